@@ -78,7 +78,9 @@ struct _p_BV {
   PetscBool          indef;        /* matrix is indefinite */
   BVMatMultType      vmm;          /* version of matmult operation */
   PetscBool          rrandom;      /* reproducible random vectors */
+  PetscInt           rctr;         /* column counter for reproducible random vectors */
   PetscReal          deftol;       /* tolerance for BV_SafeSqrt */
+  PetscBool          deterministic;/* fixed-order deterministic reductions */
 
   /*---------------------- Cached data and workspace -------------------*/
   Vec                buffer;       /* buffer vector used in orthogonalization */
@@ -95,6 +97,9 @@ struct _p_BV {
   PetscBool          defersfo;     /* deferred call to setfromoptions */
   BV                 cached;       /* cached BV to store result of matrix times BV */
   PetscObjectState   bvstate;      /* state of BV when BVApplyMatrixBV() was called */
+  PetscObjectState   cstate;       /* BV state accounted for by single-column modifications */
+  PetscInt           cvalidl;      /* first cached column holding a current product */
+  PetscInt           cvalid;       /* cached columns [cvalidl,cvalid) hold a current product */
   BV                 L,R;          /* BV objects obtained with BVGetSplit() */
   PetscObjectState   lstate,rstate;/* state of L and R when BVGetSplit() was called */
   PetscInt           lsplit;       /* the value of l when BVGetSplit() was called */
@@ -103,10 +108,16 @@ struct _p_BV {
   PetscRandom        rand;         /* random number generator */
   Mat                Acreate;      /* matrix given at BVCreateFromMat() */
   Mat                Aget;         /* matrix returned for BVGetMat() */
-  PetscBool          cuda;         /* true if GPU must be used */
+  PetscObjectState   Agetstate;    /* state of Aget at BVGetMat(), to detect modification */
+  PetscBool          cuda;         /* true if a CUDA GPU must be used */
+  PetscBool          hip;          /* true if a HIP GPU must be used */
   PetscBool          sfocalled;    /* setfromoptions has been called */
   PetscScalar        *work;
   PetscInt           lwork;
+#if defined(PETSC_HAVE_CUDA) || defined(PETSC_HAVE_HIP)
+  PetscScalar        *d_work;      /* persistent device workspace */
+  PetscInt           d_lwork;      /* allocated size of d_work */
+#endif
   void               *data;
 };
 
@@ -154,17 +165,39 @@ static inline PetscErrorCode BV_IPMatMult(BV bv,Vec x)
 
 /*
   BV_IPMatMultBV - Multiply BV by the inner-product matrix, cache the
-  result internally in bv->cached.
+  result internally in bv->cached. If the cache is stale only because
+  single columns were modified (the common situation in a Krylov iteration,
+  where columns are appended one at a time), the matrix is reapplied just to
+  the columns past the valid prefix instead of to the whole active block.
 */
 static inline PetscErrorCode BV_IPMatMultBV(BV bv)
 {
+  PetscObjectState state;
+  PetscInt         start,savel;
+
   PetscFunctionBegin;
   PetscCall(BVGetCachedBV(bv,&bv->cached));
-  if (((PetscObject)bv)->state != bv->bvstate || bv->l != bv->cached->l || bv->k != bv->cached->k) {
-    PetscCall(BVSetActiveColumns(bv->cached,bv->l,bv->k));
-    if (bv->matrix) PetscCall(BVMatMult(bv,bv->matrix,bv->cached));
-    else PetscCall(BVCopy(bv,bv->cached));
-    bv->bvstate = ((PetscObject)bv)->state;
+  state = ((PetscObject)bv)->state;
+  if (state != bv->bvstate || bv->l != bv->cached->l || bv->k != bv->cached->k) {
+    if (bv->matrix && state == bv->cstate && bv->l >= bv->cvalidl && bv->cvalid > bv->l) {
+      start = PetscMin(bv->cvalid,bv->k);
+      if (start < bv->k) {
+        savel = bv->l;
+        bv->l = start;
+        PetscCall(BVSetActiveColumns(bv->cached,start,bv->k));
+        PetscCall(BVMatMult(bv,bv->matrix,bv->cached));
+        bv->l = savel;
+      }
+      PetscCall(BVSetActiveColumns(bv->cached,bv->l,bv->k));
+    } else {
+      PetscCall(BVSetActiveColumns(bv->cached,bv->l,bv->k));
+      if (bv->matrix) PetscCall(BVMatMult(bv,bv->matrix,bv->cached));
+      else PetscCall(BVCopy(bv,bv->cached));
+      bv->cvalidl = bv->l;
+    }
+    bv->cvalid  = bv->k;
+    bv->bvstate = state;
+    bv->cstate  = state;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -191,6 +224,12 @@ static inline PetscErrorCode BV_AllocateSignature(BV bv)
       PetscCall(VecCreateSeqCUDA(PETSC_COMM_SELF,bv->nc+bv->m,&bv->omega));
 #else
       SETERRQ(PetscObjectComm((PetscObject)bv),PETSC_ERR_PLIB,"Something wrong happened");
+#endif
+    } else if (bv->hip) {
+#if defined(PETSC_HAVE_HIP)
+      PetscCall(VecCreateSeqHIP(PETSC_COMM_SELF,bv->nc+bv->m,&bv->omega));
+#else
+      SETERRQ(PetscObjectComm((PetscObject)bv),PETSC_ERR_PLIB,"Something wrong happened");
 #endif
     } else PetscCall(VecCreateSeq(PETSC_COMM_SELF,bv->nc+bv->m,&bv->omega));
     PetscCall(VecSet(bv->omega,1.0));
@@ -251,6 +290,9 @@ SLEPC_INTERN PetscErrorCode BVView_Vecs(BV,PetscViewer);
 
 SLEPC_INTERN PetscErrorCode BVAllocateWork_Private(BV,PetscInt);
 
+SLEPC_INTERN PetscErrorCode BVAllReduceSum_Private(BV,const PetscScalar*,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode BVAllReduceSumReal_Private(BV,const PetscReal*,PetscReal*,PetscInt);
+
 SLEPC_INTERN PetscErrorCode BVMult_BLAS_Private(BV,PetscInt,PetscInt,PetscInt,PetscScalar,const PetscScalar*,PetscInt,const PetscScalar*,PetscInt,PetscScalar,PetscScalar*,PetscInt);
 SLEPC_INTERN PetscErrorCode BVMultVec_BLAS_Private(BV,PetscInt,PetscInt,PetscScalar,const PetscScalar*,PetscInt,const PetscScalar*,PetscScalar,PetscScalar*);
 SLEPC_INTERN PetscErrorCode BVMultInPlace_BLAS_Private(BV,PetscInt,PetscInt,PetscInt,PetscInt,PetscScalar*,PetscInt,const PetscScalar*,PetscInt,PetscBool);
@@ -408,6 +450,17 @@ static inline PetscErrorCode BV_StoreCoefficients_Default(BV bv,PetscInt j,Petsc
 /*
   BV_GetEigenvector - retrieves k-th eigenvector from basis vectors V.
   The argument eigi is the imaginary part of the corresponding eigenvalue.
+
+  In real scalars, the two members of a complex conjugate pair are stored as
+  consecutive columns (real part, imaginary part). An alternative interleaved
+  packing of the pair within a single column buffer, which would let
+  elementwise postprocessing such as modulus or phase traverse one contiguous
+  stream, cannot be offered: every BV column must remain addressable as a
+  regular Vec through BVGetColumn(), since the columns are handed directly to
+  ST, KSP and Mat operations, and the projected-problem interplay with DS also
+  assumes the split layout on both sides of the products. Fused postprocessing
+  should instead read the two columns in a single pass, which traverses the
+  same amount of memory as an interleaved layout would.
 */
 static inline PetscErrorCode BV_GetEigenvector(BV V,PetscInt k,PetscScalar eigi,Vec Vr,Vec Vi)
 {
@@ -475,8 +528,24 @@ static inline PetscErrorCode BV_SetDefaultLD(BV bv,PetscInt nloc)
 
 #if defined(PETSC_HAVE_CUDA)
 /*
-   BV_MatDenseCUDAGetArrayRead - if Q is MATSEQDENSE it will allocate memory on the
-   GPU and copy the contents; otherwise, calls MatDenseCUDAGetArrayRead()
+   BV_AllocateWorkCUDA - Make sure the device workspace of the BV object can
+   hold at least n scalars, growing it if necessary. The workspace persists
+   until the BV is destroyed, so hot-path calls do not allocate
+*/
+static inline PetscErrorCode BV_AllocateWorkCUDA(BV bv,PetscInt n)
+{
+  PetscFunctionBegin;
+  if (n>bv->d_lwork) {
+    PetscCallCUDA(cudaFree(bv->d_work));
+    PetscCallCUDA(cudaMalloc((void**)&bv->d_work,n*sizeof(PetscScalar)));
+    bv->d_lwork = n;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   BV_MatDenseCUDAGetArrayRead - if Q is MATSEQDENSE it will stage the contents
+   through the BV device workspace; otherwise, calls MatDenseCUDAGetArrayRead()
 */
 static inline PetscErrorCode BV_MatDenseCUDAGetArrayRead(BV bv,Mat Q,const PetscScalar **d_q)
 {
@@ -486,7 +555,6 @@ static inline PetscErrorCode BV_MatDenseCUDAGetArrayRead(BV bv,Mat Q,const Petsc
   PetscBool         matiscuda;
 
   PetscFunctionBegin;
-  (void)bv; // avoid unused parameter warning
   PetscCall(MatGetSize(Q,NULL,&mq));
   PetscCall(MatDenseGetLDA(Q,&ldq));
   PetscCall(PetscCuBLASIntCast(ldq,&ldq_));
@@ -494,7 +562,8 @@ static inline PetscErrorCode BV_MatDenseCUDAGetArrayRead(BV bv,Mat Q,const Petsc
   if (matiscuda) PetscCall(MatDenseCUDAGetArrayRead(Q,d_q));
   else {
     PetscCall(MatDenseGetArrayRead(Q,&q));
-    PetscCallCUDA(cudaMalloc((void**)d_q,ldq*mq*sizeof(PetscScalar)));
+    PetscCall(BV_AllocateWorkCUDA(bv,ldq*mq));
+    *d_q = bv->d_work;
     PetscCallCUDA(cudaMemcpy((void*)*d_q,q,ldq*mq*sizeof(PetscScalar),cudaMemcpyHostToDevice));
     PetscCall(PetscLogCpuToGpu(ldq*mq*sizeof(PetscScalar)));
   }
@@ -502,8 +571,8 @@ static inline PetscErrorCode BV_MatDenseCUDAGetArrayRead(BV bv,Mat Q,const Petsc
 }
 
 /*
-   BV_MatDenseCUDARestoreArrayRead - restores the pointer obtained with BV_MatDenseCUDAGetArrayRead(),
-   freeing the GPU memory in case of MATSEQDENSE
+   BV_MatDenseCUDARestoreArrayRead - restores the pointer obtained with BV_MatDenseCUDAGetArrayRead();
+   in case of MATSEQDENSE the staging memory is kept in the BV workspace for reuse
 */
 static inline PetscErrorCode BV_MatDenseCUDARestoreArrayRead(BV bv,Mat Q,const PetscScalar **d_q)
 {
@@ -515,7 +584,6 @@ static inline PetscErrorCode BV_MatDenseCUDARestoreArrayRead(BV bv,Mat Q,const P
   if (matiscuda) PetscCall(MatDenseCUDARestoreArrayRead(Q,d_q));
   else {
     PetscCall(MatDenseRestoreArrayRead(Q,NULL));
-    PetscCallCUDA(cudaFree((void*)*d_q));
     *d_q = NULL;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -547,6 +615,95 @@ SLEPC_INTERN PetscErrorCode BV_StoreCoefficients_CUDA(BV,PetscInt,PetscScalar*,P
 #define BV_ApplySignature(a,b,c,d)    ((a)->cuda?BV_ApplySignature_CUDA:BV_ApplySignature_Default)((a),(b),(c),(d))
 #define BV_SquareRoot(a,b,c,d)        ((a)->cuda?BV_SquareRoot_CUDA:BV_SquareRoot_Default)((a),(b),(c),(d))
 #define BV_StoreCoefficients(a,b,c,d) ((a)->cuda?BV_StoreCoefficients_CUDA:BV_StoreCoefficients_Default)((a),(b),(c),(d))
+#elif defined(PETSC_HAVE_HIP)
+/*
+   BV_AllocateWorkHIP - Make sure the device workspace of the BV object can
+   hold at least n scalars, growing it if necessary. The workspace persists
+   until the BV is destroyed, so hot-path calls do not allocate
+*/
+static inline PetscErrorCode BV_AllocateWorkHIP(BV bv,PetscInt n)
+{
+  PetscFunctionBegin;
+  if (n>bv->d_lwork) {
+    PetscCallHIP(hipFree(bv->d_work));
+    PetscCallHIP(hipMalloc((void**)&bv->d_work,n*sizeof(PetscScalar)));
+    bv->d_lwork = n;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   BV_MatDenseHIPGetArrayRead - if Q is MATSEQDENSE it will stage the contents
+   through the BV device workspace; otherwise, calls MatDenseHIPGetArrayRead()
+*/
+static inline PetscErrorCode BV_MatDenseHIPGetArrayRead(BV bv,Mat Q,const PetscScalar **d_q)
+{
+  const PetscScalar *q;
+  PetscInt          ldq,mq;
+  PetscHipBLASInt   ldq_=0;
+  PetscBool         matiship;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(Q,NULL,&mq));
+  PetscCall(MatDenseGetLDA(Q,&ldq));
+  PetscCall(PetscHipBLASIntCast(ldq,&ldq_));
+  PetscCall(PetscObjectTypeCompare((PetscObject)Q,MATSEQDENSEHIP,&matiship));
+  if (matiship) PetscCall(MatDenseHIPGetArrayRead(Q,d_q));
+  else {
+    PetscCall(MatDenseGetArrayRead(Q,&q));
+    PetscCall(BV_AllocateWorkHIP(bv,ldq*mq));
+    *d_q = bv->d_work;
+    PetscCallHIP(hipMemcpy((void*)*d_q,q,ldq*mq*sizeof(PetscScalar),hipMemcpyHostToDevice));
+    PetscCall(PetscLogCpuToGpu(ldq*mq*sizeof(PetscScalar)));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   BV_MatDenseHIPRestoreArrayRead - restores the pointer obtained with BV_MatDenseHIPGetArrayRead();
+   in case of MATSEQDENSE the staging memory is kept in the BV workspace for reuse
+*/
+static inline PetscErrorCode BV_MatDenseHIPRestoreArrayRead(BV bv,Mat Q,const PetscScalar **d_q)
+{
+  PetscBool matiship;
+
+  PetscFunctionBegin;
+  (void)bv; // avoid unused parameter warning
+  PetscCall(PetscObjectTypeCompare((PetscObject)Q,MATSEQDENSEHIP,&matiship));
+  if (matiship) PetscCall(MatDenseHIPRestoreArrayRead(Q,d_q));
+  else {
+    PetscCall(MatDenseRestoreArrayRead(Q,NULL));
+    *d_q = NULL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+SLEPC_INTERN PetscErrorCode BVMult_BLAS_HIP(BV,PetscInt,PetscInt,PetscInt,PetscScalar,const PetscScalar*,PetscInt,const PetscScalar*,PetscInt,PetscScalar,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode BVMultVec_BLAS_HIP(BV,PetscInt,PetscInt,PetscScalar,const PetscScalar*,PetscInt,const PetscScalar*,PetscScalar,PetscScalar*);
+SLEPC_INTERN PetscErrorCode BVMultInPlace_BLAS_HIP(BV,PetscInt,PetscInt,PetscInt,PetscInt,PetscScalar*,PetscInt,const PetscScalar*,PetscInt,PetscBool);
+SLEPC_INTERN PetscErrorCode BVAXPY_BLAS_HIP(BV,PetscInt,PetscInt,PetscScalar,const PetscScalar*,PetscInt,PetscScalar,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode BVDot_BLAS_HIP(BV,PetscInt,PetscInt,PetscInt,const PetscScalar*,PetscInt,const PetscScalar*,PetscInt,PetscScalar*,PetscInt,PetscBool);
+SLEPC_INTERN PetscErrorCode BVDotVec_BLAS_HIP(BV,PetscInt,PetscInt,const PetscScalar*,PetscInt,const PetscScalar*,PetscScalar*,PetscBool);
+SLEPC_INTERN PetscErrorCode BVScale_BLAS_HIP(BV,PetscInt,PetscScalar*,PetscScalar);
+SLEPC_INTERN PetscErrorCode BVNorm_BLAS_HIP(BV,PetscInt,const PetscScalar*,PetscReal*);
+SLEPC_INTERN PetscErrorCode BVNormalize_BLAS_HIP(BV,PetscInt,PetscInt,PetscScalar*,PetscInt,PetscScalar*);
+
+SLEPC_INTERN PetscErrorCode BV_ConjugateHIPArray(PetscScalar*,PetscInt);
+
+SLEPC_INTERN PetscErrorCode BV_CleanCoefficients_HIP(BV,PetscInt,PetscScalar*);
+SLEPC_INTERN PetscErrorCode BV_AddCoefficients_HIP(BV,PetscInt,PetscScalar*,PetscScalar*);
+SLEPC_INTERN PetscErrorCode BV_SetValue_HIP(BV,PetscInt,PetscInt,PetscScalar*,PetscScalar);
+SLEPC_INTERN PetscErrorCode BV_SquareSum_HIP(BV,PetscInt,PetscScalar*,PetscReal*);
+SLEPC_INTERN PetscErrorCode BV_ApplySignature_HIP(BV,PetscInt,PetscScalar*,PetscBool);
+SLEPC_INTERN PetscErrorCode BV_SquareRoot_HIP(BV,PetscInt,PetscScalar*,PetscReal*);
+SLEPC_INTERN PetscErrorCode BV_StoreCoefficients_HIP(BV,PetscInt,PetscScalar*,PetscScalar*);
+#define BV_CleanCoefficients(a,b,c)   ((a)->hip?BV_CleanCoefficients_HIP:BV_CleanCoefficients_Default)((a),(b),(c))
+#define BV_AddCoefficients(a,b,c,d)   ((a)->hip?BV_AddCoefficients_HIP:BV_AddCoefficients_Default)((a),(b),(c),(d))
+#define BV_SetValue(a,b,c,d,e)        ((a)->hip?BV_SetValue_HIP:BV_SetValue_Default)((a),(b),(c),(d),(e))
+#define BV_SquareSum(a,b,c,d)         ((a)->hip?BV_SquareSum_HIP:BV_SquareSum_Default)((a),(b),(c),(d))
+#define BV_ApplySignature(a,b,c,d)    ((a)->hip?BV_ApplySignature_HIP:BV_ApplySignature_Default)((a),(b),(c),(d))
+#define BV_SquareRoot(a,b,c,d)        ((a)->hip?BV_SquareRoot_HIP:BV_SquareRoot_Default)((a),(b),(c),(d))
+#define BV_StoreCoefficients(a,b,c,d) ((a)->hip?BV_StoreCoefficients_HIP:BV_StoreCoefficients_Default)((a),(b),(c),(d))
 #else
 #define BV_CleanCoefficients(a,b,c)   BV_CleanCoefficients_Default((a),(b),(c))
 #define BV_AddCoefficients(a,b,c,d)   BV_AddCoefficients_Default((a),(b),(c),(d))
@@ -555,4 +712,4 @@ SLEPC_INTERN PetscErrorCode BV_StoreCoefficients_CUDA(BV,PetscInt,PetscScalar*,P
 #define BV_ApplySignature(a,b,c,d)    BV_ApplySignature_Default((a),(b),(c),(d))
 #define BV_SquareRoot(a,b,c,d)        BV_SquareRoot_Default((a),(b),(c),(d))
 #define BV_StoreCoefficients(a,b,c,d) BV_StoreCoefficients_Default((a),(b),(c),(d))
-#endif /* PETSC_HAVE_CUDA */
+#endif /* PETSC_HAVE_CUDA || PETSC_HAVE_HIP */
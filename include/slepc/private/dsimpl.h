@@ -20,6 +20,10 @@ SLEPC_EXTERN PetscErrorCode DSRegisterAll(void);
 SLEPC_EXTERN PetscLogEvent DS_Solve,DS_Vectors,DS_Synchronize,DS_Other;
 SLEPC_INTERN const char *DSMatName[];
 
+/* True if the matrices are stored in node-shared memory, implying that
+   operations that modify them are done by the node leader only */
+#define DSNodeSharedActive(ds) ((ds)->shmem && (ds)->nodesize>1)
+
 typedef struct _DSOps *DSOps;
 
 struct _DSOps {
@@ -58,9 +62,22 @@ struct _p_DS {
   PetscInt       bs;                 /* block size */
   SlepcSC        sc;                 /* sorting criterion */
   DSParallelType pmode;              /* parallel mode (redundant, synchronized, distributed) */
+  PetscInt       nthreads;           /* number of BLAS threads to be used in DSSolve (0=unchanged) */
+  PetscInt       swindow;            /* number of leading eigenvalues that must be sorted (0=all) */
+  PetscBool      shmem;              /* node-shared storage of the matrices allocated at DSAllocate() */
+  PetscInt       methodmagma;        /* MAGMA-backed method, eligible for automatic selection (-1=none) */
 
   /*----------------- Status variables and working data ----------------*/
   Mat            omat[DS_NUM_MAT];   /* the matrices (PETSc object) */
+#if !defined(PETSC_HAVE_MPIUNI)
+  MPI_Win        win[DS_NUM_MAT];    /* MPI windows backing the node-shared matrices */
+#endif
+  MPI_Comm       nodecomm;           /* communicator of processes sharing the node-local matrices */
+  PetscMPIInt    noderank;           /* rank of this process within nodecomm */
+  PetscMPIInt    nodesize;           /* number of processes in nodecomm */
+  PetscBool      allocating;         /* inside DSAllocate(), where node-shared matrices are created */
+  PetscBool      vecsdone[DS_NUM_MAT]; /* indicates the vectors on each matrix are up to date */
+  PetscObjectState vecstate;         /* object state after the cached vectors were computed */
   PetscInt       *perm;              /* permutation */
   void           *data;              /* placeholder for solver-specific stuff */
   PetscBool      scset;              /* the sc was provided by the user */
@@ -107,6 +124,7 @@ struct _p_DS {
 #endif
 
 SLEPC_INTERN PetscErrorCode DSAllocateMat_Private(DS,DSMatType);
+SLEPC_INTERN PetscErrorCode DSNodeShareResult_Private(DS,PetscScalar[],PetscScalar[]);
 SLEPC_INTERN PetscErrorCode DSAllocateWork_Private(DS,PetscInt,PetscInt,PetscInt);
 SLEPC_INTERN PetscErrorCode DSSortEigenvalues_Private(DS,PetscScalar*,PetscScalar*,PetscInt*,PetscBool);
 SLEPC_INTERN PetscErrorCode DSSortEigenvaluesReal_Private(DS,PetscReal*,PetscInt*);
@@ -126,6 +144,7 @@ SLEPC_INTERN PetscErrorCode DSGHIEPRealBlocks(DS);
 SLEPC_INTERN PetscErrorCode DSSolve_GHIEP_HZ(DS,PetscScalar*,PetscScalar*);
 SLEPC_INTERN PetscErrorCode DSArrowTridiag(PetscBLASInt,PetscReal*,PetscReal*,PetscScalar*,PetscBLASInt);
 
+SLEPC_INTERN void DSSolveKernel_NHEP_Private(PetscBLASInt,PetscBLASInt,PetscBLASInt,PetscBool,PetscInt,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*,PetscBLASInt,PetscBLASInt*,PetscBLASInt*);
 SLEPC_INTERN PetscErrorCode DSSolve_NHEP_Private(DS,DSMatType,DSMatType,PetscScalar*,PetscScalar*);
 SLEPC_INTERN PetscErrorCode DSSort_NHEP_Total(DS,DSMatType,DSMatType,PetscScalar*,PetscScalar*);
 SLEPC_INTERN PetscErrorCode DSSortWithPermutation_NHEP_Private(DS,PetscInt*,DSMatType,DSMatType,PetscScalar*,PetscScalar*);
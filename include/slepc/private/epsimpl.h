@@ -12,6 +12,7 @@
 
 #include <slepceps.h>
 #include <slepc/private/slepcimpl.h>
+#include <slepc/private/vecimplslepc.h>
 
 /* SUBMANSEC = EPS */
 
@@ -51,6 +52,15 @@ typedef enum { EPS_STATE_INITIAL,
                EPS_STATE_SOLVED,
                EPS_STATE_EIGENVECTORS } EPSStateType;
 
+/* Snapshot of the solver state published in shared memory, see -eps_state_shm */
+typedef struct {
+  PetscInt  state;             /* EPSStateType value */
+  PetscInt  its;               /* iterations so far */
+  PetscInt  nconv;             /* converged pairs so far */
+  PetscReal errest;            /* error estimate of the first unconverged pair */
+  PetscInt  seq;               /* update counter, samplers use it to detect progress */
+} EPSStateShm;
+
 /*
    To classify the different solvers into categories
 */
@@ -82,6 +92,8 @@ struct _p_EPS {
   PetscInt       ncv;              /* number of basis vectors */
   PetscInt       mpd;              /* maximum dimension of projected problem */
   PetscInt       nini,ninil;       /* number of initial vectors (negative means not copied yet) */
+  PetscInt       finispace;        /* number of filtered random initial vectors to generate */
+  PetscInt       finideg;          /* polynomial degree of the initial space filter */
   PetscInt       nds;              /* number of basis vectors of deflation space */
   PetscScalar    target;           /* target value */
   PetscReal      tol;              /* tolerance */
@@ -98,6 +110,8 @@ struct _p_EPS {
   PetscBool      trackall;         /* whether all the residuals must be computed */
   PetscBool      purify;           /* whether eigenvectors need to be purified */
   PetscBool      twosided;         /* whether to compute left eigenvectors (two-sided solver) */
+  PetscBool      reuseprev;        /* reuse previous solution as initial space in the next solve */
+  PetscInt       nred;             /* number of subcommunicators for redundant solves (1=disabled) */
 
   /*-------------- User-provided functions and contexts -----------------*/
   PetscErrorCode (*converged)(EPS,PetscScalar,PetscScalar,PetscReal,PetscReal*,void*);
@@ -107,9 +121,12 @@ struct _p_EPS {
   PetscErrorCode (*stoppinguser)(EPS,PetscInt,PetscInt,PetscInt,PetscInt,EPSConvergedReason*,void*);
   PetscErrorCode (*stoppingdestroy)(void*);
   PetscErrorCode (*arbitrary)(PetscScalar,PetscScalar,Vec,Vec,PetscScalar*,PetscScalar*,void*);
+  PetscErrorCode (*convergedhandler)(EPS,PetscInt,PetscInt,PetscBool*,void*);
+  PetscErrorCode (*convergedhandlerdestroy)(void*);
   void           *convergedctx;
   void           *stoppingctx;
   void           *arbitraryctx;
+  void           *convergedhandlerctx;
   PetscErrorCode (*monitor[MAXEPSMONITORS])(EPS,PetscInt,PetscInt,PetscScalar*,PetscScalar*,PetscReal*,PetscInt,void*);
   PetscErrorCode (*monitordestroy[MAXEPSMONITORS])(void**);
   void           *monitorcontext[MAXEPSMONITORS];
@@ -131,6 +148,7 @@ struct _p_EPS {
   PetscInt       *perm;            /* permutation for eigenvalue ordering */
   PetscInt       nwork;            /* number of work vectors */
   Vec            *work;            /* work vectors */
+  VecPool        pool;             /* pool of temporaries for residual checks */
   void           *data;            /* placeholder for solver-specific stuff */
 
   /* ----------------------- Status variables --------------------------*/
@@ -138,8 +156,14 @@ struct _p_EPS {
   EPSSolverType  categ;            /* solver category */
   PetscInt       nconv;            /* number of converged eigenvalues */
   PetscInt       its;              /* number of iterations so far computed */
+  PetscInt       ondemand;         /* eigenvectors extracted on demand since the last solve */
+  EPSStateShm    *shmstate;        /* solver state published in shared memory, see -eps_state_shm */
+  PetscInt       shmid;            /* id of the shared memory segment */
+  PetscViewer    vstream;          /* viewer where converged vectors are streamed during the solve */
+  PetscInt       nviewed;          /* number of basis vectors already streamed */
   PetscInt       n,nloc;           /* problem dimensions (global, local) */
   PetscReal      nrma,nrmb;        /* computed matrix norms */
+  PetscBool      balancedone;      /* balancing matrix is up to date for the current operators */
   PetscBool      useds;            /* whether the solver uses the DS object or not */
   PetscBool      isgeneralized;
   PetscBool      ispositive;
@@ -323,6 +347,11 @@ static inline PetscErrorCode EPS_KSPSetOperators(KSP ksp,Mat A,Mat B)
 SLEPC_INTERN PetscErrorCode EPSSetWhichEigenpairs_Default(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetDimensions_Default(EPS,PetscInt,PetscInt*,PetscInt*);
 SLEPC_INTERN PetscErrorCode EPSBackTransform_Default(EPS);
+SLEPC_INTERN PetscErrorCode EPSStateShmSetUp(EPS,PetscInt);
+SLEPC_INTERN PetscErrorCode EPSStateShmDetach(EPS);
+SLEPC_INTERN PetscErrorCode EPSVectorsViewStreamSetUp(EPS);
+SLEPC_INTERN PetscErrorCode EPSVectorsViewStream(EPS);
+SLEPC_INTERN PetscErrorCode EPSVectorsViewStreamFinish(EPS);
 SLEPC_INTERN PetscErrorCode EPSComputeVectors(EPS);
 SLEPC_INTERN PetscErrorCode EPSComputeVectors_Hermitian(EPS);
 SLEPC_INTERN PetscErrorCode EPSComputeVectors_Schur(EPS);
@@ -339,6 +368,7 @@ SLEPC_INTERN PetscErrorCode MatEstimateSpectralRange_EPS(Mat,PetscReal*,PetscRea
 
 SLEPC_INTERN PetscErrorCode EPSDelayedArnoldi(EPS,PetscScalar*,PetscInt,PetscInt,PetscInt*,PetscReal*,PetscBool*);
 SLEPC_INTERN PetscErrorCode EPSDelayedArnoldi1(EPS,PetscScalar*,PetscInt,PetscInt,PetscInt*,PetscReal*,PetscBool*);
+SLEPC_INTERN PetscErrorCode EPSCAArnoldi(EPS,PetscScalar*,PetscInt,PetscInt,PetscInt*,PetscInt,PetscReal*,PetscBool*);
 SLEPC_INTERN PetscErrorCode EPSKrylovConvergence(EPS,PetscBool,PetscInt,PetscInt,PetscReal,PetscReal,PetscReal,PetscInt*);
 SLEPC_INTERN PetscErrorCode EPSPseudoLanczos(EPS,PetscReal*,PetscReal*,PetscReal*,PetscInt,PetscInt*,PetscBool*,PetscBool*,PetscReal*,Vec);
 SLEPC_INTERN PetscErrorCode EPSBuildBalance_Krylov(EPS);
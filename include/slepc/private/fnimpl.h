@@ -24,10 +24,13 @@ typedef struct _FNOps *FNOps;
 struct _FNOps {
   PetscErrorCode (*evaluatefunction)(FN,PetscScalar,PetscScalar*);
   PetscErrorCode (*evaluatederivative)(FN,PetscScalar,PetscScalar*);
+  PetscErrorCode (*evaluatefunctionarray)(FN,PetscInt,PetscScalar*,PetscScalar*);
   PetscErrorCode (*evaluatefunctionmat[FN_MAX_SOLVE])(FN,Mat,Mat);
   PetscErrorCode (*evaluatefunctionmatcuda[FN_MAX_SOLVE])(FN,Mat,Mat);
+  PetscErrorCode (*evaluatefunctionmathip[FN_MAX_SOLVE])(FN,Mat,Mat);
   PetscErrorCode (*evaluatefunctionmatvec[FN_MAX_SOLVE])(FN,Mat,Vec);
   PetscErrorCode (*evaluatefunctionmatveccuda[FN_MAX_SOLVE])(FN,Mat,Vec);
+  PetscErrorCode (*evaluatefunctionmatvechip[FN_MAX_SOLVE])(FN,Mat,Vec);
   PetscErrorCode (*setfromoptions)(FN,PetscOptionItems*);
   PetscErrorCode (*view)(FN,PetscViewer);
   PetscErrorCode (*duplicate)(FN,MPI_Comm,FN*);
@@ -36,6 +39,8 @@ struct _FNOps {
 
 #define FN_MAX_W 6
 
+#define FN_MEMOIZE_SIZE 257      /* number of slots of the memoization table */
+
 struct _p_FN {
   PETSCHEADER(struct _FNOps);
   /*------------------------- User parameters --------------------------*/
@@ -43,11 +48,15 @@ struct _p_FN {
   PetscScalar    beta;           /* outer scaling (result) */
   PetscInt       method;         /* the method to compute matrix functions */
   FNParallelType pmode;          /* parallel mode (redundant or synchronized) */
+  PetscBool      memoize;        /* whether scalar evaluations are cached */
 
   /*---------------------- Cached data and workspace -------------------*/
   Mat            W[FN_MAX_W];    /* workspace matrices */
   PetscInt       nw;             /* number of allocated W matrices */
   PetscInt       cw;             /* current W matrix */
+  PetscScalar    *memox,*memoy;  /* memoization table for function evaluations */
+  PetscScalar    *memoxd,*memoyd;/* memoization table for derivative evaluations */
+  PetscBool      *memof,*memofd; /* flags marking occupied slots of the tables */
   void           *data;
 };
 
@@ -108,3 +117,6 @@ SLEPC_INTERN PetscErrorCode FNSqrtmDenmanBeavers_CUDAm(FN,PetscBLASInt,PetscScal
 SLEPC_INTERN PetscErrorCode FNSqrtmNewtonSchulz_CUDA(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
 SLEPC_INTERN PetscErrorCode FNSqrtmSadeghi_CUDAm(FN,PetscBLASInt,PetscScalar*,PetscBLASInt);
 #endif
+#if defined(PETSC_HAVE_HIP)
+SLEPC_INTERN PetscErrorCode FNSqrtmNewtonSchulz_HIP(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
+#endif
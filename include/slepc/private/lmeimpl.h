@@ -51,6 +51,7 @@ struct _p_LME {
   PetscInt       max_it;         /* maximum number of iterations */
   PetscInt       ncv;            /* number of basis vectors */
   PetscReal      tol;            /* tolerance */
+  PetscReal      ranktol;        /* relative tolerance for rank truncation of the solution */
   PetscBool      errorifnotconverged;    /* error out if LMESolve() does not converge */
 
   /*-------------- User-provided functions and contexts -----------------*/
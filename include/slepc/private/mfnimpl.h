@@ -25,6 +25,7 @@ typedef struct _MFNOps *MFNOps;
 
 struct _MFNOps {
   PetscErrorCode (*solve)(MFN,Vec,Vec);
+  PetscErrorCode (*solvemat)(MFN,Mat,Mat);
   PetscErrorCode (*setup)(MFN);
   PetscErrorCode (*setfromoptions)(MFN,PetscOptionItems*);
   PetscErrorCode (*publishoptions)(MFN);
@@ -87,6 +87,7 @@ struct _p_NEP {
   NEPRefineScheme scheme;          /* scheme for solving linear systems within refinement */
   PetscBool      trackall;         /* whether all the residuals must be computed */
   PetscBool      twosided;         /* whether to compute left eigenvectors (two-sided solver) */
+  PetscBool      cachet;           /* cache the transposes of the split matrices */
 
   /*-------------- User-provided functions and contexts -----------------*/
   PetscErrorCode (*computefunction)(NEP,PetscScalar,Mat,Mat,void*);
@@ -121,6 +122,7 @@ struct _p_NEP {
   MatStructure   mstr;             /* pattern of split matrices */
   Mat            *P;               /* matrix coefficients of split form (preconditioner) */
   MatStructure   mstrp;            /* pattern of split matrices (preconditioner) */
+  Mat            *AT;              /* cached transposes of the split matrices */
   Vec            *IS;              /* references to user-provided initial space */
   PetscScalar    *eigr,*eigi;      /* real and imaginary parts of eigenvalues */
   PetscReal      *errest;          /* error estimates */
@@ -25,7 +25,9 @@ struct _RGOps {
   PetscErrorCode (*computecontour)(RG,PetscInt,PetscScalar*,PetscScalar*);
   PetscErrorCode (*computebbox)(RG,PetscReal*,PetscReal*,PetscReal*,PetscReal*);
   PetscErrorCode (*computequadrature)(RG,RGQuadRule,PetscInt,PetscScalar*,PetscScalar*,PetscScalar*);
+  PetscErrorCode (*computequadratureadaptive)(RG,RGQuadRule,PetscInt,const PetscScalar*,PetscInt,PetscScalar*,PetscScalar*,PetscScalar*);
   PetscErrorCode (*checkinside)(RG,PetscReal,PetscReal,PetscInt*);
+  PetscErrorCode (*checkinsidearray)(RG,PetscInt,const PetscReal*,const PetscReal*,PetscInt*);
   PetscErrorCode (*isaxisymmetric)(RG,PetscBool,PetscBool*);
   PetscErrorCode (*setfromoptions)(RG,PetscOptionItems*);
   PetscErrorCode (*view)(RG,PetscViewer);
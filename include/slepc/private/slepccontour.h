@@ -30,6 +30,7 @@ static inline PetscErrorCode CISS_BlockHankel(PetscScalar *Mu,PetscInt s,PetscIn
 
 SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcCISS_isGhost(Mat,PetscInt,PetscReal*,PetscReal,PetscBool*);
 SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcCISS_BH_SVD(PetscScalar*,PetscInt,PetscReal,PetscReal*,PetscInt*);
+SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcCISS_BH_SVD_Adaptive(PetscScalar*,PetscInt,PetscInt,PetscInt,PetscReal,PetscScalar*,PetscReal*,PetscInt*,PetscInt*);
 
 /* Data structures and functions for contour integral methods (used in several classes) */
 struct _n_SlepcContourData {
@@ -187,4 +187,95 @@ static inline PetscErrorCode SlepcKernelSetGrid2DTiles(PetscInt rows,PetscInt co
 }
 #undef X_AXIS
 #undef Y_AXIS
+
+/* Stream-ordered allocation of short-lived device temporaries, so that repeated
+   solver iterations do not pay a device synchronization per allocation. Falls
+   back to plain cudaMalloc on toolkits without the asynchronous pool allocator. */
+#if CUDART_VERSION >= 11020
+#define SlepcDeviceMallocAsync(ptr,bytes) cudaMallocAsync((void**)(ptr),(bytes),NULL)
+#define SlepcDeviceFreeAsync(ptr)         cudaFreeAsync((ptr),NULL)
+#else
+#define SlepcDeviceMallocAsync(ptr,bytes) cudaMalloc((void**)(ptr),(bytes))
+#define SlepcDeviceFreeAsync(ptr)         cudaFree(ptr)
+#endif
+#endif
+
+/* Definitions needed to work with HIP kernels */
+#if defined(PETSC_HAVE_HIP)
+#include <petscdevice_hip.h>
+
+#define X_AXIS 0
+#define Y_AXIS 1
+
+#define SLEPC_TILE_SIZE_X  32
+#define SLEPC_BLOCK_SIZE_X 128
+#define SLEPC_TILE_SIZE_Y  32
+#define SLEPC_BLOCK_SIZE_Y 128
+
+static inline PetscErrorCode SlepcKernelSetGrid1D(PetscInt rows,dim3 *dimGrid,dim3 *dimBlock,PetscInt *dimGrid_xcount)
+{
+  int             card;
+  hipDeviceProp_t devprop;
+
+  PetscFunctionBegin;
+  PetscCallHIP(hipGetDevice(&card));
+  PetscCallHIP(hipGetDeviceProperties(&devprop,card));
+  *dimGrid_xcount = 1;
+
+  /* X axis */
+  dimGrid->x  = 1;
+  dimBlock->x = SLEPC_BLOCK_SIZE_X;
+  if (rows>SLEPC_BLOCK_SIZE_X) dimGrid->x = (rows+SLEPC_BLOCK_SIZE_X-1)/SLEPC_BLOCK_SIZE_X;
+  else dimBlock->x = rows;
+  if (dimGrid->x>(unsigned)devprop.maxGridSize[X_AXIS]) {
+    *dimGrid_xcount = (dimGrid->x+(devprop.maxGridSize[X_AXIS]-1))/devprop.maxGridSize[X_AXIS];
+    dimGrid->x = devprop.maxGridSize[X_AXIS];
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static inline PetscErrorCode SlepcKernelSetGrid2DTiles(PetscInt rows,PetscInt cols,dim3 *dimGrid,dim3 *dimBlock,PetscInt *dimGrid_xcount,PetscInt *dimGrid_ycount)
+{
+  int             card;
+  hipDeviceProp_t devprop;
+
+  PetscFunctionBegin;
+  PetscCallHIP(hipGetDevice(&card));
+  PetscCallHIP(hipGetDeviceProperties(&devprop,card));
+  *dimGrid_xcount = *dimGrid_ycount = 1;
+
+  /* X axis */
+  dimGrid->x  = 1;
+  dimBlock->x = SLEPC_BLOCK_SIZE_X;
+  if (rows>SLEPC_BLOCK_SIZE_X*SLEPC_TILE_SIZE_X) dimGrid->x = (rows+SLEPC_BLOCK_SIZE_X*SLEPC_TILE_SIZE_X-1)/(SLEPC_BLOCK_SIZE_X*SLEPC_TILE_SIZE_X);
+  else dimBlock->x = (rows+SLEPC_TILE_SIZE_X-1)/SLEPC_TILE_SIZE_X;
+  if (dimGrid->x>(unsigned)devprop.maxGridSize[X_AXIS]) {
+    *dimGrid_xcount = (dimGrid->x+(devprop.maxGridSize[X_AXIS]-1))/devprop.maxGridSize[X_AXIS];
+    dimGrid->x = devprop.maxGridSize[X_AXIS];
+  }
+
+  /* Y axis */
+  dimGrid->y  = 1;
+  dimBlock->y = SLEPC_BLOCK_SIZE_Y;
+  if (cols>SLEPC_BLOCK_SIZE_Y*SLEPC_TILE_SIZE_Y) dimGrid->y = (cols+SLEPC_BLOCK_SIZE_Y*SLEPC_TILE_SIZE_Y-1)/(SLEPC_BLOCK_SIZE_Y*SLEPC_TILE_SIZE_Y);
+  else dimBlock->y = (cols+SLEPC_TILE_SIZE_Y-1)/SLEPC_TILE_SIZE_Y;
+  if (dimGrid->y>(unsigned)devprop.maxGridSize[Y_AXIS]) {
+    *dimGrid_ycount = (dimGrid->y+(devprop.maxGridSize[Y_AXIS]-1))/devprop.maxGridSize[Y_AXIS];
+    dimGrid->y = devprop.maxGridSize[Y_AXIS];
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#undef X_AXIS
+#undef Y_AXIS
+
+/* Stream-ordered allocation of short-lived device temporaries, so that repeated
+   solver iterations do not pay a device synchronization per allocation. Falls
+   back to plain hipMalloc on toolkits without the asynchronous pool allocator. */
+#if HIP_VERSION >= 50200000
+#define SlepcDeviceMallocAsync(ptr,bytes) hipMallocAsync((void**)(ptr),(bytes),NULL)
+#define SlepcDeviceFreeAsync(ptr)         hipFreeAsync((ptr),NULL)
+#else
+#define SlepcDeviceMallocAsync(ptr,bytes) hipMalloc((void**)(ptr),(bytes))
+#define SlepcDeviceFreeAsync(ptr)         hipFree(ptr)
+#endif
 #endif
@@ -48,6 +48,18 @@ typedef enum { ST_STATE_INITIAL,
                ST_STATE_SETUP,
                ST_STATE_UPDATED } STStateType;
 
+/*
+   Entry of the cache of factored operators, used to avoid repeating a
+   factorization when a previously visited shift is set again
+*/
+typedef struct {
+  PetscScalar      sigma;            /* shift of this entry */
+  PetscObjectState astate[2];        /* state of the user matrices when the entry was stored */
+  Mat              P;                /* matrix the factorization was computed from */
+  PC               pc;               /* preconditioner holding the factorization */
+  PetscInt         age;              /* access counter for LRU replacement */
+} STCacheEntry;
+
 struct _p_ST {
   PETSCHEADER(struct _STOps);
   /*------------------------- User parameters --------------------------*/
@@ -55,6 +67,7 @@ struct _p_ST {
   PetscInt         nmat;             /* number of user-provided matrices */
   PetscScalar      sigma;            /* value of the shift */
   PetscScalar      defsigma;         /* default value of the shift */
+  PetscReal        scale;            /* scaling factor deferred to the operator application */
   STMatMode        matmode;          /* how the transformation matrix is handled */
   MatStructure     str;              /* whether matrices have the same pattern or not */
   PetscBool        transform;        /* whether transformed matrices are computed */
@@ -64,6 +77,7 @@ struct _p_ST {
   Mat              *Psplit;          /* matrices for the split preconditioner */
   PetscInt         nsplit;           /* number of split preconditioner matrices */
   MatStructure     strp;             /* pattern of split preconditioner matrices */
+  PetscBool        adapttol;         /* whether the KSP tolerance is adapted to the outer residual */
 
   /*------------------------- Misc data --------------------------*/
   KSP              ksp;              /* linear solver used in some ST's */
@@ -80,9 +94,18 @@ struct _p_ST {
   PetscBool        opready;          /* whether Op is up-to-date or need be computed  */
   Mat              P;                /* matrix from which preconditioner is built */
   Mat              M;                /* matrix corresponding to the non-inverted part of the operator */
+  PetscReal        outertol;         /* current residual estimate of the outer iteration */
+  PetscReal        basertol;         /* relative tolerance of the KSP before any adaptation */
   PetscBool        sigma_set;        /* whether the user provided the shift or not */
   PetscBool        asymm;            /* the user matrices are all symmetric */
   PetscBool        aherm;            /* the user matrices are all hermitian */
+  STCacheEntry     *cache;           /* cache of factored operators */
+  PetscInt         cachecapacity;    /* maximum number of cached factorizations */
+  PetscInt         cachesize;        /* number of entries currently stored in the cache */
+  PetscInt         cacheage;         /* access counter for LRU replacement */
+  PetscInt         napply;           /* number of operator applications since last reset */
+  PetscInt         nmatmult;         /* number of matrix-vector products since last reset */
+  PetscInt         nmatsolve;        /* number of linear solves since last reset */
   void             *data;
 };
 
@@ -112,6 +135,8 @@ SLEPC_INTERN PetscErrorCode STCheckNullSpace_Default(ST,BV);
 SLEPC_INTERN PetscErrorCode STMatShellCreate(ST,PetscScalar,PetscInt,PetscInt*,PetscScalar*,Mat*);
 SLEPC_INTERN PetscErrorCode STMatShellShift(Mat,PetscScalar);
 SLEPC_INTERN PetscErrorCode STCheckFactorPackage(ST);
+SLEPC_INTERN PetscErrorCode STCacheSwap_Private(ST,PetscScalar,PetscBool*);
+SLEPC_INTERN PetscErrorCode STCacheReset_Private(ST);
 SLEPC_INTERN PetscErrorCode STMatMAXPY_Private(ST,PetscScalar,PetscScalar,PetscInt,PetscScalar*,PetscBool,PetscBool,Mat*);
 SLEPC_INTERN PetscErrorCode STCoeffs_Monomial(ST,PetscScalar*);
 SLEPC_INTERN PetscErrorCode STSetDefaultKSP(ST);
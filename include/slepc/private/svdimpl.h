@@ -111,6 +111,7 @@ struct _p_SVD {
   PetscBool      leftbasis;        /* if U is filled by the solver */
   PetscBool      swapped;          /* the U and V bases have been swapped (M<N) */
   PetscBool      expltrans;        /* explicit transpose created */
+  PetscObjectState OPstate,OPbstate; /* state of user matrices when the transpose was built */
   PetscReal      nrma,nrmb;        /* computed matrix norms */
   PetscBool      isgeneralized;
   PetscBool      ishyperbolic;
@@ -87,6 +87,8 @@ typedef struct VecPool_ {
   PetscInt n;              /* size of vecs */
   PetscInt used;           /* number of already used vectors */
   PetscInt guess;          /* expected maximum number of vectors */
+  PetscInt hwm;            /* maximum number of simultaneously used vectors */
+  PetscInt gets;           /* number of requests served so far */
   struct VecPool_ *next;   /* list of pool of vectors */
 } VecPool_;
 typedef VecPool_* VecPool;
@@ -95,3 +97,4 @@ SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcVecPoolCreate(Vec,PetscInt,VecPo
 SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcVecPoolDestroy(VecPool*);
 SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcVecPoolGetVecs(VecPool,PetscInt,Vec**);
 SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcVecPoolRestoreVecs(VecPool,PetscInt,Vec**);
+SLEPC_SINGLE_LIBRARY_INTERN PetscErrorCode SlepcVecPoolShrink(VecPool,PetscInt);
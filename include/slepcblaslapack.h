@@ -144,6 +144,11 @@ BLAS_EXTERN void     LAPACKlarf_(const char*,const PetscBLASInt*,const PetscBLAS
 #define LAPACKlarf_(a,b,c,d,e,f,g,h,i) PetscMissingLapack("LARF",a,b,c,d,e,f,g,h,i);
 #endif
 BLAS_EXTERN SlepcLRT LAPACKlansy_(const char*,const char*,const PetscBLASInt*,const PetscScalar*,const PetscBLASInt*,PetscReal*);
+#if !defined(SLEPC_MISSING_LAPACK_LASR)
+BLAS_EXTERN void     LAPACKlasr_(const char*,const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscReal*,const PetscReal*,PetscScalar*,const PetscBLASInt*);
+#else
+#define LAPACKlasr_(a,b,c,d,e,f,g,h,i) PetscMissingLapack("LASR",a,b,c,d,e,f,g,h,i);
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TRSYL)
 BLAS_EXTERN void     LAPACKtrsyl_(const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscBLASInt*,const PetscScalar*,const PetscBLASInt*,const PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,PetscBLASInt*);
 #else
@@ -206,6 +211,11 @@ BLAS_EXTERN void     LAPACKggsvd3_(const char*,const char*,const char*,const Pet
 #else
 #define LAPACKggsvd3_(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x) PetscMissingLapack("GGSVD3",a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x);
 #endif
+#if !defined(SLEPC_MISSING_LAPACK_ORCSD2BY1)
+BLAS_EXTERN void     LAPACKorcsd2by1_(const char*,const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscBLASInt*,PetscBLASInt*);
+#else
+#define LAPACKorcsd2by1_(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u) PetscMissingLapack("ORCSD2BY1",a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u);
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TREVC)
 BLAS_EXTERN void     LAPACKtrevc_(const char*,const char*,PetscBLASInt*,const PetscBLASInt*,const PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,const PetscBLASInt*,PetscBLASInt*,PetscScalar*,PetscBLASInt*);
 #else
@@ -234,6 +244,11 @@ BLAS_EXTERN void     LAPACKstedc_(const char*,const PetscBLASInt*,PetscReal*,Pet
 #else
 #define LAPACKstedc_(a,b,c,d,e,f,g,h,i,j,k) PetscMissingLapack("STEDC",a,b,c,d,e,f,g,h,i,j,k);
 #endif
+#if !defined(SLEPC_MISSING_LAPACK_SBEVD)
+BLAS_EXTERN void     LAPACKsbevd_(const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscBLASInt*,const PetscBLASInt*,PetscBLASInt*);
+#else
+#define LAPACKsbevd_(a,b,c,d,e,f,g,h,i,j,k,l,m,n) PetscMissingLapack("SBEVD",a,b,c,d,e,f,g,h,i,j,k,l,m,n);
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_LASCL)
 BLAS_EXTERN void     LAPACKlascl_(const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscScalar*,const PetscScalar*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscBLASInt*);
 #else
@@ -261,6 +276,11 @@ BLAS_EXTERN void     LAPACKggsvd3_(const char*,const char*,const char*,const Pet
 #else
 #define LAPACKggsvd3_(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y) PetscMissingLapack("GGSVD3",a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y);
 #endif
+#if !defined(SLEPC_MISSING_LAPACK_ORCSD2BY1)
+BLAS_EXTERN void     LAPACKorcsd2by1_(const char*,const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,const PetscBLASInt*,PetscBLASInt*,PetscBLASInt*);
+#else
+#define LAPACKorcsd2by1_(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w) PetscMissingLapack("ORCSD2BY1",a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w);
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TREVC)
 BLAS_EXTERN void     LAPACKtrevc_(const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,const PetscBLASInt*,PetscBLASInt*,PetscScalar*,PetscReal*,PetscBLASInt*);
 #else
@@ -289,6 +309,11 @@ BLAS_EXTERN void     LAPACKstedc_(const char*,const PetscBLASInt*,PetscReal*,Pet
 #else
 #define LAPACKstedc_(a,b,c,d,e,f,g,h,i,j,k,l,m) PetscMissingLapack("STEDC",a,b,c,d,e,f,g,h,i,j,k,l,m);
 #endif
+#if !defined(SLEPC_MISSING_LAPACK_SBEVD)
+BLAS_EXTERN void     LAPACKsbevd_(const char*,const char*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,PetscScalar*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscReal*,const PetscBLASInt*,PetscBLASInt*,const PetscBLASInt*,PetscBLASInt*);
+#else
+#define LAPACKsbevd_(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) PetscMissingLapack("SBEVD",a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_LASCL)
 BLAS_EXTERN void     LAPACKlascl_(const char*,const PetscBLASInt*,const PetscBLASInt*,const PetscReal*,const PetscReal*,const PetscBLASInt*,const PetscBLASInt*,PetscScalar*,const PetscBLASInt*,PetscBLASInt*);
 #else
@@ -62,6 +62,9 @@
 #define LAPACKlarf_  PETSCBLAS(larf,LARF)
 #endif
 #define LAPACKlansy_ PETSCBLAS(lansy,LANSY)
+#if !defined(SLEPC_MISSING_LAPACK_LASR)
+#define LAPACKlasr_  PETSCBLAS(lasr,LASR)
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TRSYL)
 #define LAPACKtrsyl_ PETSCBLAS(trsyl,TRSYL)
 #endif
@@ -86,6 +89,9 @@
 #endif
 #define LAPACKsyevd_ PETSCBLAS(syevd,SYEVD)
 #define LAPACKsygvd_ PETSCBLAS(sygvd,SYGVD)
+#if !defined(SLEPC_MISSING_LAPACK_SBEVD)
+#define LAPACKsbevd_ PETSCBLAS(sbevd,SBEVD)
+#endif
 #else
 #if !defined(SLEPC_MISSING_LAPACK_ORGTR)
 #define LAPACKorgtr_ PETSCBLAS(ungtr,UNGTR)
@@ -95,6 +101,9 @@
 #endif
 #define LAPACKsyevd_ PETSCBLAS(heevd,HEEVD)
 #define LAPACKsygvd_ PETSCBLAS(hegvd,HEGVD)
+#if !defined(SLEPC_MISSING_LAPACK_SBEVD)
+#define LAPACKsbevd_ PETSCBLAS(hbevd,HBEVD)
+#endif
 #endif
 
 /* subroutines with different signature in real/complex */
@@ -117,6 +126,13 @@
 #if !defined(SLEPC_MISSING_LAPACK_GGSVD3)
 #define LAPACKggsvd3_ PETSCBLAS(ggsvd3,GGSVD3)
 #endif
+#if !defined(SLEPC_MISSING_LAPACK_ORCSD2BY1)
+#if !defined(PETSC_USE_COMPLEX)
+#define LAPACKorcsd2by1_ PETSCBLAS(orcsd2by1,ORCSD2BY1)
+#else
+#define LAPACKorcsd2by1_ PETSCBLAS(uncsd2by1,UNCSD2BY1)
+#endif
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TREVC)
 #define LAPACKtrevc_ PETSCBLAS(trevc,TREVC)
 #endif
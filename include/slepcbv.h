@@ -64,13 +64,22 @@ SLEPC_EXTERN const char *BVOrthogTypes[];
     BVOrthogRefineType - Determines what type of refinement to use
     during orthogonalization of vectors
 
+    Notes:
+    In the fused variant a single Gram-Schmidt sweep is done, as in the never
+    case, but the norm of the resulting vector is estimated from the same
+    global reduction used for the projection coefficients, instead of being
+    computed with an additional reduction. It is intended for classical
+    Gram-Schmidt on large numbers of processes, where synchronizations
+    dominate; with modified Gram-Schmidt it provides no advantage.
+
     Level: advanced
 
 .seealso: BVSetOrthogonalization(), BVGetOrthogonalization(), BVOrthogonalizeColumn()
 E*/
 typedef enum { BV_ORTHOG_REFINE_IFNEEDED,
                BV_ORTHOG_REFINE_NEVER,
-               BV_ORTHOG_REFINE_ALWAYS } BVOrthogRefineType;
+               BV_ORTHOG_REFINE_ALWAYS,
+               BV_ORTHOG_REFINE_FUSED } BVOrthogRefineType;
 SLEPC_EXTERN const char *BVOrthogRefineTypes[];
 
 /*E
@@ -95,7 +104,8 @@ SLEPC_EXTERN const char *BVOrthogBlockTypes[];
    Allowed values are
 +  BV_MATMULT_VECS - perform a matrix-vector multiply per each column
 .  BV_MATMULT_MAT - carry out a Mat-Mat product with a dense matrix
--  BV_MATMULT_MAT_SAVE - this case is deprecated
+.  BV_MATMULT_MAT_SAVE - this case is deprecated
+-  BV_MATMULT_AUTO - select between vecs and mat by timing both on first use
 
    The default is BV_MATMULT_MAT except in the case of BVVECS.
 
@@ -105,7 +115,8 @@ SLEPC_EXTERN const char *BVOrthogBlockTypes[];
 E*/
 typedef enum { BV_MATMULT_VECS,
                BV_MATMULT_MAT,
-               BV_MATMULT_MAT_SAVE } BVMatMultType;
+               BV_MATMULT_MAT_SAVE,
+               BV_MATMULT_AUTO } BVMatMultType;
 SLEPC_EXTERN const char *BVMatMultTypes[];
 
 SLEPC_EXTERN PetscErrorCode BVCreate(MPI_Comm,BV*);
@@ -137,6 +148,7 @@ SLEPC_EXTERN PetscErrorCode BVGetVecType(BV,VecType*);
 SLEPC_EXTERN PetscErrorCode BVSetActiveColumns(BV,PetscInt,PetscInt);
 SLEPC_EXTERN PetscErrorCode BVGetActiveColumns(BV,PetscInt*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode BVInsertVec(BV,PetscInt,Vec);
+SLEPC_EXTERN PetscErrorCode BVInsertVecNormalize(BV,PetscInt,Vec,PetscReal*);
 SLEPC_EXTERN PetscErrorCode BVInsertVecs(BV,PetscInt,PetscInt*,Vec*,PetscBool);
 SLEPC_EXTERN PetscErrorCode BVInsertConstraints(BV,PetscInt*,Vec*);
 SLEPC_EXTERN PetscErrorCode BVSetNumConstraints(BV,PetscInt);
@@ -148,6 +160,7 @@ SLEPC_EXTERN PetscErrorCode BVDuplicateResize(BV,PetscInt,BV*);
 SLEPC_EXTERN PetscErrorCode BVCopy(BV,BV);
 SLEPC_EXTERN PetscErrorCode BVCopyVec(BV,PetscInt,Vec);
 SLEPC_EXTERN PetscErrorCode BVCopyColumn(BV,PetscInt,PetscInt);
+SLEPC_EXTERN PetscErrorCode BVCopyColumnNormalize(BV,PetscInt,PetscInt,PetscReal*);
 SLEPC_EXTERN PetscErrorCode BVSetMatrix(BV,Mat,PetscBool);
 SLEPC_EXTERN PetscErrorCode BVGetMatrix(BV,Mat*,PetscBool*);
 SLEPC_EXTERN PetscErrorCode BVApplyMatrix(BV,Vec,Vec);
@@ -210,6 +223,8 @@ SLEPC_EXTERN PetscErrorCode BVBiorthogonalizeColumn(BV,BV,PetscInt);
 SLEPC_EXTERN PetscErrorCode BVBiorthonormalizeColumn(BV,BV,PetscInt,PetscReal*);
 SLEPC_EXTERN PetscErrorCode BVSetMatMultMethod(BV,BVMatMultType);
 SLEPC_EXTERN PetscErrorCode BVGetMatMultMethod(BV,BVMatMultType*);
+SLEPC_EXTERN PetscErrorCode BVSetDeterministic(BV,PetscBool);
+SLEPC_EXTERN PetscErrorCode BVGetDeterministic(BV,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode BVCreateFromMat(Mat,BV*);
 SLEPC_EXTERN PetscErrorCode BVCreateMat(BV,Mat*);
@@ -245,6 +260,8 @@ SLEPC_EXTERN PetscErrorCode BVCISSResizeBases(BV,BV,BV,PetscInt,PetscInt,PetscIn
 SLEPC_EXTERN PetscErrorCode BVCreateTensor(BV,PetscInt,BV*);
 SLEPC_EXTERN PetscErrorCode BVTensorBuildFirstColumn(BV,PetscInt);
 SLEPC_EXTERN PetscErrorCode BVTensorCompress(BV,PetscInt);
+SLEPC_EXTERN PetscErrorCode BVTensorSetCompressTolerance(BV,PetscReal);
+SLEPC_EXTERN PetscErrorCode BVTensorGetCompressTolerance(BV,PetscReal*);
 SLEPC_EXTERN PetscErrorCode BVTensorGetDegree(BV,PetscInt*);
 SLEPC_EXTERN PetscErrorCode BVTensorGetFactors(BV,BV*,Mat*);
 SLEPC_EXTERN PetscErrorCode BVTensorRestoreFactors(BV,BV*,Mat*);
@@ -173,6 +173,12 @@ SLEPC_EXTERN PetscErrorCode DSSetMethod(DS,PetscInt);
 SLEPC_EXTERN PetscErrorCode DSGetMethod(DS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode DSSetParallel(DS,DSParallelType);
 SLEPC_EXTERN PetscErrorCode DSGetParallel(DS,DSParallelType*);
+SLEPC_EXTERN PetscErrorCode DSSetNumThreads(DS,PetscInt);
+SLEPC_EXTERN PetscErrorCode DSGetNumThreads(DS,PetscInt*);
+SLEPC_EXTERN PetscErrorCode DSSetSortWindow(DS,PetscInt);
+SLEPC_EXTERN PetscErrorCode DSGetSortWindow(DS,PetscInt*);
+SLEPC_EXTERN PetscErrorCode DSSetNodeShared(DS,PetscBool);
+SLEPC_EXTERN PetscErrorCode DSGetNodeShared(DS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode DSSetCompact(DS,PetscBool);
 SLEPC_EXTERN PetscErrorCode DSGetCompact(DS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode DSSetExtraRow(DS,PetscBool);
@@ -189,6 +195,7 @@ SLEPC_EXTERN PetscErrorCode DSGetArrayReal(DS,DSMatType,PetscReal*[]);
 SLEPC_EXTERN PetscErrorCode DSRestoreArrayReal(DS,DSMatType,PetscReal*[]);
 SLEPC_EXTERN PetscErrorCode DSVectors(DS,DSMatType,PetscInt*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode DSSolve(DS,PetscScalar*,PetscScalar*);
+SLEPC_EXTERN PetscErrorCode DSSolveBatch(PetscInt,DS[],PetscScalar*[],PetscScalar*[]);
 SLEPC_EXTERN PetscErrorCode DSSort(DS,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode DSSortWithPermutation(DS,PetscInt*,PetscScalar*,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode DSSynchronize(DS,PetscScalar*,PetscScalar*);
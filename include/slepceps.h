@@ -194,11 +194,13 @@ SLEPC_EXTERN PetscErrorCode EPSGetExtraction(EPS,EPSExtraction*);
 SLEPC_EXTERN PetscErrorCode EPSSetBalance(EPS,EPSBalance,PetscInt,PetscReal);
 SLEPC_EXTERN PetscErrorCode EPSGetBalance(EPS,EPSBalance*,PetscInt*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSSetOperators(EPS,Mat,Mat);
+SLEPC_EXTERN PetscErrorCode EPSUpdateOperatorValues(EPS,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode EPSGetOperators(EPS,Mat*,Mat*);
 SLEPC_EXTERN PetscErrorCode EPSSetFromOptions(EPS);
 SLEPC_EXTERN PetscErrorCode EPSSetDSType(EPS);
 SLEPC_EXTERN PetscErrorCode EPSSetUp(EPS);
 SLEPC_EXTERN PetscErrorCode EPSSolve(EPS);
+SLEPC_EXTERN PetscErrorCode EPSBatchSolve(EPS,PetscInt,Mat[],Mat[],PetscErrorCode(*)(EPS,PetscInt,void*),void*);
 SLEPC_EXTERN PetscErrorCode EPSView(EPS,PetscViewer);
 SLEPC_EXTERN PetscErrorCode EPSViewFromOptions(EPS,PetscObject,const char[]);
 SLEPC_EXTERN PetscErrorCode EPSErrorView(EPS,EPSErrorType,PetscViewer);
@@ -234,6 +236,7 @@ SLEPC_EXTERN PetscErrorCode EPSConvergedAbsolute(EPS,PetscScalar,PetscScalar,Pet
 SLEPC_EXTERN PetscErrorCode EPSConvergedRelative(EPS,PetscScalar,PetscScalar,PetscReal,PetscReal*,void*);
 SLEPC_EXTERN PetscErrorCode EPSConvergedNorm(EPS,PetscScalar,PetscScalar,PetscReal,PetscReal*,void*);
 SLEPC_EXTERN PetscErrorCode EPSSetStoppingTestFunction(EPS,PetscErrorCode (*)(EPS,PetscInt,PetscInt,PetscInt,PetscInt,EPSConvergedReason*,void*),void*,PetscErrorCode (*)(void*));
+SLEPC_EXTERN PetscErrorCode EPSSetConvergedHandler(EPS,PetscErrorCode (*)(EPS,PetscInt,PetscInt,PetscBool*,void*),void*,PetscErrorCode (*)(void*));
 SLEPC_EXTERN PetscErrorCode EPSSetStoppingTest(EPS,EPSStop);
 SLEPC_EXTERN PetscErrorCode EPSGetStoppingTest(EPS,EPSStop*);
 SLEPC_EXTERN PetscErrorCode EPSStoppingBasic(EPS,PetscInt,PetscInt,PetscInt,PetscInt,EPSConvergedReason*,void*);
@@ -249,11 +252,14 @@ SLEPC_EXTERN PetscErrorCode EPSGetEigenvector(EPS,PetscInt,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode EPSGetLeftEigenvector(EPS,PetscInt,Vec,Vec);
 
 SLEPC_EXTERN PetscErrorCode EPSComputeError(EPS,PetscInt,EPSErrorType,PetscReal*);
+SLEPC_EXTERN PetscErrorCode EPSComputeErrorAll(EPS,EPSErrorType,PetscReal[]);
+SLEPC_EXTERN PetscErrorCode EPSComputeConditionNumber(EPS,PetscInt,PetscReal*);
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "EPSComputeError()", ) static inline PetscErrorCode EPSComputeRelativeError(EPS eps,PetscInt i,PetscReal *r) {return EPSComputeError(eps,i,EPS_ERROR_RELATIVE,r);}
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "EPSComputeError() with EPS_ERROR_ABSOLUTE", ) static inline PetscErrorCode EPSComputeResidualNorm(EPS eps,PetscInt i,PetscReal *r) {return EPSComputeError(eps,i,EPS_ERROR_ABSOLUTE,r);}
 SLEPC_EXTERN PetscErrorCode EPSGetInvariantSubspace(EPS,Vec[]);
 SLEPC_EXTERN PetscErrorCode EPSGetErrorEstimate(EPS,PetscInt,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSGetIterationNumber(EPS,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSGetOperationCounts(EPS,PetscInt*,PetscInt*,PetscInt*);
 
 SLEPC_EXTERN PetscErrorCode EPSSetWhichEigenpairs(EPS,EPSWhich);
 SLEPC_EXTERN PetscErrorCode EPSGetWhichEigenpairs(EPS,EPSWhich*);
@@ -275,6 +281,12 @@ SLEPC_EXTERN PetscErrorCode EPSGetTrackAll(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSSetDeflationSpace(EPS,PetscInt,Vec[]);
 SLEPC_EXTERN PetscErrorCode EPSSetInitialSpace(EPS,PetscInt,Vec[]);
 SLEPC_EXTERN PetscErrorCode EPSSetLeftInitialSpace(EPS,PetscInt,Vec[]);
+SLEPC_EXTERN PetscErrorCode EPSSetFilteredInitialSpace(EPS,PetscInt,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSGetFilteredInitialSpace(EPS,PetscInt*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSSetReusePrevious(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSGetReusePrevious(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSetRedundant(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSGetRedundant(EPS,PetscInt*);
 
 SLEPC_EXTERN PetscErrorCode EPSMonitor(EPS,PetscInt,PetscInt,PetscScalar*,PetscScalar*,PetscReal*,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSMonitorSet(EPS,PetscErrorCode (*)(EPS,PetscInt,PetscInt,PetscScalar*,PetscScalar*,PetscReal*,PetscInt,void*),void*,PetscErrorCode (*)(void**));
@@ -329,6 +341,8 @@ SLEPC_EXTERN PetscErrorCode EPSPowerSetNonlinear(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetNonlinear(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSPowerSetUpdate(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetUpdate(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSPowerSetJacobianLag(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSPowerGetJacobianLag(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSPowerSetSignNormalization(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetSignNormalization(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSPowerSetSNES(EPS,SNES);
@@ -337,14 +351,29 @@ SLEPC_EXTERN PetscErrorCode EPSPowerGetSNES(EPS,SNES*);
 SLEPC_EXTERN PetscErrorCode EPSArnoldiSetDelayed(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSArnoldiGetDelayed(EPS,PetscBool*);
 
+SLEPC_EXTERN PetscErrorCode EPSSubspaceSetChebyshev(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSSubspaceGetChebyshev(EPS,PetscBool*);
+
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetRestart(EPS,PetscReal);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetRestart(EPS,PetscReal*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetAdaptiveRestart(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetAdaptiveRestart(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetDynamicBasis(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetDynamicBasis(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetLocking(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetLocking(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetPipelined(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetPipelined(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetBlockSize(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetBlockSize(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetPartitions(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetPartitions(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetDetectZeros(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetDetectZeros(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetBalanceSubintervals(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetBalanceSubintervals(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetStochasticInertia(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetStochasticInertia(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetDimensions(EPS,PetscInt,PetscInt,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetDimensions(EPS,PetscInt*,PetscInt*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetSubintervals(EPS,PetscReal*);
@@ -355,6 +384,8 @@ SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetSubcommPairs(EPS,PetscInt,PetscScal
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetSubcommMats(EPS,Mat*,Mat*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurUpdateSubcommMats(EPS,PetscScalar,PetscScalar,Mat,PetscScalar,PetscScalar, Mat,MatStructure,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetKSP(EPS,KSP*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurCheckpoint(EPS,PetscViewer);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurRestore(EPS,PetscViewer);
 
 /*E
     EPSLanczosReorthogType - determines the type of reorthogonalization
@@ -369,11 +400,16 @@ typedef enum { EPS_LANCZOS_REORTHOG_LOCAL,
                EPS_LANCZOS_REORTHOG_SELECTIVE,
                EPS_LANCZOS_REORTHOG_PERIODIC,
                EPS_LANCZOS_REORTHOG_PARTIAL,
-               EPS_LANCZOS_REORTHOG_DELAYED } EPSLanczosReorthogType;
+               EPS_LANCZOS_REORTHOG_DELAYED,
+               EPS_LANCZOS_REORTHOG_WINDOW } EPSLanczosReorthogType;
 SLEPC_EXTERN const char *EPSLanczosReorthogTypes[];
 
 SLEPC_EXTERN PetscErrorCode EPSLanczosSetReorthog(EPS,EPSLanczosReorthogType);
 SLEPC_EXTERN PetscErrorCode EPSLanczosGetReorthog(EPS,EPSLanczosReorthogType*);
+SLEPC_EXTERN PetscErrorCode EPSLanczosSetBlockSize(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSLanczosGetBlockSize(EPS,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSLanczosSetWindow(EPS,PetscInt,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSLanczosGetWindow(EPS,PetscInt*,PetscInt*);
 
 /*E
     EPSPRIMMEMethod - determines the method selected in the PRIMME library
@@ -482,6 +518,8 @@ SLEPC_EXTERN PetscErrorCode EPSLyapIISetLME(EPS,LME);
 SLEPC_EXTERN PetscErrorCode EPSLyapIIGetLME(EPS,LME*);
 SLEPC_EXTERN PetscErrorCode EPSLyapIISetRanks(EPS,PetscInt,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSLyapIIGetRanks(EPS,PetscInt*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSLyapIISetRankAdaptive(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSLyapIIGetRankAdaptive(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSBLOPEXSetBlockSize(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSBLOPEXGetBlockSize(EPS,PetscInt*);
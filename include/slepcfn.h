@@ -91,10 +91,14 @@ SLEPC_EXTERN PetscErrorCode FNSetMethod(FN,PetscInt);
 SLEPC_EXTERN PetscErrorCode FNGetMethod(FN,PetscInt*);
 SLEPC_EXTERN PetscErrorCode FNSetParallel(FN,FNParallelType);
 SLEPC_EXTERN PetscErrorCode FNGetParallel(FN,FNParallelType*);
+SLEPC_EXTERN PetscErrorCode FNSetMemoize(FN,PetscBool);
+SLEPC_EXTERN PetscErrorCode FNGetMemoize(FN,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode FNEvaluateFunction(FN,PetscScalar,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode FNEvaluateDerivative(FN,PetscScalar,PetscScalar*);
+SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionArray(FN,PetscInt,PetscScalar*,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMat(FN,Mat,Mat);
+SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMatBatch(FN,PetscInt,Mat[],Mat[]);
 SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMatVec(FN,Mat,Vec);
 
 SLEPC_EXTERN PetscFunctionList FNList;
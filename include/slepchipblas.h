@@ -0,0 +1,73 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   Macro definitions to use HIPBLAS functionality
+*/
+
+#pragma once
+
+#include <petscdevice.h>
+
+/* complex single */
+#if defined(PETSC_USE_COMPLEX)
+#if defined(PETSC_USE_REAL_SINGLE)
+#define hipblasXgemm(a,b,c,d,e,f,g,h,i,j,k,l,m,n) hipblasCgemm((a),(b),(c),(d),(e),(f),(const hipblasComplex*)(g),(const hipblasComplex*)(h),(i),(const hipblasComplex*)(j),(k),(const hipblasComplex*)(l),(hipblasComplex*)(m),(n))
+#define hipblasXgemv(a,b,c,d,e,f,g,h,i,j,k,l) hipblasCgemv((a),(b),(c),(d),(hipblasComplex*)(e),(hipblasComplex*)(f),(g),(hipblasComplex*)(h),(i),(hipblasComplex*)(j),(hipblasComplex*)(k),(l))
+#define hipblasXgeam(a,b,c,d,e,f,g,h,i,j,k,l,m) hipblasCgeam((a),(b),(c),(d),(e),(hipblasComplex*)(f),(hipblasComplex*)(g),(h),(hipblasComplex*)(i),(hipblasComplex*)(j),(k),(hipblasComplex*)(l),(m))
+#define hipblasXscal(a,b,c,d,e) hipblasCscal((a),(b),(const hipblasComplex*)(c),(hipblasComplex*)(d),(e))
+#define hipblasXnrm2(a,b,c,d,e) hipblasScnrm2((a),(b),(const hipblasComplex*)(c),(d),(e))
+#define hipblasXaxpy(a,b,c,d,e,f,g) hipblasCaxpy((a),(b),(const hipblasComplex*)(c),(const hipblasComplex*)(d),(e),(hipblasComplex*)(f),(g))
+#define hipblasXdotc(a,b,c,d,e,f,g) hipblasCdotc((a),(b),(const hipblasComplex *)(c),(d),(const hipblasComplex *)(e),(f),(hipblasComplex *)(g))
+#define hipblasXgetrfBatched(a,b,c,d,e,f,g) hipblasCgetrfBatched((a),(b),(hipblasComplex**)(c),(d),(e),(f),(g))
+#define hipblasXgetrsBatched(a,b,c,d,e,f,g,h,i,j,k) hipblasCgetrsBatched((a),(b),(c),(d),(const hipblasComplex**)(e),(f),(g),(hipblasComplex**)(h),(i),(j),(k))
+#else /* complex double */
+#define hipblasXgemm(a,b,c,d,e,f,g,h,i,j,k,l,m,n) hipblasZgemm((a),(b),(c),(d),(e),(f),(const hipblasDoubleComplex*)(g),(const hipblasDoubleComplex*)(h),(i),(const hipblasDoubleComplex*)(j),(k),(const hipblasDoubleComplex*)(l),(hipblasDoubleComplex *)(m),(n))
+#define hipblasXgemv(a,b,c,d,e,f,g,h,i,j,k,l) hipblasZgemv((a),(b),(c),(d),(hipblasDoubleComplex*)(e),(hipblasDoubleComplex*)(f),(g),(hipblasDoubleComplex*)(h),(i),(hipblasDoubleComplex*)(j),(hipblasDoubleComplex*)(k),(l))
+#define hipblasXgeam(a,b,c,d,e,f,g,h,i,j,k,l,m) hipblasZgeam((a),(b),(c),(d),(e),(hipblasDoubleComplex*)(f),(hipblasDoubleComplex*)(g),(h),(hipblasDoubleComplex*)(i),(hipblasDoubleComplex*)(j),(k),(hipblasDoubleComplex*)(l),(m))
+#define hipblasXscal(a,b,c,d,e) hipblasZscal((a),(b),(const hipblasDoubleComplex*)(c),(hipblasDoubleComplex*)(d),(e))
+#define hipblasXnrm2(a,b,c,d,e) hipblasDznrm2((a),(b),(const hipblasDoubleComplex*)(c),(d),(e))
+#define hipblasXaxpy(a,b,c,d,e,f,g) hipblasZaxpy((a),(b),(const hipblasDoubleComplex*)(c),(const hipblasDoubleComplex*)(d),(e),(hipblasDoubleComplex*)(f),(g))
+#define hipblasXdotc(a,b,c,d,e,f,g) hipblasZdotc((a),(b),(const hipblasDoubleComplex *)(c),(d),(const hipblasDoubleComplex *)(e),(f),(hipblasDoubleComplex *)(g))
+#define hipblasXgetrfBatched(a,b,c,d,e,f,g) hipblasZgetrfBatched((a),(b),(hipblasDoubleComplex**)(c),(d),(e),(f),(g))
+#define hipblasXgetrsBatched(a,b,c,d,e,f,g,h,i,j,k) hipblasZgetrsBatched((a),(b),(c),(d),(const hipblasDoubleComplex**)(e),(f),(g),(hipblasDoubleComplex**)(h),(i),(j),(k))
+#endif
+#else /* real single */
+#if defined(PETSC_USE_REAL_SINGLE)
+#define hipblasXgemm hipblasSgemm
+#define hipblasXgemv hipblasSgemv
+#define hipblasXgeam hipblasSgeam
+#define hipblasXscal hipblasSscal
+#define hipblasXnrm2 hipblasSnrm2
+#define hipblasXaxpy hipblasSaxpy
+#define hipblasXdotc hipblasSdot
+#define hipblasXgetrfBatched hipblasSgetrfBatched
+#define hipblasXgetrsBatched hipblasSgetrsBatched
+#else /* real double */
+#define hipblasXgemm hipblasDgemm
+#define hipblasXgemv hipblasDgemv
+#define hipblasXgeam hipblasDgeam
+#define hipblasXscal hipblasDscal
+#define hipblasXnrm2 hipblasDnrm2
+#define hipblasXaxpy hipblasDaxpy
+#define hipblasXdotc hipblasDdot
+#define hipblasXgetrfBatched hipblasDgetrfBatched
+#define hipblasXgetrsBatched hipblasDgetrsBatched
+#endif
+#endif
+
+#if defined(PETSC_USE_REAL_SINGLE)
+#define hipblasXCaxpy(a,b,c,d,e,f,g)                hipblasCaxpy((a),(b),(const hipblasComplex *)(c),(const hipblasComplex *)(d),(e),(hipblasComplex *)(f),(g))
+#define hipblasXCgemm(a,b,c,d,e,f,g,h,i,j,k,l,m,n)  hipblasCgemm((a),(b),(c),(d),(e),(f),(const hipblasComplex *)(g),(const hipblasComplex *)(h),(i),(const hipblasComplex *)(j),(k),(const hipblasComplex *)(l),(hipblasComplex *)(m),(n))
+#define hipblasXCscal(a,b,c,d,e)                    hipblasCscal((a),(b),(const hipblasComplex *)(c),(hipblasComplex *)(d),(e))
+#else
+#define hipblasXCaxpy(a,b,c,d,e,f,g)                hipblasZaxpy((a),(b),(const hipblasDoubleComplex *)(c),(const hipblasDoubleComplex *)(d),(e),(hipblasDoubleComplex *)(f),(g))
+#define hipblasXCgemm(a,b,c,d,e,f,g,h,i,j,k,l,m,n)  hipblasZgemm((a),(b),(c),(d),(e),(f),(const hipblasDoubleComplex *)(g),(const hipblasDoubleComplex *)(h),(i),(const hipblasDoubleComplex *)(j),(k),(const hipblasDoubleComplex *)(l),(hipblasDoubleComplex *)(m),(n))
+#define hipblasXCscal(a,b,c,d,e)                    hipblasZscal((a),(b),(const hipblasDoubleComplex *)(c),(hipblasDoubleComplex *)(d),(e))
+#endif /* COMPLEX */
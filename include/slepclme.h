@@ -86,6 +86,8 @@ SLEPC_EXTERN PetscErrorCode LMESetTolerances(LME,PetscReal,PetscInt);
 SLEPC_EXTERN PetscErrorCode LMEGetTolerances(LME,PetscReal*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode LMESetDimensions(LME,PetscInt);
 SLEPC_EXTERN PetscErrorCode LMEGetDimensions(LME,PetscInt*);
+SLEPC_EXTERN PetscErrorCode LMESetRankTolerance(LME,PetscReal);
+SLEPC_EXTERN PetscErrorCode LMEGetRankTolerance(LME,PetscReal*);
 SLEPC_EXTERN PetscErrorCode LMEGetIterationNumber(LME,PetscInt*);
 
 SLEPC_EXTERN PetscErrorCode LMEGetErrorEstimate(LME,PetscReal*);
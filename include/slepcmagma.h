@@ -18,6 +18,11 @@
 #include <magma_v2.h>
 
 SLEPC_EXTERN PetscErrorCode SlepcMagmaInit(void);
+SLEPC_EXTERN PetscErrorCode SlepcMagmaSetCrossoverFromOptions(void);
+SLEPC_EXTERN PetscErrorCode SlepcMagmaGetCrossover(PetscInt*);
+SLEPC_EXTERN PetscErrorCode SlepcMagmaGetWorkspace(size_t,void**);
+SLEPC_EXTERN PetscErrorCode SlepcMagmaMalloc(size_t,void**);
+SLEPC_EXTERN PetscErrorCode SlepcMagmaFree(void*);
 
 #define PetscCallMAGMA(func, ...) do { \
     magma_int_t magma_ierr_; \
@@ -35,12 +40,20 @@ SLEPC_EXTERN PetscErrorCode SlepcMagmaInit(void);
 #define magma_xgetrf_gpu(a,b,c,d,e,f)   magma_cgetrf_gpu((a),(b),(magmaFloatComplex_ptr)(c),(d),(e),(f))
 #define magma_xgetri_gpu(a,b,c,d,e,f,g) magma_cgetri_gpu((a),(magmaFloatComplex_ptr)(b),(c),(d),(magmaFloatComplex_ptr)(e),(f),(g))
 #define magma_get_xgetri_nb             magma_get_cgetri_nb
+#define magma_xsyevd(a,b,c,d,e,f,g,h,i,j,k,l) magma_cheevd((a),(b),(c),(magmaFloatComplex*)(d),(e),(f),(magmaFloatComplex*)(g),(h),(i),(j),(k),(l))
+#define magma_xgehrd(a,b,c,d,e,f,g,h,i,j) magma_cgehrd((a),(b),(c),(magmaFloatComplex*)(d),(e),(magmaFloatComplex*)(f),(magmaFloatComplex*)(g),(h),(magmaFloatComplex_ptr)(i),(j))
+#define magma_xunghr(a,b,c,d,e,f,g,h,i) magma_cunghr((a),(b),(c),(magmaFloatComplex*)(d),(e),(magmaFloatComplex*)(f),(magmaFloatComplex_ptr)(g),(h),(i))
+#define magma_get_xgehrd_nb             magma_get_cgehrd_nb
 #else
 #define magma_xgeev(a,b,c,d,e,f,g,h,i,j,k,l,m,n) magma_zgeev((a),(b),(c),(magmaDoubleComplex*)(d),(e),(magmaDoubleComplex*)(f),(magmaDoubleComplex*)(g),(h),(magmaDoubleComplex*)(i),(j),(magmaDoubleComplex*)(k),(l),(m),(n))
 #define magma_xgesv_gpu(a,b,c,d,e,f,g,h)         magma_zgesv_gpu((a),(b),(magmaDoubleComplex_ptr)(c),(d),(e),(magmaDoubleComplex_ptr)(f),(g),(h))
 #define magma_xgetrf_gpu(a,b,c,d,e,f)   magma_zgetrf_gpu((a),(b),(magmaDoubleComplex_ptr)(c),(d),(e),(f))
 #define magma_xgetri_gpu(a,b,c,d,e,f,g) magma_zgetri_gpu((a),(magmaDoubleComplex_ptr)(b),(c),(d),(magmaDoubleComplex_ptr)(e),(f),(g))
 #define magma_get_xgetri_nb             magma_get_zgetri_nb
+#define magma_xsyevd(a,b,c,d,e,f,g,h,i,j,k,l) magma_zheevd((a),(b),(c),(magmaDoubleComplex*)(d),(e),(f),(magmaDoubleComplex*)(g),(h),(i),(j),(k),(l))
+#define magma_xgehrd(a,b,c,d,e,f,g,h,i,j) magma_zgehrd((a),(b),(c),(magmaDoubleComplex*)(d),(e),(magmaDoubleComplex*)(f),(magmaDoubleComplex*)(g),(h),(magmaDoubleComplex_ptr)(i),(j))
+#define magma_xunghr(a,b,c,d,e,f,g,h,i) magma_zunghr((a),(b),(c),(magmaDoubleComplex*)(d),(e),(magmaDoubleComplex*)(f),(magmaDoubleComplex_ptr)(g),(h),(i))
+#define magma_get_xgehrd_nb             magma_get_zgehrd_nb
 #endif
 #else
 #if defined(PETSC_USE_REAL_SINGLE)
@@ -49,12 +62,20 @@ SLEPC_EXTERN PetscErrorCode SlepcMagmaInit(void);
 #define magma_xgetrf_gpu                magma_sgetrf_gpu
 #define magma_xgetri_gpu                magma_sgetri_gpu
 #define magma_get_xgetri_nb             magma_get_sgetri_nb
+#define magma_xsyevd                    magma_ssyevd
+#define magma_xgehrd                    magma_sgehrd
+#define magma_xunghr                    magma_sorghr
+#define magma_get_xgehrd_nb             magma_get_sgehrd_nb
 #else
 #define magma_xgeev                     magma_dgeev
 #define magma_xgesv_gpu                 magma_dgesv_gpu
 #define magma_xgetrf_gpu                magma_dgetrf_gpu
 #define magma_xgetri_gpu                magma_dgetri_gpu
 #define magma_get_xgetri_nb             magma_get_dgetri_nb
+#define magma_xsyevd                    magma_dsyevd
+#define magma_xgehrd                    magma_dgehrd
+#define magma_xunghr                    magma_dorghr
+#define magma_get_xgehrd_nb             magma_get_dgehrd_nb
 #endif
 #endif
 
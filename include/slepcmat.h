@@ -18,8 +18,14 @@
 /* SUBMANSEC = sys */
 
 SLEPC_EXTERN PetscErrorCode MatCreateTile(PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,Mat*);
+SLEPC_EXTERN PetscErrorCode MatCreateTileImplicit(PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,Mat*);
+SLEPC_EXTERN PetscErrorCode MatCreateTilePattern(Mat,Mat,Mat,Mat,Mat*);
+SLEPC_EXTERN PetscErrorCode MatTileUpdateValues(PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,PetscScalar,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode MatCreateVecsEmpty(Mat,Vec*,Vec*);
 SLEPC_EXTERN PetscErrorCode MatNormEstimate(Mat,Vec,Vec,PetscReal*);
+SLEPC_EXTERN PetscErrorCode MatNorm2Estimate(Mat,PetscInt,PetscReal*);
+SLEPC_EXTERN PetscErrorCode MatSpectrumSketch(Mat,PetscInt,PetscInt,PetscReal*,PetscReal*,PetscViewer);
+SLEPC_EXTERN PetscErrorCode MatEstimateSpectralRange(Mat,PetscInt,PetscReal*,PetscReal*);
 
 /* Deprecated functions */
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "MatCreateRedundantMatrix() followed by MatConvert()", ) static inline PetscErrorCode SlepcMatConvertSeqDense(Mat mat,Mat *newmat)
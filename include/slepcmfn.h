@@ -55,6 +55,7 @@ SLEPC_EXTERN PetscErrorCode MFNSetFromOptions(MFN);
 SLEPC_EXTERN PetscErrorCode MFNSetUp(MFN);
 SLEPC_EXTERN PetscErrorCode MFNSolve(MFN,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode MFNSolveTranspose(MFN,Vec,Vec);
+SLEPC_EXTERN PetscErrorCode MFNSolveMat(MFN,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode MFNView(MFN,PetscViewer);
 SLEPC_EXTERN PetscErrorCode MFNViewFromOptions(MFN,PetscObject,const char[]);
 SLEPC_EXTERN PetscErrorCode MFNConvergedReasonView(MFN,PetscViewer);
@@ -72,6 +73,14 @@ SLEPC_EXTERN PetscErrorCode MFNSetDimensions(MFN,PetscInt);
 SLEPC_EXTERN PetscErrorCode MFNGetDimensions(MFN,PetscInt*);
 SLEPC_EXTERN PetscErrorCode MFNGetIterationNumber(MFN,PetscInt*);
 
+SLEPC_EXTERN PetscErrorCode MFNKrylovSetTwoPass(MFN,PetscBool);
+SLEPC_EXTERN PetscErrorCode MFNKrylovGetTwoPass(MFN,PetscBool*);
+SLEPC_EXTERN PetscErrorCode MFNKrylovSetRecycle(MFN,PetscInt);
+SLEPC_EXTERN PetscErrorCode MFNKrylovGetRecycle(MFN,PetscInt*);
+
+SLEPC_EXTERN PetscErrorCode MFNExpokitSetStepController(MFN,PetscBool,PetscReal);
+SLEPC_EXTERN PetscErrorCode MFNExpokitGetStepController(MFN,PetscBool*,PetscReal*);
+
 SLEPC_EXTERN PetscErrorCode MFNSetErrorIfNotConverged(MFN,PetscBool);
 SLEPC_EXTERN PetscErrorCode MFNGetErrorIfNotConverged(MFN,PetscBool*);
 
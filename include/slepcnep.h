@@ -243,6 +243,8 @@ SLEPC_EXTERN PetscErrorCode NEPSetWhichEigenpairs(NEP,NEPWhich);
 SLEPC_EXTERN PetscErrorCode NEPGetWhichEigenpairs(NEP,NEPWhich*);
 SLEPC_EXTERN PetscErrorCode NEPSetTwoSided(NEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode NEPGetTwoSided(NEP,PetscBool*);
+SLEPC_EXTERN PetscErrorCode NEPSetCacheTranspose(NEP,PetscBool);
+SLEPC_EXTERN PetscErrorCode NEPGetCacheTranspose(NEP,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode NEPApplyResolvent(NEP,RG,PetscScalar,Vec,Vec);
 
@@ -296,6 +298,8 @@ SLEPC_EXTERN PetscErrorCode NEPRIISetConstCorrectionTol(NEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetConstCorrectionTol(NEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode NEPRIISetHermitian(NEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetHermitian(NEP,PetscBool*);
+SLEPC_EXTERN PetscErrorCode NEPRIISetWarmStart(NEP,PetscBool);
+SLEPC_EXTERN PetscErrorCode NEPRIIGetWarmStart(NEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode NEPRIISetDeflationThreshold(NEP,PetscReal);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetDeflationThreshold(NEP,PetscReal*);
 SLEPC_EXTERN PetscErrorCode NEPRIISetKSP(NEP,KSP);
@@ -303,6 +307,8 @@ SLEPC_EXTERN PetscErrorCode NEPRIIGetKSP(NEP,KSP*);
 
 SLEPC_EXTERN PetscErrorCode NEPSLPSetDeflationThreshold(NEP,PetscReal);
 SLEPC_EXTERN PetscErrorCode NEPSLPGetDeflationThreshold(NEP,PetscReal*);
+SLEPC_EXTERN PetscErrorCode NEPSLPSetLagPreconditioner(NEP,PetscInt);
+SLEPC_EXTERN PetscErrorCode NEPSLPGetLagPreconditioner(NEP,PetscInt*);
 SLEPC_EXTERN PetscErrorCode NEPSLPSetEPS(NEP,EPS);
 SLEPC_EXTERN PetscErrorCode NEPSLPGetEPS(NEP,EPS*);
 SLEPC_EXTERN PetscErrorCode NEPSLPSetEPSLeft(NEP,EPS);
@@ -106,7 +106,8 @@ E*/
 typedef enum { PEP_SCALE_NONE,
                PEP_SCALE_SCALAR,
                PEP_SCALE_DIAGONAL,
-               PEP_SCALE_BOTH } PEPScale;
+               PEP_SCALE_BOTH,
+               PEP_SCALE_AUTO } PEPScale;
 SLEPC_EXTERN const char *PEPScaleTypes[];
 
 /*E
@@ -339,6 +340,7 @@ SLEPC_EXTERN PetscErrorCode PEPSTOARGetLinearization(PEP,PetscReal*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode PEPSTOARSetLocking(PEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode PEPSTOARGetLocking(PEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode PEPSTOARSetDetectZeros(PEP,PetscBool);
+SLEPC_EXTERN PetscErrorCode PEPSTOARSetEigenpairSink(PEP,PetscErrorCode(*)(PEP,PetscInt,PetscScalar,Vec,void*),void*);
 SLEPC_EXTERN PetscErrorCode PEPSTOARGetDetectZeros(PEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode PEPSTOARGetInertias(PEP,PetscInt*,PetscReal**,PetscInt**);
 SLEPC_EXTERN PetscErrorCode PEPSTOARSetDimensions(PEP,PetscInt,PetscInt,PetscInt);
@@ -368,6 +370,8 @@ SLEPC_EXTERN PetscErrorCode PEPJDSetMinimalityIndex(PEP,PetscInt);
 SLEPC_EXTERN PetscErrorCode PEPJDGetMinimalityIndex(PEP,PetscInt*);
 SLEPC_EXTERN PetscErrorCode PEPJDSetProjection(PEP,PEPJDProjection);
 SLEPC_EXTERN PetscErrorCode PEPJDGetProjection(PEP,PEPJDProjection*);
+SLEPC_EXTERN PetscErrorCode PEPJDSetCompact(PEP,PetscBool);
+SLEPC_EXTERN PetscErrorCode PEPJDGetCompact(PEP,PetscBool*);
 
 /*E
     PEPCISSExtraction - determines the extraction technique in the CISS solver
@@ -71,6 +71,7 @@ SLEPC_EXTERN PetscErrorCode RGCanUseConjugates(RG,PetscBool,PetscBool*);
 SLEPC_EXTERN PetscErrorCode RGComputeContour(RG,PetscInt,PetscScalar*,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode RGComputeBoundingBox(RG,PetscReal*,PetscReal*,PetscReal*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode RGComputeQuadrature(RG,RGQuadRule,PetscInt,PetscScalar*,PetscScalar*,PetscScalar*);
+SLEPC_EXTERN PetscErrorCode RGComputeQuadratureAdaptive(RG,RGQuadRule,PetscInt,PetscScalar[],PetscInt,PetscScalar*,PetscScalar*,PetscScalar*);
 
 SLEPC_EXTERN PetscFunctionList RGList;
 SLEPC_EXTERN PetscErrorCode RGRegister(const char[],PetscErrorCode(*)(RG));
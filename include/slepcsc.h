@@ -63,6 +63,7 @@ struct _n_SlepcSC {
 typedef struct _n_SlepcSC* SlepcSC;
 
 SLEPC_EXTERN PetscErrorCode SlepcSCCompare(SlepcSC,PetscScalar,PetscScalar,PetscScalar,PetscScalar,PetscInt*);
+SLEPC_EXTERN PetscErrorCode SlepcSCComputeKeys(SlepcSC,PetscInt,const PetscScalar*,const PetscScalar*,PetscReal*,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SlepcSortEigenvalues(SlepcSC,PetscInt n,PetscScalar *eigr,PetscScalar *eigi,PetscInt *perm);
 
 SLEPC_EXTERN PetscErrorCode SlepcMap_ST(PetscObject,PetscInt,PetscScalar*,PetscScalar*);
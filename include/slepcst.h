@@ -84,12 +84,15 @@ SLEPC_EXTERN PetscErrorCode STApplyMat(ST,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode STApplyTranspose(ST,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STApplyHermitianTranspose(ST,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatMult(ST,PetscInt,Vec,Vec);
+SLEPC_EXTERN PetscErrorCode STMatMultAdd(ST,PetscInt,Vec,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatMultTranspose(ST,PetscInt,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatMultHermitianTranspose(ST,PetscInt,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatSolve(ST,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatSolveTranspose(ST,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatSolveHermitianTranspose(ST,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode STMatMatSolve(ST,Mat,Mat);
+SLEPC_EXTERN PetscErrorCode STGetOperationCounters(ST,PetscInt*,PetscInt*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode STResetOperationCounters(ST);
 SLEPC_EXTERN PetscErrorCode STGetBilinearForm(ST,Mat*);
 SLEPC_EXTERN PetscErrorCode STMatSetUp(ST,PetscScalar,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode STPostSolve(ST);
@@ -102,10 +105,17 @@ SLEPC_EXTERN PetscErrorCode STSetShift(ST,PetscScalar);
 SLEPC_EXTERN PetscErrorCode STGetShift(ST,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode STSetDefaultShift(ST,PetscScalar);
 SLEPC_EXTERN PetscErrorCode STScaleShift(ST,PetscScalar);
+SLEPC_EXTERN PetscErrorCode STSetScale(ST,PetscReal);
+SLEPC_EXTERN PetscErrorCode STGetScale(ST,PetscReal*);
 SLEPC_EXTERN PetscErrorCode STSetBalanceMatrix(ST,Vec);
 SLEPC_EXTERN PetscErrorCode STGetBalanceMatrix(ST,Vec*);
 SLEPC_EXTERN PetscErrorCode STSetTransform(ST,PetscBool);
 SLEPC_EXTERN PetscErrorCode STGetTransform(ST,PetscBool*);
+SLEPC_EXTERN PetscErrorCode STCacheSetCapacity(ST,PetscInt);
+SLEPC_EXTERN PetscErrorCode STCacheGetCapacity(ST,PetscInt*);
+SLEPC_EXTERN PetscErrorCode STSetAdaptiveTolerance(ST,PetscBool);
+SLEPC_EXTERN PetscErrorCode STGetAdaptiveTolerance(ST,PetscBool*);
+SLEPC_EXTERN PetscErrorCode STSetOuterTolerance(ST,PetscReal);
 
 SLEPC_EXTERN PetscErrorCode STSetOptionsPrefix(ST,const char*);
 SLEPC_EXTERN PetscErrorCode STAppendOptionsPrefix(ST,const char*);
@@ -160,10 +170,17 @@ SLEPC_EXTERN PetscErrorCode STShellSetBackTransform(ST,PetscErrorCode (*)(ST,Pet
 SLEPC_EXTERN PetscErrorCode STCayleyGetAntishift(ST,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode STCayleySetAntishift(ST,PetscScalar);
 
+SLEPC_EXTERN PetscErrorCode STSinvertSetLagFactorization(ST,PetscInt);
+SLEPC_EXTERN PetscErrorCode STSinvertGetLagFactorization(ST,PetscInt*);
+SLEPC_EXTERN PetscErrorCode STSinvertSetLagMaxIts(ST,PetscInt);
+SLEPC_EXTERN PetscErrorCode STSinvertGetLagMaxIts(ST,PetscInt*);
+
 PETSC_DEPRECATED_FUNCTION(3, 15, 0, "STGetPreconditionerMat()", ) static inline PetscErrorCode STPrecondGetMatForPC(ST st,Mat *A) {return STGetPreconditionerMat(st,A);}
 PETSC_DEPRECATED_FUNCTION(3, 15, 0, "STSetPreconditionerMat()", ) static inline PetscErrorCode STPrecondSetMatForPC(ST st,Mat A) {return STSetPreconditionerMat(st,A);}
 SLEPC_EXTERN PetscErrorCode STPrecondGetKSPHasMat(ST,PetscBool*);
 SLEPC_EXTERN PetscErrorCode STPrecondSetKSPHasMat(ST,PetscBool);
+SLEPC_EXTERN PetscErrorCode STPrecondGetUpdateTolerance(ST,PetscReal*);
+SLEPC_EXTERN PetscErrorCode STPrecondSetUpdateTolerance(ST,PetscReal);
 
 SLEPC_EXTERN PetscErrorCode STFilterSetInterval(ST,PetscReal,PetscReal);
 SLEPC_EXTERN PetscErrorCode STFilterGetInterval(ST,PetscReal*,PetscReal*);
@@ -166,6 +166,7 @@ SLEPC_EXTERN PetscErrorCode SVDGetOptionsPrefix(SVD,const char*[]);
 SLEPC_EXTERN PetscErrorCode SVDSetDSType(SVD);
 SLEPC_EXTERN PetscErrorCode SVDSetUp(SVD);
 SLEPC_EXTERN PetscErrorCode SVDSolve(SVD);
+SLEPC_EXTERN PetscErrorCode SVDUpdateRows(SVD,Mat);
 SLEPC_EXTERN PetscErrorCode SVDGetIterationNumber(SVD,PetscInt*);
 SLEPC_EXTERN PetscErrorCode SVDSetConvergenceTestFunction(SVD,PetscErrorCode (*)(SVD,PetscReal,PetscReal,PetscReal*,void*),void*,PetscErrorCode (*)(void*));
 SLEPC_EXTERN PetscErrorCode SVDSetConvergenceTest(SVD,SVDConv);
@@ -236,6 +237,8 @@ SLEPC_EXTERN PetscErrorCode SVDAllocateSolution(SVD,PetscInt);
 
 SLEPC_EXTERN PetscErrorCode SVDCrossSetExplicitMatrix(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDCrossGetExplicitMatrix(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDCrossSetSymmetric(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDCrossGetSymmetric(SVD,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SVDCrossSetEPS(SVD,EPS);
 SLEPC_EXTERN PetscErrorCode SVDCrossGetEPS(SVD,EPS*);
 
@@ -246,6 +249,8 @@ SLEPC_EXTERN PetscErrorCode SVDCyclicGetEPS(SVD,EPS*);
 
 SLEPC_EXTERN PetscErrorCode SVDLanczosSetOneSide(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDLanczosGetOneSide(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDLanczosSetPipelined(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDLanczosGetPipelined(SVD,PetscBool*);
 
 /*E
     SVDTRLanczosGBidiag - determines the bidiagonalization choice for the
@@ -264,8 +269,14 @@ SLEPC_EXTERN const char *SVDTRLanczosGBidiags[];
 
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetGBidiag(SVD,SVDTRLanczosGBidiag);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetGBidiag(SVD,SVDTRLanczosGBidiag*);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetJoint(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetJoint(SVD,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetOneSide(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetOneSide(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetSelective(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetSelective(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetStoreU(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetStoreU(SVD,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetKSP(SVD,KSP);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetKSP(SVD,KSP*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetRestart(SVD,PetscReal);
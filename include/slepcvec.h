@@ -24,6 +24,8 @@ SLEPC_EXTERN PetscErrorCode VecCreateComp(MPI_Comm,PetscInt*,PetscInt,VecType,Ve
 SLEPC_EXTERN PetscErrorCode VecCreateCompWithVecs(Vec*,PetscInt,Vec,Vec*);
 SLEPC_EXTERN PetscErrorCode VecCompGetSubVecs(Vec,PetscInt*,const Vec**);
 SLEPC_EXTERN PetscErrorCode VecCompSetSubVecs(Vec,PetscInt,Vec*);
+SLEPC_EXTERN PetscErrorCode VecCompNormComponents(Vec,NormType,PetscReal[]);
+SLEPC_EXTERN PetscErrorCode VecCompDotComponents(Vec,Vec,PetscScalar[]);
 
 /* Some auxiliary functions */
 SLEPC_EXTERN PetscErrorCode VecNormalizeComplex(Vec,Vec,PetscBool,PetscReal*);
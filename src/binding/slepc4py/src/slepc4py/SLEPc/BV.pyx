@@ -845,6 +845,64 @@ cdef class BV(Object):
         CHKERR( PetscObjectDereference(<PetscObject>v.vec) )
         CHKERR( BVRestoreColumn(self.bv, ival, &v.vec) )
 
+    def getColumnArrayRead(self, j):
+        """
+        Returns a read-only NumPy view of the local entries of the requested
+        column of the basis vectors object, without copying.
+
+        Parameters
+        ----------
+        j: int
+            The index of the requested column.
+
+        Returns
+        -------
+        a: ndarray
+            Read-only alias of the contiguous storage of the jth column.
+
+        Notes
+        -----
+        The returned array aliases the internal storage of the BV, so it is
+        valid only until `restoreColumnArrayRead()` is called with the same
+        arguments, which must be done when access is no longer needed.
+        """
+        cdef PetscInt ival = asInt(j)
+        cdef PetscInt n=0, N=0, m=0, ld=0, nc=0
+        cdef const PetscScalar *a = NULL
+        CHKERR( BVGetSizes(self.bv, &n, &N, &m) )
+        CHKERR( BVGetLeadingDimension(self.bv, &ld) )
+        CHKERR( BVGetNumConstraints(self.bv, &nc) )
+        CHKERR( BVGetArrayRead(self.bv, &a) )
+        cdef ndarray array = aview_s(n, a + (nc + ival)*ld)
+        array.setflags(write=False)
+        return array
+
+    def restoreColumnArrayRead(self, j, a):
+        """
+        Restore the BV after a call to `getColumnArrayRead()`.
+
+        Parameters
+        ----------
+        j: int
+            The index of the requested column.
+        a: ndarray
+            The array obtained with `getColumnArrayRead()`.
+
+        Notes
+        -----
+        The arguments must match the corresponding call to
+        `getColumnArrayRead()`. The array must not be accessed afterwards.
+        """
+        cdef PetscInt ival = asInt(j)
+        cdef PetscInt n=0, N=0, m=0, ld=0, nc=0
+        cdef ndarray ary = asarray(a)
+        cdef const PetscScalar *data = NULL
+        CHKERR( BVGetSizes(self.bv, &n, &N, &m) )
+        CHKERR( BVGetLeadingDimension(self.bv, &ld) )
+        CHKERR( BVGetNumConstraints(self.bv, &nc) )
+        data = (<const PetscScalar*> PyArray_DATA(ary)) - (nc + ival)*ld
+        CHKERR( BVRestoreArrayRead(self.bv, &data) )
+
     def getMat(self):
         """
         Returns a Mat object of dense type that shares the memory
@@ -1263,7 +1263,7 @@ cdef class EPS(Object):
         """
         Solves the eigensystem.
         """
-        CHKERR( EPSSolve(self.eps) )
+        with nogil: CHKERR( EPSSolve(self.eps) )
 
     def getIterationNumber(self):
         """
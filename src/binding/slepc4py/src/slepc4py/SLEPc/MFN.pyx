@@ -340,7 +340,7 @@ cdef class MFN(Object):
         x: Vec
             The solution.
         """
-        CHKERR( MFNSolve(self.mfn, b.vec, x.vec) )
+        with nogil: CHKERR( MFNSolve(self.mfn, b.vec, x.vec) )
 
     def solveTranspose(self, Vec b, Vec x):
         """
@@ -354,7 +354,7 @@ cdef class MFN(Object):
         x: Vec
             The solution.
         """
-        CHKERR( MFNSolveTranspose(self.mfn, b.vec, x.vec) )
+        with nogil: CHKERR( MFNSolveTranspose(self.mfn, b.vec, x.vec) )
 
     def getIterationNumber(self):
         """
@@ -739,7 +739,7 @@ cdef class NEP(Object):
         """
         Solves the eigensystem.
         """
-        CHKERR( NEPSolve(self.nep) )
+        with nogil: CHKERR( NEPSolve(self.nep) )
 
     def getIterationNumber(self):
         """
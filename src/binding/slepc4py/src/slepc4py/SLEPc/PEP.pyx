@@ -1037,7 +1037,7 @@ cdef class PEP(Object):
         """
         Solves the eigensystem.
         """
-        CHKERR( PEPSolve(self.pep) )
+        with nogil: CHKERR( PEPSolve(self.pep) )
 
     def getIterationNumber(self):
         """
@@ -784,7 +784,7 @@ cdef class SVD(Object):
         """
         Solves the singular value problem.
         """
-        CHKERR( SVDSolve(self.svd) )
+        with nogil: CHKERR( SVDSolve(self.svd) )
 
     def getIterationNumber(self):
         """
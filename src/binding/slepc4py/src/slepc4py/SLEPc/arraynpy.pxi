@@ -124,6 +124,13 @@ cdef inline ndarray array_s(PetscInt size, const PetscScalar* data):
         memcpy(PyArray_DATA(ary), data, <size_t>size*sizeof(PetscScalar))
     return ary
 
+cdef inline ndarray aview_s(PetscInt size, const PetscScalar* data):
+    # zero-copy view, the caller is responsible for the lifetime of data
+    cdef npy_intp s = <npy_intp> size
+    cdef ndarray ary = PyArray_SimpleNewFromData(1, &s, NPY_PETSC_SCALAR,
+                                                 <void*>data)
+    return ary
+
 # --------------------------------------------------------------------
 
 cdef inline ndarray iarray(object ob, int typenum):
@@ -85,6 +85,8 @@ cdef extern from * nogil:
     PetscErrorCode BVGetNumConstraints(SlepcBV,PetscInt*)
     PetscErrorCode BVGetColumn(SlepcBV,PetscInt,PetscVec*)
     PetscErrorCode BVRestoreColumn(SlepcBV,PetscInt,PetscVec*)
+    PetscErrorCode BVGetArrayRead(SlepcBV,const PetscScalar**)
+    PetscErrorCode BVRestoreArrayRead(SlepcBV,const PetscScalar**)
     PetscErrorCode BVCopyVec(SlepcBV,PetscInt,PetscVec)
     PetscErrorCode BVCopyColumn(SlepcBV,PetscInt,PetscInt)
 
@@ -85,10 +85,11 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
 {
   EPS_LOBPCG     *ctx = (EPS_LOBPCG*)eps->data;
   PetscInt       i,j,k,nv,ini,nmat,nc,nconv,locked,its,prev=0;
-  PetscReal      norm;
+  PetscReal      norm,*nrm=NULL;
   PetscScalar    *eigr,dot;
+  const PetscScalar *garray;
   PetscBool      breakdown,countc,flip=PETSC_FALSE,checkprecond=PETSC_FALSE;
-  Mat            A,B,M,V=NULL,W=NULL;
+  Mat            A,B,M,V=NULL,W=NULL,H=NULL,G=NULL;
   Vec            v,z,w=eps->work[0];
   BV             X,Y=NULL,Z,R,P,AX,BX;
   SlepcSC        sc;
@@ -117,7 +118,13 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AX));
   if (B) PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BX));
   nc = eps->nds;
-  if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDuplicateResize(eps->V,nc+eps->nev,&Y));
+  if (nc>0 || eps->nev>ctx->bs-ctx->guard) {
+    PetscCall(BVDuplicateResize(eps->V,nc+eps->nev,&Y));
+    /* work matrices for the blocked constraint application */
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,nc+eps->nev,ctx->bs,NULL,&H));
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ctx->bs,ctx->bs,NULL,&G));
+    PetscCall(PetscMalloc1(ctx->bs,&nrm));
+  }
   if (nc>0) {
     for (j=0;j<nc;j++) {
       PetscCall(BVGetColumn(eps->V,-nc+j,&v));
@@ -309,21 +316,34 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
         }
       }
     }
+    PetscCall(MatCopy(W,V,SAME_NONZERO_PATTERN));
+    PetscCall(BVRestoreMat(R,&V));
+
+    /* 10. Purge constraints from the preconditioned residuals, blocked as
+       classical Gram-Schmidt with reorthogonalization so that the whole
+       block is processed with a few matrix products */
     if (nc+locked>0) {
+      PetscCall(BVDot(R,R,G));
+      PetscCall(MatDenseGetArrayRead(G,&garray));
+      for (j=ini;j<ctx->bs;j++) nrm[j] = PetscRealPart(garray[j+j*ctx->bs]);
+      PetscCall(MatDenseRestoreArrayRead(G,&garray));
+      for (i=0;i<2;i++) {
+        PetscCall(BVDot(R,Y,H));
+        PetscCall(BVMult(R,-1.0,1.0,Y,H));
+      }
+      PetscCall(BVDot(R,R,G));
+      PetscCall(MatDenseGetArrayRead(G,&garray));
+      breakdown = PETSC_FALSE;
       for (j=ini;j<ctx->bs;j++) {
-        PetscCall(MatDenseGetColumnVecWrite(W,j-ini,&w));
-        PetscCall(BVOrthogonalizeVec(Y,w,NULL,&norm,&breakdown));
-        if (norm>0.0 && !breakdown) PetscCall(VecScale(w,1.0/norm));
-        PetscCall(MatDenseRestoreColumnVecWrite(W,j-ini,&w));
-        if (norm<=0.0 || breakdown) {
-          PetscCall(PetscInfo(eps,"Orthogonalization of preconditioned residual failed\n"));
-          eps->reason = EPS_DIVERGED_BREAKDOWN;
-          goto diverged;
-        }
+        if (PetscRealPart(garray[j+j*ctx->bs]) <= PetscSqr((PetscReal)eps->n*PETSC_MACHINE_EPSILON)*nrm[j]) breakdown = PETSC_TRUE;
+      }
+      PetscCall(MatDenseRestoreArrayRead(G,&garray));
+      if (breakdown) {
+        PetscCall(PetscInfo(eps,"Orthogonalization of preconditioned residual failed\n"));
+        eps->reason = EPS_DIVERGED_BREAKDOWN;
+        goto diverged;
       }
     }
-    PetscCall(MatCopy(W,V,SAME_NONZERO_PATTERN));
-    PetscCall(BVRestoreMat(R,&V));
 
     /* 11. B-orthonormalize preconditioned residuals */
     PetscCall(BVOrthogonalize(R,NULL));
@@ -390,7 +410,12 @@ diverged:
   PetscCall(BVDestroy(&P));
   PetscCall(BVDestroy(&AX));
   if (B) PetscCall(BVDestroy(&BX));
-  if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDestroy(&Y));
+  if (nc>0 || eps->nev>ctx->bs-ctx->guard) {
+    PetscCall(BVDestroy(&Y));
+    PetscCall(MatDestroy(&H));
+    PetscCall(MatDestroy(&G));
+    PetscCall(PetscFree(nrm));
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -55,6 +55,10 @@ typedef struct {
   PetscScalar       *weight;
   PetscScalar       *omega;
   PetscScalar       *pp;
+  PetscScalar       *kspomega;  /* shift used to build the operator of each KSP */
+  PetscInt          nkspomega;  /* number of valid entries in kspomega (0 if stale) */
+  PetscObjectState  Astate,Bstate;   /* state of the matrices the KSP operators were built from */
+  PetscObjectId     Aid,Bid;    /* Id of the matrices the KSP operators were built from */
   BV                V;
   BV                S;
   BV                pV;
@@ -75,6 +79,9 @@ static PetscErrorCode EPSCISSSetUp(EPS eps,Mat A,Mat B,Mat Pa,Mat Pb)
   PetscInt         i,p_id,nsplit;
   Mat              Amat,Pmat;
   MatStructure     str,strp;
+  PetscObjectState Astate,Bstate=0;
+  PetscObjectId    Aid,Bid=0;
+  PetscBool        reuse;
 
   PetscFunctionBegin;
   if (!ctx->contour || !ctx->contour->ksp) PetscCall(EPSCISSGetKSPs(eps,NULL,NULL));
@@ -82,8 +89,23 @@ static PetscErrorCode EPSCISSSetUp(EPS eps,Mat A,Mat B,Mat Pa,Mat Pb)
   contour = ctx->contour;
   PetscCall(STGetMatStructure(eps->st,&str));
   PetscCall(STGetSplitPreconditionerInfo(eps->st,&nsplit,&strp));
+  /* reuse KSP factorizations of integration points whose operator has not changed,
+     e.g. quadrature points shared between nearby contours in a parameter sweep */
+  PetscCall(PetscObjectStateGet((PetscObject)A,&Astate));
+  PetscCall(PetscObjectGetId((PetscObject)A,&Aid));
+  if (B) {
+    PetscCall(PetscObjectStateGet((PetscObject)B,&Bstate));
+    PetscCall(PetscObjectGetId((PetscObject)B,&Bid));
+  }
+  reuse = (ctx->nkspomega==contour->npoints && Astate==ctx->Astate && Aid==ctx->Aid && Bstate==ctx->Bstate && Bid==ctx->Bid)? PETSC_TRUE: PETSC_FALSE;
+  if (ctx->nkspomega != contour->npoints) {
+    PetscCall(PetscFree(ctx->kspomega));
+    PetscCall(PetscMalloc1(contour->npoints,&ctx->kspomega));
+  }
   for (i=0;i<contour->npoints;i++) {
     p_id = i*contour->subcomm->n + contour->subcomm->color;
+    if (reuse && ctx->kspomega[i]==ctx->omega[p_id]) continue;
+    ctx->kspomega[i] = ctx->omega[p_id];
     PetscCall(MatDuplicate(A,MAT_COPY_VALUES,&Amat));
     if (B) PetscCall(MatAXPY(Amat,-ctx->omega[p_id],B,str));
     else PetscCall(MatShift(Amat,-ctx->omega[p_id]));
@@ -96,6 +118,9 @@ static PetscErrorCode EPSCISSSetUp(EPS eps,Mat A,Mat B,Mat Pa,Mat Pb)
     PetscCall(MatDestroy(&Amat));
     if (nsplit) PetscCall(MatDestroy(&Pmat));
   }
+  ctx->nkspomega = contour->npoints;
+  ctx->Astate = Astate; ctx->Aid = Aid;
+  ctx->Bstate = Bstate; ctx->Bid = Bid;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -116,6 +141,14 @@ static PetscErrorCode EPSCISSSolve(EPS eps,Mat B,BV V,PetscInt L_start,PetscInt
   PetscAssert(ctx->contour && ctx->contour->ksp,PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"Something went wrong with EPSCISSGetKSPs()");
   PetscCall(BVSetActiveColumns(V,L_start,L_end));
   PetscCall(BVGetMat(V,&MV));
+  if (B) {
+    /* the right-hand side block B*V is shared by all integration points, so compute it only once */
+    PetscCall(MatProductCreate(B,MV,NULL,&BMV));
+    PetscCall(MatProductSetType(BMV,MATPRODUCT_AB));
+    PetscCall(MatProductSetFromOptions(BMV));
+    PetscCall(MatProductSymbolic(BMV));
+    PetscCall(MatProductNumeric(BMV));
+  }
   for (i=0;i<contour->npoints;i++) {
     p_id = i*contour->subcomm->n + contour->subcomm->color;
     if (ctx->usest)  {
@@ -124,16 +157,8 @@ static PetscErrorCode EPSCISSSolve(EPS eps,Mat B,BV V,PetscInt L_start,PetscInt
     } else ksp = contour->ksp[i];
     PetscCall(BVSetActiveColumns(ctx->Y,i*ctx->L+L_start,i*ctx->L+L_end));
     PetscCall(BVGetMat(ctx->Y,&MC));
-    if (B) {
-      if (!i) {
-        PetscCall(MatProductCreate(B,MV,NULL,&BMV));
-        PetscCall(MatProductSetType(BMV,MATPRODUCT_AB));
-        PetscCall(MatProductSetFromOptions(BMV));
-        PetscCall(MatProductSymbolic(BMV));
-      }
-      PetscCall(MatProductNumeric(BMV));
-      PetscCall(KSPMatSolve(ksp,BMV,MC));
-    } else PetscCall(KSPMatSolve(ksp,MV,MC));
+    if (B) PetscCall(KSPMatSolve(ksp,BMV,MC));
+    else PetscCall(KSPMatSolve(ksp,MV,MC));
     PetscCall(BVRestoreMat(ctx->Y,&MC));
     if (ctx->usest && i<contour->npoints-1) PetscCall(KSPReset(ksp));
   }
@@ -255,14 +280,19 @@ static PetscErrorCode EPSSetUp_CISS(EPS eps)
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->rg,RGINTERVAL,&isinterval));
   PetscCheck(isellipse || isring || isinterval,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Currently only implemented for interval, elliptic or ring regions");
 
-  /* if the region has changed, then reset contour data */
+  /* if the region has changed in a way that affects the number of integration
+     points per subcommunicator, then reset contour data; otherwise the contour
+     data (and the KSP factorizations of unchanged quadrature points) is kept */
   PetscCall(PetscObjectGetId((PetscObject)eps->rg,&id));
   PetscCall(PetscObjectStateGet((PetscObject)eps->rg,&state));
   if (ctx->rgid && (id != ctx->rgid || state != ctx->rgstate)) {
-    PetscCall(SlepcContourDataDestroy(&ctx->contour));
-    PetscCall(PetscInfo(eps,"Resetting the contour data structure due to a change of region\n"));
-    ctx->rgid = id; ctx->rgstate = state;
+    PetscCall(RGCanUseConjugates(eps->rg,ctx->isreal,&flg));
+    if (ctx->contour && flg != ctx->useconj) {
+      PetscCall(SlepcContourDataDestroy(&ctx->contour));
+      PetscCall(PetscInfo(eps,"Resetting the contour data structure due to a change of region\n"));
+    }
   }
+  ctx->rgid = id; ctx->rgstate = state;
 
 #if !defined(PETSC_USE_COMPLEX)
   PetscCheck(!isring,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Ring region only supported for complex scalars");
@@ -377,7 +407,7 @@ static PetscErrorCode EPSSolve_CISS(EPS eps)
   SlepcContourData contour = ctx->contour;
   Mat              A,B,X,M,pA,pB,T,J,Pa=NULL,Pb=NULL;
   BV               V;
-  PetscInt         i,j,ld,nmat,L_add=0,nv=0,L_base=ctx->L,inner,nlocal,*inside,nsplit;
+  PetscInt         i,j,ld,nmat,L_add=0,nv=0,L_base=ctx->L,inner,nlocal,*inside,nsplit,nini,mused;
   PetscScalar      *Mu,*H0,*H1=NULL,*rr,*temp;
   PetscReal        error,max_error,norm;
   PetscBool        *fl1;
@@ -385,6 +415,7 @@ static PetscErrorCode EPSSolve_CISS(EPS eps)
   PetscRandom      rand;
 #if defined(PETSC_USE_COMPLEX)
   PetscBool        isellipse;
+  PetscInt         L_new;
   PetscReal        est_eig,eta;
 #else
   PetscReal        normi;
@@ -421,8 +452,19 @@ static PetscErrorCode EPSSolve_CISS(EPS eps)
     }
     PetscCall(EPSCISSSetUp(eps,T,J,Pa,Pb));
   }
+  /* warm start: seed the source block with the initial space, if given,
+     e.g. the subspace computed for a nearby contour in a parameter sweep */
+  nini = PetscMin(eps->nini,ctx->L);
+  if (nini) {
+    PetscCall(BVSetActiveColumns(eps->V,0,nini));
+    PetscCall(BVSetActiveColumns(ctx->V,0,nini));
+    PetscCall(BVCopy(eps->V,ctx->V));
+  }
+  if (nini<ctx->L) {
+    PetscCall(BVSetActiveColumns(ctx->V,nini,ctx->L));
+    PetscCall(BVSetRandomSign(ctx->V));
+  }
   PetscCall(BVSetActiveColumns(ctx->V,0,ctx->L));
-  PetscCall(BVSetRandomSign(ctx->V));
   PetscCall(BVGetRandomContext(ctx->V,&rand));
 
   if (contour->pA) PetscCall(BVScatter(ctx->V,ctx->pV,contour->scatterin,contour->xdup));
@@ -449,14 +491,26 @@ static PetscErrorCode EPSSolve_CISS(EPS eps)
     ctx->L += L_add;
     PetscCall(EPSCISSSolve(eps,J,V,ctx->L-L_add,ctx->L));
   }
+#if defined(PETSC_USE_COMPLEX)
+  else if (isellipse) {
+    /* the same estimate may reveal that the block size is oversized for the
+       number of eigenvalues in the region; shrinking L reduces the cost of
+       the linear solves in all subsequent iterations */
+    L_new = PetscMax((PetscInt)PetscCeilReal((est_eig*eta)/ctx->M),1);
+    if (L_new<ctx->L) {
+      PetscCall(PetscInfo(eps,"Changing L %" PetscInt_FMT " -> %" PetscInt_FMT " by Estimate #Eig\n",ctx->L,L_new));
+      PetscCall(BVCISSResizeBases(ctx->S,contour->pA?ctx->pV:ctx->V,ctx->Y,ctx->L,L_new,ctx->M,contour->npoints));
+      ctx->L = L_new;
+    }
+  }
+#endif
   PetscCall(PetscMalloc2(ctx->L*ctx->L*ctx->M*2,&Mu,ctx->L*ctx->M*ctx->L*ctx->M,&H0));
   for (i=0;i<ctx->refine_blocksize;i++) {
     PetscCall(BVDotQuadrature(ctx->Y,(contour->pA)?ctx->pV:ctx->V,Mu,ctx->M,ctx->L,ctx->L,ctx->weight,ctx->pp,contour->subcomm,contour->npoints,ctx->useconj));
-    PetscCall(CISS_BlockHankel(Mu,0,ctx->L,ctx->M,H0));
     PetscCall(PetscLogEventBegin(EPS_CISS_SVD,eps,0,0,0));
-    PetscCall(SlepcCISS_BH_SVD(H0,ctx->L*ctx->M,ctx->delta,ctx->sigma,&nv));
+    PetscCall(SlepcCISS_BH_SVD_Adaptive(Mu,0,ctx->L,ctx->M,ctx->delta,H0,ctx->sigma,&mused,&nv));
     PetscCall(PetscLogEventEnd(EPS_CISS_SVD,eps,0,0,0));
-    if (ctx->sigma[0]<=ctx->delta || nv < ctx->L*ctx->M || ctx->L == ctx->L_max) break;
+    if (ctx->sigma[0]<=ctx->delta || nv < ctx->L*mused || ctx->L == ctx->L_max) break;
     L_add = L_base;
     if (ctx->L+L_add>ctx->L_max) L_add = ctx->L_max-ctx->L;
     PetscCall(PetscInfo(eps,"Changing L %" PetscInt_FMT " -> %" PetscInt_FMT " by SVD(H0)\n",ctx->L,ctx->L+L_add));
@@ -478,9 +532,12 @@ static PetscErrorCode EPSSolve_CISS(EPS eps)
     for (inner=0;inner<=ctx->refine_inner;inner++) {
       if (ctx->extraction == EPS_CISS_EXTRACTION_HANKEL) {
         PetscCall(BVDotQuadrature(ctx->Y,(contour->pA)?ctx->pV:ctx->V,Mu,ctx->M,ctx->L,ctx->L,ctx->weight,ctx->pp,contour->subcomm,contour->npoints,ctx->useconj));
-        PetscCall(CISS_BlockHankel(Mu,0,ctx->L,ctx->M,H0));
+        /* determine the rank from Hankel matrices of increasing moment degree;
+           the degree-m matrix is the leading principal submatrix of the full
+           one, so the section extracted below is not affected by where the
+           degree scan stopped */
         PetscCall(PetscLogEventBegin(EPS_CISS_SVD,eps,0,0,0));
-        PetscCall(SlepcCISS_BH_SVD(H0,ctx->L*ctx->M,ctx->delta,ctx->sigma,&nv));
+        PetscCall(SlepcCISS_BH_SVD_Adaptive(Mu,0,ctx->L,ctx->M,ctx->delta,H0,ctx->sigma,&mused,&nv));
         PetscCall(PetscLogEventEnd(EPS_CISS_SVD,eps,0,0,0));
         break;
       } else {
@@ -1270,6 +1327,7 @@ static PetscErrorCode EPSReset_CISS(EPS eps)
   PetscCall(BVDestroy(&ctx->V));
   PetscCall(BVDestroy(&ctx->Y));
   if (!ctx->usest) PetscCall(SlepcContourDataReset(ctx->contour));
+  ctx->nkspomega = 0;  /* KSPReset discards the factorizations */
   PetscCall(BVDestroy(&ctx->pV));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1333,6 +1391,7 @@ static PetscErrorCode EPSDestroy_CISS(EPS eps)
   PetscFunctionBegin;
   PetscCall(SlepcContourDataDestroy(&ctx->contour));
   PetscCall(PetscFree4(ctx->weight,ctx->omega,ctx->pp,ctx->sigma));
+  PetscCall(PetscFree(ctx->kspomega));
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSCISSSetSizes_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSCISSGetSizes_C",NULL));
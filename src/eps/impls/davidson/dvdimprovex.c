@@ -22,7 +22,7 @@ typedef struct {
   PetscInt     size_X;
   KSP          ksp;                /* correction equation solver */
   Vec          friends;            /* reference vector for composite vectors */
-  PetscScalar  theta[4],thetai[2]; /* the shifts used in the correction eq. */
+  PetscScalar  *theta,*thetai;     /* the shifts used in the correction eq. */
   PetscInt     maxits;             /* maximum number of iterations */
   PetscInt     r_s,r_e;            /* the selected eigenpairs to improve */
   PetscInt     ksp_max_size;       /* the ksp maximum subvectors size */
@@ -163,6 +163,7 @@ static PetscErrorCode dvd_improvex_jd_d(dvdDashboard *d)
 
   PetscFunctionBegin;
   /* Free local data and objects */
+  PetscCall(PetscFree2(data->theta,data->thetai));
   PetscCall(PetscFree(data->XKZ));
   PetscCall(PetscFree(data->iXKZ));
   PetscCall(PetscFree(data->iXKZPivots));
@@ -510,7 +511,7 @@ static PetscErrorCode dvd_improvex_jd_proj_cuv(dvdDashboard *d,PetscInt i_s,Pets
   dvdImprovex_jd    *data = (dvdImprovex_jd*)d->improveX_data;
   const PetscScalar *array;
   Mat               M;
-  Vec               u[2],v[2];
+  Vec               *u,*v;
   PetscBLASInt      s,ldXKZ,info;
 
   PetscFunctionBegin;
@@ -540,15 +541,13 @@ static PetscErrorCode dvd_improvex_jd_proj_cuv(dvdDashboard *d,PetscInt i_s,Pets
   PetscCall(BVSetActiveColumns(data->U,lKZ,lKZ+n));
 
   /* Compute X, KZ and KR */
-  PetscCall(BVGetColumn(data->U,lKZ,u));
-  if (n>1) PetscCall(BVGetColumn(data->U,lKZ+1,&u[1]));
-  PetscCall(BVGetColumn(data->KZ,lKZ,v));
-  if (n>1) PetscCall(BVGetColumn(data->KZ,lKZ+1,&v[1]));
+  PetscCall(PetscMalloc2(n,&u,n,&v));
+  for (i=0;i<n;i++) PetscCall(BVGetColumn(data->U,lKZ+i,&u[i]));
+  for (i=0;i<n;i++) PetscCall(BVGetColumn(data->KZ,lKZ+i,&v[i]));
   PetscCall(d->improvex_jd_proj_uv(d,i_s,i_e,u,v,kr,theta,thetai,pX,pY,ld));
-  PetscCall(BVRestoreColumn(data->U,lKZ,u));
-  if (n>1) PetscCall(BVRestoreColumn(data->U,lKZ+1,&u[1]));
-  PetscCall(BVRestoreColumn(data->KZ,lKZ,v));
-  if (n>1) PetscCall(BVRestoreColumn(data->KZ,lKZ+1,&v[1]));
+  for (i=0;i<n;i++) PetscCall(BVRestoreColumn(data->U,lKZ+i,&u[i]));
+  for (i=0;i<n;i++) PetscCall(BVRestoreColumn(data->KZ,lKZ+i,&v[i]));
+  PetscCall(PetscFree2(u,v));
 
   /* XKZ <- U'*KZ */
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,lKZ+n,lKZ+n,NULL,&M));
@@ -582,7 +581,7 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
   PetscInt       i,j,n,maxits,maxits0,lits,s,ld,k,max_size_D,lV,kV;
   PetscScalar    *pX,*pY;
   PetscReal      tol,tol0;
-  Vec            *kr,kr_comp,D_comp,D[2],kr0[2];
+  Vec            *kr,kr_comp,D_comp,*D,*kr0;
   PetscBool      odd_situation = PETSC_FALSE;
 
   PetscFunctionBegin;
@@ -599,20 +598,26 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
   PetscAssert(data->size_X>=r_e-r_s,PETSC_COMM_SELF,PETSC_ERR_PLIB,"size_X < r_e-r_s");
 
   PetscCall(DSGetLeadingDimension(d->eps->ds,&ld));
+  PetscCall(PetscMalloc2(data->ksp_max_size,&D,data->ksp_max_size,&kr0));
 
   /* Restart lastTol if a new pair converged */
   if (data->dynamic && data->size_cX < lV)
     data->lastTol = 0.5;
 
   for (i=0,s=0;i<n;i+=s) {
-    /* If the selected eigenvalue is complex, but the arithmetic is real... */
+    /* Select the block of pairs whose correction equations are solved
+       together; a complex eigenvalue in real arithmetic takes two slots
+       and cannot be split */
+    for (s=0;i+s<n && s<data->ksp_max_size;) {
 #if !defined(PETSC_USE_COMPLEX)
-    if (d->eigi[r_s+i] != 0.0) {
-      if (i+2 <= max_size_D) s=2;
-      else break;
-    } else
+      if (d->eigi[r_s+i+s] != 0.0) {
+        if (i+s+2 <= max_size_D && s+2 <= data->ksp_max_size) s += 2;
+        else break;
+      } else
 #endif
-      s=1;
+        s++;
+    }
+    if (s == 0) break;
 
     data->r_s = r_s+i;
     data->r_e = r_s+i+s;
@@ -659,12 +664,11 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
       for (j=0;j<s;j++) PetscCall(VecScale(kr[j],-1.0));
 
       /* Compose kr and D */
-      kr0[0] = kr[0];
-      kr0[1] = (s==2 ? kr[1] : NULL);
+      for (j=0;j<s;j++) kr0[j] = kr[j];
+      for (j=s;j<data->ksp_max_size;j++) kr0[j] = NULL;
       PetscCall(VecCreateCompWithVecs(kr0,data->ksp_max_size,data->friends,&kr_comp));
-      PetscCall(BVGetColumn(d->eps->V,kV+i,&D[0]));
-      if (s==2) PetscCall(BVGetColumn(d->eps->V,kV+i+1,&D[1]));
-      else D[1] = NULL;
+      for (j=0;j<s;j++) PetscCall(BVGetColumn(d->eps->V,kV+i+j,&D[j]));
+      for (j=s;j<data->ksp_max_size;j++) D[j] = NULL;
       PetscCall(VecCreateCompWithVecs(D,data->ksp_max_size,data->friends,&D_comp));
       PetscCall(VecCompSetSubVecs(data->friends,s,NULL));
 
@@ -676,17 +680,14 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
       /* Destroy the composed ks and D */
       PetscCall(VecDestroy(&kr_comp));
       PetscCall(VecDestroy(&D_comp));
-      PetscCall(BVRestoreColumn(d->eps->V,kV+i,&D[0]));
-      if (s==2) PetscCall(BVRestoreColumn(d->eps->V,kV+i+1,&D[1]));
+      for (j=0;j<s;j++) PetscCall(BVRestoreColumn(d->eps->V,kV+i+j,&D[j]));
 
     /* If GD */
     } else {
-      PetscCall(BVGetColumn(d->eps->V,kV+i,&D[0]));
-      if (s==2) PetscCall(BVGetColumn(d->eps->V,kV+i+1,&D[1]));
+      for (j=0;j<s;j++) PetscCall(BVGetColumn(d->eps->V,kV+i+j,&D[j]));
       for (j=0;j<s;j++) PetscCall(d->improvex_precond(d,r_s+i+j,kr[j],D[j]));
       PetscCall(dvd_improvex_apply_proj(d,D,s));
-      PetscCall(BVRestoreColumn(d->eps->V,kV+i,&D[0]));
-      if (s==2) PetscCall(BVRestoreColumn(d->eps->V,kV+i+1,&D[1]));
+      for (j=0;j<s;j++) PetscCall(BVRestoreColumn(d->eps->V,kV+i+j,&D[j]));
     }
     /* Prevent that short vectors are discarded in the orthogonalization */
     if (i == 0 && d->eps->errest[d->nconv+r_s] > PETSC_MACHINE_EPSILON && d->eps->errest[d->nconv+r_s] < PETSC_MAX_REAL) {
@@ -694,6 +695,7 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
     }
     PetscCall(SlepcVecPoolRestoreVecs(d->auxV,s,&kr));
   }
+  PetscCall(PetscFree2(D,kr0));
   *size_D = i;
   if (data->dynamic) data->lastTol = PetscMax(data->lastTol/2.0,PETSC_MACHINE_EPSILON*10.0);
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -713,14 +715,10 @@ PetscErrorCode dvd_improvex_jd(dvdDashboard *d,dvdBlackboard *b,KSP ksp,PetscInt
   /* If the arithmetic is real and the problem is not Hermitian, then
      the block size is incremented in one */
 #if !defined(PETSC_USE_COMPLEX)
-  if (!DVD_IS(d->sEP,DVD_EP_HERMITIAN)) {
-    max_bs++;
-    b->max_size_P = PetscMax(b->max_size_P,2);
-  } else
+  if (!DVD_IS(d->sEP,DVD_EP_HERMITIAN)) max_bs++;
 #endif
-  {
-    b->max_size_P = PetscMax(b->max_size_P,1);
-  }
+  /* The projector spans all the pairs improved in one block */
+  b->max_size_P = PetscMax(b->max_size_P,max_bs);
   b->max_size_X = PetscMax(b->max_size_X,max_bs);
   size_P = b->max_size_P;
 
@@ -743,11 +741,11 @@ PetscErrorCode dvd_improvex_jd(dvdDashboard *d,dvdBlackboard *b,KSP ksp,PetscInt
     data->ksp = useGD? NULL: ksp;
     data->d = d;
     d->improveX = dvd_improvex_jd_gen;
-#if !defined(PETSC_USE_COMPLEX)
-    if (!DVD_IS(d->sEP,DVD_EP_HERMITIAN)) data->ksp_max_size = 2;
-    else
-#endif
-      data->ksp_max_size = 1;
+    /* All the correction equations of one block are solved together in a
+       single KSP solve on a composite vector, so the dominant cost becomes
+       multi-RHS work amortizing the operator and preconditioner setup */
+    data->ksp_max_size = max_bs;
+    PetscCall(PetscMalloc2(2*max_bs,&data->theta,max_bs,&data->thetai));
     /* Create various vector basis */
     PetscCall(BVDuplicateResize(d->eps->V,size_P,&data->KZ));
     PetscCall(BVSetMatrix(data->KZ,NULL,PETSC_FALSE));
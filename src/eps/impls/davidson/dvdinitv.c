@@ -18,6 +18,7 @@
 typedef struct {
   PetscInt k;                 /* desired initial subspace size */
   PetscInt user;              /* number of user initial vectors */
+  PetscInt bs;                /* block size for the Krylov warm start */
   void     *old_initV_data;   /* old initV data */
 } dvdInitV;
 
@@ -43,7 +44,7 @@ static PetscErrorCode dvd_initV_classic_0(dvdDashboard *d)
 static PetscErrorCode dvd_initV_krylov_0(dvdDashboard *d)
 {
   dvdInitV       *data = (dvdInitV*)d->initV_data;
-  PetscInt       i,user = PetscMin(data->user,d->eps->mpd),l,k;
+  PetscInt       i,j,user = PetscMin(data->user,d->eps->mpd),bs,l,k;
   Vec            av,v1,v2;
 
   PetscFunctionBegin;
@@ -51,18 +52,18 @@ static PetscErrorCode dvd_initV_krylov_0(dvdDashboard *d)
   /* User vectors are added at the beginning, so no active column should be in V */
   PetscAssert(data->user==0 || l==0,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
 
-  /* If needed, generate a random vector for starting the arnoldi method */
-  if (user == 0) {
-    PetscCall(BVSetRandomColumn(d->eps->V,l));
-    user = 1;
-  }
+  /* Complete the seed block with random vectors; user vectors (e.g. a solution
+     interpolated from a coarser mesh given with EPSSetInitialSpace()) come first */
+  bs = PetscMax(user,PetscMax(1,PetscMin(data->bs,data->k)));
+  for (i=l+user;i<l+bs;i++) PetscCall(BVSetRandomColumn(d->eps->V,i));
 
-  /* Perform k steps of Arnoldi with the operator K^{-1}*(t[1]*A-t[2]*B) */
-  PetscCall(dvd_orthV(d->eps->V,l,l+user));
-  for (i=l+user;i<l+data->k && i<d->eps->ncv && i-l<d->eps->mpd;i++) {
+  /* Perform k steps of block-Krylov iteration with the preconditioned operator
+     K^{-1}*(t[1]*A-t[2]*B), deferring orthogonalization to block boundaries */
+  PetscCall(dvd_orthV(d->eps->V,l,l+bs));
+  for (i=l+bs;i<l+data->k && i<d->eps->ncv && i-l<d->eps->mpd;i++) {
     /* aux <- theta[1]A*in - theta[0]*B*in */
     PetscCall(BVGetColumn(d->eps->V,i,&v1));
-    PetscCall(BVGetColumn(d->eps->V,i-user,&v2));
+    PetscCall(BVGetColumn(d->eps->V,i-bs,&v2));
     PetscCall(BVGetColumn(d->auxBV,0,&av));
     if (d->B) {
       PetscCall(MatMult(d->A,v2,v1));
@@ -74,10 +75,13 @@ static PetscErrorCode dvd_initV_krylov_0(dvdDashboard *d)
     }
     PetscCall(d->improvex_precond(d,0,av,v1));
     PetscCall(BVRestoreColumn(d->eps->V,i,&v1));
-    PetscCall(BVRestoreColumn(d->eps->V,i-user,&v2));
+    PetscCall(BVRestoreColumn(d->eps->V,i-bs,&v2));
     PetscCall(BVRestoreColumn(d->auxBV,0,&av));
-    PetscCall(dvd_orthV(d->eps->V,i,i+1));
+    if ((i+1-l)%bs==0) PetscCall(dvd_orthV(d->eps->V,i+1-bs,i+1));
   }
+  /* Orthonormalize the trailing incomplete block, if any */
+  j = l+bs*((i-l)/bs);
+  if (j<i) PetscCall(dvd_orthV(d->eps->V,j,i));
 
   d->V_tra_s = 0; d->V_tra_e = 0;
   d->V_new_s = 0; d->V_new_e = i-l;
@@ -100,7 +104,7 @@ static PetscErrorCode dvd_initV_d(dvdDashboard *d)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-PetscErrorCode dvd_initV(dvdDashboard *d, dvdBlackboard *b, PetscInt k,PetscInt user, PetscBool krylov)
+PetscErrorCode dvd_initV(dvdDashboard *d, dvdBlackboard *b, PetscInt k,PetscInt user, PetscInt bs, PetscBool krylov)
 {
   dvdInitV       *data;
 
@@ -113,6 +117,7 @@ PetscErrorCode dvd_initV(dvdDashboard *d, dvdBlackboard *b, PetscInt k,PetscInt
     PetscCall(PetscNew(&data));
     data->k = k;
     data->user = user;
+    data->bs = PetscMax(1,bs);
     data->old_initV_data = d->initV_data;
     d->initV_data = data;
     if (krylov) d->initV = dvd_initV_krylov_0;
@@ -26,7 +26,7 @@ PetscErrorCode dvd_schm_basic_preconf(dvdDashboard *d,dvdBlackboard *b,PetscInt
     PetscCall(dvd_managementV_basic(d,b,bs,mpd,min_size_V,plusk,PetscNot(harmMode==DVD_HARM_NONE),allResiduals));
 
     /* Setup the initial subspace for V */
-    PetscCall(dvd_initV(d,b,ini_size_V,size_initV,(init==DVD_INITV_KRYLOV)?PETSC_TRUE:PETSC_FALSE));
+    PetscCall(dvd_initV(d,b,ini_size_V,size_initV,bs,(init==DVD_INITV_KRYLOV)?PETSC_TRUE:PETSC_FALSE));
 
     /* Setup the convergence in order to use the SLEPc convergence test */
     PetscCall(dvd_testconv_slepc(d,b));
@@ -59,7 +59,7 @@ PetscErrorCode dvd_schm_basic_conf(dvdDashboard *d,dvdBlackboard *b,PetscInt mpd
   PetscCall(dvd_managementV_basic(d,b,bs,mpd,min_size_V,plusk,PetscNot(harmMode==DVD_HARM_NONE),allResiduals));
 
   /* Setup the initial subspace for V */
-  PetscCall(dvd_initV(d,b,ini_size_V,size_initV,(init==DVD_INITV_KRYLOV)?PETSC_TRUE:PETSC_FALSE));
+  PetscCall(dvd_initV(d,b,ini_size_V,size_initV,bs,(init==DVD_INITV_KRYLOV)?PETSC_TRUE:PETSC_FALSE));
 
   /* Setup the convergence in order to use the SLEPc convergence test */
   PetscCall(dvd_testconv_slepc(d,b));
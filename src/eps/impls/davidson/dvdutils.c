@@ -16,7 +16,13 @@
 #include "davidson.h"
 
 typedef struct {
-  PC pc;
+  PC          pc;
+  PetscReal   refresh;     /* residual reduction ratio triggering a rebuild (0 = static) */
+  PetscReal   lastnR;      /* residual norm of the targeted pair at the last iteration */
+  PetscInt    stalled;     /* consecutive iterations with poor residual reduction */
+  PetscInt    lastits;     /* outer iteration of the last monitored call */
+  PetscScalar shift;       /* shift the preconditioner was last built at */
+  Mat         P;           /* rebuilt preconditioner matrix */
 } dvdPCWrapper;
 
 /*
@@ -48,15 +54,51 @@ static PetscErrorCode dvd_improvex_precond_d(dvdDashboard *d)
   PetscFunctionBegin;
   /* Free local data */
   PetscCall(PCDestroy(&dvdpc->pc));
+  PetscCall(MatDestroy(&dvdpc->P));
   PetscCall(PetscFree(d->improvex_precond_data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Monitor the residual reduction of the first targeted pair and rebuild the
+  preconditioner at the current Ritz value when the iteration stagnates,
+  i.e. when the preconditioner built at the original shift has gone stale
+  because the targeted Ritz value drifted away from it
+*/
+static PetscErrorCode dvd_static_precond_update(dvdDashboard *d,dvdPCWrapper *dvdpc,PetscInt i)
+{
+  PetscScalar    theta = d->eigr[i];
+  PetscReal      nr = d->nR[i];
+
+  PetscFunctionBegin;
+  if (d->eps->its == dvdpc->lastits) PetscFunctionReturn(PETSC_SUCCESS);
+  dvdpc->lastits = d->eps->its;
+  if (dvdpc->lastnR < 0.0) dvdpc->shift = theta;   /* first monitored iteration */
+  else if (nr > dvdpc->refresh*dvdpc->lastnR) dvdpc->stalled++;
+  else dvdpc->stalled = 0;
+  dvdpc->lastnR = nr;
+  if (dvdpc->stalled >= 3 && PetscAbsScalar(theta-dvdpc->shift) > 0.01*PetscAbsScalar(theta)) {
+    PetscCall(PetscInfo(d->eps,"Rebuilding the preconditioner at theta=%g after stagnation\n",(double)PetscRealPart(theta)));
+    PetscCall(MatDestroy(&dvdpc->P));
+    PetscCall(MatDuplicate(d->A,MAT_COPY_VALUES,&dvdpc->P));
+    if (d->B) PetscCall(MatAXPY(dvdpc->P,-theta,d->B,UNKNOWN_NONZERO_PATTERN));
+    else PetscCall(MatShift(dvdpc->P,-theta));
+    PetscCall(PCSetReusePreconditioner(dvdpc->pc,PETSC_FALSE));
+    PetscCall(PCSetOperators(dvdpc->pc,dvdpc->P,dvdpc->P));
+    PetscCall(PCSetUp(dvdpc->pc));
+    PetscCall(PCSetReusePreconditioner(dvdpc->pc,PETSC_TRUE));
+    dvdpc->shift   = theta;
+    dvdpc->stalled = 0;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode dvd_static_precond_PC_0(dvdDashboard *d,PetscInt i,Vec x,Vec Px)
 {
   dvdPCWrapper   *dvdpc = (dvdPCWrapper*)d->improvex_precond_data;
 
   PetscFunctionBegin;
+  if (dvdpc->refresh > 0.0) PetscCall(dvd_static_precond_update(d,dvdpc,i));
   PetscCall(PCApply(dvdpc->pc,x,Px));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -88,6 +130,8 @@ PetscErrorCode dvd_static_precond_PC(dvdDashboard *d,dvdBlackboard *b,PC pc)
       PetscCall(PetscNew(&dvdpc));
       dvdpc->pc = pc;
       PetscCall(PetscObjectReference((PetscObject)pc));
+      dvdpc->lastnR  = -1.0;
+      dvdpc->lastits = -1;
       d->improvex_precond_data = dvdpc;
       d->improvex_precond = dvd_static_precond_PC_0;
 
@@ -102,6 +146,9 @@ PetscErrorCode dvd_static_precond_PC(dvdDashboard *d,dvdBlackboard *b,PC pc)
         PetscCall(PCSetOperators(pc,P,P));
         PetscCall(PCSetReusePreconditioner(pc,PETSC_TRUE));
         PetscCall(MatDestroy(&P));
+        /* Optionally rebuild the preconditioner at the current Ritz value
+           when the residual reduction per iteration drops below a threshold */
+        PetscCall(PetscOptionsGetReal(NULL,((PetscObject)d->eps)->prefix,"-eps_gd_refresh_threshold",&dvdpc->refresh,NULL));
       } else if (t2) {
         PetscCall(PCSetOperators(pc,d->A,d->A));
         PetscCall(PCSetReusePreconditioner(pc,PETSC_TRUE));
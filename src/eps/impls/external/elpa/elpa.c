@@ -39,14 +39,15 @@
   } while (0)
 
 typedef struct {
-  Mat As,Bs;        /* converted matrices */
+  Mat    As,Bs;     /* converted matrices */
+  elpa_t handle;    /* ELPA solver handle, kept across solves */
 } EPS_ELPA;
 
 static PetscErrorCode EPSSetUp_ELPA(EPS eps)
 {
   EPS_ELPA       *ctx = (EPS_ELPA*)eps->data;
   Mat            A,B;
-  PetscInt       nmat;
+  PetscInt       nmat,M,m;
   PetscBool      isshift;
   PetscScalar    shift;
 
@@ -63,15 +64,27 @@ static PetscErrorCode EPSSetUp_ELPA(EPS eps)
   EPSCheckIgnored(eps,EPS_FEATURE_EXTRACTION | EPS_FEATURE_CONVERGENCE);
   PetscCall(EPSAllocateSolution(eps,0));
 
-  /* convert matrices */
-  PetscCall(MatDestroy(&ctx->As));
-  PetscCall(MatDestroy(&ctx->Bs));
+  /* convert matrices, reusing the block-cyclic layout (and the BLACS grid it
+     carries) from a previous solve whenever the dimensions have not changed */
   PetscCall(STGetNumMatrices(eps->st,&nmat));
   PetscCall(STGetMatrix(eps->st,0,&A));
-  PetscCall(MatConvert(A,MATSCALAPACK,MAT_INITIAL_MATRIX,&ctx->As));
+  if (ctx->As) {
+    PetscCall(MatGetSize(ctx->As,&M,NULL));
+    PetscCall(MatGetLocalSize(ctx->As,&m,NULL));
+    if (M!=eps->n || m!=eps->nloc || (nmat>1 && !ctx->Bs) || (nmat==1 && ctx->Bs)) {
+      PetscCall(MatDestroy(&ctx->As));
+      PetscCall(MatDestroy(&ctx->Bs));
+      if (ctx->handle) {   /* the handle refers to the old distribution */
+        PetscCallELPA(elpa_deallocate,ctx->handle);
+        PetscCallELPANOARG(elpa_uninit);
+        ctx->handle = NULL;
+      }
+    }
+  }
+  PetscCall(MatConvert(A,MATSCALAPACK,ctx->As? MAT_REUSE_MATRIX: MAT_INITIAL_MATRIX,&ctx->As));
   if (nmat>1) {
     PetscCall(STGetMatrix(eps->st,1,&B));
-    PetscCall(MatConvert(B,MATSCALAPACK,MAT_INITIAL_MATRIX,&ctx->Bs));
+    PetscCall(MatConvert(B,MATSCALAPACK,ctx->Bs? MAT_REUSE_MATRIX: MAT_INITIAL_MATRIX,&ctx->Bs));
   }
   PetscCall(STGetShift(eps->st,&shift));
   if (shift != 0.0) {
@@ -94,24 +107,27 @@ static PetscErrorCode EPSSolve_ELPA(EPS eps)
   PetscCall(MatDuplicate(A,MAT_DO_NOT_COPY_VALUES,&Q));
   q = (Mat_ScaLAPACK*)Q->data;
 
-  PetscCallELPARET(elpa_init,20200417);    /* 20171201 */
-  PetscCallELPANOARG(handle = elpa_allocate);
-
-  /* set parameters of the matrix and its MPI distribution */
-  PetscCallELPA(elpa_set,handle,"na",a->N);                         /* matrix size */
-  PetscCallELPA(elpa_set,handle,"nev",a->N);                        /* number of eigenvectors to be computed (1<=nev<=na) */
-  PetscCallELPA(elpa_set,handle,"local_nrows",a->locr);             /* number of local rows of the distributed matrix on this MPI task  */
-  PetscCallELPA(elpa_set,handle,"local_ncols",a->locc);             /* number of local columns of the distributed matrix on this MPI task */
-  PetscCallELPA(elpa_set,handle,"nblk",a->mb);                      /* size of the BLACS block cyclic distribution */
-  PetscCallELPA(elpa_set,handle,"mpi_comm_parent",MPI_Comm_c2f(PetscObjectComm((PetscObject)eps)));
-  PetscCallELPA(elpa_set,handle,"process_row",a->grid->myrow);      /* row coordinate of MPI process */
-  PetscCallELPA(elpa_set,handle,"process_col",a->grid->mycol);      /* column coordinate of MPI process */
-  if (B) PetscCallELPA(elpa_set,handle,"blacs_context",a->grid->ictxt);
-
-  /* setup and set tunable run-time options */
-  PetscCallELPARET(elpa_setup,handle);
-  PetscCallELPA(elpa_set,handle,"solver",ELPA_SOLVER_2STAGE);
-  /* PetscCallELPA(elpa_print_settings,handle); */
+  if (!ctx->handle) {   /* the handle is created once and kept for later solves */
+    PetscCallELPARET(elpa_init,20200417);    /* 20171201 */
+    PetscCallELPANOARG(ctx->handle = elpa_allocate);
+    handle = ctx->handle;
+
+    /* set parameters of the matrix and its MPI distribution */
+    PetscCallELPA(elpa_set,handle,"na",a->N);                         /* matrix size */
+    PetscCallELPA(elpa_set,handle,"nev",a->N);                        /* number of eigenvectors to be computed (1<=nev<=na) */
+    PetscCallELPA(elpa_set,handle,"local_nrows",a->locr);             /* number of local rows of the distributed matrix on this MPI task  */
+    PetscCallELPA(elpa_set,handle,"local_ncols",a->locc);             /* number of local columns of the distributed matrix on this MPI task */
+    PetscCallELPA(elpa_set,handle,"nblk",a->mb);                      /* size of the BLACS block cyclic distribution */
+    PetscCallELPA(elpa_set,handle,"mpi_comm_parent",MPI_Comm_c2f(PetscObjectComm((PetscObject)eps)));
+    PetscCallELPA(elpa_set,handle,"process_row",a->grid->myrow);      /* row coordinate of MPI process */
+    PetscCallELPA(elpa_set,handle,"process_col",a->grid->mycol);      /* column coordinate of MPI process */
+    if (B) PetscCallELPA(elpa_set,handle,"blacs_context",a->grid->ictxt);
+
+    /* setup and set tunable run-time options */
+    PetscCallELPARET(elpa_setup,handle);
+    PetscCallELPA(elpa_set,handle,"solver",ELPA_SOLVER_2STAGE);
+    /* PetscCallELPA(elpa_print_settings,handle); */
+  } else handle = ctx->handle;
 
   /* solve the eigenvalue problem */
   if (B) {
@@ -119,10 +135,6 @@ static PetscErrorCode EPSSolve_ELPA(EPS eps)
     PetscCallELPA(elpa_generalized_eigenvectors,handle,a->loc,b->loc,w,q->loc,0);
   } else PetscCallELPA(elpa_eigenvectors,handle,a->loc,w,q->loc);
 
-  /* cleanup */
-  PetscCallELPA(elpa_deallocate,handle);
-  PetscCallELPANOARG(elpa_uninit);
-
   for (i=0;i<eps->ncv;i++) {
     eps->eigr[i]   = eps->errest[i];
     eps->errest[i] = PETSC_MACHINE_EPSILON;
@@ -153,6 +165,11 @@ static PetscErrorCode EPSReset_ELPA(EPS eps)
   PetscFunctionBegin;
   PetscCall(MatDestroy(&ctx->As));
   PetscCall(MatDestroy(&ctx->Bs));
+  if (ctx->handle) {
+    PetscCallELPA(elpa_deallocate,ctx->handle);
+    PetscCallELPANOARG(elpa_uninit);
+    ctx->handle = NULL;
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -162,9 +162,9 @@ static PetscErrorCode EPSSetUp_EVSL(EPS eps)
 static PetscErrorCode EPSSolve_EVSL(EPS eps)
 {
   EPS_EVSL       *ctx = (EPS_EVSL*)eps->data;
-  PetscInt       i,j,k=0,sl,mlan,nevout,*ind,nevmax,rstart,rend,*nevloc,*disp,N;
+  PetscInt       i,j,k=0,sl,mlan,nevout,*ind,nevmax,rstart,rend,*nevloc,*disp,N,ld;
   PetscReal      *res,xintv[4],*errest;
-  PetscScalar    *lam,*X,*Y,*vinit,*eigr;
+  PetscScalar    *lam,*X=NULL,*Y,*vinit,*eigr,*a=NULL;
   PetscMPIInt    size,rank;
   PetscRandom    rnd;
   Vec            v,w,v0,x;
@@ -181,7 +181,14 @@ static PetscErrorCode EPSSolve_EVSL(EPS eps)
   PetscCall(BVGetRandomContext(eps->V,&rnd));
   PetscCall(VecSetRandom(v0,rnd));
   PetscCall(VecGetArray(v0,&vinit));
-  PetscCall(PetscMalloc5(size,&nevloc,size+1,&disp,nevmax,&eigr,nevmax,&errest,nevmax*eps->n,&X));
+  PetscCall(PetscMalloc4(size,&nevloc,size+1,&disp,nevmax,&eigr,nevmax,&errest));
+  if (size>1) PetscCall(PetscMalloc1(nevmax*eps->n,&X));
+  else {
+    /* sequential run: write the eigenvectors straight into the BV storage,
+       avoiding the intermediate buffer and the scatter */
+    PetscCall(BVGetLeadingDimension(eps->V,&ld));
+    PetscCall(BVGetArray(eps->V,&a));
+  }
   mlan = PetscMin(PetscMax(5*ctx->nev,300),eps->n);
   for (sl=rstart; sl<rend; sl++) {
     xintv[0] = ctx->sli[sl];
@@ -196,7 +203,7 @@ static PetscErrorCode EPSSolve_EVSL(EPS eps)
     find_pol(xintv,&pol);
     PetscCall(PetscInfo(ctx->A,"Polynomial [type = %" PetscInt_FMT "], deg %" PetscInt_FMT ", bar %e gam %e\n",pol.type,pol.deg,pol.bar,pol.gam));
     PetscCallEVSL(ChebLanNr,xintv,mlan,eps->tol,vinit,&pol,&nevout,&lam,&Y,&res,NULL);
-    PetscCheck(k+nevout<=nevmax,PetscObjectComm((PetscObject)eps),PETSC_ERR_LIB,"Too low estimation of eigenvalue count, try modifying the sampling parameters");
+    PetscCheck(k+nevout<=nevmax && (size>1 || k+nevout<=eps->ncv),PetscObjectComm((PetscObject)eps),PETSC_ERR_LIB,"Too low estimation of eigenvalue count, try modifying the sampling parameters");
     free_pol(&pol);
     PetscCall(PetscInfo(ctx->A,"Computed %" PetscInt_FMT " eigenvalues\n",nevout));
     PetscCall(PetscMalloc1(nevout,&ind));
@@ -204,7 +211,8 @@ static PetscErrorCode EPSSolve_EVSL(EPS eps)
     for (i=0;i<nevout;i++) {
       eigr[i+k]   = lam[i];
       errest[i+k] = res[ind[i]];
-      PetscCall(PetscArraycpy(X+(i+k)*eps->n,Y+ind[i]*eps->n,eps->n));
+      if (size>1) PetscCall(PetscArraycpy(X+(i+k)*eps->n,Y+ind[i]*eps->n,eps->n));
+      else PetscCall(PetscArraycpy(a+(i+k)*ld,Y+ind[i]*eps->n,eps->n));
     }
     k += nevout;
     if (lam) evsl_Free(lam);
@@ -214,6 +222,7 @@ static PetscErrorCode EPSSolve_EVSL(EPS eps)
   }
   PetscCall(VecRestoreArray(v0,&vinit));
   PetscCall(VecDestroy(&v0));
+  if (a) PetscCall(BVRestoreArray(eps->V,&a));
 
   /* gather eigenvalues computed by each MPI process */
   PetscCallMPI(MPI_Allgather(&k,1,MPIU_INT,nevloc,1,MPIU_INT,PetscObjectComm((PetscObject)eps)));
@@ -231,28 +240,32 @@ static PetscErrorCode EPSSolve_EVSL(EPS eps)
   eps->its    = 1;
   eps->reason = EPS_CONVERGED_TOL;
 
-  /* scatter computed eigenvectors and store them in eps->V */
-  PetscCall(BVCreateVec(eps->V,&w));
-  for (i=0;i<size;i++) {
-    N = (rank==i)? eps->n: 0;
-    PetscCall(VecCreateSeq(PETSC_COMM_SELF,N,&x));
-    PetscCall(VecSetFromOptions(x));
-    PetscCall(ISCreateStride(PETSC_COMM_SELF,N,0,1,&is));
-    PetscCall(VecScatterCreate(x,is,w,is,&vs));
-    PetscCall(ISDestroy(&is));
-    for (j=disp[i];j<disp[i+1];j++) {
-      PetscCall(BVGetColumn(eps->V,j,&v));
-      if (rank==i) PetscCall(VecPlaceArray(x,X+(j-disp[i])*eps->n));
-      PetscCall(VecScatterBegin(vs,x,v,INSERT_VALUES,SCATTER_FORWARD));
-      PetscCall(VecScatterEnd(vs,x,v,INSERT_VALUES,SCATTER_FORWARD));
-      if (rank==i) PetscCall(VecResetArray(x));
-      PetscCall(BVRestoreColumn(eps->V,j,&v));
+  /* scatter computed eigenvectors and store them in eps->V (sequential runs
+     have already placed them in the BV storage) */
+  if (size>1) {
+    PetscCall(BVCreateVec(eps->V,&w));
+    for (i=0;i<size;i++) {
+      N = (rank==i)? eps->n: 0;
+      PetscCall(VecCreateSeq(PETSC_COMM_SELF,N,&x));
+      PetscCall(VecSetFromOptions(x));
+      PetscCall(ISCreateStride(PETSC_COMM_SELF,N,0,1,&is));
+      PetscCall(VecScatterCreate(x,is,w,is,&vs));
+      PetscCall(ISDestroy(&is));
+      for (j=disp[i];j<disp[i+1];j++) {
+        PetscCall(BVGetColumn(eps->V,j,&v));
+        if (rank==i) PetscCall(VecPlaceArray(x,X+(j-disp[i])*eps->n));
+        PetscCall(VecScatterBegin(vs,x,v,INSERT_VALUES,SCATTER_FORWARD));
+        PetscCall(VecScatterEnd(vs,x,v,INSERT_VALUES,SCATTER_FORWARD));
+        if (rank==i) PetscCall(VecResetArray(x));
+        PetscCall(BVRestoreColumn(eps->V,j,&v));
+      }
+      PetscCall(VecScatterDestroy(&vs));
+      PetscCall(VecDestroy(&x));
     }
-    PetscCall(VecScatterDestroy(&vs));
-    PetscCall(VecDestroy(&x));
+    PetscCall(VecDestroy(&w));
+    PetscCall(PetscFree(X));
   }
-  PetscCall(VecDestroy(&w));
-  PetscCall(PetscFree5(nevloc,disp,eigr,errest,X));
+  PetscCall(PetscFree4(nevloc,disp,eigr,errest));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
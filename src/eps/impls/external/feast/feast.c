@@ -43,11 +43,70 @@ typedef struct {
 #else
   MKL_Complex16 *work2;
 #endif
+#if defined(PETSC_USE_COMPLEX)
+  PetscScalar   *work3;           /* solution buffer for the blocked solves */
+#endif
+  KSP           *ksps;            /* cached linear solver of each quadrature node */
+  PetscReal     *sreal,*simag;    /* shift associated with each quadrature node */
+  PetscInt      nshifts;          /* number of quadrature nodes seen so far */
+  PetscInt      cur;              /* node selected by the last change of shift */
 } EPS_FEAST;
 
+/*
+   EPSFEASTSelectKSP: pick the cached linear solver associated with the given
+   quadrature node, building and factoring the shifted matrix only the first
+   time the node appears; subsequent refinement loops revisit the same nodes
+   and reuse the factorizations
+*/
+static PetscErrorCode EPSFEASTSelectKSP(EPS eps,PetscReal zr,PetscReal zi)
+{
+  EPS_FEAST      *ctx = (EPS_FEAST*)eps->data;
+  PetscInt       i,nmat;
+  PetscScalar    sigma;
+  Mat            A,B,T;
+  PC             pc;
+
+  PetscFunctionBegin;
+  for (i=0;i<ctx->nshifts;i++) {
+    if (ctx->sreal[i]==zr && ctx->simag[i]==zi) {
+      ctx->cur = i;
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
+  PetscCheck(ctx->nshifts<ctx->npoints,PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"FEAST used more quadrature nodes than contour points");
+  i = ctx->nshifts;
+#if defined(PETSC_USE_COMPLEX)
+  sigma = PetscCMPLX(zr,zi);
+#else
+  sigma = zr;  /* only the real part of the node can be represented in real arithmetic */
+#endif
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(MatDuplicate(A,MAT_COPY_VALUES,&T));
+  if (nmat>1) {
+    PetscCall(STGetMatrix(eps->st,1,&B));
+    PetscCall(MatAXPY(T,-sigma,B,UNKNOWN_NONZERO_PATTERN));
+  } else PetscCall(MatShift(T,-sigma));
+  PetscCall(KSPCreate(PETSC_COMM_SELF,&ctx->ksps[i]));
+  PetscCall(PetscObjectIncrementTabLevel((PetscObject)ctx->ksps[i],(PetscObject)eps,1));
+  PetscCall(KSPSetOptionsPrefix(ctx->ksps[i],((PetscObject)eps)->prefix));
+  PetscCall(KSPAppendOptionsPrefix(ctx->ksps[i],"eps_feast_"));
+  PetscCall(KSPSetOperators(ctx->ksps[i],T,T));
+  PetscCall(KSPSetType(ctx->ksps[i],KSPPREONLY));
+  PetscCall(KSPGetPC(ctx->ksps[i],&pc));
+  PetscCall(PCSetType(pc,PCLU));
+  PetscCall(KSPSetFromOptions(ctx->ksps[i]));
+  PetscCall(MatDestroy(&T));
+  ctx->sreal[i] = zr;
+  ctx->simag[i] = zi;
+  ctx->nshifts++;
+  ctx->cur = i;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSetUp_FEAST(EPS eps)
 {
-  PetscInt       ncv;
+  PetscInt       i,ncv;
   EPS_FEAST      *ctx = (EPS_FEAST*)eps->data;
   PetscMPIInt    size;
 
@@ -71,6 +130,14 @@ static PetscErrorCode EPSSetUp_FEAST(EPS eps)
   ncv = eps->ncv;
   PetscCall(PetscFree4(ctx->work1,ctx->work2,ctx->Aq,ctx->Bq));
   PetscCall(PetscMalloc4(eps->nloc*ncv,&ctx->work1,eps->nloc*ncv,&ctx->work2,ncv*ncv,&ctx->Aq,ncv*ncv,&ctx->Bq));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree(ctx->work3));
+  PetscCall(PetscMalloc1(eps->nloc*ncv,&ctx->work3));
+#endif
+  for (i=0;i<ctx->nshifts;i++) PetscCall(KSPDestroy(&ctx->ksps[i]));
+  PetscCall(PetscFree3(ctx->ksps,ctx->sreal,ctx->simag));
+  PetscCall(PetscCalloc3(ctx->npoints,&ctx->ksps,ctx->npoints,&ctx->sreal,ctx->npoints,&ctx->simag));
+  ctx->nshifts = 0;
 
   PetscCall(EPSAllocateSolution(eps,0));
   PetscCall(EPSSetWorkVecs(eps,2));
@@ -82,9 +149,15 @@ static PetscErrorCode EPSSolve_FEAST(EPS eps)
   EPS_FEAST      *ctx = (EPS_FEAST*)eps->data;
   MKL_INT        fpm[128],ijob,n,ncv,nconv,loop,info;
   PetscReal      *evals,epsout=0.0;
+#if defined(PETSC_USE_COMPLEX)
+  PetscInt       i,nmat,ld;
+  PetscScalar    *pV,*X=NULL;
+  Vec            x,y;
+#else
   PetscInt       i,k,nmat,ld;
   PetscScalar    *pV,*pz,*X=NULL;
   Vec            x,y,w=eps->work[0],z=eps->work[1];
+#endif
   Mat            A,B;
 #if defined(PETSC_USE_REAL_SINGLE)
   MKL_Complex8   Ze;
@@ -104,16 +177,23 @@ static PetscErrorCode EPSSolve_FEAST(EPS eps)
   fpm[2] = -PetscLog10Real(eps->tol);       /* tolerance for trace */
 #endif
   fpm[3] = eps->max_it;                     /* refinement loops */
+  fpm[4] = (eps->nini>0)? 1: 0;             /* start from the given subspace */
   fpm[5] = 1;                               /* second stopping criterion */
 #if defined(PETSC_USE_REAL_SINGLE)
   fpm[6] = -PetscLog10Real(eps->tol);       /* tolerance for trace */
 #endif
 
   PetscCall(PetscMalloc1(eps->ncv,&evals));
+  /* complete the initial subspace with random vectors, FEAST uses all ncv columns */
+  if (fpm[4]) for (i=eps->nini;i<eps->ncv;i++) PetscCall(BVSetRandomColumn(eps->V,i));
   PetscCall(BVGetLeadingDimension(eps->V,&ld));
   PetscCall(BVGetArray(eps->V,&pV));
   if (ld==n) X = pV;
-  else PetscCall(PetscMalloc1(eps->ncv*n,&X));
+  else {
+    PetscCall(PetscMalloc1(eps->ncv*n,&X));
+    /* the initial vectors were inserted in V at setup, pass them on to FEAST */
+    if (fpm[4]) for (i=0;i<eps->ncv;i++) PetscCall(PetscArraycpy(X+i*n,pV+i*ld,n));
+  }
 
   ijob = -1;           /* first call to reverse communication interface */
   PetscCall(STGetNumMatrices(eps->st,&nmat));
@@ -128,33 +208,38 @@ static PetscErrorCode EPSSolve_FEAST(EPS eps)
 
     PetscCheck(ncv==eps->ncv,PetscObjectComm((PetscObject)eps),PETSC_ERR_LIB,"FEAST changed value of ncv to %d",(int)ncv);
     if (ijob == 10) {
-      /* set new quadrature point */
-      PetscCall(STSetShift(eps->st,Ze.real));
+      /* set new quadrature point, reusing the factorization if the node was already visited */
+      PetscCall(EPSFEASTSelectKSP(eps,(PetscReal)Ze.real,(PetscReal)Ze.imag));
     } else if (ijob == 20) {
       /* use same quadrature point and factorization for transpose solve */
     } else if (ijob == 11 || ijob == 21) {
       /* linear solve (A-sigma*B)\work2, overwrite work2 */
-      for (k=0;k<ncv;k++) {
-        PetscCall(VecGetArray(z,&pz));
 #if defined(PETSC_USE_COMPLEX)
-        for (i=0;i<eps->nloc;i++) pz[i] = PetscCMPLX(ctx->work2[eps->nloc*k+i].real,ctx->work2[eps->nloc*k+i].imag);
+      Mat R,S;
+
+      PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,eps->nloc,eps->ncv,(PetscScalar*)ctx->work2,&R));
+      PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,eps->nloc,eps->ncv,ctx->work3,&S));
+      if (ijob == 11) PetscCall(KSPMatSolve(ctx->ksps[ctx->cur],R,S));
+      else {
+        PetscCall(MatConjugate(R));
+        PetscCall(KSPMatSolveTranspose(ctx->ksps[ctx->cur],R,S));
+        PetscCall(MatConjugate(S));
+      }
+      PetscCall(PetscArraycpy((PetscScalar*)ctx->work2,ctx->work3,eps->nloc*eps->ncv));
+      PetscCall(MatDestroy(&R));
+      PetscCall(MatDestroy(&S));
 #else
+      for (k=0;k<ncv;k++) {
+        PetscCall(VecGetArray(z,&pz));
         for (i=0;i<eps->nloc;i++) pz[i] = ctx->work2[eps->nloc*k+i].real;
-#endif
         PetscCall(VecRestoreArray(z,&pz));
-        if (ijob == 11) PetscCall(STMatSolve(eps->st,z,w));
-        else PetscCall(STMatSolveHermitianTranspose(eps->st,z,w));
+        if (ijob == 11) PetscCall(KSPSolve(ctx->ksps[ctx->cur],z,w));
+        else PetscCall(KSPSolveTranspose(ctx->ksps[ctx->cur],z,w));
         PetscCall(VecGetArray(w,&pz));
-#if defined(PETSC_USE_COMPLEX)
-        for (i=0;i<eps->nloc;i++) {
-          ctx->work2[eps->nloc*k+i].real = PetscRealPart(pz[i]);
-          ctx->work2[eps->nloc*k+i].imag = PetscImaginaryPart(pz[i]);
-        }
-#else
         for (i=0;i<eps->nloc;i++) ctx->work2[eps->nloc*k+i].real = pz[i];
-#endif
         PetscCall(VecRestoreArray(w,&pz));
       }
+#endif
     } else if (ijob == 30 || ijob == 40) {
       /* multiplication A*V or B*V, result in work1 */
       for (k=fpm[23]-1;k<fpm[23]+fpm[24]-1;k++) {
@@ -201,9 +286,16 @@ static PetscErrorCode EPSSolve_FEAST(EPS eps)
 static PetscErrorCode EPSReset_FEAST(EPS eps)
 {
   EPS_FEAST      *ctx = (EPS_FEAST*)eps->data;
+  PetscInt       i;
 
   PetscFunctionBegin;
   PetscCall(PetscFree4(ctx->work1,ctx->work2,ctx->Aq,ctx->Bq));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree(ctx->work3));
+#endif
+  for (i=0;i<ctx->nshifts;i++) PetscCall(KSPDestroy(&ctx->ksps[i]));
+  PetscCall(PetscFree3(ctx->ksps,ctx->sreal,ctx->simag));
+  ctx->nshifts = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
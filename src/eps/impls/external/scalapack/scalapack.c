@@ -22,7 +22,7 @@ static PetscErrorCode EPSSetUp_ScaLAPACK(EPS eps)
 {
   EPS_ScaLAPACK  *ctx = (EPS_ScaLAPACK*)eps->data;
   Mat            A,B;
-  PetscInt       nmat;
+  PetscInt       nmat,M,m;
   PetscBool      isshift;
   PetscScalar    shift;
 
@@ -39,15 +39,22 @@ static PetscErrorCode EPSSetUp_ScaLAPACK(EPS eps)
   EPSCheckIgnored(eps,EPS_FEATURE_EXTRACTION | EPS_FEATURE_CONVERGENCE);
   PetscCall(EPSAllocateSolution(eps,0));
 
-  /* convert matrices */
-  PetscCall(MatDestroy(&ctx->As));
-  PetscCall(MatDestroy(&ctx->Bs));
+  /* convert matrices, reusing the block-cyclic layout (and the BLACS grid it
+     carries) from a previous solve whenever the dimensions have not changed */
   PetscCall(STGetNumMatrices(eps->st,&nmat));
   PetscCall(STGetMatrix(eps->st,0,&A));
-  PetscCall(MatConvert(A,MATSCALAPACK,MAT_INITIAL_MATRIX,&ctx->As));
+  if (ctx->As) {
+    PetscCall(MatGetSize(ctx->As,&M,NULL));
+    PetscCall(MatGetLocalSize(ctx->As,&m,NULL));
+    if (M!=eps->n || m!=eps->nloc || (nmat>1 && !ctx->Bs) || (nmat==1 && ctx->Bs)) {
+      PetscCall(MatDestroy(&ctx->As));
+      PetscCall(MatDestroy(&ctx->Bs));
+    }
+  }
+  PetscCall(MatConvert(A,MATSCALAPACK,ctx->As? MAT_REUSE_MATRIX: MAT_INITIAL_MATRIX,&ctx->As));
   if (nmat>1) {
     PetscCall(STGetMatrix(eps->st,1,&B));
-    PetscCall(MatConvert(B,MATSCALAPACK,MAT_INITIAL_MATRIX,&ctx->Bs));
+    PetscCall(MatConvert(B,MATSCALAPACK,ctx->Bs? MAT_REUSE_MATRIX: MAT_INITIAL_MATRIX,&ctx->Bs));
   }
   PetscCall(STGetShift(eps->st,&shift));
   if (shift != 0.0) {
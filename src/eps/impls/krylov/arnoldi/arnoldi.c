@@ -168,8 +168,11 @@ static PetscErrorCode EPSArnoldiSetDelayed_Arnoldi(EPS eps,PetscBool delayed)
 
    Note:
    Delayed reorthogonalization is an aggressive optimization for the Arnoldi
-   eigensolver than may provide better scalability, but sometimes makes the
-   solver converge less than the default algorithm.
+   eigensolver that reduces the number of global synchronizations per step,
+   providing better scalability at large process counts. Loss of orthogonality
+   is monitored with an inexpensive running estimate, triggering an immediate
+   additional reorthogonalization when necessary, so convergence is normally
+   as good as with the default algorithm.
 
    Level: advanced
 
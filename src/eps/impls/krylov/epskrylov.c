@@ -19,14 +19,18 @@
    EPSDelayedArnoldi - This function is equivalent to BVMatArnoldi but
    performs the computation in a different way. The main idea is that
    reorthogonalization is delayed to the next Arnoldi step. This version is
-   more scalable but in some cases convergence may stagnate.
+   more scalable. The orthogonality of the basis is monitored with the same
+   inexpensive estimate used in the CGS refinement of bvorthog.c, and when
+   loss of orthogonality is detected an additional (non-delayed) refinement
+   of the affected column is carried out, so the recurrence does not stagnate
+   on ill-conditioned problems.
 */
 PetscErrorCode EPSDelayedArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,PetscInt *M,PetscReal *beta,PetscBool *breakdown)
 {
-  PetscInt       i,j,m=*M;
+  PetscInt       i,j,m=*M,nextra=0;
   Vec            u,t;
   PetscScalar    shh[100],*lhh,dot,dot2;
-  PetscReal      norm1=0.0,norm2=1.0;
+  PetscReal      norm1=0.0,norm2=1.0,eta,sum;
   Vec            vj,vj1,vj2=NULL;
 
   PetscFunctionBegin;
@@ -34,6 +38,7 @@ PetscErrorCode EPSDelayedArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,
   else PetscCall(PetscMalloc1(m,&lhh));
   PetscCall(BVCreateVec(eps->V,&u));
   PetscCall(BVCreateVec(eps->V,&t));
+  PetscCall(BVGetOrthogonalization(eps->V,NULL,NULL,&eta,NULL));
 
   PetscCall(BVSetActiveColumns(eps->V,0,m));
   for (j=k;j<m;j++) {
@@ -75,8 +80,20 @@ PetscErrorCode EPSDelayedArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,
     if (j>k) {
       PetscCall(BVSetActiveColumns(eps->V,0,j));
       PetscCall(BVMultVec(eps->V,-1.0,1.0,t,lhh));
-      PetscCall(BVSetActiveColumns(eps->V,0,m));
       for (i=0;i<j;i++) H[ldh*(j-1)+i] += lhh[i];
+      /* running estimate of the orthogonality loss, as in BVOrthogonalizeCGS1:
+         if the delayed correction removed a large fraction of the norm (the
+         criterion ||v'|| < eta ||v|| in squared form) the corrected vector may
+         still not be orthogonal, so refine it again immediately */
+      sum = 0.0;
+      for (i=0;i<j;i++) sum += PetscRealPart(lhh[i]*PetscConj(lhh[i]));
+      if (sum > (1.0-eta*eta)*PetscRealPart(dot)) {
+        PetscCall(BVDotVec(eps->V,t,lhh));
+        PetscCall(BVMultVec(eps->V,-1.0,1.0,t,lhh));
+        for (i=0;i<j;i++) H[ldh*(j-1)+i] += lhh[i];
+        nextra++;
+      }
+      PetscCall(BVSetActiveColumns(eps->V,0,m));
     }
 
     if (j>k+1) {
@@ -90,11 +107,7 @@ PetscErrorCode EPSDelayedArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,
     if (j<m-1) PetscCall(VecCopy(t,u));
   }
 
-  PetscCall(BVNormVec(eps->V,t,NORM_2,&norm2));
-  PetscCall(VecScale(t,1.0/norm2));
-  PetscCall(BVGetColumn(eps->V,m-1,&vj1));
-  PetscCall(VecCopy(t,vj1));
-  PetscCall(BVRestoreColumn(eps->V,m-1,&vj1));
+  PetscCall(BVInsertVecNormalize(eps->V,m-1,t,&norm2));
   H[ldh*(m-2)+m-1] = norm2;
 
   PetscCall(BVDotColumn(eps->V,m,lhh));
@@ -106,6 +119,7 @@ PetscErrorCode EPSDelayedArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,
   PetscCall(BVNormColumn(eps->V,m,NORM_2,beta));
   PetscCall(BVScaleColumn(eps->V,m,1.0 / *beta));
   *breakdown = PETSC_FALSE;
+  if (nextra) PetscCall(PetscInfo(eps,"Performed %" PetscInt_FMT " extra reorthogonalizations due to detected orthogonality loss\n",nextra));
 
   if (m>100) PetscCall(PetscFree(lhh));
   PetscCall(VecDestroy(&u));
@@ -154,6 +168,85 @@ PetscErrorCode EPSDelayedArnoldi1(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSCAArnoldi - Communication-avoiding (s-step) variant of BVMatArnoldi.
+   The basis is extended in blocks of up to bs vectors: first a matrix powers
+   kernel generates the block without any inner products (each vector is just
+   normalized to avoid overflow), then the whole block is orthogonalized at
+   once with BVOrthogonalize. The corresponding columns of the Hessenberg
+   matrix are recovered locally from the triangular factor, so the number of
+   global reductions per basis vector is greatly reduced. The monomial basis
+   becomes ill-conditioned quickly, so bs should be kept small.
+*/
+PetscErrorCode EPSCAArnoldi(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k,PetscInt *M,PetscInt bs,PetscReal *beta,PetscBool *breakdown)
+{
+  PetscInt          i,p,j,jend,m=*M,ldr;
+  Mat               R;
+  PetscScalar       *sigma,rpp;
+  const PetscScalar *r;
+  PetscReal         norm;
+  Vec               vp,vp1;
+
+  PetscFunctionBegin;
+  *breakdown = PETSC_FALSE;
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,m+1,m+1,NULL,&R));
+  PetscCall(PetscMalloc1(bs+1,&sigma));
+  for (j=k;j<m;j+=bs) {
+    jend = PetscMin(j+bs,m);
+    /* matrix powers kernel: columns j+1..jend, normalization only */
+    for (i=j;i<jend;i++) {
+      PetscCall(BVGetColumn(eps->V,i,&vp));
+      PetscCall(BVGetColumn(eps->V,i+1,&vp1));
+      PetscCall(STApply(eps->st,vp,vp1));
+      PetscCall(BVRestoreColumn(eps->V,i,&vp));
+      PetscCall(BVRestoreColumn(eps->V,i+1,&vp1));
+      PetscCall(BVNormColumn(eps->V,i+1,NORM_2,&norm));
+      if (norm==0.0) {
+        *breakdown = PETSC_TRUE;
+        *M = i;
+        *beta = 0.0;
+        PetscCall(PetscFree(sigma));
+        PetscCall(MatDestroy(&R));
+        PetscFunctionReturn(PETSC_SUCCESS);
+      }
+      PetscCall(BVScaleColumn(eps->V,i+1,1.0/norm));
+      sigma[i-j+1] = norm;
+    }
+    /* block orthogonalization against the leading columns */
+    PetscCall(BVSetActiveColumns(eps->V,j+1,jend+1));
+    PetscCall(BVOrthogonalize(eps->V,R));
+    /* recover the Hessenberg columns from the triangular factor */
+    PetscCall(MatDenseGetLDA(R,&ldr));
+    PetscCall(MatDenseGetArrayRead(R,&r));
+    for (p=j;p<jend;p++) {
+      rpp = (p==j)? 1.0: r[ldr*p+p];
+      if (PetscAbsScalar(rpp)<PETSC_MACHINE_EPSILON) {  /* linearly dependent column detected */
+        PetscCall(MatDenseRestoreArrayRead(R,&r));
+        *breakdown = PETSC_TRUE;
+        *M = p;
+        *beta = (p>k)? PetscAbsScalar(H[ldh*(p-1)+p]): 0.0;
+        PetscCall(PetscFree(sigma));
+        PetscCall(MatDestroy(&R));
+        PetscFunctionReturn(PETSC_SUCCESS);
+      }
+      for (i=0;i<=p+1;i++) H[ldh*p+i] = sigma[p-j+1]*r[ldr*(p+1)+i];
+      if (p>j) for (i=0;i<p;i++) {
+        if (r[ldr*p+i]!=0.0) {
+          /* columns before the initial one may have entries down to the arrow row k */
+          PetscInt ii,top=PetscMin((i<k)?k+1:i+2,p+2);
+          for (ii=0;ii<top;ii++) H[ldh*p+ii] -= r[ldr*p+i]*H[ldh*i+ii];
+        }
+      }
+      for (i=0;i<=p+1;i++) H[ldh*p+i] /= rpp;
+    }
+    PetscCall(MatDenseRestoreArrayRead(R,&r));
+  }
+  *beta = PetscAbsScalar(H[ldh*(m-1)+m]);
+  PetscCall(PetscFree(sigma));
+  PetscCall(MatDestroy(&R));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSKrylovConvergence_Filter - Specialized version for STFILTER.
 */
@@ -210,7 +303,8 @@ PetscErrorCode EPSKrylovConvergence(EPS eps,PetscBool getall,PetscInt kini,Petsc
   PetscScalar    re,im,*Zr,*Zi,*X;
   PetscReal      resnorm,gamma,lerrest;
   PetscBool      isshift,isfilter,refined,istrivial;
-  Vec            x=NULL,y=NULL,w[3];
+  Vec            x=NULL,y=NULL,t,w[3],*z=NULL;
+  const PetscInt nz = PetscDefined(USE_COMPLEX)? 4: 5;
 
   PetscFunctionBegin;
   if (PetscUnlikely(eps->which == EPS_ALL)) {
@@ -223,12 +317,20 @@ PetscErrorCode EPSKrylovConvergence(EPS eps,PetscBool getall,PetscInt kini,Petsc
   }
   PetscCall(RGIsTrivial(eps->rg,&istrivial));
   if (PetscUnlikely(eps->trueres)) {
-    PetscCall(BVCreateVec(eps->V,&x));
-    PetscCall(BVCreateVec(eps->V,&y));
-    PetscCall(BVCreateVec(eps->V,&w[0]));
-    PetscCall(BVCreateVec(eps->V,&w[2]));
+    /* the temporaries are drawn from a pool kept in the EPS, so repeated
+       convergence checks do not allocate vectors */
+    if (!eps->pool) {
+      PetscCall(BVCreateVec(eps->V,&t));
+      PetscCall(SlepcVecPoolCreate(t,nz,&eps->pool));
+      PetscCall(VecDestroy(&t));
+    }
+    PetscCall(SlepcVecPoolGetVecs(eps->pool,nz,&z));
+    x    = z[0];
+    y    = z[1];
+    w[0] = z[2];
+    w[2] = z[3];
 #if !defined(PETSC_USE_COMPLEX)
-    PetscCall(BVCreateVec(eps->V,&w[1]));
+    w[1] = z[4];
 #else
     w[1] = NULL;
 #endif
@@ -253,14 +355,25 @@ PetscErrorCode EPSKrylovConvergence(EPS eps,PetscBool getall,PetscInt kini,Petsc
     }
     newk = k;
     PetscCall(DSVectors(eps->ds,DS_MAT_X,&newk,&resnorm));
-    if (PetscUnlikely(eps->trueres)) {
-      PetscCall(DSGetArray(eps->ds,DS_MAT_X,&X));
-      Zr = X+k*ld;
-      if (newk==k+1) Zi = X+newk*ld;
-      else Zi = NULL;
-      PetscCall(EPSComputeRitzVector(eps,Zr,Zi,eps->V,x,y));
-      PetscCall(DSRestoreArray(eps->ds,DS_MAT_X,&X));
-      PetscCall(EPSComputeResidualNorm_Private(eps,PETSC_FALSE,re,im,x,y,w,&resnorm));
+    /* once the first unconverged pair has been found, the remaining candidates
+       cannot be locked in this restart, so their error estimates are only used
+       for monitoring purposes; avoid the collective operations of the explicit
+       residual for them and report the cheap estimate instead */
+    if (PetscUnlikely(eps->trueres) && marker==-1) {
+      /* two-stage test: the free estimate from the factorization filters out
+         candidates that are still far from convergence, and only survivors
+         get the explicit residual that involves matrix-vector products */
+      if (!refined) resnorm *= beta*corrf;
+      PetscCall((*eps->converged)(eps,re,im,resnorm,&lerrest,eps->convergedctx));
+      if (lerrest < 10*eps->tol) {
+        PetscCall(DSGetArray(eps->ds,DS_MAT_X,&X));
+        Zr = X+k*ld;
+        if (newk==k+1) Zi = X+newk*ld;
+        else Zi = NULL;
+        PetscCall(EPSComputeRitzVector(eps,Zr,Zi,eps->V,x,y));
+        PetscCall(DSRestoreArray(eps->ds,DS_MAT_X,&X));
+        PetscCall(EPSComputeResidualNorm_Private(eps,PETSC_FALSE,re,im,x,y,w,&resnorm));
+      }
     }
     else if (!refined) resnorm *= beta*corrf;
     /* error estimate */
@@ -282,32 +395,75 @@ PetscErrorCode EPSKrylovConvergence(EPS eps,PetscBool getall,PetscInt kini,Petsc
   }
   if (marker!=-1) k = marker;
   *kout = k;
-  if (PetscUnlikely(eps->trueres)) {
-    PetscCall(VecDestroy(&x));
-    PetscCall(VecDestroy(&y));
-    PetscCall(VecDestroy(&w[0]));
-    PetscCall(VecDestroy(&w[2]));
-#if !defined(PETSC_USE_COMPLEX)
-    PetscCall(VecDestroy(&w[1]));
-#endif
-  }
+  if (PetscUnlikely(eps->trueres)) PetscCall(SlepcVecPoolRestoreVecs(eps->pool,nz,&z));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSUpdateOmegaGHIEP - Recurrence for the estimates mu[i] of the loss of
+   B-orthogonality (v_{j+1},v_i)_B in the pseudo-Lanczos iteration. It is
+   analogous to the omega-recurrence used for partial reorthogonalization in
+   the definite case (see update_omega() in the LANCZOS solver), except that
+   the entries sig[] of the signature matrix enter the coefficients of the
+   three-term recurrence.
+*/
+static void EPSUpdateOmegaGHIEP(PetscReal *mu,PetscReal *mu_old,PetscInt j,PetscInt k,PetscReal *alpha,PetscReal *beta,PetscReal *sig,PetscReal eps1,PetscReal anorm)
+{
+  PetscInt  i;
+  PetscReal T,binv,h;
+
+  PetscFunctionBegin;
+  /* Estimate of the contribution of roundoff errors in OP*v */
+  T = eps1*anorm;
+  binv = 1.0/beta[j];
+
+  for (i=k;i<j-1;i++) {
+    h = beta[i]*mu[i+1] + (alpha[i]-alpha[j])*mu[i] - beta[j-1]*sig[j-1]*sig[j]*mu_old[i];
+    if (i>0) h += beta[i-1]*sig[i-1]*sig[i]*mu[i-1];
+    if (h > 0) mu_old[i] = binv*(h + T);
+    else mu_old[i] = binv*(h - T);
+  }
+  mu_old[j-1] = binv*T;
+
+  /* Swap mu and mu_old */
+  for (i=k;i<j;i++) {
+    h = mu[i];
+    mu[i] = mu_old[i];
+    mu_old[i] = h;
+  }
+  mu[j] = eps1;
+  PetscFunctionReturnVoid();
+}
+
 PetscErrorCode EPSPseudoLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscReal *omega,PetscInt k,PetscInt *M,PetscBool *breakdown,PetscBool *symmlost,PetscReal *cos,Vec w)
 {
   PetscInt       j,m = *M,i,ld,l;
   Vec            vj,vj1;
   PetscScalar    *hwork,lhwork[100];
   PetscReal      norm,norm1,norm2,t,sym=0.0,fro=0.0;
+  PetscReal      *mu,*mu_old,lmu[100],lmu_old[100],eps1,delta,anorm=1.0;
+  PetscBool      *which,lwhich[100],*which2,lwhich2[100];
+  PetscBool      reorth,force_reorth=PETSC_FALSE,fullreorth=PETSC_FALSE;
   PetscBLASInt   j_,one=1;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
   PetscCall(DSGetDimensions(eps->ds,NULL,&l,NULL,NULL));
   if (cos) *cos = 1.0;
-  if (m > 100) PetscCall(PetscMalloc1(m,&hwork));
-  else hwork = lhwork;
+  if (m > 100) PetscCall(PetscMalloc5(m,&hwork,m,&mu,m,&mu_old,m,&which,m,&which2));
+  else {
+    hwork   = lhwork;
+    mu      = lmu;
+    mu_old  = lmu_old;
+    which   = lwhich;
+    which2  = lwhich2;
+  }
+
+  eps1  = PetscSqrtReal((PetscReal)eps->n)*PETSC_MACHINE_EPSILON/2;
+  delta = PETSC_SQRT_MACHINE_EPSILON/PetscSqrtReal((PetscReal)eps->ncv);
+  for (i=0;i<m;i++) mu[i] = mu_old[i] = 0.0;
+  for (i=0;i<k;i++) which[i] = PETSC_TRUE;
+  for (i=k;i<m;i++) which[i] = PETSC_FALSE;
 
   PetscCall(BVSetActiveColumns(eps->V,0,m));
   for (j=k;j<m;j++) {
@@ -316,9 +472,19 @@ PetscErrorCode EPSPseudoLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscRe
     PetscCall(STApply(eps->st,vj,vj1));
     PetscCall(BVRestoreColumn(eps->V,j,&vj));
     PetscCall(BVRestoreColumn(eps->V,j+1,&vj1));
-    PetscCall(BVOrthogonalizeColumn(eps->V,j+1,hwork,&norm,breakdown));
+    if (fullreorth) {
+      /* pseudo-Lanczos step with full reorthogonalization */
+      PetscCall(BVOrthogonalizeColumn(eps->V,j+1,hwork,&norm,breakdown));
+    } else {
+      /* pseudo-Lanczos step, orthogonalizing against the locked and restart
+         vectors and the two previous Lanczos vectors only */
+      which[j] = PETSC_TRUE;
+      if (j-2>=k) which[j-2] = PETSC_FALSE;
+      PetscCall(BVOrthogonalizeSomeColumn(eps->V,j+1,which,hwork,&norm,breakdown));
+    }
     alpha[j] = PetscRealPart(hwork[j]);
     beta[j] = PetscAbsReal(norm);
+    anorm = PetscMax(anorm,PetscAbsReal(alpha[j])+beta[j]+((j>0)?beta[j-1]:0.0));
     if (j==k) {
       PetscReal *f;
 
@@ -335,6 +501,30 @@ PetscErrorCode EPSPseudoLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscRe
     fro = SlepcAbs(fro,SlepcAbs(alpha[j],beta[j]));
     if (j>0) fro = SlepcAbs(fro,beta[j-1]);
     if (sym/fro>PetscMax(PETSC_SQRT_MACHINE_EPSILON,10*eps->tol)) { *symmlost = PETSC_TRUE; *M=j+1; break; }
+    if (!fullreorth) {
+      /* Update the estimates of the loss of B-orthogonality and check if
+         reorthogonalization is needed */
+      reorth = PETSC_FALSE;
+      if (j>k) {
+        EPSUpdateOmegaGHIEP(mu,mu_old,j,k,alpha,beta,omega,eps1,anorm);
+        for (i=k;i<j-1;i++) {
+          if (PetscAbsReal(mu[i]) > delta) { reorth = PETSC_TRUE; break; }
+        }
+      }
+      if (reorth || force_reorth) {
+        for (i=0;i<k;i++) which2[i] = PETSC_FALSE;
+        for (i=k;i<=j;i++) which2[i] = PETSC_TRUE;
+        if (force_reorth) force_reorth = PETSC_FALSE;
+        else force_reorth = PETSC_TRUE;
+        for (i=k;i<j;i++) mu[i] = eps1;
+        PetscCall(BVOrthogonalizeSomeColumn(eps->V,j+1,which2,hwork,&norm,breakdown));
+        beta[j] = PetscAbsReal(norm);
+      }
+      if (beta[j]*delta < anorm*eps1) {
+        fullreorth = PETSC_TRUE;
+        PetscCall(PetscInfo(eps,"Switching to full reorthogonalization at iteration %" PetscInt_FMT "\n",eps->its));
+      }
+    }
     omega[j+1] = (norm<0.0)? -1.0: 1.0;
     PetscCall(BVScaleColumn(eps->V,j+1,1.0/norm));
     /* */
@@ -348,6 +538,6 @@ PetscErrorCode EPSPseudoLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscRe
       if (*cos>t) *cos = t;
     }
   }
-  if (m > 100) PetscCall(PetscFree(hwork));
+  if (m > 100) PetscCall(PetscFree5(hwork,mu,mu_old,which,which2));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -94,7 +94,6 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
 {
   PetscReal         eta;
   PetscBool         isfilt=PETSC_FALSE;
-  BVOrthogType      otype;
   BVOrthogBlockType obtype;
   EPS_KRYLOVSCHUR   *ctx = (EPS_KRYLOVSCHUR*)eps->data;
   enum { EPS_KS_DEFAULT,EPS_KS_SYMM,EPS_KS_SLICE,EPS_KS_FILTER,EPS_KS_INDEF,EPS_KS_TWOSIDED } variant;
@@ -111,6 +110,8 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
     if (!eps->which) PetscCall(EPSSetWhichEigenpairs_Default(eps));
   }
   PetscCheck(ctx->lock || eps->mpd>=eps->ncv,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Should not use mpd parameter in non-locking variant");
+  PetscCheck(!ctx->pipelined || ctx->bs<=1,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The pipelined variant cannot be combined with s-step basis generation");
+  PetscCheck(!ctx->dynamic || ctx->lock,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Dynamic sizing of the working basis requires the locking variant");
 
   EPSCheckDefiniteCondition(eps,eps->arbitrary," with arbitrary selection of eigenpairs");
 
@@ -174,9 +175,9 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
       PetscCall(DSSetCompact(eps->ds,PETSC_TRUE));
       PetscCall(DSSetExtraRow(eps->ds,PETSC_TRUE));
       PetscCall(DSAllocate(eps->ds,eps->ncv+1));
-      /* force reorthogonalization for pseudo-Lanczos */
-      PetscCall(BVGetOrthogonalization(eps->V,&otype,NULL,&eta,&obtype));
-      PetscCall(BVSetOrthogonalization(eps->V,otype,BV_ORTHOG_REFINE_ALWAYS,eta,obtype));
+      /* pseudo-Lanczos reorthogonalizes selectively, which requires MGS */
+      PetscCall(BVGetOrthogonalization(eps->V,NULL,NULL,&eta,&obtype));
+      PetscCall(BVSetOrthogonalization(eps->V,BV_ORTHOG_MGS,BV_ORTHOG_REFINE_ALWAYS,eta,obtype));
       break;
     case EPS_KS_TWOSIDED:
       eps->ops->solve = EPSSolve_KrylovSchur_TwoSided;
@@ -221,26 +222,118 @@ static PetscErrorCode EPSSetUpSort_KrylovSchur(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
+/*
+   EPSKrylovSchurFreeCheckpoint - Release the data loaded by EPSKrylovSchurRestore.
+*/
+static PetscErrorCode EPSKrylovSchurFreeCheckpoint(EPS eps)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt        i;
+
+  PetscFunctionBegin;
+  if (ctx->nckpt>=0) {
+    for (i=0;i<=ctx->nckpt;i++) PetscCall(VecDestroy(&ctx->Vckpt[i]));
+    PetscCall(PetscFree(ctx->Vckpt));
+    PetscCall(PetscFree(ctx->eigrckpt));
+    PetscCall(PetscFree(ctx->eigickpt));
+    ctx->nckpt = -1;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSKrylovSchurLoadCheckpoint - Inject the state loaded by EPSKrylovSchurRestore
+   at the beginning of the solve: copy the locked columns and the start vector
+   into the basis, recover the eigenvalues and counters, and rebuild the locked
+   block of the projected matrix. For Hermitian problems the locked block is
+   diagonal with the converged Ritz values; otherwise it is recomputed by
+   projecting the operator onto the restored columns.
+*/
+static PetscErrorCode EPSKrylovSchurLoadCheckpoint(EPS eps,PetscBool hermitian)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
-  PetscInt        j,*pj,k,l,nv,ld,nconv;
-  Mat             U,Op,H,T;
-  PetscScalar     *g;
-  PetscReal       beta,gamma=1.0;
-  PetscBool       breakdown,harmonic,hermitian;
+  PetscInt        i,j,ld,k=ctx->nckpt;
+  PetscScalar     *Ha,*coef;
+  PetscReal       *T;
+  Vec             v,w;
+
+  PetscFunctionBegin;
+  PetscCheck(k<eps->ncv,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_SIZ,"The checkpoint contains %" PetscInt_FMT " converged pairs, which requires ncv larger than the current value %" PetscInt_FMT,k,eps->ncv);
+  for (i=0;i<=k;i++) {
+    PetscCall(BVGetColumn(eps->V,i,&v));
+    PetscCall(VecCopy(ctx->Vckpt[i],v));
+    PetscCall(BVRestoreColumn(eps->V,i,&v));
+  }
+  for (i=0;i<k;i++) {
+    eps->eigr[i]   = ctx->eigrckpt[i];
+    eps->eigi[i]   = ctx->eigickpt[i];
+    eps->errest[i] = 0.0;
+  }
+  eps->nconv = k;
+  eps->its   = ctx->itsckpt;
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  if (hermitian) {
+    PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&T));
+    for (i=0;i<k;i++) {
+      T[i]    = PetscRealPart(eps->eigr[i]);
+      T[ld+i] = 0.0;
+    }
+    PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&T));
+  } else {
+    /* rebuild the locked block (including the arrow row) by projection */
+    PetscCall(BVCreateVec(eps->V,&w));
+    PetscCall(PetscMalloc1(k+1,&coef));
+    PetscCall(BVSetActiveColumns(eps->V,0,k+1));
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&Ha));
+    for (j=0;j<k;j++) {
+      PetscCall(BVGetColumn(eps->V,j,&v));
+      PetscCall(STApply(eps->st,v,w));
+      PetscCall(BVRestoreColumn(eps->V,j,&v));
+      PetscCall(BVDotVec(eps->V,w,coef));
+      for (i=0;i<=k;i++) Ha[ld*j+i] = coef[i];
+    }
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&Ha));
+    PetscCall(PetscFree(coef));
+    PetscCall(VecDestroy(&w));
+  }
+  /* clean up the start vector in case of roundoff contamination */
+  PetscCall(BVOrthonormalizeColumn(eps->V,k,PETSC_FALSE,NULL,NULL));
+  PetscCall(PetscInfo(eps,"Resuming from checkpoint with %" PetscInt_FMT " converged pairs at iteration %" PetscInt_FMT "\n",k,eps->its));
+  PetscCall(EPSKrylovSchurFreeCheckpoint(eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
+{
+  EPS_KRYLOVSCHUR    *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt           j,*pj,k,l,nv,ld,nconv,kprev,trend=0;
+  Mat                U,Op,H,T;
+  PetscScalar        *g,*Harray;
+  PetscReal          beta,gamma=1.0,errprev=0.0,rate;
+  PetscBool          breakdown,harmonic,hermitian,shrink=PETSC_FALSE,userstop;
+  BVOrthogRefineType orthog_ref;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
   harmonic = (eps->extraction==EPS_HARMONIC || eps->extraction==EPS_REFINED_HARMONIC)?PETSC_TRUE:PETSC_FALSE;
   hermitian = (eps->ishermitian && !harmonic)?PETSC_TRUE:PETSC_FALSE;
+  PetscCall(BVGetOrthogonalization(eps->V,NULL,&orthog_ref,NULL,NULL));
   if (harmonic) PetscCall(PetscMalloc1(ld,&g));
   if (eps->arbitrary) pj = &j;
   else pj = NULL;
 
-  /* Get the starting Arnoldi vector */
-  PetscCall(EPSGetStartVector(eps,0,NULL));
+  /* Get the starting Arnoldi vector, or resume from a restored checkpoint */
+  if (ctx->nckpt>=0) PetscCall(EPSKrylovSchurLoadCheckpoint(eps,hermitian));
+  else PetscCall(EPSGetStartVector(eps,0,NULL));
   l = 0;
+  kprev = eps->nconv;
+
+  /* Start with a reduced working basis, to be grown on demand */
+  if (ctx->dynamic) {
+    ctx->wsize = PetscMin(eps->ncv,PetscMax(eps->nconv+2,PetscMax(eps->nev+2,(eps->ncv+2)/4)));
+    PetscCall(BVResize(eps->V,ctx->wsize+1,PETSC_TRUE));
+    PetscCall(PetscInfo(eps,"Starting with a working basis of %" PetscInt_FMT " vectors\n",ctx->wsize));
+  } else ctx->wsize = eps->ncv;
 
   /* Restart loop */
   while (eps->reason == EPS_CONVERGED_ITERATING) {
@@ -248,18 +341,38 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
 
     /* Compute an nv-step Arnoldi factorization */
     nv = PetscMin(eps->nconv+eps->mpd,eps->ncv);
+    if (ctx->dynamic) {
+      if (ctx->wsize < eps->nconv+l+2) {  /* make sure there is room to expand the factorization */
+        ctx->wsize = PetscMin(eps->ncv,eps->nconv+l+2);
+        PetscCall(BVResize(eps->V,ctx->wsize+1,PETSC_TRUE));
+      }
+      nv = PetscMin(nv,ctx->wsize);
+    }
     PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,eps->nconv+l));
-    PetscCall(STGetOperator(eps->st,&Op));
-    if (hermitian) {
-      PetscCall(DSGetMat(eps->ds,DS_MAT_T,&T));
-      PetscCall(BVMatLanczos(eps->V,Op,T,eps->nconv+l,&nv,&beta,&breakdown));
-      PetscCall(DSRestoreMat(eps->ds,DS_MAT_T,&T));
+    if (ctx->pipelined && !hermitian) {
+      /* delayed normalization overlaps the reductions with the next operator application */
+      PetscCall(DSGetArray(eps->ds,DS_MAT_A,&Harray));
+      if (orthog_ref == BV_ORTHOG_REFINE_NEVER) PetscCall(EPSDelayedArnoldi1(eps,Harray,ld,eps->nconv+l,&nv,&beta,&breakdown));
+      else PetscCall(EPSDelayedArnoldi(eps,Harray,ld,eps->nconv+l,&nv,&beta,&breakdown));
+      PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&Harray));
+    } else if (ctx->bs>1 && !hermitian) {
+      /* s-step basis generation with a matrix powers kernel and block orthogonalization */
+      PetscCall(DSGetArray(eps->ds,DS_MAT_A,&Harray));
+      PetscCall(EPSCAArnoldi(eps,Harray,ld,eps->nconv+l,&nv,ctx->bs,&beta,&breakdown));
+      PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&Harray));
     } else {
-      PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
-      PetscCall(BVMatArnoldi(eps->V,Op,H,eps->nconv+l,&nv,&beta,&breakdown));
-      PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+      PetscCall(STGetOperator(eps->st,&Op));
+      if (hermitian) {
+        PetscCall(DSGetMat(eps->ds,DS_MAT_T,&T));
+        PetscCall(BVMatLanczos(eps->V,Op,T,eps->nconv+l,&nv,&beta,&breakdown));
+        PetscCall(DSRestoreMat(eps->ds,DS_MAT_T,&T));
+      } else {
+        PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
+        PetscCall(BVMatArnoldi(eps->V,Op,H,eps->nconv+l,&nv,&beta,&breakdown));
+        PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+      }
+      PetscCall(STRestoreOperator(eps->st,&Op));
     }
-    PetscCall(STRestoreOperator(eps->st,&Op));
     PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,eps->nconv+l));
     PetscCall(DSSetState(eps->ds,l?DS_STATE_RAW:DS_STATE_INTERMEDIATE));
     PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
@@ -282,6 +395,36 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,k,eps->nev,&eps->reason,eps->stoppingctx));
     nconv = k;
 
+    /* Adapt the restart parameter and the working basis size from the observed convergence rate */
+    if ((ctx->adaptrestart || ctx->dynamic) && eps->reason == EPS_CONVERGED_ITERATING) {
+      rate = (k==kprev && errprev>0.0 && k<nv)? eps->errest[k]/errprev: 0.0;
+      if (k==kprev && rate>0.9) trend = (trend<0)? 1: trend+1;  /* little progress on the first wanted pair */
+      else if (k>kprev || (rate>0.0 && rate<0.3)) trend = (trend>0)? -1: trend-1;  /* converging quickly */
+      else trend = 0;  /* inconclusive, do not accumulate evidence */
+      if (trend>=2) {
+        if (ctx->adaptrestart) {
+          ctx->keep = PetscMin((PetscReal)0.9,ctx->keep+(PetscReal)0.05);
+          PetscCall(PetscInfo(eps,"Slow convergence detected, increasing restart parameter to %g\n",(double)ctx->keep));
+        }
+        if (ctx->dynamic && ctx->wsize<eps->ncv) {
+          /* the model predicts benefit from a larger search space: grow halfway towards the allocated maximum */
+          ctx->wsize = PetscMin(eps->ncv,ctx->wsize+PetscMax(1,(eps->ncv-ctx->wsize+1)/2));
+          PetscCall(BVResize(eps->V,ctx->wsize+1,PETSC_TRUE));
+          PetscCall(PetscInfo(eps,"Slow convergence detected, growing working basis to %" PetscInt_FMT " vectors\n",ctx->wsize));
+        }
+        trend = 0;
+      } else if (trend<=-2) {
+        if (ctx->adaptrestart) {
+          ctx->keep = PetscMax((PetscReal)0.1,ctx->keep-(PetscReal)0.05);
+          PetscCall(PetscInfo(eps,"Fast convergence detected, decreasing restart parameter to %g\n",(double)ctx->keep));
+        }
+        if (ctx->dynamic) shrink = PETSC_TRUE;  /* the basis can only be shrunk after the restart update */
+        trend = 0;
+      }
+      kprev = k;
+      errprev = (k<nv)? eps->errest[k]: 0.0;
+    }
+
     /* Update l */
     if (eps->reason != EPS_CONVERGED_ITERATING || breakdown || k==nv) l = 0;
     else {
@@ -318,13 +461,36 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
         PetscCall(DSTruncate(eps->ds,k+l,PETSC_FALSE));
       }
     }
-    /* Update the corresponding vectors V(:,idx) = V*Q(:,idx) */
+    /* Update the corresponding vectors V(:,idx) = V*Q(:,idx)
+       Note: the host DSSolve and this device update cannot be pipelined across
+       restarts, since the next projected problem is formed only after this
+       update and the subsequent expansion of the factorization; on GPU the
+       update is launched asynchronously, so the remaining host-side work of
+       this iteration (truncation bookkeeping, monitors, viewers) already
+       overlaps with it */
     PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&U));
     PetscCall(BVMultInPlace(eps->V,U,eps->nconv,k+l));
     PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&U));
 
     if (eps->reason == EPS_CONVERGED_ITERATING && !breakdown) PetscCall(BVCopyColumn(eps->V,nv,k+l));
+    if (PetscUnlikely(shrink)) {
+      /* The active window has narrowed: return part of the working basis */
+      j = PetscMax(k+l+2,ctx->wsize-PetscMax(1,(ctx->wsize-k-l)/4));
+      if (j<ctx->wsize) {
+        ctx->wsize = j;
+        PetscCall(BVResize(eps->V,ctx->wsize+1,PETSC_TRUE));
+        PetscCall(PetscInfo(eps,"Fast convergence detected, shrinking working basis to %" PetscInt_FMT " vectors\n",ctx->wsize));
+      }
+      shrink = PETSC_FALSE;
+    }
+    if (PetscUnlikely(eps->convergedhandler && k>eps->nconv)) {
+      /* notify the user of the newly locked pairs, which are now final */
+      userstop = PETSC_FALSE;
+      PetscCall((*eps->convergedhandler)(eps,eps->nconv,k-eps->nconv,&userstop,eps->convergedhandlerctx));
+      if (userstop && eps->reason==EPS_CONVERGED_ITERATING) eps->reason = EPS_CONVERGED_USER;
+    }
     eps->nconv = k;
+    if (PetscUnlikely(eps->vstream)) PetscCall(EPSVectorsViewStream(eps));
     PetscCall(EPSMonitor(eps,eps->its,nconv,eps->eigr,eps->eigi,eps->errest,nv));
   }
 
@@ -410,6 +576,174 @@ PetscErrorCode EPSKrylovSchurGetRestart(EPS eps,PetscReal *keep)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurSetAdaptiveRestart_KrylovSchur(EPS eps,PetscBool adapt)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  ctx->adaptrestart = adapt;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetAdaptiveRestart - Activate the adaptive variant of the
+   Krylov-Schur method, where the restart parameter is adjusted during the
+   solve according to the observed convergence rate.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  adapt - true if the restart parameter must be adjusted adaptively
+
+   Options Database Key:
+.  -eps_krylovschur_adaptive_restart - Sets the adaptive restart flag
+
+   Notes:
+   By default, the proportion of basis vectors kept at restart is fixed
+   throughout the solve, see EPSKrylovSchurSetRestart(). With the adaptive
+   variant, this proportion is increased when the error estimate of the
+   first wanted eigenpair stalls across restarts, and decreased when
+   eigenpairs are converging quickly, always within the range [0.1,0.9].
+   The adjustment requires evidence from two consecutive restarts, so that
+   a single irregular restart does not cause oscillations.
+
+   The value set with EPSKrylovSchurSetRestart() is used as the initial
+   value of the restart parameter.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetAdaptiveRestart(), EPSKrylovSchurSetRestart()
+@*/
+PetscErrorCode EPSKrylovSchurSetAdaptiveRestart(EPS eps,PetscBool adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,adapt,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetAdaptiveRestart_C",(EPS,PetscBool),(eps,adapt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetAdaptiveRestart_KrylovSchur(EPS eps,PetscBool *adapt)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *adapt = ctx->adaptrestart;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetAdaptiveRestart - Gets the flag indicating whether the
+   restart parameter is adjusted adaptively during the solve.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  adapt - the adaptive restart flag
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetAdaptiveRestart()
+@*/
+PetscErrorCode EPSKrylovSchurGetAdaptiveRestart(EPS eps,PetscBool *adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(adapt,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetAdaptiveRestart_C",(EPS,PetscBool*),(eps,adapt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurSetDynamicBasis_KrylovSchur(EPS eps,PetscBool dynamic)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (ctx->dynamic != dynamic) {
+    ctx->dynamic = dynamic;
+    eps->state   = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetDynamicBasis - Activate dynamic sizing of the working basis
+   in the Krylov-Schur method.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigenproblem solver context
+-  dynamic - true if the number of working basis vectors must be adjusted during the solve
+
+   Options Database Key:
+.  -eps_krylovschur_dynamic_basis - Sets the dynamic basis flag
+
+   Notes:
+   By default, the solver builds subspaces with as many vectors as indicated
+   with EPSSetDimensions(). With dynamic sizing, the solve starts with a
+   smaller working basis and grows it (up to ncv) only when the error
+   estimate of the first wanted eigenpair stalls across restarts, indicating
+   that a larger search space would be beneficial. When eigenpairs converge
+   quickly, part of the working basis is returned, so the maximum dimension
+   of the projected problem shrinks together with the window of active
+   vectors. This reduces both the memory footprint and the orthogonalization
+   cost whenever the wanted eigenvalues converge with a basis smaller than
+   the allocated maximum.
+
+   This option requires the locking variant, see EPSKrylovSchurSetLocking().
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetDynamicBasis(), EPSKrylovSchurSetAdaptiveRestart(), EPSSetDimensions()
+@*/
+PetscErrorCode EPSKrylovSchurSetDynamicBasis(EPS eps,PetscBool dynamic)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,dynamic,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetDynamicBasis_C",(EPS,PetscBool),(eps,dynamic));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetDynamicBasis_KrylovSchur(EPS eps,PetscBool *dynamic)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *dynamic = ctx->dynamic;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetDynamicBasis - Gets the flag indicating whether the
+   working basis is sized dynamically during the solve.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  dynamic - the dynamic basis flag
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetDynamicBasis()
+@*/
+PetscErrorCode EPSKrylovSchurGetDynamicBasis(EPS eps,PetscBool *dynamic)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(dynamic,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetDynamicBasis_C",(EPS,PetscBool*),(eps,dynamic));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetLocking_KrylovSchur(EPS eps,PetscBool lock)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -438,6 +772,15 @@ static PetscErrorCode EPSKrylovSchurSetLocking_KrylovSchur(EPS eps,PetscBool loc
    working subspace even if already converged to working accuracy (the
    non-locking variant).
 
+   In the locking variant, every new basis vector must still be explicitly
+   orthogonalized against all locked columns, so the cost of each
+   orthogonalization grows linearly with the number of converged pairs.
+   When computing many eigenpairs (nev in the thousands) this deflation
+   cost may eventually dominate the cost of the matrix-vector products;
+   in that case consider limiting the dimension of the projected problem
+   with the mpd parameter, see EPSSetDimensions(), or splitting the
+   computation by intervals with spectrum slicing.
+
    Level: advanced
 
 .seealso: EPSKrylovSchurGetLocking()
@@ -485,6 +828,175 @@ PetscErrorCode EPSKrylovSchurGetLocking(EPS eps,PetscBool *lock)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurSetPipelined_KrylovSchur(EPS eps,PetscBool pipelined)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  ctx->pipelined = pipelined;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetPipelined - Activates or deactivates the pipelined variant
+   of the Krylov-Schur method.
+
+   Logically Collective
+
+   Input Parameters:
++  eps       - the eigenproblem solver context
+-  pipelined - boolean flag
+
+   Options Database Key:
+.  -eps_krylovschur_pipelined - Sets the pipelined flag
+
+   Notes:
+   In the pipelined variant, the normalization of each Arnoldi vector is
+   delayed to the next iteration, so that the global reductions required
+   for the orthogonalization can be overlapped with the application of the
+   operator. This reduces the synchronization cost per iteration, which is
+   beneficial when running on many processes, but convergence may stagnate
+   in difficult problems.
+
+   This variant is currently available only for non-Hermitian problems (or
+   when harmonic extraction is used); otherwise the flag is ignored and the
+   standard Lanczos recurrence is employed.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetPipelined(), EPSArnoldiSetDelayed()
+@*/
+PetscErrorCode EPSKrylovSchurSetPipelined(EPS eps,PetscBool pipelined)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,pipelined,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetPipelined_C",(EPS,PetscBool),(eps,pipelined));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetPipelined_KrylovSchur(EPS eps,PetscBool *pipelined)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *pipelined = ctx->pipelined;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetPipelined - Gets the pipelined flag used in the Krylov-Schur
+   method.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  pipelined - the pipelined flag
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetPipelined()
+@*/
+PetscErrorCode EPSKrylovSchurGetPipelined(EPS eps,PetscBool *pipelined)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(pipelined,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetPipelined_C",(EPS,PetscBool*),(eps,pipelined));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurSetBlockSize_KrylovSchur(EPS eps,PetscInt bs)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (bs==PETSC_DEFAULT || bs==PETSC_DECIDE) ctx->bs = 1;
+  else {
+    PetscCheck(bs>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of bs. Must be > 0");
+    ctx->bs = bs;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetBlockSize - Sets the block size used when generating the
+   Krylov basis in blocks (s-step basis generation).
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  bs  - the block size
+
+   Options Database Key:
+.  -eps_krylovschur_blocksize - Sets the block size
+
+   Notes:
+   With the default value bs=1 the basis is extended one vector at a time,
+   with full orthogonalization. For bs>1, each group of bs basis vectors is
+   generated with a matrix powers kernel (repeated application of the
+   operator, without intermediate orthogonalization) and then orthogonalized
+   all at once with a block method, see BVSetOrthogonalization(). This
+   reduces the number of global reductions, at the cost of using a monomial
+   Krylov basis that becomes ill-conditioned as bs grows, so small values
+   (up to 4 or so) are recommended.
+
+   This variant is currently available only for non-Hermitian problems (or
+   when harmonic extraction is used); otherwise the value is ignored. It
+   cannot be combined with the pipelined variant, see
+   EPSKrylovSchurSetPipelined().
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetBlockSize(), EPSKrylovSchurSetPipelined(), BVSetOrthogonalization()
+@*/
+PetscErrorCode EPSKrylovSchurSetBlockSize(EPS eps,PetscInt bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,bs,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetBlockSize_C",(EPS,PetscInt),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetBlockSize_KrylovSchur(EPS eps,PetscInt *bs)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *bs = ctx->bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetBlockSize - Gets the block size used when generating the
+   Krylov basis in blocks.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  bs - the block size
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetBlockSize()
+@*/
+PetscErrorCode EPSKrylovSchurGetBlockSize(EPS eps,PetscInt *bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(bs,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetBlockSize_C",(EPS,PetscInt*),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetPartitions_KrylovSchur(EPS eps,PetscInt npart)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -663,6 +1175,185 @@ PetscErrorCode EPSKrylovSchurGetDetectZeros(EPS eps,PetscBool *detect)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurSetBalanceSubintervals_KrylovSchur(EPS eps,PetscBool balance)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  ctx->balance = balance;
+  eps->state   = EPS_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetBalanceSubintervals - Sets a flag to balance the number of
+   eigenvalues assigned to each partition in the spectrum slicing computation.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigenproblem solver context
+-  balance - balance the subintervals
+
+   Options Database Key:
+.  -eps_krylovschur_balance_subintervals - Balance the subintervals; this takes
+   an optional bool value (0/1/no/yes/true/false)
+
+   Notes:
+   By default, when several partitions are used the computational interval is
+   divided into subintervals of equal width, see EPSKrylovSchurSetPartitions().
+   If the eigenvalue distribution is far from uniform, some partitions end up
+   computing many more eigenpairs than others and the overall time is dictated
+   by the most loaded one. When this flag is set, the subinterval boundaries
+   are instead placed so that all partitions receive approximately the same
+   number of eigenvalues, by bisecting on the matrix inertia before the actual
+   computation starts. Each bisection step requires a factorization, so there
+   is an additional setup cost, usually amortized in unbalanced runs.
+
+   This flag has no effect if the subintervals have been set explicitly with
+   EPSKrylovSchurSetSubintervals().
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetBalanceSubintervals(), EPSKrylovSchurSetPartitions(), EPSKrylovSchurSetSubintervals(), EPSSetInterval()
+@*/
+PetscErrorCode EPSKrylovSchurSetBalanceSubintervals(EPS eps,PetscBool balance)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,balance,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetBalanceSubintervals_C",(EPS,PetscBool),(eps,balance));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetBalanceSubintervals_KrylovSchur(EPS eps,PetscBool *balance)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *balance = ctx->balance;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetBalanceSubintervals - Gets the flag that enables balancing
+   of the subintervals in spectrum slicing.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  balance - whether the subinterval boundaries are balanced using inertia
+   information
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetBalanceSubintervals()
+@*/
+PetscErrorCode EPSKrylovSchurGetBalanceSubintervals(EPS eps,PetscBool *balance)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(balance,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetBalanceSubintervals_C",(EPS,PetscBool*),(eps,balance));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurSetStochasticInertia_KrylovSchur(EPS eps,PetscInt nvec)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (nvec==PETSC_DEFAULT || nvec==PETSC_DECIDE) ctx->sinertia = 32;
+  else {
+    PetscCheck(nvec>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The number of sample vectors cannot be negative");
+    ctx->sinertia = nvec;
+  }
+  eps->state = EPS_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetStochasticInertia - Activates stochastic estimation of
+   matrix inertia in spectrum slicing runs.
+
+   Logically Collective
+
+   Input Parameters:
++  eps  - the eigenproblem solver context
+-  nvec - number of sample vectors, 0 to disable
+
+   Options Database Key:
+.  -eps_krylovschur_stochastic_inertia <nvec> - number of sample vectors
+
+   Notes:
+   Spectrum slicing normally obtains the number of eigenvalues to the left of
+   a shift from the LDL^T factorization of the shifted matrix, which requires
+   a direct linear solver. When this option is activated, that count is
+   instead estimated with stochastic Lanczos quadrature of the spectral
+   projector, which uses matrix-vector products only, so EPSSetInterval()
+   can be combined with an iterative linear solver when the matrix is too
+   large to factorize.
+
+   The estimated counts are approximate; the variance decreases with the
+   number of sample vectors, each one requiring a short Lanczos run with the
+   matrix. The computed eigenvalues are still obtained to full accuracy, only
+   the counts that steer the search for shifts are inexact, which may result
+   in additional subsolves. Zero detection, see EPSKrylovSchurSetDetectZeros(),
+   is not meaningful in this mode. Use PETSC_DEFAULT for a reasonable number
+   of samples.
+
+   Only implemented for standard Hermitian eigenproblems.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetStochasticInertia(), EPSSetInterval(), EPSKrylovSchurSetDetectZeros()
+@*/
+PetscErrorCode EPSKrylovSchurSetStochasticInertia(EPS eps,PetscInt nvec)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,nvec,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetStochasticInertia_C",(EPS,PetscInt),(eps,nvec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetStochasticInertia_KrylovSchur(EPS eps,PetscInt *nvec)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *nvec = ctx->sinertia;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetStochasticInertia - Gets the number of sample vectors
+   used for stochastic inertia estimation in spectrum slicing.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  nvec - number of sample vectors, 0 if inertia is computed exactly
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetStochasticInertia()
+@*/
+PetscErrorCode EPSKrylovSchurGetStochasticInertia(EPS eps,PetscInt *nvec)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(nvec,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetStochasticInertia_C",(EPS,PetscInt*),(eps,nvec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetDimensions_KrylovSchur(EPS eps,PetscInt nev,PetscInt ncv,PetscInt mpd)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -1344,6 +2035,132 @@ PetscErrorCode EPSKrylovSchurGetKSP(EPS eps,KSP *ksp)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurCheckpoint_KrylovSchur(EPS eps,PetscViewer viewer)
+{
+  PetscInt       i,hdr[3];
+  Vec            v;
+
+  PetscFunctionBegin;
+  PetscCheck(eps->state!=EPS_STATE_INITIAL,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONGSTATE,"Must call EPSSetUp() first");
+  PetscCheck(eps->ops->solve==EPSSolve_KrylovSchur_Default,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Checkpointing is only available in the default Krylov-Schur variant");
+  hdr[0] = eps->n;
+  hdr[1] = eps->nconv;
+  hdr[2] = eps->its;
+  PetscCall(PetscViewerBinaryWrite(viewer,hdr,3,PETSC_INT));
+  PetscCall(PetscViewerBinaryWrite(viewer,eps->eigr,eps->nconv,PETSC_SCALAR));
+  PetscCall(PetscViewerBinaryWrite(viewer,eps->eigi,eps->nconv,PETSC_SCALAR));
+  for (i=0;i<=eps->nconv;i++) {
+    PetscCall(BVGetColumn(eps->V,i,&v));
+    PetscCall(VecView(v,viewer));
+    PetscCall(BVRestoreColumn(eps->V,i,&v));
+  }
+  PetscCall(PetscInfo(eps,"Saved checkpoint with %" PetscInt_FMT " converged pairs at iteration %" PetscInt_FMT "\n",eps->nconv,eps->its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurCheckpoint - Saves the current state of a Krylov-Schur
+   computation, so that it can be resumed later with EPSKrylovSchurRestore().
+
+   Collective
+
+   Input Parameters:
++  eps    - the eigenproblem solver context
+-  viewer - a binary viewer where the state is written
+
+   Notes:
+   The saved state consists of the converged (locked) eigenpairs together
+   with the vector from which the Krylov subspace will be rebuilt, plus the
+   iteration counters. This is much smaller than the full working basis, so
+   the cost of writing a checkpoint is moderate, and it is enough to resume
+   the computation without repeating the work done for already converged
+   eigenpairs. Unconverged Ritz information is discarded, so after a restore
+   a few additional iterations may be needed compared with an uninterrupted
+   run.
+
+   This function is typically invoked periodically from a monitor routine,
+   see EPSMonitorSet(), opening the viewer with PetscViewerBinaryOpen().
+   Parallel I/O is available with the usual viewer options, e.g.
+   -viewer_binary_mpiio.
+
+   Checkpointing is only supported in the default Krylov-Schur variant, in
+   particular it is not available in spectrum slicing runs.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurRestore(), EPSMonitorSet(), PetscViewerBinaryOpen()
+@*/
+PetscErrorCode EPSKrylovSchurCheckpoint(EPS eps,PetscViewer viewer)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidHeaderSpecific(viewer,PETSC_VIEWER_CLASSID,2);
+  PetscCheckSameComm(eps,1,viewer,2);
+  PetscTryMethod(eps,"EPSKrylovSchurCheckpoint_C",(EPS,PetscViewer),(eps,viewer));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurRestore_KrylovSchur(EPS eps,PetscViewer viewer)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt        i,hdr[3],N;
+  Mat             A;
+
+  PetscFunctionBegin;
+  PetscCall(EPSKrylovSchurFreeCheckpoint(eps));
+  PetscCall(EPSGetOperators(eps,&A,NULL));
+  PetscCall(MatGetSize(A,&N,NULL));
+  PetscCall(PetscViewerBinaryRead(viewer,hdr,3,NULL,PETSC_INT));
+  PetscCheck(hdr[0]==N,PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"The checkpoint was taken from a problem of size %" PetscInt_FMT ", but the current problem has size %" PetscInt_FMT,hdr[0],N);
+  PetscCheck(hdr[1]>=0 && hdr[1]<=hdr[0],PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"Invalid number of converged pairs in checkpoint");
+  PetscCall(PetscMalloc1(hdr[1],&ctx->eigrckpt));
+  PetscCall(PetscMalloc1(hdr[1],&ctx->eigickpt));
+  PetscCall(PetscViewerBinaryRead(viewer,ctx->eigrckpt,hdr[1],NULL,PETSC_SCALAR));
+  PetscCall(PetscViewerBinaryRead(viewer,ctx->eigickpt,hdr[1],NULL,PETSC_SCALAR));
+  PetscCall(PetscMalloc1(hdr[1]+1,&ctx->Vckpt));
+  for (i=0;i<=hdr[1];i++) {
+    PetscCall(MatCreateVecs(A,&ctx->Vckpt[i],NULL));
+    PetscCall(VecLoad(ctx->Vckpt[i],viewer));
+  }
+  ctx->nckpt   = hdr[1];
+  ctx->itsckpt = hdr[2];
+  PetscCall(PetscInfo(eps,"Loaded checkpoint with %" PetscInt_FMT " converged pairs\n",ctx->nckpt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurRestore - Loads the state of a Krylov-Schur computation
+   previously saved with EPSKrylovSchurCheckpoint(), so that the next
+   EPSSolve() resumes from it.
+
+   Collective
+
+   Input Parameters:
++  eps    - the eigenproblem solver context
+-  viewer - a binary viewer where the state was written
+
+   Notes:
+   Must be called after the problem matrices have been set with
+   EPSSetOperators(). The restored eigenpairs are injected at the beginning
+   of the next EPSSolve(), which then continues the computation of the
+   remaining pairs. The solver settings (problem type, target, number of
+   requested eigenvalues) are not part of the checkpoint and must be set
+   again to the same values used in the original run.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurCheckpoint(), EPSSetOperators()
+@*/
+PetscErrorCode EPSKrylovSchurRestore(EPS eps,PetscViewer viewer)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidHeaderSpecific(viewer,PETSC_VIEWER_CLASSID,2);
+  PetscCheckSameComm(eps,1,viewer,2);
+  PetscTryMethod(eps,"EPSKrylovSchurRestore_C",(EPS,PetscViewer),(eps,viewer));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSetFromOptions_KrylovSchur(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -1358,9 +2175,24 @@ static PetscErrorCode EPSSetFromOptions_KrylovSchur(EPS eps,PetscOptionItems *Pe
     PetscCall(PetscOptionsReal("-eps_krylovschur_restart","Proportion of vectors kept after restart","EPSKrylovSchurSetRestart",0.5,&keep,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetRestart(eps,keep));
 
+    PetscCall(PetscOptionsBool("-eps_krylovschur_adaptive_restart","Adjust the restart parameter adaptively during the solve","EPSKrylovSchurSetAdaptiveRestart",PETSC_FALSE,&b,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetAdaptiveRestart(eps,b));
+
+    b = ctx->dynamic;
+    PetscCall(PetscOptionsBool("-eps_krylovschur_dynamic_basis","Adjust the number of working basis vectors during the solve","EPSKrylovSchurSetDynamicBasis",ctx->dynamic,&b,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetDynamicBasis(eps,b));
+
     PetscCall(PetscOptionsBool("-eps_krylovschur_locking","Choose between locking and non-locking variants","EPSKrylovSchurSetLocking",PETSC_TRUE,&lock,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetLocking(eps,lock));
 
+    b = ctx->pipelined;
+    PetscCall(PetscOptionsBool("-eps_krylovschur_pipelined","Use the pipelined variant with delayed normalization","EPSKrylovSchurSetPipelined",ctx->pipelined,&b,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetPipelined(eps,b));
+
+    i = ctx->bs;
+    PetscCall(PetscOptionsInt("-eps_krylovschur_blocksize","Block size for s-step basis generation","EPSKrylovSchurSetBlockSize",ctx->bs,&i,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetBlockSize(eps,i));
+
     i = ctx->npart;
     PetscCall(PetscOptionsInt("-eps_krylovschur_partitions","Number of partitions of the communicator for spectrum slicing","EPSKrylovSchurSetPartitions",ctx->npart,&i,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetPartitions(eps,i));
@@ -1369,6 +2201,14 @@ static PetscErrorCode EPSSetFromOptions_KrylovSchur(EPS eps,PetscOptionItems *Pe
     PetscCall(PetscOptionsBool("-eps_krylovschur_detect_zeros","Check zeros during factorizations at subinterval boundaries","EPSKrylovSchurSetDetectZeros",ctx->detect,&b,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetDetectZeros(eps,b));
 
+    b = ctx->balance;
+    PetscCall(PetscOptionsBool("-eps_krylovschur_balance_subintervals","Balance the number of eigenvalues assigned to each partition","EPSKrylovSchurSetBalanceSubintervals",ctx->balance,&b,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetBalanceSubintervals(eps,b));
+
+    i = ctx->sinertia;
+    PetscCall(PetscOptionsInt("-eps_krylovschur_stochastic_inertia","Number of sample vectors for stochastic inertia estimation","EPSKrylovSchurSetStochasticInertia",ctx->sinertia,&i,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetStochasticInertia(eps,i));
+
     i = 1;
     j = k = PETSC_DECIDE;
     PetscCall(PetscOptionsInt("-eps_krylovschur_nev","Number of eigenvalues to compute in each subsolve (only for spectrum slicing)","EPSKrylovSchurSetDimensions",40,&i,&f1));
@@ -1402,16 +2242,21 @@ static PetscErrorCode EPSView_KrylovSchur(EPS eps,PetscViewer viewer)
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
-    PetscCall(PetscViewerASCIIPrintf(viewer,"  %d%% of basis vectors kept after restart\n",(int)(100*ctx->keep)));
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  %d%% of basis vectors kept after restart%s\n",(int)(100*ctx->keep),ctx->adaptrestart?" (adjusted adaptively)":""));
+    if (ctx->dynamic) PetscCall(PetscViewerASCIIPrintf(viewer,"  sizing the working basis dynamically\n"));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  using the %slocking variant\n",ctx->lock?"":"non-"));
+    if (ctx->pipelined) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the pipelined variant with delayed normalization\n"));
+    if (ctx->bs>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  using s-step basis generation with block size %" PetscInt_FMT "\n",ctx->bs));
     if (eps->which==EPS_ALL) {
       PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
       if (isfilt) PetscCall(PetscViewerASCIIPrintf(viewer,"  using filtering to extract all eigenvalues in an interval\n"));
       else {
         PetscCall(PetscViewerASCIIPrintf(viewer,"  doing spectrum slicing with nev=%" PetscInt_FMT ", ncv=%" PetscInt_FMT ", mpd=%" PetscInt_FMT "\n",ctx->nev,ctx->ncv,ctx->mpd));
+        if (ctx->sinertia) PetscCall(PetscViewerASCIIPrintf(viewer,"  estimating inertia stochastically with %" PetscInt_FMT " sample vectors\n",ctx->sinertia));
         if (ctx->npart>1) {
           PetscCall(PetscViewerASCIIPrintf(viewer,"  multi-communicator spectrum slicing with %" PetscInt_FMT " partitions\n",ctx->npart));
           if (ctx->detect) PetscCall(PetscViewerASCIIPrintf(viewer,"  detecting zeros when factorizing at subinterval boundaries\n"));
+          if (ctx->balance) PetscCall(PetscViewerASCIIPrintf(viewer,"  balancing the subinterval boundaries using inertia information\n"));
         }
         /* view child KSP */
         PetscCall(EPSKrylovSchurGetKSP_KrylovSchur(eps,&ksp));
@@ -1441,12 +2286,24 @@ static PetscErrorCode EPSDestroy_KrylovSchur(EPS eps)
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetRestart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetAdaptiveRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetAdaptiveRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDynamicBasis_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDynamicBasis_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPipelined_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPipelined_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBlockSize_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPartitions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDetectZeros_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDetectZeros_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBalanceSubintervals_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBalanceSubintervals_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetStochasticInertia_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetStochasticInertia_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDimensions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDimensions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetSubintervals_C",NULL));
@@ -1457,6 +2314,8 @@ static PetscErrorCode EPSDestroy_KrylovSchur(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetSubcommMats_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurUpdateSubcommMats_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetKSP_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurCheckpoint_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurRestore_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1467,6 +2326,7 @@ static PetscErrorCode EPSReset_KrylovSchur(EPS eps)
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
   if (eps->which==EPS_ALL && !isfilt) PetscCall(EPSReset_KrylovSchur_Slice(eps));
+  PetscCall(EPSKrylovSchurFreeCheckpoint(eps));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1487,11 +2347,18 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
   PetscCall(PetscNew(&ctx));
   eps->data   = (void*)ctx;
   ctx->lock   = PETSC_TRUE;
+  ctx->adaptrestart = PETSC_FALSE;
+  ctx->dynamic = PETSC_FALSE;
+  ctx->pipelined = PETSC_FALSE;
+  ctx->bs     = 1;
+  ctx->nckpt  = -1;
   ctx->nev    = 1;
   ctx->ncv    = PETSC_DEFAULT;
   ctx->mpd    = PETSC_DEFAULT;
   ctx->npart  = 1;
   ctx->detect = PETSC_FALSE;
+  ctx->balance = PETSC_FALSE;
+  ctx->sinertia = 0;
   ctx->global = PETSC_TRUE;
 
   eps->useds = PETSC_TRUE;
@@ -1508,12 +2375,24 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetRestart_C",EPSKrylovSchurSetRestart_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",EPSKrylovSchurGetRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetAdaptiveRestart_C",EPSKrylovSchurSetAdaptiveRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetAdaptiveRestart_C",EPSKrylovSchurGetAdaptiveRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDynamicBasis_C",EPSKrylovSchurSetDynamicBasis_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDynamicBasis_C",EPSKrylovSchurGetDynamicBasis_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",EPSKrylovSchurSetLocking_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",EPSKrylovSchurGetLocking_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPipelined_C",EPSKrylovSchurSetPipelined_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPipelined_C",EPSKrylovSchurGetPipelined_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBlockSize_C",EPSKrylovSchurSetBlockSize_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBlockSize_C",EPSKrylovSchurGetBlockSize_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",EPSKrylovSchurSetPartitions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPartitions_C",EPSKrylovSchurGetPartitions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDetectZeros_C",EPSKrylovSchurSetDetectZeros_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDetectZeros_C",EPSKrylovSchurGetDetectZeros_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBalanceSubintervals_C",EPSKrylovSchurSetBalanceSubintervals_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBalanceSubintervals_C",EPSKrylovSchurGetBalanceSubintervals_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetStochasticInertia_C",EPSKrylovSchurSetStochasticInertia_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetStochasticInertia_C",EPSKrylovSchurGetStochasticInertia_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDimensions_C",EPSKrylovSchurSetDimensions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetDimensions_C",EPSKrylovSchurGetDimensions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetSubintervals_C",EPSKrylovSchurSetSubintervals_KrylovSchur));
@@ -1524,5 +2403,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetSubcommMats_C",EPSKrylovSchurGetSubcommMats_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurUpdateSubcommMats_C",EPSKrylovSchurUpdateSubcommMats_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetKSP_C",EPSKrylovSchurGetKSP_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurCheckpoint_C",EPSKrylovSchurCheckpoint_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurRestore_C",EPSKrylovSchurRestore_KrylovSchur));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -71,7 +71,17 @@ typedef struct _n_SR *EPS_SR;
 
 typedef struct {
   PetscReal        keep;               /* restart parameter */
+  PetscBool        adaptrestart;       /* adjust the restart parameter during the solve */
+  PetscBool        dynamic;            /* dynamic sizing of the working basis */
+  PetscInt         wsize;              /* current number of working basis vectors */
   PetscBool        lock;               /* locking/non-locking variant */
+  PetscBool        pipelined;          /* pipelined variant with delayed normalization */
+  PetscInt         bs;                 /* block size for s-step basis generation */
+  /* checkpoint/restart */
+  PetscInt         nckpt;              /* locked pairs in restored checkpoint (-1 if none) */
+  PetscInt         itsckpt;            /* iteration count at checkpoint */
+  Vec              *Vckpt;             /* restored basis columns (nckpt+1) */
+  PetscScalar      *eigrckpt,*eigickpt;/* restored eigenvalues */
   /* the following are used only in spectrum slicing */
   EPS_SR           sr;                 /* spectrum slicing context */
   PetscInt         nev;                /* number of eigenvalues to compute */
@@ -79,6 +89,10 @@ typedef struct {
   PetscInt         mpd;                /* maximum dimension of projected problem */
   PetscInt         npart;              /* number of partitions of subcommunicator */
   PetscBool        detect;             /* check for zeros during factorizations */
+  PetscBool        balance;            /* inertia-balanced subinterval boundaries */
+  PetscInt         sinertia;           /* sample vectors for stochastic inertia estimation (0=exact) */
+  PetscInt         sinq;               /* number of cached stochastic quadrature nodes */
+  PetscReal        *sinodes,*siwts;    /* cached stochastic quadrature nodes and weights */
   PetscReal        *subintervals;      /* partition of global interval */
   PetscBool        subintset;          /* subintervals set by user */
   PetscMPIInt      *nconv_loc;         /* converged eigenpairs for each subinterval */
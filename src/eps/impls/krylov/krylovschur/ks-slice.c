@@ -25,6 +25,7 @@
 
 #include <slepc/private/epsimpl.h>
 #include "krylovschur.h"
+#include <slepcblaslapack.h>
 
 static PetscBool  cited = PETSC_FALSE;
 static const char citation[] =
@@ -73,6 +74,8 @@ PetscErrorCode EPSReset_KrylovSchur_Slice(EPS eps)
   EPS_KRYLOVSCHUR *ctx=(EPS_KRYLOVSCHUR*)eps->data;
 
   PetscFunctionBegin;
+  ctx->sinq = 0;
+  PetscCall(PetscFree2(ctx->sinodes,ctx->siwts));
   if (!ctx->global) PetscFunctionReturn(PETSC_SUCCESS);
   /* Reset auxiliary EPS */
   PetscCall(EPSSliceResetSR(ctx->eps));
@@ -194,6 +197,8 @@ static PetscErrorCode EPSSliceGetEPS(EPS eps)
 
   ctx_local = (EPS_KRYLOVSCHUR*)ctx->eps->data;
   ctx_local->detect = ctx->detect;
+  ctx_local->balance = ctx->balance;
+  ctx_local->sinertia = ctx->sinertia;
 
   /* transfer options from eps->V */
   PetscCall(EPSGetBV(ctx->eps,&V));
@@ -224,8 +229,85 @@ static PetscErrorCode EPSSliceGetEPS(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSSliceStochasticInertia - Estimate the number of eigenvalues to the left
+   of the given shift using only matrix-vector products. The count is the
+   trace of the spectral projector onto (-inf,shift), written as the
+   expectation of v'*f(A)*v over random unit vectors v, with f the step
+   function. Each sample runs a short Lanczos recurrence and approximates
+   v'*f(A)*v by a Gauss quadrature whose nodes are the Ritz values and whose
+   weights are the squared first components of the eigenvectors of the
+   tridiagonal matrix. Nodes and weights do not depend on the shift, so they
+   are computed once and cached; subsequent queries amount to scanning the
+   cache, which in addition makes the estimated count a monotone function of
+   the shift, as assumed by the search logic of the slicing driver.
+*/
+static PetscErrorCode EPSSliceStochasticInertia(EPS eps,PetscReal shift,PetscInt *inertia)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  Mat             A;
+  Vec             v,w,vold;
+  PetscRandom     rand;
+  PetscReal       *alpha,*beta,*rwork,nrm,est=0.0;
+  PetscScalar     *Z,dot;
+  PetscInt        i,j,k,m,q;
+  PetscBLASInt    n_,info;
+
+  PetscFunctionBegin;
+  if (!ctx->sinodes) {  /* compute and cache the quadrature nodes and weights */
+    PetscCall(STGetMatrix(eps->st,0,&A));
+    m = PetscMin(eps->n,64);   /* Lanczos steps per sample */
+    PetscCall(PetscMalloc2(ctx->sinertia*m,&ctx->sinodes,ctx->sinertia*m,&ctx->siwts));
+    PetscCall(PetscMalloc4(m,&alpha,m,&beta,m*m,&Z,2*m,&rwork));
+    PetscCall(MatCreateVecs(A,&v,&w));
+    PetscCall(VecDuplicate(v,&vold));
+    PetscCall(PetscRandomCreate(PetscObjectComm((PetscObject)eps),&rand));
+    PetscCall(PetscRandomSetInterval(rand,-1.0,1.0));
+    q = 0;
+    for (j=0;j<ctx->sinertia;j++) {
+      PetscCall(VecSetRandom(v,rand));
+      PetscCall(VecNormalize(v,NULL));
+      k = m;
+      for (i=0;i<m;i++) {   /* Lanczos iteration without reorthogonalization */
+        PetscCall(MatMult(A,v,w));
+        if (i) PetscCall(VecAXPY(w,-beta[i-1],vold));
+        PetscCall(VecDot(w,v,&dot));
+        alpha[i] = PetscRealPart(dot);
+        PetscCall(VecAXPY(w,-alpha[i],v));
+        PetscCall(VecNorm(w,NORM_2,&nrm));
+        beta[i] = nrm;
+        if (nrm<10*PETSC_MACHINE_EPSILON*PetscAbsReal(alpha[i])) { k = i+1; break; }  /* breakdown */
+        PetscCall(VecCopy(v,vold));
+        PetscCall(VecCopy(w,v));
+        PetscCall(VecScale(v,1.0/nrm));
+      }
+      PetscCall(PetscBLASIntCast(k,&n_));
+      PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+      PetscCallBLAS("LAPACKsteqr",LAPACKsteqr_("I",&n_,alpha,beta,Z,&n_,rwork,&info));
+      PetscCall(PetscFPTrapPop());
+      SlepcCheckLapackInfo("steqr",info);
+      for (i=0;i<k;i++) {
+        ctx->sinodes[q] = alpha[i];
+        ctx->siwts[q]   = PetscAbsScalar(Z[i*k])*PetscAbsScalar(Z[i*k]);
+        q++;
+      }
+    }
+    ctx->sinq = q;
+    PetscCall(PetscRandomDestroy(&rand));
+    PetscCall(VecDestroy(&v));
+    PetscCall(VecDestroy(&w));
+    PetscCall(VecDestroy(&vold));
+    PetscCall(PetscFree4(alpha,beta,Z,rwork));
+  }
+  for (q=0;q<ctx->sinq;q++) if (ctx->sinodes[q]<shift) est += ctx->siwts[q];
+  i = (PetscInt)PetscFloorReal((PetscReal)eps->n*est/ctx->sinertia+0.5);
+  *inertia = PetscMax(0,PetscMin(eps->n,i));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSliceGetInertia(EPS eps,PetscReal shift,PetscInt *inertia,PetscInt *zeros)
 {
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
   KSP            ksp,kspr;
   PC             pc;
   Mat            F;
@@ -243,21 +325,73 @@ static PetscErrorCode EPSSliceGetInertia(EPS eps,PetscReal shift,PetscInt *inert
        The goal is that the nonzero pattern is the same in all cases and reuse
        the symbolic factorizations */
     nzshift = (shift==0.0)? 10.0/PETSC_MAX_REAL: shift;
+    /* Each ST holds a single factorization, overwritten on every shift change.
+       Caching several factorizations and spilling idle ones to local storage
+       is not viable: the factored Mat of an external direct solver is an
+       opaque handle (e.g. MUMPS keeps its factors in solver-internal
+       structures, partly distributed), and neither PETSc nor the solvers
+       expose a way to serialize and restore it, so a revisited shift can only
+       be obtained by refactoring. Memory pressure from concurrently held
+       factorizations is instead controlled with the partitioning option,
+       which gives each subcommunicator exactly one factorization */
     PetscCall(STSetShift(eps->st,nzshift));
-    PetscCall(STGetKSP(eps->st,&ksp));
-    PetscCall(KSPGetPC(ksp,&pc));
-    PetscCall(PetscObjectTypeCompare((PetscObject)pc,PCREDUNDANT,&flg));
-    if (flg) {
-      PetscCall(PCRedundantGetKSP(pc,&kspr));
-      PetscCall(KSPGetPC(kspr,&pc));
+    if (ctx->sinertia) {  /* matrix-free estimate, no factorization available */
+      if (inertia) PetscCall(EPSSliceStochasticInertia(eps,shift,inertia));
+      if (zeros) *zeros = 0;
+    } else {
+      PetscCall(STGetKSP(eps->st,&ksp));
+      PetscCall(KSPGetPC(ksp,&pc));
+      PetscCall(PetscObjectTypeCompare((PetscObject)pc,PCREDUNDANT,&flg));
+      if (flg) {
+        PetscCall(PCRedundantGetKSP(pc,&kspr));
+        PetscCall(KSPGetPC(kspr,&pc));
+      }
+      PetscCall(PCFactorGetMatrix(pc,&F));
+      PetscCall(MatGetInertia(F,inertia,zeros,NULL));
     }
-    PetscCall(PCFactorGetMatrix(pc,&F));
-    PetscCall(MatGetInertia(F,inertia,zeros,NULL));
   }
   if (inertia) PetscCall(PetscInfo(eps,"Computed inertia at shift %g: %" PetscInt_FMT "\n",(double)nzshift,*inertia));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSSliceComputeBalancedBoundary - Replace a uniform subinterval boundary by
+   one chosen so that all partitions receive approximately the same number of
+   eigenvalues. The boundary with index b (1<=b<=npart-1) is located by
+   bisection on the inertia, which is a monotone integer function of the
+   shift, so each subcommunicator can compute its own boundary independently
+   (neighbouring subcommunicators later receive the computed value through
+   the usual exchange of endpoints). Each bisection step requires a
+   factorization, hence the iteration count is kept small.
+
+   Note that only the numeric phase is paid at each step: ST updates the
+   shifted operator in place, so its nonzero pattern is unchanged (see also
+   the zero-shift perturbation in EPSSliceGetInertia) and PCSetUp reuses the
+   symbolic analysis of the first factorization for all subsequent shifts.
+   The numeric factorizations themselves cannot be batched, since each
+   bisection shift is chosen from the inertia obtained at the previous one.
+*/
+static PetscErrorCode EPSSliceComputeBalancedBoundary(EPS eps,PetscInt b,PetscInt npart,PetscReal ga,PetscReal gb,PetscReal *x)
+{
+  PetscInt       n0,n1,target,iner,it;
+  PetscReal      lo=ga,hi=gb,mid=*x;
+
+  PetscFunctionBegin;
+  PetscCall(EPSSliceGetInertia(eps,ga,&n0,NULL));
+  PetscCall(EPSSliceGetInertia(eps,gb,&n1,NULL));
+  target = n0+((n1-n0)*b)/npart;
+  for (it=0;it<20 && hi-lo>PETSC_SQRT_MACHINE_EPSILON*(gb-ga);it++) {
+    mid = (lo+hi)/2;
+    PetscCall(EPSSliceGetInertia(eps,mid,&iner,NULL));
+    if (iner==target) break;
+    else if (iner>target) hi = mid;
+    else lo = mid;
+  }
+  PetscCall(PetscInfo(eps,"Subinterval boundary %" PetscInt_FMT " moved to %g targeting inertia %" PetscInt_FMT "\n",b,(double)mid,target));
+  *x = mid;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    Dummy backtransform operation
  */
@@ -286,6 +420,7 @@ PetscErrorCode EPSSetUp_KrylovSchur_Slice(EPS eps)
     PetscCheck(eps->inta!=eps->intb,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver does not support computing all eigenvalues unless you provide a computational interval with EPSSetInterval()");
     PetscCheck(eps->intb<PETSC_MAX_REAL || eps->inta>PETSC_MIN_REAL,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONG,"The defined computational interval should have at least one of their sides bounded");
     PetscCheck(eps->nds==0,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Spectrum slicing not supported in combination with deflation space");
+    PetscCheck(!ctx->sinertia || !eps->isgeneralized,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Stochastic inertia estimation is only implemented for standard eigenproblems");
     EPSCheckUnsupportedCondition(eps,EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION | EPS_FEATURE_STOPPING,PETSC_TRUE," with spectrum slicing");
     EPSCheckIgnoredCondition(eps,EPS_FEATURE_BALANCE,PETSC_TRUE," with spectrum slicing");
     if (eps->tol==(PetscReal)PETSC_DEFAULT) {
@@ -303,6 +438,8 @@ PetscErrorCode EPSSetUp_KrylovSchur_Slice(EPS eps)
   eps->ops->backtransform = EPSBackTransform_Skip;
 
   /* create spectrum slicing context and initialize it */
+  ctx->sinq = 0;
+  PetscCall(PetscFree2(ctx->sinodes,ctx->siwts));  /* matrices may have changed since the last solve */
   PetscCall(EPSSliceResetSR(eps));
   PetscCall(PetscNew(&sr));
   ctx->sr = sr;
@@ -388,6 +525,17 @@ PetscErrorCode EPSSetUp_KrylovSchur_Slice(EPS eps)
     PetscCall(STSetShift(eps->st,(sr->int0==0.0)?10.0/PETSC_MAX_REAL:sr->int0));
     PetscCall(STSetUp(eps->st));
 
+    /* optionally replace the uniform boundary assigned to this subcommunicator
+       by an inertia-balanced one */
+    if (ctx->balance && ctx->npart>1 && !ctx_glob->subintset && ((sr->dir>0 && ctx->subc->color>0) || (sr->dir<0 && ctx->subc->color<ctx->npart-1))) {
+      i = (sr->dir>0)? ctx->subc->color: ctx->subc->color+1;
+      r = sr->int0;
+      PetscCall(EPSSliceComputeBalancedBoundary(eps,i,ctx->npart,ctx->eps->inta,ctx->eps->intb,&r));
+      sr->int0 = r;
+      if (sr->dir>0) eps->inta = r;
+      else eps->intb = r;
+    }
+
     /* compute inertia0 */
     PetscCall(EPSSliceGetInertia(eps,sr->int0,&sr->inertia0,ctx->detect?&zeros:NULL));
     /* undocumented option to control what to do when an eigenvalue is found:
@@ -785,7 +933,7 @@ static PetscErrorCode EPSPrepareRational(EPS eps)
 /* Provides next shift to be computed */
 static PetscErrorCode EPSExtractShift(EPS eps)
 {
-  PetscInt        iner,zeros=0;
+  PetscInt        i,iner,zeros=0;
   EPS_KRYLOVSCHUR *ctx=(EPS_KRYLOVSCHUR*)eps->data;
   EPS_SR          sr;
   PetscReal       newShift,diam,ptol;
@@ -804,6 +952,20 @@ static PetscErrorCode EPSExtractShift(EPS eps)
     sr->sPrev = sr->sPres;
     sr->sPres = sr->pending[--sr->nPend];
     sPres = sr->sPres;
+    /* A shift that agrees to working accuracy with a computed eigenvalue renders
+       a singular factorization; predict this case by scanning the eigenvalues
+       already stored and perturb the shift in advance, so that the cost of a
+       factorization that would be discarded afterwards is saved */
+    for (i=0;i<sr->indexEig;i++) {
+      if (PetscAbsReal(PetscRealPart(sr->eigr[i])-sPres->value) <= 100*PETSC_SQRT_MACHINE_EPSILON*PetscAbsReal(sPres->value)) {
+        ptol = SLICE_PTOL;
+        if (sPres->neighb[0]) ptol = PetscMin(ptol,PetscAbsReal(sPres->neighb[0]->value-sPres->value)/(2*PetscAbsReal(sPres->value)));
+        if (sPres->neighb[1]) ptol = PetscMin(ptol,PetscAbsReal(sPres->neighb[1]->value-sPres->value)/(2*PetscAbsReal(sPres->value)));
+        PetscCall(PetscInfo(eps,"Shift %g is too close to a computed eigenvalue, perturbed to %g\n",(double)sPres->value,(double)(sPres->value*(1.0+ptol))));
+        sPres->value *= 1.0+ptol;
+        break;
+      }
+    }
     PetscCall(EPSSliceGetInertia(eps,sPres->value,&iner,ctx->detect?&zeros:NULL));
     if (zeros) {
       diam = PetscMin(PetscAbsReal(sPres->neighb[0]->value-sPres->value),PetscAbsReal(sPres->neighb[1]->value-sPres->value));
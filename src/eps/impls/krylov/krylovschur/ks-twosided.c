@@ -127,6 +127,7 @@ PetscErrorCode EPSSolve_KrylovSchur_TwoSided(EPS eps)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
   Mat             M,U,Op,OpHT,S,T;
+  Vec             u,w;
   PetscReal       norm,norm2,beta,betat;
   PetscInt        ld,l,nv,nvt,k,nconv,dsn,dsk;
   PetscBool       breakdownt,breakdown,breakdownl;
@@ -179,9 +180,15 @@ PetscErrorCode EPSSolve_KrylovSchur_TwoSided(EPS eps)
     PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
     PetscCall(DSUpdateExtraRow(eps->ds));
 
-    /* Check convergence */
-    PetscCall(BVNormColumn(eps->V,nv,NORM_2,&norm));
-    PetscCall(BVNormColumn(eps->W,nv,NORM_2,&norm2));
+    /* Check convergence, computing both residual norms with a single reduction */
+    PetscCall(BVGetColumn(eps->V,nv,&u));
+    PetscCall(BVGetColumn(eps->W,nv,&w));
+    PetscCall(VecNormBegin(u,NORM_2,&norm));
+    PetscCall(VecNormBegin(w,NORM_2,&norm2));
+    PetscCall(VecNormEnd(u,NORM_2,&norm));
+    PetscCall(VecNormEnd(w,NORM_2,&norm2));
+    PetscCall(BVRestoreColumn(eps->V,nv,&u));
+    PetscCall(BVRestoreColumn(eps->W,nv,&w));
     PetscCall(EPSKrylovConvergence(eps,PETSC_FALSE,eps->nconv,nv-eps->nconv,beta*norm,betat*norm2,1.0,&k));
     PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,k,eps->nev,&eps->reason,eps->stoppingctx));
     nconv = k;
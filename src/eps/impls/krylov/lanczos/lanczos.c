@@ -29,8 +29,12 @@
 
 typedef struct {
   EPSLanczosReorthogType reorthog;      /* user-provided reorthogonalization parameter */
+  PetscInt               bs;            /* block size for the block-Lanczos variant */
   PetscInt               allocsize;     /* number of columns of work BV's allocated at setup */
   BV                     AV;            /* work BV used in selective reorthogonalization */
+  PetscInt               window;        /* number of recent vectors kept in the sliding window */
+  PetscInt               sketch;        /* number of sketch vectors summarizing the older basis */
+  BV                     S;             /* work BV holding the sketch of the older basis */
 } EPS_LANCZOS;
 
 static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
@@ -51,14 +55,19 @@ static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
   EPSCheckIgnored(eps,EPS_FEATURE_BALANCE);
 
   PetscCheck(lanczos->reorthog!=(EPSLanczosReorthogType)-1,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"You should explicitly provide the reorthogonalization type, e.g., -eps_lanczos_reorthog local\n          ...   Note that the EPSLANCZOS solver is *NOT RECOMMENDED* for general use, because it uses\n          ...   explicit restart which typically has slow convergence. The recommended solver is\n          ...   EPSKRYLOVSCHUR (the default), which implements Lanczos with thick restart in the\n          ...   case of symmetric/Hermitian problems");
+  PetscCheck(lanczos->bs==1 || lanczos->reorthog==EPS_LANCZOS_REORTHOG_FULL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"A block size larger than 1 requires full reorthogonalization");
 
-  PetscCall(EPSAllocateSolution(eps,1));
+  PetscCall(EPSAllocateSolution(eps,lanczos->bs));
   PetscCall(EPS_SetInnerProduct(eps));
   if (lanczos->reorthog != EPS_LANCZOS_REORTHOG_FULL) {
     PetscCall(BVGetOrthogonalization(eps->V,NULL,&refine,&eta,&btype));
     PetscCall(BVSetOrthogonalization(eps->V,BV_ORTHOG_MGS,refine,eta,btype));
     PetscCall(PetscInfo(eps,"Switching to MGS orthogonalization\n"));
   }
+  if (lanczos->reorthog == EPS_LANCZOS_REORTHOG_WINDOW && lanczos->sketch>0) {
+    if (!lanczos->S) PetscCall(BVDuplicateResize(eps->V,lanczos->sketch,&lanczos->S));
+    else PetscCall(BVResize(lanczos->S,lanczos->sketch,PETSC_FALSE));
+  }
   if (lanczos->reorthog == EPS_LANCZOS_REORTHOG_SELECTIVE) {
     if (!lanczos->allocsize) {
       PetscCall(BVDuplicate(eps->V,&lanczos->AV));
@@ -70,7 +79,9 @@ static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
   }
 
   PetscCall(DSSetType(eps->ds,DSHEP));
-  PetscCall(DSSetCompact(eps->ds,PETSC_TRUE));
+  /* with blocks the projected matrix is band instead of tridiagonal */
+  PetscCall(DSSetCompact(eps->ds,lanczos->bs==1?PETSC_TRUE:PETSC_FALSE));
+  if (lanczos->bs>1) PetscCall(DSSetBlockSize(eps->ds,lanczos->bs));
   PetscCall(DSAllocate(eps->ds,eps->ncv+1));
   if (lanczos->reorthog == EPS_LANCZOS_REORTHOG_LOCAL) PetscCall(EPSSetWorkVecs(eps,1));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -118,6 +129,96 @@ static PetscErrorCode EPSLocalLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,P
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSWindowLanczos - Sliding-window reorthogonalization.
+
+   At each Lanczos step, the new vector is orthogonalized explicitly against the
+   last 'window' basis vectors (plus the locked ones), instead of just the two
+   vectors of the three-term recurrence. In addition, if 'sketch' is positive,
+   a random projection of the older basis is maintained in a small work BV: each
+   vector leaving the window is accumulated with a random sign into one of the
+   sketch columns, and the new vector is purged of its components along the
+   sketch before the window orthogonalization. This suppresses the growth of
+   ghost eigenvalues at a cost of O(window+sketch) inner products per step,
+   without the full-basis sweeps of complete reorthogonalization. The purge is
+   approximate by construction, so semi-orthogonality is not guaranteed.
+*/
+static PetscErrorCode EPSWindowLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscInt k,PetscInt *M,PetscBool *breakdown)
+{
+  EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
+  PetscInt       i,j,b,m = *M,w = lanczos->window,s = lanczos->sketch;
+  Mat            Op;
+  Vec            z,vold,sb;
+  PetscRandom    rand=NULL;
+  PetscBool      *which,lwhich[100];
+  PetscScalar    *hwork,*coef=NULL,lhwork[100],gamma;
+  PetscReal      *cnt=NULL;
+
+  PetscFunctionBegin;
+  if (m > 100) PetscCall(PetscMalloc2(m,&which,m,&hwork));
+  else {
+    which = lwhich;
+    hwork = lhwork;
+  }
+  for (i=0;i<k;i++) which[i] = PETSC_TRUE;
+  for (i=k;i<m;i++) which[i] = PETSC_FALSE;
+  if (s) {
+    /* the sketch starts empty: it only summarizes vectors generated in this sweep */
+    PetscCall(PetscMalloc2(s,&coef,s,&cnt));
+    PetscCall(PetscArrayzero(cnt,s));
+    for (b=0;b<s;b++) {
+      PetscCall(BVGetColumn(lanczos->S,b,&sb));
+      PetscCall(VecSet(sb,0.0));
+      PetscCall(BVRestoreColumn(lanczos->S,b,&sb));
+    }
+    PetscCall(BVSetActiveColumns(lanczos->S,0,s));
+    PetscCall(BVGetRandomContext(lanczos->S,&rand));
+  }
+
+  PetscCall(BVSetActiveColumns(eps->V,0,m));
+  PetscCall(STGetOperator(eps->st,&Op));
+  for (j=k;j<m;j++) {
+    PetscCall(BVMatMultColumn(eps->V,Op,j));
+    which[j] = PETSC_TRUE;
+    if (j-w>=k) {
+      which[j-w] = PETSC_FALSE;
+      if (s) {
+        /* fold the vector leaving the window into one of the sketch columns,
+           with a random sign so that ghost components do not cancel systematically */
+        b = (j-w) % s;
+        PetscCall(PetscRandomGetValue(rand,&gamma));
+        gamma = (PetscRealPart(gamma)<0.5)? -1.0: 1.0;
+        PetscCall(BVGetColumn(eps->V,j-w,&vold));
+        PetscCall(BVGetColumn(lanczos->S,b,&sb));
+        PetscCall(VecAXPY(sb,gamma,vold));
+        PetscCall(BVRestoreColumn(lanczos->S,b,&sb));
+        PetscCall(BVRestoreColumn(eps->V,j-w,&vold));
+        cnt[b] += 1.0;
+      }
+    }
+    if (s && j-w>=k) {
+      /* purge the components along the sketch; since each sketch column is a
+         signed sum of (nearly) orthonormal vectors, its squared norm is the
+         number of accumulated vectors */
+      PetscCall(BVGetColumn(eps->V,j+1,&z));
+      PetscCall(BVDotVec(lanczos->S,z,coef));
+      for (b=0;b<s;b++) coef[b] = cnt[b]>0.0? coef[b]/cnt[b]: 0.0;
+      PetscCall(BVMultVec(lanczos->S,-1.0,1.0,z,coef));
+      PetscCall(BVRestoreColumn(eps->V,j+1,&z));
+    }
+    PetscCall(BVOrthogonalizeSomeColumn(eps->V,j+1,which,hwork,beta+j,breakdown));
+    alpha[j] = PetscRealPart(hwork[j]);
+    if (PetscUnlikely(*breakdown)) {
+      *M = j+1;
+      break;
+    } else PetscCall(BVScaleColumn(eps->V,j+1,1/beta[j]));
+  }
+  PetscCall(STRestoreOperator(eps->st,&Op));
+  if (s) PetscCall(PetscFree2(coef,cnt));
+  if (m > 100) PetscCall(PetscFree2(which,hwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    DenseTridiagonal - Solves a real tridiagonal Hermitian Eigenvalue Problem.
 
@@ -435,6 +536,66 @@ static PetscErrorCode EPSPartialLanczos(EPS eps,PetscReal *alpha,PetscReal *beta
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSBlockLanczos - Block Lanczos with block size bs and full
+   reorthogonalization, in the column-wise (band) formulation: the candidate
+   for v_{j+bs} is OP*v_j orthogonalized against all previous basis vectors,
+   so that the projected matrix is symmetric banded with bandwidth bs. The
+   matrix is stored in non-compact form in T (leading dimension ldt), with
+   entries beyond row m-1 contributing to the residual block instead. On exit,
+   betam contains the Frobenius norm of the residual block, which bounds its
+   2-norm in the residual estimates of the solver.
+
+   The initial block is completed with random orthonormal columns, so that a
+   cluster of up to bs (nearly) degenerate eigenvalues can be resolved in a
+   single sweep.
+*/
+static PetscErrorCode EPSBlockLanczos(EPS eps,PetscScalar *T,PetscInt ldt,PetscInt k,PetscInt *M,PetscReal *betam,PetscBool *breakdown)
+{
+  EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
+  PetscInt       bs=lanczos->bs,i,j,m=*M;
+  Vec            vj,w;
+  PetscReal      norm,res=0.0;
+  PetscBool      lindep=PETSC_FALSE;
+  PetscScalar    *hwork;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc1(m+bs,&hwork));
+  /* complete the initial block with random orthonormal columns */
+  for (j=k+1;j<k+bs;j++) {
+    PetscCall(BVSetRandomColumn(eps->V,j));
+    PetscCall(BVOrthonormalizeColumn(eps->V,j,PETSC_TRUE,NULL,NULL));
+  }
+  *breakdown = PETSC_FALSE;
+  for (j=k;j<m;j++) {
+    PetscCall(BVGetColumn(eps->V,j,&vj));
+    PetscCall(BVGetColumn(eps->V,j+bs,&w));
+    PetscCall(STApply(eps->st,vj,w));
+    PetscCall(BVRestoreColumn(eps->V,j,&vj));
+    PetscCall(BVRestoreColumn(eps->V,j+bs,&w));
+    PetscCall(BVSetActiveColumns(eps->V,0,j+bs));
+    PetscCall(BVOrthogonalizeColumn(eps->V,j+bs,hwork,&norm,&lindep));
+    /* store the j-th column of the projected matrix (and its symmetric mirror) */
+    for (i=k;i<PetscMin(j+bs,m);i++) {
+      T[i+j*ldt] = hwork[i];
+      T[j+i*ldt] = PetscConj(hwork[i]);
+    }
+    /* coefficients beyond row m-1 belong to the residual block */
+    for (i=m;i<j+bs;i++) res += PetscAbsScalar(hwork[i])*PetscAbsScalar(hwork[i]);
+    if (PetscUnlikely(lindep)) {
+      *M = j+1;
+      *breakdown = PETSC_TRUE;
+      break;
+    }
+    if (j+bs<m) T[(j+bs)+j*ldt] = T[j+(j+bs)*ldt] = norm;
+    else res += norm*norm;
+    PetscCall(BVScaleColumn(eps->V,j+bs,1.0/norm));
+  }
+  *betam = PetscSqrtReal(res);
+  PetscCall(PetscFree(hwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSBasicLanczos - Computes an m-step Lanczos factorization. The first k
    columns are assumed to be locked and therefore they are not modified. On
@@ -463,6 +624,16 @@ static PetscErrorCode EPSBasicLanczos(EPS eps,PetscInt k,PetscInt *m,PetscReal *
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  if (lanczos->bs>1) {
+    /* block variant: band matrix stored in non-compact form, with the
+       diagonal of the locked part rebuilt from the converged eigenvalues */
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&T));
+    PetscCall(PetscArrayzero(T,ld*ld));
+    for (i=0;i<k;i++) T[i+i*ld] = eps->eigr[i];
+    PetscCall(EPSBlockLanczos(eps,T,ld,k,m,betam,breakdown));
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&T));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   switch (lanczos->reorthog) {
     case EPS_LANCZOS_REORTHOG_LOCAL:
       PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&alpha));
@@ -471,6 +642,13 @@ static PetscErrorCode EPSBasicLanczos(EPS eps,PetscInt k,PetscInt *m,PetscReal *
       *betam = beta[*m-1];
       PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&alpha));
       break;
+    case EPS_LANCZOS_REORTHOG_WINDOW:
+      PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&alpha));
+      beta = alpha + ld;
+      PetscCall(EPSWindowLanczos(eps,alpha,beta,k,m,breakdown));
+      *betam = beta[*m-1];
+      PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&alpha));
+      break;
     case EPS_LANCZOS_REORTHOG_FULL:
       PetscCall(STGetOperator(eps->st,&Op));
       PetscCall(DSGetMat(eps->ds,DS_MAT_T,&M));
@@ -544,7 +722,7 @@ static PetscErrorCode EPSSolve_Lanczos(EPS eps)
     PetscCall(DSSetDimensions(eps->ds,n,nconv,PETSC_DEFAULT));
     PetscCall(EPSBasicLanczos(eps,nconv,&n,&beta,&breakdown,anorm));
     PetscCall(DSSetDimensions(eps->ds,n,nconv,0));
-    PetscCall(DSSetState(eps->ds,DS_STATE_INTERMEDIATE));
+    PetscCall(DSSetState(eps->ds,lanczos->bs>1?DS_STATE_RAW:DS_STATE_INTERMEDIATE));
     PetscCall(BVSetActiveColumns(eps->V,nconv,n));
 
     /* Solve projected problem */
@@ -556,10 +734,15 @@ static PetscErrorCode EPSSolve_Lanczos(EPS eps)
     for (i=nconv;i<n;i++)
       anorm = PetscMax(anorm,PetscAbsReal(PetscRealPart(ritz[i])));
 
-    /* Compute residual norm estimates as beta*abs(Y(m,:)) + eps*||A|| */
+    /* Compute residual norm estimates as beta*abs(Y(m,:)) + eps*||A||;
+       with blocks, the residual involves the last bs rows of Y */
     PetscCall(DSGetArray(eps->ds,DS_MAT_Q,&Y));
     for (i=nconv;i<n;i++) {
-      resnorm = beta*PetscAbsScalar(Y[n-1+i*ld]) + PETSC_MACHINE_EPSILON*anorm;
+      if (lanczos->bs>1) {
+        rtmp = 0.0;
+        for (j=0;j<PetscMin(lanczos->bs,n-nconv);j++) rtmp += PetscAbsScalar(Y[n-1-j+i*ld])*PetscAbsScalar(Y[n-1-j+i*ld]);
+        resnorm = beta*PetscSqrtReal(rtmp) + PETSC_MACHINE_EPSILON*anorm;
+      } else resnorm = beta*PetscAbsScalar(Y[n-1+i*ld]) + PETSC_MACHINE_EPSILON*anorm;
       PetscCall((*eps->converged)(eps,ritz[i],eps->eigi[i],resnorm,&bnd[i],eps->convergedctx));
       if (bnd[i]<eps->tol) conv[i] = 'C';
       else conv[i] = 'N';
@@ -698,7 +881,8 @@ static PetscErrorCode EPSSolve_Lanczos(EPS eps)
 static PetscErrorCode EPSSetFromOptions_Lanczos(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
   EPS_LANCZOS            *lanczos = (EPS_LANCZOS*)eps->data;
-  PetscBool              flg;
+  PetscBool              flg,flg2;
+  PetscInt               bs,w,s;
   EPSLanczosReorthogType reorthog=EPS_LANCZOS_REORTHOG_LOCAL,curval;
 
   PetscFunctionBegin;
@@ -708,6 +892,15 @@ static PetscErrorCode EPSSetFromOptions_Lanczos(EPS eps,PetscOptionItems *PetscO
     PetscCall(PetscOptionsEnum("-eps_lanczos_reorthog","Lanczos reorthogonalization","EPSLanczosSetReorthog",EPSLanczosReorthogTypes,(PetscEnum)curval,(PetscEnum*)&reorthog,&flg));
     if (flg) PetscCall(EPSLanczosSetReorthog(eps,reorthog));
 
+    PetscCall(PetscOptionsInt("-eps_lanczos_blocksize","Block size for the block-Lanczos variant","EPSLanczosSetBlockSize",lanczos->bs,&bs,&flg));
+    if (flg) PetscCall(EPSLanczosSetBlockSize(eps,bs));
+
+    w = lanczos->window;
+    s = lanczos->sketch;
+    PetscCall(PetscOptionsInt("-eps_lanczos_window_size","Number of recent vectors in the sliding-window variant","EPSLanczosSetWindow",w,&w,&flg));
+    PetscCall(PetscOptionsInt("-eps_lanczos_sketch_size","Number of sketch vectors in the sliding-window variant","EPSLanczosSetWindow",s,&s,&flg2));
+    if (flg || flg2) PetscCall(EPSLanczosSetWindow(eps,w,s));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -724,6 +917,7 @@ static PetscErrorCode EPSLanczosSetReorthog_Lanczos(EPS eps,EPSLanczosReorthogTy
     case EPS_LANCZOS_REORTHOG_SELECTIVE:
     case EPS_LANCZOS_REORTHOG_PERIODIC:
     case EPS_LANCZOS_REORTHOG_PARTIAL:
+    case EPS_LANCZOS_REORTHOG_WINDOW:
       if (lanczos->reorthog != reorthog) {
         lanczos->reorthog = reorthog;
         eps->state = EPS_STATE_INITIAL;
@@ -796,12 +990,189 @@ PetscErrorCode EPSLanczosGetReorthog(EPS eps,EPSLanczosReorthogType *reorthog)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSLanczosSetBlockSize_Lanczos(EPS eps,PetscInt bs)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  if (bs==PETSC_DEFAULT || bs==PETSC_DECIDE) bs = 1;
+  PetscCheck(bs>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The block size must be at least 1");
+  if (lanczos->bs != bs) {
+    lanczos->bs = bs;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosSetBlockSize - Sets the block size to be used in the block-Lanczos
+   variant of the Lanczos iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  bs  - the block size
+
+   Options Database Key:
+.  -eps_lanczos_blocksize - Sets the block size
+
+   Notes:
+   The default is a block size of 1, that is, the standard single-vector
+   Lanczos iteration. A block size larger than 1 expands the subspace with
+   blocks of bs vectors, with the initial block completed with random
+   directions, which makes it possible to resolve clusters of up to bs
+   (nearly) degenerate eigenvalues in a single sweep.
+
+   The block variant requires full reorthogonalization, see
+   EPSLanczosSetReorthog(). Typical values are in the range 4-16.
+
+   Level: advanced
+
+.seealso: EPSLanczosGetBlockSize(), EPSLanczosSetReorthog()
+@*/
+PetscErrorCode EPSLanczosSetBlockSize(EPS eps,PetscInt bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,bs,2);
+  PetscTryMethod(eps,"EPSLanczosSetBlockSize_C",(EPS,PetscInt),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLanczosGetBlockSize_Lanczos(EPS eps,PetscInt *bs)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  *bs = lanczos->bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosGetBlockSize - Gets the block size used in the block-Lanczos
+   variant of the Lanczos iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  bs - the block size
+
+   Level: advanced
+
+.seealso: EPSLanczosSetBlockSize()
+@*/
+PetscErrorCode EPSLanczosGetBlockSize(EPS eps,PetscInt *bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(bs,2);
+  PetscUseMethod(eps,"EPSLanczosGetBlockSize_C",(EPS,PetscInt*),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLanczosSetWindow_Lanczos(EPS eps,PetscInt w,PetscInt s)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  if (w==PETSC_DEFAULT || w==PETSC_DECIDE) w = 4;
+  if (s==PETSC_DEFAULT || s==PETSC_DECIDE) s = 4;
+  PetscCheck(w>=2,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The window size must be at least 2");
+  PetscCheck(s>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The sketch size must be nonnegative");
+  if (lanczos->window != w || lanczos->sketch != s) {
+    lanczos->window = w;
+    lanczos->sketch = s;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosSetWindow - Sets the window and sketch sizes to be used in the
+   sliding-window variant of the Lanczos iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+.  w   - number of recent basis vectors kept in the window
+-  s   - number of sketch vectors summarizing the older basis
+
+   Options Database Keys:
++  -eps_lanczos_window_size - Sets the window size
+-  -eps_lanczos_sketch_size - Sets the sketch size
+
+   Notes:
+   These parameters are relevant only when the reorthogonalization type has
+   been set to EPS_LANCZOS_REORTHOG_WINDOW with EPSLanczosSetReorthog(). At
+   each step, the new Lanczos vector is orthogonalized against the last w
+   basis vectors, and additionally purged of its components along s sketch
+   vectors built via random projection of the vectors that have left the
+   window. The per-step cost is O(w+s) inner products, independently of the
+   basis size. Larger values improve the suppression of ghost eigenvalues
+   at a higher cost. A sketch size of 0 disables the sketch, leaving plain
+   window orthogonalization. The default is w=4, s=4.
+
+   Level: advanced
+
+.seealso: EPSLanczosGetWindow(), EPSLanczosSetReorthog()
+@*/
+PetscErrorCode EPSLanczosSetWindow(EPS eps,PetscInt w,PetscInt s)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,w,2);
+  PetscValidLogicalCollectiveInt(eps,s,3);
+  PetscTryMethod(eps,"EPSLanczosSetWindow_C",(EPS,PetscInt,PetscInt),(eps,w,s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLanczosGetWindow_Lanczos(EPS eps,PetscInt *w,PetscInt *s)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  if (w) *w = lanczos->window;
+  if (s) *s = lanczos->sketch;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosGetWindow - Gets the window and sketch sizes used in the
+   sliding-window variant of the Lanczos iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  w - number of recent basis vectors kept in the window
+-  s - number of sketch vectors summarizing the older basis
+
+   Level: advanced
+
+.seealso: EPSLanczosSetWindow()
+@*/
+PetscErrorCode EPSLanczosGetWindow(EPS eps,PetscInt *w,PetscInt *s)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSLanczosGetWindow_C",(EPS,PetscInt*,PetscInt*),(eps,w,s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSReset_Lanczos(EPS eps)
 {
   EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
 
   PetscFunctionBegin;
   PetscCall(BVDestroy(&lanczos->AV));
+  PetscCall(BVDestroy(&lanczos->S));
   lanczos->allocsize = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -812,6 +1183,10 @@ static PetscErrorCode EPSDestroy_Lanczos(EPS eps)
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetReorthog_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetReorthog_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetWindow_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetWindow_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -824,6 +1199,8 @@ static PetscErrorCode EPSView_Lanczos(EPS eps,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     if (lanczos->reorthog != (EPSLanczosReorthogType)-1) PetscCall(PetscViewerASCIIPrintf(viewer,"  %s reorthogonalization\n",EPSLanczosReorthogTypes[lanczos->reorthog]));
+    if (lanczos->bs>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  block-Lanczos variant with block size %" PetscInt_FMT "\n",lanczos->bs));
+    if (lanczos->reorthog==EPS_LANCZOS_REORTHOG_WINDOW) PetscCall(PetscViewerASCIIPrintf(viewer,"  window size %" PetscInt_FMT ", sketch size %" PetscInt_FMT "\n",lanczos->window,lanczos->sketch));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -836,6 +1213,9 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Lanczos(EPS eps)
   PetscCall(PetscNew(&ctx));
   eps->data = (void*)ctx;
   ctx->reorthog = (EPSLanczosReorthogType)-1;
+  ctx->bs       = 1;
+  ctx->window   = 4;
+  ctx->sketch   = 4;
 
   eps->useds = PETSC_TRUE;
 
@@ -851,5 +1231,9 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Lanczos(EPS eps)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetReorthog_C",EPSLanczosSetReorthog_Lanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetReorthog_C",EPSLanczosGetReorthog_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetBlockSize_C",EPSLanczosSetBlockSize_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetBlockSize_C",EPSLanczosGetBlockSize_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetWindow_C",EPSLanczosSetWindow_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetWindow_C",EPSLanczosGetWindow_Lanczos));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
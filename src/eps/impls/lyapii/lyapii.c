@@ -31,10 +31,11 @@
 #include <slepcblaslapack.h>
 
 typedef struct {
-  LME      lme;      /* Lyapunov solver */
-  DS       ds;       /* used to compute the SVD for compression */
-  PetscInt rkl;      /* prescribed rank for the Lyapunov solver */
-  PetscInt rkc;      /* the compressed rank, cannot be larger than rkl */
+  LME       lme;      /* Lyapunov solver */
+  DS        ds;       /* used to compute the SVD for compression */
+  PetscInt  rkl;      /* prescribed rank for the Lyapunov solver */
+  PetscInt  rkc;      /* the compressed rank, cannot be larger than rkl */
+  PetscBool adapt;    /* whether the rank of the Lyapunov solver is adapted */
 } EPS_LYAPII;
 
 typedef struct {
@@ -342,8 +343,10 @@ static PetscErrorCode EPSSolve_LyapII(EPS eps)
   PetscCall(BVSetOrthogonalization(V,type,refine,eta,BV_ORTHOG_BLOCK_TSQR));
   PetscCall(MatCreateDense(PetscObjectComm((PetscObject)eps),eps->nloc,PETSC_DECIDE,PETSC_DECIDE,1,NULL,&Ux[0]));
   PetscCall(MatCreateDense(PetscObjectComm((PetscObject)eps),eps->nloc,PETSC_DECIDE,PETSC_DECIDE,2,NULL,&Ux[1]));
-  nv = ctx->rkl;
-  PetscCall(PetscMalloc1(nv,&s));
+  /* with rank adaptivity, start with a small working rank and let the
+     singular value decay of the computed factor drive it up if needed */
+  nv = ctx->adapt? PetscMin(ctx->rkc,ctx->rkl): ctx->rkl;
+  PetscCall(PetscMalloc1(ctx->rkl,&s));
 
   /* Initialize first column */
   PetscCall(EPSGetStartVector(eps,0,NULL));
@@ -392,6 +395,14 @@ static PetscErrorCode EPSSolve_LyapII(EPS eps)
     rk = nv;
     for (i=1;i<nv;i++) if (PetscAbsScalar(s[i]/s[0])<PETSC_SQRT_MACHINE_EPSILON) {rk=i; break;}
     PetscCall(PetscInfo(eps,"The computed solution of the Lyapunov equation has rank %" PetscInt_FMT "\n",rk));
+    if (ctx->adapt) {
+      /* adjust the working rank of the next Lyapunov solve: grow it if no
+         decay was observed in the trailing singular values, otherwise shrink
+         it to the numerical rank plus a small safety margin */
+      if (rk==nv) nv = PetscMin(2*nv,ctx->rkl);
+      else nv = PetscMax(PetscMin(rk+2,ctx->rkl),ctx->rkc);
+      PetscCall(PetscInfo(eps,"Working rank for the next Lyapunov solve set to %" PetscInt_FMT "\n",nv));
+    }
     rk = PetscMin(rk,ctx->rkc);
     PetscCall(DSGetMat(ctx->ds,DS_MAT_U,&U));
     PetscCall(BVMultInPlace(V,U,0,rk));
@@ -528,7 +539,7 @@ static PetscErrorCode EPSSetFromOptions_LyapII(EPS eps,PetscOptionItems *PetscOp
 {
   EPS_LYAPII     *ctx = (EPS_LYAPII*)eps->data;
   PetscInt       k,array[2]={PETSC_DEFAULT,PETSC_DEFAULT};
-  PetscBool      flg;
+  PetscBool      flg,val;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject,"EPS Lyapunov Inverse Iteration Options");
@@ -537,6 +548,9 @@ static PetscErrorCode EPSSetFromOptions_LyapII(EPS eps,PetscOptionItems *PetscOp
     PetscCall(PetscOptionsIntArray("-eps_lyapii_ranks","Ranks for Lyapunov equation (one or two comma-separated integers)","EPSLyapIISetRanks",array,&k,&flg));
     if (flg) PetscCall(EPSLyapIISetRanks(eps,array[0],array[1]));
 
+    PetscCall(PetscOptionsBool("-eps_lyapii_rank_adaptive","Adapt the rank of the Lyapunov solver during the iteration","EPSLyapIISetRankAdaptive",ctx->adapt,&val,&flg));
+    if (flg) PetscCall(EPSLyapIISetRankAdaptive(eps,val));
+
   PetscOptionsHeadEnd();
 
   if (!ctx->lme) PetscCall(EPSLyapIIGetLME(eps,&ctx->lme));
@@ -632,6 +646,86 @@ PetscErrorCode EPSLyapIIGetRanks(EPS eps,PetscInt *rkc,PetscInt *rkl)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSLyapIISetRankAdaptive_LyapII(EPS eps,PetscBool adapt)
+{
+  EPS_LYAPII *ctx = (EPS_LYAPII*)eps->data;
+
+  PetscFunctionBegin;
+  if (ctx->adapt != adapt) {
+    ctx->adapt = adapt;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLyapIISetRankAdaptive - Toggle the rank adaptivity of the Lyapunov solver.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  adapt - boolean flag to activate rank adaptivity
+
+   Options Database Key:
+.  -eps_lyapii_rank_adaptive <bool> - Toggles the rank adaptivity
+
+   Notes:
+   When rank adaptivity is activated, the rank used in the solution of the
+   Lyapunov equation is no longer fixed to the value rkl set with
+   EPSLyapIISetRanks(), which then acts as an upper bound. Instead, the rank
+   starts at the compressed rank and is adjusted at every outer iteration
+   according to the decay of the trailing singular values of the computed
+   low-rank factor. This usually saves a considerable amount of work in the
+   first iterations, where a small rank is sufficient.
+
+   Level: advanced
+
+.seealso: EPSLyapIIGetRankAdaptive(), EPSLyapIISetRanks()
+@*/
+PetscErrorCode EPSLyapIISetRankAdaptive(EPS eps,PetscBool adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,adapt,2);
+  PetscTryMethod(eps,"EPSLyapIISetRankAdaptive_C",(EPS,PetscBool),(eps,adapt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLyapIIGetRankAdaptive_LyapII(EPS eps,PetscBool *adapt)
+{
+  EPS_LYAPII *ctx = (EPS_LYAPII*)eps->data;
+
+  PetscFunctionBegin;
+  *adapt = ctx->adapt;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLyapIIGetRankAdaptive - Return the flag indicating if rank adaptivity
+   is being used in the Lyapunov solver.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  adapt - the rank adaptivity flag
+
+   Level: advanced
+
+.seealso: EPSLyapIISetRankAdaptive()
+@*/
+PetscErrorCode EPSLyapIIGetRankAdaptive(EPS eps,PetscBool *adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(adapt,2);
+  PetscUseMethod(eps,"EPSLyapIIGetRankAdaptive_C",(EPS,PetscBool*),(eps,adapt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSLyapIISetLME_LyapII(EPS eps,LME lme)
 {
   EPS_LYAPII     *ctx = (EPS_LYAPII*)eps->data;
@@ -717,6 +811,7 @@ static PetscErrorCode EPSView_LyapII(EPS eps,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer,"  ranks: for Lyapunov solver=%" PetscInt_FMT ", after compression=%" PetscInt_FMT "\n",ctx->rkl,ctx->rkc));
+    if (ctx->adapt) PetscCall(PetscViewerASCIIPrintf(viewer,"  adapting the rank of the Lyapunov solver during the iteration\n"));
     if (!ctx->lme) PetscCall(EPSLyapIIGetLME(eps,&ctx->lme));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(LMEView(ctx->lme,viewer));
@@ -746,6 +841,8 @@ static PetscErrorCode EPSDestroy_LyapII(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetLME_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIISetRanks_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetRanks_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIISetRankAdaptive_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetRankAdaptive_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -781,5 +878,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_LyapII(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetLME_C",EPSLyapIIGetLME_LyapII));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIISetRanks_C",EPSLyapIISetRanks_LyapII));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetRanks_C",EPSLyapIIGetRanks_LyapII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIISetRankAdaptive_C",EPSLyapIISetRankAdaptive_LyapII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLyapIIGetRankAdaptive_C",EPSLyapIIGetRankAdaptive_LyapII));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -45,6 +45,7 @@ typedef struct {
   PetscBool         nonlinear;
   PetscBool         update;
   PetscBool         sign_normalization;
+  PetscInt          jlag; /* reuse the Jacobian (and its factorization) for jlag iterations */
   SNES              snes;
   PetscErrorCode    (*formFunctionB)(SNES,Vec,Vec,void*);
   void              *formFunctionBctx;
@@ -76,6 +77,7 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
   STMatMode      mode;
   Mat            A,B,P;
   Vec            res;
+  PetscInt       nloc,mloc;
   PetscContainer container;
   PetscErrorCode (*formFunctionA)(SNES,Vec,Vec,void*);
   PetscErrorCode (*formJacobianA)(SNES,Vec,Mat,Mat,void*);
@@ -110,17 +112,25 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
     PetscCall(EPSSetWorkVecs(eps,3));
     PetscCheck(!power->update || eps->max_it==1,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"More than one iteration is not allowed for Newton eigensolver (SNES)");
 
+    PetscCall(EPSGetOperators(eps,&A,&B));
+
     /* Set up SNES solver */
-    /* If SNES was setup, we need to reset it so that it will be consistent with the current EPS */
-    if (power->snes) PetscCall(SNESReset(power->snes));
-    else PetscCall(EPSPowerGetSNES(eps,&power->snes));
+    /* If SNES was setup for different operators, we need to reset it so that it will be
+       consistent with the current EPS; otherwise keep the SNES (and its KSP/PC) intact,
+       so that repeated solves within e.g. a time-stepping loop reuse the setup */
+    if (power->snes) {
+      PetscCall(SNESGetFunction(power->snes,&res,NULL,NULL));
+      if (res) {
+        PetscCall(VecGetLocalSize(res,&nloc));
+        PetscCall(MatGetLocalSize(A,&mloc,NULL));
+        if (nloc != mloc) PetscCall(SNESReset(power->snes));
+      }
+    } else PetscCall(EPSPowerGetSNES(eps,&power->snes));
 
     /* For nonlinear solver (Newton), we should scale the initial vector back.
        The initial vector will be scaled in EPSSetUp. */
     if (eps->IS) PetscCall(VecNorm((eps->IS)[0],NORM_2,&power->norm0));
 
-    PetscCall(EPSGetOperators(eps,&A,&B));
-
     /* form function */
     PetscCall(PetscObjectQueryFunction((PetscObject)A,"formFunction",&formFunctionA));
     PetscCheck(formFunctionA,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER,"For nonlinear inverse iteration you must compose a callback function 'formFunction' in matrix A");
@@ -151,6 +161,13 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
     /* If users do not provide a matrix, we simply use A */
     PetscCall(SNESSetJacobian(power->snes,A,P? P:A,formJacobianA,ctx));
     PetscCall(SNESSetFromOptions(power->snes));
+    if (power->jlag > 1) {
+      /* freeze the Jacobian (and hence its factorization) for jlag iterations */
+      PetscCall(SNESSetLagJacobian(power->snes,power->jlag));
+      PetscCall(SNESSetLagJacobianPersists(power->snes,PETSC_TRUE));
+      PetscCall(SNESSetLagPreconditioner(power->snes,power->jlag));
+      PetscCall(SNESSetLagPreconditionerPersists(power->snes,PETSC_TRUE));
+    }
     PetscCall(SNESSetUp(power->snes));
 
     ctx = NULL;
@@ -300,15 +317,26 @@ static PetscErrorCode EPSPowerFormFunction_Update(SNES snes,Vec x,Vec y,void *ct
 */
 static PetscErrorCode EPSPowerApply_SNES(EPS eps,Vec x,Vec y)
 {
-  EPS_POWER      *power = (EPS_POWER*)eps->data;
-  Vec            Bx;
+  EPS_POWER           *power = (EPS_POWER*)eps->data;
+  Vec                 Bx;
+  SNESConvergedReason reason;
 
   PetscFunctionBegin;
   PetscCall(VecCopy(x,y));
-  if (power->update) PetscCall(SNESSolve(power->snes,NULL,y));
-  else {
-    Bx = eps->work[2];
-    PetscCall(SNESSolve(power->snes,Bx,y));
+  Bx = power->update? NULL: eps->work[2];
+  PetscCall(SNESSolve(power->snes,Bx,y));
+  if (power->jlag > 1) {
+    /* if the lagged Jacobian is too stale the SNES may diverge; rebuild it and retry once */
+    PetscCall(SNESGetConvergedReason(power->snes,&reason));
+    if (reason < 0) {
+      PetscCall(PetscInfo(eps,"SNES diverged with lagged Jacobian (reason=%s), retrying with a fresh Jacobian\n",SNESConvergedReasons[reason]));
+      PetscCall(SNESSetLagJacobian(power->snes,1));
+      PetscCall(SNESSetLagPreconditioner(power->snes,1));
+      PetscCall(VecCopy(x,y));
+      PetscCall(SNESSolve(power->snes,Bx,y));
+      PetscCall(SNESSetLagJacobian(power->snes,power->jlag));
+      PetscCall(SNESSetLagPreconditioner(power->snes,power->jlag));
+    }
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -437,6 +465,9 @@ static PetscErrorCode EPSSolve_Power(EPS eps)
         PetscCall(Normalize(Bx,norm,power->idx,power->p,power->sign_normalization,&sign));
       }
     } else {
+      /* with the default classical Gram-Schmidt this projects against all
+         locked columns at once, with a single BVDotVec/BVMultVec pair per
+         refinement pass regardless of the number of converged vectors */
       PetscCall(DSGetArray(eps->ds,DS_MAT_A,&T));
       PetscCall(BVSetActiveColumns(eps->V,0,k));
       PetscCall(BVOrthogonalizeVec(eps->V,y,T+k*ld,&norm,NULL));
@@ -731,6 +762,7 @@ static PetscErrorCode EPSSetFromOptions_Power(EPS eps,PetscOptionItems *PetscOpt
 {
   EPS_POWER         *power = (EPS_POWER*)eps->data;
   PetscBool         flg,val;
+  PetscInt          lag;
   EPSPowerShiftType shift;
 
   PetscFunctionBegin;
@@ -745,6 +777,9 @@ static PetscErrorCode EPSSetFromOptions_Power(EPS eps,PetscOptionItems *PetscOpt
     PetscCall(PetscOptionsBool("-eps_power_update","Update residual monolithically","EPSPowerSetUpdate",power->update,&val,&flg));
     if (flg) PetscCall(EPSPowerSetUpdate(eps,val));
 
+    PetscCall(PetscOptionsInt("-eps_power_jacobian_lag","Number of iterations the Jacobian is reused in nonlinear inverse iteration","EPSPowerSetJacobianLag",power->jlag,&lag,&flg));
+    if (flg) PetscCall(EPSPowerSetJacobianLag(eps,lag));
+
     PetscCall(PetscOptionsBool("-eps_power_sign_normalization","Normalize Bx with sign of first nonzero entry","EPSPowerSetSignNormalization",power->sign_normalization,&power->sign_normalization,&flg));
 
   PetscOptionsHeadEnd();
@@ -999,6 +1034,88 @@ PetscErrorCode EPSPowerGetUpdate(EPS eps,PetscBool *update)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSPowerSetJacobianLag_Power(EPS eps,PetscInt lag)
+{
+  EPS_POWER *power = (EPS_POWER*)eps->data;
+
+  PetscFunctionBegin;
+  if (lag==PETSC_DEFAULT || lag==PETSC_DECIDE) lag = 1;
+  PetscCheck(lag>=1,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The lag must be at least 1");
+  if (power->jlag != lag) {
+    power->jlag = lag;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSPowerSetJacobianLag - Sets the number of iterations the Jacobian (and hence
+   its factorization) is reused in nonlinear inverse iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  lag - number of iterations the Jacobian is frozen
+
+   Options Database Key:
+.  -eps_power_jacobian_lag - Sets the lag value
+
+   Notes:
+   A lag larger than 1 avoids rebuilding (and refactoring) the Jacobian at every
+   nonlinear iteration, at the cost of using a stale Jacobian in between. If the
+   inner SNES diverges with the lagged Jacobian, a fresh Jacobian is built and
+   the solve is retried automatically.
+
+   The default is 1, that is, the Jacobian is rebuilt at every iteration.
+
+   Level: advanced
+
+.seealso: EPSPowerSetNonlinear(), EPSPowerGetJacobianLag()
+@*/
+PetscErrorCode EPSPowerSetJacobianLag(EPS eps,PetscInt lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,lag,2);
+  PetscTryMethod(eps,"EPSPowerSetJacobianLag_C",(EPS,PetscInt),(eps,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSPowerGetJacobianLag_Power(EPS eps,PetscInt *lag)
+{
+  EPS_POWER *power = (EPS_POWER*)eps->data;
+
+  PetscFunctionBegin;
+  *lag = power->jlag;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSPowerGetJacobianLag - Returns the number of iterations the Jacobian is
+   reused in nonlinear inverse iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  lag - number of iterations the Jacobian is frozen
+
+   Level: advanced
+
+.seealso: EPSPowerSetJacobianLag()
+@*/
+PetscErrorCode EPSPowerGetJacobianLag(EPS eps,PetscInt *lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(lag,2);
+  PetscUseMethod(eps,"EPSPowerGetJacobianLag_C",(EPS,PetscInt*),(eps,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSPowerSetSignNormalization_Power(EPS eps,PetscBool sign_normalization)
 {
   EPS_POWER *power = (EPS_POWER*)eps->data;
@@ -1172,6 +1289,8 @@ static PetscErrorCode EPSDestroy_Power(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetNonlinear_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetUpdate_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetUpdate_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetJacobianLag_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetJacobianLag_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSignNormalization_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSignNormalization_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSNES_C",NULL));
@@ -1192,6 +1311,7 @@ static PetscErrorCode EPSView_Power(EPS eps,PetscViewer viewer)
       else PetscCall(PetscViewerASCIIPrintf(viewer,"  not normalizing Bx by the sign of the first nonzero element\n"));
       PetscCall(PetscViewerASCIIPrintf(viewer,"  using nonlinear inverse iteration\n"));
       if (power->update) PetscCall(PetscViewerASCIIPrintf(viewer,"  updating the residual monolithically\n"));
+      if (power->jlag > 1) PetscCall(PetscViewerASCIIPrintf(viewer,"  reusing the Jacobian for %" PetscInt_FMT " iterations\n",power->jlag));
       if (!power->snes) PetscCall(EPSPowerGetSNES(eps,&power->snes));
       PetscCall(PetscViewerASCIIPushTab(viewer));
       PetscCall(SNESView(power->snes,viewer));
@@ -1256,6 +1376,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Power(EPS eps)
   eps->ops->setdefaultst   = EPSSetDefaultST_Power;
   eps->stopping            = EPSStopping_Power;
   ctx->sign_normalization  = PETSC_TRUE;
+  ctx->jlag                = 1;
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetShiftType_C",EPSPowerSetShiftType_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetShiftType_C",EPSPowerGetShiftType_Power));
@@ -1263,6 +1384,8 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Power(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetNonlinear_C",EPSPowerGetNonlinear_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetUpdate_C",EPSPowerSetUpdate_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetUpdate_C",EPSPowerGetUpdate_Power));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetJacobianLag_C",EPSPowerSetJacobianLag_Power));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetJacobianLag_C",EPSPowerGetJacobianLag_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSignNormalization_C",EPSPowerSetSignNormalization_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSignNormalization_C",EPSPowerGetSignNormalization_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSNES_C",EPSPowerSetSNES_Power));
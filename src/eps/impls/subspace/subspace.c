@@ -27,6 +27,7 @@
 
 typedef struct {
   PetscBool estimatedrange;     /* the filter range was not set by the user */
+  PetscBool cheb;               /* accelerate the block updates with Chebyshev polynomials */
 } EPS_SUBSPACE;
 
 static PetscErrorCode EPSSetUp_Subspace_Filter(EPS eps)
@@ -61,10 +62,15 @@ static PetscErrorCode EPSSetUp_Subspace_Filter(EPS eps)
 
 static PetscErrorCode EPSSetUp_Subspace(EPS eps)
 {
-  PetscBool isfilt;
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool    isfilt;
 
   PetscFunctionBegin;
   EPSCheckDefinite(eps);
+  if (ctx->cheb) {
+    EPSCheckHermitianCondition(eps,PETSC_TRUE," with Chebyshev acceleration");
+    PetscCheck(eps->which!=EPS_ALL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Chebyshev acceleration cannot be combined with polynomial filtering");
+  }
   if (eps->max_it==PETSC_DEFAULT) eps->max_it = PetscMax(100,2*eps->n/eps->ncv);
   if (!eps->which) PetscCall(EPSSetWhichEigenpairs_Default(eps));
   if (eps->which==EPS_ALL) {
@@ -177,12 +183,13 @@ static PetscErrorCode EPSSubspaceResidualNorms(BV R,BV V,Mat T,PetscInt l,PetscI
 
 static PetscErrorCode EPSSolve_Subspace(EPS eps)
 {
+  EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
   Mat            H,Q,S,T,B;
-  BV             AV,R;
-  PetscBool      indef;
+  BV             AV,R,Z=NULL;
+  PetscBool      indef,first;
   PetscInt       i,k,ld,ngrp,nogrp,*itrsd,*itrsdold;
   PetscInt       nxtsrr,idsrr,idort,nxtort,nv,ncv = eps->ncv,its,ninside;
-  PetscReal      arsd,oarsd,ctr,octr,ae,oae,*rsd,*orsd,tcond=1.0,gamma;
+  PetscReal      arsd,oarsd,ctr,octr,ae,oae,*rsd,*orsd,tcond=1.0,gamma,e=0.0;
   PetscScalar    *oeigr,*oeigi;
   /* Parameters */
   PetscInt       init = 5;        /* Number of initial iterations */
@@ -200,6 +207,7 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
   PetscCall(BVDuplicate(eps->V,&AV));
   PetscCall(BVDuplicate(eps->V,&R));
+  if (ctx->cheb) PetscCall(BVDuplicate(eps->V,&Z));
   PetscCall(STGetOperator(eps->st,&S));
 
   for (i=0;i<ncv;i++) {
@@ -240,6 +248,8 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
     PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
     PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
     PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
+    /* the smallest retained Ritz value bounds the unwanted part of the spectrum */
+    if (ctx->cheb) e = SlepcAbsEigenvalue(eps->eigr[nv-1],eps->eigi[nv-1]);
 
     /* Update vectors V(:,idx) = V * U(:,idx) */
     PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
@@ -306,6 +316,7 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
     /* V(:,idx) = AV(:,idx) */
     PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
     PetscCall(BVSetActiveColumns(AV,eps->nconv,nv));
+    if (ctx->cheb) PetscCall(BVSetActiveColumns(Z,eps->nconv,nv));
     PetscCall(BVCopy(AV,eps->V));
     its++;
 
@@ -313,11 +324,27 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
     do {
       PetscCall(BVGetMatrix(eps->V,&B,&indef));
       PetscCall(BVSetMatrix(eps->V,NULL,PETSC_FALSE));
+      first = PETSC_TRUE;
       while (its<nxtort) {
-        /* A(:,idx) = OP*V(:,idx) with normalization */
-        PetscCall(BVMatMult(eps->V,S,AV));
-        PetscCall(BVCopy(AV,eps->V));
-        PetscCall(BVNormalize(eps->V,NULL));
+        if (ctx->cheb && e>0.0) {
+          /* Chebyshev recurrence z_new = (2/e)*OP*z - z_old, damping [-e,e];
+             normalization is deferred to the orthogonalization step */
+          PetscCall(BVMatMult(eps->V,S,AV));
+          if (first) {
+            PetscCall(BVScale(AV,1.0/e));
+            first = PETSC_FALSE;
+          } else {
+            PetscCall(BVScale(AV,2.0/e));
+            PetscCall(BVMult(AV,-1.0,1.0,Z,NULL));
+          }
+          PetscCall(BVCopy(eps->V,Z));
+          PetscCall(BVCopy(AV,eps->V));
+        } else {
+          /* A(:,idx) = OP*V(:,idx) with normalization */
+          PetscCall(BVMatMult(eps->V,S,AV));
+          PetscCall(BVCopy(AV,eps->V));
+          PetscCall(BVNormalize(eps->V,NULL));
+        }
         its++;
       }
       PetscCall(BVSetMatrix(eps->V,B,indef));
@@ -330,15 +357,128 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
   PetscCall(PetscFree6(rsd,orsd,oeigr,oeigi,itrsd,itrsdold));
   PetscCall(BVDestroy(&AV));
   PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&Z));
   PetscCall(STRestoreOperator(eps->st,&S));
   PetscCall(DSTruncate(eps->ds,eps->nconv,PETSC_TRUE));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSSetFromOptions_Subspace(EPS eps,PetscOptionItems *PetscOptionsObject)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool    flg,val;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"EPS Subspace Iteration Options");
+
+    PetscCall(PetscOptionsBool("-eps_subspace_chebyshev","Accelerate the block updates with Chebyshev polynomials","EPSSubspaceSetChebyshev",ctx->cheb,&val,&flg));
+    if (flg) PetscCall(EPSSubspaceSetChebyshev(eps,val));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceSetChebyshev_Subspace(EPS eps,PetscBool cheb)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  if (ctx->cheb != cheb) {
+    ctx->cheb  = cheb;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceSetChebyshev - Toggle the Chebyshev acceleration of subspace
+   iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps  - the eigenproblem solver context
+-  cheb - boolean flag to activate the Chebyshev acceleration
+
+   Options Database Key:
+.  -eps_subspace_chebyshev <bool> - Toggles the Chebyshev acceleration
+
+   Notes:
+   When this flag is activated, the plain block updates performed between
+   Rayleigh-Ritz projection steps are replaced by a Chebyshev recurrence that
+   damps the interval containing the unwanted part of the spectrum, estimated
+   from the smallest retained Ritz value. This accelerates convergence and
+   hence reduces the number of projection steps, at no extra cost in matrix-
+   vector products.
+
+   This acceleration is available only for Hermitian problems, and cannot be
+   combined with polynomial filtering (computational intervals), where the
+   operator is already a polynomial in the matrix.
+
+   Level: advanced
+
+.seealso: EPSSubspaceGetChebyshev()
+@*/
+PetscErrorCode EPSSubspaceSetChebyshev(EPS eps,PetscBool cheb)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,cheb,2);
+  PetscTryMethod(eps,"EPSSubspaceSetChebyshev_C",(EPS,PetscBool),(eps,cheb));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceGetChebyshev_Subspace(EPS eps,PetscBool *cheb)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  *cheb = ctx->cheb;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceGetChebyshev - Return the flag indicating if Chebyshev
+   acceleration is being used in subspace iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  cheb - the Chebyshev acceleration flag
+
+   Level: advanced
+
+.seealso: EPSSubspaceSetChebyshev()
+@*/
+PetscErrorCode EPSSubspaceGetChebyshev(EPS eps,PetscBool *cheb)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(cheb,2);
+  PetscUseMethod(eps,"EPSSubspaceGetChebyshev_C",(EPS,PetscBool*),(eps,cheb));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSView_Subspace(EPS eps,PetscViewer viewer)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool    isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii && ctx->cheb) PetscCall(PetscViewerASCIIPrintf(viewer,"  using Chebyshev acceleration for the block updates\n"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSDestroy_Subspace(EPS eps)
 {
   PetscFunctionBegin;
   PetscCall(PetscFree(eps->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshev_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshev_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -356,8 +496,13 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Subspace(EPS eps)
   eps->ops->solve          = EPSSolve_Subspace;
   eps->ops->setup          = EPSSetUp_Subspace;
   eps->ops->setupsort      = EPSSetUpSort_Subspace;
+  eps->ops->setfromoptions = EPSSetFromOptions_Subspace;
   eps->ops->destroy        = EPSDestroy_Subspace;
+  eps->ops->view           = EPSView_Subspace;
   eps->ops->backtransform  = EPSBackTransform_Default;
   eps->ops->computevectors = EPSComputeVectors_Schur;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshev_C",EPSSubspaceSetChebyshev_Subspace));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshev_C",EPSSubspaceGetChebyshev_Subspace));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
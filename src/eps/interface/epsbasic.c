@@ -77,6 +77,10 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->trackall        = PETSC_FALSE;
   eps->purify          = PETSC_TRUE;
   eps->twosided        = PETSC_FALSE;
+  eps->reuseprev       = PETSC_FALSE;
+  eps->nred            = 1;
+  eps->finispace       = 0;
+  eps->finideg         = 20;
 
   eps->converged       = EPSConvergedRelative;
   eps->convergeduser   = NULL;
@@ -85,9 +89,12 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->stoppinguser    = NULL;
   eps->stoppingdestroy = NULL;
   eps->arbitrary       = NULL;
+  eps->convergedhandler = NULL;
+  eps->convergedhandlerdestroy = NULL;
   eps->convergedctx    = NULL;
   eps->stoppingctx     = NULL;
   eps->arbitraryctx    = NULL;
+  eps->convergedhandlerctx = NULL;
   eps->numbermonitors  = 0;
 
   eps->st              = NULL;
@@ -107,15 +114,22 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->perm            = NULL;
   eps->nwork           = 0;
   eps->work            = NULL;
+  eps->pool            = NULL;
   eps->data            = NULL;
 
   eps->state           = EPS_STATE_INITIAL;
   eps->categ           = EPS_CATEGORY_KRYLOV;
   eps->nconv           = 0;
   eps->its             = 0;
+  eps->ondemand        = 0;
+  eps->shmstate        = NULL;
+  eps->shmid           = 0;
+  eps->vstream         = NULL;
+  eps->nviewed         = 0;
   eps->nloc            = 0;
   eps->nrma            = 0.0;
   eps->nrmb            = 0.0;
+  eps->balancedone     = PETSC_FALSE;
   eps->useds           = PETSC_FALSE;
   eps->isgeneralized   = PETSC_FALSE;
   eps->ispositive      = PETSC_FALSE;
@@ -312,6 +326,7 @@ PetscErrorCode EPSReset(EPS eps)
   PetscCall(BVDestroy(&eps->W));
   PetscCall(VecDestroyVecs(eps->nwork,&eps->work));
   eps->nwork = 0;
+  if (eps->pool) PetscCall(SlepcVecPoolDestroy(&eps->pool));
   eps->state = EPS_STATE_INITIAL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -347,7 +362,9 @@ PetscErrorCode EPSDestroy(EPS *eps)
   PetscCall(SlepcBasisDestroy_Private(&(*eps)->nini,&(*eps)->IS));
   PetscCall(SlepcBasisDestroy_Private(&(*eps)->ninil,&(*eps)->ISL));
   if ((*eps)->convergeddestroy) PetscCall((*(*eps)->convergeddestroy)((*eps)->convergedctx));
+  if ((*eps)->convergedhandlerdestroy) PetscCall((*(*eps)->convergedhandlerdestroy)((*eps)->convergedhandlerctx));
   PetscCall(EPSMonitorCancel(*eps));
+  PetscCall(EPSStateShmDetach(*eps));
   PetscCall(PetscHeaderDestroy(eps));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -382,6 +399,7 @@ PetscErrorCode EPSSetTarget(EPS eps,PetscScalar target)
   PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
   PetscValidLogicalCollectiveScalar(eps,target,2);
   eps->target = target;
+  eps->balancedone = PETSC_FALSE;  /* the balancing matrix depends on the shifted operator */
   if (!eps->st) PetscCall(EPSGetST(eps,&eps->st));
   PetscCall(STSetDefaultShift(eps->st,target));
   PetscFunctionReturn(PETSC_SUCCESS);
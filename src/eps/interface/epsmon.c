@@ -13,6 +13,54 @@
 
 #include <slepc/private/epsimpl.h>   /*I "slepceps.h" I*/
 #include <petscdraw.h>
+#if defined(PETSC_HAVE_SHMGET)
+#include <sys/shm.h>
+#endif
+
+/*
+   EPSStateShmSetUp - Map a small shared memory segment where the solver
+   publishes its state at every outer iteration. The segment of the process
+   with rank r is created with key+r, so an external sampler can attach with
+   shmget()/shmat() and inspect a running solve without any cooperation from
+   the solver process. The segment is removed when the EPS is destroyed.
+*/
+PetscErrorCode EPSStateShmSetUp(EPS eps,PetscInt key)
+{
+#if defined(PETSC_HAVE_SHMGET)
+  PetscMPIInt rank;
+  int         shmid;
+
+  PetscFunctionBegin;
+  if (eps->shmstate) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)eps),&rank));
+  shmid = shmget((key_t)(key+rank),sizeof(EPSStateShm),IPC_CREAT|0600);
+  PetscCheck(shmid!=-1,PETSC_COMM_SELF,PETSC_ERR_LIB,"Unable to create shared memory segment with key %" PetscInt_FMT,key+rank);
+  eps->shmstate = (EPSStateShm*)shmat(shmid,NULL,0);
+  PetscCheck(eps->shmstate!=(void*)-1,PETSC_COMM_SELF,PETSC_ERR_LIB,"Unable to attach shared memory segment with key %" PetscInt_FMT,key+rank);
+  eps->shmid = shmid;
+  PetscCall(PetscMemzero(eps->shmstate,sizeof(EPSStateShm)));
+  PetscFunctionReturn(PETSC_SUCCESS);
+#else
+  PetscFunctionBegin;
+  SETERRQ(PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The option -eps_state_shm requires a system with System V shared memory");
+#endif
+}
+
+/*
+   EPSStateShmDetach - Counterpart of EPSStateShmSetUp, called at EPSDestroy.
+*/
+PetscErrorCode EPSStateShmDetach(EPS eps)
+{
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_SHMGET)
+  if (eps->shmstate) {
+    (void)shmctl((int)eps->shmid,IPC_RMID,NULL);  /* removal completes on the last detach */
+    (void)shmdt(eps->shmstate);
+    eps->shmstate = NULL;
+  }
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 
 PetscErrorCode EPSMonitorLGCreate(MPI_Comm comm,const char host[],const char label[],const char metric[],PetscInt l,const char *names[],int x,int y,int m,int n,PetscDrawLG *lgctx)
 {
@@ -34,13 +82,24 @@ PetscErrorCode EPSMonitorLGCreate(MPI_Comm comm,const char host[],const char lab
 }
 
 /*
-   Runs the user provided monitor routines, if any.
+   Runs the user provided monitor routines, if any. It also passes the residual
+   estimate of the first unconverged eigenpair to the ST, since this is the
+   single point through which all solvers report per-iteration residuals.
 */
 PetscErrorCode EPSMonitor(EPS eps,PetscInt it,PetscInt nconv,PetscScalar *eigr,PetscScalar *eigi,PetscReal *errest,PetscInt nest)
 {
   PetscInt       i,n = eps->numbermonitors;
 
   PetscFunctionBegin;
+  if (PetscUnlikely(eps->shmstate)) {
+    /* plain aligned stores; a sampler may read a torn snapshot, which is harmless for monitoring */
+    eps->shmstate->state  = (PetscInt)eps->state;
+    eps->shmstate->its    = it;
+    eps->shmstate->nconv  = nconv;
+    eps->shmstate->errest = (nest>nconv)? errest[nconv]: 0.0;
+    eps->shmstate->seq++;
+  }
+  if (nest>nconv) PetscCall(STSetOuterTolerance(eps->st,errest[nconv]));
   for (i=0;i<n;i++) PetscCall((*eps->monitor[i])(eps,it,nconv,eigr,eigi,errest,nest,eps->monitorcontext[i]));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -48,6 +48,9 @@ PetscErrorCode EPSMonitorSetFromOptions(EPS eps,const char opt[],const char name
   PetscCall(PetscOptionsGetViewer(PetscObjectComm((PetscObject)eps),((PetscObject)eps)->options,((PetscObject)eps)->prefix,opt,&viewer,&format,&flg));
   if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
 
+  /* Register built-in monitors the first time one is requested */
+  PetscCall(EPSMonitorRegisterAll());
+
   PetscCall(PetscViewerGetType(viewer,&vtype));
   PetscCall(SlepcMonitorMakeKey_Internal(name,vtype,format,key));
   PetscCall(PetscFunctionListFind(EPSMonitorList,key,&mfunc));
@@ -87,7 +90,7 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
   PetscBool      set,flg,flg1,flg2,flg3,bval;
   PetscReal      r,array[2]={0,0};
   PetscScalar    s;
-  PetscInt       i,j,k;
+  PetscInt       i,j,k,iarray[2]={0,0};
   EPSBalance     bal;
 
   PetscFunctionBegin;
@@ -197,11 +200,18 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
       PetscCall(EPSSetInterval(eps,array[0],array[1]));
     }
 
+    k = 2;
+    PetscCall(PetscOptionsIntArray("-eps_filtered_initial_space","Number of filtered random initial vectors, optionally followed by the filter degree","EPSSetFilteredInitialSpace",iarray,&k,&flg));
+    if (flg) PetscCall(EPSSetFilteredInitialSpace(eps,iarray[0],k>1?iarray[1]:PETSC_DEFAULT));
+
     PetscCall(PetscOptionsBool("-eps_true_residual","Compute true residuals explicitly","EPSSetTrueResidual",eps->trueres,&eps->trueres,NULL));
     PetscCall(PetscOptionsBool("-eps_purify","Postprocess eigenvectors for purification","EPSSetPurify",eps->purify,&bval,&flg));
     if (flg) PetscCall(EPSSetPurify(eps,bval));
     PetscCall(PetscOptionsBool("-eps_two_sided","Use two-sided variant (to compute left eigenvectors)","EPSSetTwoSided",eps->twosided,&bval,&flg));
     if (flg) PetscCall(EPSSetTwoSided(eps,bval));
+    PetscCall(PetscOptionsBool("-eps_reuse_previous","Reuse previous solution as initial space in the next solve","EPSSetReusePrevious",eps->reuseprev,&eps->reuseprev,NULL));
+    PetscCall(PetscOptionsInt("-eps_redundant","Number of subcommunicators that solve the problem redundantly","EPSSetRedundant",eps->nred,&i,&flg));
+    if (flg) PetscCall(EPSSetRedundant(eps,i));
 
     /* -----------------------------------------------------------------------*/
     /*
@@ -212,6 +222,9 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
     PetscCall(EPSMonitorSetFromOptions(eps,"-eps_monitor","first_approximation",NULL,PETSC_FALSE));
     PetscCall(EPSMonitorSetFromOptions(eps,"-eps_monitor_all","all_approximations",NULL,PETSC_TRUE));
     PetscCall(EPSMonitorSetFromOptions(eps,"-eps_monitor_conv","convergence_history",NULL,PETSC_FALSE));
+    k = 0;
+    PetscCall(PetscOptionsInt("-eps_state_shm","Base key of the shared memory segments where the solver state is published","EPSMonitor",k,&k,&flg));
+    if (flg) PetscCall(EPSStateShmSetUp(eps,k));
 
     /* -----------------------------------------------------------------------*/
     PetscCall(PetscOptionsName("-eps_view","Print detailed information on solver used","EPSView",&set));
@@ -790,6 +803,55 @@ PetscErrorCode EPSSetStoppingTestFunction(EPS eps,PetscErrorCode (*func)(EPS eps
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+   EPSSetConvergedHandler - Sets a function to be called every time one or more
+   eigenpairs are locked during the solve.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - eigensolver context obtained from EPSCreate()
+.  func    - pointer to the handler function
+.  ctx     - context for private data for the handler routine (may be null)
+-  destroy - a routine for destroying the context (may be null)
+
+   Calling sequence of func:
+$  PetscErrorCode func(EPS eps,PetscInt first,PetscInt npairs,PetscBool *stop,void *ctx)
++   eps    - eigensolver context obtained from EPSCreate()
+.   first  - index of the first newly locked eigenpair
+.   npairs - number of newly locked eigenpairs
+.   stop   - (output) set to PETSC_TRUE to request termination of the solve
+-   ctx    - optional context, as set by EPSSetConvergedHandler()
+
+   Notes:
+   The handler is invoked from within EPSSolve() as soon as pairs with indices
+   first..first+npairs-1 are locked, that is, they will not change in subsequent
+   iterations. The corresponding eigenvalues are available in the usual way with
+   EPSGetEigenvalue(), so a consumer can start post-processing converged pairs
+   before the solve has completed. Eigenvectors are not yet in final form at
+   this point, since they are extracted at the end of the solve.
+
+   If the handler sets the stop flag, the solve terminates at the current
+   iteration with reason EPS_CONVERGED_USER, keeping the pairs locked so far.
+
+   Currently, only solvers that lock converged pairs invoke the handler, such
+   as the default Krylov-Schur solver with locking enabled.
+
+   Level: advanced
+
+.seealso: EPSSetStoppingTestFunction(), EPSGetConverged(), EPSKrylovSchurSetLocking()
+@*/
+PetscErrorCode EPSSetConvergedHandler(EPS eps,PetscErrorCode (*func)(EPS eps,PetscInt first,PetscInt npairs,PetscBool *stop,void *ctx),void* ctx,PetscErrorCode (*destroy)(void*))
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (eps->convergedhandlerdestroy) PetscCall((*eps->convergedhandlerdestroy)(eps->convergedhandlerctx));
+  eps->convergedhandler        = func;
+  eps->convergedhandlerdestroy = destroy;
+  eps->convergedhandlerctx     = ctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSetStoppingTest - Specifies how to decide the termination of the outer
    loop of the eigensolver.
@@ -1098,6 +1160,7 @@ PetscErrorCode EPSSetBalance(EPS eps,EPSBalance bal,PetscInt its,PetscReal cutof
     PetscCheck(cutoff>0.0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of cutoff. Must be > 0");
     eps->balance_cutoff = cutoff;
   }
+  eps->balancedone = PETSC_FALSE;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1217,6 +1280,13 @@ PetscErrorCode EPSGetTwoSided(EPS eps,PetscBool *twosided)
    used). On the contrary, preconditioned eigensolvers (e.g., Davidson solvers)
    do rely on computing the true residual, so this option is irrelevant for them.
 
+   In Krylov solvers, the true residual is computed only for the eigenpair
+   approximations that may pass the convergence test in the current restart.
+   If all error estimates are being tracked, e.g. with EPSSetTrackAll() or a
+   monitor displaying all of them, the remaining ones are reported using the
+   cheap estimate, since they do not take part in the convergence decision
+   and the explicit residual involves global communication.
+
    Level: advanced
 
 .seealso: EPSGetTrueResidual()
@@ -264,6 +264,57 @@ PetscErrorCode EPSSetDSType(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSBuildFilteredInitialSpace_Private: generate the initial space by passing
+   random vectors through a low-degree polynomial filter that approximates the
+   indicator function of the target interval, so that the starting basis has
+   most of its energy in the wanted part of the spectrum
+*/
+static PetscErrorCode EPSBuildFilteredInitialSpace_Private(EPS eps)
+{
+  ST             flt;
+  Mat            A;
+  Vec            *is,w;
+  PetscRandom    rand;
+  PetscReal      a,b,c,d;
+  PetscBool      istrivial,isinterval;
+  PetscInt       i,n=eps->finispace;
+
+  PetscFunctionBegin;
+  PetscCheck(eps->ishermitian && !eps->isgeneralized,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Filtered initial space requires a standard Hermitian eigenproblem");
+  a = eps->inta; b = eps->intb;
+  if (a>=b) {  /* no computational interval given, try an interval region */
+    PetscCall(RGIsTrivial(eps->rg,&istrivial));
+    PetscCall(PetscObjectTypeCompare((PetscObject)eps->rg,RGINTERVAL,&isinterval));
+    PetscCheck(!istrivial && isinterval,PetscObjectComm((PetscObject)eps),PETSC_ERR_ORDER,"Must specify the target interval with EPSSetInterval() or an RGINTERVAL region");
+    PetscCall(RGIntervalGetEndpoints(eps->rg,&a,&b,&c,&d));
+  }
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(STCreate(PetscObjectComm((PetscObject)eps),&flt));
+  PetscCall(STSetType(flt,STFILTER));
+  PetscCall(STSetMatrices(flt,1,&A));
+  PetscCall(STFilterSetInterval(flt,a,b));
+  PetscCall(STFilterSetDegree(flt,eps->finideg));
+  PetscCall(STSetUp(flt));
+  PetscCall(PetscRandomCreate(PetscObjectComm((PetscObject)eps),&rand));
+  PetscCall(PetscRandomSetFromOptions(rand));
+  PetscCall(MatCreateVecs(A,&w,NULL));
+  PetscCall(PetscMalloc1(n,&is));
+  for (i=0;i<n;i++) {
+    PetscCall(MatCreateVecs(A,&is[i],NULL));
+    PetscCall(VecSetRandom(w,rand));
+    PetscCall(STApply(flt,w,is[i]));
+  }
+  PetscCall(EPSSetInitialSpace(eps,n,is));
+  PetscCall(PetscInfo(eps,"Generated %" PetscInt_FMT " initial vectors with a degree %" PetscInt_FMT " filter on [%g,%g]\n",n,eps->finideg,(double)a,(double)b));
+  for (i=0;i<n;i++) PetscCall(VecDestroy(&is[i]));
+  PetscCall(PetscFree(is));
+  PetscCall(VecDestroy(&w));
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(STDestroy(&flt));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSetUp - Sets up all the internal data structures necessary for the
    execution of the eigensolver. Then calls STSetUp() for any set-up
@@ -371,8 +422,15 @@ PetscErrorCode EPSSetUp(EPS eps)
   if (eps->balance!=EPS_BALANCE_USER) {
     PetscCall(STSetBalanceMatrix(eps->st,NULL));
     if (!eps->ishermitian && (eps->balance==EPS_BALANCE_ONESIDE || eps->balance==EPS_BALANCE_TWOSIDE)) {
-      if (!eps->D) PetscCall(BVCreateVec(eps->V,&eps->D));
-      PetscCall(EPSBuildBalance_Krylov(eps));
+      if (!eps->D) {
+        PetscCall(BVCreateVec(eps->V,&eps->D));
+        eps->balancedone = PETSC_FALSE;
+      }
+      /* skip the computation if the operators and the balancing settings have not changed */
+      if (!eps->balancedone) {
+        PetscCall(EPSBuildBalance_Krylov(eps));
+        eps->balancedone = PETSC_TRUE;
+      }
       PetscCall(STSetBalanceMatrix(eps->st,eps->D));
     }
   }
@@ -389,6 +447,7 @@ PetscErrorCode EPSSetUp(EPS eps)
     eps->nds = k;
     PetscCall(STCheckNullSpace(eps->st,eps->V));
   }
+  if (eps->finispace>0 && !eps->nini) PetscCall(EPSBuildFilteredInitialSpace_Private(eps));
   if (eps->nini<0) {
     k = -eps->nini;
     PetscCheck(k<=eps->ncv,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The number of initial vectors is larger than ncv");
@@ -457,6 +516,7 @@ PetscErrorCode EPSSetOperators(EPS eps,Mat A,Mat B)
   if (eps->state && (n!=eps->n || nloc!=eps->nloc)) PetscCall(EPSReset(eps));
   eps->nrma = 0.0;
   eps->nrmb = 0.0;
+  eps->balancedone = PETSC_FALSE;
   if (!eps->st) PetscCall(EPSGetST(eps,&eps->st));
   mat[0] = A;
   if (B) {
@@ -468,6 +528,67 @@ PetscErrorCode EPSSetOperators(EPS eps,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSUpdateOperatorValues - Declares that the values of the problem matrices
+   have changed, keeping their nonzero structure, so that the next solve can
+   reuse the setup of the previous one.
+
+   Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+.  A  - the matrix associated with the eigensystem
+-  B  - the second matrix in the case of generalized eigenproblems
+
+   Notes:
+   This is the update path for sequences of eigenproblems in which only the
+   matrix entries change between solves, as in Newton-type outer loops. The
+   matrices must be the same Mat objects passed to EPSSetOperators(), with
+   their values modified in place. In contrast to EPSSetOperators(), which
+   invalidates the whole setup, this routine propagates a values-only change
+   through the spectral transformation, where the shifted operator is rebuilt
+   in place and the preconditioner reuses the symbolic factorization, paying
+   only the numeric phase. The basis vectors, the projected problem storage
+   and all remaining solver data are preserved.
+
+   If the solver has not been set up yet, or different Mat objects are passed,
+   this is equivalent to calling EPSSetOperators().
+
+   To start the next solve from the solution of the previous one instead of
+   from scratch, combine this routine with EPSSetReusePrevious().
+
+   Level: intermediate
+
+.seealso: EPSSetOperators(), EPSSetReusePrevious(), EPSSolve(), STSetUp()
+@*/
+PetscErrorCode EPSUpdateOperatorValues(EPS eps,Mat A,Mat B)
+{
+  Mat            mat[2],A0=NULL,B0=NULL;
+  PetscInt       nmat;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidHeaderSpecific(A,MAT_CLASSID,2);
+  if (B) PetscValidHeaderSpecific(B,MAT_CLASSID,3);
+  if (eps->st) PetscCall(EPSGetOperators(eps,&A0,&B0));
+  if (!eps->state || A!=A0 || B!=B0) {  /* not a values-only change */
+    PetscCall(EPSSetOperators(eps,A,B));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  mat[0] = A;
+  if (B) {
+    mat[1] = B;
+    nmat = 2;
+  } else nmat = 1;
+  PetscCall(STSetMatrices(eps->st,nmat,mat));  /* same objects, sets the updated state */
+  eps->nrma = 0.0;
+  eps->nrmb = 0.0;
+  eps->balancedone = PETSC_FALSE;
+  PetscCall(STSetUp(eps->st));  /* numeric-only refactorization */
+  eps->state = EPS_STATE_SETUP;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSGetOperators - Gets the matrices associated with the eigensystem.
 
@@ -573,6 +694,11 @@ PetscErrorCode EPSSetDeflationSpace(EPS eps,PetscInt n,Vec v[])
    Common usage of this function is when the user can provide a rough approximation
    of the wanted eigenspace. Then, convergence may be faster.
 
+   In the CISS solver, the initial space is used to seed the block of source
+   vectors for the contour integrals, which is useful e.g. in parameter sweeps
+   where the eigenvectors computed for one region are a good starting point for
+   a nearby region.
+
    Level: intermediate
 
 .seealso: EPSSetLeftInitialSpace(), EPSSetDeflationSpace()
@@ -629,6 +755,221 @@ PetscErrorCode EPSSetLeftInitialSpace(EPS eps,PetscInt n,Vec isl[])
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSSetFilteredInitialSpace - Requests that the initial space is generated
+   automatically by applying a polynomial filter to random vectors.
+
+   Logically Collective
+
+   Input Parameters:
++  eps    - the eigenproblem solver context
+.  n      - number of vectors to generate
+-  degree - degree of the polynomial filter
+
+   Options Database Key:
+.  -eps_filtered_initial_space <n,deg> - number of vectors and filter degree
+
+   Notes:
+   At setup time, n random vectors are passed through a degree-th degree
+   Chebyshev approximation of the indicator function of the target interval,
+   and the result is taken as the initial space. The filtered vectors have
+   most of their energy inside the interval, so in interior eigenproblems the
+   first iterations do not have to remove the large exterior components that a
+   plain random start would contain.
+
+   The target interval is the one given with EPSSetInterval(), or alternatively
+   the endpoints of an RGINTERVAL region. This feature is available only for
+   standard Hermitian eigenproblems, since it relies on the STFILTER machinery.
+
+   A crude low-degree filter suffices here, as the vectors are used only as a
+   starting guess; use PETSC_DEFAULT for a reasonable degree. Passing n=0
+   deactivates the automatic generation.
+
+   Level: advanced
+
+.seealso: EPSSetInitialSpace(), EPSSetInterval(), STFILTER
+@*/
+PetscErrorCode EPSSetFilteredInitialSpace(EPS eps,PetscInt n,PetscInt degree)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,n,2);
+  PetscValidLogicalCollectiveInt(eps,degree,3);
+  PetscCheck(n>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Argument n cannot be negative");
+  eps->finispace = n;
+  if (degree==PETSC_DEFAULT || degree==PETSC_DECIDE) eps->finideg = 20;
+  else {
+    PetscCheck(degree>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Argument degree must be positive");
+    eps->finideg = degree;
+  }
+  if (n>0) eps->state = EPS_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetFilteredInitialSpace - Gets the parameters of the automatic generation
+   of the initial space.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  n      - number of vectors to generate
+-  degree - degree of the polynomial filter
+
+   Level: advanced
+
+.seealso: EPSSetFilteredInitialSpace()
+@*/
+PetscErrorCode EPSGetFilteredInitialSpace(EPS eps,PetscInt *n,PetscInt *degree)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (n) *n = eps->finispace;
+  if (degree) *degree = eps->finideg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSetReusePrevious - Sets a flag to reuse the solution of the previous
+   solve as the initial space of the next one.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  reuse - boolean flag
+
+   Options Database Key:
+.  -eps_reuse_previous <bool> - sets the flag
+
+   Notes:
+   This is intended for sequences of slowly varying eigenproblems, where
+   EPSSetOperators() is called repeatedly with slightly perturbed matrices,
+   as in time-dependent simulations or parameter continuation. In that setting
+   the eigenvectors of one solve are usually a good approximation of the
+   solution of the next one. With this flag set, EPSSolve() feeds the converged
+   eigenvectors of the previous solve back as the initial space, as in
+   EPSSetInitialSpace(), so the solver starts from the previous invariant
+   subspace rather than from a random vector, and still-converged eigenpairs
+   are re-validated in the first few iterations. In two-sided solvers, left
+   eigenvectors are reused in the same way.
+
+   The previous basis can be kept only if the matrices passed to
+   EPSSetOperators() preserve their dimensions, otherwise the solver is reset
+   and the flag has no effect. An initial space provided explicitly with
+   EPSSetInitialSpace() takes precedence over the reused vectors.
+
+   Level: intermediate
+
+.seealso: EPSGetReusePrevious(), EPSSetInitialSpace(), EPSSetOperators()
+@*/
+PetscErrorCode EPSSetReusePrevious(EPS eps,PetscBool reuse)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,reuse,2);
+  eps->reuseprev = reuse;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetReusePrevious - Returns the flag indicating whether the solution of
+   the previous solve is reused as the initial space of the next one.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  reuse - the flag
+
+   Level: intermediate
+
+.seealso: EPSSetReusePrevious()
+@*/
+PetscErrorCode EPSGetReusePrevious(EPS eps,PetscBool *reuse)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(reuse,2);
+  *reuse = eps->reuseprev;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSetRedundant - Sets the number of subcommunicators on which the
+   eigenproblem is to be solved redundantly.
+
+   Logically Collective
+
+   Input Parameters:
++  eps  - the eigenproblem solver context
+-  nred - number of subcommunicators (1 means no redundancy)
+
+   Options Database Key:
+.  -eps_redundant <n> - sets the number of subcommunicators
+
+   Notes:
+   This is intended for eigenproblems that are small relative to the number
+   of processes of the communicator, where running the iteration on all
+   processes is slower than on a few of them due to communication latency.
+   With nred>1, EPSSolve() splits the communicator into nred subcommunicators,
+   replicates the operators on each of them with MatCreateRedundantMatrix(),
+   and solves the problem concurrently on every subcommunicator, in the same
+   way as PCREDUNDANT does for linear solves. Since all processes take part in
+   one of the replicas, the solution is available everywhere and only a local
+   copy is needed to return the eigenvectors in the original parallel layout.
+
+   The redundant solver can be configured separately from the outer one by
+   appending "redundant_" to the options prefix, e.g. -eps_redundant_eps_type.
+
+   The replication of the operators requires them to be assembled matrices,
+   so this option cannot be used with shell matrices. Spectral transformations
+   must be requested on the redundant solver via its options prefix.
+
+   Level: advanced
+
+.seealso: EPSGetRedundant(), EPSSolve(), EPSSetOperators()
+@*/
+PetscErrorCode EPSSetRedundant(EPS eps,PetscInt nred)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,nred,2);
+  PetscCheck(nred>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The number of subcommunicators must be at least 1");
+  eps->nred = nred;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetRedundant - Returns the number of subcommunicators used for
+   redundant solves.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  nred - number of subcommunicators
+
+   Level: advanced
+
+.seealso: EPSSetRedundant()
+@*/
+PetscErrorCode EPSGetRedundant(EPS eps,PetscInt *nred)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(nred,2);
+  *nred = eps->nred;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   EPSSetDimensions_Default - Set reasonable values for ncv, mpd if not set
   by the user. This is called at setup.
@@ -696,7 +1037,7 @@ PetscErrorCode EPSAllocateSolution(EPS eps,PetscInt extra)
   }
 
   /* workspace for the case of arbitrary selection */
-  if (eps->arbitrary) {
+  if (eps->arbitrary && (requested != oldsize || !eps->rr)) {
     if (eps->rr) PetscCall(PetscFree2(eps->rr,eps->ri));
     PetscCall(PetscMalloc2(requested,&eps->rr,requested,&eps->ri));
   }
@@ -710,8 +1051,8 @@ PetscErrorCode EPSAllocateSolution(EPS eps,PetscInt extra)
     PetscCall(VecDestroy(&t));
   } else PetscCall(BVResize(eps->V,requested,PETSC_FALSE));
 
-  /* allocate W */
-  if (eps->twosided) {
+  /* allocate W, reusing it if the basis size has not changed */
+  if (eps->twosided && (requested != oldsize || !eps->W)) {
     PetscCall(BVGetRandomContext(eps->V,&rand));  /* make sure the random context is available when duplicating */
     PetscCall(BVDestroy(&eps->W));
     PetscCall(BVDuplicate(eps->V,&eps->W));
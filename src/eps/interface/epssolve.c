@@ -88,6 +88,137 @@ static PetscErrorCode EPSComputeValues(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSRedundantCopyColumn_Private - Gather a redundant vector on every process
+   of the subcommunicator and keep the rows owned in the original layout as
+   column j of V.
+*/
+static PetscErrorCode EPSRedundantCopyColumn_Private(VecScatter scat,Vec xred,Vec xseq,PetscInt rstart,PetscInt nloc,BV V,PetscInt j)
+{
+  Vec               v;
+  PetscScalar       *va;
+  const PetscScalar *xa;
+
+  PetscFunctionBegin;
+  PetscCall(VecScatterBegin(scat,xred,xseq,INSERT_VALUES,SCATTER_FORWARD));
+  PetscCall(VecScatterEnd(scat,xred,xseq,INSERT_VALUES,SCATTER_FORWARD));
+  PetscCall(VecGetArrayRead(xseq,&xa));
+  PetscCall(BVGetColumn(V,j,&v));
+  PetscCall(VecGetArray(v,&va));
+  PetscCall(PetscArraycpy(va,xa+rstart,nloc));
+  PetscCall(VecRestoreArray(v,&va));
+  PetscCall(BVRestoreColumn(V,j,&v));
+  PetscCall(VecRestoreArrayRead(xseq,&xa));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSSolveRedundant_Private - Replicate the operators on eps->nred
+   subcommunicators, solve the problem concurrently on all of them, and copy
+   the (identical) solution back to the original parallel layout. See
+   EPSSetRedundant().
+*/
+static PetscErrorCode EPSSolveRedundant_Private(EPS eps)
+{
+  EPS            epsred;
+  EPSType        type;
+  PetscSubcomm   psubcomm;
+  MPI_Comm       child;
+  Mat            A,B=NULL,Ared,Bred=NULL;
+  Vec            xr,xi=NULL,xseq;
+  VecScatter     scat;
+  const char     *prefix;
+  PetscMPIInt    size;
+  PetscInt       i,ncv,rstart,rend;
+
+  PetscFunctionBegin;
+  PetscCall(PetscLogEventBegin(EPS_Solve,eps,0,0,0));
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)eps),&size));
+  PetscCheck(eps->nred<=size,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The number of subcommunicators cannot exceed the number of processes");
+
+  /* replicate the operators on each subcommunicator */
+  PetscCall(PetscSubcommCreate(PetscObjectComm((PetscObject)eps),&psubcomm));
+  PetscCall(PetscSubcommSetNumber(psubcomm,eps->nred));
+  PetscCall(PetscSubcommSetType(psubcomm,PETSC_SUBCOMM_CONTIGUOUS));
+  PetscCall(PetscSubcommGetChild(psubcomm,&child));
+  PetscCall(EPSGetOperators(eps,&A,&B));
+  PetscCall(MatCreateRedundantMatrix(A,0,child,MAT_INITIAL_MATRIX,&Ared));
+  if (B) PetscCall(MatCreateRedundantMatrix(B,0,child,MAT_INITIAL_MATRIX,&Bred));
+
+  /* configure a solver on the subcommunicator mimicking the outer one */
+  PetscCall(EPSCreate(child,&epsred));
+  PetscCall(EPSGetOptionsPrefix(eps,&prefix));
+  if (prefix) PetscCall(EPSSetOptionsPrefix(epsred,prefix));
+  PetscCall(EPSAppendOptionsPrefix(epsred,"redundant_"));
+  PetscCall(EPSGetType(eps,&type));
+  if (type) PetscCall(EPSSetType(epsred,type));
+  PetscCall(EPSSetOperators(epsred,Ared,Bred));
+  if (eps->problem_type) PetscCall(EPSSetProblemType(epsred,eps->problem_type));
+  if (eps->which) PetscCall(EPSSetWhichEigenpairs(epsred,eps->which));
+  PetscCall(EPSSetTarget(epsred,eps->target));
+  PetscCall(EPSSetDimensions(epsred,eps->nev,eps->ncv,eps->mpd));
+  PetscCall(EPSSetTolerances(epsred,eps->tol,eps->max_it));
+  PetscCall(EPSSetFromOptions(epsred));
+
+  /* solve redundantly on every subcommunicator */
+  PetscCall(EPSSolve(epsred));
+
+  /* allocate the outer solution and copy eigenvalues and status */
+  PetscCall(EPSGetDimensions(epsred,NULL,&ncv,NULL));
+  eps->ncv = ncv;
+  PetscCall(EPSAllocateSolution(eps,0));
+  PetscCall(EPSGetConverged(epsred,&eps->nconv));
+  PetscCall(EPSGetIterationNumber(epsred,&eps->its));
+  PetscCall(EPSGetConvergedReason(epsred,&eps->reason));
+  for (i=0;i<eps->ncv;i++) {
+    eps->eigr[i]   = 0.0;
+    eps->eigi[i]   = 0.0;
+    eps->errest[i] = 0.0;
+    eps->perm[i]   = i;
+  }
+  for (i=0;i<eps->nconv;i++) PetscCall(EPSGetErrorEstimate(epsred,i,&eps->errest[i]));
+
+  /* every subcommunicator holds the full solution, so no broadcast is
+     needed: gather each eigenvector within the subcommunicator and keep
+     the locally owned rows */
+  PetscCall(MatCreateVecs(Ared,&xr,NULL));
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCall(MatCreateVecs(Ared,&xi,NULL));
+#endif
+  PetscCall(VecScatterCreateToAll(xr,&scat,&xseq));
+  PetscCall(MatGetOwnershipRange(A,&rstart,&rend));
+  for (i=0;i<eps->nconv;i++) {
+    PetscCall(EPSGetEigenpair(epsred,i,&eps->eigr[i],&eps->eigi[i],xr,xi));
+    PetscCall(EPSRedundantCopyColumn_Private(scat,xr,xseq,rstart,rend-rstart,eps->V,i));
+#if !defined(PETSC_USE_COMPLEX)
+    if (eps->eigi[i]>0.0 && i+1<eps->nconv) {
+      /* store the imaginary part in the second column of the conjugate pair */
+      eps->eigr[i+1] = eps->eigr[i];
+      eps->eigi[i+1] = -eps->eigi[i];
+      PetscCall(EPSRedundantCopyColumn_Private(scat,xi,xseq,rstart,rend-rstart,eps->V,i+1));
+      i++;
+    }
+#endif
+  }
+  PetscCall(VecScatterDestroy(&scat));
+  PetscCall(VecDestroy(&xseq));
+  PetscCall(VecDestroy(&xr));
+  PetscCall(VecDestroy(&xi));
+  PetscCall(EPSDestroy(&epsred));
+  PetscCall(MatDestroy(&Ared));
+  PetscCall(MatDestroy(&Bred));
+  PetscCall(PetscSubcommDestroy(&psubcomm));
+
+  /* the eigenvectors are already in final form, skip the computevectors phase */
+  eps->state = EPS_STATE_EIGENVECTORS;
+  PetscCall(BVSetActiveColumns(eps->V,0,eps->nconv));
+  PetscCall(PetscLogEventEnd(EPS_Solve,eps,0,0,0));
+  PetscCall(EPSViewFromOptions(eps,NULL,"-eps_view"));
+  PetscCall(EPSConvergedReasonViewFromOptions(eps));
+  PetscCall(EPSValuesViewFromOptions(eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSolve - Solves the eigensystem.
 
@@ -120,16 +251,43 @@ static PetscErrorCode EPSComputeValues(EPS eps)
 @*/
 PetscErrorCode EPSSolve(EPS eps)
 {
-  PetscInt       i;
+  PetscInt       i,k;
   PetscBool      hasname;
   STMatMode      matmode;
   Mat            A,B;
+  Vec            *is;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
   if (eps->state>=EPS_STATE_SOLVED) PetscFunctionReturn(PETSC_SUCCESS);
+  if (eps->nred>1) {
+    /* solve replicas of the problem on subcommunicators, see EPSSetRedundant() */
+    PetscCall(EPSSolveRedundant_Private(eps));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(PetscLogEventBegin(EPS_Solve,eps,0,0,0));
 
+  /* Reuse the converged eigenvectors of the previous solve as initial space */
+  if (eps->reuseprev && eps->nconv>0 && eps->V && !eps->nini) {
+    k = PetscMin(eps->nconv,eps->ncv);
+    PetscCall(PetscMalloc1(k,&is));
+    for (i=0;i<k;i++) {
+      PetscCall(BVCreateVec(eps->V,&is[i]));
+      PetscCall(BVCopyVec(eps->V,i,is[i]));
+    }
+    PetscCall(EPSSetInitialSpace(eps,k,is));
+    if (eps->twosided && eps->W && !eps->ninil) {
+      for (i=0;i<k;i++) {
+        PetscCall(VecDestroy(&is[i]));  /* still referenced from within the EPS object */
+        PetscCall(BVCreateVec(eps->W,&is[i]));
+        PetscCall(BVCopyVec(eps->W,i,is[i]));
+      }
+      PetscCall(EPSSetLeftInitialSpace(eps,k,is));
+    }
+    for (i=0;i<k;i++) PetscCall(VecDestroy(&is[i]));
+    PetscCall(PetscFree(is));
+  }
+
   /* Call setup */
   PetscCall(EPSSetUp(eps));
   eps->nconv = 0;
@@ -142,11 +300,16 @@ PetscErrorCode EPSSolve(EPS eps)
   }
   PetscCall(EPSViewFromOptions(eps,NULL,"-eps_view_pre"));
   PetscCall(RGViewFromOptions(eps->rg,NULL,"-rg_view"));
+  PetscCall(EPSVectorsViewStreamSetUp(eps));
 
   /* Call solver */
+  PetscCall(STResetOperationCounters(eps->st));  /* make counts refer to this solve only */
+  PetscCall(STSetOuterTolerance(eps->st,0.0));  /* no residual estimate available yet */
   PetscUseTypeMethod(eps,solve);
   PetscCheck(eps->reason,PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
-  eps->state = EPS_STATE_SOLVED;
+  eps->state    = EPS_STATE_SOLVED;
+  eps->ondemand = 0;
+  PetscCall(EPSVectorsViewStreamFinish(eps));
 
   /* Only the first nconv columns contain useful information (except in CISS) */
   PetscCall(BVSetActiveColumns(eps->V,0,eps->nconv));
@@ -209,6 +372,65 @@ PetscErrorCode EPSSolve(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+   EPSBatchSolve - Solves a sequence of eigenvalue problems of the same
+   dimensions, reusing the workspace of the solver across problems.
+
+   Collective
+
+   Input Parameters:
++  eps     - the eigensolver context
+.  n       - number of problems in the batch
+.  A       - array of n matrices associated with the eigensystems
+.  B       - array of n second matrices for generalized problems, or NULL
+.  collect - (optional) routine called after each solve to retrieve the results
+-  ctx     - context for private data for the collect routine (may be null)
+
+   Calling sequence of collect:
+$  PetscErrorCode collect(EPS eps,PetscInt i,void *ctx)
++   eps - the eigensolver context
+.   i   - index of the problem just solved
+-   ctx - optional context, as set by EPSBatchSolve()
+
+   Notes:
+   This is equivalent to calling EPSSetOperators() and EPSSolve() for each
+   problem in turn, but makes the intent explicit: since all problems have
+   the same dimensions, the basis vectors, the projected problem storage and
+   the spectral transformation workspace allocated for the first problem are
+   reused for all subsequent ones, so the setup cost is amortized over the
+   whole batch. The solution of one problem is overwritten by the next one,
+   hence the results must be extracted in the collect callback, e.g. with
+   EPSGetEigenpair().
+
+   For sequences of slowly varying problems, consider also activating
+   EPSSetReusePrevious() so that each solve starts from the solution of the
+   previous one.
+
+   To process several independent batches concurrently, create one EPS on
+   each subcommunicator (see PetscSubcommCreate()) and call this routine on
+   every subcommunicator with its share of the problems.
+
+   Level: intermediate
+
+.seealso: EPSSolve(), EPSSetOperators(), EPSSetReusePrevious()
+@*/
+PetscErrorCode EPSBatchSolve(EPS eps,PetscInt n,Mat A[],Mat B[],PetscErrorCode (*collect)(EPS eps,PetscInt i,void *ctx),void *ctx)
+{
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,n,2);
+  PetscCheck(n>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Number of problems must be nonnegative");
+  if (n) PetscAssertPointer(A,3);
+  for (i=0;i<n;i++) {
+    PetscCall(EPSSetOperators(eps,A[i],B?B[i]:NULL));
+    PetscCall(EPSSolve(eps));
+    if (collect) PetscCall((*collect)(eps,i,ctx));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSGetIterationNumber - Gets the current iteration number. If the
    call to EPSSolve() is complete, then it returns the number of iterations
@@ -242,6 +464,43 @@ PetscErrorCode EPSGetIterationNumber(EPS eps,PetscInt *its)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSGetOperationCounts - Gets the number of operator applications,
+   matrix-vector products and linear solves performed during the last
+   call to EPSSolve().
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameters:
++  applys    - number of applications of the spectral transformation operator
+.  matmults  - number of matrix-vector products with the transformation matrices
+-  matsolves - number of linear solves within the spectral transformation
+
+   Notes:
+   Any output parameter may be NULL if not needed.
+
+   The counters are reset at the beginning of each EPSSolve() call, so they
+   always refer to the last solve. They are maintained by the associated ST
+   object, see STGetOperationCounters(). Together with the iteration count
+   and the dimensions of the problem, these numbers allow building a cost
+   model of a given solver configuration without activating PETSc logging.
+
+   Level: intermediate
+
+.seealso: EPSGetIterationNumber(), STGetOperationCounters()
+@*/
+PetscErrorCode EPSGetOperationCounts(EPS eps,PetscInt *applys,PetscInt *matmults,PetscInt *matsolves)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscCheck(eps->st,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONGSTATE,"Must call EPSSolve() first");
+  PetscCall(STGetOperationCounters(eps->st,applys,matmults,matsolves));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSGetConverged - Gets the number of converged eigenpairs.
 
@@ -464,6 +723,54 @@ PetscErrorCode EPSGetEigenvalue(EPS eps,PetscInt i,PetscScalar *eigr,PetscScalar
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSGetEigenvectorOnDemand_Private - Extract a single eigenvector as the product
+   of the Schur basis times the corresponding eigenvector of the projected problem,
+   without back-transforming the whole basis. When the caller retrieves only a few
+   of many converged eigenpairs, this costs O(n*nconv) per vector instead of the
+   O(n*nconv^2) of the full transform done by EPSComputeVectors(). The basis keeps
+   holding Schur vectors, so a later full transform is still possible. The fast
+   path is skipped (done=PETSC_FALSE) if a significant fraction of the spectrum
+   has already been requested, or if postprocessing of the vectors is required.
+*/
+static PetscErrorCode EPSGetEigenvectorOnDemand_Private(EPS eps,PetscInt k,Vec Vr,Vec Vi,PetscBool *done)
+{
+  PetscInt       kk,ld,l0,k0;
+  PetscScalar    *X;
+
+  PetscFunctionBegin;
+  *done = PETSC_FALSE;
+  if (eps->state!=EPS_STATE_SOLVED || eps->ops->computevectors!=EPSComputeVectors_Schur) PetscFunctionReturn(PETSC_SUCCESS);
+  if (eps->ishermitian || eps->twosided || eps->purify || (eps->balance!=EPS_BALANCE_NONE && eps->D)) PetscFunctionReturn(PETSC_SUCCESS);
+  if (4*(eps->ondemand+1)>eps->nconv) PetscFunctionReturn(PETSC_SUCCESS);  /* the full transform is cheaper */
+  eps->ondemand++;
+
+  kk = k;
+#if !defined(PETSC_USE_COMPLEX)
+  if (eps->eigi[k]<0.0) kk = k-1;  /* second vector of a complex conjugate pair */
+#endif
+  PetscCall(DSVectors(eps->ds,DS_MAT_X,&kk,NULL));
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  PetscCall(DSGetArray(eps->ds,DS_MAT_X,&X));
+  PetscCall(BVGetActiveColumns(eps->V,&l0,&k0));
+  PetscCall(BVSetActiveColumns(eps->V,0,eps->nconv));
+  if (Vr) PetscCall(BVMultVec(eps->V,1.0,0.0,Vr,X+kk*ld));
+#if !defined(PETSC_USE_COMPLEX)
+  if (Vi) {
+    if (eps->eigi[k]!=0.0) {
+      PetscCall(BVMultVec(eps->V,1.0,0.0,Vi,X+(kk+1)*ld));
+      if (eps->eigi[k]<0.0) PetscCall(VecScale(Vi,-1.0));
+    } else PetscCall(VecSet(Vi,0.0));
+  }
+#else
+  if (Vi) PetscCall(VecSet(Vi,0.0));
+#endif
+  PetscCall(BVSetActiveColumns(eps->V,l0,k0));
+  PetscCall(DSRestoreArray(eps->ds,DS_MAT_X,&X));
+  *done = PETSC_TRUE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSGetEigenvector - Gets the i-th right eigenvector as computed by EPSSolve().
 
@@ -501,6 +808,7 @@ PetscErrorCode EPSGetEigenvalue(EPS eps,PetscInt i,PetscScalar *eigr,PetscScalar
 PetscErrorCode EPSGetEigenvector(EPS eps,PetscInt i,Vec Vr,Vec Vi)
 {
   PetscInt       k;
+  PetscBool      done;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
@@ -510,9 +818,12 @@ PetscErrorCode EPSGetEigenvector(EPS eps,PetscInt i,Vec Vr,Vec Vi)
   EPSCheckSolved(eps,1);
   PetscCheck(i>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The index cannot be negative");
   PetscCheck(i<eps->nconv,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The index can be nconv-1 at most, see EPSGetConverged()");
-  PetscCall(EPSComputeVectors(eps));
   k = eps->perm[i];
-  PetscCall(BV_GetEigenvector(eps->V,k,eps->eigi[k],Vr,Vi));
+  PetscCall(EPSGetEigenvectorOnDemand_Private(eps,k,Vr,Vi,&done));
+  if (!done) {
+    PetscCall(EPSComputeVectors(eps));
+    PetscCall(BV_GetEigenvector(eps->V,k,eps->eigi[k],Vr,Vi));
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -568,6 +879,98 @@ PetscErrorCode EPSGetLeftEigenvector(EPS eps,PetscInt i,Vec Wr,Vec Wi)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSComputeConditionNumber - Computes the condition number of the i-th
+   computed eigenvalue.
+
+   Collective
+
+   Input Parameters:
++  eps - eigensolver context
+-  i   - index of the solution
+
+   Output Parameter:
+.  kappa - the condition number
+
+   Notes:
+   The condition number of a simple eigenvalue is the reciprocal of the cosine
+   of the angle between its left and right eigenvectors,
+   kappa = ||x||*||y||/|y'*x|, and quantifies the sensitivity of the eigenvalue
+   to perturbations of the matrices. A first-order error bar for the computed
+   eigenvalue is obtained by multiplying the residual norm by kappa.
+
+   Left eigenvectors are required, so this function must be used after a
+   two-sided solve, see EPSSetTwoSided(). No additional linear solves or
+   eigensolves are performed, since both eigenvectors are recovered from the
+   data already computed by EPSSolve(); the back-transform of the bases is done
+   only once regardless of how many indices are requested afterwards.
+
+   The index i should be a value between 0 and nconv-1 (see EPSGetConverged()).
+   With real scalars, the two members of a complex conjugate pair have the
+   same condition number.
+
+   Level: intermediate
+
+.seealso: EPSSetTwoSided(), EPSGetEigenvector(), EPSGetLeftEigenvector(), EPSComputeError()
+@*/
+PetscErrorCode EPSComputeConditionNumber(EPS eps,PetscInt i,PetscReal *kappa)
+{
+  PetscInt       k;
+  Vec            x,y;
+  PetscScalar    dot;
+  PetscReal      nx,ny,den;
+#if !defined(PETSC_USE_COMPLEX)
+  Vec            xi,yi;
+  PetscScalar    dot2,dot3,dot4;
+  PetscReal      nxi,nyi;
+#endif
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,i,2);
+  PetscAssertPointer(kappa,3);
+  EPSCheckSolved(eps,1);
+  PetscCheck(eps->twosided,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONGSTATE,"Must request left vectors with EPSSetTwoSided");
+  PetscCheck(i>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The index cannot be negative");
+  PetscCheck(i<eps->nconv,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The index can be nconv-1 at most, see EPSGetConverged()");
+  PetscCall(EPSComputeVectors(eps));
+  k = eps->perm[i];
+#if !defined(PETSC_USE_COMPLEX)
+  if (eps->eigi[k]<0.0) k--;   /* second member of a conjugate pair */
+  if (eps->eigi[k]!=0.0) {
+    PetscCall(BVGetColumn(eps->V,k,&x));
+    PetscCall(BVGetColumn(eps->V,k+1,&xi));
+    PetscCall(BVGetColumn(eps->W,k,&y));
+    PetscCall(BVGetColumn(eps->W,k+1,&yi));
+    PetscCall(VecDot(x,y,&dot));     /* yr'*xr */
+    PetscCall(VecDot(xi,yi,&dot2));  /* yi'*xi */
+    PetscCall(VecDot(xi,y,&dot3));   /* yr'*xi */
+    PetscCall(VecDot(x,yi,&dot4));   /* yi'*xr */
+    PetscCall(VecNorm(x,NORM_2,&nx));
+    PetscCall(VecNorm(xi,NORM_2,&nxi));
+    PetscCall(VecNorm(y,NORM_2,&ny));
+    PetscCall(VecNorm(yi,NORM_2,&nyi));
+    PetscCall(BVRestoreColumn(eps->V,k,&x));
+    PetscCall(BVRestoreColumn(eps->V,k+1,&xi));
+    PetscCall(BVRestoreColumn(eps->W,k,&y));
+    PetscCall(BVRestoreColumn(eps->W,k+1,&yi));
+    den = SlepcAbsEigenvalue(dot+dot2,dot3-dot4);
+    *kappa = (den>0.0)? SlepcAbsEigenvalue(nx,nxi)*SlepcAbsEigenvalue(ny,nyi)/den: PETSC_MAX_REAL;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+#endif
+  PetscCall(BVGetColumn(eps->V,k,&x));
+  PetscCall(BVGetColumn(eps->W,k,&y));
+  PetscCall(VecDot(x,y,&dot));
+  PetscCall(VecNorm(x,NORM_2,&nx));
+  PetscCall(VecNorm(y,NORM_2,&ny));
+  PetscCall(BVRestoreColumn(eps->V,k,&x));
+  PetscCall(BVRestoreColumn(eps->W,k,&y));
+  den = PetscAbsScalar(dot);
+  *kappa = (den>0.0)? nx*ny/den: PETSC_MAX_REAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSGetErrorEstimate - Returns the error estimate associated to the i-th
    computed eigenpair.
@@ -763,6 +1166,166 @@ PetscErrorCode EPSComputeError(EPS eps,PetscInt i,EPSErrorType type,PetscReal *e
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSComputeErrorAll - Computes the errors of all converged eigenpairs at once.
+
+   Collective
+
+   Input Parameters:
++  eps  - the eigensolver context
+-  type - the type of error to compute
+
+   Output Parameter:
+.  errors - array to store the errors, of length at least the number of
+            converged eigenpairs, see EPSGetConverged()
+
+   Notes:
+   The result is the same as calling EPSComputeError() for every index, but
+   the residuals are formed with blocked matrix-basis products and all the
+   norms are accumulated in a single global reduction, which is much faster
+   when many eigenpairs have converged. This is the path used by EPSErrorView()
+   when generating the final report.
+
+   Two-sided computations fall back to the one-by-one computation, since left
+   residuals require additional per-pair work.
+
+   Level: advanced
+
+.seealso: EPSComputeError(), EPSErrorView(), EPSGetConverged()
+@*/
+PetscErrorCode EPSComputeErrorAll(EPS eps,EPSErrorType type,PetscReal errors[])
+{
+  Mat            A,B=NULL;
+  BV             R,W;
+  Vec            u,v,w1,w2;
+  PetscInt       i,j,nconv=eps->nconv;
+  PetscReal      *resnorm,*vecnorm,t;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(eps,type,2);
+  PetscAssertPointer(errors,3);
+  EPSCheckSolved(eps,1);
+  if (!nconv) PetscFunctionReturn(PETSC_SUCCESS);
+
+  /* two-sided errors involve left residuals, not amenable to blocking */
+  if (eps->twosided) {
+    for (i=0;i<nconv;i++) PetscCall(EPSComputeError(eps,i,type,&errors[i]));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* initialization of matrix norms */
+  if (type==EPS_ERROR_BACKWARD) {
+    if (!eps->nrma) {
+      PetscCall(STGetMatrix(eps->st,0,&A));
+      PetscCall(MatHasOperation(A,MATOP_NORM,&flg));
+      PetscCheck(flg,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
+      PetscCall(MatNorm(A,NORM_INFINITY,&eps->nrma));
+    }
+    if (eps->isgeneralized) {
+      if (!eps->nrmb) {
+        PetscCall(STGetMatrix(eps->st,1,&B));
+        PetscCall(MatHasOperation(B,MATOP_NORM,&flg));
+        PetscCheck(flg,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
+        PetscCall(MatNorm(B,NORM_INFINITY,&eps->nrmb));
+      }
+    } else eps->nrmb = 1.0;
+  }
+
+  /* form all residuals with blocked products, R = A*X - diag(k)*B*X */
+  PetscCall(EPSComputeVectors(eps));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  if (eps->isgeneralized) PetscCall(STGetMatrix(eps->st,1,&B));
+  PetscCall(BVSetActiveColumns(eps->V,0,nconv));
+  PetscCall(BVDuplicateResize(eps->V,nconv,&R));
+  PetscCall(BVSetMatrix(R,NULL,PETSC_FALSE));  /* residual norms must be 2-norms, not B-norms */
+  PetscCall(BVMatMult(eps->V,A,R));
+  if (B) {
+    PetscCall(BVDuplicateResize(eps->V,nconv,&W));
+    PetscCall(BVSetMatrix(W,NULL,PETSC_FALSE));
+    PetscCall(BVMatMult(eps->V,B,W));
+  } else W = eps->V;
+  for (j=0;j<nconv;j++) {
+#if !defined(PETSC_USE_COMPLEX)
+    if (eps->eigi[j]>0.0 && j+1<nconv) {
+      /* complex conjugate pair: columns j and j+1 hold real and imaginary parts */
+      PetscCall(BVGetColumn(R,j,&u));
+      PetscCall(BVGetColumn(R,j+1,&v));
+      PetscCall(BVGetColumn(W,j,&w1));
+      PetscCall(BVGetColumn(W,j+1,&w2));
+      PetscCall(VecAXPY(u,-eps->eigr[j],w1));   /* u = A*xr-kr*B*xr */
+      PetscCall(VecAXPY(u,eps->eigi[j],w2));    /* u = A*xr-kr*B*xr+ki*B*xi */
+      PetscCall(VecAXPY(v,-eps->eigr[j],w2));   /* v = A*xi-kr*B*xi */
+      PetscCall(VecAXPY(v,-eps->eigi[j],w1));   /* v = A*xi-kr*B*xi-ki*B*xr */
+      PetscCall(BVRestoreColumn(W,j+1,&w2));
+      PetscCall(BVRestoreColumn(W,j,&w1));
+      PetscCall(BVRestoreColumn(R,j+1,&v));
+      PetscCall(BVRestoreColumn(R,j,&u));
+      j++;
+      continue;
+    }
+#endif
+    PetscCall(BVGetColumn(R,j,&u));
+    PetscCall(BVGetColumn(W,j,&w1));
+    PetscCall(VecAXPY(u,-eps->eigr[j],w1));     /* u = A*x-k*B*x */
+    PetscCall(BVRestoreColumn(W,j,&w1));
+    PetscCall(BVRestoreColumn(R,j,&u));
+  }
+
+  /* all norms in one concatenated reduction */
+  PetscCall(PetscMalloc2(nconv,&resnorm,nconv,&vecnorm));
+  for (j=0;j<nconv;j++) vecnorm[j] = 1.0;
+  for (j=0;j<nconv;j++) PetscCall(BVNormColumnBegin(R,j,NORM_2,&resnorm[j]));
+  if (eps->problem_type==EPS_GHEP) {
+    /* eigenvector 2-norms; BVNormColumn(eps->V,...) would return B-norms */
+    for (j=0;j<nconv;j++) {
+      PetscCall(BVGetColumn(eps->V,j,&u));
+      PetscCall(VecNormBegin(u,NORM_2,&vecnorm[j]));
+      PetscCall(BVRestoreColumn(eps->V,j,&u));
+    }
+  }
+  for (j=0;j<nconv;j++) PetscCall(BVNormColumnEnd(R,j,NORM_2,&resnorm[j]));
+  if (eps->problem_type==EPS_GHEP) {
+    for (j=0;j<nconv;j++) {
+      PetscCall(BVGetColumn(eps->V,j,&u));
+      PetscCall(VecNormEnd(u,NORM_2,&vecnorm[j]));
+      PetscCall(BVRestoreColumn(eps->V,j,&u));
+    }
+  }
+#if !defined(PETSC_USE_COMPLEX)
+  for (j=0;j<nconv-1;j++) {
+    if (eps->eigi[j]>0.0) {
+      resnorm[j] = resnorm[j+1] = SlepcAbsEigenvalue(resnorm[j],resnorm[j+1]);
+      j++;
+    }
+  }
+#endif
+
+  /* scale according to the error type, in the ordering given by the permutation */
+  for (i=0;i<nconv;i++) {
+    j = eps->perm[i];
+    t = SlepcAbsEigenvalue(eps->eigr[j],eps->eigi[j]);
+    switch (type) {
+      case EPS_ERROR_ABSOLUTE:
+        errors[i] = resnorm[j];
+        break;
+      case EPS_ERROR_RELATIVE:
+        errors[i] = resnorm[j]/(t*vecnorm[j]);
+        break;
+      case EPS_ERROR_BACKWARD:
+        errors[i] = resnorm[j]/((eps->nrma+t*eps->nrmb)*vecnorm[j]);
+        break;
+      default:
+        SETERRQ(PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+    }
+  }
+  PetscCall(PetscFree2(resnorm,vecnorm));
+  if (B) PetscCall(BVDestroy(&W));
+  PetscCall(BVDestroy(&R));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSGetStartVector - Generate a suitable vector to be used as the starting vector
    for the recurrence that builds the right subspace.
@@ -286,7 +286,7 @@ PetscErrorCode EPSConvergedReasonViewFromOptions(EPS eps)
 
 static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *errors;
   PetscInt       i,j,k,nvals;
 
   PetscFunctionBegin;
@@ -299,13 +299,16 @@ static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer
     PetscCall(PetscViewerASCIIPrintf(viewer," No eigenvalues have been found\n\n"));
     PetscFunctionReturn(PETSC_SUCCESS);
   }
+  PetscCall(PetscMalloc1(eps->nconv,&errors));
+  PetscCall(EPSComputeErrorAll(eps,etype,errors));
   for (i=0;i<nvals;i++) {
-    PetscCall(EPSComputeError(eps,i,etype,&error));
-    if (error>=5.0*eps->tol) {
+    if (errors[i]>=5.0*eps->tol) {
       PetscCall(PetscViewerASCIIPrintf(viewer," Problem: some of the first %" PetscInt_FMT " relative errors are higher than the tolerance\n\n",nvals));
+      PetscCall(PetscFree(errors));
       PetscFunctionReturn(PETSC_SUCCESS);
     }
   }
+  PetscCall(PetscFree(errors));
   if (eps->which==EPS_ALL) PetscCall(PetscViewerASCIIPrintf(viewer," Found %" PetscInt_FMT " eigenvalues, all of them computed up to the required tolerance:",nvals));
   else PetscCall(PetscViewerASCIIPrintf(viewer," All requested eigenvalues computed up to the required tolerance:"));
   for (i=0;i<=(nvals-1)/8;i++) {
@@ -322,13 +325,15 @@ static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer
 
 static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error,re,im;
+  PetscReal      *errors,re,im;
   PetscScalar    kr,ki;
   PetscInt       i;
   char           ex[30],sep[]=" ---------------------- --------------------\n";
 
   PetscFunctionBegin;
   if (!eps->nconv) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscMalloc1(eps->nconv,&errors));
+  PetscCall(EPSComputeErrorAll(eps,etype,errors));
   switch (etype) {
     case EPS_ERROR_ABSOLUTE:
       PetscCall(PetscSNPrintf(ex,sizeof(ex),"   ||Ax-k%sx||",eps->isgeneralized?"B":""));
@@ -343,7 +348,6 @@ static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s            k             %s\n%s",sep,ex,sep));
   for (i=0;i<eps->nconv;i++) {
     PetscCall(EPSGetEigenpair(eps,i,&kr,&ki,NULL,NULL));
-    PetscCall(EPSComputeError(eps,i,etype,&error));
 #if defined(PETSC_USE_COMPLEX)
     re = PetscRealPart(kr);
     im = PetscImaginaryPart(kr);
@@ -351,27 +355,28 @@ static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer
     re = kr;
     im = ki;
 #endif
-    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)error));
-    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)error));
+    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)errors[i]));
+    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)errors[i]));
   }
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s",sep));
+  PetscCall(PetscFree(errors));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode EPSErrorView_MATLAB(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *errors;
   PetscInt       i;
   const char     *name;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectGetName((PetscObject)eps,&name));
+  PetscCall(PetscMalloc1(eps->nconv,&errors));
+  PetscCall(EPSComputeErrorAll(eps,etype,errors));
   PetscCall(PetscViewerASCIIPrintf(viewer,"Error_%s = [\n",name));
-  for (i=0;i<eps->nconv;i++) {
-    PetscCall(EPSComputeError(eps,i,etype,&error));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error));
-  }
+  for (i=0;i<eps->nconv;i++) PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)errors[i]));
   PetscCall(PetscViewerASCIIPrintf(viewer,"];\n"));
+  PetscCall(PetscFree(errors));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -723,8 +728,9 @@ PetscErrorCode EPSValuesViewFromOptions(EPS eps)
 +  eps    - the eigensolver context
 -  viewer - the viewer
 
-   Options Database Key:
-.  -eps_view_vectors - output eigenvectors.
+   Options Database Keys:
++  -eps_view_vectors - output eigenvectors.
+-  -eps_view_vectors_stream - write converged basis vectors incrementally during the solve
 
    Notes:
    If PETSc was configured with real scalars, complex conjugate eigenvectors
@@ -806,3 +812,70 @@ PetscErrorCode EPSVectorsViewFromOptions(EPS eps)
   incall = PETSC_FALSE;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   EPSVectorsViewStreamSetUp - Processes the option -eps_view_vectors_stream
+   and, if present, opens the viewer where the columns of the basis will be
+   written incrementally as they converge during the solve. Writing each
+   vector while the iteration is still running overlaps the I/O with the
+   remaining computation, instead of blocking the job with one large dump
+   after EPSSolve(). MPI-IO and aggregator hints can be selected with the
+   standard binary viewer options.
+*/
+PetscErrorCode EPSVectorsViewStreamSetUp(EPS eps)
+{
+  PetscViewer       viewer;
+  PetscBool         flg = PETSC_FALSE;
+  PetscViewerFormat format;
+
+  PetscFunctionBegin;
+  if (eps->vstream) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscOptionsGetViewer(PetscObjectComm((PetscObject)eps),((PetscObject)eps)->options,((PetscObject)eps)->prefix,"-eps_view_vectors_stream",&viewer,&format,&flg));
+  if (flg) {
+    PetscCall(PetscViewerPushFormat(viewer,format));
+    eps->vstream = viewer;
+    eps->nviewed = 0;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSVectorsViewStream - Writes to the stream viewer the columns of the basis
+   that have converged since the last call. Solvers with a locking step call
+   this when nconv grows; columns written are the locked basis vectors, which
+   are no longer modified by the iteration (in the Hermitian case these are
+   the converged eigenvectors).
+*/
+PetscErrorCode EPSVectorsViewStream(EPS eps)
+{
+  PetscInt       i;
+  Vec            v;
+  char           name[16];
+
+  PetscFunctionBegin;
+  for (i=eps->nviewed;i<eps->nconv;i++) {
+    PetscCall(BVGetColumn(eps->V,i,&v));
+    PetscCall(PetscSNPrintf(name,sizeof(name),"V%" PetscInt_FMT,i));
+    PetscCall(PetscObjectSetName((PetscObject)v,name));
+    PetscCall(VecView(v,eps->vstream));
+    PetscCall(BVRestoreColumn(eps->V,i,&v));
+  }
+  eps->nviewed = eps->nconv;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSVectorsViewStreamFinish - Counterpart of EPSVectorsViewStreamSetUp,
+   called at the end of EPSSolve(). Writes the vectors not yet streamed by
+   the solver (all of them, for solvers without a locking hook) and closes
+   the viewer.
+*/
+PetscErrorCode EPSVectorsViewStreamFinish(EPS eps)
+{
+  PetscFunctionBegin;
+  if (!eps->vstream) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(EPSVectorsViewStream(eps));
+  PetscCall(PetscViewerPopFormat(eps->vstream));
+  PetscCall(PetscOptionsRestoreViewer(&eps->vstream));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
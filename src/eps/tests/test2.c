@@ -143,6 +143,12 @@ int main(int argc,char **argv)
          suffix: 2_selective
          args: -eps_lanczos_reorthog selective
          requires: !defined(PETSCTEST_VALGRIND)
+      test:
+         suffix: 2_block
+         args: -eps_lanczos_reorthog full -eps_lanczos_blocksize {{2 4}}
+      test:
+         suffix: 2_window
+         args: -eps_lanczos_reorthog window -eps_lanczos_window_size 8 -eps_lanczos_sketch_size {{0 8}}
 
    testset:
       args: -n 32 -eps_nev 4
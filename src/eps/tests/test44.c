@@ -0,0 +1,117 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests checkpoint/restore of a Krylov-Schur computation.\n\n";
+
+#include <slepceps.h>
+
+/*
+   Creates an EPS ready to compute the largest eigenvalues of A
+*/
+PetscErrorCode CreateSolver(Mat A,PetscInt nev,PetscReal tol,EPS *eps)
+{
+  PetscFunctionBeginUser;
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,eps));
+  PetscCall(EPSSetOperators(*eps,A,NULL));
+  PetscCall(EPSSetProblemType(*eps,EPS_HEP));
+  PetscCall(EPSSetType(*eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetWhichEigenpairs(*eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(*eps,nev,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(EPSSetTolerances(*eps,tol,PETSC_DEFAULT));
+  PetscCall(EPSSetFromOptions(*eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A;           /* problem matrix */
+  EPS            eps;         /* eigenproblem solver context */
+  PetscViewer    viewer;
+  PetscReal      tol=PetscMax(1000*PETSC_MACHINE_EPSILON,1e-9),error;
+  PetscScalar    kr1,kr2;
+  PetscInt       n=30,i,nev=6,Istart,Iend,nconv;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compute the operator matrix that defines the eigensystem, Ax=kx
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        First solve, interrupted by a low iteration limit, then checkpoint
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(CreateSolver(A,nev,tol,&eps));
+  PetscCall(EPSSetTolerances(eps,tol,2));
+  PetscCall(EPSSolve(eps));
+  PetscCall(PetscViewerBinaryOpen(PETSC_COMM_WORLD,"test44.ckpt",FILE_MODE_WRITE,&viewer));
+  PetscCall(EPSKrylovSchurCheckpoint(eps,viewer));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Checkpoint/restore roundtrip with Krylov-Schur\n"));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Resume the computation in a fresh solver with the same settings
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(CreateSolver(A,nev,tol,&eps));
+  PetscCall(PetscViewerBinaryOpen(PETSC_COMM_WORLD,"test44.ckpt",FILE_MODE_READ,&viewer));
+  PetscCall(EPSKrylovSchurRestore(eps,viewer));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Compare the eigenvalues with those of an uninterrupted solve
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  {
+    EPS eps2;
+    PetscCall(CreateSolver(A,nev,tol,&eps2));
+    PetscCall(EPSSolve(eps2));
+    PetscCall(EPSGetConverged(eps,&nconv));
+    for (i=0;i<PetscMin(nconv,nev);i++) {
+      PetscCall(EPSGetEigenpair(eps,i,&kr1,NULL,NULL,NULL));
+      PetscCall(EPSGetEigenpair(eps2,i,&kr2,NULL,NULL,NULL));
+      error = PetscAbsScalar(kr1-kr2)/PetscAbsScalar(kr2);
+      if (error>100*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Eigenvalue %" PetscInt_FMT " differs from the uninterrupted solve: %g\n",i,(double)error));
+    }
+    PetscCall(EPSDestroy(&eps2));
+  }
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      nsize: {{1 2}}
+      requires: !single
+
+TEST*/
@@ -0,0 +1,108 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests spectrum slicing in a standard symmetric eigenproblem.\n\n"
+  "All eigenvalues of the 1-D Laplacian are known analytically, so the test\n"
+  "checks that none of the eigenvalues contained in the interval is missed.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;           /* problem matrix */
+  EPS            eps;         /* eigenproblem solver context */
+  ST             st;
+  PetscReal      int0=0.5,int1=1.5,lambda,dif;
+  PetscScalar    kr;
+  PetscInt       n=30,i,k,count,nconv,Istart,Iend;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compute the operator matrix that defines the eigensystem, Ax=kx
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Solve for all eigenvalues in an interval with spectrum slicing
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_ALL));
+  PetscCall(EPSSetInterval(eps,int0,int1));
+  PetscCall(EPSGetST(eps,&st));
+  PetscCall(STSetType(st,STSINVERT));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSSolve(eps));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Check against the analytically known eigenvalues 2-2*cos(k*pi/(n+1))
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  count = 0;
+  for (k=1;k<=n;k++) {
+    lambda = 2.0-2.0*PetscCosReal(k*PETSC_PI/(n+1));
+    if (lambda>=int0 && lambda<=int1) count++;
+  }
+  PetscCall(EPSGetConverged(eps,&nconv));
+  if (nconv!=count) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Found %" PetscInt_FMT " eigenvalues, but the interval contains %" PetscInt_FMT "\n",nconv,count));
+  else {
+    for (i=0;i<nconv;i++) {
+      PetscCall(EPSGetEigenpair(eps,i,&kr,NULL,NULL,NULL));
+      dif = PETSC_MAX_REAL;
+      for (k=1;k<=n;k++) {
+        lambda = 2.0-2.0*PetscCosReal(k*PETSC_PI/(n+1));
+        dif = PetscMin(dif,PetscAbsReal(PetscRealPart(kr)-lambda));
+      }
+      if (dif>1e-8) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Eigenvalue %g does not match any exact eigenvalue\n",(double)PetscRealPart(kr)));
+    }
+    PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Found all %" PetscInt_FMT " eigenvalues in the interval [%g,%g]\n",nconv,(double)int0,(double)int1));
+  }
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test45_1.out
+      test:
+         suffix: 1
+         nsize: {{1 2}}
+      test:
+         suffix: 1_stochastic
+         nsize: {{1 2}}
+         args: -eps_krylovschur_stochastic_inertia {{16 64}}
+
+TEST*/
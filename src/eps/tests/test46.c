@@ -0,0 +1,106 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests redundant subcommunicator solves, comparing against a regular solve.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;           /* problem matrix */
+  EPS            eps,epsref;  /* redundant and reference solvers */
+  Vec            x,xref;
+  PetscScalar    kr,krref,dot;
+  PetscReal      tol=PetscMax(1000*PETSC_MACHINE_EPSILON,1e-9),error;
+  PetscInt       n=30,i,nev=4,Istart,Iend,nconv,nconvref;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compute the operator matrix that defines the eigensystem, Ax=kx
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Solve redundantly on subcommunicators (-eps_redundant is set
+        in the test harness), then solve normally for reference
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(eps,nev,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(EPSSetTolerances(eps,tol,PETSC_DEFAULT));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&epsref));
+  PetscCall(EPSSetOperators(epsref,A,NULL));
+  PetscCall(EPSSetProblemType(epsref,EPS_HEP));
+  PetscCall(EPSSetWhichEigenpairs(epsref,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(epsref,nev,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(EPSSetTolerances(epsref,tol,PETSC_DEFAULT));
+  PetscCall(EPSSetRedundant(epsref,1));
+  PetscCall(EPSSolve(epsref));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Compare eigenvalues and eigenvectors of both solves
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(EPSGetConverged(eps,&nconv));
+  PetscCall(EPSGetConverged(epsref,&nconvref));
+  PetscCall(MatCreateVecs(A,&x,NULL));
+  PetscCall(MatCreateVecs(A,&xref,NULL));
+  for (i=0;i<PetscMin(PetscMin(nconv,nconvref),nev);i++) {
+    PetscCall(EPSGetEigenpair(eps,i,&kr,NULL,x,NULL));
+    PetscCall(EPSGetEigenpair(epsref,i,&krref,NULL,xref,NULL));
+    error = PetscAbsScalar(kr-krref)/PetscAbsScalar(krref);
+    if (error>100*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Eigenvalue %" PetscInt_FMT " of the redundant solve differs: %g\n",i,(double)error));
+    /* eigenvectors are unique up to a unimodular factor, compare |x'*xref| */
+    PetscCall(VecDot(x,xref,&dot));
+    if (PetscAbsReal(PetscAbsScalar(dot)-(PetscReal)1.0)>1000*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Eigenvector %" PetscInt_FMT " of the redundant solve differs: |x'*xref|=%g\n",i,(double)PetscAbsScalar(dot)));
+  }
+
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&xref));
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(EPSDestroy(&epsref));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      nsize: {{2 3}}
+      args: -eps_redundant 2
+      requires: !single
+      output_file: output/test46_1.out
+
+TEST*/
@@ -294,6 +294,20 @@ PetscErrorCode MyEigenSort(PetscScalar ar,PetscScalar ai,PetscScalar br,PetscSca
       requires: x
       output_file: output/test9_1.out
 
+   test:
+      suffix: 9
+      nsize: {{1 2}}
+      args: -eps_nev 4 -eps_krylovschur_pipelined -bv_orthog_refine {{ifneeded never}}
+      requires: double
+      output_file: output/test9_1.out
+
+   test:
+      suffix: 10
+      nsize: {{1 2}}
+      args: -eps_nev 4 -eps_krylovschur_blocksize {{2 5}}
+      requires: double
+      output_file: output/test9_1.out
+
    test:
       suffix: 5_ksphpddm
       args: -eps_nev 3 -st_type sinvert -eps_target .5 -st_ksp_type hpddm -st_ksp_hpddm_type gcrodr -eps_ncv 10
@@ -0,0 +1,215 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Eigensolver benchmark battery over a set of generated operators.\n"
+  "Runs one or more solvers on a 2-D Laplacian, a Markov chain matrix and a\n"
+  "2x2 block tiling of the Laplacian, recording iteration counts, operator\n"
+  "applications and time to solution. By default only the convergence status\n"
+  "is printed, so the output is machine-independent; use -report to print\n"
+  "the collected metrics.\n\n"
+  "The command line options are:\n"
+  "  -m <m>, where <m> = base grid parameter for the generated operators.\n"
+  "  -battery_types <list>, comma-separated list of EPS types to run.\n\n";
+
+#include <slepceps.h>
+#include <petsctime.h>
+
+/*
+   User-defined routines
+*/
+PetscErrorCode MatLaplacian2D(PetscInt m,Mat *A);
+PetscErrorCode MatMarkovModel(PetscInt m,Mat *A);
+PetscErrorCode RunCase(const char *pname,Mat A,EPSProblemType ptype,EPSWhich which,const char *type,PetscBool report);
+
+int main(int argc,char **argv)
+{
+  Mat            L,M,T;           /* generated operator matrices */
+  char           *types[8];
+  PetscInt       i,j,m=30,ntypes=8;
+  PetscBool      report,flg;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscLogDefaultBegin());
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL));
+  PetscCall(PetscOptionsGetStringArray(NULL,NULL,"-battery_types",types,&ntypes,&flg));
+  if (!flg) {
+    ntypes = 1;
+    PetscCall(PetscStrallocpy(EPSKRYLOVSCHUR,&types[0]));
+  }
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-report",&report));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nEigensolver benchmark battery, m=%" PetscInt_FMT "\n\n",m));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Generate the battery of operator matrices
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatLaplacian2D(m,&L));
+  PetscCall(MatMarkovModel(m,&M));
+  PetscCall(MatCreateTile(2.0,L,-1.0,L,-1.0,L,2.0,L,&T));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Run every requested solver on every operator
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (i=0;i<3;i++) {
+    for (j=0;j<ntypes;j++) {
+      switch (i) {
+        case 0:
+          PetscCall(RunCase("laplacian2d",L,EPS_HEP,EPS_SMALLEST_REAL,types[j],report));
+          break;
+        case 1:
+          PetscCall(RunCase("markov",M,EPS_NHEP,EPS_LARGEST_REAL,types[j],report));
+          break;
+        case 2:
+          PetscCall(RunCase("tile",T,EPS_HEP,EPS_SMALLEST_REAL,types[j],report));
+          break;
+      }
+    }
+  }
+
+  for (j=0;j<ntypes;j++) PetscCall(PetscFree(types[j]));
+  PetscCall(MatDestroy(&L));
+  PetscCall(MatDestroy(&M));
+  PetscCall(MatDestroy(&T));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*
+   RunCase - solve one eigenproblem with the given solver type and print a
+   one-line summary; with report=PETSC_TRUE also print iteration count,
+   number of operator applications and elapsed time.
+*/
+PetscErrorCode RunCase(const char *pname,Mat A,EPSProblemType ptype,EPSWhich which,const char *type,PetscBool report)
+{
+  EPS                eps;
+  PetscEventPerfInfo info0,info1;
+  PetscLogEvent      event;
+  PetscLogDouble     t0,t1;
+  PetscInt           N,nev,nconv,its,matmults=0;
+  PetscBool          herm;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatGetSize(A,&N,NULL));
+  /* LOBPCG is restricted to Hermitian problems, skip it for the Markov matrix */
+  PetscCall(PetscStrcmp(type,EPSLOBPCG,&herm));
+  if (herm && ptype!=EPS_HEP) {
+    PetscCall(PetscPrintf(PETSC_COMM_WORLD," %-12s N=%-6" PetscInt_FMT " %-14s skipped (requires a Hermitian problem)\n",pname,N,type));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,ptype));
+  PetscCall(EPSSetWhichEigenpairs(eps,which));
+  PetscCall(EPSSetDimensions(eps,4,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(EPSSetType(eps,type));
+  PetscCall(EPSSetFromOptions(eps));
+
+  PetscCall(PetscLogEventGetId("MatMult",&event));
+  if (event>=0) PetscCall(PetscLogEventGetPerfInfo(PETSC_DETERMINE,event,&info0));
+  PetscCall(PetscTime(&t0));
+  PetscCall(EPSSolve(eps));
+  PetscCall(PetscTime(&t1));
+  if (event>=0) {
+    PetscCall(PetscLogEventGetPerfInfo(PETSC_DETERMINE,event,&info1));
+    matmults = (PetscInt)(info1.count-info0.count);
+  }
+
+  PetscCall(EPSGetDimensions(eps,&nev,NULL,NULL));
+  PetscCall(EPSGetConverged(eps,&nconv));
+  PetscCall(EPSGetIterationNumber(eps,&its));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," %-12s N=%-6" PetscInt_FMT " %-14s %s\n",pname,N,type,nconv>=nev?"all requested eigenvalues converged":"NOT all requested eigenvalues converged"));
+  if (report) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"   its=%" PetscInt_FMT " matmults=%" PetscInt_FMT " time=%g\n",its,matmults,(double)(t1-t0)));
+
+  PetscCall(EPSDestroy(&eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   MatLaplacian2D - standard 5-point stencil Laplacian on an m x m grid.
+*/
+PetscErrorCode MatLaplacian2D(PetscInt m,Mat *A)
+{
+  PetscInt N=m*m,II,Istart,Iend,i,j;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatCreate(PETSC_COMM_WORLD,A));
+  PetscCall(MatSetSizes(*A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(*A));
+  PetscCall(MatGetOwnershipRange(*A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/m; j = II-i*m;
+    if (i>0) PetscCall(MatSetValue(*A,II,II-m,-1.0,INSERT_VALUES));
+    if (i<m-1) PetscCall(MatSetValue(*A,II,II+m,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(*A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<m-1) PetscCall(MatSetValue(*A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(*A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(*A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(*A,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   MatMarkovModel - matrix representing a random walk on a triangular grid,
+   same generator used in ex5.c. The transpose of the matrix is stochastic,
+   so the rightmost eigenvalue is known to be 1.
+*/
+PetscErrorCode MatMarkovModel(PetscInt m,Mat *A)
+{
+  const PetscReal cst = 0.5/(PetscReal)(m-1);
+  PetscReal       pd,pu;
+  PetscInt        N=m*(m+1)/2,Istart,Iend,i,j,jmax,ix=0;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatCreate(PETSC_COMM_WORLD,A));
+  PetscCall(MatSetSizes(*A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(*A));
+  PetscCall(MatGetOwnershipRange(*A,&Istart,&Iend));
+  for (i=1;i<=m;i++) {
+    jmax = m-i+1;
+    for (j=1;j<=jmax;j++) {
+      ix = ix + 1;
+      if (ix-1<Istart || ix>Iend) continue;  /* compute only owned rows */
+      if (j!=jmax) {
+        pd = cst*(PetscReal)(i+j-1);
+        /* north */
+        if (i==1) PetscCall(MatSetValue(*A,ix-1,ix,2*pd,INSERT_VALUES));
+        else PetscCall(MatSetValue(*A,ix-1,ix,pd,INSERT_VALUES));
+        /* east */
+        if (j==1) PetscCall(MatSetValue(*A,ix-1,ix+jmax-1,2*pd,INSERT_VALUES));
+        else PetscCall(MatSetValue(*A,ix-1,ix+jmax-1,pd,INSERT_VALUES));
+      }
+      /* south */
+      pu = 0.5 - cst*(PetscReal)(i+j-3);
+      if (j>1) PetscCall(MatSetValue(*A,ix-1,ix-2,pu,INSERT_VALUES));
+      /* west */
+      if (i>1) PetscCall(MatSetValue(*A,ix-1,ix-jmax-2,pu,INSERT_VALUES));
+    }
+  }
+  PetscCall(MatAssemblyBegin(*A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(*A,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -m 8
+
+   test:
+      suffix: 2
+      args: -m 8 -battery_types krylovschur,lobpcg
+
+TEST*/
@@ -59,8 +59,7 @@ PetscErrorCode LMEInitializePackage(void)
   PetscCall(PetscClassIdRegister("Lin. Matrix Equation",&LME_CLASSID));
   /* Register Constructors */
   PetscCall(LMERegisterAll());
-  /* Register Monitors */
-  PetscCall(LMEMonitorRegisterAll());
+  /* Monitors are registered on demand, see LMEMonitorSetFromOptions() */
   /* Register Events */
   PetscCall(PetscLogEventRegister("LMESetUp",LME_CLASSID,&LME_SetUp));
   PetscCall(PetscLogEventRegister("LMESolve",LME_CLASSID,&LME_Solve));
@@ -82,6 +82,7 @@ PetscErrorCode LMEView(LME lme,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer,"  number of column vectors (ncv): %" PetscInt_FMT "\n",lme->ncv));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  maximum number of iterations: %" PetscInt_FMT "\n",lme->max_it));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  tolerance: %g\n",(double)lme->tol));
+    if (lme->ranktol>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  tolerance for rank truncation of the solution: %g\n",(double)lme->ranktol));
   } else PetscTryTypeMethod(lme,view,viewer);
   PetscCall(PetscViewerPushFormat(viewer,PETSC_VIEWER_ASCII_INFO));
   if (!lme->V) PetscCall(LMEGetBV(lme,&lme->V));
@@ -223,6 +224,7 @@ PetscErrorCode LMECreate(MPI_Comm comm,LME *outlme)
   lme->max_it          = PETSC_DEFAULT;
   lme->ncv             = PETSC_DEFAULT;
   lme->tol             = PETSC_DEFAULT;
+  lme->ranktol         = PETSC_DEFAULT;
   lme->errorifnotconverged = PETSC_FALSE;
 
   lme->numbermonitors  = 0;
@@ -16,7 +16,9 @@
 
 /*
    LMEDenseRankSVD - given a square matrix A, compute its SVD U*S*V', and determine the
-   numerical rank. On exit, U contains U*S and A is overwritten with V'
+   numerical rank. On exit, U contains U*S and A is overwritten with V'. The rank is
+   determined with the tolerance set via LMESetRankTolerance(), or a strict tolerance
+   based on the machine precision if none was given.
 */
 PetscErrorCode LMEDenseRankSVD(LME lme,PetscInt n,PetscScalar *A,PetscInt lda,PetscScalar *U,PetscInt ldu,PetscInt *rank)
 {
@@ -39,7 +41,8 @@ PetscErrorCode LMEDenseRankSVD(LME lme,PetscInt n,PetscScalar *A,PetscInt lda,Pe
 #endif
   PetscCall(PetscFPTrapPop());
   SlepcCheckLapackInfo("gesvd",info);
-  tol = 10*PETSC_MACHINE_EPSILON*n*sg[0];
+  if (lme->ranktol>0.0) tol = lme->ranktol*sg[0];
+  else tol = 10*PETSC_MACHINE_EPSILON*n*sg[0];
   for (j=0;j<n;j++) {
     if (sg[j]>tol) {
       for (i=0;i<n;i++) U[i+j*n] *= sg[j];
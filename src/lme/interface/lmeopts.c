@@ -47,6 +47,9 @@ PetscErrorCode LMEMonitorSetFromOptions(LME lme,const char opt[],const char name
   PetscCall(PetscOptionsGetViewer(PetscObjectComm((PetscObject)lme),((PetscObject)lme)->options,((PetscObject)lme)->prefix,opt,&viewer,&format,&flg));
   if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
 
+  /* Register built-in monitors the first time one is requested */
+  PetscCall(LMEMonitorRegisterAll());
+
   PetscCall(PetscViewerGetType(viewer,&vtype));
   PetscCall(SlepcMonitorMakeKey_Internal(name,vtype,format,key));
   PetscCall(PetscFunctionListFind(LMEMonitorList,key,&mfunc));
@@ -117,6 +120,9 @@ PetscErrorCode LMESetFromOptions(LME lme)
     PetscCall(PetscOptionsInt("-lme_ncv","Number of basis vectors","LMESetDimensions",lme->ncv,&i,&flg));
     if (flg) PetscCall(LMESetDimensions(lme,i));
 
+    PetscCall(PetscOptionsReal("-lme_rank_tolerance","Relative tolerance for rank truncation of the solution","LMESetRankTolerance",lme->ranktol,&r,&flg));
+    if (flg) PetscCall(LMESetRankTolerance(lme,r));
+
     PetscCall(PetscOptionsBool("-lme_error_if_not_converged","Generate error if solver does not converge","LMESetErrorIfNotConverged",lme->errorifnotconverged,&lme->errorifnotconverged,NULL));
 
     /* -----------------------------------------------------------------------*/
@@ -362,6 +368,70 @@ PetscErrorCode LMESetDimensions(LME lme,PetscInt ncv)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   LMESetRankTolerance - Sets the relative tolerance used to truncate the rank
+   of the computed solution.
+
+   Logically Collective
+
+   Input Parameters:
++  lme - the linear matrix equation solver context
+-  tol - the rank truncation tolerance
+
+   Options Database Keys:
+.  -lme_rank_tolerance <tol> - Sets the rank truncation tolerance
+
+   Notes:
+   When the solution is returned in factored form X=X1*X1', the columns of X1
+   associated with singular values below tol relative to the largest singular
+   value are discarded. This keeps the memory devoted to the solution factor
+   bounded, which is especially relevant when solving a sequence of equations.
+
+   Use PETSC_DEFAULT to assign a strict default based on the machine precision,
+   so that only numerically negligible columns are discarded.
+
+   Level: intermediate
+
+.seealso: LMEGetRankTolerance(), LMESetTolerances()
+@*/
+PetscErrorCode LMESetRankTolerance(LME lme,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(lme,LME_CLASSID,1);
+  PetscValidLogicalCollectiveReal(lme,tol,2);
+  if (tol == (PetscReal)PETSC_DEFAULT) lme->ranktol = PETSC_DEFAULT;
+  else {
+    PetscCheck(tol>0.0 && tol<1.0,PetscObjectComm((PetscObject)lme),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be in (0,1)");
+    lme->ranktol = tol;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   LMEGetRankTolerance - Gets the relative tolerance used to truncate the rank
+   of the computed solution.
+
+   Not Collective
+
+   Input Parameter:
+.  lme - the linear matrix equation solver context
+
+   Output Parameter:
+.  tol - the rank truncation tolerance
+
+   Level: intermediate
+
+.seealso: LMESetRankTolerance()
+@*/
+PetscErrorCode LMEGetRankTolerance(LME lme,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(lme,LME_CLASSID,1);
+  PetscAssertPointer(tol,2);
+  *tol = lme->ranktol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    LMESetErrorIfNotConverged - Causes LMESolve() to generate an error if the
    solver has not converged.
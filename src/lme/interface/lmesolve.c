@@ -168,17 +168,20 @@ PetscErrorCode LMEGetErrorEstimate(LME lme,PetscReal *errest)
 /*
    LMEComputeResidualNorm_Lyapunov - Computes the Frobenius norm of the residual matrix
    associated with the Lyapunov equation.
+
+   With the residual R = C1*C1'+A*X1*X1'+X1*X1'*A' expressed in terms of the low-rank
+   factors, ||R||_F^2 = trace(R'*R) can be evaluated from traces of small Gram matrices
+   of the factors, so the residual matrix is never formed explicitly and the cost is
+   proportional to the square of the factor ranks.
 */
 static PetscErrorCode LMEComputeResidualNorm_Lyapunov(LME lme,PetscReal *norm)
 {
-  PetscInt          j,n,N,k,l,lda,ldb;
-  PetscBLASInt      n_,N_,k_,l_,lda_,ldb_;
-  PetscScalar       *Rarray,alpha=1.0,beta=0.0;
-  const PetscScalar *A,*B;
-  BV                W,AX,X1,C1;
-  Mat               R,X1m,C1m;
-  Vec               v,w;
-  VecScatter        vscat;
+  PetscInt          i,j,k,l;
+  PetscReal         t;
+  PetscScalar       sum;
+  const PetscScalar *mcc,*mca,*mcx,*maa,*max,*mxx;
+  BV                AX,X1,C1;
+  Mat               X1m,C1m,Mcc,Mca,Mcx,Maa,Max,Mxx;
 
   PetscFunctionBegin;
   PetscCall(MatLRCGetMats(lme->C,NULL,&C1m,NULL,NULL));
@@ -187,97 +190,56 @@ static PetscErrorCode LMEComputeResidualNorm_Lyapunov(LME lme,PetscReal *norm)
   PetscCall(BVSetFromOptions(C1));
   PetscCall(BVCreateFromMat(X1m,&X1));
   PetscCall(BVSetFromOptions(X1));
-  PetscCall(BVGetSizes(X1,&n,&N,&k));
-  PetscCall(BVGetSizes(C1,NULL,NULL,&l));
-  PetscCall(PetscBLASIntCast(n,&n_));
-  PetscCall(PetscBLASIntCast(N,&N_));
-  PetscCall(PetscBLASIntCast(k,&k_));
-  PetscCall(PetscBLASIntCast(l,&l_));
-
-  /* create W to store a redundant copy of a BV in each process */
-  PetscCall(BVCreate(PETSC_COMM_SELF,&W));
-  PetscCall(BVSetSizes(W,N,N,k));
-  PetscCall(BVSetFromOptions(W));
-  PetscCall(BVGetColumn(X1,0,&v));
-  PetscCall(VecScatterCreateToAll(v,&vscat,NULL));
-  PetscCall(BVRestoreColumn(X1,0,&v));
+  PetscCall(BVGetActiveColumns(X1,NULL,&k));
+  PetscCall(BVGetActiveColumns(C1,NULL,&l));
 
   /* create AX to hold the product A*X1 */
   PetscCall(BVDuplicate(X1,&AX));
   PetscCall(BVMatMult(X1,lme->A,AX));
 
-  /* create dense matrix to hold the residual R=C1*C1'+AX*X1'+X1*AX' */
-  PetscCall(MatCreateDense(PetscObjectComm((PetscObject)lme),n,n,N,N,NULL,&R));
-
-  /* R=C1*C1' */
-  PetscCall(MatDenseGetArrayWrite(R,&Rarray));
-  for (j=0;j<l;j++) {
-    PetscCall(BVGetColumn(C1,j,&v));
-    PetscCall(BVGetColumn(W,j,&w));
-    PetscCall(VecScatterBegin(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(VecScatterEnd(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(BVRestoreColumn(C1,j,&v));
-    PetscCall(BVRestoreColumn(W,j,&w));
-  }
-  if (n) {
-    PetscCall(BVGetArrayRead(C1,&A));
-    PetscCall(BVGetLeadingDimension(C1,&lda));
-    PetscCall(PetscBLASIntCast(lda,&lda_));
-    PetscCall(BVGetArrayRead(W,&B));
-    PetscCall(BVGetLeadingDimension(W,&ldb));
-    PetscCall(PetscBLASIntCast(ldb,&ldb_));
-    PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&n_,&N_,&l_,&alpha,(PetscScalar*)A,&lda_,(PetscScalar*)B,&ldb_,&beta,Rarray,&n_));
-    PetscCall(BVRestoreArrayRead(C1,&A));
-    PetscCall(BVRestoreArrayRead(W,&B));
-  }
-  beta = 1.0;
-
-  /* R+=AX*X1' */
-  for (j=0;j<k;j++) {
-    PetscCall(BVGetColumn(X1,j,&v));
-    PetscCall(BVGetColumn(W,j,&w));
-    PetscCall(VecScatterBegin(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(VecScatterEnd(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(BVRestoreColumn(X1,j,&v));
-    PetscCall(BVRestoreColumn(W,j,&w));
-  }
-  if (n) {
-    PetscCall(BVGetArrayRead(AX,&A));
-    PetscCall(BVGetLeadingDimension(AX,&lda));
-    PetscCall(PetscBLASIntCast(lda,&lda_));
-    PetscCall(BVGetArrayRead(W,&B));
-    PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&n_,&N_,&k_,&alpha,(PetscScalar*)A,&lda_,(PetscScalar*)B,&ldb_,&beta,Rarray,&n_));
-    PetscCall(BVRestoreArrayRead(AX,&A));
-    PetscCall(BVRestoreArrayRead(W,&B));
-  }
-
-  /* R+=X1*AX' */
-  for (j=0;j<k;j++) {
-    PetscCall(BVGetColumn(AX,j,&v));
-    PetscCall(BVGetColumn(W,j,&w));
-    PetscCall(VecScatterBegin(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(VecScatterEnd(vscat,v,w,INSERT_VALUES,SCATTER_FORWARD));
-    PetscCall(BVRestoreColumn(AX,j,&v));
-    PetscCall(BVRestoreColumn(W,j,&w));
-  }
-  if (n) {
-    PetscCall(BVGetArrayRead(X1,&A));
-    PetscCall(BVGetLeadingDimension(AX,&lda));
-    PetscCall(PetscBLASIntCast(lda,&lda_));
-    PetscCall(BVGetArrayRead(W,&B));
-    PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&n_,&N_,&k_,&alpha,(PetscScalar*)A,&lda_,(PetscScalar*)B,&ldb_,&beta,Rarray,&n_));
-    PetscCall(BVRestoreArrayRead(X1,&A));
-    PetscCall(BVRestoreArrayRead(W,&B));
-  }
-  PetscCall(MatDenseRestoreArrayWrite(R,&Rarray));
-
-  /* compute ||R||_F */
-  PetscCall(MatNorm(R,NORM_FROBENIUS,norm));
-
-  PetscCall(BVDestroy(&W));
-  PetscCall(VecScatterDestroy(&vscat));
+  /* Gram matrices of the factors */
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,l,l,NULL,&Mcc));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,l,k,NULL,&Mca));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,l,k,NULL,&Mcx));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,k,NULL,&Maa));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,k,NULL,&Max));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,k,NULL,&Mxx));
+  PetscCall(BVDot(C1,C1,Mcc));    /* Mcc = C1'*C1 */
+  PetscCall(BVDot(AX,C1,Mca));    /* Mca = C1'*A*X1 */
+  PetscCall(BVDot(X1,C1,Mcx));    /* Mcx = C1'*X1 */
+  PetscCall(BVDot(AX,AX,Maa));    /* Maa = (A*X1)'*A*X1 */
+  PetscCall(BVDot(X1,AX,Max));    /* Max = (A*X1)'*X1 */
+  PetscCall(BVDot(X1,X1,Mxx));    /* Mxx = X1'*X1 */
+
+  /* ||R||_F^2 = tr((Mcc)^2) + 4*Re(tr(Mca*Mcx')) + 2*Re(tr(Max^2)) + 2*tr(Maa*Mxx) */
+  PetscCall(MatDenseGetArrayRead(Mcc,&mcc));
+  PetscCall(MatDenseGetArrayRead(Mca,&mca));
+  PetscCall(MatDenseGetArrayRead(Mcx,&mcx));
+  PetscCall(MatDenseGetArrayRead(Maa,&maa));
+  PetscCall(MatDenseGetArrayRead(Max,&max));
+  PetscCall(MatDenseGetArrayRead(Mxx,&mxx));
+  t = 0.0;
+  for (j=0;j<l;j++) for (i=0;i<l;i++) t += PetscSqr(PetscAbsScalar(mcc[i+j*l]));
+  for (j=0;j<k;j++) for (i=0;i<l;i++) t += 4.0*PetscRealPart(mca[i+j*l]*PetscConj(mcx[i+j*l]));
+  sum = 0.0;
+  for (j=0;j<k;j++) for (i=0;i<k;i++) sum += max[i+j*k]*max[j+i*k];
+  t += 2.0*PetscRealPart(sum);
+  for (j=0;j<k;j++) for (i=0;i<k;i++) t += 2.0*PetscRealPart(maa[i+j*k]*PetscConj(mxx[i+j*k]));
+  PetscCall(MatDenseRestoreArrayRead(Mcc,&mcc));
+  PetscCall(MatDenseRestoreArrayRead(Mca,&mca));
+  PetscCall(MatDenseRestoreArrayRead(Mcx,&mcx));
+  PetscCall(MatDenseRestoreArrayRead(Maa,&maa));
+  PetscCall(MatDenseRestoreArrayRead(Max,&max));
+  PetscCall(MatDenseRestoreArrayRead(Mxx,&mxx));
+  *norm = PetscSqrtReal(PetscMax(t,0.0));   /* guard against cancellation for tiny residuals */
+
+  PetscCall(MatDestroy(&Mcc));
+  PetscCall(MatDestroy(&Mca));
+  PetscCall(MatDestroy(&Mcx));
+  PetscCall(MatDestroy(&Maa));
+  PetscCall(MatDestroy(&Max));
+  PetscCall(MatDestroy(&Mxx));
   PetscCall(BVDestroy(&AX));
-  PetscCall(MatDestroy(&R));
   PetscCall(BVDestroy(&C1));
   PetscCall(BVDestroy(&X1));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -296,9 +258,11 @@ static PetscErrorCode LMEComputeResidualNorm_Lyapunov(LME lme,PetscReal *norm)
 .  error - the error
 
    Notes:
-   This function is not scalable (in terms of memory or parallel communication),
-   so it should not be called except in the case of small problem size. For
-   large equations, use LMEGetErrorEstimate().
+   The residual norm is evaluated from the low-rank factors of the right-hand
+   side and the solution, without building any matrix of the size of the
+   problem, so the cost is proportional to the square of the factor ranks.
+   The cheaper estimate computed internally by the solver is available with
+   LMEGetErrorEstimate().
 
    Level: advanced
 
@@ -25,6 +25,11 @@
 
 #include <slepc/private/mfnimpl.h>
 
+typedef struct {
+  PetscBool pi;        /* use a PI controller to select the sub-step size */
+  PetscReal safety;    /* safety factor of the step-size controller */
+} MFN_EXPOKIT;
+
 static PetscErrorCode MFNSetUp_Expokit(MFN mfn)
 {
   PetscInt       N;
@@ -43,13 +48,14 @@ static PetscErrorCode MFNSetUp_Expokit(MFN mfn)
 
 static PetscErrorCode MFNSolve_Expokit(MFN mfn,Vec b,Vec x)
 {
+  MFN_EXPOKIT       *ctx = (MFN_EXPOKIT*)mfn->data;
   PetscInt          mxstep,mxrej,m,mb,ld,i,j,ireject,mx,k1;
   Vec               v,r;
   Mat               H,M=NULL,K=NULL;
   FN                fn;
   PetscScalar       *Harray,*B,*F,*betaF,t,sgn,sfactor;
   const PetscScalar *pK;
-  PetscReal         anorm,avnorm,tol,err_loc,rndoff,t_out,t_new,t_now,t_step;
+  PetscReal         anorm,avnorm,tol,err_loc,err_old,rndoff,t_out,t_new,t_now,t_step;
   PetscReal         xm,fact,s,p1,p2,beta,beta2,gamma,delta;
   PetscBool         breakdown;
 
@@ -58,8 +64,9 @@ static PetscErrorCode MFNSolve_Expokit(MFN mfn,Vec b,Vec x)
   tol = mfn->tol;
   mxstep = mfn->max_it;
   mxrej = 10;
-  gamma = 0.9;
+  gamma = ctx->safety;
   delta = 1.2;
+  err_old = tol;
   mb    = m;
   PetscCall(FNGetScale(mfn->fn,&t,&sfactor));
   PetscCall(FNDuplicate(mfn->fn,PetscObjectComm((PetscObject)mfn->fn),&fn));
@@ -160,11 +167,15 @@ static PetscErrorCode MFNSolve_Expokit(MFN mfn,Vec b,Vec x)
     t_now = t_now+t_step;
     if (t_now>=t_out) mfn->reason = MFN_CONVERGED_TOL;
     else {
-      t_new = gamma*t_step*PetscPowReal((t_step*tol)/err_loc,xm);
+      /* with the PI controller the error of the previous accepted sub-step also
+         enters the formula, damping oscillations of the sub-step size */
+      if (ctx->pi) t_new = gamma*t_step*PetscPowReal((t_step*tol)/err_loc,0.7*xm)*PetscPowReal(err_old/err_loc,0.4*xm);
+      else t_new = gamma*t_step*PetscPowReal((t_step*tol)/err_loc,xm);
       s = PetscPowReal(10.0,PetscFloorReal(PetscLog10Real(t_new))-1);
       t_new = PetscCeilReal(t_new/s)*s;
     }
     err_loc = PetscMax(err_loc,rndoff);
+    err_old = err_loc;
     if (mfn->its==mxstep) mfn->reason = MFN_DIVERGED_ITS;
     PetscCall(MFNMonitor(mfn,mfn->its,err_loc));
   }
@@ -179,10 +190,147 @@ static PetscErrorCode MFNSolve_Expokit(MFN mfn,Vec b,Vec x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode MFNExpokitSetStepController_Expokit(MFN mfn,PetscBool pi,PetscReal safety)
+{
+  MFN_EXPOKIT    *ctx = (MFN_EXPOKIT*)mfn->data;
+
+  PetscFunctionBegin;
+  ctx->pi = pi;
+  if (safety == (PetscReal)PETSC_DEFAULT) ctx->safety = 0.9;
+  else {
+    PetscCheck(safety>0.0 && safety<1.0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_OUTOFRANGE,"The safety argument must be in (0,1)");
+    ctx->safety = safety;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNExpokitSetStepController - Sets the parameters of the controller that
+   selects the size of the internal sub-steps.
+
+   Logically Collective
+
+   Input Parameters:
++  mfn    - matrix function solver
+.  pi     - whether a PI controller is used instead of the classical one
+-  safety - safety factor applied when predicting the next sub-step size
+
+   Options Database Keys:
++  -mfn_expokit_pi_controller - Activates the PI controller
+-  -mfn_expokit_safety <safety> - Sets the safety factor
+
+   Notes:
+   The classical controller predicts each sub-step size from the local error
+   estimate of the last sub-step only. The PI controller also takes into
+   account the error of the previous accepted sub-step, which damps
+   oscillations of the sub-step size and typically results in fewer rejected
+   sub-steps when the solution changes smoothly.
+
+   Use PETSC_DEFAULT in the safety argument to restore the default value.
+
+   Level: advanced
+
+.seealso: MFNExpokitGetStepController(), MFNSetTolerances()
+@*/
+PetscErrorCode MFNExpokitSetStepController(MFN mfn,PetscBool pi,PetscReal safety)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidLogicalCollectiveBool(mfn,pi,2);
+  PetscValidLogicalCollectiveReal(mfn,safety,3);
+  PetscTryMethod(mfn,"MFNExpokitSetStepController_C",(MFN,PetscBool,PetscReal),(mfn,pi,safety));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNExpokitGetStepController_Expokit(MFN mfn,PetscBool *pi,PetscReal *safety)
+{
+  MFN_EXPOKIT *ctx = (MFN_EXPOKIT*)mfn->data;
+
+  PetscFunctionBegin;
+  if (pi)     *pi = ctx->pi;
+  if (safety) *safety = ctx->safety;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNExpokitGetStepController - Gets the parameters of the controller that
+   selects the size of the internal sub-steps.
+
+   Not Collective
+
+   Input Parameter:
+.  mfn - matrix function solver
+
+   Output Parameters:
++  pi     - whether a PI controller is used instead of the classical one
+-  safety - safety factor applied when predicting the next sub-step size
+
+   Level: advanced
+
+.seealso: MFNExpokitSetStepController()
+@*/
+PetscErrorCode MFNExpokitGetStepController(MFN mfn,PetscBool *pi,PetscReal *safety)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscUseMethod(mfn,"MFNExpokitGetStepController_C",(MFN,PetscBool*,PetscReal*),(mfn,pi,safety));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNSetFromOptions_Expokit(MFN mfn,PetscOptionItems *PetscOptionsObject)
+{
+  PetscReal      r;
+  PetscBool      b,flg,flg2;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"MFN Expokit Options");
+
+    PetscCall(MFNExpokitGetStepController(mfn,&b,&r));
+    PetscCall(PetscOptionsBool("-mfn_expokit_pi_controller","Use a PI controller for the sub-step size","MFNExpokitSetStepController",b,&b,&flg));
+    PetscCall(PetscOptionsReal("-mfn_expokit_safety","Safety factor of the step-size controller","MFNExpokitSetStepController",r,&r,&flg2));
+    if (flg || flg2) PetscCall(MFNExpokitSetStepController(mfn,b,r));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNView_Expokit(MFN mfn,PetscViewer viewer)
+{
+  MFN_EXPOKIT    *ctx = (MFN_EXPOKIT*)mfn->data;
+  PetscBool      isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii) PetscCall(PetscViewerASCIIPrintf(viewer,"  %s sub-step controller with safety factor %g\n",ctx->pi?"PI":"classical",(double)ctx->safety));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNDestroy_Expokit(MFN mfn)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscFree(mfn->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNExpokitSetStepController_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNExpokitGetStepController_C",NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode MFNCreate_Expokit(MFN mfn)
 {
+  MFN_EXPOKIT    *ctx;
+
   PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  mfn->data   = (void*)ctx;
+  ctx->pi     = PETSC_FALSE;
+  ctx->safety = 0.9;
+
   mfn->ops->solve          = MFNSolve_Expokit;
   mfn->ops->setup          = MFNSetUp_Expokit;
+  mfn->ops->setfromoptions = MFNSetFromOptions_Expokit;
+  mfn->ops->destroy        = MFNDestroy_Expokit;
+  mfn->ops->view           = MFNView_Expokit;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNExpokitSetStepController_C",MFNExpokitSetStepController_Expokit));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNExpokitGetStepController_C",MFNExpokitGetStepController_Expokit));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -25,41 +25,211 @@
 */
 
 #include <slepc/private/mfnimpl.h>
+#include <slepcds.h>
 #include <slepcblaslapack.h>
 
+typedef struct {
+  PetscBool twopass;   /* use the two-pass Lanczos variant for Hermitian operators */
+  PetscInt  nrec;      /* number of Ritz vectors to recycle between solves */
+  PetscInt  nu;        /* number of vectors currently stored in U */
+  BV        U;         /* recycled approximate invariant subspace */
+  Mat       T;         /* projection of the operator onto the recycled subspace */
+  DS        ds;        /* used to extract the dominant Ritz vectors */
+  PetscBool trans;     /* the recycled subspace comes from a transpose solve */
+} MFN_KRYLOV;
+
 static PetscErrorCode MFNSetUp_Krylov(MFN mfn)
 {
-  PetscInt       N;
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+  PetscInt       N,ncv;
+  PetscBool      set,flg;
 
   PetscFunctionBegin;
   PetscCall(MatGetSize(mfn->A,&N,NULL));
   if (mfn->ncv==PETSC_DEFAULT) mfn->ncv = PetscMin(30,N);
   if (mfn->max_it==PETSC_DEFAULT) mfn->max_it = 100;
-  PetscCall(MFNAllocateSolution(mfn,1));
+  if (ctx->twopass) {
+    PetscCall(MatIsHermitianKnown(mfn->A,&set,&flg));
+    PetscCheck(set && flg,PetscObjectComm((PetscObject)mfn),PETSC_ERR_SUP,"The two-pass variant requires a hermitian operator (use MatSetOption to mark it as such)");
+    PetscCheck(!ctx->nrec,PetscObjectComm((PetscObject)mfn),PETSC_ERR_SUP,"The two-pass variant cannot be combined with recycling");
+    /* only the starting vector of the current restart cycle is kept in V */
+    ncv = mfn->ncv; mfn->ncv = 1;
+    PetscCall(MFNAllocateSolution(mfn,1));
+    mfn->ncv = ncv;
+  } else PetscCall(MFNAllocateSolution(mfn,1));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
+/*
+   Two-pass Lanczos variant for Hermitian operators: the first pass builds the
+   tridiagonal projection with a three-term recurrence, without storing the
+   Krylov basis; after evaluating the function, a second pass regenerates the
+   basis vectors one at a time and accumulates the update. This applies the
+   operator twice per step but needs only a handful of vectors of storage.
+*/
+static PetscErrorCode MFNSolve_Krylov_TwoPass(MFN mfn,Vec b,Vec x)
 {
-  PetscInt          n=0,m,ld,ldh,j;
-  PetscBLASInt      m_,inc=1;
-  Mat               M,G=NULL,H=NULL;
-  Vec               F=NULL;
-  PetscScalar       *marray,*farray,*harray;
+  PetscInt       n=0,m,mcur,ldh,j,pass;
+  PetscBLASInt   m_,inc=1;
+  Mat            A=mfn->transpose_solve?mfn->AT:mfn->A,G=NULL,H=NULL;
+  Vec            F=NULL,vold,v,w,t;
+  PetscScalar    *harray,*farray,dot;
   const PetscScalar *garray;
-  PetscReal         beta,betaold=0.0,nrm=1.0;
+  PetscReal      *alpha,*beta,betaold=0.0,nrm=1.0;
+  PetscBool      breakdown=PETSC_FALSE;
+
+  PetscFunctionBegin;
+  m = mfn->ncv;
+  PetscCall(PetscMalloc2(m,&alpha,m+1,&beta));
+  PetscCall(BVCreateVec(mfn->V,&vold));
+  PetscCall(BVCreateVec(mfn->V,&v));
+  PetscCall(BVCreateVec(mfn->V,&w));
+  PetscCall(VecSet(x,0.0));
+  PetscCall(BVInsertVec(mfn->V,0,b));
+  PetscCall(BVScaleColumn(mfn->V,0,1.0/mfn->bnorm));
+
+  /* Restart loop */
+  while (mfn->reason == MFN_CONVERGED_ITERATING) {
+    mfn->its++;
+    mcur = m;
+
+    for (pass=0;pass<2;pass++) {
+      /* run the Lanczos recurrence from the starting vector of the cycle */
+      PetscCall(BVCopyVec(mfn->V,0,v));
+      for (j=0;j<mcur;j++) {
+        if (pass==1) {
+          /* second pass: accumulate the update with the regenerated vector */
+          PetscCall(VecAXPY(x,farray[n+j],v));
+          if (j==mcur-1 && breakdown) break;   /* no need for the next vector */
+        }
+        PetscCall(MatMult(A,v,w));
+        if (j>0) PetscCall(VecAXPY(w,-beta[j],vold));
+        if (pass==0) {
+          PetscCall(VecDot(w,v,&dot));
+          alpha[j] = PetscRealPart(dot);
+        }
+        PetscCall(VecAXPY(w,-alpha[j],v));
+        if (pass==0) {
+          PetscCall(VecNorm(w,NORM_2,&beta[j+1]));
+          if (beta[j+1]==0.0) {   /* breakdown: invariant subspace found, stop after this cycle */
+            breakdown = PETSC_TRUE;
+            mcur = j+1;
+          }
+        }
+        if (j==mcur-1 && breakdown) break;
+        t = vold; vold = v; v = t;
+        PetscCall(VecAXPBY(v,1.0/beta[j+1],0.0,w));
+      }
+
+      if (pass==1) break;
+
+      /* glue together the previous matrix and the new tridiagonal block */
+      if (mfn->its>1) { G = H; H = NULL; }
+      ldh = n+mcur;
+      PetscCall(MFN_CreateVec(ldh,&F));
+      PetscCall(MFN_CreateDenseMat(ldh,&H));
+      PetscCall(MatDenseGetArray(H,&harray));
+      for (j=0;j<mcur;j++) {
+        harray[n+j+(n+j)*ldh] = alpha[j];
+        if (j<mcur-1) harray[n+j+1+(n+j)*ldh] = harray[n+j+(n+j+1)*ldh] = beta[j+1];
+      }
+      if (mfn->its>1) {
+        PetscCall(MatDenseGetArrayRead(G,&garray));
+        for (j=0;j<n;j++) PetscCall(PetscArraycpy(harray+j*ldh,garray+j*n,n));
+        PetscCall(MatDenseRestoreArrayRead(G,&garray));
+        PetscCall(MatDestroy(&G));
+        harray[n+(n-1)*ldh] = betaold;
+      }
+      PetscCall(MatDenseRestoreArray(H,&harray));
+
+      if (mfn->its==1) {
+        /* set symmetry flag of H from A */
+        PetscCall(MatPropagateSymmetryOptions(mfn->A,H));
+      }
+
+      /* evaluate f(H) */
+      PetscCall(FNEvaluateFunctionMatVec(mfn->fn,H,F));
+      PetscCall(VecGetArray(F,&farray));
+      PetscCall(PetscBLASIntCast(mcur,&m_));
+      nrm = BLASnrm2_(&m_,farray+n,&inc);   /* relative norm of the update ||u||/||b|| */
+      PetscCall(MFNMonitor(mfn,mfn->its,nrm));
+      for (j=0;j<mcur;j++) farray[j+n] *= mfn->bnorm;
+    }
+    PetscCall(VecRestoreArray(F,&farray));
+
+    /* check convergence */
+    if (mfn->its >= mfn->max_it) mfn->reason = MFN_DIVERGED_ITS;
+    if (breakdown) mfn->reason = MFN_CONVERGED_TOL;
+    else if (mfn->its>1 && nrm<mfn->tol) mfn->reason = MFN_CONVERGED_TOL;
+
+    /* restart with vector v_{m+1} */
+    if (mfn->reason == MFN_CONVERGED_ITERATING) {
+      PetscCall(BVInsertVec(mfn->V,0,v));
+      n += mcur;
+      betaold = beta[mcur];
+    }
+  }
+
+  PetscCall(MatDestroy(&H));
+  PetscCall(MatDestroy(&G));
+  PetscCall(VecDestroy(&F));
+  PetscCall(VecDestroy(&vold));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(PetscFree2(alpha,beta));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
+{
+  MFN_KRYLOV        *ctx = (MFN_KRYLOV*)mfn->data;
+  PetscInt          n=0,m,ld,ldh,lds,j,k;
+  PetscBLASInt      m_,k_,inc=1;
+  Mat               M,G=NULL,H=NULL,FT=NULL,Q;
+  Vec               F=NULL,v;
+  PetscScalar       *marray,*farray,*harray,*darray,*tarray,*c,*fc,*eigr,*eigi,sone=1.0,szero=0.0;
+  const PetscScalar *garray,*ftarray;
+  PetscReal         beta,betaold=0.0,nrm=1.0,scale;
   PetscBool         breakdown;
+  SlepcSC           sc;
 
   PetscFunctionBegin;
+  if (ctx->twopass) {
+    PetscCall(MFNSolve_Krylov_TwoPass(mfn,b,x));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   m  = mfn->ncv;
   ld = m+1;
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ld,m,NULL,&M));
   PetscCall(MatDenseGetArray(M,&marray));
 
-  /* set initial vector to b/||b|| */
-  PetscCall(BVInsertVec(mfn->V,0,b));
-  PetscCall(BVScaleColumn(mfn->V,0,1.0/mfn->bnorm));
+  scale = mfn->bnorm;
   PetscCall(VecSet(x,0.0));
+  PetscCall(BVInsertVec(mfn->V,0,b));
+  if (ctx->nu && ctx->trans==mfn->transpose_solve) {
+    /* split off the part of b lying in the recycled subspace: x = U*f(T)*U'*b,
+       and continue the Arnoldi iteration with the remainder of b only */
+    k = ctx->nu;
+    PetscCall(PetscMalloc2(k,&c,k,&fc));
+    PetscCall(BVSetActiveColumns(ctx->U,0,k));
+    PetscCall(BVDotVec(ctx->U,b,c));
+    PetscCall(MFN_CreateDenseMat(k,&FT));
+    PetscCall(FNEvaluateFunctionMat(mfn->fn,ctx->T,FT));
+    PetscCall(MatDenseGetArrayRead(FT,&ftarray));
+    PetscCall(PetscBLASIntCast(k,&k_));
+    PetscCallBLAS("BLASgemv",BLASgemv_("N",&k_,&k_,&sone,ftarray,&k_,c,&inc,&szero,fc,&inc));
+    PetscCall(MatDenseRestoreArrayRead(FT,&ftarray));
+    PetscCall(MatDestroy(&FT));
+    PetscCall(BVMultVec(ctx->U,1.0,1.0,x,fc));
+    for (j=0;j<k;j++) c[j] = -c[j];
+    PetscCall(BVGetColumn(mfn->V,0,&v));
+    PetscCall(BVMultVec(ctx->U,1.0,1.0,v,c));
+    PetscCall(BVRestoreColumn(mfn->V,0,&v));
+    PetscCall(PetscFree2(c,fc));
+    PetscCall(BVNormColumn(mfn->V,0,NORM_2,&scale));
+    if (scale==0.0) mfn->reason = MFN_CONVERGED_TOL;  /* b lies entirely in the recycled subspace */
+  }
+  if (scale>0.0) PetscCall(BVScaleColumn(mfn->V,0,1.0/scale));
 
   /* Restart loop */
   while (mfn->reason == MFN_CONVERGED_ITERATING) {
@@ -94,12 +264,12 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
     /* evaluate f(H) */
     PetscCall(FNEvaluateFunctionMatVec(mfn->fn,H,F));
 
-    /* x += ||b||*V*f(H)*e_1 */
+    /* x += scale*V*f(H)*e_1 */
     PetscCall(VecGetArray(F,&farray));
     PetscCall(PetscBLASIntCast(m,&m_));
-    nrm = BLASnrm2_(&m_,farray+n,&inc);   /* relative norm of the update ||u||/||b|| */
+    nrm = BLASnrm2_(&m_,farray+n,&inc)*scale/mfn->bnorm;   /* relative norm of the update ||u||/||b|| */
     PetscCall(MFNMonitor(mfn,mfn->its,nrm));
-    for (j=0;j<m;j++) farray[j+n] *= mfn->bnorm;
+    for (j=0;j<m;j++) farray[j+n] *= scale;
     PetscCall(BVSetActiveColumns(mfn->V,0,m));
     PetscCall(BVMultVec(mfn->V,1.0,1.0,x,farray+n));
     PetscCall(VecRestoreArray(F,&farray));
@@ -118,6 +288,49 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
     }
   }
 
+  /* retain the dominant Ritz vectors of the last cycle to be used in the next solve */
+  if (ctx->nrec && mfn->its>0 && m>1) {
+    if (!ctx->ds) {
+      PetscCall(DSCreate(PetscObjectComm((PetscObject)mfn),&ctx->ds));
+      PetscCall(DSSetType(ctx->ds,DSNHEP));
+      PetscCall(DSAllocate(ctx->ds,mfn->ncv));
+      PetscCall(DSGetSlepcSC(ctx->ds,&sc));
+      sc->comparison    = SlepcCompareLargestMagnitude;
+      sc->comparisonctx = NULL;
+      sc->map           = NULL;
+      sc->mapobj        = NULL;
+    }
+    PetscCall(DSSetDimensions(ctx->ds,m,0,0));
+    PetscCall(DSGetLeadingDimension(ctx->ds,&lds));
+    PetscCall(DSGetArray(ctx->ds,DS_MAT_A,&darray));
+    for (j=0;j<m;j++) PetscCall(PetscArraycpy(darray+j*lds,marray+j*ld,m));
+    PetscCall(DSRestoreArray(ctx->ds,DS_MAT_A,&darray));
+    PetscCall(DSSetState(ctx->ds,DS_STATE_INTERMEDIATE));
+    PetscCall(PetscMalloc2(m,&eigr,m,&eigi));
+    PetscCall(DSSolve(ctx->ds,eigr,eigi));
+    PetscCall(DSSort(ctx->ds,eigr,eigi,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(ctx->ds,eigr,eigi));
+    PetscCall(PetscFree2(eigr,eigi));
+    k = PetscMin(ctx->nrec,m);
+    PetscCall(DSGetArray(ctx->ds,DS_MAT_A,&darray));
+#if !defined(PETSC_USE_COMPLEX)
+    if (k<m && darray[k+(k-1)*lds]!=0.0) k++;   /* do not break a 2x2 block of the real Schur form */
+#endif
+    PetscCall(MFN_CreateDenseMat(k,&ctx->T));
+    PetscCall(MatDenseGetArray(ctx->T,&tarray));
+    for (j=0;j<k;j++) PetscCall(PetscArraycpy(tarray+j*k,darray+j*lds,k));
+    PetscCall(MatDenseRestoreArray(ctx->T,&tarray));
+    PetscCall(DSRestoreArray(ctx->ds,DS_MAT_A,&darray));
+    if (!ctx->U) PetscCall(BVDuplicateResize(mfn->V,ctx->nrec+1,&ctx->U));
+    PetscCall(DSGetMat(ctx->ds,DS_MAT_Q,&Q));
+    PetscCall(BVSetActiveColumns(mfn->V,0,m));
+    PetscCall(BVSetActiveColumns(ctx->U,0,k));
+    PetscCall(BVMult(ctx->U,1.0,0.0,mfn->V,Q));
+    PetscCall(DSRestoreMat(ctx->ds,DS_MAT_Q,&Q));
+    ctx->nu    = k;
+    ctx->trans = mfn->transpose_solve;
+  }
+
   PetscCall(MatDestroy(&H));
   PetscCall(MatDestroy(&G));
   PetscCall(VecDestroy(&F));
@@ -126,10 +339,396 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Block variant of the restarted Arnoldi method: a single Krylov basis is
+   shared by all columns of B, and the operator is applied to one block of
+   vectors at a time.
+*/
+static PetscErrorCode MFNSolveMat_Krylov(MFN mfn,Mat B,Mat X)
+{
+  MFN_KRYLOV        *ctx = (MFN_KRYLOV*)mfn->data;
+  PetscInt          p,m,mb,ld,ldh,n=0,i,j,jb,c;
+  PetscBLASInt      m_,n_;
+  Mat               H=NULL,G=NULL,F=NULL;
+  BV                W;
+  Vec               b,x,w;
+  PetscScalar       *Hb,*r0,*bprev,*C,*harray,sone=1.0,szero=0.0;
+  const PetscScalar *garray,*farray;
+  PetscReal         norm,nrm=1.0;
+  PetscBool         breakdown=PETSC_FALSE,lindep;
+
+  PetscFunctionBegin;
+  PetscCheck(!ctx->twopass,PetscObjectComm((PetscObject)mfn),PETSC_ERR_SUP,"The two-pass variant is not available when solving with several right-hand sides");
+  PetscCall(MatGetSize(B,NULL,&p));
+  PetscCheck(mfn->ncv>=2*p,PetscObjectComm((PetscObject)mfn),PETSC_ERR_SUP,"The block has %" PetscInt_FMT " columns but ncv is only %" PetscInt_FMT "; increase ncv to at least twice the number of columns",p,mfn->ncv);
+  m  = (mfn->ncv+1)/p-1;   /* number of block steps per restart cycle */
+  mb = m*p;
+  ld = mb+p;
+  PetscCall(PetscCalloc3(ld*mb,&Hb,p*p,&r0,p*p,&bprev));
+  PetscCall(BVDuplicateResize(mfn->V,p,&W));
+  PetscCall(MatZeroEntries(X));
+
+  /* orthonormalize the columns of B, giving B = V_1*R0 */
+  PetscCall(BVSetActiveColumns(mfn->V,0,p));
+  for (c=0;c<p;c++) {
+    PetscCall(MatDenseGetColumnVecRead(B,c,&b));
+    PetscCall(BVInsertVec(mfn->V,c,b));
+    PetscCall(MatDenseRestoreColumnVecRead(B,c,&b));
+    PetscCall(BVOrthogonalizeColumn(mfn->V,c,r0+c*p,&norm,&lindep));
+    r0[c+c*p] = lindep? 0.0: norm;
+    if (lindep || norm==0.0) PetscCall(BVOrthonormalizeColumn(mfn->V,c,PETSC_TRUE,NULL,NULL));
+    else PetscCall(BVScaleColumn(mfn->V,c,1.0/norm));
+  }
+
+  /* Restart loop */
+  while (mfn->reason == MFN_CONVERGED_ITERATING) {
+    mfn->its++;
+
+    /* compute block Arnoldi factorization, applying the operator once per block step */
+    PetscCall(PetscArrayzero(Hb,ld*mb));
+    for (jb=0;jb<m;jb++) {
+      PetscCall(BVSetActiveColumns(mfn->V,jb*p,(jb+1)*p));
+      PetscCall(BVSetActiveColumns(W,0,p));
+      PetscCall(BVMatMult(mfn->V,mfn->transpose_solve?mfn->AT:mfn->A,W));
+      PetscCall(BVSetActiveColumns(mfn->V,0,(jb+2)*p));
+      for (i=0;i<p;i++) {
+        c = (jb+1)*p+i;
+        PetscCall(BVGetColumn(W,i,&w));
+        PetscCall(BVInsertVec(mfn->V,c,w));
+        PetscCall(BVRestoreColumn(W,i,&w));
+        PetscCall(BVOrthogonalizeColumn(mfn->V,c,Hb+(c-p)*ld,&norm,&lindep));
+        Hb[c+(c-p)*ld] = lindep? 0.0: norm;
+        if (lindep || norm==0.0) {
+          /* breakdown: pad the basis with a random direction and stop after this cycle */
+          breakdown = PETSC_TRUE;
+          PetscCall(BVOrthonormalizeColumn(mfn->V,c,PETSC_TRUE,NULL,NULL));
+        } else PetscCall(BVScaleColumn(mfn->V,c,1.0/norm));
+      }
+    }
+
+    /* glue together the previous Hessenberg matrix and the new block Hessenberg */
+    if (mfn->its>1) { G = H; H = NULL; }
+    ldh = n+mb;
+    PetscCall(MFN_CreateDenseMat(ldh,&H));
+    PetscCall(MatDenseGetArray(H,&harray));
+    for (j=0;j<mb;j++) PetscCall(PetscArraycpy(harray+n+(n+j)*ldh,Hb+j*ld,mb));
+    if (mfn->its>1) {
+      PetscCall(MatDenseGetArrayRead(G,&garray));
+      for (j=0;j<n;j++) PetscCall(PetscArraycpy(harray+j*ldh,garray+j*n,n));
+      PetscCall(MatDenseRestoreArrayRead(G,&garray));
+      PetscCall(MatDestroy(&G));
+      for (j=0;j<p;j++)
+        for (i=0;i<p;i++) harray[(n+i)+(n-p+j)*ldh] = bprev[i+j*p];
+    }
+    PetscCall(MatDenseRestoreArray(H,&harray));
+
+    if (mfn->its==1) {
+      /* set symmetry flag of H from A */
+      PetscCall(MatPropagateSymmetryOptions(mfn->A,H));
+    }
+
+    /* evaluate f(H) and form the coefficients of the update, f(H)*E1*R0 */
+    PetscCall(MFN_CreateDenseMat(ldh,&F));
+    PetscCall(FNEvaluateFunctionMat(mfn->fn,H,F));
+    PetscCall(PetscMalloc1(ldh*p,&C));
+    PetscCall(MatDenseGetArrayRead(F,&farray));
+    PetscCall(PetscBLASIntCast(ldh,&m_));
+    PetscCall(PetscBLASIntCast(p,&n_));
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&m_,&n_,&n_,&sone,farray,&m_,r0,&n_,&szero,C,&m_));
+    PetscCall(MatDenseRestoreArrayRead(F,&farray));
+
+    /* X += V*C, using the rows of C corresponding to the current cycle */
+    nrm = 0.0;
+    for (j=0;j<p;j++) for (i=n;i<ldh;i++) nrm += PetscSqr(PetscAbsScalar(C[i+j*ldh]));
+    nrm = PetscSqrtReal(nrm)/mfn->bnorm;   /* relative norm of the update ||U||/||B|| */
+    PetscCall(MFNMonitor(mfn,mfn->its,nrm));
+    PetscCall(BVSetActiveColumns(mfn->V,0,mb));
+    for (j=0;j<p;j++) {
+      PetscCall(MatDenseGetColumnVecWrite(X,j,&x));
+      PetscCall(BVMultVec(mfn->V,1.0,1.0,x,C+n+j*ldh));
+      PetscCall(MatDenseRestoreColumnVecWrite(X,j,&x));
+    }
+    PetscCall(PetscFree(C));
+
+    /* check convergence */
+    if (mfn->its >= mfn->max_it) mfn->reason = MFN_DIVERGED_ITS;
+    if (breakdown) mfn->reason = MFN_CONVERGED_TOL;
+    else if (mfn->its>1 && nrm<mfn->tol) mfn->reason = MFN_CONVERGED_TOL;
+
+    /* restart with the next block of basis vectors */
+    if (mfn->reason == MFN_CONVERGED_ITERATING) {
+      for (j=0;j<p;j++)
+        for (i=0;i<p;i++) bprev[i+j*p] = Hb[(mb+i)+(mb-p+j)*ld];
+      for (j=0;j<p;j++) PetscCall(BVCopyColumn(mfn->V,mb+j,j));
+      n += mb;
+    }
+  }
+
+  PetscCall(MatDestroy(&H));
+  PetscCall(MatDestroy(&G));
+  PetscCall(MatDestroy(&F));
+  PetscCall(BVDestroy(&W));
+  PetscCall(PetscFree3(Hb,r0,bprev));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNKrylovSetTwoPass_Krylov(MFN mfn,PetscBool twopass)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  if (ctx->twopass != twopass) {
+    ctx->twopass     = twopass;
+    mfn->setupcalled = 0;   /* the number of allocated basis vectors changes */
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNKrylovSetTwoPass - Activate the two-pass Lanczos variant, which stores
+   only a few basis vectors, for use with Hermitian operators.
+
+   Logically Collective
+
+   Input Parameters:
++  mfn     - matrix function solver
+-  twopass - whether to use the two-pass variant
+
+   Options Database Key:
+.  -mfn_krylov_two_pass <bool> - Activates/deactivates the two-pass variant
+
+   Notes:
+   In the two-pass variant, the first pass of each restart cycle builds the
+   tridiagonal projection of the operator with the Lanczos three-term
+   recurrence, discarding the basis vectors as it goes, and after evaluating
+   the function on the projection a second pass regenerates the basis vectors
+   to accumulate the solution. This applies the operator twice per step, but
+   the storage is reduced from ncv+1 basis vectors to just a few, which pays
+   off for very large problems.
+
+   The operator must have been marked as symmetric (Hermitian in the complex
+   case) with MatSetOption(). This variant cannot be combined with
+   MFNKrylovSetRecycle() or MFNSolveMat().
+
+   Level: advanced
+
+.seealso: MFNKrylovGetTwoPass(), MFNSolve(), MatSetOption()
+@*/
+PetscErrorCode MFNKrylovSetTwoPass(MFN mfn,PetscBool twopass)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidLogicalCollectiveBool(mfn,twopass,2);
+  PetscTryMethod(mfn,"MFNKrylovSetTwoPass_C",(MFN,PetscBool),(mfn,twopass));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNKrylovGetTwoPass_Krylov(MFN mfn,PetscBool *twopass)
+{
+  MFN_KRYLOV *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  *twopass = ctx->twopass;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNKrylovGetTwoPass - Gets the flag indicating whether the two-pass
+   Lanczos variant is being used.
+
+   Not Collective
+
+   Input Parameter:
+.  mfn - matrix function solver
+
+   Output Parameter:
+.  twopass - the flag
+
+   Level: advanced
+
+.seealso: MFNKrylovSetTwoPass()
+@*/
+PetscErrorCode MFNKrylovGetTwoPass(MFN mfn,PetscBool *twopass)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscAssertPointer(twopass,2);
+  PetscUseMethod(mfn,"MFNKrylovGetTwoPass_C",(MFN,PetscBool*),(mfn,twopass));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNKrylovSetRecycle_Krylov(MFN mfn,PetscInt nrec)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  if (nrec == PETSC_DEFAULT || nrec == PETSC_DECIDE) nrec = 0;
+  PetscCheck(nrec>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_OUTOFRANGE,"The nrec argument must be >= 0");
+  if (ctx->nrec != nrec) {
+    ctx->nrec = nrec;
+    /* discard any subspace recycled with the previous setting */
+    PetscCall(BVDestroy(&ctx->U));
+    PetscCall(MatDestroy(&ctx->T));
+    ctx->nu = 0;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNKrylovSetRecycle - Sets the number of Ritz vectors that are recycled
+   between successive calls to MFNSolve().
+
+   Logically Collective
+
+   Input Parameters:
++  mfn  - matrix function solver
+-  nrec - number of vectors to recycle
+
+   Options Database Key:
+.  -mfn_krylov_recycle <nrec> - Sets the number of recycled vectors
+
+   Notes:
+   When several matrix functions are to be computed on correlated vectors,
+   as in the time loop of exponential integrators, part of the work done in
+   one solve can be reused in the next one. If nrec is larger than zero, at
+   the end of each solve the nrec dominant Ritz vectors of the last Krylov
+   basis are retained, and the next solve subtracts from b its component in
+   the retained subspace, which is processed directly with the projected
+   matrix. The Arnoldi iteration then only has to approximate the remainder,
+   usually requiring a smaller basis.
+
+   The approximation applied on the recycled subspace is accurate only if it
+   is close to an invariant subspace, so this option should be used when the
+   vectors passed to successive solves are known to be strongly correlated,
+   otherwise the basis size reduction may come at the cost of accuracy. The
+   recycled subspace is discarded when the operator changes. By default no
+   vectors are recycled.
+
+   Level: advanced
+
+.seealso: MFNKrylovGetRecycle(), MFNSolve()
+@*/
+PetscErrorCode MFNKrylovSetRecycle(MFN mfn,PetscInt nrec)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidLogicalCollectiveInt(mfn,nrec,2);
+  PetscTryMethod(mfn,"MFNKrylovSetRecycle_C",(MFN,PetscInt),(mfn,nrec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNKrylovGetRecycle_Krylov(MFN mfn,PetscInt *nrec)
+{
+  MFN_KRYLOV *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  *nrec = ctx->nrec;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNKrylovGetRecycle - Gets the number of Ritz vectors that are recycled
+   between successive calls to MFNSolve().
+
+   Not Collective
+
+   Input Parameter:
+.  mfn - matrix function solver
+
+   Output Parameter:
+.  nrec - number of vectors to recycle
+
+   Level: advanced
+
+.seealso: MFNKrylovSetRecycle()
+@*/
+PetscErrorCode MFNKrylovGetRecycle(MFN mfn,PetscInt *nrec)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscAssertPointer(nrec,2);
+  PetscUseMethod(mfn,"MFNKrylovGetRecycle_C",(MFN,PetscInt*),(mfn,nrec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNSetFromOptions_Krylov(MFN mfn,PetscOptionItems *PetscOptionsObject)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+  PetscInt       i;
+  PetscBool      flg,bval;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"MFN Krylov Options");
+
+    PetscCall(PetscOptionsBool("-mfn_krylov_two_pass","Use the two-pass Lanczos variant (Hermitian operators only)","MFNKrylovSetTwoPass",ctx->twopass,&bval,&flg));
+    if (flg) PetscCall(MFNKrylovSetTwoPass(mfn,bval));
+
+    PetscCall(PetscOptionsInt("-mfn_krylov_recycle","Number of Ritz vectors to recycle between solves","MFNKrylovSetRecycle",ctx->nrec,&i,&flg));
+    if (flg) PetscCall(MFNKrylovSetRecycle(mfn,i));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNView_Krylov(MFN mfn,PetscViewer viewer)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+  PetscBool      isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii && ctx->twopass) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the two-pass Lanczos variant\n"));
+  if (isascii && ctx->nrec) PetscCall(PetscViewerASCIIPrintf(viewer,"  recycling %" PetscInt_FMT " Ritz vectors between solves\n",ctx->nrec));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNReset_Krylov(MFN mfn)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  PetscCall(BVDestroy(&ctx->U));
+  PetscCall(MatDestroy(&ctx->T));
+  PetscCall(DSDestroy(&ctx->ds));
+  ctx->nu = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNDestroy_Krylov(MFN mfn)
+{
+  MFN_KRYLOV     *ctx = (MFN_KRYLOV*)mfn->data;
+
+  PetscFunctionBegin;
+  PetscCall(BVDestroy(&ctx->U));
+  PetscCall(MatDestroy(&ctx->T));
+  PetscCall(DSDestroy(&ctx->ds));
+  PetscCall(PetscFree(mfn->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovSetTwoPass_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovGetTwoPass_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovSetRecycle_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovGetRecycle_C",NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode MFNCreate_Krylov(MFN mfn)
 {
+  MFN_KRYLOV     *ctx;
+
   PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  mfn->data = (void*)ctx;
+
   mfn->ops->solve          = MFNSolve_Krylov;
+  mfn->ops->solvemat       = MFNSolveMat_Krylov;
   mfn->ops->setup          = MFNSetUp_Krylov;
+  mfn->ops->setfromoptions = MFNSetFromOptions_Krylov;
+  mfn->ops->reset          = MFNReset_Krylov;
+  mfn->ops->destroy        = MFNDestroy_Krylov;
+  mfn->ops->view           = MFNView_Krylov;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovSetTwoPass_C",MFNKrylovSetTwoPass_Krylov));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovGetTwoPass_C",MFNKrylovGetTwoPass_Krylov));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovSetRecycle_C",MFNKrylovSetRecycle_Krylov));
+  PetscCall(PetscObjectComposeFunction((PetscObject)mfn,"MFNKrylovGetRecycle_C",MFNKrylovGetRecycle_Krylov));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -58,8 +58,7 @@ PetscErrorCode MFNInitializePackage(void)
   PetscCall(PetscClassIdRegister("Matrix Function",&MFN_CLASSID));
   /* Register Constructors */
   PetscCall(MFNRegisterAll());
-  /* Register Monitors */
-  PetscCall(MFNMonitorRegisterAll());
+  /* Monitors are registered on demand, see MFNMonitorSetFromOptions() */
   /* Register Events */
   PetscCall(PetscLogEventRegister("MFNSetUp",MFN_CLASSID,&MFN_SetUp));
   PetscCall(PetscLogEventRegister("MFNSolve",MFN_CLASSID,&MFN_Solve));
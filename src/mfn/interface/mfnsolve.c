@@ -126,6 +126,104 @@ PetscErrorCode MFNSolveTranspose(MFN mfn,Vec b,Vec x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   MFNSolveMat - Solves the matrix function problem for a block of vectors.
+   Given a matrix B with a few dense columns, the matrix X = f(A)*B is returned.
+
+   Collective
+
+   Input Parameters:
++  mfn - matrix function context obtained from MFNCreate()
+-  B   - the right hand side matrix, of dense type
+
+   Output Parameter:
+.  X   - the solution, of the same dimensions and type as B
+
+   Notes:
+   This is equivalent to calling MFNSolve() on each column of B, but solvers
+   that support it process all columns together with a block Krylov method,
+   where a single basis is shared by all columns and the matrix is applied
+   to one block of vectors at a time. For solvers without block support, the
+   columns are simply processed one after the other.
+
+   In the block case the convergence test is applied to the whole block, so
+   individual columns may be solved to slightly different accuracy than with
+   separate MFNSolve() calls.
+
+   Level: intermediate
+
+.seealso: MFNSolve(), MFNSetOperator(), MFNSetFN()
+@*/
+PetscErrorCode MFNSolveMat(MFN mfn,Mat B,Mat X)
+{
+  PetscInt           j,ncols,mb,nb,mx,nx;
+  Vec                b,x;
+  PetscReal          bnorm;
+  MFNConvergedReason reason;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(X,MAT_CLASSID,3);
+  PetscCheckSameComm(mfn,1,B,2);
+  PetscCheckSameComm(mfn,1,X,3);
+  PetscCheck(B!=X,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_IDN,"B and X must be different matrices");
+  PetscCall(MatGetSize(B,&mb,&nb));
+  PetscCall(MatGetSize(X,&mx,&nx));
+  PetscCheck(mb==mx && nb==nx,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_SIZ,"B and X must have the same dimensions");
+  mfn->transpose_solve = PETSC_FALSE;
+
+  /* call setup */
+  PetscCall(MFNSetUp(mfn));
+  mfn->its = 0;
+
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view_pre"));
+
+  /* check nonzero right-hand side */
+  PetscCall(MatNorm(B,NORM_FROBENIUS,&mfn->bnorm));
+  PetscCheck(mfn->bnorm,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_WRONG,"Cannot pass a zero B matrix to MFNSolveMat()");
+
+  PetscCall(PetscLogEventBegin(MFN_Solve,mfn,B,X,0));
+  if (mfn->ops->solvemat) PetscUseTypeMethod(mfn,solvemat,B,X);
+  else {
+    /* process the columns one at a time */
+    ncols  = nb;
+    reason = MFN_CONVERGED_TOL;
+    mb     = 0;   /* reused as maximum iteration count */
+    for (j=0;j<ncols;j++) {
+      PetscCall(MatDenseGetColumnVecRead(B,j,&b));
+      PetscCall(MatDenseGetColumnVecWrite(X,j,&x));
+      PetscCall(VecNorm(b,NORM_2,&bnorm));
+      if (bnorm==0.0) PetscCall(VecSet(x,0.0));
+      else {
+        mfn->bnorm  = bnorm;
+        mfn->its    = 0;
+        mfn->reason = MFN_CONVERGED_ITERATING;
+        PetscUseTypeMethod(mfn,solve,b,x);
+      }
+      PetscCall(MatDenseRestoreColumnVecWrite(X,j,&x));
+      PetscCall(MatDenseRestoreColumnVecRead(B,j,&b));
+      if (mfn->reason<0) reason = mfn->reason;
+      mb = PetscMax(mb,mfn->its);
+    }
+    mfn->reason = reason;
+    mfn->its    = mb;
+  }
+  PetscCall(PetscLogEventEnd(MFN_Solve,mfn,B,X,0));
+
+  PetscCheck(mfn->reason,PetscObjectComm((PetscObject)mfn),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
+
+  PetscCheck(!mfn->errorifnotconverged || mfn->reason>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_NOT_CONVERGED,"MFNSolveMat has not converged");
+
+  /* various viewers */
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view"));
+  PetscCall(MFNConvergedReasonViewFromOptions(mfn));
+  PetscCall(MatViewFromOptions(mfn->A,(PetscObject)mfn,"-mfn_view_mat"));
+  PetscCall(MatViewFromOptions(B,(PetscObject)mfn,"-mfn_view_rhs"));
+  PetscCall(MatViewFromOptions(X,(PetscObject)mfn,"-mfn_view_solution"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    MFNGetIterationNumber - Gets the current iteration number. If the
    call to MFNSolve() is complete, then it returns the number of iterations
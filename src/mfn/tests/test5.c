@@ -0,0 +1,115 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test MFNSolveMat by comparing against column-by-column MFNSolve.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions.\n"
+  "  -k <k>, where <k> = number of columns of the right-hand side.\n\n";
+
+#include <slepcmfn.h>
+
+int main(int argc,char **argv)
+{
+  Mat                A,B,X;      /* problem matrix, block RHS and solution */
+  MFN                mfn;
+  FN                 f;
+  Vec                b,x,y;
+  PetscReal          norm,error,tol=PetscMax(1000*PETSC_MACHINE_EPSILON,1e-9);
+  PetscScalar        t=0.1;
+  PetscInt           n=100,k=4,i,j,Istart,Iend;
+  MFNConvergedReason reason;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-k",&k,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nBlock matrix exponential X=exp(t*A)*B, n=%" PetscInt_FMT ", %" PetscInt_FMT " columns\n\n",n,k));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Build the 1-D Laplacian and a dense right-hand side block
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatCreateDense(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,n,k,NULL,&B));
+  PetscCall(MatGetOwnershipRange(B,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    for (j=0;j<k;j++) PetscCall(MatSetValue(B,i,j,1.0/(i+j+1.0),INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&X));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Solve the problem for the whole block
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MFNCreate(PETSC_COMM_WORLD,&mfn));
+  PetscCall(MFNSetOperator(mfn,A));
+  PetscCall(MFNGetFN(mfn,&f));
+  PetscCall(FNSetType(f,FNEXP));
+  PetscCall(FNSetScale(f,t,1.0));
+  PetscCall(MFNSetTolerances(mfn,tol,PETSC_DEFAULT));
+  PetscCall(MFNSetFromOptions(mfn));
+
+  PetscCall(MFNSolveMat(mfn,B,X));
+  PetscCall(MFNGetConvergedReason(mfn,&reason));
+  PetscCheck(reason>=0,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"Solver did not converge");
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Solve again column by column and compare the solutions
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreateVecs(A,NULL,&y));
+  for (j=0;j<k;j++) {
+    PetscCall(MatDenseGetColumnVecRead(B,j,&b));
+    PetscCall(MFNSolve(mfn,b,y));
+    PetscCall(MatDenseRestoreColumnVecRead(B,j,&b));
+    PetscCall(MFNGetConvergedReason(mfn,&reason));
+    PetscCheck(reason>=0,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"Solver did not converge");
+    PetscCall(MatDenseGetColumnVecRead(X,j,&x));
+    PetscCall(VecNorm(y,NORM_2,&norm));
+    PetscCall(VecAXPY(y,-1.0,x));
+    PetscCall(MatDenseRestoreColumnVecRead(X,j,&x));
+    PetscCall(VecNorm(y,NORM_2,&error));
+    if (error/norm>100*PetscSqrtReal(tol)) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Column %" PetscInt_FMT " of the blocked solve differs from MFNSolve: %g\n",j,(double)(error/norm)));
+  }
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Blocked solve matches column-by-column MFNSolve\n"));
+
+  PetscCall(MFNDestroy(&mfn));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&B));
+  PetscCall(MatDestroy(&X));
+  PetscCall(VecDestroy(&y));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      nsize: {{1 2}}
+      args: -mfn_type {{krylov expokit}}
+      requires: !single
+
+TEST*/
@@ -59,6 +59,8 @@ typedef struct {
   BV                Y;
   PetscBool         useconj;
   Mat               J;             /* auxiliary matrix when using subcomm */
+  Mat               *dJ;           /* cached derivative matrices at the integration points */
+  PetscInt          ndJ;           /* number of matrices in dJ */
   BV                pV;
   NEP_CISS_PROJECT  dsctxf;
   PetscObjectId     rgid;
@@ -122,6 +124,10 @@ static PetscErrorCode NEPCISSSetUp(NEP nep,Mat T,Mat P)
   if (!ctx->contour || !ctx->contour->ksp) PetscCall(NEPCISSGetKSPs(nep,NULL,NULL));
   contour = ctx->contour;
   PetscAssert(ctx->contour && ctx->contour->ksp,PetscObjectComm((PetscObject)nep),PETSC_ERR_PLIB,"Something went wrong with NEPCISSGetKSPs()");
+  /* discard derivative matrices cached in a previous solve */
+  for (i=0;i<ctx->ndJ;i++) PetscCall(MatDestroy(&ctx->dJ[i]));
+  PetscCall(PetscFree(ctx->dJ));
+  ctx->ndJ = 0;
   for (i=0;i<contour->npoints;i++) {
     p_id = i*contour->subcomm->n + contour->subcomm->color;
     PetscCall(MatDuplicate(T,MAT_DO_NOT_COPY_VALUES,&Amat));
@@ -144,14 +150,31 @@ static PetscErrorCode NEPCISSSolve(NEP nep,Mat dT,BV V,PetscInt L_start,PetscInt
   SlepcContourData contour = ctx->contour;
   PetscInt         i,p_id;
   Mat              MV,BMV=NULL,MC;
+  PetscBool        flg;
 
   PetscFunctionBegin;
+  if (!ctx->dJ) {   /* cache the derivatives at the integration points, reused in subsequent refinement sweeps */
+    PetscCall(MatHasOperation(dT,MATOP_DUPLICATE,&flg));
+    if (flg) {
+      PetscCall(PetscCalloc1(contour->npoints,&ctx->dJ));
+      ctx->ndJ = contour->npoints;
+    }
+  }
   PetscCall(BVSetActiveColumns(V,L_start,L_end));
   PetscCall(BVGetMat(V,&MV));
   for (i=0;i<contour->npoints;i++) {
     p_id = i*contour->subcomm->n + contour->subcomm->color;
-    if (contour->subcomm->n==1 || nep->fui==NEP_USER_INTERFACE_CALLBACK) PetscCall(NEPComputeJacobian(nep,ctx->omega[p_id],dT));
-    else PetscCall(NEPComputeFunctionSubcomm(nep,ctx->omega[p_id],dT,NULL,PETSC_TRUE));
+    if (ctx->dJ) {
+      if (!ctx->dJ[i]) {
+        PetscCall(MatDuplicate(dT,MAT_DO_NOT_COPY_VALUES,&ctx->dJ[i]));
+        if (contour->subcomm->n==1 || nep->fui==NEP_USER_INTERFACE_CALLBACK) PetscCall(NEPComputeJacobian(nep,ctx->omega[p_id],ctx->dJ[i]));
+        else PetscCall(NEPComputeFunctionSubcomm(nep,ctx->omega[p_id],ctx->dJ[i],NULL,PETSC_TRUE));
+      }
+      PetscCall(MatCopy(ctx->dJ[i],dT,SAME_NONZERO_PATTERN));
+    } else {
+      if (contour->subcomm->n==1 || nep->fui==NEP_USER_INTERFACE_CALLBACK) PetscCall(NEPComputeJacobian(nep,ctx->omega[p_id],dT));
+      else PetscCall(NEPComputeFunctionSubcomm(nep,ctx->omega[p_id],dT,NULL,PETSC_TRUE));
+    }
     PetscCall(BVSetActiveColumns(ctx->Y,i*ctx->L+L_start,i*ctx->L+L_end));
     PetscCall(BVGetMat(ctx->Y,&MC));
     if (!i) {
@@ -961,6 +984,7 @@ PetscErrorCode NEPCISSGetKSPs(NEP nep,PetscInt *nsolve,KSP **ksp)
 static PetscErrorCode NEPReset_CISS(NEP nep)
 {
   NEP_CISS       *ctx = (NEP_CISS*)nep->data;
+  PetscInt       i;
 
   PetscFunctionBegin;
   PetscCall(BVDestroy(&ctx->S));
@@ -968,6 +992,9 @@ static PetscErrorCode NEPReset_CISS(NEP nep)
   PetscCall(BVDestroy(&ctx->Y));
   PetscCall(SlepcContourDataReset(ctx->contour));
   PetscCall(MatDestroy(&ctx->J));
+  for (i=0;i<ctx->ndJ;i++) PetscCall(MatDestroy(&ctx->dJ[i]));
+  PetscCall(PetscFree(ctx->dJ));
+  ctx->ndJ = 0;
   PetscCall(BVDestroy(&ctx->pV));
   if (ctx->extraction == NEP_CISS_EXTRACTION_RITZ && nep->fui==NEP_USER_INTERFACE_CALLBACK) PetscCall(PetscFree(ctx->dsctxf));
   PetscFunctionReturn(PETSC_SUCCESS);
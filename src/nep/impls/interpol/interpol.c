@@ -116,15 +116,15 @@ static PetscErrorCode NEPSolve_Interpol(NEP nep)
 {
   NEP_INTERPOL   *ctx = (NEP_INTERPOL*)nep->data;
   Mat            *A,*P;
-  PetscScalar    *x,*fx,t;
-  PetscReal      *cs,a,b,s,aprox,aprox0=1.0,*matnorm;
-  PetscInt       i,j,k,deg=ctx->maxdeg;
+  PetscScalar    *x,*fx,*coeff,t;
+  PetscReal      *cs,a,b,s,aprox,aprox0=1.0,*matnorm,*cnorm;
+  PetscInt       i,j,k,d=ctx->maxdeg,deg=ctx->maxdeg;
   PetscBool      hasmnorm=PETSC_FALSE;
   Vec            vr,vi=NULL;
   ST             st;
 
   PetscFunctionBegin;
-  PetscCall(PetscMalloc4((deg+1)*(deg+1),&cs,deg+1,&x,(deg+1)*nep->nt,&fx,nep->nt,&matnorm));
+  PetscCall(PetscMalloc4((d+1)*(d+1),&cs,d+1,&x,(d+1)*nep->nt,&fx,nep->nt,&matnorm));
   for  (j=0;j<nep->nt;j++) {
     PetscCall(MatHasOperation(nep->A[j],MATOP_NORM,&hasmnorm));
     if (!hasmnorm) break;
@@ -132,35 +132,48 @@ static PetscErrorCode NEPSolve_Interpol(NEP nep)
   }
   if (!hasmnorm) for (j=0;j<nep->nt;j++) matnorm[j] = 1.0;
   PetscCall(RGIntervalGetEndpoints(nep->rg,&a,&b,NULL,NULL));
-  PetscCall(ChebyshevNodes(deg,a,b,x,cs));
+  PetscCall(ChebyshevNodes(d,a,b,x,cs));
   for (j=0;j<nep->nt;j++) {
-    for (i=0;i<=deg;i++) PetscCall(FNEvaluateFunction(nep->f[j],x[i],&fx[i+j*(deg+1)]));
+    for (i=0;i<=d;i++) PetscCall(FNEvaluateFunction(nep->f[j],x[i],&fx[i+j*(d+1)]));
   }
-  /* Polynomial coefficients */
+  /* Polynomial coefficients, computed before assembling any matrix */
+  PetscCall(PetscMalloc2((d+1)*nep->nt,&coeff,d+1,&cnorm));
+  for (k=0;k<=d;k++) {
+    cnorm[k] = 0.0;
+    for (j=0;j<nep->nt;j++) {
+      t = 0.0;
+      for (i=0;i<d+1;i++) t += fx[i+j*(d+1)]*cs[i*(d+1)+k];
+      t *= 2.0/(d+1);
+      if (k==0) t /= 2.0;
+      coeff[k+j*(d+1)] = t;
+      cnorm[k] += matnorm[j]*PetscAbsScalar(t);
+    }
+  }
+  if (cnorm[0]>0.0) aprox0 = cnorm[0];
+  /* select the smallest degree whose trailing coefficients (an estimate of the
+     truncation error of the interpolant) fall below the tolerance */
+  aprox = 0.0;
+  for (k=d;k>2;k--) {
+    aprox += cnorm[k];
+    if (aprox/aprox0>=ctx->tol) break;
+    deg = k-1;
+  }
+  ctx->deg = deg;
+  for (aprox=0.0,k=deg+1;k<=d;k++) aprox += cnorm[k];
+  PetscCall(PetscInfo(nep,"Using degree %" PetscInt_FMT " with estimated relative truncation error %g\n",deg,(double)(aprox/aprox0)));
   PetscCall(PetscMalloc1(deg+1,&A));
   if (nep->P) PetscCall(PetscMalloc1(deg+1,&P));
-  ctx->deg = deg;
   for (k=0;k<=deg;k++) {
     PetscCall(MatDuplicate(nep->A[0],MAT_COPY_VALUES,&A[k]));
-    if (nep->P) PetscCall(MatDuplicate(nep->P[0],MAT_COPY_VALUES,&P[k]));
-    t = 0.0;
-    for (i=0;i<deg+1;i++) t += fx[i]*cs[i*(deg+1)+k];
-    t *= 2.0/(deg+1);
-    if (k==0) t /= 2.0;
-    aprox = matnorm[0]*PetscAbsScalar(t);
-    PetscCall(MatScale(A[k],t));
-    if (nep->P) PetscCall(MatScale(P[k],t));
+    PetscCall(MatScale(A[k],coeff[k]));
+    if (nep->P) {
+      PetscCall(MatDuplicate(nep->P[0],MAT_COPY_VALUES,&P[k]));
+      PetscCall(MatScale(P[k],coeff[k]));
+    }
     for (j=1;j<nep->nt;j++) {
-      t = 0.0;
-      for (i=0;i<deg+1;i++) t += fx[i+j*(deg+1)]*cs[i*(deg+1)+k];
-      t *= 2.0/(deg+1);
-      if (k==0) t /= 2.0;
-      aprox += matnorm[j]*PetscAbsScalar(t);
-      PetscCall(MatAXPY(A[k],t,nep->A[j],nep->mstr));
-      if (nep->P) PetscCall(MatAXPY(P[k],t,nep->P[j],nep->mstrp));
+      PetscCall(MatAXPY(A[k],coeff[k+j*(d+1)],nep->A[j],nep->mstr));
+      if (nep->P) PetscCall(MatAXPY(P[k],coeff[k+j*(d+1)],nep->P[j],nep->mstrp));
     }
-    if (k==0) aprox0 = aprox;
-    if (k>1 && aprox/aprox0<ctx->tol) { ctx->deg = k; deg = k; break; }
   }
   PetscCall(PEPSetOperators(ctx->pep,deg+1,A));
   PetscCall(MatDestroyMatrices(deg+1,&A));
@@ -169,6 +182,7 @@ static PetscErrorCode NEPSolve_Interpol(NEP nep)
     PetscCall(STSetSplitPreconditioner(st,deg+1,P,nep->mstrp));
     PetscCall(MatDestroyMatrices(deg+1,&P));
   }
+  PetscCall(PetscFree2(coeff,cnorm));
   PetscCall(PetscFree4(cs,x,fx,matnorm));
 
   /* Solve polynomial eigenproblem */
@@ -294,6 +308,11 @@ static PetscErrorCode NEPInterpolSetInterpolation_Interpol(NEP nep,PetscReal tol
    Notes:
    Use PETSC_DEFAULT for either argument to assign a reasonably good value.
 
+   The degree of the interpolation polynomial is chosen as the smallest one
+   such that the norm of the trailing coefficients, which estimates the
+   truncation error of the interpolant, falls below tol relative to the
+   leading coefficient, never exceeding deg.
+
    Level: advanced
 
 .seealso: NEPInterpolGetInterpolation()
@@ -219,12 +219,23 @@ static PetscErrorCode NEPDeflationEvaluateBasisMat(NEP_EXT_OP extop,PetscInt idx
 PetscErrorCode NEPDeflationLocking(NEP_EXT_OP extop,Vec u,PetscScalar lambda)
 {
   PetscInt       i;
+  Vec            x,ax;
 
   PetscFunctionBegin;
   PetscCall(NEPDeflationExtendInvariantPair(extop,u,lambda,extop->n));
   extop->n++;
   PetscCall(BVSetActiveColumns(extop->X,0,extop->n));
   if (extop->n <= extop->szd) {
+    /* extend the cached products with the new locked vector */
+    if (extop->AX) {
+      for (i=0;i<extop->nep->nt;i++) {
+        PetscCall(BVGetColumn(extop->X,extop->n-1,&x));
+        PetscCall(BVGetColumn(extop->AX[i],extop->n-1,&ax));
+        PetscCall(MatMult(extop->nep->A[i],x,ax));
+        PetscCall(BVRestoreColumn(extop->AX[i],extop->n-1,&ax));
+        PetscCall(BVRestoreColumn(extop->X,extop->n-1,&x));
+      }
+    }
     /* update XpX */
     PetscCall(BVDotColumn(extop->X,extop->n-1,extop->XpX+(extop->n-1)*extop->szd));
     extop->XpX[(extop->n-1)*(1+extop->szd)] = 1.0;
@@ -464,13 +475,14 @@ static PetscErrorCode NEPDeflationComputeShellMat(NEP_EXT_OP extop,PetscScalar l
         PetscCall(BVSetActiveColumns(matctx->U,0,n));
         hf = jacobian?hfjp:hfj;
         PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,n,n,hf,&F));
-        PetscCall(BVMatMult(extop->X,extop->nep->A[0],matctx->U));
-        PetscCall(BVMultInPlace(matctx->U,F,0,n));
-        PetscCall(BVSetActiveColumns(extop->W,0,extop->n));
+        /* the products A_j*X are cached, so refreshing the operator at a new
+           lambda involves only small dense combinations of their columns */
+        PetscCall(BVSetActiveColumns(extop->AX[0],0,n));
+        PetscCall(BVMult(matctx->U,1.0,0.0,extop->AX[0],F));
         for (j=1;j<extop->nep->nt;j++) {
-          PetscCall(BVMatMult(extop->X,extop->nep->A[j],extop->W));
+          PetscCall(BVSetActiveColumns(extop->AX[j],0,n));
           PetscCall(MatDensePlaceArray(F,hf+j*n*n));
-          PetscCall(BVMult(matctx->U,1.0,1.0,extop->W,F));
+          PetscCall(BVMult(matctx->U,1.0,1.0,extop->AX[j],F));
           PetscCall(MatDenseResetArray(F));
         }
         PetscCall(MatDestroy(&F));
@@ -673,6 +685,10 @@ PetscErrorCode NEPDeflationReset(NEP_EXT_OP extop)
     PetscCall(VecDestroy(&extop->w));
     PetscCall(PetscFree3(extop->Hj,extop->XpX,extop->bc));
     PetscCall(BVDestroy(&extop->W));
+    if (extop->AX) {
+      for (j=0;j<extop->nep->nt;j++) PetscCall(BVDestroy(&extop->AX[j]));
+      PetscCall(PetscFree(extop->AX));
+    }
   }
   PetscCall(MatDestroy(&extop->MF));
   PetscCall(MatDestroy(&extop->MJ));
@@ -705,7 +721,7 @@ PetscErrorCode NEPDeflationInitialize(NEP nep,BV X,KSP ksp,PetscBool sincfun,Pet
 {
   NEP_EXT_OP        op;
   NEP_DEF_FUN_SOLVE solve;
-  PetscInt          szd;
+  PetscInt          j,szd;
   Vec               x;
 
   PetscFunctionBegin;
@@ -733,6 +749,12 @@ PetscErrorCode NEPDeflationInitialize(NEP nep,BV X,KSP ksp,PetscBool sincfun,Pet
     }
     PetscCall(PetscCalloc3(szd*szd*op->max_midx,&(op)->Hj,szd*szd,&(op)->XpX,szd,&op->bc));
     PetscCall(BVDuplicateResize(op->X,op->szd,&op->W));
+    if (!op->simpU) {
+      /* cache the products of the split matrices times the locked vectors,
+         extended one column at a time as the invariant pair grows */
+      PetscCall(PetscMalloc1(nep->nt,&op->AX));
+      for (j=0;j<nep->nt;j++) PetscCall(BVDuplicateResize(op->X,op->szd,&op->AX[j]));
+    }
   }
   if (ksp) {
     PetscCall(PetscNew(&solve));
@@ -912,8 +934,13 @@ PetscErrorCode NEPDeflationProjectOperator(NEP_EXT_OP extop,BV Vext,DS ds,PetscI
       /* Compute matrices V1^* A_i X  and V1^* X */
       PetscCall(BVSetActiveColumns(extop->W,0,n));
       for (k=0;k<nep->nt;k++) {
-        PetscCall(BVMatMult(extop->X,nep->A[k],extop->W));
-        PetscCall(BVDot(extop->W,V1,proj->V1pApX[k]));
+        if (extop->AX) {
+          PetscCall(BVSetActiveColumns(extop->AX[k],0,n));
+          PetscCall(BVDot(extop->AX[k],V1,proj->V1pApX[k]));
+        } else {
+          PetscCall(BVMatMult(extop->X,nep->A[k],extop->W));
+          PetscCall(BVDot(extop->W,V1,proj->V1pApX[k]));
+        }
       }
       PetscCall(BVDot(V1,extop->X,proj->XpV1));
     }
@@ -38,6 +38,7 @@ struct _n_nep_ext_op {
   NEP_DEF_PROJECT   proj;   /* context for the projected eigenproblem */
   /* auxiliary computations */
   BV                W;
+  BV                *AX;    /* cached products of the split matrices times the locked vectors */
   PetscScalar       *Hj;    /* matrix containing the powers of the invariant pair matrix */
   PetscScalar       *XpX;   /* X^*X */
   DS                ds;
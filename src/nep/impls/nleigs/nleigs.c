@@ -618,8 +618,9 @@ static PetscErrorCode NEPNLEIGSDividedDifferences_split(NEP nep)
   PetscReal      norm0,norm,*matnorm;
   PetscScalar    *s=ctx->s,*beta=ctx->beta,*xi=ctx->xi,*b,alpha,*coeffs,*pK,*pH,sone=1.0;
   Mat            T,P,Ts,K,H;
-  PetscBool      shell,hasmnorm=PETSC_FALSE,matrix=PETSC_TRUE;
+  PetscBool      shell,hasmnorm=PETSC_FALSE,matrix=PETSC_TRUE,mfail;
   PetscBLASInt   n_;
+  PetscMPIInt    rk,np,nc;
 
   PetscFunctionBegin;
   nmax = ctx->ddmaxit;
@@ -645,7 +646,13 @@ static PetscErrorCode NEPNLEIGSDividedDifferences_split(NEP nep)
   /* The matrix to be used is in H. K will be a work-space matrix */
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,nmax,nmax,pH,&H));
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,nmax,nmax,pK,&K));
-  for (j=0;matrix&&j<nep->nt;j++) {
+  /* the dense evaluations for the different terms are independent and
+     replicated on all processes, so distribute them in a round-robin fashion
+     and combine the resulting (small) coefficient arrays afterwards */
+  PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)nep),&rk));
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)nep),&np));
+  PetscCall(PetscArrayzero(ctx->coeffD,nep->nt*nmax));
+  for (j=rk;matrix&&j<nep->nt;j+=np) {
     PetscCall(PetscPushErrorHandler(PetscReturnErrorHandler,NULL));
     ierr = FNEvaluateFunctionMat(nep->f[j],H,K);
     PetscCall(PetscPopErrorHandler());
@@ -656,6 +663,14 @@ static PetscErrorCode NEPNLEIGSDividedDifferences_split(NEP nep)
       PetscCall(PetscFPTrapPop());
     }
   }
+  if (np>1) {
+    mfail = matrix;
+    PetscCall(MPIU_Allreduce(&mfail,&matrix,1,MPIU_BOOL,MPI_LAND,PetscObjectComm((PetscObject)nep)));
+    if (matrix) {
+      PetscCall(PetscMPIIntCast(nep->nt*nmax,&nc));
+      PetscCall(MPIU_Allreduce(MPI_IN_PLACE,ctx->coeffD,nc,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)nep)));
+    }
+  }
   PetscCall(MatDestroy(&H));
   PetscCall(MatDestroy(&K));
   if (!matrix) {
@@ -30,6 +30,7 @@ typedef struct {
   PetscInt  lag;              /* interval to rebuild preconditioner */
   PetscBool cctol;            /* constant correction tolerance */
   PetscBool herm;             /* whether the Hermitian version of the scalar equation must be used */
+  PetscBool wstart;           /* warm start after deflation */
   PetscReal deftol;           /* tolerance for the deflation (threshold) */
   KSP       ksp;              /* linear solver object */
 } NEP_RII;
@@ -55,10 +56,10 @@ static PetscErrorCode NEPSolve_RII(NEP nep)
   NEP_RII            *ctx = (NEP_RII*)nep->data;
   Mat                T,Tp,H,A;
   Vec                uu,u,r,delta,t;
-  PetscScalar        lambda,lambda2,sigma,a1,a2,corr;
+  PetscScalar        lambda,lambda2,sigma,fsigma,a1,a2,corr;
   PetscReal          nrm,resnorm=1.0,ktol=0.1,perr,rtol;
   PetscBool          skip=PETSC_FALSE,lock=PETSC_FALSE;
-  PetscInt           inner_its,its=0;
+  PetscInt           i,inner_its,its=0;
   NEP_EXT_OP         extop=NULL;
   KSPConvergedReason kspreason;
 
@@ -82,6 +83,7 @@ static PetscErrorCode NEPSolve_RII(NEP nep)
 
   /* prepare linear solver */
   PetscCall(NEPDeflationSolveSetUp(extop,sigma));
+  fsigma = sigma;
   PetscCall(KSPGetTolerances(ctx->ksp,&rtol,NULL,NULL,NULL));
 
   PetscCall(VecCopy(u,r));
@@ -154,7 +156,10 @@ static PetscErrorCode NEPSolve_RII(NEP nep)
     if (nep->reason == NEP_CONVERGED_ITERATING) {
       if (!skip) {
         /* update preconditioner and set adaptive tolerance */
-        if (ctx->lag && !(its%ctx->lag) && its>=2*ctx->lag && perr && nep->errest[nep->nconv]>.5*perr) PetscCall(NEPDeflationSolveSetUp(extop,lambda2));
+        if (ctx->lag && !(its%ctx->lag) && its>=2*ctx->lag && perr && nep->errest[nep->nconv]>.5*perr) {
+          PetscCall(NEPDeflationSolveSetUp(extop,lambda2));
+          fsigma = lambda2;
+        }
         if (!ctx->cctol) {
           ktol = PetscMax(ktol/2.0,rtol);
           PetscCall(KSPSetTolerances(ctx->ksp,ktol,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT));
@@ -177,7 +182,22 @@ static PetscErrorCode NEPSolve_RII(NEP nep)
       } else {
         its = -1;
         PetscCall(NEPDeflationSetRandomVec(extop,u));
-        PetscCall(NEPDeflationSolveSetUp(extop,sigma));
+        if (ctx->wstart) {
+          /* replace the leading part of the restart vector with the residual of the
+             locked eigenpair, which retains components in the remaining eigenvectors */
+          PetscCall(NEPDeflationCopyToExtendedVec(extop,nep->work[0],NULL,r,PETSC_TRUE));
+          PetscCall(VecNorm(nep->work[0],NORM_2,&nrm));
+          if (nrm>PETSC_MACHINE_EPSILON) {
+            PetscCall(VecScale(nep->work[0],1.0/nrm));
+            PetscCall(NEPDeflationCopyToExtendedVec(extop,nep->work[0],NULL,u,PETSC_FALSE));
+          }
+          /* keep the current factorization for the enlarged deflated problem, unless
+             the shift lies too close to one of the locked eigenvalues */
+          for (i=0;i<nep->nconv;i++) {
+            if (PetscAbsScalar(fsigma-nep->eigr[i])<PETSC_SQRT_MACHINE_EPSILON*PetscMax(PetscAbsScalar(fsigma),1.0)) { fsigma = sigma; break; }
+          }
+        } else fsigma = sigma;
+        PetscCall(NEPDeflationSolveSetUp(extop,fsigma));
         PetscCall(VecCopy(u,r));
         PetscCall(NEPDeflationFunctionSolve(extop,r,u));
         PetscCall(VecNorm(u,NORM_2,&nrm));
@@ -221,6 +241,8 @@ static PetscErrorCode NEPSetFromOptions_RII(NEP nep,PetscOptionItems *PetscOptio
 
     PetscCall(PetscOptionsBool("-nep_rii_hermitian","Use Hermitian version of the scalar nonlinear equation","NEPRIISetHermitian",ctx->herm,&ctx->herm,NULL));
 
+    PetscCall(PetscOptionsBool("-nep_rii_warm_start","Use warm start after deflating a converged eigenpair","NEPRIISetWarmStart",ctx->wstart,&ctx->wstart,NULL));
+
     i = 0;
     PetscCall(PetscOptionsInt("-nep_rii_lag_preconditioner","Interval to rebuild preconditioner","NEPRIISetLagPreconditioner",ctx->lag,&i,&flg));
     if (flg) PetscCall(NEPRIISetLagPreconditioner(nep,i));
@@ -530,6 +552,85 @@ PetscErrorCode NEPRIIGetHermitian(NEP nep,PetscBool *herm)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode NEPRIISetWarmStart_RII(NEP nep,PetscBool warm)
+{
+  NEP_RII *ctx = (NEP_RII*)nep->data;
+
+  PetscFunctionBegin;
+  ctx->wstart = warm;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPRIISetWarmStart - Sets a flag to warm start the iteration after each
+   deflation step.
+
+   Logically Collective
+
+   Input Parameters:
++  nep  - nonlinear eigenvalue solver
+-  warm - a boolean value
+
+   Options Database Keys:
+.  -nep_rii_warm_start <bool> - set the boolean flag
+
+   Notes:
+   By default, once an eigenpair has been locked the solver restarts with a
+   random vector and rebuilds the preconditioner at the initial shift sigma.
+   When this flag is set, the restart vector is built from the residual of the
+   locked eigenpair, which generally retains components in the remaining
+   eigenvectors, and the current (possibly lagged) factorization is kept for
+   the enlarged deflated problem, saving one factorization per deflation step.
+   The factorization is still rebuilt if its shift lies too close to one of
+   the locked eigenvalues.
+
+   Level: advanced
+
+.seealso: NEPRIIGetWarmStart(), NEPRIISetLagPreconditioner()
+@*/
+PetscErrorCode NEPRIISetWarmStart(NEP nep,PetscBool warm)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscValidLogicalCollectiveBool(nep,warm,2);
+  PetscTryMethod(nep,"NEPRIISetWarmStart_C",(NEP,PetscBool),(nep,warm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode NEPRIIGetWarmStart_RII(NEP nep,PetscBool *warm)
+{
+  NEP_RII *ctx = (NEP_RII*)nep->data;
+
+  PetscFunctionBegin;
+  *warm = ctx->wstart;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPRIIGetWarmStart - Returns the flag about warm starting the iteration
+   after each deflation step.
+
+   Not Collective
+
+   Input Parameter:
+.  nep - nonlinear eigenvalue solver
+
+   Output Parameter:
+.  warm - the value of the warm start flag
+
+   Level: advanced
+
+.seealso: NEPRIISetWarmStart()
+@*/
+PetscErrorCode NEPRIIGetWarmStart(NEP nep,PetscBool *warm)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscAssertPointer(warm,2);
+  PetscUseMethod(nep,"NEPRIIGetWarmStart_C",(NEP,PetscBool*),(nep,warm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode NEPRIISetDeflationThreshold_RII(NEP nep,PetscReal deftol)
 {
   NEP_RII *ctx = (NEP_RII*)nep->data;
@@ -697,6 +798,7 @@ static PetscErrorCode NEPView_RII(NEP nep,PetscViewer viewer)
     if (ctx->cctol) PetscCall(PetscViewerASCIIPrintf(viewer,"  using a constant tolerance for the linear solver\n"));
     if (ctx->herm) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the Hermitian version of the scalar nonlinear equation\n"));
     if (ctx->lag) PetscCall(PetscViewerASCIIPrintf(viewer,"  updating the preconditioner every %" PetscInt_FMT " iterations\n",ctx->lag));
+    if (ctx->wstart) PetscCall(PetscViewerASCIIPrintf(viewer,"  using warm start after deflation\n"));
     if (ctx->deftol) PetscCall(PetscViewerASCIIPrintf(viewer,"  deflation threshold: %g\n",(double)ctx->deftol));
     if (!ctx->ksp) PetscCall(NEPRIIGetKSP(nep,&ctx->ksp));
     PetscCall(PetscViewerASCIIPushTab(viewer));
@@ -730,6 +832,8 @@ static PetscErrorCode NEPDestroy_RII(NEP nep)
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetConstCorrectionTol_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetHermitian_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetHermitian_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetWarmStart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetWarmStart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetDeflationThreshold_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetDeflationThreshold_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetKSP_C",NULL));
@@ -748,6 +852,7 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_RII(NEP nep)
   ctx->lag          = 1;
   ctx->cctol        = PETSC_FALSE;
   ctx->herm         = PETSC_FALSE;
+  ctx->wstart       = PETSC_FALSE;
   ctx->deftol       = 0.0;
 
   nep->useds = PETSC_TRUE;
@@ -768,6 +873,8 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_RII(NEP nep)
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetConstCorrectionTol_C",NEPRIIGetConstCorrectionTol_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetHermitian_C",NEPRIISetHermitian_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetHermitian_C",NEPRIIGetHermitian_RII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetWarmStart_C",NEPRIISetWarmStart_RII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetWarmStart_C",NEPRIIGetWarmStart_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetDeflationThreshold_C",NEPRIISetDeflationThreshold_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetDeflationThreshold_C",NEPRIIGetDeflationThreshold_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetKSP_C",NEPRIISetKSP_RII));
@@ -149,7 +149,7 @@ PetscErrorCode NEPSolve_SLP(NEP nep)
   PetscScalar       sigma,lambda,mu,im;
   PetscReal         resnorm;
   PetscInt          nconv;
-  PetscBool         skip=PETSC_FALSE,lock=PETSC_FALSE;
+  PetscBool         skip=PETSC_FALSE,lock=PETSC_FALSE,flg;
   NEP_EXT_OP        extop=NULL;    /* Extended operator for deflation */
 
   PetscFunctionBegin;
@@ -158,6 +158,10 @@ PetscErrorCode NEPSolve_SLP(NEP nep)
   if (!nep->nini) PetscCall(BVSetRandomColumn(nep->V,0));
   lambda = sigma;
   if (!ctx->ksp) PetscCall(NEPSLPGetKSP(nep,&ctx->ksp));
+  if (ctx->lag!=1) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)ctx->ksp,KSPPREONLY,&flg));
+    PetscCheck(!flg,PetscObjectComm((PetscObject)nep),PETSC_ERR_SUP,"Lagging the preconditioner requires an iterative linear solver that can correct the solves, not KSPPREONLY");
+  }
   PetscCall(NEPDeflationInitialize(nep,nep->V,ctx->ksp,PETSC_TRUE,nep->nev,&extop));
   PetscCall(NEPDeflationCreateVec(extop,&u));
   PetscCall(VecDuplicate(u,&r));
@@ -201,6 +205,7 @@ PetscErrorCode NEPSolve_SLP(NEP nep)
     if (nep->reason == NEP_CONVERGED_ITERATING) {
       if (!skip) {
         /* evaluate T(lambda) and T'(lambda) */
+        if (ctx->lag!=1) PetscCall(KSPSetReusePreconditioner(ctx->ksp,(nep->its>1 && (!ctx->lag || (nep->its-1)%ctx->lag))?PETSC_TRUE:PETSC_FALSE));
         PetscCall(NEPSLPSetUpLinearEP(nep,extop,lambda,u,nep->its==1?PETSC_TRUE:PETSC_FALSE));
         /* compute new eigenvalue correction mu and eigenvector approximation u */
         PetscCall(EPSSolve(ctx->eps));
@@ -250,6 +255,7 @@ static PetscErrorCode NEPSetFromOptions_SLP(NEP nep,PetscOptionItems *PetscOptio
   NEP_SLP        *ctx = (NEP_SLP*)nep->data;
   PetscBool      flg;
   PetscReal      r;
+  PetscInt       i;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject,"NEP SLP Options");
@@ -258,6 +264,10 @@ static PetscErrorCode NEPSetFromOptions_SLP(NEP nep,PetscOptionItems *PetscOptio
     PetscCall(PetscOptionsReal("-nep_slp_deflation_threshold","Tolerance used as a threshold for including deflated eigenpairs","NEPSLPSetDeflationThreshold",ctx->deftol,&r,&flg));
     if (flg) PetscCall(NEPSLPSetDeflationThreshold(nep,r));
 
+    i = 0;
+    PetscCall(PetscOptionsInt("-nep_slp_lag_preconditioner","Interval to rebuild preconditioner","NEPSLPSetLagPreconditioner",ctx->lag,&i,&flg));
+    if (flg) PetscCall(NEPSLPSetLagPreconditioner(nep,i));
+
   PetscOptionsHeadEnd();
 
   if (!ctx->eps) PetscCall(NEPSLPGetEPS(nep,&ctx->eps));
@@ -353,6 +363,86 @@ PetscErrorCode NEPSLPGetDeflationThreshold(NEP nep,PetscReal *deftol)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode NEPSLPSetLagPreconditioner_SLP(NEP nep,PetscInt lag)
+{
+  NEP_SLP *ctx = (NEP_SLP*)nep->data;
+
+  PetscFunctionBegin;
+  PetscCheck(lag>=0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Lag must be non-negative");
+  ctx->lag = lag;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPSLPSetLagPreconditioner - Determines when the preconditioner is rebuilt
+   in the linear solves performed at each iteration of the SLP method.
+
+   Logically Collective
+
+   Input Parameters:
++  nep - nonlinear eigenvalue solver
+-  lag - 0 indicates NEVER rebuild, 1 means rebuild every time the eigenvalue
+         approximation is updated within the nonlinear iteration, 2 means every
+         second time and so on
+
+   Options Database Keys:
+.  -nep_slp_lag_preconditioner <lag> - the lag value
+
+   Notes:
+   The default is to rebuild the preconditioner, typically a factorization of
+   the current Function matrix, at every iteration of the method. With a lag,
+   intermediate iterations keep the factors computed at a previous eigenvalue
+   approximation and rely on the iterations of the linear solver to correct
+   the solves, so the associated KSP must not be of type KSPPREONLY.
+
+   This option is not used in the two-sided variant.
+
+   Level: intermediate
+
+.seealso: NEPSLPGetLagPreconditioner(), NEPSLPSetKSP()
+@*/
+PetscErrorCode NEPSLPSetLagPreconditioner(NEP nep,PetscInt lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscValidLogicalCollectiveInt(nep,lag,2);
+  PetscTryMethod(nep,"NEPSLPSetLagPreconditioner_C",(NEP,PetscInt),(nep,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode NEPSLPGetLagPreconditioner_SLP(NEP nep,PetscInt *lag)
+{
+  NEP_SLP *ctx = (NEP_SLP*)nep->data;
+
+  PetscFunctionBegin;
+  *lag = ctx->lag;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPSLPGetLagPreconditioner - Indicates how often the preconditioner is rebuilt.
+
+   Not Collective
+
+   Input Parameter:
+.  nep - nonlinear eigenvalue solver
+
+   Output Parameter:
+.  lag - the lag parameter
+
+   Level: intermediate
+
+.seealso: NEPSLPSetLagPreconditioner()
+@*/
+PetscErrorCode NEPSLPGetLagPreconditioner(NEP nep,PetscInt *lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscAssertPointer(lag,2);
+  PetscUseMethod(nep,"NEPSLPGetLagPreconditioner_C",(NEP,PetscInt*),(nep,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode NEPSLPSetEPS_SLP(NEP nep,EPS eps)
 {
   NEP_SLP        *ctx = (NEP_SLP*)nep->data;
@@ -597,6 +687,7 @@ static PetscErrorCode NEPView_SLP(NEP nep,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     if (ctx->deftol) PetscCall(PetscViewerASCIIPrintf(viewer,"  deflation threshold: %g\n",(double)ctx->deftol));
+    if (ctx->lag!=1) PetscCall(PetscViewerASCIIPrintf(viewer,"  updating the preconditioner every %" PetscInt_FMT " iterations\n",ctx->lag));
     if (!ctx->eps) PetscCall(NEPSLPGetEPS(nep,&ctx->eps));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(EPSView(ctx->eps,viewer));
@@ -633,6 +724,8 @@ static PetscErrorCode NEPDestroy_SLP(NEP nep)
   PetscCall(PetscFree(nep->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetDeflationThreshold_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetDeflationThreshold_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetLagPreconditioner_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetLagPreconditioner_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetEPS_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetEPS_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetEPSLeft_C",NULL));
@@ -652,6 +745,7 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_SLP(NEP nep)
 
   nep->useds  = PETSC_TRUE;
   ctx->deftol = PETSC_DEFAULT;
+  ctx->lag    = 1;
 
   nep->ops->solve          = NEPSolve_SLP;
   nep->ops->setup          = NEPSetUp_SLP;
@@ -663,6 +757,8 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_SLP(NEP nep)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetDeflationThreshold_C",NEPSLPSetDeflationThreshold_SLP));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetDeflationThreshold_C",NEPSLPGetDeflationThreshold_SLP));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetLagPreconditioner_C",NEPSLPSetLagPreconditioner_SLP));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetLagPreconditioner_C",NEPSLPGetLagPreconditioner_SLP));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetEPS_C",NEPSLPSetEPS_SLP));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPGetEPS_C",NEPSLPGetEPS_SLP));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPSLPSetEPSLeft_C",NEPSLPSetEPSLeft_SLP));
@@ -62,8 +62,7 @@ PetscErrorCode NEPInitializePackage(void)
   PetscCall(PetscClassIdRegister("NEP Solver",&NEP_CLASSID));
   /* Register Constructors */
   PetscCall(NEPRegisterAll());
-  /* Register Monitors */
-  PetscCall(NEPMonitorRegisterAll());
+  /* Monitors are registered on demand, see NEPMonitorSetFromOptions() */
   /* Register Events */
   PetscCall(PetscLogEventRegister("NEPSetUp",NEP_CLASSID,&NEP_SetUp));
   PetscCall(PetscLogEventRegister("NEPSolve",NEP_CLASSID,&NEP_Solve));
@@ -70,6 +70,7 @@ PetscErrorCode NEPCreate(MPI_Comm comm,NEP *outnep)
   nep->scheme          = (NEPRefineScheme)0;
   nep->trackall        = PETSC_FALSE;
   nep->twosided        = PETSC_FALSE;
+  nep->cachet          = PETSC_FALSE;
 
   nep->computefunction = NULL;
   nep->computejacobian = NULL;
@@ -98,6 +99,7 @@ PetscErrorCode NEPCreate(MPI_Comm comm,NEP *outnep)
   nep->mstr            = UNKNOWN_NONZERO_PATTERN;
   nep->P               = NULL;
   nep->mstrp           = UNKNOWN_NONZERO_PATTERN;
+  nep->AT              = NULL;
   nep->IS              = NULL;
   nep->eigr            = NULL;
   nep->eigi            = NULL;
@@ -294,6 +296,7 @@ PetscErrorCode NEPReset_Problem(NEP nep)
     PetscCall(PetscFree(nep->f));
     PetscCall(PetscFree(nep->nrma));
     if (nep->P) PetscCall(MatDestroyMatrices(nep->nt,&nep->P));
+    if (nep->AT) PetscCall(MatDestroyMatrices(nep->nt,&nep->AT));
     nep->nt = 0;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
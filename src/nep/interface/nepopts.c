@@ -48,6 +48,9 @@ PetscErrorCode NEPMonitorSetFromOptions(NEP nep,const char opt[],const char name
   PetscCall(PetscOptionsGetViewer(PetscObjectComm((PetscObject)nep),((PetscObject)nep)->options,((PetscObject)nep)->prefix,opt,&viewer,&format,&flg));
   if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
 
+  /* Register built-in monitors the first time one is requested */
+  PetscCall(NEPMonitorRegisterAll());
+
   PetscCall(PetscViewerGetType(viewer,&vtype));
   PetscCall(SlepcMonitorMakeKey_Internal(name,vtype,format,key));
   PetscCall(PetscFunctionListFind(NEPMonitorList,key,&mfunc));
@@ -174,6 +177,9 @@ PetscErrorCode NEPSetFromOptions(NEP nep)
     PetscCall(PetscOptionsBool("-nep_two_sided","Use two-sided variant (to compute left eigenvectors)","NEPSetTwoSided",nep->twosided,&bval,&flg));
     if (flg) PetscCall(NEPSetTwoSided(nep,bval));
 
+    PetscCall(PetscOptionsBool("-nep_cache_transpose","Cache the transposes of the split matrices","NEPSetCacheTranspose",nep->cachet,&bval,&flg));
+    if (flg) PetscCall(NEPSetCacheTranspose(nep,bval));
+
     /* -----------------------------------------------------------------------*/
     /*
       Cancels all monitors hardwired into code before call to NEPSetFromOptions()
@@ -652,6 +658,71 @@ PetscErrorCode NEPGetTwoSided(NEP nep,PetscBool *twosided)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   NEPSetCacheTranspose - Sets a flag to cache the (conjugate) transposes of
+   the split form matrices.
+
+   Logically Collective
+
+   Input Parameters:
++  nep    - the eigensolver context
+-  cachet - whether the transposes are to be cached or not
+
+   Options Database Keys:
+.  -nep_cache_transpose <boolean> - Sets/resets the flag
+
+   Notes:
+   This option is relevant only when the problem has been specified in split
+   form with NEPSetSplitOperator(). If activated, representations of A_i^H
+   are built once during NEPSetUp() and reused in all subsequent applications
+   of T(lambda)^H, such as left residual evaluations in two-sided solvers.
+   An explicit transpose is assembled whenever the matrix type supports it,
+   otherwise a virtual wrapper created with MatCreateHermitianTranspose() is
+   used. Applying the adjoint operator repeatedly (as done when computing
+   errors of left eigenvectors) is much cheaper this way, at the expense of
+   storing a copy of the matrices.
+
+   Level: advanced
+
+.seealso: NEPGetCacheTranspose(), NEPSetSplitOperator(), NEPSetTwoSided()
+@*/
+PetscErrorCode NEPSetCacheTranspose(NEP nep,PetscBool cachet)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscValidLogicalCollectiveBool(nep,cachet,2);
+  if (cachet!=nep->cachet) {
+    nep->cachet = cachet;
+    nep->state  = NEP_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPGetCacheTranspose - Returns the flag indicating whether the transposes
+   of the split form matrices are being cached or not.
+
+   Not Collective
+
+   Input Parameter:
+.  nep - the eigensolver context
+
+   Output Parameter:
+.  cachet - the returned flag
+
+   Level: advanced
+
+.seealso: NEPSetCacheTranspose()
+@*/
+PetscErrorCode NEPGetCacheTranspose(NEP nep,PetscBool *cachet)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscAssertPointer(cachet,2);
+  *cachet = nep->cachet;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
    NEPSetConvergenceTestFunction - Sets a function to compute the error estimate
    used in the convergence test.
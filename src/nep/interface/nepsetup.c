@@ -96,6 +96,15 @@ PetscErrorCode NEPSetUp(NEP nep)
     PetscCall(MatDuplicate(nep->A[0],MAT_DO_NOT_COPY_VALUES,&nep->jacobian));
     PetscCall(MatGetSize(nep->A[0],&nep->n,NULL));
     PetscCall(MatGetLocalSize(nep->A[0],&nep->nloc,NULL));
+    if (nep->cachet && !nep->AT) {
+      /* cache A_i^H, explicitly if the matrix type supports it */
+      PetscCall(PetscMalloc1(nep->nt,&nep->AT));
+      for (k=0;k<nep->nt;k++) {
+        PetscCall(MatHasOperation(nep->A[k],MATOP_TRANSPOSE,&flg));
+        if (flg) PetscCall(MatHermitianTranspose(nep->A[k],MAT_INITIAL_MATRIX,&nep->AT[k]));
+        else PetscCall(MatCreateHermitianTranspose(nep->A[k],&nep->AT[k]));
+      }
+    }
     break;
   }
 
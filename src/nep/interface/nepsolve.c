@@ -263,6 +263,16 @@ PetscErrorCode NEPApplyAdjoint(NEP nep,PetscScalar lambda,Vec x,Vec v,Vec y,Mat
   if (A) PetscValidHeaderSpecific(A,MAT_CLASSID,6);
   if (B) PetscValidHeaderSpecific(B,MAT_CLASSID,7);
 
+  if (nep->fui==NEP_USER_INTERFACE_SPLIT && nep->AT) {
+    /* cached transposes: apply y = sum_i conj(f_i(lambda)) A_i^H x directly */
+    PetscCall(VecSet(y,0.0));
+    for (i=0;i<nep->nt;i++) {
+      PetscCall(FNEvaluateFunction(nep->f[i],lambda,&alpha));
+      PetscCall(MatMult(nep->AT[i],x,v));
+      PetscCall(VecAXPY(y,PetscConj(alpha),v));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(VecDuplicate(x,&w));
   PetscCall(VecCopy(x,w));
   PetscCall(VecConjugate(w));
@@ -717,6 +727,71 @@ PetscErrorCode NEPComputeError(NEP nep,PetscInt i,NEPErrorType type,PetscReal *e
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   NEPSplitSumSeqAIJ - compute A = sum_i alpha[i]*Ai[i] with a single fused pass
+   over the value arrays, assuming all matrices share the nonzero pattern.
+*/
+static PetscErrorCode NEPSplitSumSeqAIJ(Mat A,PetscInt nt,const PetscScalar *alpha,Mat *Ai)
+{
+  PetscInt          i,k,nz;
+  PetscScalar       *aa,t;
+  const PetscScalar **ai;
+  MatInfo           info;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetInfo(A,MAT_LOCAL,&info));
+  nz = (PetscInt)info.nz_used;
+  PetscCall(PetscMalloc1(nt,&ai));
+  for (i=0;i<nt;i++) PetscCall(MatSeqAIJGetArrayRead(Ai[i],&ai[i]));
+  PetscCall(MatSeqAIJGetArrayWrite(A,&aa));
+  for (k=0;k<nz;k++) {
+    t = alpha[0]*ai[0][k];
+    for (i=1;i<nt;i++) t += alpha[i]*ai[i][k];
+    aa[k] = t;
+  }
+  PetscCall(MatSeqAIJRestoreArrayWrite(A,&aa));
+  for (i=0;i<nt;i++) PetscCall(MatSeqAIJRestoreArrayRead(Ai[i],&ai[i]));
+  PetscCall(PetscFree(ai));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   NEPComputeSplitSum - assemble the linear combination of the split matrices
+   with coefficients alpha. When all matrices are of AIJ type and share the
+   nonzero pattern, the combination is done with one fused pass per value
+   array instead of one MatAXPY pass per term.
+*/
+static PetscErrorCode NEPComputeSplitSum(Mat A,PetscInt nt,const PetscScalar *alpha,Mat *Ai,MatStructure str)
+{
+  PetscInt       i;
+  PetscBool      fused=PETSC_FALSE,mpiaij=PETSC_FALSE,flg;
+  Mat            Ad,Ao,Td,To,*Aid,*Aio;
+
+  PetscFunctionBegin;
+  if (str==SAME_NONZERO_PATTERN) {
+    PetscCall(PetscObjectBaseTypeCompareAny((PetscObject)A,&fused,MATSEQAIJ,MATMPIAIJ,""));
+    if (fused) PetscCall(PetscObjectBaseTypeCompare((PetscObject)A,MATMPIAIJ,&mpiaij));
+    for (i=0;i<nt && fused;i++) {
+      PetscCall(PetscObjectBaseTypeCompare((PetscObject)Ai[i],mpiaij?MATMPIAIJ:MATSEQAIJ,&flg));
+      fused = flg;
+    }
+  }
+  if (fused && !mpiaij) PetscCall(NEPSplitSumSeqAIJ(A,nt,alpha,Ai));
+  else if (fused) {
+    PetscCall(PetscMalloc2(nt,&Aid,nt,&Aio));
+    PetscCall(MatMPIAIJGetSeqAIJ(A,&Td,&To,NULL));
+    for (i=0;i<nt;i++) PetscCall(MatMPIAIJGetSeqAIJ(Ai[i],&Aid[i],&Aio[i],NULL));
+    PetscCall(NEPSplitSumSeqAIJ(Td,nt,alpha,Aid));
+    PetscCall(NEPSplitSumSeqAIJ(To,nt,alpha,Aio));
+    PetscCall(PetscFree2(Aid,Aio));
+    PetscCall(PetscObjectStateIncrease((PetscObject)A));
+  } else {
+    PetscCall(MatZeroEntries(A));
+    for (i=0;i<nt;i++) PetscCall(MatAXPY(A,alpha[i],Ai[i],str));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    NEPComputeFunction - Computes the function matrix T(lambda) that has been
    set with NEPSetFunction().
@@ -743,7 +818,7 @@ PetscErrorCode NEPComputeError(NEP nep,PetscInt i,NEPErrorType type,PetscReal *e
 PetscErrorCode NEPComputeFunction(NEP nep,PetscScalar lambda,Mat A,Mat B)
 {
   PetscInt       i;
-  PetscScalar    alpha;
+  PetscScalar    *vals;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
@@ -756,13 +831,11 @@ PetscErrorCode NEPComputeFunction(NEP nep,PetscScalar lambda,Mat A,Mat B)
     PetscCall(PetscLogEventEnd(NEP_FunctionEval,nep,A,B,0));
     break;
   case NEP_USER_INTERFACE_SPLIT:
-    PetscCall(MatZeroEntries(A));
-    if (A != B) PetscCall(MatZeroEntries(B));
-    for (i=0;i<nep->nt;i++) {
-      PetscCall(FNEvaluateFunction(nep->f[i],lambda,&alpha));
-      PetscCall(MatAXPY(A,alpha,nep->A[i],nep->mstr));
-      if (A != B) PetscCall(MatAXPY(B,alpha,nep->P[i],nep->mstrp));
-    }
+    PetscCall(PetscMalloc1(nep->nt,&vals));
+    for (i=0;i<nep->nt;i++) PetscCall(FNEvaluateFunction(nep->f[i],lambda,&vals[i]));
+    PetscCall(NEPComputeSplitSum(A,nep->nt,vals,nep->A,nep->mstr));
+    if (A != B) PetscCall(NEPComputeSplitSum(B,nep->nt,vals,nep->P,nep->mstrp));
+    PetscCall(PetscFree(vals));
     break;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -792,7 +865,7 @@ PetscErrorCode NEPComputeFunction(NEP nep,PetscScalar lambda,Mat A,Mat B)
 PetscErrorCode NEPComputeJacobian(NEP nep,PetscScalar lambda,Mat A)
 {
   PetscInt       i;
-  PetscScalar    alpha;
+  PetscScalar    *vals;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
@@ -805,11 +878,10 @@ PetscErrorCode NEPComputeJacobian(NEP nep,PetscScalar lambda,Mat A)
     PetscCall(PetscLogEventEnd(NEP_JacobianEval,nep,A,0,0));
     break;
   case NEP_USER_INTERFACE_SPLIT:
-    PetscCall(MatZeroEntries(A));
-    for (i=0;i<nep->nt;i++) {
-      PetscCall(FNEvaluateDerivative(nep->f[i],lambda,&alpha));
-      PetscCall(MatAXPY(A,alpha,nep->A[i],nep->mstr));
-    }
+    PetscCall(PetscMalloc1(nep->nt,&vals));
+    for (i=0;i<nep->nt;i++) PetscCall(FNEvaluateDerivative(nep->f[i],lambda,&vals[i]));
+    PetscCall(NEPComputeSplitSum(A,nep->nt,vals,nep->A,nep->mstr));
+    PetscCall(PetscFree(vals));
     break;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
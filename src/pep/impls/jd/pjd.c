@@ -51,9 +51,11 @@ typedef struct {
   PetscReal   keep;          /* restart parameter */
   PetscReal   fix;           /* fix parameter */
   PetscBool   reusepc;       /* flag indicating whether pc is rebuilt or not */
+  PetscBool   compact;       /* regenerate T*V on the fly instead of storing it */
   BV          V;             /* work basis vectors to store the search space */
   BV          W;             /* work basis vectors to store the test space */
   BV          *TV;           /* work basis vectors to store T*V (each TV[i] is the coefficient for \lambda^i of T*V for the extended T) */
+  BV          TW;            /* work basis holding the regenerated coefficients of one column (compact mode) */
   BV          *AX;           /* work basis vectors to store A_i*X for locked eigenvectors */
   BV          N[2];          /* auxiliary work BVs */
   BV          X;             /* locked eigenvectors */
@@ -156,7 +158,14 @@ static PetscErrorCode PEPSetUp_JD(PEP pep)
   pjd->ld++;
 #endif
   PetscCall(PetscMalloc2(pep->nmat,&pjd->TV,pep->nmat,&pjd->AX));
-  for (i=0;i<pep->nmat;i++) PetscCall(PEPJDDuplicateBasis(pep,pjd->TV+i));
+  if (pjd->compact) {
+    /* one work basis regenerated on the fly replaces the nmat stored copies */
+    for (i=0;i<pep->nmat;i++) pjd->TV[i] = NULL;
+    PetscCall(PEPJDDuplicateBasis(pep,&pjd->TW));
+    PetscCall(BVResize(pjd->TW,pep->nmat,PETSC_FALSE));
+  } else {
+    for (i=0;i<pep->nmat;i++) PetscCall(PEPJDDuplicateBasis(pep,pjd->TV+i));
+  }
   if (pjd->ld>1) {
     PetscCall(PEPJDDuplicateBasis(pep,&pjd->V));
     PetscCall(BVSetFromOptions(pjd->V));
@@ -218,7 +227,8 @@ static PetscErrorCode PEPJDUpdateTV(PEP pep,PetscInt low,PetscInt high,Vec *w)
       PetscCall(BVDotVec(pjd->X,t1,xx));
     }
     for (pp=pep->nmat-1;pp>=0;pp--) {
-      PetscCall(BVGetColumn(pjd->TV[pp],col,&v2));
+      if (pjd->compact) PetscCall(BVGetColumn(pjd->TW,pp,&v2));
+      else PetscCall(BVGetColumn(pjd->TV[pp],col,&v2));
       PetscCall(VecGetArray(v2,&array2));
       PetscCall(VecPlaceArray(t2,array2));
       PetscCall(MatMult(pep->A[pp],t1,t2));
@@ -261,7 +271,8 @@ static PetscErrorCode PEPJDUpdateTV(PEP pep,PetscInt low,PetscInt high,Vec *w)
       }
       PetscCall(VecResetArray(t2));
       PetscCall(VecRestoreArray(v2,&array2));
-      PetscCall(BVRestoreColumn(pjd->TV[pp],col,&v2));
+      if (pjd->compact) PetscCall(BVRestoreColumn(pjd->TW,pp,&v2));
+      else PetscCall(BVRestoreColumn(pjd->TV[pp],col,&v2));
     }
     PetscCall(VecResetArray(t1));
     PetscCall(VecRestoreArray(v1,&array1));
@@ -1199,14 +1210,15 @@ static PetscErrorCode PEPJDSystemSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Ve
 static PetscErrorCode PEPSolve_JD(PEP pep)
 {
   PEP_JD          *pjd = (PEP_JD*)pep->data;
-  PetscInt        k,nv,nvc,ld,minv,dim,bupdated=0,sz=1,kspsf=1,idx,off,maxits,nloc;
+  PetscInt        k,col,nv,nvc,ld,minv,dim,bupdated=0,sz=1,kspsf=1,idx,off,maxits,nloc;
   PetscMPIInt     np,count;
-  PetscScalar     theta[2]={0.0,0.0},ritz[2]={0.0,0.0},*pX,*eig,*eigi,*array;
+  PetscScalar     theta[2]={0.0,0.0},ritz[2]={0.0,0.0},*pX,*eig,*eigi,*array,*garray;
+  const PetscScalar *carray;
   PetscReal       norm,*res,tol=0.0,rtol,abstol, dtol;
   PetscBool       lindep,ini=PETSC_TRUE;
   Vec             tc,t[2]={NULL,NULL},u[2]={NULL,NULL},p[2]={NULL,NULL};
   Vec             rc,rr[2],r[2]={NULL,NULL},*ww=pep->work,v[2];
-  Mat             G,X,Y;
+  Mat             G,Gc,X,Y;
   KSP             ksp;
   PEP_JD_PCSHELL  *pcctx;
   PEP_JD_MATSHELL *matctx;
@@ -1248,13 +1260,32 @@ static PetscErrorCode PEPSolve_JD(PEP pep)
     pep->its++;
     PetscCall(DSSetDimensions(pep->ds,nv,0,0));
     PetscCall(BVSetActiveColumns(pjd->V,bupdated,nv));
-    PetscCall(PEPJDUpdateTV(pep,bupdated,nv,ww));
-    if (pjd->proj==PEP_JD_PROJECTION_HARMONIC) PetscCall(BVSetActiveColumns(pjd->W,bupdated,nv));
-    for (k=0;k<pep->nmat;k++) {
-      PetscCall(BVSetActiveColumns(pjd->TV[k],bupdated,nv));
-      PetscCall(DSGetMat(pep->ds,DSMatExtra[k],&G));
-      PetscCall(BVMatProject(pjd->TV[k],NULL,pjd->W,G));
-      PetscCall(DSRestoreMat(pep->ds,DSMatExtra[k],&G));
+    if (pjd->compact) {
+      /* the coefficients of T*V are not stored, so regenerate them column by
+         column and project all degrees at once */
+      PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,nv,pep->nmat,NULL,&Gc));
+      PetscCall(BVSetActiveColumns(pjd->W,0,nv));
+      for (col=0;col<nv;col++) {
+        PetscCall(PEPJDUpdateTV(pep,col,col+1,ww));
+        PetscCall(BVMatProject(pjd->TW,NULL,pjd->W,Gc));
+        PetscCall(MatDenseGetArrayRead(Gc,&carray));
+        for (k=0;k<pep->nmat;k++) {
+          PetscCall(DSGetArray(pep->ds,DSMatExtra[k],&garray));
+          PetscCall(PetscArraycpy(garray+col*ld,carray+k*nv,nv));
+          PetscCall(DSRestoreArray(pep->ds,DSMatExtra[k],&garray));
+        }
+        PetscCall(MatDenseRestoreArrayRead(Gc,&carray));
+      }
+      PetscCall(MatDestroy(&Gc));
+    } else {
+      PetscCall(PEPJDUpdateTV(pep,bupdated,nv,ww));
+      if (pjd->proj==PEP_JD_PROJECTION_HARMONIC) PetscCall(BVSetActiveColumns(pjd->W,bupdated,nv));
+      for (k=0;k<pep->nmat;k++) {
+        PetscCall(BVSetActiveColumns(pjd->TV[k],bupdated,nv));
+        PetscCall(DSGetMat(pep->ds,DSMatExtra[k],&G));
+        PetscCall(BVMatProject(pjd->TV[k],NULL,pjd->W,G));
+        PetscCall(DSRestoreMat(pep->ds,DSMatExtra[k],&G));
+      }
     }
     PetscCall(BVSetActiveColumns(pjd->V,0,nv));
     PetscCall(BVSetActiveColumns(pjd->W,0,nv));
@@ -1853,6 +1884,87 @@ PetscErrorCode PEPJDGetProjection(PEP pep,PEPJDProjection *proj)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PEPJDSetCompact_JD(PEP pep,PetscBool compact)
+{
+  PEP_JD *pjd = (PEP_JD*)pep->data;
+
+  PetscFunctionBegin;
+  if (pjd->compact != compact) {
+    pjd->compact = compact;
+    pep->state   = PEP_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPJDSetCompact - Sets a flag indicating that the coefficients of the
+   extended search space must be regenerated on the fly instead of stored.
+
+   Logically Collective
+
+   Input Parameters:
++  pep     - the eigenproblem solver context
+-  compact - boolean flag
+
+   Options Database Key:
+.  -pep_jd_compact - Sets the compact flag
+
+   Notes:
+   By default, the solver stores the coefficients of T times the search space,
+   one basis per polynomial degree, which dominates the memory footprint for
+   problems of high degree. With the compact representation only the search
+   space itself is kept, and the coefficients are regenerated column by column
+   when the projected problem is assembled. This divides the workspace by the
+   number of polynomial matrices, at the cost of recomputing the coefficients
+   of all columns at every outer iteration.
+
+   Level: advanced
+
+.seealso: PEPJDGetCompact(), PEPJDSetProjection()
+@*/
+PetscErrorCode PEPJDSetCompact(PEP pep,PetscBool compact)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscValidLogicalCollectiveBool(pep,compact,2);
+  PetscTryMethod(pep,"PEPJDSetCompact_C",(PEP,PetscBool),(pep,compact));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PEPJDGetCompact_JD(PEP pep,PetscBool *compact)
+{
+  PEP_JD *pjd = (PEP_JD*)pep->data;
+
+  PetscFunctionBegin;
+  *compact = pjd->compact;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPJDGetCompact - Returns the flag indicating if the coefficients of the
+   extended search space are regenerated on the fly.
+
+   Not Collective
+
+   Input Parameter:
+.  pep - the eigenproblem solver context
+
+   Output Parameter:
+.  compact - the compact flag
+
+   Level: advanced
+
+.seealso: PEPJDSetCompact()
+@*/
+PetscErrorCode PEPJDGetCompact(PEP pep,PetscBool *compact)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscAssertPointer(compact,2);
+  PetscUseMethod(pep,"PEPJDGetCompact_C",(PEP,PetscBool*),(pep,compact));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PEPSetFromOptions_JD(PEP pep,PetscOptionItems *PetscOptionsObject)
 {
   PetscBool       flg,b1;
@@ -1878,6 +1990,9 @@ static PetscErrorCode PEPSetFromOptions_JD(PEP pep,PetscOptionItems *PetscOption
     PetscCall(PetscOptionsEnum("-pep_jd_projection","Type of projection","PEPJDSetProjection",PEPJDProjectionTypes,(PetscEnum)PEP_JD_PROJECTION_HARMONIC,(PetscEnum*)&proj,&flg));
     if (flg) PetscCall(PEPJDSetProjection(pep,proj));
 
+    PetscCall(PetscOptionsBool("-pep_jd_compact","Whether to regenerate the extended search space instead of storing it","PEPJDSetCompact",PETSC_FALSE,&b1,&flg));
+    if (flg) PetscCall(PEPJDSetCompact(pep,b1));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1895,6 +2010,7 @@ static PetscErrorCode PEPView_JD(PEP pep,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer,"  projection type: %s\n",PEPJDProjectionTypes[pjd->proj]));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  maximum allowed minimality index: %" PetscInt_FMT "\n",pjd->mmidx));
     if (pjd->reusepc) PetscCall(PetscViewerASCIIPrintf(viewer,"  reusing the preconditioner\n"));
+    if (pjd->compact) PetscCall(PetscViewerASCIIPrintf(viewer,"  using a compact representation of the extended search space\n"));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1923,7 +2039,8 @@ static PetscErrorCode PEPReset_JD(PEP pep)
   PetscInt       i;
 
   PetscFunctionBegin;
-  for (i=0;i<pep->nmat;i++) PetscCall(BVDestroy(pjd->TV+i));
+  if (pjd->compact) PetscCall(BVDestroy(&pjd->TW));
+  else for (i=0;i<pep->nmat;i++) PetscCall(BVDestroy(pjd->TV+i));
   if (pjd->proj==PEP_JD_PROJECTION_HARMONIC) PetscCall(BVDestroy(&pjd->W));
   if (pjd->ld>1) {
     PetscCall(BVDestroy(&pjd->V));
@@ -1950,6 +2067,8 @@ static PetscErrorCode PEPDestroy_JD(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetMinimalityIndex_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetProjection_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetProjection_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetCompact_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetCompact_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1983,5 +2102,7 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_JD(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetMinimalityIndex_C",PEPJDGetMinimalityIndex_JD));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetProjection_C",PEPJDSetProjection_JD));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetProjection_C",PEPJDGetProjection_JD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetCompact_C",PEPJDSetCompact_JD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetCompact_C",PEPJDGetCompact_JD));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -101,4 +101,6 @@ typedef struct {
   PetscBool     hyperbolic;     /* hyperbolic problem flag */
   PetscReal     alpha,beta;     /* coefficients defining the linearization */
   PetscBool     checket;        /* check eigenvalue type during spectrum slicing */
+  PetscErrorCode (*sink)(PEP,PetscInt,PetscScalar,Vec,void*); /* receives eigenpairs as they are validated */
+  void          *sinkctx;       /* user context for the sink callback */
 } PEP_STOAR;
@@ -770,11 +770,11 @@ static PetscErrorCode PEPStoreEigenpairs(PEP pep)
 {
   PEP_STOAR      *ctx=(PEP_STOAR*)pep->data;
   PetscReal      lambda,err,*errest;
-  PetscInt       i,*aux,count=0,ndef,ld,nconv=pep->nconv,d=pep->nmat-1,idx;
+  PetscInt       i,j,*aux,count=0,ndef,ld,nconv=pep->nconv,d=pep->nmat-1,idx;
   PetscBool      iscayley,divide=PETSC_FALSE;
   PEP_SR         sr = ctx->sr;
   PEP_shift      sPres;
-  Vec            w,vomega;
+  Vec            u,w,vomega;
   Mat            MS;
   BV             tV;
   PetscScalar    *S,*eigr,*tS,*omega;
@@ -914,6 +914,20 @@ static PetscErrorCode PEPStoreEigenpairs(PEP pep)
     sr->indexEig += sPres->neigs;
     sPres->nconv[0]-= sr->ndef0;
     sPres->nconv[1]-= sr->ndef1;
+    /* Stream the newly validated eigenpairs to the caller-provided sink */
+    if (ctx->sink && sPres->neigs>0) {
+      PetscCall(BVCreateVec(sr->V,&u));
+      for (i=sPres->index;i<sr->indexEig;i++) {
+        PetscCall(VecSet(u,0.0));
+        for (j=0;j<sr->qinfo[i].nq;j++) {
+          PetscCall(BVGetColumn(sr->V,sr->qinfo[i].q[j],&w));
+          PetscCall(VecAXPY(u,*(sr->S+i*sr->ld*d+j),w));
+          PetscCall(BVRestoreColumn(sr->V,sr->qinfo[i].q[j],&w));
+        }
+        PetscCall((*ctx->sink)(pep,i,sr->eigr[i],u,ctx->sinkctx));
+      }
+      PetscCall(VecDestroy(&u));
+    }
     PetscCall(PetscFree4(eigr,errest,tS,aux));
   } else {
     sPres->neigs = 0;
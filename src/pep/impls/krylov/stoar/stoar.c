@@ -1006,6 +1006,64 @@ PetscErrorCode PEPSTOARGetCheckEigenvalueType(PEP pep,PetscBool *checket)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PEPSTOARSetEigenpairSink_STOAR(PEP pep,PetscErrorCode (*sink)(PEP,PetscInt,PetscScalar,Vec,void*),void *sinkctx)
+{
+  PEP_STOAR *ctx = (PEP_STOAR*)pep->data;
+
+  PetscFunctionBegin;
+  ctx->sink    = sink;
+  ctx->sinkctx = sinkctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+   PEPSTOARSetEigenpairSink - Sets a callback to receive eigenpairs as soon as
+   they are validated during spectrum slicing.
+
+   Logically Collective
+
+   Input Parameters:
++  pep     - the eigenproblem solver context
+.  sink    - the callback function
+-  sinkctx - context for the callback (may be NULL)
+
+   Calling sequence of sink:
+$  PetscErrorCode sink(PEP pep,PetscInt i,PetscScalar eigr,Vec v,void *sinkctx)
++  pep     - the eigenproblem solver context
+.  i       - global index of the eigenpair within the interval
+.  eigr    - the eigenvalue
+.  v       - the eigenvector
+-  sinkctx - the context passed at registration time
+
+   Notes:
+   In spectrum slicing runs (see PEPSetInterval()) all eigenpairs of the
+   interval are collected before PEPSolve() returns, which may imply a long
+   wait and a large memory footprint when the interval contains many
+   eigenvalues. With a sink, each eigenpair is passed to the callback right
+   after it has been validated against the inertia counts at the current
+   shift, so the caller can stream values and vectors to disk or process
+   them incrementally. The callback must not keep a reference to the vector,
+   which is overwritten with the next eigenpair.
+
+   Eigenpairs are delivered in the order in which the shifts are processed,
+   which in general is not the final sorted order; use the index argument to
+   place them. The basis columns of delivered eigenpairs are still retained
+   internally, since they take part in the deflation of neighbouring
+   subintervals, and the eigenpairs remain available through the usual
+   interface after PEPSolve().
+
+   Level: advanced
+
+.seealso: PEPSetInterval(), PEPSTOARGetInertias()
+@*/
+PetscErrorCode PEPSTOARSetEigenpairSink(PEP pep,PetscErrorCode (*sink)(PEP pep,PetscInt i,PetscScalar eigr,Vec v,void *sinkctx),void *sinkctx)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscTryMethod(pep,"PEPSTOARSetEigenpairSink_C",(PEP,PetscErrorCode(*)(PEP,PetscInt,PetscScalar,Vec,void*),void*),(pep,sink,sinkctx));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PEPView_STOAR(PEP pep,PetscViewer viewer)
 {
   PEP_STOAR      *ctx = (PEP_STOAR*)pep->data;
@@ -1046,6 +1104,7 @@ static PetscErrorCode PEPDestroy_STOAR(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetLinearization_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetCheckEigenvalueType_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetCheckEigenvalueType_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetEigenpairSink_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1086,5 +1145,6 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_STOAR(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetLinearization_C",PEPSTOARGetLinearization_STOAR));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetCheckEigenvalueType_C",PEPSTOARSetCheckEigenvalueType_STOAR));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetCheckEigenvalueType_C",PEPSTOARGetCheckEigenvalueType_STOAR));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetEigenpairSink_C",PEPSTOARSetEigenpairSink_STOAR));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -45,7 +45,7 @@ typedef struct {
   VecScatter   *scatter_id,*scatterp_id;
   Mat          *A;
   BV           V,W,M2,M3,Wt;
-  PetscScalar  *M4,*w,*wt,*d,*dt;
+  PetscScalar  *M4,*w,*wt,*d,*dt,h;
   Vec          t,tg,Rv,Vi,tp,tpg;
   PetscInt     idx,*cols;
 } PEP_REFINE_EXPLICIT;
@@ -717,14 +717,19 @@ static PetscErrorCode NRefSysIter(PetscInt i,PEP pep,PetscInt k,KSP ksp,PetscSca
     idx = i;
     R   = Rv;
     Vi  = dVi;
+    /* a repeated eigenvalue reuses the operator (and its factorization)
+       assembled for the previous system, only the border is rebuilt */
+    if (matctx && i>0 && h==matctx->h) matctx->compM1 = PETSC_TRUE;
     switch (pep->scheme) {
     case PEP_REFINE_SCHEME_EXPLICIT:
       PetscCall(NRefSysSetup_explicit(pep,k,ksp,fH,S,lds,fh,h,V,matctx,W));
       matctx->compM1 = PETSC_FALSE;
+      matctx->h = h;
       break;
     case PEP_REFINE_SCHEME_MBE:
       PetscCall(NRefSysSetup_mbe(pep,k,ksp,fH,S,lds,fh,h,V,matctx));
       matctx->compM1 = PETSC_FALSE;
+      matctx->h = h;
       break;
     case PEP_REFINE_SCHEME_SCHUR:
       PetscCall(KSPGetOperators(ksp,&M,NULL));
@@ -738,14 +743,17 @@ static PetscErrorCode NRefSysIter(PetscInt i,PEP pep,PetscInt k,KSP ksp,PetscSca
       for (j=0;j<pep->nmat;j++) fh[j] = fH[j*k+idx+idx*lda];
       h = H[idx+idx*ldh];
       matctx->idx = idx;
+      if (i>0 && pep->scheme!=PEP_REFINE_SCHEME_SCHUR && h==matctx->h) matctx->compM1 = PETSC_TRUE;
       switch (pep->scheme) {
       case PEP_REFINE_SCHEME_EXPLICIT:
         PetscCall(NRefSysSetup_explicit(pep,k,ksp,fH,S,lds,fh,h,matctx->V,matctx,matctx->W));
         matctx->compM1 = PETSC_FALSE;
+        matctx->h = h;
         break;
       case PEP_REFINE_SCHEME_MBE:
         PetscCall(NRefSysSetup_mbe(pep,k,ksp,fH,S,lds,fh,h,matctx->V,matctx));
         matctx->compM1 = PETSC_FALSE;
+        matctx->h = h;
         break;
       case PEP_REFINE_SCHEME_SCHUR:
         break;
@@ -1017,7 +1025,8 @@ static PetscErrorCode PEPNRefSetUp(PEP pep,PetscInt k,PetscScalar *H,PetscInt ld
       PetscCall(STGetMatStructure(pep->st,&str));
       PetscCall(MatDuplicate(A[0],MAT_COPY_VALUES,&E[0]));
       j = (matctx->subc)?matctx->subc->color:0;
-      PetscCall(PEPEvaluateBasis(pep,H[j+j*ldh],0,coef,NULL));
+      matctx->h = H[j+j*ldh];
+      PetscCall(PEPEvaluateBasis(pep,matctx->h,0,coef,NULL));
       for (j=1;j<nmat;j++) PetscCall(MatAXPY(E[0],coef[j],A[j],str));
       PetscCall(MatCreateDense(comm,PETSC_DECIDE,PETSC_DECIDE,k,k,NULL,&E[1]));
       PetscCall(MatGetOwnershipRange(E[0],&n0,&m0));
@@ -1107,7 +1116,8 @@ static PetscErrorCode PEPNRefSetUp(PEP pep,PetscInt k,PetscScalar *H,PetscInt ld
       PetscCall(STGetMatStructure(pep->st,&str));
       PetscCall(MatDuplicate(A[0],MAT_COPY_VALUES,&matctx->M1));
       j = (matctx->subc)?matctx->subc->color:0;
-      PetscCall(PEPEvaluateBasis(pep,H[j+j*ldh],0,coef,NULL));
+      matctx->h = H[j+j*ldh];
+      PetscCall(PEPEvaluateBasis(pep,matctx->h,0,coef,NULL));
       for (j=1;j<nmat;j++) PetscCall(MatAXPY(matctx->M1,coef[j],A[j],str));
       PetscCall(BVDuplicateResize(matctx->V,PetscMax(k,pep->nmat),&matctx->W));
       PetscCall(BVDuplicateResize(matctx->V,k,&matctx->M2));
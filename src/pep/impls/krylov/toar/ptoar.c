@@ -103,7 +103,7 @@ static PetscErrorCode PEPTOARExtendBasis(PEP pep,PetscBool sinvert,PetscScalar s
 {
   PetscInt       nmat=pep->nmat,deg=nmat-1,k,j,off=0,lss;
   Vec            v=t_[0],ve=t_[1],q=t_[2];
-  PetscScalar    alpha=1.0,*ss,a;
+  PetscScalar    alpha=1.0,*ss,a,av=1.0,ave=1.0;
   PetscReal      *ca=pep->pbc,*cb=pep->pbc+nmat,*cg=pep->pbc+2*nmat;
   PetscBool      flg;
 
@@ -124,39 +124,38 @@ static PetscErrorCode PEPTOARExtendBasis(PEP pep,PetscBool sinvert,PetscScalar s
   } else {
     ss = S; lss = ls; off = 0; alpha = -ca[deg-1]; a = 1.0;
   }
-  PetscCall(BVMultVec(V,1.0,0.0,v,ss+off*lss));
+  /* the scalar factors a are folded into BVMultVec, so that each term can be
+     accumulated onto q with a single fused multiply-add pass */
+  PetscCall(BVMultVec(V,a,0.0,v,ss+off*lss));
   if (PetscUnlikely(pep->Dr)) { /* balancing */
     PetscCall(VecPointwiseMult(v,v,pep->Dr));
   }
   PetscCall(STMatMult(pep->st,off,v,q));
-  PetscCall(VecScale(q,a));
   for (j=1+off;j<deg+off-1;j++) {
-    PetscCall(BVMultVec(V,1.0,0.0,v,ss+j*lss));
-    if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseMult(v,v,pep->Dr));
-    PetscCall(STMatMult(pep->st,j,v,t));
     a *= pep->sfactor;
-    PetscCall(VecAXPY(q,a,t));
+    PetscCall(BVMultVec(V,a,0.0,v,ss+j*lss));
+    if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseMult(v,v,pep->Dr));
+    PetscCall(STMatMultAdd(pep->st,j,v,q,q));
   }
   if (sinvert) {
-    PetscCall(BVMultVec(V,1.0,0.0,v,ss));
-    if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseMult(v,v,pep->Dr));
-    PetscCall(STMatMult(pep->st,deg,v,t));
     a *= pep->sfactor;
-    PetscCall(VecAXPY(q,a,t));
+    PetscCall(BVMultVec(V,a,0.0,v,ss));
+    if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseMult(v,v,pep->Dr));
+    PetscCall(STMatMultAdd(pep->st,deg,v,q,q));
   } else {
-    PetscCall(BVMultVec(V,1.0,0.0,ve,ss+(deg-1)*lss));
+    av = a;  /* v remains scaled by this factor */
+    a *= pep->sfactor; ave = a;
+    PetscCall(BVMultVec(V,a,0.0,ve,ss+(deg-1)*lss));
     if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseMult(ve,ve,pep->Dr));
-    a *= pep->sfactor;
-    PetscCall(STMatMult(pep->st,deg-1,ve,t));
-    PetscCall(VecAXPY(q,a,t));
+    PetscCall(STMatMultAdd(pep->st,deg-1,ve,q,q));
     a *= pep->sfactor;
   }
   if (flg || !sinvert) alpha /= a;
   PetscCall(STMatSolve(pep->st,q,t));
   PetscCall(VecScale(t,alpha));
   if (!sinvert) {
-    PetscCall(VecAXPY(t,cg[deg-1],v));
-    PetscCall(VecAXPY(t,cb[deg-1],ve));
+    PetscCall(VecAXPY(t,cg[deg-1]/av,v));
+    PetscCall(VecAXPY(t,cb[deg-1]/ave,ve));
   }
   if (PetscUnlikely(pep->Dr)) PetscCall(VecPointwiseDivide(t,t,pep->Dr));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -47,8 +47,7 @@ static PetscErrorCode MatMult_Linear_Shift(Mat M,Vec x,Vec y)
   PetscCall(VecPlaceArray(x2,px));
   PetscCall(VecPlaceArray(x3,px+m));
   PetscCall(VecPlaceArray(y1,py));
-  PetscCall(VecAXPY(y1,cb[0]-sigma,x2));
-  PetscCall(VecAXPY(y1,ca[0],x3));
+  PetscCall(VecAXPBYPCZ(y1,cb[0]-sigma,ca[0],0.0,x2,x3));
   PetscCall(VecResetArray(x2));
   PetscCall(VecResetArray(x3));
   PetscCall(VecResetArray(y1));
@@ -59,8 +58,7 @@ static PetscErrorCode MatMult_Linear_Shift(Mat M,Vec x,Vec y)
     PetscCall(VecPlaceArray(x2,px+i*m));
     PetscCall(VecPlaceArray(x3,px+(i+1)*m));
     PetscCall(VecPlaceArray(y1,py+i*m));
-    PetscCall(VecAXPY(y1,cg[i],x1));
-    PetscCall(VecAXPY(y1,cb[i]-sigma,x2));
+    PetscCall(VecAXPBYPCZ(y1,cg[i],cb[i]-sigma,0.0,x1,x2));
     PetscCall(VecAXPY(y1,ca[i],x3));
     PetscCall(VecResetArray(x1));
     PetscCall(VecResetArray(x2));
@@ -79,11 +77,9 @@ static PetscErrorCode MatMult_Linear_Shift(Mat M,Vec x,Vec y)
   }
   PetscCall(VecCopy(y1,aux));
   PetscCall(STMatSolve(pep->st,aux,y1));
-  PetscCall(VecScale(y1,-ca[deg-1]/a));
   PetscCall(VecPlaceArray(x1,px+(deg-2)*m));
   PetscCall(VecPlaceArray(x2,px+(deg-1)*m));
-  PetscCall(VecAXPY(y1,cg[deg-1],x1));
-  PetscCall(VecAXPY(y1,cb[deg-1]-sigma,x2));
+  PetscCall(VecAXPBYPCZ(y1,cg[deg-1],cb[deg-1]-sigma,-ca[deg-1]/a,x1,x2));
   PetscCall(VecResetArray(x1));
   PetscCall(VecResetArray(x2));
   PetscCall(VecResetArray(y1));
@@ -122,8 +118,7 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
   /* first block */
   PetscCall(VecPlaceArray(x1,px));
   PetscCall(VecPlaceArray(y1,py+m));
-  PetscCall(VecCopy(x1,y1));
-  PetscCall(VecScale(y1,1.0/ca[0]));
+  PetscCall(VecAXPBY(y1,1.0/ca[0],0.0,x1));
   PetscCall(VecResetArray(x1));
   PetscCall(VecResetArray(y1));
 
@@ -132,9 +127,7 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
     PetscCall(VecPlaceArray(x1,px+m));
     PetscCall(VecPlaceArray(y1,py+m));
     PetscCall(VecPlaceArray(y2,py+2*m));
-    PetscCall(VecCopy(x1,y2));
-    PetscCall(VecAXPY(y2,sigma-cb[1],y1));
-    PetscCall(VecScale(y2,1.0/ca[1]));
+    PetscCall(VecAXPBYPCZ(y2,1.0/ca[1],(sigma-cb[1])/ca[1],0.0,x1,y1));
     PetscCall(VecResetArray(x1));
     PetscCall(VecResetArray(y1));
     PetscCall(VecResetArray(y2));
@@ -146,10 +139,8 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
     PetscCall(VecPlaceArray(y1,py+(i-1)*m));
     PetscCall(VecPlaceArray(y2,py+i*m));
     PetscCall(VecPlaceArray(y3,py+(i+1)*m));
-    PetscCall(VecCopy(x1,y3));
-    PetscCall(VecAXPY(y3,sigma-cb[i],y2));
-    PetscCall(VecAXPY(y3,-cg[i],y1));
-    PetscCall(VecScale(y3,1.0/ca[i]));
+    PetscCall(VecAXPBYPCZ(y3,1.0/ca[i],(sigma-cb[i])/ca[i],0.0,x1,y2));
+    PetscCall(VecAXPY(y3,-cg[i]/ca[i],y1));
     PetscCall(VecResetArray(x1));
     PetscCall(VecResetArray(y1));
     PetscCall(VecResetArray(y2));
@@ -241,10 +232,10 @@ static PetscErrorCode PEPSetUp_Linear(PEP pep)
 {
   PEP_LINEAR     *ctx = (PEP_LINEAR*)pep->data;
   ST             st;
-  PetscInt       i=0,deg=pep->nmat-1;
+  PetscInt       i=0,mloc,deg=pep->nmat-1;
   EPSWhich       which = EPS_LARGEST_MAGNITUDE;
   EPSProblemType ptype;
-  PetscBool      trackall,istrivial,transf,sinv,ks;
+  PetscBool      trackall,istrivial,transf,sinv,ks,reuse=PETSC_FALSE;
   PetscScalar    sigma,*epsarray,*peparray;
   Vec            veps,w=NULL;
   /* function tables */
@@ -312,10 +303,23 @@ static PetscErrorCode PEPSetUp_Linear(PEP pep)
     PetscCall(STShellSetContext(st,ctx));
     if (!transf) PetscCall(STShellSetBackTransform(st,BackTransform_Linear));
     else PetscCall(STShellSetBackTransform(st,BackTransform_Skip));
-    PetscCall(MatCreateVecsEmpty(pep->A[0],&ctx->w[0],&ctx->w[1]));
-    PetscCall(MatCreateVecsEmpty(pep->A[0],&ctx->w[2],&ctx->w[3]));
-    PetscCall(MatCreateVecs(pep->A[0],&ctx->w[4],&ctx->w[5]));
-    PetscCall(MatCreateShell(PetscObjectComm((PetscObject)pep),deg*pep->nloc,deg*pep->nloc,deg*pep->n,deg*pep->n,ctx,&ctx->A));
+    if (ctx->A) {
+      /* reuse the shell linearization from the previous setup if the dimensions
+         have not changed, so that the inner solver can keep its matrices */
+      PetscCall(PetscObjectTypeCompare((PetscObject)ctx->A,MATSHELL,&reuse));
+      if (reuse) {
+        PetscCall(MatGetLocalSize(ctx->A,&mloc,NULL));
+        if (mloc!=deg*pep->nloc) reuse = PETSC_FALSE;
+      }
+    }
+    if (!reuse) {
+      PetscCall(MatDestroy(&ctx->A));
+      for (i=0;i<6;i++) PetscCall(VecDestroy(&ctx->w[i]));
+      PetscCall(MatCreateVecsEmpty(pep->A[0],&ctx->w[0],&ctx->w[1]));
+      PetscCall(MatCreateVecsEmpty(pep->A[0],&ctx->w[2],&ctx->w[3]));
+      PetscCall(MatCreateVecs(pep->A[0],&ctx->w[4],&ctx->w[5]));
+      PetscCall(MatCreateShell(PetscObjectComm((PetscObject)pep),deg*pep->nloc,deg*pep->nloc,deg*pep->n,deg*pep->n,ctx,&ctx->A));
+    }
     if (sinv && !transf) PetscCall(MatShellSetOperation(ctx->A,MATOP_MULT,(void(*)(void))MatMult_Linear_Sinvert));
     else PetscCall(MatShellSetOperation(ctx->A,MATOP_MULT,(void(*)(void))MatMult_Linear_Shift));
     PetscCall(STShellSetApply(st,Apply_Linear));
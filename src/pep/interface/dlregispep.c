@@ -13,7 +13,7 @@
 static PetscBool PEPPackageInitialized = PETSC_FALSE;
 
 const char *PEPBasisTypes[] = {"MONOMIAL","CHEBYSHEV1","CHEBYSHEV2","LEGENDRE","LAGUERRE","HERMITE","PEPBasis","PEP_BASIS_",NULL};
-const char *PEPScaleTypes[] = {"NONE","SCALAR","DIAGONAL","BOTH","PEPScale","PEP_SCALE_",NULL};
+const char *PEPScaleTypes[] = {"NONE","SCALAR","DIAGONAL","BOTH","AUTO","PEPScale","PEP_SCALE_",NULL};
 const char *PEPRefineTypes[] = {"NONE","SIMPLE","MULTIPLE","PEPRefine","PEP_REFINE_",NULL};
 const char *PEPRefineSchemes[] = {"","SCHUR","MBE","EXPLICIT","PEPRefineScheme","PEP_REFINE_SCHEME_",NULL};
 const char *PEPExtractTypes[] = {"","NONE","NORM","RESIDUAL","STRUCTURED","PEPExtract","PEP_EXTRACT_",NULL};
@@ -66,8 +66,7 @@ PetscErrorCode PEPInitializePackage(void)
   PetscCall(PetscClassIdRegister("PEP Solver",&PEP_CLASSID));
   /* Register Constructors */
   PetscCall(PEPRegisterAll());
-  /* Register Monitors */
-  PetscCall(PEPMonitorRegisterAll());
+  /* Monitors are registered on demand, see PEPMonitorSetFromOptions() */
   /* Register Events */
   PetscCall(PetscLogEventRegister("PEPSetUp",PEP_CLASSID,&PEP_SetUp));
   PetscCall(PetscLogEventRegister("PEPSolve",PEP_CLASSID,&PEP_Solve));
@@ -326,6 +326,87 @@ PetscErrorCode PEPBuildDiagonalScaling(PEP pep)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   PEPScaleNorm - matrix norm used for scaling decisions: the infinity norm
+   when the matrix provides it, otherwise a randomized estimate that only
+   requires one matrix-vector product with a sample vector of normally
+   distributed entries.
+*/
+static PetscErrorCode PEPScaleNorm(Mat A,Vec vrn,Vec w,PetscReal *nrm)
+{
+  PetscBool      has;
+
+  PetscFunctionBegin;
+  PetscCall(MatHasOperation(A,MATOP_NORM,&has));
+  if (has) PetscCall(MatNorm(A,NORM_INFINITY,nrm));
+  else PetscCall(MatNormEstimate(A,vrn,w,nrm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   PEPSelectScaling - resolve PEP_SCALE_AUTO into a concrete strategy, based on
+   estimated norms of the coefficient matrices. The scale factor is the one of
+   [Betcke 2008], which for quadratic problems reduces to the optimal scaling
+   of Fan, Lin and Van Dooren; the growth of the intermediate coefficients
+   after scaling, relative to the extreme ones, measures whether the scaled
+   problem is balanced, and diagonal balancing is added when it is not.
+*/
+static PetscErrorCode PEPSelectScaling(PEP pep)
+{
+  PetscBool      aij,flg;
+  PetscInt       k,nmat=pep->nmat;
+  PetscReal      *nrm,rho,t,s;
+  Mat            T;
+  Vec            vrn,w;
+  PEPBasis       basis;
+
+  PetscFunctionBegin;
+  pep->scale = PEP_SCALE_SCALAR;
+  if (!pep->sfactor_set) {
+    pep->sfactor  = 1.0;
+    pep->dsfactor = 1.0;
+  }
+  PetscCall(PEPGetBasis(pep,&basis));
+  if (basis!=PEP_BASIS_MONOMIAL || nmat<3) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(STGetTransform(pep->st,&flg));
+  PetscCall(PetscMalloc1(nmat,&nrm));
+  PetscCall(MatCreateVecs(pep->A[0],&vrn,&w));
+  PetscCall(VecSetRandomNormal(vrn,NULL,NULL,NULL));
+  PetscCall(VecNormalize(vrn,NULL));
+  for (k=0;k<nmat;k++) {
+    if (flg) PetscCall(STGetMatrixTransformed(pep->st,k,&T));
+    else T = pep->A[k];
+    PetscCall(PEPScaleNorm(T,vrn,w,&nrm[k]));
+  }
+  if (nrm[0]>0.0 && nrm[nmat-1]>0.0) {
+    if (pep->sfactor_set) s = pep->sfactor;
+    else {
+      s = PetscPowReal(nrm[0]/nrm[nmat-1],1.0/(nmat-1));
+      pep->sfactor  = s;
+      pep->dsfactor = nrm[nmat-1];
+      for (k=nmat-2;k>0;k--) pep->dsfactor = pep->dsfactor*s+nrm[k];
+      pep->dsfactor = pep->dsfactor*s+nrm[0];
+      pep->dsfactor = nmat/pep->dsfactor;
+    }
+    rho = 0.0; t = 1.0;
+    for (k=1;k<nmat-1;k++) {
+      t *= s;
+      rho = PetscMax(rho,nrm[k]*t);
+    }
+    rho /= PetscSqrtReal(nrm[0]*nrm[nmat-1]*PetscPowReal(s,nmat-1));
+    if (rho>1.0) {
+      /* heavily damped problem, scalar scaling alone cannot balance it */
+      PetscCall(PetscObjectBaseTypeCompareAny((PetscObject)pep->A[0],&aij,MATMPIAIJ,MATSEQAIJ,""));
+      if (aij) pep->scale = PEP_SCALE_BOTH;
+    }
+    PetscCall(PetscInfo(pep,"Automatic scaling: sensitivity %g, selected strategy %s\n",(double)rho,PEPScaleTypes[pep->scale]));
+  }
+  PetscCall(VecDestroy(&vrn));
+  PetscCall(VecDestroy(&w));
+  PetscCall(PetscFree(nrm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    PEPComputeScaleFactor - compute sfactor as described in [Betcke 2008].
 */
@@ -338,6 +419,10 @@ PetscErrorCode PEPComputeScaleFactor(PEP pep)
   PetscInt       i;
 
   PetscFunctionBegin;
+  if (pep->scale==PEP_SCALE_AUTO) {  /* choose the strategy and its parameters */
+    PetscCall(PEPSelectScaling(pep));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   if (pep->scale==PEP_SCALE_NONE || pep->scale==PEP_SCALE_DIAGONAL) {  /* no scalar scaling */
     pep->sfactor = 1.0;
     pep->dsfactor = 1.0;
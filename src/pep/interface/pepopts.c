@@ -48,6 +48,9 @@ PetscErrorCode PEPMonitorSetFromOptions(PEP pep,const char opt[],const char name
   PetscCall(PetscOptionsGetViewer(PetscObjectComm((PetscObject)pep),((PetscObject)pep)->options,((PetscObject)pep)->prefix,opt,&viewer,&format,&flg));
   if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
 
+  /* Register built-in monitors the first time one is requested */
+  PetscCall(PEPMonitorRegisterAll());
+
   PetscCall(PetscViewerGetType(viewer,&vtype));
   PetscCall(SlepcMonitorMakeKey_Internal(name,vtype,format,key));
   PetscCall(PetscFunctionListFind(PEPMonitorList,key,&mfunc));
@@ -994,7 +997,7 @@ PetscErrorCode PEPGetStoppingTest(PEP pep,PEPStop *stop)
 -  lambda - approximation to wanted eigenvalues (modulus)
 
    Options Database Keys:
-+  -pep_scale <type> - scaling type, one of <none,scalar,diagonal,both>
++  -pep_scale <type> - scaling type, one of <none,scalar,diagonal,both,auto>
 .  -pep_scale_factor <alpha> - the scaling factor
 .  -pep_scale_its <its> - number of iterations
 -  -pep_scale_lambda <lambda> - approximation to eigenvalues
@@ -1018,6 +1021,12 @@ PetscErrorCode PEPGetStoppingTest(PEP pep,PEPStop *stop)
    Parameter 'lambda' must be positive. Use PETSC_DEFAULT or set lambda = 1.0 if
    no information about eigenvalues is available.
 
+   With PEP_SCALE_AUTO the strategy is chosen at PEPSetUp() time: the norms of
+   the coefficient matrices are estimated cheaply (with a randomized sample if
+   the matrix does not provide its norm) and diagonal balancing is added to the
+   scalar scaling only when the latter cannot balance the coefficients by
+   itself. After PEPSetUp(), PEPGetScale() returns the strategy selected.
+
    Level: intermediate
 
 .seealso: PEPGetScale()
@@ -1028,7 +1037,7 @@ PetscErrorCode PEPSetScale(PEP pep,PEPScale scale,PetscReal alpha,Vec Dl,Vec Dr,
   PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
   PetscValidLogicalCollectiveEnum(pep,scale,2);
   pep->scale = scale;
-  if (scale==PEP_SCALE_SCALAR || scale==PEP_SCALE_BOTH) {
+  if (scale==PEP_SCALE_SCALAR || scale==PEP_SCALE_BOTH || scale==PEP_SCALE_AUTO) {
     PetscValidLogicalCollectiveReal(pep,alpha,3);
     if (alpha == (PetscReal)PETSC_DEFAULT || alpha == (PetscReal)PETSC_DECIDE) {
       pep->sfactor = 0.0;
@@ -1039,7 +1048,7 @@ PetscErrorCode PEPSetScale(PEP pep,PEPScale scale,PetscReal alpha,Vec Dl,Vec Dr,
       pep->sfactor_set = PETSC_TRUE;
     }
   }
-  if (scale==PEP_SCALE_DIAGONAL || scale==PEP_SCALE_BOTH) {
+  if (scale==PEP_SCALE_DIAGONAL || scale==PEP_SCALE_BOTH || scale==PEP_SCALE_AUTO) {
     if (Dl) {
       PetscValidHeaderSpecific(Dl,VEC_CLASSID,4);
       PetscCheckSameComm(pep,1,Dl,4);
@@ -162,6 +162,16 @@ PetscErrorCode PEPSetUp(PEP pep)
     pep->extract = (pep->basis==PEP_BASIS_MONOMIAL)? PEP_EXTRACT_NORM: PEP_EXTRACT_NONE;
   }
 
+  /* precompute the normalization factors of the norm-based convergence test,
+     so that the test reduces to a polynomial evaluation during the solve */
+  if (pep->conv==PEP_CONV_NORM && !pep->nrma[pep->nmat-1]) {
+    for (k=0;k<pep->nmat;k++) {
+      PetscCall(MatHasOperation(pep->A[k],MATOP_NORM,&flg));
+      PetscCheck(flg,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"The convergence test related to the matrix norms requires a matrix norm operation");
+      PetscCall(MatNorm(pep->A[k],NORM_INFINITY,&pep->nrma[k]));
+    }
+  }
+
   /* fill sorting criterion context */
   switch (pep->which) {
     case PEP_LARGEST_MAGNITUDE:
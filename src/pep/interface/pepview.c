@@ -85,6 +85,9 @@ PetscErrorCode PEPView(PEP pep,PetscViewer viewer)
       case PEP_SCALE_BOTH:
         PetscCall(PetscViewerASCIIPrintf(viewer,"  parameter scaling & diagonal balancing enabled, with scaling factor=%g, its=%" PetscInt_FMT " and lambda=%g\n",(double)pep->sfactor,pep->sits,(double)pep->slambda));
         break;
+      case PEP_SCALE_AUTO:
+        PetscCall(PetscViewerASCIIPrintf(viewer,"  automatic selection of the scaling strategy enabled\n"));
+        break;
     }
     PetscCall(PetscViewerASCIIPrintf(viewer,"  selected portion of the spectrum: "));
     PetscCall(PetscViewerASCIIUseTabs(viewer,PETSC_FALSE));
@@ -17,6 +17,7 @@
 
 typedef struct {
   PetscBool explicitmatrix;
+  PetscBool symmetric;      /* store only the upper triangle of the explicit matrix */
   EPS       eps;
   PetscBool usereps;
   Mat       C,D;
@@ -102,9 +103,24 @@ static PetscErrorCode SVDCrossGetProductMat(SVD svd,Mat A,Mat AT,Mat *C)
   SVD_CROSS_SHELL *ctx;
   PetscInt        n;
   VecType         vtype;
+  PetscBool       isshell;
   Mat             B;
 
   PetscFunctionBegin;
+  if (*C && !cross->explicitmatrix) {
+    /* reuse the shell matrix from the previous setup if the operators have not
+       changed, so that the inner solver can keep its matrices and workspace;
+       only the cached diagonal is discarded since the values may be different */
+    PetscCall(PetscObjectTypeCompare((PetscObject)*C,MATSHELL,&isshell));
+    if (isshell) {
+      PetscCall(MatShellGetContext(*C,&ctx));
+      if (ctx->A==A && ctx->AT==AT && ctx->omega==svd->omega && ctx->swapped==svd->swapped) {
+        PetscCall(VecDestroy(&ctx->diag));
+        PetscFunctionReturn(PETSC_SUCCESS);
+      }
+    }
+  }
+  PetscCall(MatDestroy(C));
   if (cross->explicitmatrix) {
     if (!svd->ishyperbolic || svd->swapped) B = (!svd->expltrans && svd->swapped)? AT: A;
     else {  /* duplicate A and scale by signature */
@@ -131,6 +147,15 @@ static PetscErrorCode SVDCrossGetProductMat(SVD svd,Mat A,Mat AT,Mat *C)
     PetscCall(MatProductSymbolic(*C));
     PetscCall(MatProductNumeric(*C));
     if (svd->ishyperbolic && !svd->swapped) PetscCall(MatDestroy(&B));
+    PetscCall(MatSetOption(*C,PetscDefined(USE_COMPLEX)?MAT_HERMITIAN:MAT_SYMMETRIC,PETSC_TRUE));
+    if (cross->symmetric) {
+#if defined(PETSC_USE_COMPLEX)
+      SETERRQ(PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Symmetric storage not available with complex scalars");
+#else
+      /* keep only the upper triangle, halving the memory of the product */
+      PetscCall(MatConvert(*C,MATSBAIJ,MAT_INPLACE_MATRIX,C));
+#endif
+    }
   } else {
     PetscCall(PetscNew(&ctx));
     ctx->A       = A;
@@ -172,8 +197,7 @@ static PetscErrorCode SVDSetUp_Cross(SVD svd)
 
   PetscFunctionBegin;
   if (!cross->eps) PetscCall(SVDCrossGetEPS(svd,&cross->eps));
-  PetscCall(MatDestroy(&cross->C));
-  PetscCall(MatDestroy(&cross->D));
+  if (!svd->isgeneralized) PetscCall(MatDestroy(&cross->D));
   PetscCall(SVDCrossGetProductMat(svd,svd->A,svd->AT,&cross->C));
   if (svd->isgeneralized) {
     PetscCall(SVDCrossGetProductMat(svd,svd->B,svd->BT,&cross->D));
@@ -385,6 +409,9 @@ static PetscErrorCode SVDSetFromOptions_Cross(SVD svd,PetscOptionItems *PetscOpt
     PetscCall(PetscOptionsBool("-svd_cross_explicitmatrix","Use cross explicit matrix","SVDCrossSetExplicitMatrix",cross->explicitmatrix,&val,&set));
     if (set) PetscCall(SVDCrossSetExplicitMatrix(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_cross_symmetric","Use symmetric storage for the explicit matrix","SVDCrossSetSymmetric",cross->symmetric,&val,&set));
+    if (set) PetscCall(SVDCrossSetSymmetric(svd,val));
+
   PetscOptionsHeadEnd();
 
   if (!cross->eps) PetscCall(SVDCrossGetEPS(svd,&cross->eps));
@@ -468,6 +495,84 @@ PetscErrorCode SVDCrossGetExplicitMatrix(SVD svd,PetscBool *explicitmat)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDCrossSetSymmetric_Cross(SVD svd,PetscBool symmetric)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  if (cross->symmetric != symmetric) {
+    cross->symmetric = symmetric;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossSetSymmetric - Indicate if the explicitly computed matrix A^T*A
+   must be stored in symmetric (half) format.
+
+   Logically Collective
+
+   Input Parameters:
++  svd       - singular value solver
+-  symmetric - boolean flag indicating if symmetric storage is used
+
+   Options Database Key:
+.  -svd_cross_symmetric <boolean> - Indicates the boolean flag
+
+   Notes:
+   The cross product matrix is symmetric by construction, so only the upper
+   triangle needs to be stored, halving the memory required by the explicit
+   matrix. This option has an effect only if the matrix is built explicitly,
+   see SVDCrossSetExplicitMatrix(), and is not available with complex scalars.
+
+   Level: advanced
+
+.seealso: SVDCrossGetSymmetric(), SVDCrossSetExplicitMatrix()
+@*/
+PetscErrorCode SVDCrossSetSymmetric(SVD svd,PetscBool symmetric)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,symmetric,2);
+  PetscTryMethod(svd,"SVDCrossSetSymmetric_C",(SVD,PetscBool),(svd,symmetric));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDCrossGetSymmetric_Cross(SVD svd,PetscBool *symmetric)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  *symmetric = cross->symmetric;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossGetSymmetric - Returns the flag indicating if the explicit matrix
+   is stored in symmetric format.
+
+   Not Collective
+
+   Input Parameter:
+.  svd  - singular value solver
+
+   Output Parameter:
+.  symmetric - the mode flag
+
+   Level: advanced
+
+.seealso: SVDCrossSetSymmetric()
+@*/
+PetscErrorCode SVDCrossGetSymmetric(SVD svd,PetscBool *symmetric)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(symmetric,2);
+  PetscUseMethod(svd,"SVDCrossGetSymmetric_C",(SVD,PetscBool*),(svd,symmetric));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDCrossSetEPS_Cross(SVD svd,EPS eps)
 {
   SVD_CROSS      *cross = (SVD_CROSS*)svd->data;
@@ -558,6 +663,7 @@ static PetscErrorCode SVDView_Cross(SVD svd,PetscViewer viewer)
   if (isascii) {
     if (!cross->eps) PetscCall(SVDCrossGetEPS(svd,&cross->eps));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix\n",cross->explicitmatrix?"explicit":"implicit"));
+    if (cross->explicitmatrix && cross->symmetric) PetscCall(PetscViewerASCIIPrintf(viewer,"  using symmetric storage for the explicit matrix\n"));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(EPSView(cross->eps,viewer));
     PetscCall(PetscViewerASCIIPopTab(viewer));
@@ -587,6 +693,8 @@ static PetscErrorCode SVDDestroy_Cross(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetEPS_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetExplicitMatrix_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetExplicitMatrix_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetSymmetric_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetSymmetric_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -611,5 +719,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_Cross(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetEPS_C",SVDCrossGetEPS_Cross));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetExplicitMatrix_C",SVDCrossSetExplicitMatrix_Cross));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetExplicitMatrix_C",SVDCrossGetExplicitMatrix_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetSymmetric_C",SVDCrossSetSymmetric_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetSymmetric_C",SVDCrossGetSymmetric_Cross));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
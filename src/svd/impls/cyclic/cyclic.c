@@ -22,17 +22,15 @@ static PetscErrorCode MatMult_Cyclic(Mat B,Vec x,Vec y)
   SVD_CYCLIC_SHELL  *ctx;
   const PetscScalar *px;
   PetscScalar       *py;
-  PetscInt          m;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(B,&ctx));
-  PetscCall(MatGetLocalSize(ctx->A,&m,NULL));
   PetscCall(VecGetArrayRead(x,&px));
   PetscCall(VecGetArrayWrite(y,&py));
   PetscCall(VecPlaceArray(ctx->x1,px));
-  PetscCall(VecPlaceArray(ctx->x2,px+m));
+  PetscCall(VecPlaceArray(ctx->x2,px+ctx->m));
   PetscCall(VecPlaceArray(ctx->y1,py));
-  PetscCall(VecPlaceArray(ctx->y2,py+m));
+  PetscCall(VecPlaceArray(ctx->y2,py+ctx->m));
   PetscCall(MatMult(ctx->A,ctx->x2,ctx->y1));
   PetscCall(MatMult(ctx->AT,ctx->x1,ctx->y2));
   PetscCall(VecResetArray(ctx->x1));
@@ -79,6 +77,7 @@ static PetscErrorCode SVDCyclicGetCyclicMat(SVD svd,Mat A,Mat AT,Mat *C)
   SVD_CYCLIC_SHELL *ctx;
   PetscInt         i,M,N,m,n,Istart,Iend;
   VecType          vtype;
+  PetscBool        isshell;
   Mat              Zm,Zn;
 #if defined(PETSC_HAVE_CUDA)
   PetscBool        cuda;
@@ -90,6 +89,16 @@ static PetscErrorCode SVDCyclicGetCyclicMat(SVD svd,Mat A,Mat AT,Mat *C)
   PetscCall(MatGetSize(A,&M,&N));
   PetscCall(MatGetLocalSize(A,&m,&n));
 
+  if (*C && !cyclic->explicitmatrix) {
+    /* reuse the shell matrix from the previous setup if the operators have not
+       changed, so that the inner solver can keep its matrices and workspace */
+    PetscCall(PetscObjectTypeCompare((PetscObject)*C,MATSHELL,&isshell));
+    if (isshell) {
+      PetscCall(MatShellGetContext(*C,&ctx));
+      if (ctx->A==A && ctx->AT==AT && ctx->swapped==svd->swapped) PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
+  PetscCall(MatDestroy(C));
   if (cyclic->explicitmatrix) {
     PetscCheck(svd->expltrans,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Cannot use explicit cyclic matrix with implicit transpose");
     PetscCall(MatCreate(PetscObjectComm((PetscObject)svd),&Zm));
@@ -115,6 +124,7 @@ static PetscErrorCode SVDCyclicGetCyclicMat(SVD svd,Mat A,Mat AT,Mat *C)
     PetscCall(PetscNew(&ctx));
     ctx->A       = A;
     ctx->AT      = AT;
+    ctx->m       = m;
     ctx->swapped = svd->swapped;
     PetscCall(MatCreateVecsEmpty(A,&ctx->x2,&ctx->x1));
     PetscCall(MatCreateVecsEmpty(A,&ctx->y2,&ctx->y1));
@@ -153,19 +163,15 @@ static PetscErrorCode MatMult_ECross(Mat B,Vec x,Vec y)
   SVD_CYCLIC_SHELL  *ctx;
   const PetscScalar *px;
   PetscScalar       *py;
-  PetscInt          mn,m,n;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(B,&ctx));
-  PetscCall(MatGetLocalSize(ctx->A,NULL,&n));
-  PetscCall(VecGetLocalSize(y,&mn));
-  m = mn-n;
   PetscCall(VecGetArrayRead(x,&px));
   PetscCall(VecGetArrayWrite(y,&py));
   PetscCall(VecPlaceArray(ctx->x1,px));
-  PetscCall(VecPlaceArray(ctx->x2,px+m));
+  PetscCall(VecPlaceArray(ctx->x2,px+ctx->m));
   PetscCall(VecPlaceArray(ctx->y1,py));
-  PetscCall(VecPlaceArray(ctx->y2,py+m));
+  PetscCall(VecPlaceArray(ctx->y2,py+ctx->m));
   PetscCall(VecCopy(ctx->x1,ctx->y1));
   PetscCall(MatMult(ctx->A,ctx->x2,ctx->w));
   PetscCall(MatMult(ctx->AT,ctx->w,ctx->y2));
@@ -183,21 +189,18 @@ static PetscErrorCode MatGetDiagonal_ECross(Mat B,Vec d)
   SVD_CYCLIC_SHELL  *ctx;
   PetscScalar       *pd;
   PetscMPIInt       len;
-  PetscInt          mn,m,n,N,i,j,start,end,ncols;
+  PetscInt          N,i,j,start,end,ncols;
   PetscScalar       *work1,*work2,*diag;
   const PetscInt    *cols;
   const PetscScalar *vals;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(B,&ctx));
-  PetscCall(MatGetLocalSize(ctx->A,NULL,&n));
-  PetscCall(VecGetLocalSize(d,&mn));
-  m = mn-n;
   PetscCall(VecGetArrayWrite(d,&pd));
   PetscCall(VecPlaceArray(ctx->y1,pd));
   PetscCall(VecSet(ctx->y1,1.0));
   PetscCall(VecResetArray(ctx->y1));
-  PetscCall(VecPlaceArray(ctx->y2,pd+m));
+  PetscCall(VecPlaceArray(ctx->y2,pd+ctx->m));
   if (!ctx->diag) {
     /* compute diagonal from rows and store in ctx->diag */
     PetscCall(VecDuplicate(ctx->y2,&ctx->diag));
@@ -263,6 +266,7 @@ static PetscErrorCode SVDCyclicGetECrossMat(SVD svd,Mat A,Mat AT,Mat *C,Vec t)
   SVD_CYCLIC_SHELL *ctx;
   PetscInt         i,M,N,m,n,Istart,Iend;
   VecType          vtype;
+  PetscBool        isshell;
   Mat              Id,Zm,Zn,ATA;
 #if defined(PETSC_HAVE_CUDA)
   PetscBool        cuda;
@@ -276,6 +280,19 @@ static PetscErrorCode SVDCyclicGetECrossMat(SVD svd,Mat A,Mat AT,Mat *C,Vec t)
   PetscCall(VecGetSize(t,&M));
   PetscCall(VecGetLocalSize(t,&m));
 
+  if (*C && !cyclic->explicitmatrix) {
+    /* reuse the shell matrix from the previous setup if the operators have not
+       changed, discarding only the cached diagonal */
+    PetscCall(PetscObjectTypeCompare((PetscObject)*C,MATSHELL,&isshell));
+    if (isshell) {
+      PetscCall(MatShellGetContext(*C,&ctx));
+      if (ctx->A==A && ctx->AT==AT && ctx->swapped==svd->swapped) {
+        PetscCall(VecDestroy(&ctx->diag));
+        PetscFunctionReturn(PETSC_SUCCESS);
+      }
+    }
+  }
+  PetscCall(MatDestroy(C));
   if (cyclic->explicitmatrix) {
     PetscCheck(svd->expltrans,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Cannot use explicit cyclic matrix with implicit transpose");
     PetscCall(MatCreateConstantDiagonal(PetscObjectComm((PetscObject)svd),m,m,M,M,1.0,&Id));
@@ -313,6 +330,7 @@ static PetscErrorCode SVDCyclicGetECrossMat(SVD svd,Mat A,Mat AT,Mat *C,Vec t)
     PetscCall(PetscNew(&ctx));
     ctx->A       = A;
     ctx->AT      = AT;
+    ctx->m       = m;
     ctx->swapped = svd->swapped;
     PetscCall(VecDuplicateEmpty(t,&ctx->x1));
     PetscCall(VecDuplicateEmpty(t,&ctx->y1));
@@ -377,8 +395,7 @@ static PetscErrorCode SVDSetUp_Cyclic(SVD svd)
   PetscCall(MatGetSize(svd->A,&M,&N));
   PetscCall(MatGetLocalSize(svd->A,&m,&n));
   if (!cyclic->eps) PetscCall(SVDCyclicGetEPS(svd,&cyclic->eps));
-  PetscCall(MatDestroy(&cyclic->C));
-  PetscCall(MatDestroy(&cyclic->D));
+  if (!svd->isgeneralized) PetscCall(MatDestroy(&cyclic->D));
   if (svd->isgeneralized) {
     if (svd->which==SVD_SMALLEST) {  /* alternative pencil */
       PetscCall(MatCreateVecs(svd->B,NULL,&t));
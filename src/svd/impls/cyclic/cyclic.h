@@ -19,6 +19,7 @@ typedef struct {
 
 typedef struct {
   Mat       A,AT;
+  PetscInt  m;              /* size of the top block, i.e., offset of the bottom one */
   Vec       x1,x2,y1,y2;
   Vec       diag,w;         /* used only in extended cross matrix */
   PetscBool swapped;
@@ -18,17 +18,15 @@ PetscErrorCode MatMult_Cyclic_CUDA(Mat B,Vec x,Vec y)
   SVD_CYCLIC_SHELL  *ctx;
   const PetscScalar *d_px;
   PetscScalar       *d_py;
-  PetscInt          m;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(B,&ctx));
-  PetscCall(MatGetLocalSize(ctx->A,&m,NULL));
   PetscCall(VecCUDAGetArrayRead(x,&d_px));
   PetscCall(VecCUDAGetArrayWrite(y,&d_py));
   PetscCall(VecCUDAPlaceArray(ctx->x1,d_px));
-  PetscCall(VecCUDAPlaceArray(ctx->x2,d_px+m));
+  PetscCall(VecCUDAPlaceArray(ctx->x2,d_px+ctx->m));
   PetscCall(VecCUDAPlaceArray(ctx->y1,d_py));
-  PetscCall(VecCUDAPlaceArray(ctx->y2,d_py+m));
+  PetscCall(VecCUDAPlaceArray(ctx->y2,d_py+ctx->m));
   if (!ctx->misaligned) {
     PetscCall(MatMult(ctx->A,ctx->x2,ctx->y1));
     PetscCall(MatMult(ctx->AT,ctx->x1,ctx->y2));
@@ -52,19 +50,15 @@ PetscErrorCode MatMult_ECross_CUDA(Mat B,Vec x,Vec y)
   SVD_CYCLIC_SHELL  *ctx;
   const PetscScalar *d_px;
   PetscScalar       *d_py;
-  PetscInt          mn,m,n;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(B,&ctx));
-  PetscCall(MatGetLocalSize(ctx->A,NULL,&n));
-  PetscCall(VecGetLocalSize(y,&mn));
-  m = mn-n;
   PetscCall(VecCUDAGetArrayRead(x,&d_px));
   PetscCall(VecCUDAGetArrayWrite(y,&d_py));
   PetscCall(VecCUDAPlaceArray(ctx->x1,d_px));
-  PetscCall(VecCUDAPlaceArray(ctx->x2,d_px+m));
+  PetscCall(VecCUDAPlaceArray(ctx->x2,d_px+ctx->m));
   PetscCall(VecCUDAPlaceArray(ctx->y1,d_py));
-  PetscCall(VecCUDAPlaceArray(ctx->y2,d_py+m));
+  PetscCall(VecCUDAPlaceArray(ctx->y2,d_py+ctx->m));
   PetscCall(VecCopy(ctx->x1,ctx->y1));
   if (!ctx->misaligned) {
     PetscCall(MatMult(ctx->A,ctx->x2,ctx->w));
@@ -32,6 +32,7 @@
 
 typedef struct {
   PetscBool oneside;
+  PetscBool pipelined;
 } SVD_LANCZOS;
 
 static PetscErrorCode SVDSetUp_Lanczos(SVD svd)
@@ -42,6 +43,7 @@ static PetscErrorCode SVDSetUp_Lanczos(SVD svd)
   PetscFunctionBegin;
   SVDCheckStandard(svd);
   SVDCheckDefinite(svd);
+  PetscCheck(!lanczos->oneside || !lanczos->pipelined,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The pipelined bidiagonalization requires the two-sided variant");
   PetscCall(MatGetSize(svd->A,NULL,&N));
   PetscCall(SVDSetDimensions_Default(svd));
   PetscCheck(svd->ncv<=svd->nsv+svd->mpd,PetscObjectComm((PetscObject)svd),PETSC_ERR_USER_INPUT,"The value of ncv must not be larger than nev+mpd");
@@ -109,6 +111,84 @@ PetscErrorCode SVDTwoSideLanczos(SVD svd,PetscReal *alpha,PetscReal *beta,BV V,B
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   SVDTwoSideLanczosPipelined - Variant of the two-sided bidiagonalization in
+   which the products with A and A^T of one step are applied back to back, and
+   all inner products and norms of the step are batched in a single split-phase
+   reduction. This rearrangement is possible because A^T can be applied to the
+   unnormalized left vector, so the normalization by alpha is deferred and
+   folded into the scaling of the next right vector. Each basis is purged with
+   a single CGS sweep whose resulting norm is estimated from the combined
+   reduction, as in the BV_ORTHOG_REFINE_FUSED refinement, hence one global
+   synchronization per Golub-Kahan step.
+*/
+static PetscErrorCode SVDTwoSideLanczosPipelined(SVD svd,PetscReal *alpha,PetscReal *beta,BV V,BV U,PetscInt k,PetscInt *n,PetscBool *breakdown,PetscScalar *worku,PetscScalar *workv)
+{
+  PetscInt       i,j,ul,uk,vl,vk;
+  Vec            u,v;
+  PetscReal      a,b,eta,sum,est,s;
+  PetscBool      lindep=PETSC_FALSE;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetOrthogonalization(U,NULL,NULL,&eta,NULL));
+  PetscCall(BVGetActiveColumns(U,&ul,&uk));
+  PetscCall(BVGetActiveColumns(V,&vl,&vk));
+  for (i=k;i<*n;i++) {
+    /* apply both matrix-vector products before any reduction */
+    PetscCall(BVGetColumn(V,i,&v));
+    PetscCall(BVGetColumn(U,i,&u));
+    PetscCall(MatMult(svd->A,v,u));
+    PetscCall(BVRestoreColumn(V,i,&v));
+    PetscCall(BVGetColumn(V,i+1,&v));
+    PetscCall(MatMult(svd->AT,u,v));
+    PetscCall(BVRestoreColumn(U,i,&u));
+    PetscCall(BVRestoreColumn(V,i+1,&v));
+
+    /* batch all coefficients and norms of the step in one reduction */
+    PetscCall(BVSetActiveColumns(U,0,i));
+    PetscCall(BVSetActiveColumns(V,0,i+1));
+    PetscCall(BVDotColumnBegin(U,i,worku));
+    PetscCall(BVNormColumnBegin(U,i,NORM_2,&a));
+    PetscCall(BVDotColumnBegin(V,i+1,workv));
+    PetscCall(BVNormColumnBegin(V,i+1,NORM_2,&b));
+    PetscCall(BVDotColumnEnd(U,i,worku));
+    PetscCall(BVNormColumnEnd(U,i,NORM_2,&a));
+    PetscCall(BVDotColumnEnd(V,i+1,workv));
+    PetscCall(BVNormColumnEnd(V,i+1,NORM_2,&b));
+
+    /* u = (u - U c)/alpha, with alpha estimated from the combined reduction */
+    sum = 0.0;
+    for (j=0;j<i;j++) sum += PetscAbsScalar(worku[j])*PetscAbsScalar(worku[j]);
+    est = a*a-sum;
+    if (est<=0.0 || PetscSqrtReal(est)<eta*a) {
+      *n = i;
+      lindep = PETSC_TRUE;
+      break;
+    }
+    alpha[i] = PetscSqrtReal(est);
+    PetscCall(BVMultColumn(U,-1.0/alpha[i],1.0/alpha[i],i,worku));
+
+    /* v = (v - V h)/(alpha*beta); the component of A^T u along previous
+       left vectors lies in the span of V and is purged along with h */
+    sum = 0.0;
+    for (j=0;j<i+1;j++) sum += PetscAbsScalar(workv[j])*PetscAbsScalar(workv[j]);
+    est = b*b-sum;
+    if (est<=0.0 || PetscSqrtReal(est)<eta*b) {
+      beta[i] = (est>0.0)? PetscSqrtReal(est)/alpha[i]: 0.0;
+      *n = i+1;
+      lindep = PETSC_TRUE;
+      break;
+    }
+    beta[i] = PetscSqrtReal(est)/alpha[i];
+    s = 1.0/(alpha[i]*beta[i]);
+    PetscCall(BVMultColumn(V,-s,s,i+1,workv));
+  }
+  PetscCall(BVSetActiveColumns(U,ul,uk));
+  PetscCall(BVSetActiveColumns(V,vl,vk));
+  if (breakdown) *breakdown = lindep;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDOneSideLanczos(SVD svd,PetscReal *alpha,PetscReal *beta,BV V,Vec u,Vec u_1,PetscInt k,PetscInt n,PetscScalar* work)
 {
   PetscInt       i,bvl,bvk;
@@ -221,7 +301,7 @@ static PetscErrorCode SVDSolve_Lanczos(SVD svd)
 {
   SVD_LANCZOS    *lanczos = (SVD_LANCZOS*)svd->data;
   PetscReal      *alpha,*beta;
-  PetscScalar    *swork,*w,*P;
+  PetscScalar    *swork,*pwork=NULL,*w,*P;
   PetscInt       i,k,j,nv,ld;
   Vec            u=NULL,u_1=NULL;
   Mat            U,V;
@@ -230,6 +310,7 @@ static PetscErrorCode SVDSolve_Lanczos(SVD svd)
   /* allocate working space */
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
   PetscCall(PetscMalloc2(ld,&w,svd->ncv,&swork));
+  if (lanczos->pipelined) PetscCall(PetscMalloc1(svd->ncv+1,&pwork));
 
   if (lanczos->oneside) {
     PetscCall(MatCreateVecs(svd->A,NULL,&u));
@@ -253,7 +334,8 @@ static PetscErrorCode SVDSolve_Lanczos(SVD svd)
     if (lanczos->oneside) PetscCall(SVDOneSideLanczos(svd,alpha,beta,svd->V,u,u_1,svd->nconv,nv,swork));
     else {
       PetscCall(BVSetActiveColumns(svd->U,svd->nconv,nv));
-      PetscCall(SVDTwoSideLanczos(svd,alpha,beta,svd->V,svd->U,svd->nconv,&nv,NULL));
+      if (lanczos->pipelined) PetscCall(SVDTwoSideLanczosPipelined(svd,alpha,beta,svd->V,svd->U,svd->nconv,&nv,NULL,swork,pwork));
+      else PetscCall(SVDTwoSideLanczos(svd,alpha,beta,svd->V,svd->U,svd->nconv,&nv,NULL));
     }
     PetscCall(DSRestoreArrayReal(svd->ds,DS_MAT_T,&alpha));
 
@@ -305,6 +387,7 @@ static PetscErrorCode SVDSolve_Lanczos(SVD svd)
   /* free working space */
   PetscCall(VecDestroy(&u));
   PetscCall(VecDestroy(&u_1));
+  PetscCall(PetscFree(pwork));
   PetscCall(PetscFree2(w,swork));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -320,6 +403,9 @@ static PetscErrorCode SVDSetFromOptions_Lanczos(SVD svd,PetscOptionItems *PetscO
     PetscCall(PetscOptionsBool("-svd_lanczos_oneside","Use one-side reorthogonalization","SVDLanczosSetOneSide",lanczos->oneside,&val,&set));
     if (set) PetscCall(SVDLanczosSetOneSide(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_lanczos_pipelined","Use pipelined bidiagonalization with one reduction per step","SVDLanczosSetPipelined",lanczos->pipelined,&val,&set));
+    if (set) PetscCall(SVDLanczosSetPipelined(svd,val));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -402,12 +488,99 @@ PetscErrorCode SVDLanczosGetOneSide(SVD svd,PetscBool *oneside)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDLanczosSetPipelined_Lanczos(SVD svd,PetscBool pipelined)
+{
+  SVD_LANCZOS *lanczos = (SVD_LANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (lanczos->pipelined != pipelined) {
+    lanczos->pipelined = pipelined;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDLanczosSetPipelined - Indicate if the two-sided Lanczos bidiagonalization
+   must be rearranged so that each step performs a single global reduction.
+
+   Logically Collective
+
+   Input Parameters:
++  svd       - singular value solver
+-  pipelined - boolean flag indicating if the pipelined variant must be used
+
+   Options Database Key:
+.  -svd_lanczos_pipelined <boolean> - Indicates the boolean flag
+
+   Notes:
+   In the pipelined variant, the two matrix-vector products of each
+   bidiagonalization step are applied back to back and all the inner products
+   and norms of the step are batched in a single all-reduce, halving the
+   number of global synchronizations. This is advantageous when running on
+   a large number of processes.
+
+   The rearrangement performs a single classical Gram-Schmidt sweep per basis
+   with the norm estimated from the combined reduction, so it can be slightly
+   less robust than the default variant in difficult cases.
+
+   This option is not available in combination with SVDLanczosSetOneSide().
+
+   Level: advanced
+
+.seealso: SVDLanczosGetPipelined(), SVDLanczosSetOneSide()
+@*/
+PetscErrorCode SVDLanczosSetPipelined(SVD svd,PetscBool pipelined)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,pipelined,2);
+  PetscTryMethod(svd,"SVDLanczosSetPipelined_C",(SVD,PetscBool),(svd,pipelined));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDLanczosGetPipelined_Lanczos(SVD svd,PetscBool *pipelined)
+{
+  SVD_LANCZOS *lanczos = (SVD_LANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *pipelined = lanczos->pipelined;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDLanczosGetPipelined - Gets if the pipelined variant of the Lanczos
+   bidiagonalization is being used.
+
+   Not Collective
+
+   Input Parameters:
+.  svd - singular value solver
+
+   Output Parameters:
+.  pipelined - boolean flag indicating if the pipelined variant is used
+
+   Level: advanced
+
+.seealso: SVDLanczosSetPipelined()
+@*/
+PetscErrorCode SVDLanczosGetPipelined(SVD svd,PetscBool *pipelined)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(pipelined,2);
+  PetscUseMethod(svd,"SVDLanczosGetPipelined_C",(SVD,PetscBool*),(svd,pipelined));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDDestroy_Lanczos(SVD svd)
 {
   PetscFunctionBegin;
   PetscCall(PetscFree(svd->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosSetOneSide_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosGetOneSide_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosSetPipelined_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosGetPipelined_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -418,7 +591,10 @@ static PetscErrorCode SVDView_Lanczos(SVD svd,PetscViewer viewer)
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
-  if (isascii) PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
+  if (isascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
+    if (lanczos->pipelined) PetscCall(PetscViewerASCIIPrintf(viewer,"  pipelined bidiagonalization with one reduction per step\n"));
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -438,5 +614,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_Lanczos(SVD svd)
   svd->ops->computevectors = SVDComputeVectors_Left;
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosSetOneSide_C",SVDLanczosSetOneSide_Lanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosGetOneSide_C",SVDLanczosGetOneSide_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosSetPipelined_C",SVDLanczosSetPipelined_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDLanczosGetPipelined_C",SVDLanczosGetPipelined_Lanczos));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
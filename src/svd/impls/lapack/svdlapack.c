@@ -37,21 +37,21 @@ static PetscErrorCode SVDSetUp_LAPACK(SVD svd)
 static PetscErrorCode SVDSolve_LAPACK(SVD svd)
 {
   PetscInt          M,N,n,i,j,k,ld,lowu,lowv,highu,highv;
-  Mat               A,Ar,mat;
+  Mat               A,Ar;
   Vec               u,v;
   PetscScalar       *pU,*pV,*pu,*pv,*w;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
-  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
-  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&mat));
-  PetscCall(MatDestroy(&Ar));
-  PetscCall(MatGetSize(mat,&M,&N));
+  PetscCall(MatGetSize(svd->OP,&M,&N));
   PetscCall(DSSetDimensions(svd->ds,M,0,0));
   PetscCall(DSSVDSetDimensions(svd->ds,N));
+  /* gather the matrix directly into the DS storage, avoiding an intermediate dense copy */
+  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
   PetscCall(DSGetMat(svd->ds,DS_MAT_A,&A));
-  PetscCall(MatCopy(mat,A,SAME_NONZERO_PATTERN));
+  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_REUSE_MATRIX,&A));
   PetscCall(DSRestoreMat(svd->ds,DS_MAT_A,&A));
+  PetscCall(MatDestroy(&Ar));
   PetscCall(DSSetState(svd->ds,DS_STATE_RAW));
 
   n = PetscMin(M,N);
@@ -92,7 +92,6 @@ static PetscErrorCode SVDSolve_LAPACK(SVD svd)
   svd->its    = 1;
   svd->reason = SVD_CONVERGED_TOL;
 
-  PetscCall(MatDestroy(&mat));
   PetscCall(PetscFree(w));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -100,30 +99,29 @@ static PetscErrorCode SVDSolve_LAPACK(SVD svd)
 static PetscErrorCode SVDSolve_LAPACK_GSVD(SVD svd)
 {
   PetscInt          nsv,m,n,p,i,j,mlocal,plocal,ld,lowx,lowu,lowv,highx;
-  Mat               Ar,A,Ads,Br,B,Bds;
+  Mat               Ar,Ads,Br,Bds;
   Vec               uv,x;
   PetscScalar       *U,*V,*X,*px,*puv,*w;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
-  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
-  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&A));
-  PetscCall(MatDestroy(&Ar));
-  PetscCall(MatCreateRedundantMatrix(svd->OPb,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Br));
-  PetscCall(MatConvert(Br,MATSEQDENSE,MAT_INITIAL_MATRIX,&B));
-  PetscCall(MatDestroy(&Br));
-  PetscCall(MatGetSize(A,&m,&n));
+  PetscCall(MatGetSize(svd->OP,&m,&n));
+  PetscCall(MatGetSize(svd->OPb,&p,NULL));
   PetscCall(MatGetLocalSize(svd->OP,&mlocal,NULL));
   PetscCall(MatGetLocalSize(svd->OPb,&plocal,NULL));
-  PetscCall(MatGetSize(B,&p,NULL));
   PetscCall(DSSetDimensions(svd->ds,m,0,0));
   PetscCall(DSGSVDSetDimensions(svd->ds,n,p));
+  /* gather both matrices directly into the DS storage, avoiding intermediate dense copies */
+  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
   PetscCall(DSGetMat(svd->ds,DS_MAT_A,&Ads));
-  PetscCall(MatCopy(A,Ads,SAME_NONZERO_PATTERN));
+  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_REUSE_MATRIX,&Ads));
   PetscCall(DSRestoreMat(svd->ds,DS_MAT_A,&Ads));
+  PetscCall(MatDestroy(&Ar));
+  PetscCall(MatCreateRedundantMatrix(svd->OPb,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Br));
   PetscCall(DSGetMat(svd->ds,DS_MAT_B,&Bds));
-  PetscCall(MatCopy(B,Bds,SAME_NONZERO_PATTERN));
+  PetscCall(MatConvert(Br,MATSEQDENSE,MAT_REUSE_MATRIX,&Bds));
   PetscCall(DSRestoreMat(svd->ds,DS_MAT_B,&Bds));
+  PetscCall(MatDestroy(&Br));
   PetscCall(DSSetState(svd->ds,DS_STATE_RAW));
 
   nsv  = PetscMin(n,PetscMin(p,m));
@@ -162,8 +160,6 @@ static PetscErrorCode SVDSolve_LAPACK_GSVD(SVD svd)
   svd->its    = 1;
   svd->reason = SVD_CONVERGED_TOL;
 
-  PetscCall(MatDestroy(&A));
-  PetscCall(MatDestroy(&B));
   PetscCall(PetscFree(w));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -171,22 +167,22 @@ static PetscErrorCode SVDSolve_LAPACK_GSVD(SVD svd)
 static PetscErrorCode SVDSolve_LAPACK_HSVD(SVD svd)
 {
   PetscInt          M,N,n,i,j,k,ld,lowu,lowv,highu,highv;
-  Mat               A,Ar,mat,D;
+  Mat               A,Ar,D;
   Vec               u,v,vomega;
   PetscScalar       *pU,*pV,*pu,*pv,*w;
   PetscReal         *pD;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
-  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
-  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&mat));
-  PetscCall(MatDestroy(&Ar));
-  PetscCall(MatGetSize(mat,&M,&N));
+  PetscCall(MatGetSize(svd->OP,&M,&N));
   PetscCall(DSSetDimensions(svd->ds,M,0,0));
   PetscCall(DSHSVDSetDimensions(svd->ds,N));
+  /* gather the matrix directly into the DS storage, avoiding an intermediate dense copy */
+  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
   PetscCall(DSGetMat(svd->ds,DS_MAT_A,&A));
-  PetscCall(MatCopy(mat,A,SAME_NONZERO_PATTERN));
+  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_REUSE_MATRIX,&A));
   PetscCall(DSRestoreMat(svd->ds,DS_MAT_A,&A));
+  PetscCall(MatDestroy(&Ar));
   PetscCall(DSGetMatAndColumn(svd->ds,DS_MAT_D,0,&D,&vomega));
   PetscCall(VecCopy(svd->omega,vomega));
   PetscCall(DSRestoreMatAndColumn(svd->ds,DS_MAT_D,0,&D,&vomega));
@@ -233,7 +229,6 @@ static PetscErrorCode SVDSolve_LAPACK_HSVD(SVD svd)
   svd->its    = 1;
   svd->reason = SVD_CONVERGED_TOL;
 
-  PetscCall(MatDestroy(&mat));
   PetscCall(PetscFree(w));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -91,7 +91,7 @@ static PetscErrorCode BlockMatMult(BV V,Mat A,BV Y,Mat AT)
 static PetscErrorCode SVDSolve_Randomized(SVD svd)
 {
   PetscScalar    *w;
-  PetscReal      res=1.0;
+  PetscReal      res=1.0,*sigma0;
   PetscInt       i,k=0;
   Mat            A,U,V;
 
@@ -100,6 +100,7 @@ static PetscErrorCode SVDSolve_Randomized(SVD svd)
   PetscCall(BVSetActiveColumns(svd->V,svd->nini,svd->ncv));
   PetscCall(BVSetRandomNormal(svd->V));
   PetscCall(PetscCalloc1(svd->ncv,&w));
+  PetscCall(PetscCalloc1(svd->ncv,&sigma0));
 
   /* Subspace Iteration */
   do {
@@ -132,9 +133,16 @@ static PetscErrorCode SVDSolve_Randomized(SVD svd)
     /* Check convergence */
     k = 0;
     for (i=svd->nconv;i<svd->ncv;i++) {
-      PetscCall(SVDRandomizedResidualNorm(svd,i,w[i],&res));
       svd->sigma[i] = PetscRealPart(w[i]);
-      PetscCall((*svd->converged)(svd,svd->sigma[i],res,&svd->errest[i],svd->convergedctx));
+      /* the change of the value with respect to the previous pass gives a
+         free estimate of the convergence rate; the explicit residual (two
+         matrix-vector products) is computed only for values close enough */
+      PetscCall((*svd->converged)(svd,svd->sigma[i],PetscAbsReal(svd->sigma[i]-sigma0[i]),&svd->errest[i],svd->convergedctx));
+      sigma0[i] = svd->sigma[i];
+      if (svd->errest[i] < 10*svd->tol) {
+        PetscCall(SVDRandomizedResidualNorm(svd,i,w[i],&res));
+        PetscCall((*svd->converged)(svd,svd->sigma[i],res,&svd->errest[i],svd->convergedctx));
+      }
       if (svd->errest[i] < svd->tol) k++;
       else break;
     }
@@ -147,6 +155,7 @@ static PetscErrorCode SVDSolve_Randomized(SVD svd)
     PetscCall(SVDMonitor(svd,svd->its,svd->nconv,svd->sigma,svd->errest,svd->ncv));
   } while (svd->reason == SVD_CONVERGED_ITERATING);
   PetscCall(PetscFree(w));
+  PetscCall(PetscFree(sigma0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -54,10 +54,13 @@ static const char citationg[] =
 typedef struct {
   /* user parameters */
   PetscBool           oneside;   /* one-sided variant */
+  PetscBool           selective; /* selective reorthogonalization in the one-sided variant */
+  PetscBool           storeu;    /* whether the left basis is stored during the iteration */
   PetscReal           keep;      /* restart parameter */
   PetscBool           lock;      /* locking/non-locking variant */
   KSP                 ksp;       /* solver for least-squares problem in GSVD */
   SVDTRLanczosGBidiag bidiag;    /* bidiagonalization variant for GSVD */
+  PetscBool           joint;     /* joint orthogonalization of the two left bases in GSVD */
   PetscReal           scalef;    /* scale factor for matrix B */
   PetscReal           scaleth;   /* scale threshold for automatic scaling */
   PetscBool           explicitmatrix;
@@ -216,10 +219,20 @@ static PetscErrorCode SVDSetUp_TRLanczos(SVD svd)
   PetscCheck(lanczos->lock || svd->mpd>=svd->ncv,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Should not use mpd parameter in non-locking variant");
   if (svd->max_it==PETSC_DEFAULT) svd->max_it = PetscMax(N/svd->ncv,100);
   if (!lanczos->keep) lanczos->keep = 0.5;
-  svd->leftbasis = PETSC_TRUE;
+  if (!lanczos->storeu) {
+    PetscCheck(lanczos->oneside,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Not storing the left basis requires the one-sided variant");
+    PetscCheck(!svd->isgeneralized && !svd->ishyperbolic,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Not storing the left basis is only available for the standard SVD");
+  }
+  svd->leftbasis = lanczos->storeu;
+  svd->ops->computevectors = lanczos->storeu? NULL: SVDComputeVectors_Left;
   PetscCall(SVDAllocateSolution(svd,1));
+  if (!lanczos->storeu) PetscCall(SVDSetWorkVecs(svd,2,1));
   if (svd->isgeneralized) {
     PetscCall(MatGetSize(svd->B,&P,NULL));
+    if (lanczos->joint) {
+      PetscCheck(!lanczos->oneside,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Joint orthogonalization requires the two-sided variant");
+      PetscCheck(lanczos->bidiag==SVD_TRLANCZOS_GBIDIAG_UPPER,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Joint orthogonalization is only available with upper-upper bidiagonalization");
+    }
     if (lanczos->bidiag == SVD_TRLANCZOS_GBIDIAG_LOWER && ((svd->which==SVD_LARGEST && P<=N) || (svd->which==SVD_SMALLEST && M>N && P<=N))) {
       SWAP(svd->A,svd->B,aux);
       SWAP(svd->AT,svd->BT,aux);
@@ -315,6 +328,155 @@ static PetscErrorCode SVDOneSideTRLanczosMGS(SVD svd,PetscReal *alpha,PetscReal
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   One-sided Lanczos bidiagonalization with selective reorthogonalization.
+   The loss of orthogonality among the right Lanczos vectors is monitored
+   with the omega recurrence, and a vector is orthogonalized explicitly
+   against the previous ones only when the estimate exceeds the sqrt(eps)
+   threshold, so most iterations perform just the three-term recurrence
+   plus a normalization.
+*/
+static PetscErrorCode SVDOneSideTRLanczosSelective(SVD svd,PetscReal *alpha,PetscReal *beta,BV V,BV U,PetscInt nconv,PetscInt l,PetscInt n,PetscScalar* work)
+{
+  PetscReal      a,b,t,numax,*mu,*nu;
+  const PetscReal eps=PETSC_MACHINE_EPSILON,delta=PETSC_SQRT_MACHINE_EPSILON;
+  PetscInt       i,j,k=nconv+l;
+  Vec            ui,ui1,vi,vi1;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc2(n+1,&mu,n+1,&nu));
+  /* after restart, the first k+1 right vectors are orthogonal to working precision */
+  for (j=0;j<k;j++) { mu[j] = eps; nu[j] = eps; }
+  mu[k] = 1.0; nu[k] = 1.0;
+
+  PetscCall(BVGetColumn(V,k,&vi));
+  PetscCall(BVGetColumn(U,k,&ui));
+  PetscCall(MatMult(svd->A,vi,ui));
+  PetscCall(BVRestoreColumn(V,k,&vi));
+  PetscCall(BVRestoreColumn(U,k,&ui));
+  if (l>0) {
+    PetscCall(BVSetActiveColumns(U,nconv,n));
+    for (i=0;i<l;i++) work[i]=beta[i+nconv];
+    PetscCall(BVMultColumn(U,-1.0,1.0,k,work));
+  }
+  PetscCall(BVNormColumn(U,k,NORM_2,&a));
+  PetscCall(BVScaleColumn(U,k,1.0/a));
+  alpha[k] = a;
+
+  for (i=k+1;i<=n;i++) {
+    /* v_i = A^T u_{i-1} - alpha_{i-1} v_{i-1} */
+    PetscCall(BVGetColumn(V,i,&vi));
+    PetscCall(BVGetColumn(U,i-1,&ui1));
+    PetscCall(MatMult(svd->AT,ui1,vi));
+    PetscCall(BVRestoreColumn(U,i-1,&ui1));
+    PetscCall(BVGetColumn(V,i-1,&vi1));
+    PetscCall(VecAXPY(vi,-alpha[i-1],vi1));
+    PetscCall(BVRestoreColumn(V,i-1,&vi1));
+    PetscCall(BVRestoreColumn(V,i,&vi));
+    PetscCall(BVNormColumn(V,i,NORM_2,&b));
+    PetscCheck(PetscAbsReal(b)>10*PETSC_MACHINE_EPSILON,PetscObjectComm((PetscObject)svd),PETSC_ERR_PLIB,"Recurrence generated a zero vector; use a two-sided variant");
+
+    /* omega recurrence: update the estimates of <v_i,v_j> */
+    numax = 0.0;
+    for (j=0;j<i;j++) {
+      t = (alpha[j]*mu[j] + (j>0? beta[j-1]*mu[j-1]: 0.0) - alpha[i-1]*nu[j])/b;
+      nu[j] = t + ((t>=0.0)? eps: -eps);
+      numax = PetscMax(numax,PetscAbsReal(nu[j]));
+    }
+    nu[i] = 1.0;
+
+    if (numax > delta) {
+      /* orthogonality lost: reorthogonalize against all previous vectors */
+      if (i<n) PetscCall(BVOrthonormalizeColumn(V,i,PETSC_FALSE,&b,NULL));
+      else PetscCall(BVOrthogonalizeColumn(V,n,NULL,&b,NULL));
+      for (j=0;j<i;j++) nu[j] = eps;
+    } else if (i<n) PetscCall(BVScaleColumn(V,i,1.0/b));
+    beta[i-1] = b;
+    if (i==n) break;   /* the last column is normalized by the caller */
+
+    /* u_i = A v_i - beta_{i-1} u_{i-1} */
+    PetscCall(BVGetColumn(V,i,&vi));
+    PetscCall(BVGetColumn(U,i,&ui));
+    PetscCall(MatMult(svd->A,vi,ui));
+    PetscCall(BVRestoreColumn(V,i,&vi));
+    PetscCall(BVGetColumn(U,i-1,&ui1));
+    PetscCall(VecAXPY(ui,-b,ui1));
+    PetscCall(BVRestoreColumn(U,i-1,&ui1));
+    PetscCall(BVRestoreColumn(U,i,&ui));
+    PetscCall(BVNormColumn(U,i,NORM_2,&a));
+    PetscCall(BVScaleColumn(U,i,1.0/a));
+    alpha[i] = a;
+
+    /* omega recurrence: update the estimates of <u_i,u_j> */
+    for (j=0;j<i;j++) {
+      t = (alpha[j]*nu[j] + beta[j]*nu[j+1] - b*mu[j])/a;
+      mu[j] = t + ((t>=0.0)? eps: -eps);
+    }
+    mu[i] = 1.0;
+  }
+  PetscCall(PetscFree2(mu,nu));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   One-sided Lanczos bidiagonalization that does not store the left basis.
+   Only the two most recent left vectors are kept in work vectors, which
+   makes the memory footprint independent of ncv on the left side. After a
+   thick restart the relation A*v_j = sigma_j*u_j holds for the restart
+   vectors, so the couplings with the new start vector can be applied on
+   the right side and a single matrix-vector product suffices to compute
+   the first left vector of the sweep. Converged left singular vectors are
+   regenerated at the end as U=A*V, see SVDComputeVectors_Left().
+*/
+static PetscErrorCode SVDOneSideTRLanczosNoU(SVD svd,PetscReal *alpha,PetscReal *beta,BV V,PetscInt nconv,PetscInt l,PetscInt n,PetscScalar* work)
+{
+  PetscReal      a,b;
+  PetscInt       j,i,k=nconv+l;
+  Vec            vi,tmp,ui=svd->workl[0],ui1=svd->workl[1],w=svd->workr[0];
+
+  PetscFunctionBegin;
+  if (l>0) {
+    for (j=0;j<l;j++) work[j] = -beta[j+nconv]/alpha[j+nconv];
+    PetscCall(BVSetActiveColumns(V,nconv,k));
+    PetscCall(BVGetColumn(V,k,&vi));
+    PetscCall(VecCopy(vi,w));
+    PetscCall(BVRestoreColumn(V,k,&vi));
+    PetscCall(BVMultVec(V,1.0,1.0,w,work));
+    PetscCall(MatMult(svd->A,w,ui));
+  } else {
+    PetscCall(BVGetColumn(V,k,&vi));
+    PetscCall(MatMult(svd->A,vi,ui));
+    PetscCall(BVRestoreColumn(V,k,&vi));
+  }
+  PetscCall(VecNorm(ui,NORM_2,&a));
+  PetscCall(VecScale(ui,1.0/a));
+  alpha[k] = a;
+
+  for (i=k+1;i<n;i++) {
+    PetscCall(BVGetColumn(V,i,&vi));
+    PetscCall(MatMult(svd->AT,ui,vi));
+    PetscCall(BVRestoreColumn(V,i,&vi));
+    PetscCall(BVOrthonormalizeColumn(V,i,PETSC_FALSE,&b,NULL));
+    beta[i-1] = b;
+
+    SWAP(ui,ui1,tmp);
+    PetscCall(BVGetColumn(V,i,&vi));
+    PetscCall(MatMult(svd->A,vi,ui));
+    PetscCall(BVRestoreColumn(V,i,&vi));
+    PetscCall(VecAXPY(ui,-b,ui1));
+    PetscCall(VecNorm(ui,NORM_2,&a));
+    PetscCall(VecScale(ui,1.0/a));
+    alpha[i] = a;
+  }
+
+  PetscCall(BVGetColumn(V,n,&vi));
+  PetscCall(MatMult(svd->AT,ui,vi));
+  PetscCall(BVRestoreColumn(V,n,&vi));
+  PetscCall(BVOrthogonalizeColumn(V,n,NULL,&b,NULL));
+  beta[n-1] = b;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   Custom CGS orthogonalization, preprocess after first orthogonalization
 */
@@ -482,13 +644,15 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
     PetscCall(DSGetArrayReal(svd->ds,DS_MAT_T,&alpha));
     beta = alpha + ld;
     if (lanczos->oneside) {
-      if (orthog == BV_ORTHOG_MGS) PetscCall(SVDOneSideTRLanczosMGS(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
+      if (!lanczos->storeu) PetscCall(SVDOneSideTRLanczosNoU(svd,alpha,beta,svd->V,svd->nconv,l,nv,swork));
+      else if (lanczos->selective) PetscCall(SVDOneSideTRLanczosSelective(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
+      else if (orthog == BV_ORTHOG_MGS) PetscCall(SVDOneSideTRLanczosMGS(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
       else PetscCall(SVDOneSideTRLanczosCGS(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
     } else PetscCall(SVDTwoSideLanczos(svd,alpha,beta,svd->V,svd->U,svd->nconv+l,&nv,&breakdown));
     PetscCall(DSRestoreArrayReal(svd->ds,DS_MAT_T,&alpha));
     PetscCall(BVScaleColumn(svd->V,nv,1.0/beta[nv-1]));
     PetscCall(BVSetActiveColumns(svd->V,svd->nconv,nv));
-    PetscCall(BVSetActiveColumns(svd->U,svd->nconv,nv));
+    if (lanczos->storeu) PetscCall(BVSetActiveColumns(svd->U,svd->nconv,nv));
 
     /* solve projected problem */
     PetscCall(DSSetDimensions(svd->ds,nv,svd->nconv,svd->nconv+l));
@@ -529,9 +693,11 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
     PetscCall(DSGetMat(svd->ds,DS_MAT_V,&V));
     PetscCall(BVMultInPlace(svd->V,V,svd->nconv,k+l));
     PetscCall(DSRestoreMat(svd->ds,DS_MAT_V,&V));
-    PetscCall(DSGetMat(svd->ds,DS_MAT_U,&U));
-    PetscCall(BVMultInPlace(svd->U,U,svd->nconv,k+l));
-    PetscCall(DSRestoreMat(svd->ds,DS_MAT_U,&U));
+    if (lanczos->storeu) {
+      PetscCall(DSGetMat(svd->ds,DS_MAT_U,&U));
+      PetscCall(BVMultInPlace(svd->U,U,svd->nconv,k+l));
+      PetscCall(DSRestoreMat(svd->ds,DS_MAT_U,&U));
+    }
 
     /* copy the last vector to be the next initial vector */
     if (svd->reason == SVD_CONVERGED_ITERATING && !breakdown) PetscCall(BVCopyColumn(svd->V,nv,k+l));
@@ -541,7 +707,7 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
   }
 
   /* orthonormalize U columns in one side method */
-  if (lanczos->oneside) {
+  if (lanczos->oneside && lanczos->storeu) {
     for (i=0;i<svd->nconv;i++) PetscCall(BVOrthonormalizeColumn(svd->U,i,PETSC_FALSE,NULL,NULL));
   }
 
@@ -993,6 +1159,50 @@ static inline PetscErrorCode SVDLeftSingularVectors_Single(SVD svd,BV U1,BV U2)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Orthonormalize column j of U1 and column j of U2 jointly, with a classical
+   Gram-Schmidt sweep plus one refinement. The inner products of the two panels
+   are accumulated in the same split-phase reduction, so each pass costs a
+   single global reduction instead of one per basis
+*/
+static PetscErrorCode SVDOrthonormalizeJoint(BV U1,BV U2,PetscInt j,PetscReal *norm1,PetscReal *norm2,PetscBool *lindep1,PetscBool *lindep2)
+{
+  PetscScalar *h1,*h2;
+  PetscReal   nrm1,nrm2;
+  PetscInt    i,l1,l2,k1,k2;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetActiveColumns(U1,&l1,&k1));
+  PetscCall(BVGetActiveColumns(U2,&l2,&k2));
+  PetscCall(BVSetActiveColumns(U1,0,k1));  /* must also orthogonalize against leading columns */
+  PetscCall(BVSetActiveColumns(U2,0,k2));
+  if (j>0) {
+    PetscCall(PetscMalloc2(j,&h1,j,&h2));
+    for (i=0;i<2;i++) {
+      PetscCall(BVDotColumnBegin(U1,j,h1));
+      PetscCall(BVDotColumnBegin(U2,j,h2));
+      PetscCall(BVDotColumnEnd(U1,j,h1));
+      PetscCall(BVDotColumnEnd(U2,j,h2));
+      PetscCall(BVMultColumn(U1,-1.0,1.0,j,h1));
+      PetscCall(BVMultColumn(U2,-1.0,1.0,j,h2));
+    }
+    PetscCall(PetscFree2(h1,h2));
+  }
+  PetscCall(BVNormColumnBegin(U1,j,NORM_2,&nrm1));
+  PetscCall(BVNormColumnBegin(U2,j,NORM_2,&nrm2));
+  PetscCall(BVNormColumnEnd(U1,j,NORM_2,&nrm1));
+  PetscCall(BVNormColumnEnd(U2,j,NORM_2,&nrm2));
+  *lindep1 = nrm1==0.0? PETSC_TRUE: PETSC_FALSE;
+  *lindep2 = nrm2==0.0? PETSC_TRUE: PETSC_FALSE;
+  if (!*lindep1) PetscCall(BVScaleColumn(U1,j,1.0/nrm1));
+  if (!*lindep2) PetscCall(BVScaleColumn(U2,j,1.0/nrm2));
+  *norm1 = nrm1;
+  *norm2 = nrm2;
+  PetscCall(BVSetActiveColumns(U1,l1,k1));
+  PetscCall(BVSetActiveColumns(U2,l2,k2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDLanczosGUpper(SVD svd,PetscReal *alpha,PetscReal *beta,PetscReal *alphah,PetscReal *betah,Mat Z,BV U1,BV U2,BV V,KSP ksp,PetscInt k,PetscInt *n,PetscBool *breakdown)
 {
   SVD_TRLANCZOS     *lanczos = (SVD_TRLANCZOS*)svd->data;
@@ -1014,7 +1224,8 @@ static PetscErrorCode SVDLanczosGUpper(SVD svd,PetscReal *alpha,PetscReal *beta,
     PetscCall(VecPlaceArray(v1,carr));
     PetscCall(BVInsertVec(U1,i,v1));
     PetscCall(VecResetArray(v1));
-    if (!lanczos->oneside || i==k) PetscCall(BVOrthonormalizeColumn(U1,i,PETSC_FALSE,alpha+i,&lindep1));
+    if (lanczos->joint) { /* deferred until the U2 panel is formed */ }
+    else if (!lanczos->oneside || i==k) PetscCall(BVOrthonormalizeColumn(U1,i,PETSC_FALSE,alpha+i,&lindep1));
     else {  /* cheap computation of U1[i], if restart (i==k) do a full reorthogonalization */
       PetscCall(BVGetColumn(U1,i,&u2));
       if (i>0) {
@@ -1050,7 +1261,8 @@ static PetscErrorCode SVDLanczosGUpper(SVD svd,PetscReal *alpha,PetscReal *beta,
       else PetscCall(VecScale(u2,1.0/alphah[i]));
     }
     PetscCall(BVRestoreColumn(U2,i,&u2));
-    if (!lanczos->oneside || i==k) PetscCall(BVOrthonormalizeColumn(U2,i,PETSC_FALSE,alphah+i,&lindep2));
+    if (lanczos->joint) PetscCall(SVDOrthonormalizeJoint(U1,U2,i,alpha+i,alphah+i,&lindep1,&lindep2));
+    else if (!lanczos->oneside || i==k) PetscCall(BVOrthonormalizeColumn(U2,i,PETSC_FALSE,alphah+i,&lindep2));
     if (i%2) alphah[i] = -alphah[i];
     if (PetscUnlikely(lindep1 || lindep2)) {
       lindep = PETSC_TRUE;
@@ -1633,6 +1845,12 @@ static PetscErrorCode SVDSetFromOptions_TRLanczos(SVD svd,PetscOptionItems *Pets
     PetscCall(PetscOptionsBool("-svd_trlanczos_oneside","Use one-side reorthogonalization","SVDTRLanczosSetOneSide",lanczos->oneside,&val,&flg));
     if (flg) PetscCall(SVDTRLanczosSetOneSide(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_trlanczos_selective","Use selective reorthogonalization in the one-sided variant","SVDTRLanczosSetSelective",lanczos->selective,&val,&flg));
+    if (flg) PetscCall(SVDTRLanczosSetSelective(svd,val));
+
+    PetscCall(PetscOptionsBool("-svd_trlanczos_storeu","Store the left basis during the iteration","SVDTRLanczosSetStoreU",lanczos->storeu,&val,&flg));
+    if (flg) PetscCall(SVDTRLanczosSetStoreU(svd,val));
+
     PetscCall(PetscOptionsReal("-svd_trlanczos_restart","Proportion of vectors kept after restart","SVDTRLanczosSetRestart",0.5,&keep,&flg));
     if (flg) PetscCall(SVDTRLanczosSetRestart(svd,keep));
 
@@ -1642,6 +1860,9 @@ static PetscErrorCode SVDSetFromOptions_TRLanczos(SVD svd,PetscOptionItems *Pets
     PetscCall(PetscOptionsEnum("-svd_trlanczos_gbidiag","Bidiagonalization choice for Generalized Problem","SVDTRLanczosSetGBidiag",SVDTRLanczosGBidiags,(PetscEnum)lanczos->bidiag,(PetscEnum*)&bidiag,&flg));
     if (flg) PetscCall(SVDTRLanczosSetGBidiag(svd,bidiag));
 
+    PetscCall(PetscOptionsBool("-svd_trlanczos_joint","Orthogonalize the two left bases jointly in the GSVD","SVDTRLanczosSetJoint",lanczos->joint,&val,&flg));
+    if (flg) PetscCall(SVDTRLanczosSetJoint(svd,val));
+
     PetscCall(PetscOptionsBool("-svd_trlanczos_explicitmatrix","Build explicit matrix for KSP solver","SVDTRLanczosSetExplicitMatrix",lanczos->explicitmatrix,&val,&flg));
     if (flg) PetscCall(SVDTRLanczosSetExplicitMatrix(svd,val));
 
@@ -1738,6 +1959,172 @@ PetscErrorCode SVDTRLanczosGetOneSide(SVD svd,PetscBool *oneside)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDTRLanczosSetSelective_TRLanczos(SVD svd,PetscBool selective)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (lanczos->selective != selective) {
+    lanczos->selective = selective;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosSetSelective - Indicate if the one-sided variant of the Lanczos
+   method must use selective reorthogonalization.
+
+   Logically Collective
+
+   Input Parameters:
++  svd       - singular value solver
+-  selective - boolean flag indicating if selective reorthogonalization is used
+
+   Options Database Key:
+.  -svd_trlanczos_selective <boolean> - Indicates the boolean flag
+
+   Notes:
+   By default, the one-sided variant orthogonalizes every right Lanczos vector
+   against all the previous ones. With selective reorthogonalization, the loss
+   of orthogonality is monitored with an inexpensive scalar recurrence, and a
+   vector is orthogonalized explicitly only when the estimate exceeds a
+   threshold, which saves most of the global reductions per iteration.
+
+   This option is relevant only in the one-sided variant, see
+   SVDTRLanczosSetOneSide().
+
+   Level: advanced
+
+.seealso: SVDTRLanczosGetSelective(), SVDTRLanczosSetOneSide()
+@*/
+PetscErrorCode SVDTRLanczosSetSelective(SVD svd,PetscBool selective)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,selective,2);
+  PetscTryMethod(svd,"SVDTRLanczosSetSelective_C",(SVD,PetscBool),(svd,selective));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosGetSelective_TRLanczos(SVD svd,PetscBool *selective)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *selective = lanczos->selective;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosGetSelective - Gets if the one-sided variant of the Lanczos
+   method uses selective reorthogonalization.
+
+   Not Collective
+
+   Input Parameters:
+.  svd       - singular value solver
+
+   Output Parameters:
+.  selective - boolean flag indicating if selective reorthogonalization is used
+
+   Level: advanced
+
+.seealso: SVDTRLanczosSetSelective()
+@*/
+PetscErrorCode SVDTRLanczosGetSelective(SVD svd,PetscBool *selective)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(selective,2);
+  PetscUseMethod(svd,"SVDTRLanczosGetSelective_C",(SVD,PetscBool*),(svd,selective));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosSetStoreU_TRLanczos(SVD svd,PetscBool storeu)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (lanczos->storeu != storeu) {
+    lanczos->storeu = storeu;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosSetStoreU - Indicate if the left Lanczos basis must be stored
+   during the iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  svd    - singular value solver
+-  storeu - boolean flag indicating if the left basis is stored
+
+   Options Database Key:
+.  -svd_trlanczos_storeu <boolean> - Indicates the boolean flag
+
+   Notes:
+   By default, the left Lanczos vectors are kept in a basis with as many
+   columns as the right one. For very tall matrices this basis dominates the
+   memory consumption of the solver. If the flag is set to false, only the
+   two most recent left vectors are kept in work vectors, and the converged
+   left singular vectors are regenerated from the right ones at the end of
+   the computation, at the cost of one extra matrix-vector product per
+   requested singular triplet.
+
+   This option requires the one-sided variant, see SVDTRLanczosSetOneSide(),
+   and is available only for the standard SVD problem.
+
+   Level: advanced
+
+.seealso: SVDTRLanczosGetStoreU(), SVDTRLanczosSetOneSide()
+@*/
+PetscErrorCode SVDTRLanczosSetStoreU(SVD svd,PetscBool storeu)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,storeu,2);
+  PetscTryMethod(svd,"SVDTRLanczosSetStoreU_C",(SVD,PetscBool),(svd,storeu));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosGetStoreU_TRLanczos(SVD svd,PetscBool *storeu)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *storeu = lanczos->storeu;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosGetStoreU - Gets if the left Lanczos basis is stored during
+   the iteration.
+
+   Not Collective
+
+   Input Parameters:
+.  svd    - singular value solver
+
+   Output Parameters:
+.  storeu - boolean flag indicating if the left basis is stored
+
+   Level: advanced
+
+.seealso: SVDTRLanczosSetStoreU()
+@*/
+PetscErrorCode SVDTRLanczosGetStoreU(SVD svd,PetscBool *storeu)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(storeu,2);
+  PetscUseMethod(svd,"SVDTRLanczosGetStoreU_C",(SVD,PetscBool*),(svd,storeu));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDTRLanczosSetGBidiag_TRLanczos(SVD svd,SVDTRLanczosGBidiag bidiag)
 {
   SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
@@ -1819,6 +2206,90 @@ PetscErrorCode SVDTRLanczosGetGBidiag(SVD svd,SVDTRLanczosGBidiag *bidiag)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDTRLanczosSetJoint_TRLanczos(SVD svd,PetscBool joint)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (lanczos->joint != joint) {
+    lanczos->joint = joint;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosSetJoint - Indicate if the two left Lanczos bases generated in
+   the GSVD are orthogonalized jointly.
+
+   Logically Collective
+
+   Input Parameters:
++  svd   - singular value solver
+-  joint - boolean flag indicating if joint orthogonalization must be used
+
+   Options Database Key:
+.  -svd_trlanczos_joint <boolean> - Indicates the boolean flag
+
+   Notes:
+   In the GSVD, each iteration of the Lanczos process must orthogonalize one
+   column of each of the two left bases. By default, this is done with two
+   independent sweeps, each of them performing its own global reductions. With
+   joint orthogonalization, both columns are processed together with a fused
+   classical Gram-Schmidt sweep whose inner products are accumulated in a
+   single reduction, halving the number of synchronization points. This is
+   most beneficial when running on a large number of MPI processes.
+
+   This option is used only in the GSVD, with the upper-upper bidiagonalization
+   variant and two-sided orthogonalization.
+
+   Level: advanced
+
+.seealso: SVDTRLanczosGetJoint(), SVDTRLanczosSetGBidiag(), SVDTRLanczosSetOneSide()
+@*/
+PetscErrorCode SVDTRLanczosSetJoint(SVD svd,PetscBool joint)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,joint,2);
+  PetscTryMethod(svd,"SVDTRLanczosSetJoint_C",(SVD,PetscBool),(svd,joint));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosGetJoint_TRLanczos(SVD svd,PetscBool *joint)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *joint = lanczos->joint;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosGetJoint - Gets if the two left Lanczos bases generated in the
+   GSVD are orthogonalized jointly.
+
+   Not Collective
+
+   Input Parameter:
+.  svd - singular value solver
+
+   Output Parameter:
+.  joint - the joint orthogonalization flag
+
+   Level: advanced
+
+.seealso: SVDTRLanczosSetJoint()
+@*/
+PetscErrorCode SVDTRLanczosGetJoint(SVD svd,PetscBool *joint)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(joint,2);
+  PetscUseMethod(svd,"SVDTRLanczosGetJoint_C",(SVD,PetscBool*),(svd,joint));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDTRLanczosSetKSP_TRLanczos(SVD svd,KSP ksp)
 {
   SVD_TRLANCZOS  *ctx = (SVD_TRLANCZOS*)svd->data;
@@ -2241,8 +2712,14 @@ static PetscErrorCode SVDDestroy_TRLanczos(SVD svd)
   PetscCall(PetscFree(svd->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetOneSide_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetOneSide_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetSelective_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetSelective_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetStoreU_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetStoreU_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetGBidiag_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetGBidiag_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetJoint_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetJoint_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetKSP_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetKSP_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetRestart_C",NULL));
@@ -2275,6 +2752,7 @@ static PetscErrorCode SVDView_TRLanczos(SVD svd,PetscViewer viewer)
         case SVD_TRLANCZOS_GBIDIAG_LOWER:  bidiag = "joint lower-upper"; break;
       }
       PetscCall(PetscViewerASCIIPrintf(viewer,"  bidiagonalization choice: %s\n",bidiag));
+      if (lanczos->joint) PetscCall(PetscViewerASCIIPrintf(viewer,"  using joint orthogonalization of the two left bases\n"));
       PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix\n",lanczos->explicitmatrix?"explicit":"implicit"));
       if (lanczos->scaleth==0) PetscCall(PetscViewerASCIIPrintf(viewer,"  scale factor for matrix B: %g\n",(double)lanczos->scalef));
       else PetscCall(PetscViewerASCIIPrintf(viewer,"  automatic scaling for matrix B with threshold: %g\n",(double)lanczos->scaleth));
@@ -2282,7 +2760,11 @@ static PetscErrorCode SVDView_TRLanczos(SVD svd,PetscViewer viewer)
       PetscCall(PetscViewerASCIIPushTab(viewer));
       PetscCall(KSPView(lanczos->ksp,viewer));
       PetscCall(PetscViewerASCIIPopTab(viewer));
-    } else PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
+    } else {
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
+      if (lanczos->oneside && lanczos->selective) PetscCall(PetscViewerASCIIPrintf(viewer,"  using selective reorthogonalization\n"));
+      if (!lanczos->storeu) PetscCall(PetscViewerASCIIPrintf(viewer,"  not storing the left basis during the iteration\n"));
+    }
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -2308,6 +2790,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_TRLanczos(SVD svd)
   svd->data = (void*)ctx;
 
   ctx->lock    = PETSC_TRUE;
+  ctx->storeu  = PETSC_TRUE;
   ctx->bidiag  = SVD_TRLANCZOS_GBIDIAG_LOWER;
   ctx->scalef  = 1.0;
   ctx->scaleth = 0.0;
@@ -2323,8 +2806,14 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_TRLanczos(SVD svd)
   svd->ops->setdstype      = SVDSetDSType_TRLanczos;
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetOneSide_C",SVDTRLanczosSetOneSide_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetOneSide_C",SVDTRLanczosGetOneSide_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetSelective_C",SVDTRLanczosSetSelective_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetSelective_C",SVDTRLanczosGetSelective_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetStoreU_C",SVDTRLanczosSetStoreU_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetStoreU_C",SVDTRLanczosGetStoreU_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetGBidiag_C",SVDTRLanczosSetGBidiag_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetGBidiag_C",SVDTRLanczosGetGBidiag_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetJoint_C",SVDTRLanczosSetJoint_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetJoint_C",SVDTRLanczosGetJoint_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetKSP_C",SVDTRLanczosSetKSP_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetKSP_C",SVDTRLanczosGetKSP_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetRestart_C",SVDTRLanczosSetRestart_TRLanczos));
@@ -63,8 +63,7 @@ PetscErrorCode SVDInitializePackage(void)
   PetscCall(PetscClassIdRegister("SVD Solver",&SVD_CLASSID));
   /* Register Constructors */
   PetscCall(SVDRegisterAll());
-  /* Register Monitors */
-  PetscCall(SVDMonitorRegisterAll());
+  /* Monitors are registered on demand, see SVDMonitorSetFromOptions() */
   /* Register Events */
   PetscCall(PetscLogEventRegister("SVDSetUp",SVD_CLASSID,&SVD_SetUp));
   PetscCall(PetscLogEventRegister("SVDSolve",SVD_CLASSID,&SVD_Solve));
@@ -107,6 +107,8 @@ PetscErrorCode SVDCreate(MPI_Comm comm,SVD *outsvd)
   svd->leftbasis        = PETSC_FALSE;
   svd->swapped          = PETSC_FALSE;
   svd->expltrans        = PETSC_FALSE;
+  svd->OPstate          = 0;
+  svd->OPbstate         = 0;
   svd->nrma             = 0.0;
   svd->nrmb             = 0.0;
   svd->isgeneralized    = PETSC_FALSE;
@@ -216,11 +216,13 @@ PetscErrorCode SVDSetDSType(SVD svd)
 @*/
 PetscErrorCode SVDSetUp(SVD svd)
 {
-  PetscBool      flg;
-  PetscInt       M,N,P=0,k,maxnsol;
-  SlepcSC        sc;
-  Vec            *T;
-  BV             bv;
+  PetscBool        flg,virt,reuse;
+  PetscInt         M,N,P=0,k,maxnsol;
+  SlepcSC          sc;
+  Vec              *T;
+  BV               bv;
+  Mat              aux;
+  PetscObjectState state;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
@@ -276,40 +278,60 @@ PetscErrorCode SVDSetUp(SVD svd)
     PetscCheck(M+P>=N,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The case when [A;B] has less rows than columns is not supported");
   }
 
-  /* build transpose matrix */
-  PetscCall(MatDestroy(&svd->A));
-  PetscCall(MatDestroy(&svd->AT));
-  PetscCall(PetscObjectReference((PetscObject)svd->OP));
-  if (svd->expltrans) {
-    if (svd->isgeneralized || M>=N) {
-      svd->A = svd->OP;
-      PetscCall(MatHermitianTranspose(svd->OP,MAT_INITIAL_MATRIX,&svd->AT));
-    } else {
-      PetscCall(MatHermitianTranspose(svd->OP,MAT_INITIAL_MATRIX,&svd->A));
-      svd->AT = svd->OP;
-    }
-  } else {
-    if (svd->isgeneralized || M>=N) {
-      svd->A = svd->OP;
-      PetscCall(MatCreateHermitianTranspose(svd->OP,&svd->AT));
+  /* build transpose matrix, reusing the one from a previous setup if it is still
+     valid, so that solvers can in turn keep the objects derived from it */
+  PetscCall(PetscObjectStateGet((PetscObject)svd->OP,&state));
+  aux = (svd->isgeneralized || M>=N)? svd->AT: svd->A;
+  if (aux && ((svd->isgeneralized || M>=N)? svd->A: svd->AT)==svd->OP) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)aux,MATHERMITIANTRANSPOSEVIRTUAL,&virt));
+    if (virt) reuse = svd->expltrans? PETSC_FALSE: PETSC_TRUE;  /* the virtual transpose is always up to date */
+    else reuse = (svd->expltrans && state==svd->OPstate)? PETSC_TRUE: PETSC_FALSE;
+  } else reuse = PETSC_FALSE;
+  if (!reuse) {
+    PetscCall(MatDestroy(&svd->A));
+    PetscCall(MatDestroy(&svd->AT));
+    PetscCall(PetscObjectReference((PetscObject)svd->OP));
+    if (svd->expltrans) {
+      if (svd->isgeneralized || M>=N) {
+        svd->A = svd->OP;
+        PetscCall(MatHermitianTranspose(svd->OP,MAT_INITIAL_MATRIX,&svd->AT));
+      } else {
+        PetscCall(MatHermitianTranspose(svd->OP,MAT_INITIAL_MATRIX,&svd->A));
+        svd->AT = svd->OP;
+      }
     } else {
-      PetscCall(MatCreateHermitianTranspose(svd->OP,&svd->A));
-      svd->AT = svd->OP;
+      if (svd->isgeneralized || M>=N) {
+        svd->A = svd->OP;
+        PetscCall(MatCreateHermitianTranspose(svd->OP,&svd->AT));
+      } else {
+        PetscCall(MatCreateHermitianTranspose(svd->OP,&svd->A));
+        svd->AT = svd->OP;
+      }
     }
   }
+  svd->OPstate = state;
 
   /* build transpose matrix B for GSVD */
   if (svd->isgeneralized) {
-    PetscCall(MatDestroy(&svd->B));
-    PetscCall(MatDestroy(&svd->BT));
-    PetscCall(PetscObjectReference((PetscObject)svd->OPb));
-    if (svd->expltrans) {
-      svd->B = svd->OPb;
-      PetscCall(MatHermitianTranspose(svd->OPb,MAT_INITIAL_MATRIX,&svd->BT));
-    } else {
-      svd->B = svd->OPb;
-      PetscCall(MatCreateHermitianTranspose(svd->OPb,&svd->BT));
+    PetscCall(PetscObjectStateGet((PetscObject)svd->OPb,&state));
+    if (svd->BT && svd->B==svd->OPb) {
+      PetscCall(PetscObjectTypeCompare((PetscObject)svd->BT,MATHERMITIANTRANSPOSEVIRTUAL,&virt));
+      if (virt) reuse = svd->expltrans? PETSC_FALSE: PETSC_TRUE;
+      else reuse = (svd->expltrans && state==svd->OPbstate)? PETSC_TRUE: PETSC_FALSE;
+    } else reuse = PETSC_FALSE;
+    if (!reuse) {
+      PetscCall(MatDestroy(&svd->B));
+      PetscCall(MatDestroy(&svd->BT));
+      PetscCall(PetscObjectReference((PetscObject)svd->OPb));
+      if (svd->expltrans) {
+        svd->B = svd->OPb;
+        PetscCall(MatHermitianTranspose(svd->OPb,MAT_INITIAL_MATRIX,&svd->BT));
+      } else {
+        svd->B = svd->OPb;
+        PetscCall(MatCreateHermitianTranspose(svd->OPb,&svd->BT));
+      }
     }
+    svd->OPbstate = state;
   }
 
   if (!svd->isgeneralized && M<N) {
@@ -0,0 +1,154 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   SVD routines for updating a computed solution when the matrix grows
+*/
+
+#include <slepc/private/svdimpl.h>       /*I "slepcsvd.h" I*/
+
+/*@
+   SVDUpdateRows - Updates the computed partial SVD after new rows have been
+   appended to the problem matrix.
+
+   Collective
+
+   Input Parameters:
++  svd - the singular value solver context, with a solution computed by SVDSolve()
+-  R   - a matrix whose rows are the rows appended to the problem matrix
+
+   Notes:
+   Given the partial singular value decomposition computed by the last call to
+   SVDSolve() for a matrix A, this function computes the decomposition of the
+   extended matrix obtained by appending the rows of R below A, without solving
+   from scratch. This is done with an additive rank update in the style of
+   Brand's method: the appended rows are projected onto the current right
+   singular subspace, the subspace is enlarged with the orthogonal complement
+   of the rows, and a dense singular value problem of order nconv+p is solved,
+   where p is the number of rows of R. The cost is p applications of the
+   transpose of R plus the dense solve, so the batch of appended rows should be
+   of moderate size. The function can be called repeatedly, once per batch.
+
+   The result is exact up to the truncation error of the previously computed
+   decomposition, since the discarded singular triplets are not available for
+   the update. Hence, accuracy may degrade slowly after many successive updates.
+
+   Only the singular values and the right singular vectors are updated. The
+   left singular vectors of the extended matrix have more rows than those of A,
+   so they cannot be stored in the solver context; they must be recomputed by
+   the caller if needed. The matrix given with SVDSetOperators() is not
+   modified either, so calling SVDSolve() afterwards will solve the original
+   problem, discarding the updates.
+
+   The number of columns of R must be equal to that of the problem matrix, with
+   the same parallel layout. This function is only available for the standard
+   SVD problem.
+
+   Level: intermediate
+
+.seealso: SVDSolve(), SVDGetSingularTriplet(), SVDGetConverged(), SVDSetOperators()
+@*/
+PetscErrorCode SVDUpdateRows(SVD svd,Mat R)
+{
+  DS             ds;
+  BV             W;
+  SlepcSC        sc;
+  Vec            b,x,col;
+  Mat            Vt;
+  PetscScalar    *M,*w,*h;
+  PetscReal      norm;
+  PetscBool      lindep;
+  PetscInt       i,j,k,p,total,ld,n,nloc,rloc,rstart,rend,N;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidHeaderSpecific(R,MAT_CLASSID,2);
+  PetscCheckSameComm(svd,1,R,2);
+  SVDCheckSolved(svd,1);
+  PetscCheck(!svd->isgeneralized && !svd->ishyperbolic,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Row updating is only available for the standard SVD");
+  PetscCheck(svd->nconv>0,PetscObjectComm((PetscObject)svd),PETSC_ERR_ORDER,"No singular triplets available, the solver did not converge");
+  PetscCall(MatGetSize(R,&p,&n));
+  PetscCall(MatGetSize(svd->OP,NULL,&N));
+  PetscCheck(n==N,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"The appended rows have %" PetscInt_FMT " columns, but the problem matrix has %" PetscInt_FMT,n,N);
+  PetscCall(MatCreateVecs(R,&x,&b));
+  PetscCall(VecGetLocalSize(x,&rloc));
+  PetscCall(BVGetSizes(svd->V,&nloc,NULL,NULL));
+  PetscCheck(rloc==nloc,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"The column layout of the appended rows does not match that of the problem matrix");
+  PetscCall(SVDComputeVectors(svd));
+
+  k = svd->nconv;
+  total = k+p;
+
+  /* enlarged basis W = [ V Q ], Q spans the rows of R not in the range of V */
+  PetscCall(BVDuplicateResize(svd->V,total,&W));
+  PetscCall(BVSetActiveColumns(svd->V,0,k));
+  PetscCall(BVSetActiveColumns(W,0,k));
+  PetscCall(BVCopy(svd->V,W));
+
+  /* middle matrix M = [ diag(sigma) 0; C L ], where row i of [C L] holds the
+     coefficients of the i-th appended row in the basis W */
+  PetscCall(DSCreate(PetscObjectComm((PetscObject)svd),&ds));
+  PetscCall(DSSetType(ds,DSSVD));
+  PetscCall(DSAllocate(ds,total));
+  PetscCall(DSSetDimensions(ds,total,0,0));
+  PetscCall(DSSVDSetDimensions(ds,total));
+  PetscCall(DSGetLeadingDimension(ds,&ld));
+  PetscCall(PetscMalloc2(total,&w,total,&h));
+  PetscCall(DSGetArray(ds,DS_MAT_A,&M));
+  for (i=0;i<k;i++) M[i+i*ld] = svd->sigma[i];
+  PetscCall(VecGetOwnershipRange(b,&rstart,&rend));
+  for (i=0;i<p;i++) {
+    PetscCall(VecSet(b,0.0));
+    if (i>=rstart && i<rend) PetscCall(VecSetValue(b,i,1.0,INSERT_VALUES));
+    PetscCall(VecAssemblyBegin(b));
+    PetscCall(VecAssemblyEnd(b));
+    PetscCall(BVGetColumn(W,k+i,&col));
+#if defined(PETSC_USE_COMPLEX)
+    PetscCall(MatMultHermitianTranspose(R,b,col));
+#else
+    PetscCall(MatMultTranspose(R,b,col));
+#endif
+    PetscCall(BVRestoreColumn(W,k+i,&col));
+    PetscCall(BVOrthogonalizeColumn(W,k+i,h,&norm,&lindep));
+    for (j=0;j<k+i;j++) M[k+i+j*ld] = PetscConj(h[j]);
+    if (PetscUnlikely(lindep)) PetscCall(BVOrthonormalizeColumn(W,k+i,PETSC_TRUE,NULL,NULL));
+    else {
+      M[k+i+(k+i)*ld] = norm;
+      PetscCall(BVScaleColumn(W,k+i,1.0/norm));
+    }
+  }
+  PetscCall(DSRestoreArray(ds,DS_MAT_A,&M));
+  PetscCall(DSSetState(ds,DS_STATE_RAW));
+  PetscCall(DSGetSlepcSC(ds,&sc));
+  sc->comparison    = (svd->which==SVD_LARGEST)? SlepcCompareLargestReal: SlepcCompareSmallestReal;
+  sc->comparisonctx = NULL;
+  PetscCall(DSSolve(ds,w,NULL));
+  PetscCall(DSSort(ds,w,NULL,NULL,NULL,NULL));
+  PetscCall(DSSynchronize(ds,w,NULL));
+
+  /* update the singular values and right singular vectors, truncating back to nconv */
+  PetscCall(DSGetMat(ds,DS_MAT_V,&Vt));
+  PetscCall(BVSetActiveColumns(W,0,total));
+  PetscCall(BVMultInPlace(W,Vt,0,k));
+  PetscCall(DSRestoreMat(ds,DS_MAT_V,&Vt));
+  PetscCall(BVSetActiveColumns(W,0,k));
+  PetscCall(BVCopy(W,svd->V));
+  for (i=0;i<k;i++) {
+    svd->sigma[i] = PetscRealPart(w[i]);
+    svd->perm[i]  = i;
+  }
+  svd->state = SVD_STATE_VECTORS;
+
+  PetscCall(PetscFree2(w,h));
+  PetscCall(DSDestroy(&ds));
+  PetscCall(BVDestroy(&W));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&b));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
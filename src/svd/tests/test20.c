@@ -0,0 +1,125 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test updating a computed SVD with appended rows.\n\n"
+  "The full SVD of a matrix is computed, then two batches of rows are appended\n"
+  "with SVDUpdateRows, and the result is compared against a from-scratch solve\n"
+  "of the extended matrix.\n\n";
+
+#include <slepcsvd.h>
+
+/*
+   Entry (i,j) of the test matrix; the diagonal shift makes all singular
+   values well separated, so singular vectors can be compared one by one
+*/
+static inline PetscScalar MatEntry(PetscInt i,PetscInt j)
+{
+  return PetscSinReal((i+1.0)*(j+1.0)) + (i==j? j+1.0: 0.0);
+}
+
+/*
+   Builds a matrix with rows i0..i1-1 of the test matrix, with n columns
+*/
+PetscErrorCode BuildMatrix(PetscInt i0,PetscInt i1,PetscInt n,Mat *A)
+{
+  PetscInt    i,j,Istart,Iend;
+  PetscScalar val;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatCreate(PETSC_COMM_WORLD,A));
+  PetscCall(MatSetSizes(*A,PETSC_DECIDE,PETSC_DECIDE,i1-i0,n));
+  PetscCall(MatSetFromOptions(*A));
+  PetscCall(MatSetUp(*A));
+  PetscCall(MatGetOwnershipRange(*A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    for (j=0;j<n;j++) {
+      val = MatEntry(i0+i,j);
+      PetscCall(MatSetValue(*A,i,j,val,INSERT_VALUES));
+    }
+  }
+  PetscCall(MatAssemblyBegin(*A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(*A,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A,R1,R2,Aext;
+  SVD            svd,svdext;
+  Vec            v,vext;
+  PetscScalar    dot;
+  PetscReal      sigma,sigmaext,tol=PetscMax(1000*PETSC_MACHINE_EPSILON,1e-9);
+  PetscInt       m=12,n=8,p1=2,p2=3,i,nconv;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nSVD row-update test, initial matrix %" PetscInt_FMT "x%" PetscInt_FMT ", appending %" PetscInt_FMT "+%" PetscInt_FMT " rows\n\n",m,n,p1,p2));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Compute the full SVD of A, then append two batches of rows
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(BuildMatrix(0,m,n,&A));
+  PetscCall(SVDCreate(PETSC_COMM_WORLD,&svd));
+  PetscCall(SVDSetOperators(svd,A,NULL));
+  PetscCall(SVDSetType(svd,SVDLAPACK));
+  PetscCall(SVDSetDimensions(svd,n,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(SVDSetFromOptions(svd));
+  PetscCall(SVDSolve(svd));
+  PetscCall(SVDGetConverged(svd,&nconv));
+  PetscCheck(nconv>=n,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"The initial solve did not compute the full SVD");
+
+  PetscCall(BuildMatrix(m,m+p1,n,&R1));
+  PetscCall(SVDUpdateRows(svd,R1));
+  PetscCall(BuildMatrix(m+p1,m+p1+p2,n,&R2));
+  PetscCall(SVDUpdateRows(svd,R2));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Solve the extended matrix from scratch and compare
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(BuildMatrix(0,m+p1+p2,n,&Aext));
+  PetscCall(SVDCreate(PETSC_COMM_WORLD,&svdext));
+  PetscCall(SVDSetOperators(svdext,Aext,NULL));
+  PetscCall(SVDSetType(svdext,SVDLAPACK));
+  PetscCall(SVDSetDimensions(svdext,n,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(SVDSetFromOptions(svdext));
+  PetscCall(SVDSolve(svdext));
+
+  PetscCall(MatCreateVecs(A,&v,NULL));
+  PetscCall(MatCreateVecs(Aext,&vext,NULL));
+  for (i=0;i<n;i++) {
+    PetscCall(SVDGetSingularTriplet(svd,i,&sigma,NULL,v));
+    PetscCall(SVDGetSingularTriplet(svdext,i,&sigmaext,NULL,vext));
+    if (PetscAbsReal(sigma-sigmaext)>100*tol*sigmaext) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Singular value %" PetscInt_FMT " differs from the from-scratch solve: %g vs %g\n",i,(double)sigma,(double)sigmaext));
+    /* right vectors are unique up to a unimodular factor, compare |v'*vext| */
+    PetscCall(VecDot(v,vext,&dot));
+    if (PetscAbsReal(PetscAbsScalar(dot)-(PetscReal)1.0)>100*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Right singular vector %" PetscInt_FMT " differs from the from-scratch solve: |v'*vext|=%g\n",i,(double)PetscAbsScalar(dot)));
+  }
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Updated decomposition matches the from-scratch solve\n"));
+
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&vext));
+  PetscCall(SVDDestroy(&svd));
+  PetscCall(SVDDestroy(&svdext));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&R1));
+  PetscCall(MatDestroy(&R2));
+  PetscCall(MatDestroy(&Aext));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      nsize: {{1 2}}
+      requires: !single
+
+TEST*/
@@ -128,6 +128,9 @@ int main(int argc,char **argv)
       test:
          suffix: 1_lanczos_one
          args: -svd_type lanczos -svd_lanczos_oneside
+      test:
+         suffix: 1_lanczos_pipelined
+         args: -svd_type lanczos -svd_lanczos_pipelined
       test:
          suffix: 1_trlanczos
          args: -svd_type trlanczos -svd_trlanczos_locking {{0 1}}
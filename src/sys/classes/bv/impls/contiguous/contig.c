@@ -215,6 +215,29 @@ static PetscErrorCode BVCopyColumn_Contiguous(BV V,PetscInt j,PetscInt i)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Allocate the contiguous column buffer, zeroed out. If OpenMP is enabled,
+   the pages are touched in parallel with a static schedule, so that with a
+   first-touch NUMA policy they end up close to the threads that will later
+   traverse them in the threaded BLAS kernels.
+*/
+static PetscErrorCode BVAllocateArray_Contiguous(BV bv,PetscInt m,PetscScalar **array)
+{
+#if defined(_OPENMP)
+  PetscInt       i,n=m*bv->ld;
+#endif
+
+  PetscFunctionBegin;
+#if defined(_OPENMP)
+  PetscCall(PetscMalloc1(n,array));
+  #pragma omp parallel for schedule(static)
+  for (i=0;i<n;i++) (*array)[i] = 0.0;
+#else
+  PetscCall(PetscCalloc1(m*bv->ld,array));
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode BVResize_Contiguous(BV bv,PetscInt m,PetscBool copy)
 {
   BV_CONTIGUOUS  *ctx = (BV_CONTIGUOUS*)bv->data;
@@ -225,7 +248,7 @@ static PetscErrorCode BVResize_Contiguous(BV bv,PetscInt m,PetscBool copy)
 
   PetscFunctionBegin;
   PetscCall(PetscLayoutGetBlockSize(bv->map,&bs));
-  PetscCall(PetscCalloc1(m*bv->ld,&newarray));
+  PetscCall(BVAllocateArray_Contiguous(bv,m,&newarray));
   PetscCall(PetscMalloc1(m,&newV));
   for (j=0;j<m;j++) {
     if (ctx->mpi) PetscCall(VecCreateMPIWithArray(PetscObjectComm((PetscObject)bv),bs,bv->n,PETSC_DECIDE,newarray+j*bv->ld,newV+j));
@@ -364,7 +387,7 @@ SLEPC_EXTERN PetscErrorCode BVCreate_Contiguous(BV bv)
     ctx->array = (bv->issplit==1)? array: array+lsplit*bv->ld;
   } else {
     /* regular BV: allocate memory and Vecs for the BV entries */
-    PetscCall(PetscCalloc1(bv->m*bv->ld,&ctx->array));
+    PetscCall(BVAllocateArray_Contiguous(bv,bv->m,&ctx->array));
     PetscCall(PetscMalloc1(bv->m,&ctx->V));
     for (j=0;j<bv->m;j++) {
       if (ctx->mpi) PetscCall(VecCreateMPIWithArray(PetscObjectComm((PetscObject)bv),bs,nloc,PETSC_DECIDE,ctx->array+j*bv->ld,ctx->V+j));
@@ -62,7 +62,7 @@ PetscErrorCode BVMultVec_BLAS_CUDA(BV,PetscInt n_,PetscInt k_,PetscScalar alpha,
 /*
     A(:,s:e-1) := A*B(:,s:e-1)
 */
-PetscErrorCode BVMultInPlace_BLAS_CUDA(BV,PetscInt m_,PetscInt k_,PetscInt s,PetscInt e,PetscScalar *d_A,PetscInt lda_,const PetscScalar *d_B,PetscInt ldb_,PetscBool btrans)
+PetscErrorCode BVMultInPlace_BLAS_CUDA(BV bv,PetscInt m_,PetscInt k_,PetscInt s,PetscInt e,PetscScalar *d_A,PetscInt lda_,const PetscScalar *d_B,PetscInt ldb_,PetscBool btrans)
 {
   const PetscScalar *d_B1;
   PetscScalar       *d_work,sone=1.0,szero=0.0;
@@ -86,15 +86,19 @@ PetscErrorCode BVMultInPlace_BLAS_CUDA(BV,PetscInt m_,PetscInt k_,PetscInt s,Pet
     d_B1 = d_B+s*ldb;
     bt   = CUBLAS_OP_N;
   }
-  /* try to allocate the whole matrix */
-  PetscCallCUDA(cudaMemGetInfo(&freemem,&totmem));
-  if (freemem>=lda*n*sizeof(PetscScalar)) {
-    PetscCallCUDA(cudaMalloc((void**)&d_work,lda*n*sizeof(PetscScalar)));
+  /* check if the workspace can hold the whole matrix, querying the free
+     device memory only when the cached workspace is too small */
+  if (bv->d_lwork<(PetscInt)lda*n) {
+    PetscCallCUDA(cudaMemGetInfo(&freemem,&totmem));
+    if (freemem>=lda*n*sizeof(PetscScalar)) PetscCall(BV_AllocateWorkCUDA(bv,(PetscInt)lda*n));
+  }
+  if (bv->d_lwork>=(PetscInt)lda*n) {
+    d_work = bv->d_work;
     PetscCallCUBLAS(cublasXgemm(cublasv2handle,CUBLAS_OP_N,bt,m,n,k,&sone,d_A,lda,d_B1,ldb,&szero,d_work,lda));
     PetscCallCUDA(cudaMemcpy2D(d_A+s*lda,lda*sizeof(PetscScalar),d_work,lda*sizeof(PetscScalar),m*sizeof(PetscScalar),n,cudaMemcpyDeviceToDevice));
   } else {
     PetscCall(PetscCuBLASIntCast(freemem/(m*sizeof(PetscScalar)),&bs));
-    PetscCallCUDA(cudaMalloc((void**)&d_work,bs*n*sizeof(PetscScalar)));
+    PetscCallCUDA(SlepcDeviceMallocAsync(&d_work,bs*n*sizeof(PetscScalar)));
     PetscCall(PetscCuBLASIntCast(m % bs,&l));
     if (l) {
       PetscCallCUBLAS(cublasXgemm(cublasv2handle,CUBLAS_OP_N,bt,l,n,k,&sone,d_A,lda,d_B1,ldb,&szero,d_work,l));
@@ -104,9 +108,9 @@ PetscErrorCode BVMultInPlace_BLAS_CUDA(BV,PetscInt m_,PetscInt k_,PetscInt s,Pet
       PetscCallCUBLAS(cublasXgemm(cublasv2handle,CUBLAS_OP_N,bt,bs,n,k,&sone,d_A+l,lda,d_B1,ldb,&szero,d_work,bs));
       PetscCallCUDA(cudaMemcpy2D(d_A+l+s*lda,lda*sizeof(PetscScalar),d_work,bs*sizeof(PetscScalar),bs*sizeof(PetscScalar),n,cudaMemcpyDeviceToDevice));
     }
+    PetscCallCUDA(SlepcDeviceFreeAsync(d_work));
   }
   PetscCall(PetscLogGpuTimeEnd());
-  PetscCallCUDA(cudaFree(d_work));
   PetscCall(PetscLogGpuFlops(2.0*m*n*k));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -153,7 +157,8 @@ PetscErrorCode BVDot_BLAS_CUDA(BV bv,PetscInt m_,PetscInt n_,PetscInt k_,const P
   PetscCall(PetscCuBLASIntCast(lda_,&lda));
   PetscCall(PetscCuBLASIntCast(ldb_,&ldb));
   PetscCall(PetscCuBLASIntCast(ldc_,&ldc));
-  PetscCallCUDA(cudaMalloc((void**)&d_work,m*n*sizeof(PetscScalar)));
+  PetscCall(BV_AllocateWorkCUDA(bv,m*n));
+  d_work = bv->d_work;
   if (mpi) {
     if (ldc==m) {
       PetscCall(BVAllocateWork_Private(bv,m*n));
@@ -191,7 +196,6 @@ PetscErrorCode BVDot_BLAS_CUDA(BV bv,PetscInt m_,PetscInt n_,PetscInt k_,const P
       for (j=0;j<n;j++) PetscCall(PetscArraycpy(C+j*ldc,bv->work+j*m,m));
     }
   }
-  PetscCallCUDA(cudaFree(d_work));
   PetscCall(PetscLogGpuFlops(2.0*m*n*k));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -214,7 +218,10 @@ PetscErrorCode BVDotVec_BLAS_CUDA(BV bv,PetscInt n_,PetscInt k_,const PetscScala
   PetscCall(PetscCuBLASIntCast(k_,&k));
   PetscCall(PetscCuBLASIntCast(lda_,&lda));
   if (!y) PetscCall(VecCUDAGetArrayWrite(bv->buffer,&d_work));
-  else PetscCallCUDA(cudaMalloc((void**)&d_work,k*sizeof(PetscScalar)));
+  else {
+    PetscCall(BV_AllocateWorkCUDA(bv,k));
+    d_work = bv->d_work;
+  }
   if (mpi) {
     PetscCall(BVAllocateWork_Private(bv,k));
     if (n) {
@@ -232,7 +239,7 @@ PetscErrorCode BVDotVec_BLAS_CUDA(BV bv,PetscInt n_,PetscInt k_,const PetscScala
     if (!y) {
       PetscCall(VecCUDARestoreArrayWrite(bv->buffer,&d_work));
       PetscCall(VecGetArray(bv->buffer,&yy));
-    } else PetscCallCUDA(cudaFree(d_work));
+    }
     PetscCall(PetscMPIIntCast(k,&len));
     PetscCall(MPIU_Allreduce(bv->work,yy,len,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
   } else {
@@ -250,7 +257,6 @@ PetscErrorCode BVDotVec_BLAS_CUDA(BV bv,PetscInt n_,PetscInt k_,const PetscScala
     else {
       PetscCallCUDA(cudaMemcpy(y,d_work,k*sizeof(PetscScalar),cudaMemcpyDeviceToHost));
       PetscCall(PetscLogGpuToCpu(k*sizeof(PetscScalar)));
-      PetscCallCUDA(cudaFree(d_work));
     }
   }
   PetscCall(PetscLogGpuFlops(2.0*n*k));
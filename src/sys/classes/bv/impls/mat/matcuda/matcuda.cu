@@ -55,7 +55,8 @@ PetscErrorCode BVMultVec_Mat_CUDA(BV X,PetscScalar alpha,PetscScalar beta,Vec y,
   if (!q) PetscCall(VecCUDAGetArray(X->buffer,&d_q));
   else {
     PetscInt k=X->k-X->l;
-    PetscCallCUDA(cudaMalloc((void**)&d_q,k*sizeof(PetscScalar)));
+    PetscCall(BV_AllocateWorkCUDA(X,k));
+    d_q = X->d_work;
     PetscCallCUDA(cudaMemcpy(d_q,q,k*sizeof(PetscScalar),cudaMemcpyHostToDevice));
     PetscCall(PetscLogCpuToGpu(k*sizeof(PetscScalar)));
   }
@@ -64,7 +65,6 @@ PetscErrorCode BVMultVec_Mat_CUDA(BV X,PetscScalar alpha,PetscScalar beta,Vec y,
   if (beta==(PetscScalar)0.0) PetscCall(VecCUDARestoreArrayWrite(y,&d_py));
   else PetscCall(VecCUDARestoreArray(y,&d_py));
   if (!q) PetscCall(VecCUDARestoreArray(X->buffer,&d_q));
-  else PetscCallCUDA(cudaFree(d_q));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -21,6 +21,7 @@ typedef struct {
   PetscScalar *sw;      /* work space */
   PetscInt    d;        /* degree of the tensor BV */
   PetscInt    ld;       /* leading dimension of a single block in S */
+  PetscReal   ctol;     /* relative tolerance for rank truncation in BVTensorCompress */
   PetscInt    puk;      /* copy of the k value */
   Vec         u;        /* auxiliary work vector */
 } BV_TENSOR;
@@ -450,7 +451,8 @@ static PetscErrorCode BVTensorCompress_Tensor(BV V,PetscInt newc)
 #endif
   SlepcCheckLapackInfo("gesvd",info);
   PetscCall(PetscFPTrapPop());
-  tol = PetscMax(rs1,deg*cs1)*PETSC_MACHINE_EPSILON*sg[0];
+  if (ctx->ctol>0.0) tol = ctx->ctol*sg[0];
+  else tol = PetscMax(rs1,deg*cs1)*PETSC_MACHINE_EPSILON*sg[0];
   rk = 0;
   for (i=0;i<PetscMin(nrow,nnctdeg);i++) if (sg[i]>tol) rk++;
   rk = PetscMin(nnc+deg-1,rk);
@@ -570,6 +572,87 @@ PetscErrorCode BVTensorCompress(BV V,PetscInt newc)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode BVTensorSetCompressTolerance_Tensor(BV bv,PetscReal tol)
+{
+  BV_TENSOR *ctx = (BV_TENSOR*)bv->data;
+
+  PetscFunctionBegin;
+  if (tol == (PetscReal)PETSC_DEFAULT || tol == (PetscReal)PETSC_DECIDE) ctx->ctol = 0.0;
+  else {
+    PetscCheck(tol>=0.0,PetscObjectComm((PetscObject)bv),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be nonnegative");
+    ctx->ctol = tol;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   BVTensorSetCompressTolerance - Sets the tolerance used to truncate the rank
+   during BVTensorCompress().
+
+   Logically Collective
+
+   Input Parameters:
++  bv  - the tensor basis vectors context
+-  tol - the relative truncation tolerance
+
+   Notes:
+   During compression, singular values of the low-rank matrix that are smaller
+   than tol times the largest singular value are discarded. A larger tolerance
+   results in more aggressive truncation, and hence fewer retained columns of
+   the U factor, at the cost of a less accurate representation. Use
+   PETSC_DEFAULT to restore the default value, which scales the machine
+   precision by the dimension of the factor.
+
+   Level: advanced
+
+.seealso: BVTensorCompress(), BVTensorGetCompressTolerance()
+@*/
+PetscErrorCode BVTensorSetCompressTolerance(BV bv,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(bv,BV_CLASSID,1);
+  PetscValidLogicalCollectiveReal(bv,tol,2);
+  PetscTryMethod(bv,"BVTensorSetCompressTolerance_C",(BV,PetscReal),(bv,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode BVTensorGetCompressTolerance_Tensor(BV bv,PetscReal *tol)
+{
+  BV_TENSOR *ctx = (BV_TENSOR*)bv->data;
+
+  PetscFunctionBegin;
+  *tol = ctx->ctol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   BVTensorGetCompressTolerance - Returns the tolerance used to truncate the
+   rank during BVTensorCompress().
+
+   Not Collective
+
+   Input Parameter:
+.  bv - the basis vectors context
+
+   Output Parameter:
+.  tol - the relative truncation tolerance
+
+   Note:
+   A value of zero indicates that the default tolerance is being used.
+
+   Level: advanced
+
+.seealso: BVTensorCompress(), BVTensorSetCompressTolerance()
+@*/
+PetscErrorCode BVTensorGetCompressTolerance(BV bv,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(bv,BV_CLASSID,1);
+  PetscAssertPointer(tol,2);
+  PetscUseMethod(bv,"BVTensorGetCompressTolerance_C",(BV,PetscReal*),(bv,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode BVTensorGetDegree_Tensor(BV bv,PetscInt *d)
 {
   BV_TENSOR *ctx = (BV_TENSOR*)bv->data;
@@ -706,6 +789,8 @@ static PetscErrorCode BVDestroy_Tensor(BV bv)
   PetscCall(PetscFree(bv->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorBuildFirstColumn_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorCompress_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorSetCompressTolerance_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetCompressTolerance_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetDegree_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetFactors_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorRestoreFactors_C",NULL));
@@ -733,6 +818,8 @@ SLEPC_EXTERN PetscErrorCode BVCreate_Tensor(BV bv)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorBuildFirstColumn_C",BVTensorBuildFirstColumn_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorCompress_C",BVTensorCompress_Tensor));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorSetCompressTolerance_C",BVTensorSetCompressTolerance_Tensor));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetCompressTolerance_C",BVTensorGetCompressTolerance_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetDegree_C",BVTensorGetDegree_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetFactors_C",BVTensorGetFactors_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorRestoreFactors_C",BVTensorRestoreFactors_Tensor));
@@ -811,5 +898,7 @@ PetscErrorCode BVCreateTensor(BV U,PetscInt d,BV *V)
   (*V)->orthog_block = U->orthog_block;
   (*V)->vmm          = U->vmm;
   (*V)->rrandom      = U->rrandom;
+  (*V)->rctr         = U->rctr;
+  (*V)->deterministic = U->deterministic;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
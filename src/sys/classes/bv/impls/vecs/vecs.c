@@ -14,10 +14,12 @@
 #include <slepc/private/bvimpl.h>
 
 typedef struct {
-  Vec      *V;
-  PetscInt vmip;   /* Version of BVMultInPlace:
+  Vec         *V;
+  PetscInt    vmip;   /* Version of BVMultInPlace:
        0: memory-efficient version, uses VecGetArray (default in CPU)
        1: version that allocates (e-s) work vectors in every call (default in GPU) */
+  PetscScalar *wa,*ra;      /* staging buffers reused by BVGetArray/BVGetArrayRead */
+  PetscInt    walen,ralen;  /* allocated length of the staging buffers */
 } BV_VECS;
 
 static PetscErrorCode BVMult_Vecs(BV Y,PetscScalar alpha,PetscScalar beta,BV X,Mat Q)
@@ -162,7 +164,9 @@ static PetscErrorCode BVDot_Vecs(BV X,BV Y,Mat M)
   PetscFunctionBegin;
   PetscCall(MatDenseGetLDA(M,&ldm));
   PetscCall(MatDenseGetArray(M,&m));
-  for (j=X->l;j<X->k;j++) PetscCall(VecMDot(x->V[X->nc+j],Y->k-Y->l,y->V+Y->nc+Y->l,m+j*ldm+Y->l));
+  /* split-phase so that the dot products of all columns share a single reduction */
+  for (j=X->l;j<X->k;j++) PetscCall(VecMDotBegin(x->V[X->nc+j],Y->k-Y->l,y->V+Y->nc+Y->l,m+j*ldm+Y->l));
+  for (j=X->l;j<X->k;j++) PetscCall(VecMDotEnd(x->V[X->nc+j],Y->k-Y->l,y->V+Y->nc+Y->l,m+j*ldm+Y->l));
   PetscCall(MatDenseRestoreArray(M,&m));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -374,7 +378,12 @@ static PetscErrorCode BVGetArray_Vecs(BV bv,PetscScalar **a)
   const PetscScalar *p;
 
   PetscFunctionBegin;
-  PetscCall(PetscMalloc1((bv->nc+bv->m)*bv->n,a));
+  if (ctx->walen<(bv->nc+bv->m)*bv->n) {  /* grow the cached staging buffer if needed */
+    PetscCall(PetscFree(ctx->wa));
+    ctx->walen = (bv->nc+bv->m)*bv->n;
+    PetscCall(PetscMalloc1(ctx->walen,&ctx->wa));
+  }
+  *a = ctx->wa;
   for (j=0;j<bv->nc+bv->m;j++) {
     PetscCall(VecGetArrayRead(ctx->V[j],&p));
     PetscCall(PetscArraycpy(*a+j*bv->n,p,bv->n));
@@ -395,7 +404,7 @@ static PetscErrorCode BVRestoreArray_Vecs(BV bv,PetscScalar **a)
     PetscCall(PetscArraycpy(p,*a+j*bv->n,bv->n));
     PetscCall(VecRestoreArray(ctx->V[j],&p));
   }
-  PetscCall(PetscFree(*a));
+  *a = NULL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -406,7 +415,12 @@ static PetscErrorCode BVGetArrayRead_Vecs(BV bv,const PetscScalar **a)
   const PetscScalar *p;
 
   PetscFunctionBegin;
-  PetscCall(PetscMalloc1((bv->nc+bv->m)*bv->n,(PetscScalar**)a));
+  if (ctx->ralen<(bv->nc+bv->m)*bv->n) {  /* grow the cached staging buffer if needed */
+    PetscCall(PetscFree(ctx->ra));
+    ctx->ralen = (bv->nc+bv->m)*bv->n;
+    PetscCall(PetscMalloc1(ctx->ralen,&ctx->ra));
+  }
+  *a = ctx->ra;
   for (j=0;j<bv->nc+bv->m;j++) {
     PetscCall(VecGetArrayRead(ctx->V[j],&p));
     PetscCall(PetscArraycpy((PetscScalar*)*a+j*bv->n,p,bv->n));
@@ -418,7 +432,7 @@ static PetscErrorCode BVGetArrayRead_Vecs(BV bv,const PetscScalar **a)
 static PetscErrorCode BVRestoreArrayRead_Vecs(BV bv,const PetscScalar **a)
 {
   PetscFunctionBegin;
-  PetscCall(PetscFree(*a));
+  *a = NULL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -486,6 +500,8 @@ static PetscErrorCode BVDestroy_Vecs(BV bv)
 
   PetscFunctionBegin;
   if (!bv->issplit) PetscCall(VecDestroyVecs(bv->nc+bv->m,&ctx->V));
+  PetscCall(PetscFree(ctx->wa));
+  PetscCall(PetscFree(ctx->ra));
   PetscCall(PetscFree(bv->data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -539,7 +555,7 @@ SLEPC_EXTERN PetscErrorCode BVCreate_Vecs(BV bv)
   }
 
   /* Default version of BVMultInPlace */
-  PetscCall(PetscStrcmpAny(bv->vtype,&isgpu,VECSEQCUDA,VECMPICUDA,""));
+  PetscCall(PetscStrcmpAny(bv->vtype,&isgpu,VECSEQCUDA,VECMPICUDA,VECSEQHIP,VECMPIHIP,""));
   ctx->vmip = isgpu? 1: 0;
 
   /* Default BVMatMult method */
@@ -28,6 +28,18 @@ PetscFunctionList BVList = NULL;
    Options Database Key:
 .  -bv_type <type> - Sets BV type
 
+   Developer Note:
+   All BV implementations distribute rows exactly as the Vec layout of the
+   operator, since columns are exchanged with Vec-based code (MatMult, ST,
+   user callbacks) without copies. A two-dimensional (process grid) data
+   distribution would improve the shape of the local products in extreme
+   strong-scaling runs, but it cannot be provided as just another type: it
+   would require redistribution at every such boundary and breaks the
+   column-access contract of BVGetColumn(). Skinny local panels are better
+   addressed by reducing the process count per solve, e.g. with the
+   communicator splitting facilities of the spectrum slicing and contour
+   integral solvers.
+
    Level: intermediate
 
 .seealso: BVGetType()
@@ -362,6 +374,12 @@ PetscErrorCode BVResize(BV bv,PetscInt m,PetscBool copy)
       PetscCall(VecCreateSeqCUDA(PETSC_COMM_SELF,m,&v));
 #else
       SETERRQ(PetscObjectComm((PetscObject)bv),PETSC_ERR_PLIB,"Something wrong happened");
+#endif
+    } else if (bv->hip) {
+#if defined(PETSC_HAVE_HIP)
+      PetscCall(VecCreateSeqHIP(PETSC_COMM_SELF,m,&v));
+#else
+      SETERRQ(PetscObjectComm((PetscObject)bv),PETSC_ERR_PLIB,"Something wrong happened");
 #endif
     } else PetscCall(VecCreateSeq(PETSC_COMM_SELF,m,&v));
     if (copy) {
@@ -884,6 +902,8 @@ PetscErrorCode BVSetFromOptions(BV bv)
     PetscCall(PetscOptionsReal("-bv_definite_tol","Tolerance for checking a definite inner product","BVSetDefiniteTolerance",r,&r,&flg1));
     if (flg1) PetscCall(BVSetDefiniteTolerance(bv,r));
 
+    PetscCall(PetscOptionsBool("-bv_deterministic","Deterministic global reductions","BVSetDeterministic",bv->deterministic,&bv->deterministic,NULL));
+
     /* undocumented option to generate random vectors that are independent of the number of processes */
     PetscCall(PetscOptionsGetBool(NULL,NULL,"-bv_reproducible_random",&bv->rrandom,NULL));
 
@@ -913,7 +933,7 @@ PetscErrorCode BVSetFromOptions(BV bv)
    Options Database Keys:
 +  -bv_orthog_type <type> - Where <type> is cgs for Classical Gram-Schmidt orthogonalization
                          (default) or mgs for Modified Gram-Schmidt orthogonalization
-.  -bv_orthog_refine <ref> - Where <ref> is one of never, ifneeded (default) or always
+.  -bv_orthog_refine <ref> - Where <ref> is one of never, ifneeded (default), always or fused
 .  -bv_orthog_eta <eta> -  For setting the value of eta
 -  -bv_orthog_block <block> - Where <block> is the block-orthogonalization method
 
@@ -923,6 +943,11 @@ PetscErrorCode BVSetFromOptions(BV bv)
    The parameter eta should be a real value between 0 and 1 (or PETSC_DEFAULT).
    The value of eta is used only when the refinement type is "ifneeded".
 
+   In single precision builds, where the basis is stored and operated in
+   reduced precision, an unconditional second Gram-Schmidt sweep (refine
+   set to always) acts as the correction step and is recommended whenever
+   the orthogonality level of the basis is critical for the solver.
+
    When using several processors, MGS is likely to result in bad scalability.
 
    If the method set for block orthogonalization is GS, then the computation
@@ -952,6 +977,7 @@ PetscErrorCode BVSetOrthogonalization(BV bv,BVOrthogType type,BVOrthogRefineType
     case BV_ORTHOG_REFINE_NEVER:
     case BV_ORTHOG_REFINE_IFNEEDED:
     case BV_ORTHOG_REFINE_ALWAYS:
+    case BV_ORTHOG_REFINE_FUSED:
       bv->orthog_ref = refine;
       break;
     default:
@@ -1016,16 +1042,25 @@ PetscErrorCode BVGetOrthogonalization(BV bv,BVOrthogType *type,BVOrthogRefineTyp
 -  method - the method for the BVMatMult() operation
 
    Options Database Keys:
-.  -bv_matmult <meth> - choose one of the methods: vecs, mat
+.  -bv_matmult <meth> - choose one of the methods: vecs, mat, auto
 
    Notes:
    Allowed values are
 +  BV_MATMULT_VECS - perform a matrix-vector multiply per each column
 .  BV_MATMULT_MAT - carry out a Mat-Mat product with a dense matrix
--  BV_MATMULT_MAT_SAVE - this case is deprecated
+.  BV_MATMULT_MAT_SAVE - this case is deprecated
+-  BV_MATMULT_AUTO - select between vecs and mat by timing both on first use
 
    The default is BV_MATMULT_MAT except in the case of BVVECS.
 
+   With BV_MATMULT_AUTO, the first call to BVMatMult() times both actual
+   methods on the given operands and keeps the fastest one. The choice is
+   stored in the file .slepc_bvmatmult of the user's home directory, keyed
+   by matrix type, matrix dimensions and number of columns, so subsequent
+   runs with the same operation reuse the recorded winner without repeating
+   the measurement. Delete the file to force re-tuning, e.g. after moving
+   to a different machine.
+
    Level: advanced
 
 .seealso: BVMatMult(), BVGetMatMultMethod(), BVMatMultType
@@ -1038,6 +1073,7 @@ PetscErrorCode BVSetMatMultMethod(BV bv,BVMatMultType method)
   switch (method) {
     case BV_MATMULT_VECS:
     case BV_MATMULT_MAT:
+    case BV_MATMULT_AUTO:
       bv->vmm = method;
       break;
     case BV_MATMULT_MAT_SAVE:
@@ -1074,6 +1110,71 @@ PetscErrorCode BVGetMatMultMethod(BV bv,BVMatMultType *method)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   BVSetDeterministic - Specifies whether global reductions must give bitwise
+   reproducible results.
+
+   Logically Collective
+
+   Input Parameters:
++  bv            - the basis vectors context
+-  deterministic - whether to enable deterministic reductions
+
+   Options Database Keys:
+.  -bv_deterministic <bool> - enable deterministic reductions
+
+   Notes:
+   By default, the result of parallel inner products such as BVDot() may
+   change slightly from run to run, even with the same number of processes,
+   because the MPI implementation is free to reassociate the partial sums
+   of the reduction. When deterministic mode is enabled, the partial sums
+   are always combined in process order using compensated summation, so
+   repeated runs at a fixed number of processes give bitwise identical
+   results. This costs an extra gather and broadcast per reduction, which
+   is noticeable only when the mode is enabled.
+
+   Together with the option -bv_reproducible_random, this allows fully
+   reproducible solver runs, which is useful for debugging and for
+   comparing against stored baselines.
+
+   Level: advanced
+
+.seealso: BVGetDeterministic(), BVDot(), BVNorm()
+@*/
+PetscErrorCode BVSetDeterministic(BV bv,PetscBool deterministic)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(bv,BV_CLASSID,1);
+  PetscValidLogicalCollectiveBool(bv,deterministic,2);
+  bv->deterministic = deterministic;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   BVGetDeterministic - Returns the flag indicating if global reductions are
+   done deterministically.
+
+   Not Collective
+
+   Input Parameter:
+.  bv - basis vectors context
+
+   Output Parameter:
+.  deterministic - the flag
+
+   Level: advanced
+
+.seealso: BVSetDeterministic()
+@*/
+PetscErrorCode BVGetDeterministic(BV bv,PetscBool *deterministic)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(bv,BV_CLASSID,1);
+  PetscAssertPointer(deterministic,2);
+  *deterministic = bv->deterministic;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    BVGetColumn - Returns a Vec object that contains the entries of the
    requested column of the basis vectors object.
@@ -1163,7 +1264,14 @@ PetscErrorCode BVRestoreColumn(BV bv,PetscInt j,Vec *v)
   PetscCall(PetscObjectGetId((PetscObject)*v,&id));
   PetscCheck(id==bv->id[l],PetscObjectComm((PetscObject)bv),PETSC_ERR_ARG_WRONG,"Argument 3 is not the same Vec that was obtained with BVGetColumn");
   PetscCall(PetscObjectStateGet((PetscObject)*v,&st));
-  if (st!=bv->st[l]) PetscCall(PetscObjectStateIncrease((PetscObject)bv));
+  if (st!=bv->st[l]) {
+    /* only this column changed: clamp the validity of the cached product of the
+       inner-product matrix, and account for the state change provided that all
+       previous changes since the last refresh were also column-level ones */
+    bv->cvalid = PetscMin(bv->cvalid,j);
+    if (bv->cstate == ((PetscObject)bv)->state) bv->cstate++;
+    PetscCall(PetscObjectStateIncrease((PetscObject)bv));
+  }
   PetscUseTypeMethod(bv,restorecolumn,j,v);
   bv->ci[l] = -bv->nc-1;
   bv->st[l] = -1;
@@ -1356,7 +1464,7 @@ PetscErrorCode BVCreateVec(BV bv,Vec *v)
 @*/
 PetscErrorCode BVCreateVecEmpty(BV bv,Vec *v)
 {
-  PetscBool  standard,cuda,mpi;
+  PetscBool  standard,cuda,hip,mpi;
   PetscInt   N,nloc,bs;
 
   PetscFunctionBegin;
@@ -1366,8 +1474,9 @@ PetscErrorCode BVCreateVecEmpty(BV bv,Vec *v)
 
   PetscCall(PetscStrcmpAny(bv->vtype,&standard,VECSEQ,VECMPI,""));
   PetscCall(PetscStrcmpAny(bv->vtype,&cuda,VECSEQCUDA,VECMPICUDA,""));
-  if (standard || cuda) {
-    PetscCall(PetscStrcmpAny(bv->vtype,&mpi,VECMPI,VECMPICUDA,""));
+  PetscCall(PetscStrcmpAny(bv->vtype,&hip,VECSEQHIP,VECMPIHIP,""));
+  if (standard || cuda || hip) {
+    PetscCall(PetscStrcmpAny(bv->vtype,&mpi,VECMPI,VECMPICUDA,VECMPIHIP,""));
     PetscCall(PetscLayoutGetLocalSize(bv->map,&nloc));
     PetscCall(PetscLayoutGetSize(bv->map,&N));
     PetscCall(PetscLayoutGetBlockSize(bv->map,&bs));
@@ -1375,6 +1484,11 @@ PetscErrorCode BVCreateVecEmpty(BV bv,Vec *v)
 #if defined(PETSC_HAVE_CUDA)
       if (mpi) PetscCall(VecCreateMPICUDAWithArray(PetscObjectComm((PetscObject)bv),bs,nloc,N,NULL,v));
       else PetscCall(VecCreateSeqCUDAWithArray(PetscObjectComm((PetscObject)bv),bs,N,NULL,v));
+#endif
+    } else if (hip) {
+#if defined(PETSC_HAVE_HIP)
+      if (mpi) PetscCall(VecCreateMPIHIPWithArray(PetscObjectComm((PetscObject)bv),bs,nloc,N,NULL,v));
+      else PetscCall(VecCreateSeqHIPWithArray(PetscObjectComm((PetscObject)bv),bs,N,NULL,v));
 #endif
     } else {
       if (mpi) PetscCall(VecCreateMPIWithArray(PetscObjectComm((PetscObject)bv),bs,nloc,N,NULL,v));
@@ -1509,6 +1623,7 @@ PetscErrorCode BVGetMat_Default(BV bv,Mat *A)
     PetscCall(MatDenseReplaceArray(bv->Aget,NULL));  /* replace with a null pointer, the value after BVRestoreMat */
   }
   PetscCall(MatDensePlaceArray(bv->Aget,vv+(bv->nc+bv->l)*bv->ld));  /* set the actual pointer */
+  PetscCall(PetscObjectStateGet((PetscObject)bv->Aget,&bv->Agetstate));
   *A = bv->Aget;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1549,13 +1664,17 @@ PetscErrorCode BVGetMat(BV bv,Mat *A)
 
 PetscErrorCode BVRestoreMat_Default(BV bv,Mat *A)
 {
-  PetscScalar *vv,*aa;
+  PetscScalar      *vv,*aa;
+  PetscObjectState state;
 
   PetscFunctionBegin;
+  PetscCall(PetscObjectStateGet((PetscObject)bv->Aget,&state));
   PetscCall(MatDenseGetArray(bv->Aget,&aa));
   vv = aa-(bv->nc+bv->l)*bv->ld;
   PetscCall(MatDenseResetArray(bv->Aget));
-  PetscCall(BVRestoreArray(bv,&vv));
+  /* if the Mat was not modified, restore in read-only mode to skip any copy-back */
+  if (state==bv->Agetstate) PetscCall(BVRestoreArrayRead(bv,(const PetscScalar**)&vv));
+  else PetscCall(BVRestoreArray(bv,&vv));
   *A = NULL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1609,7 +1728,9 @@ static inline PetscErrorCode BVDuplicate_Private(BV V,BV W)
   W->indef        = V->indef;
   W->vmm          = V->vmm;
   W->rrandom      = V->rrandom;
+  W->rctr         = V->rctr;
   W->deftol       = V->deftol;
+  W->deterministic = V->deterministic;
   if (V->rand) PetscCall(PetscObjectReference((PetscObject)V->rand));
   W->rand         = V->rand;
   W->sfocalled    = V->sfocalled;
@@ -1869,6 +1990,87 @@ PetscErrorCode BVCopyColumn(BV V,PetscInt j,PetscInt i)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   BVCopyColumnNormalize - Copies the values from one of the columns to
+   another one, normalizing the result.
+
+   Collective
+
+   Input Parameters:
++  V - basis vectors context
+.  j - the number of the source column
+-  i - the number of the destination column
+
+   Output Parameter:
+.  norm - (optional) the norm of the source column
+
+   Notes:
+   The result is equivalent to BVCopyColumn() followed by BVNormColumn() and
+   BVScaleColumn(), but the norm is accumulated during the copy sweep so the
+   destination column is traversed one time less and a single global
+   reduction is used. The source column is not modified. If j and i are
+   equal, the column is simply normalized in place.
+
+   If a non-standard inner product has been specified with BVSetMatrix(),
+   then the three operations are performed separately, since the norm
+   requires an additional matrix-vector product.
+
+   Level: intermediate
+
+.seealso: BVCopyColumn(), BVNormColumn(), BVScaleColumn(), BVNormalize()
+@*/
+PetscErrorCode BVCopyColumnNormalize(BV V,PetscInt j,PetscInt i,PetscReal *norm)
+{
+  PetscInt          k;
+  PetscReal         nrm,sum,lsum=0.0,absw;
+  PetscScalar       *pv;
+  const PetscScalar *pw;
+  Vec               v,w;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(V,BV_CLASSID,1);
+  PetscValidType(V,1);
+  BVCheckSizes(V,1);
+  PetscValidLogicalCollectiveInt(V,j,2);
+  PetscValidLogicalCollectiveInt(V,i,3);
+
+  if (V->matrix) {  /* non-standard inner product, cannot fuse the sweeps */
+    PetscCall(BVCopyColumn(V,j,i));
+    PetscCall(BVNormColumn(V,i,NORM_2,&nrm));
+    PetscCall(BVScaleColumn(V,i,1.0/nrm));
+  } else {
+    PetscCall(PetscLogEventBegin(BV_Copy,V,0,0,0));
+    PetscCall(BVGetColumn(V,i,&v));
+    PetscCall(VecGetArray(v,&pv));
+    if (j!=i) {
+      PetscCall(BVGetColumn(V,j,&w));
+      PetscCall(VecGetArrayRead(w,&pw));
+      for (k=0;k<V->n;k++) {
+        pv[k] = pw[k];
+        absw = PetscAbsScalar(pw[k]);
+        lsum += absw*absw;
+      }
+      PetscCall(VecRestoreArrayRead(w,&pw));
+      PetscCall(BVRestoreColumn(V,j,&w));
+    } else {
+      for (k=0;k<V->n;k++) {
+        absw = PetscAbsScalar(pv[k]);
+        lsum += absw*absw;
+      }
+    }
+    PetscCall(MPIU_Allreduce(&lsum,&sum,1,MPIU_REAL,MPIU_SUM,PetscObjectComm((PetscObject)V)));
+    nrm = PetscSqrtReal(sum);
+    for (k=0;k<V->n;k++) pv[k] /= nrm;
+    PetscCall(VecRestoreArray(v,&pv));
+    PetscCall(BVRestoreColumn(V,i,&v));
+    PetscCall(PetscLogFlops(3.0*V->n));
+    PetscCall(PetscLogEventEnd(BV_Copy,V,0,0,0));
+  }
+  if (norm) *norm = nrm;
+  PetscCall(PetscObjectStateIncrease((PetscObject)V));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode BVGetSplit_Private(BV bv,PetscBool left,BV *split)
 {
   PetscInt  ncols;
@@ -56,6 +56,36 @@ static PetscErrorCode BVBiorthogonalizeCGS1(BV V,BV W,Vec v,PetscScalar *h,Petsc
 
 #define BVBiorthogonalizeGS1(a,b,c,d,e) ((V->orthog_type==BV_ORTHOG_MGS)?BVBiorthogonalizeMGS1:BVBiorthogonalizeCGS1)(a,b,c,d,e)
 
+/*
+   BVBiorthogonalizeCGSFused - Fused CGS bi-orthogonalization of v against W
+   and w against V. The two sets of inner products are posted as split-phase
+   reductions, so each sweep (and each refinement sweep) costs a single global
+   synchronization instead of two
+*/
+static PetscErrorCode BVBiorthogonalizeCGSFused(BV V,BV W,Vec v,Vec w)
+{
+  PetscScalar    *hv=V->h,*cv=V->c,*hw=W->h,*cw=W->c;
+  PetscInt       i,nsweeps;
+
+  PetscFunctionBegin;
+  PetscCall(BV_CleanCoefficients(V,V->k,hv));
+  PetscCall(BV_CleanCoefficients(W,W->k,hw));
+  nsweeps = (V->orthog_ref!=BV_ORTHOG_REFINE_NEVER && V->orthog_ref!=BV_ORTHOG_REFINE_FUSED)? 2: 1;
+  for (i=0;i<nsweeps;i++) {
+    /* cv = W'*v, cw = V'*w, combined in one reduction */
+    PetscCall(BVDotVecBegin(W,v,cv));
+    PetscCall(BVDotVecBegin(V,w,cw));
+    PetscCall(BVDotVecEnd(W,v,cv));
+    PetscCall(BVDotVecEnd(V,w,cw));
+    /* v = v - V cv, w = w - W cw */
+    PetscCall(BVMultVec(V,-1.0,1.0,v,cv));
+    PetscCall(BVMultVec(W,-1.0,1.0,w,cw));
+    PetscCall(BV_AddCoefficients(V,V->k,hv,cv));
+    PetscCall(BV_AddCoefficients(W,W->k,hw,cw));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    BVBiorthogonalizeGS - Orthogonalize with (classical or modified) Gram-Schmidt
 
@@ -71,7 +101,7 @@ static PetscErrorCode BVBiorthogonalizeGS(BV V,BV W,Vec v)
   c = V->c;
   PetscCall(BV_CleanCoefficients(V,V->k,h));
   PetscCall(BVBiorthogonalizeGS1(V,W,v,h,c));
-  if (V->orthog_ref!=BV_ORTHOG_REFINE_NEVER) PetscCall(BVBiorthogonalizeGS1(V,W,v,h,c));
+  if (V->orthog_ref!=BV_ORTHOG_REFINE_NEVER && V->orthog_ref!=BV_ORTHOG_REFINE_FUSED) PetscCall(BVBiorthogonalizeGS1(V,W,v,h,c));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -127,12 +157,21 @@ PetscErrorCode BVBiorthogonalizeColumn(BV V,BV W,PetscInt j)
   W->l = -W->nc;
   PetscCall(BV_AllocateCoeffs(V));
   PetscCall(BV_AllocateCoeffs(W));
-  PetscCall(BVGetColumn(V,j,&y));
-  PetscCall(BVBiorthogonalizeGS(V,W,y));
-  PetscCall(BVRestoreColumn(V,j,&y));
-  PetscCall(BVGetColumn(W,j,&z));
-  PetscCall(BVBiorthogonalizeGS(W,V,z));
-  PetscCall(BVRestoreColumn(W,j,&z));
+  if (V->orthog_type==BV_ORTHOG_CGS) {
+    /* fused kernel: both coefficient vectors share a single reduction per sweep */
+    PetscCall(BVGetColumn(V,j,&y));
+    PetscCall(BVGetColumn(W,j,&z));
+    PetscCall(BVBiorthogonalizeCGSFused(V,W,y,z));
+    PetscCall(BVRestoreColumn(V,j,&y));
+    PetscCall(BVRestoreColumn(W,j,&z));
+  } else {
+    PetscCall(BVGetColumn(V,j,&y));
+    PetscCall(BVBiorthogonalizeGS(V,W,y));
+    PetscCall(BVRestoreColumn(V,j,&y));
+    PetscCall(BVGetColumn(W,j,&z));
+    PetscCall(BVBiorthogonalizeGS(W,V,z));
+    PetscCall(BVRestoreColumn(W,j,&z));
+  }
   V->k = ksavev;
   V->l = lsavev;
   W->k = ksavew;
@@ -201,12 +240,21 @@ PetscErrorCode BVBiorthonormalizeColumn(BV V,BV W,PetscInt j,PetscReal *delta)
   W->l = -W->nc;
   PetscCall(BV_AllocateCoeffs(V));
   PetscCall(BV_AllocateCoeffs(W));
-  PetscCall(BVGetColumn(V,j,&y));
-  PetscCall(BVBiorthogonalizeGS(V,W,y));
-  PetscCall(BVRestoreColumn(V,j,&y));
-  PetscCall(BVGetColumn(W,j,&z));
-  PetscCall(BVBiorthogonalizeGS(W,V,z));
-  PetscCall(BVRestoreColumn(W,j,&z));
+  if (V->orthog_type==BV_ORTHOG_CGS) {
+    /* fused kernel: both coefficient vectors share a single reduction per sweep */
+    PetscCall(BVGetColumn(V,j,&y));
+    PetscCall(BVGetColumn(W,j,&z));
+    PetscCall(BVBiorthogonalizeCGSFused(V,W,y,z));
+    PetscCall(BVRestoreColumn(V,j,&y));
+    PetscCall(BVRestoreColumn(W,j,&z));
+  } else {
+    PetscCall(BVGetColumn(V,j,&y));
+    PetscCall(BVBiorthogonalizeGS(V,W,y));
+    PetscCall(BVRestoreColumn(V,j,&y));
+    PetscCall(BVGetColumn(W,j,&z));
+    PetscCall(BVBiorthogonalizeGS(W,V,z));
+    PetscCall(BVRestoreColumn(W,j,&z));
+  }
   V->k = ksavev;
   V->l = lsavev;
   W->k = ksavew;
@@ -200,7 +200,6 @@ PetscErrorCode BVDot_BLAS_Private(BV bv,PetscInt m_,PetscInt n_,PetscInt k_,cons
 {
   PetscScalar    zero=0.0,one=1.0,*CC;
   PetscBLASInt   m,n,k,lda,ldb,ldc,j;
-  PetscMPIInt    len;
 
   PetscFunctionBegin;
   PetscCall(PetscBLASIntCast(m_,&m));
@@ -214,15 +213,13 @@ PetscErrorCode BVDot_BLAS_Private(BV bv,PetscInt m_,PetscInt n_,PetscInt k_,cons
       PetscCall(BVAllocateWork_Private(bv,m*n));
       if (k) PetscCallBLAS("BLASgemm",BLASgemm_("C","N",&m,&n,&k,&one,(PetscScalar*)A,&lda,(PetscScalar*)B,&ldb,&zero,bv->work,&ldc));
       else PetscCall(PetscArrayzero(bv->work,m*n));
-      PetscCall(PetscMPIIntCast(m*n,&len));
-      PetscCall(MPIU_Allreduce(bv->work,C,len,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+      PetscCall(BVAllReduceSum_Private(bv,bv->work,C,m*n));
     } else {
       PetscCall(BVAllocateWork_Private(bv,2*m*n));
       CC = bv->work+m*n;
       if (k) PetscCallBLAS("BLASgemm",BLASgemm_("C","N",&m,&n,&k,&one,(PetscScalar*)A,&lda,(PetscScalar*)B,&ldb,&zero,bv->work,&m));
       else PetscCall(PetscArrayzero(bv->work,m*n));
-      PetscCall(PetscMPIIntCast(m*n,&len));
-      PetscCall(MPIU_Allreduce(bv->work,CC,len,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+      PetscCall(BVAllReduceSum_Private(bv,bv->work,CC,m*n));
       for (j=0;j<n;j++) PetscCall(PetscArraycpy(C+j*ldc,CC+j*m,m));
     }
   } else {
@@ -241,7 +238,6 @@ PetscErrorCode BVDotVec_BLAS_Private(BV bv,PetscInt n_,PetscInt k_,const PetscSc
 {
   PetscScalar    zero=0.0,done=1.0;
   PetscBLASInt   n,k,lda,one=1;
-  PetscMPIInt    len;
 
   PetscFunctionBegin;
   PetscCall(PetscBLASIntCast(n_,&n));
@@ -251,8 +247,7 @@ PetscErrorCode BVDotVec_BLAS_Private(BV bv,PetscInt n_,PetscInt k_,const PetscSc
     PetscCall(BVAllocateWork_Private(bv,k));
     if (n) PetscCallBLAS("BLASgemv",BLASgemv_("C",&n,&k,&done,A,&lda,x,&one,&zero,bv->work,&one));
     else PetscCall(PetscArrayzero(bv->work,k));
-    PetscCall(PetscMPIIntCast(k,&len));
-    PetscCall(MPIU_Allreduce(bv->work,y,len,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+    PetscCall(BVAllReduceSum_Private(bv,bv->work,y,k));
   } else {
     if (n) PetscCallBLAS("BLASgemv",BLASgemv_("C",&n,&k,&done,A,&lda,x,&one,&zero,y,&one));
   }
@@ -566,7 +566,7 @@ PetscErrorCode BVSVDAndRank(BV S,PetscInt m,PetscInt l,PetscReal delta,BVSVDMeth
 }
 
 /*@
-   BVCISSResizeBases - Resize the bases involved in CISS solvers when the L grows.
+   BVCISSResizeBases - Resize the bases involved in CISS solvers when the value of L changes.
 
    Logically Collective
 
@@ -596,12 +596,22 @@ PetscErrorCode BVCISSResizeBases(BV S,BV V,BV Y,PetscInt Lold,PetscInt Lnew,Pets
   PetscValidLogicalCollectiveInt(S,M,6);
   PetscValidLogicalCollectiveInt(S,npoints,7);
 
-  PetscCall(BVResize(S,Lnew*M,PETSC_FALSE));
-  PetscCall(BVResize(V,Lnew,PETSC_TRUE));
-  PetscCall(BVResize(Y,Lnew*npoints,PETSC_TRUE));
-  /* columns of Y are interleaved */
-  for (i=npoints-1;i>=0;i--) {
-    for (j=Lold-1;j>=0;j--) PetscCall(BVCopyColumn(Y,i*Lold+j,i*Lnew+j));
+  if (Lnew>=Lold) {
+    PetscCall(BVResize(S,Lnew*M,PETSC_FALSE));
+    PetscCall(BVResize(V,Lnew,PETSC_TRUE));
+    PetscCall(BVResize(Y,Lnew*npoints,PETSC_TRUE));
+    /* columns of Y are interleaved */
+    for (i=npoints-1;i>=0;i--) {
+      for (j=Lold-1;j>=0;j--) PetscCall(BVCopyColumn(Y,i*Lold+j,i*Lnew+j));
+    }
+  } else {
+    /* when shrinking, compact the interleaved columns of Y before resizing */
+    for (i=1;i<npoints;i++) {
+      for (j=0;j<Lnew;j++) PetscCall(BVCopyColumn(Y,i*Lold+j,i*Lnew+j));
+    }
+    PetscCall(BVResize(S,Lnew*M,PETSC_FALSE));
+    PetscCall(BVResize(V,Lnew,PETSC_TRUE));
+    PetscCall(BVResize(Y,Lnew*npoints,PETSC_TRUE));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
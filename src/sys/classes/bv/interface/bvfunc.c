@@ -19,9 +19,9 @@ static PetscBool BVPackageInitialized = PETSC_FALSE;
 MPI_Op MPIU_TSQR = 0,MPIU_LAPY2;
 
 const char *BVOrthogTypes[] = {"CGS","MGS","BVOrthogType","BV_ORTHOG_",NULL};
-const char *BVOrthogRefineTypes[] = {"IFNEEDED","NEVER","ALWAYS","BVOrthogRefineType","BV_ORTHOG_REFINE_",NULL};
+const char *BVOrthogRefineTypes[] = {"IFNEEDED","NEVER","ALWAYS","FUSED","BVOrthogRefineType","BV_ORTHOG_REFINE_",NULL};
 const char *BVOrthogBlockTypes[] = {"GS","CHOL","TSQR","TSQRCHOL","SVQB","BVOrthogBlockType","BV_ORTHOG_BLOCK_",NULL};
-const char *BVMatMultTypes[] = {"VECS","MAT","MAT_SAVE","BVMatMultType","BV_MATMULT_",NULL};
+const char *BVMatMultTypes[] = {"VECS","MAT","MAT_SAVE","AUTO","BVMatMultType","BV_MATMULT_",NULL};
 const char *BVSVDMethods[] = {"REFINE","QR","QR_CAA","BVSVDMethod","BV_SVD_METHOD_",NULL};
 
 /*@C
@@ -130,6 +130,9 @@ PetscErrorCode BVDestroy(BV *bv)
   PetscCall(BVDestroy(&(*bv)->L));
   PetscCall(BVDestroy(&(*bv)->R));
   PetscCall(PetscFree((*bv)->work));
+#if defined(PETSC_HAVE_CUDA)
+  if ((*bv)->d_work) PetscCallCUDA(cudaFree((*bv)->d_work));
+#endif
   PetscCall(PetscFree2((*bv)->h,(*bv)->c));
   PetscCall(VecDestroy(&(*bv)->omega));
   PetscCall(MatDestroy(&(*bv)->Acreate));
@@ -182,7 +185,9 @@ PetscErrorCode BVCreate(MPI_Comm comm,BV *newbv)
   bv->indef        = PETSC_FALSE;
   bv->vmm          = BV_MATMULT_MAT;
   bv->rrandom      = PETSC_FALSE;
+  bv->rctr         = 0;
   bv->deftol       = 10*PETSC_MACHINE_EPSILON;
+  bv->deterministic = PETSC_FALSE;
 
   bv->buffer       = NULL;
   bv->Abuffer      = NULL;
@@ -203,6 +208,9 @@ PetscErrorCode BVCreate(MPI_Comm comm,BV *newbv)
   bv->defersfo     = PETSC_FALSE;
   bv->cached       = NULL;
   bv->bvstate      = 0;
+  bv->cstate       = 0;
+  bv->cvalidl      = 0;
+  bv->cvalid       = 0;
   bv->L            = NULL;
   bv->R            = NULL;
   bv->lstate       = 0;
@@ -214,9 +222,14 @@ PetscErrorCode BVCreate(MPI_Comm comm,BV *newbv)
   bv->Acreate      = NULL;
   bv->Aget         = NULL;
   bv->cuda         = PETSC_FALSE;
+  bv->hip          = PETSC_FALSE;
   bv->sfocalled    = PETSC_FALSE;
   bv->work         = NULL;
   bv->lwork        = 0;
+#if defined(PETSC_HAVE_CUDA)
+  bv->d_work       = NULL;
+  bv->d_lwork      = 0;
+#endif
   bv->data         = NULL;
 
   *newbv = bv;
@@ -303,6 +316,82 @@ PetscErrorCode BVInsertVec(BV V,PetscInt j,Vec w)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   BVInsertVecNormalize - Insert a vector into the specified column, normalized.
+
+   Collective
+
+   Input Parameters:
++  V - basis vectors
+.  j - the column of V to be overwritten
+-  w - the vector to be copied
+
+   Output Parameter:
+.  norm - (optional) the norm of w
+
+   Notes:
+   The result is equivalent to BVInsertVec() followed by BVNormColumn() and
+   BVScaleColumn(), but the norm is accumulated during the copy sweep so the
+   column is traversed one time less and a single global reduction is used.
+   The input vector w is not modified.
+
+   If a non-standard inner product has been specified with BVSetMatrix(),
+   then the three operations are performed separately, since the norm
+   requires an additional matrix-vector product.
+
+   Level: intermediate
+
+.seealso: BVInsertVec(), BVNormColumn(), BVScaleColumn(), BVNormalize()
+@*/
+PetscErrorCode BVInsertVecNormalize(BV V,PetscInt j,Vec w,PetscReal *norm)
+{
+  PetscInt          n,N,i;
+  PetscReal         nrm,sum,lsum=0.0,absw;
+  PetscScalar       *pv;
+  const PetscScalar *pw;
+  Vec               v;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(V,BV_CLASSID,1);
+  PetscValidLogicalCollectiveInt(V,j,2);
+  PetscValidHeaderSpecific(w,VEC_CLASSID,3);
+  PetscValidType(V,1);
+  BVCheckSizes(V,1);
+  PetscCheckSameComm(V,1,w,3);
+
+  PetscCall(VecGetSize(w,&N));
+  PetscCall(VecGetLocalSize(w,&n));
+  PetscCheck(N==V->N && n==V->n,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_INCOMP,"Vec sizes (global %" PetscInt_FMT ", local %" PetscInt_FMT ") do not match BV sizes (global %" PetscInt_FMT ", local %" PetscInt_FMT ")",N,n,V->N,V->n);
+  PetscCheck(j>=-V->nc && j<V->m,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_OUTOFRANGE,"Argument j has wrong value %" PetscInt_FMT ", should be between %" PetscInt_FMT " and %" PetscInt_FMT,j,-V->nc,V->m-1);
+
+  if (V->matrix) {  /* non-standard inner product, cannot fuse the sweeps */
+    PetscCall(BVInsertVec(V,j,w));
+    PetscCall(BVNormColumn(V,j,NORM_2,&nrm));
+    PetscCall(BVScaleColumn(V,j,1.0/nrm));
+  } else {
+    PetscCall(PetscLogEventBegin(BV_Copy,V,w,0,0));
+    PetscCall(BVGetColumn(V,j,&v));
+    PetscCall(VecGetArrayRead(w,&pw));
+    PetscCall(VecGetArray(v,&pv));
+    for (i=0;i<n;i++) {
+      pv[i] = pw[i];
+      absw = PetscAbsScalar(pw[i]);
+      lsum += absw*absw;
+    }
+    PetscCall(MPIU_Allreduce(&lsum,&sum,1,MPIU_REAL,MPIU_SUM,PetscObjectComm((PetscObject)V)));
+    nrm = PetscSqrtReal(sum);
+    for (i=0;i<n;i++) pv[i] /= nrm;
+    PetscCall(VecRestoreArray(v,&pv));
+    PetscCall(VecRestoreArrayRead(w,&pw));
+    PetscCall(BVRestoreColumn(V,j,&v));
+    PetscCall(PetscLogFlops(3.0*n));
+    PetscCall(PetscLogEventEnd(BV_Copy,V,w,0,0));
+  }
+  if (norm) *norm = nrm;
+  PetscCall(PetscObjectStateIncrease((PetscObject)V));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    BVInsertVecs - Insert a set of vectors into the specified columns.
 
@@ -324,13 +413,20 @@ PetscErrorCode BVInsertVec(BV V,PetscInt j,Vec w)
    against the previous ones. If any of them is linearly dependent then it
    is discarded and the value of m is decreased.
 
+   If a block orthogonalization method other than GS has been selected with
+   BVSetOrthogonalization(), then all vectors are copied first and
+   orthogonalized simultaneously with BVOrthogonalize(), which requires a
+   single global reduction in methods such as TSQR. In that case linearly
+   dependent vectors are not discarded, and an error is generated on
+   breakdown instead.
+
    Level: intermediate
 
-.seealso: BVInsertVec(), BVOrthogonalizeColumn()
+.seealso: BVInsertVec(), BVOrthogonalizeColumn(), BVOrthogonalize(), BVSetOrthogonalization()
 @*/
 PetscErrorCode BVInsertVecs(BV V,PetscInt s,PetscInt *m,Vec *W,PetscBool orth)
 {
-  PetscInt       n,N,i,ndep;
+  PetscInt       n,N,i,ndep,ksave,lsave;
   PetscBool      lindep;
   PetscReal      norm;
   Vec            v;
@@ -355,6 +451,23 @@ PetscErrorCode BVInsertVecs(BV V,PetscInt s,PetscInt *m,Vec *W,PetscBool orth)
   PetscCheck(s>=0 && s<V->m,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_OUTOFRANGE,"Argument s has wrong value %" PetscInt_FMT ", should be between 0 and %" PetscInt_FMT,s,V->m-1);
   PetscCheck(s+(*m)<=V->m,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_OUTOFRANGE,"Too many vectors provided, there is only room for %" PetscInt_FMT,V->m);
 
+  if (orth && V->orthog_block!=BV_ORTHOG_BLOCK_GS && !V->nc && !V->indef) {
+    /* copy all vectors, then orthogonalize them as a block */
+    for (i=0;i<*m;i++) {
+      PetscCall(BVGetColumn(V,s+i,&v));
+      PetscCall(VecCopy(W[i],v));
+      PetscCall(BVRestoreColumn(V,s+i,&v));
+    }
+    ksave = V->k;
+    lsave = V->l;
+    V->l = s;
+    V->k = s+*m;
+    PetscCall(BVOrthogonalize(V,NULL));
+    V->k = ksave;
+    V->l = lsave;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
   ndep = 0;
   for (i=0;i<*m;i++) {
     PetscCall(BVGetColumn(V,s+i-ndep,&v));
@@ -550,7 +663,7 @@ PetscErrorCode BVView(BV bv,PetscViewer viewer)
   PetscBool         isascii;
   PetscViewerFormat format;
   const char        *orthname[2] = {"classical","modified"};
-  const char        *refname[3] = {"if needed","never","always"};
+  const char        *refname[4] = {"if needed","never","always","fused"};
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(bv,BV_CLASSID,1);
@@ -562,7 +675,7 @@ PetscErrorCode BVView(BV bv,PetscViewer viewer)
     PetscCall(PetscObjectPrintClassNamePrefixType((PetscObject)bv,viewer));
     PetscCall(PetscViewerGetFormat(viewer,&format));
     if (format == PETSC_VIEWER_ASCII_INFO || format == PETSC_VIEWER_ASCII_INFO_DETAIL) {
-      PetscCall(PetscViewerASCIIPrintf(viewer,"  %" PetscInt_FMT " columns of global length %" PetscInt_FMT "%s\n",bv->m,bv->N,bv->cuda?" (CUDA)":""));
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  %" PetscInt_FMT " columns of global length %" PetscInt_FMT "%s\n",bv->m,bv->N,bv->cuda?" (CUDA)":(bv->hip?" (HIP)":"")));
       if (bv->nc>0) PetscCall(PetscViewerASCIIPrintf(viewer,"  number of constraints: %" PetscInt_FMT "\n",bv->nc));
       PetscCall(PetscViewerASCIIPrintf(viewer,"  vector orthogonalization method: %s Gram-Schmidt\n",orthname[bv->orthog_type]));
       switch (bv->orthog_ref) {
@@ -571,6 +684,7 @@ PetscErrorCode BVView(BV bv,PetscViewer viewer)
           break;
         case BV_ORTHOG_REFINE_NEVER:
         case BV_ORTHOG_REFINE_ALWAYS:
+        case BV_ORTHOG_REFINE_FUSED:
           PetscCall(PetscViewerASCIIPrintf(viewer,"  orthogonalization refinement: %s\n",refname[bv->orthog_ref]));
           break;
       }
@@ -596,8 +710,12 @@ PetscErrorCode BVView(BV bv,PetscViewer viewer)
         case BV_MATMULT_MAT_SAVE:
           PetscCall(PetscViewerASCIIPrintf(viewer,"  mat_save is deprecated, use mat\n"));
           break;
+        case BV_MATMULT_AUTO:
+          PetscCall(PetscViewerASCIIPrintf(viewer,"  the matmult method will be selected by timing both candidates\n"));
+          break;
       }
       if (bv->rrandom) PetscCall(PetscViewerASCIIPrintf(viewer,"  generating random vectors independent of the number of processes\n"));
+      if (bv->deterministic) PetscCall(PetscViewerASCIIPrintf(viewer,"  using deterministic global reductions\n"));
     }
   }
   PetscTryTypeMethod(bv,view,viewer);
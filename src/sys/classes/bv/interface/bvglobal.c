@@ -13,6 +13,90 @@
 
 #include <slepc/private/bvimpl.h>      /*I "slepcbv.h" I*/
 
+/*
+  BVAllReduceSum_Private - Global sum of an array of n scalars distributed
+  across the communicator of the BV. By default this is a plain Allreduce,
+  whose result may change from run to run because MPI is free to reassociate
+  the partial sums. In deterministic mode, see BVSetDeterministic(), the
+  partial values are gathered and added in fixed process order with
+  compensated (Kahan) summation, so the result is bitwise identical in
+  every run with the same number of processes.
+*/
+PetscErrorCode BVAllReduceSum_Private(BV bv,const PetscScalar *local,PetscScalar *global,PetscInt n)
+{
+  PetscScalar    *buf,sum,comp,y,t;
+  PetscMPIInt    size,rank,len;
+  PetscInt       i,p;
+  MPI_Comm       comm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMPIIntCast(n,&len));
+  PetscCall(PetscObjectGetComm((PetscObject)bv,&comm));
+  if (!bv->deterministic) {
+    PetscCall(MPIU_Allreduce(local,global,len,MPIU_SCALAR,MPIU_SUM,comm));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCallMPI(MPI_Comm_size(comm,&size));
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  PetscCall(PetscMalloc1(rank?0:size*n,&buf));
+  PetscCallMPI(MPI_Gather(local,len,MPIU_SCALAR,buf,len,MPIU_SCALAR,0,comm));
+  if (!rank) {
+    for (i=0;i<n;i++) {
+      sum  = buf[i];
+      comp = 0.0;
+      for (p=1;p<size;p++) {
+        y    = buf[p*n+i] - comp;
+        t    = sum + y;
+        comp = (t - sum) - y;
+        sum  = t;
+      }
+      global[i] = sum;
+    }
+  }
+  PetscCall(PetscFree(buf));
+  PetscCallMPI(MPI_Bcast(global,len,MPIU_SCALAR,0,comm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+  BVAllReduceSumReal_Private - Same as BVAllReduceSum_Private for real values.
+*/
+PetscErrorCode BVAllReduceSumReal_Private(BV bv,const PetscReal *local,PetscReal *global,PetscInt n)
+{
+  PetscReal      *buf,sum,comp,y,t;
+  PetscMPIInt    size,rank,len;
+  PetscInt       i,p;
+  MPI_Comm       comm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMPIIntCast(n,&len));
+  PetscCall(PetscObjectGetComm((PetscObject)bv,&comm));
+  if (!bv->deterministic) {
+    PetscCall(MPIU_Allreduce(local,global,len,MPIU_REAL,MPIU_SUM,comm));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCallMPI(MPI_Comm_size(comm,&size));
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  PetscCall(PetscMalloc1(rank?0:size*n,&buf));
+  PetscCallMPI(MPI_Gather(local,len,MPIU_REAL,buf,len,MPIU_REAL,0,comm));
+  if (!rank) {
+    for (i=0;i<n;i++) {
+      sum  = buf[i];
+      comp = 0.0;
+      for (p=1;p<size;p++) {
+        y    = buf[p*n+i] - comp;
+        t    = sum + y;
+        comp = (t - sum) - y;
+        sum  = t;
+      }
+      global[i] = sum;
+    }
+  }
+  PetscCall(PetscFree(buf));
+  PetscCallMPI(MPI_Bcast(global,len,MPIU_REAL,0,comm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   BVDot for the particular case of non-standard inner product with
   matrix B, which is assumed to be symmetric (or complex Hermitian)
@@ -37,7 +37,6 @@ SLEPC_EXTERN void MPIAPI SlepcPythag(void *in,void *inout,PetscMPIInt *len,MPI_D
 PetscErrorCode BVNorm_LAPACK_Private(BV bv,PetscInt m_,PetscInt n_,const PetscScalar *A,PetscInt lda_,NormType type,PetscReal *nrm,PetscBool mpi)
 {
   PetscBLASInt   m,n,lda,i,j;
-  PetscMPIInt    len;
   PetscReal      lnrm,*rwork=NULL,*rwork2=NULL;
 
   PetscFunctionBegin;
@@ -62,8 +61,7 @@ PetscErrorCode BVNorm_LAPACK_Private(BV bv,PetscInt m_,PetscInt n_,const PetscSc
           rwork[j] += PetscAbsScalar(A[i+j*lda_]);
         }
       }
-      PetscCall(PetscMPIIntCast(n_,&len));
-      PetscCall(MPIU_Allreduce(rwork,rwork2,len,MPIU_REAL,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+      PetscCall(BVAllReduceSumReal_Private(bv,rwork,rwork2,n_));
       *nrm = 0.0;
       for (j=0;j<n_;j++) if (rwork2[j] > *nrm) *nrm = rwork2[j];
     } else {
@@ -13,6 +13,7 @@
 
 #include <slepc/private/bvimpl.h>      /*I "slepcbv.h" I*/
 #include <slepcds.h>
+#include <petsctime.h>
 
 /*@
    BVMult - Computes Y = beta*Y + alpha*X*Q.
@@ -357,21 +358,60 @@ PetscErrorCode BVScaleColumn(BV bv,PetscInt j,PetscScalar alpha)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Counter-based random number generation for the reproducible mode: every
+   entry is a pure function of the seed, a stream identifier (one per generated
+   column) and the global index, obtained with two rounds of the SplitMix64
+   finalizer. Hence each process fills just the locally owned part of the
+   vector, with a result that does not depend on how the vector is distributed
+*/
+static inline uint64_t BVRandomMix_Private(uint64_t x)
+{
+  x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+static inline PetscReal BVRandomUniform_Private(uint64_t key,uint64_t idx)
+{
+  uint64_t x = BVRandomMix_Private(key+0x9e3779b97f4a7c15ULL*idx);
+  return (PetscReal)((x>>11)+1)*(1.0/9007199254740992.0);   /* uniform in (0,1] */
+}
+
+static inline PetscScalar BVRandomValue_Private(uint64_t key,uint64_t idx)
+{
+#if defined(PETSC_USE_COMPLEX)
+  return PetscCMPLX(BVRandomUniform_Private(key,2*idx),BVRandomUniform_Private(key,2*idx+1));
+#else
+  return BVRandomUniform_Private(key,idx);
+#endif
+}
+
+static inline PetscErrorCode BVRandomGetKey_Private(BV bv,uint64_t *key)
+{
+  unsigned long  seed;
+
+  PetscFunctionBegin;
+  PetscCall(PetscRandomGetSeed(bv->rand,&seed));
+  *key = BVRandomMix_Private((uint64_t)seed^(0x9e3779b97f4a7c15ULL*(uint64_t)++bv->rctr));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static inline PetscErrorCode BVSetRandomColumn_Private(BV bv,PetscInt k)
 {
   PetscInt       i,low,high;
-  PetscScalar    *px,t;
+  PetscScalar    *px;
+  uint64_t       key;
   Vec            x;
 
   PetscFunctionBegin;
   PetscCall(BVGetColumn(bv,k,&x));
   if (bv->rrandom) {  /* generate the same vector irrespective of number of processes */
+    PetscCall(BVRandomGetKey_Private(bv,&key));
     PetscCall(VecGetOwnershipRange(x,&low,&high));
     PetscCall(VecGetArray(x,&px));
-    for (i=0;i<bv->N;i++) {
-      PetscCall(PetscRandomGetValue(bv->rand,&t));
-      if (i>=low && i<high) px[i-low] = t;
-    }
+    for (i=low;i<high;i++) px[i-low] = BVRandomValue_Private(key,(uint64_t)i);
     PetscCall(VecRestoreArray(x,&px));
   } else PetscCall(VecSetRandom(x,bv->rand));
   PetscCall(BVRestoreColumn(bv,k,&x));
@@ -382,23 +422,23 @@ static inline PetscErrorCode BVSetRandomNormalColumn_Private(BV bv,PetscInt k,Ve
 {
   PetscInt       i,low,high;
   PetscScalar    *px,s,t;
+  uint64_t       key;
   Vec            x;
 
   PetscFunctionBegin;
   PetscCall(BVGetColumn(bv,k,&x));
   if (bv->rrandom) {  /* generate the same vector irrespective of number of processes */
+    PetscCall(BVRandomGetKey_Private(bv,&key));
     PetscCall(VecGetOwnershipRange(x,&low,&high));
     PetscCall(VecGetArray(x,&px));
-    for (i=0;i<bv->N;i++) {
-      PetscCall(PetscRandomGetValue(bv->rand,&s));
-      PetscCall(PetscRandomGetValue(bv->rand,&t));
-      if (i>=low && i<high) {
+    for (i=low;i<high;i++) {
+      s = BVRandomValue_Private(key,2*(uint64_t)i);
+      t = BVRandomValue_Private(key,2*(uint64_t)i+1);
 #if defined(PETSC_USE_COMPLEX)
-        px[i-low] = PetscCMPLX(PetscSqrtReal(-2.0*PetscLogReal(PetscRealPart(s)))*PetscCosReal(2.0*PETSC_PI*PetscRealPart(t)),PetscSqrtReal(-2.0*PetscLogReal(PetscImaginaryPart(s)))*PetscCosReal(2.0*PETSC_PI*PetscImaginaryPart(t)));
+      px[i-low] = PetscCMPLX(PetscSqrtReal(-2.0*PetscLogReal(PetscRealPart(s)))*PetscCosReal(2.0*PETSC_PI*PetscRealPart(t)),PetscSqrtReal(-2.0*PetscLogReal(PetscImaginaryPart(s)))*PetscCosReal(2.0*PETSC_PI*PetscImaginaryPart(t)));
 #else
-        px[i-low] = PetscSqrtReal(-2.0*PetscLogReal(s))*PetscCosReal(2.0*PETSC_PI*t);
+      px[i-low] = PetscSqrtReal(-2.0*PetscLogReal(s))*PetscCosReal(2.0*PETSC_PI*t);
 #endif
-      }
     }
     PetscCall(VecRestoreArray(x,&px));
   } else PetscCall(VecSetRandomNormal(x,bv->rand,w1,w2));
@@ -409,18 +449,17 @@ static inline PetscErrorCode BVSetRandomNormalColumn_Private(BV bv,PetscInt k,Ve
 static inline PetscErrorCode BVSetRandomSignColumn_Private(BV bv,PetscInt k)
 {
   PetscInt       i,low,high;
-  PetscScalar    *px,t;
+  PetscScalar    *px;
+  uint64_t       key;
   Vec            x;
 
   PetscFunctionBegin;
   PetscCall(BVGetColumn(bv,k,&x));
   PetscCall(VecGetOwnershipRange(x,&low,&high));
   if (bv->rrandom) {  /* generate the same vector irrespective of number of processes */
+    PetscCall(BVRandomGetKey_Private(bv,&key));
     PetscCall(VecGetArray(x,&px));
-    for (i=0;i<bv->N;i++) {
-      PetscCall(PetscRandomGetValue(bv->rand,&t));
-      if (i>=low && i<high) px[i-low] = (PetscRealPart(t)<0.5)? -1.0: 1.0;
-    }
+    for (i=low;i<high;i++) px[i-low] = (PetscRealPart(BVRandomValue_Private(key,(uint64_t)i))<0.5)? -1.0: 1.0;
     PetscCall(VecRestoreArray(x,&px));
   } else {
     PetscCall(VecSetRandom(x,bv->rand));
@@ -663,6 +702,74 @@ PetscErrorCode BVSetRandomCond(BV bv,PetscReal condn)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  BVMatMultSelect_Private - Resolve BV_MATMULT_AUTO into one of the two actual
+  methods. The winner for a given combination of matrix type, matrix dimensions
+  and block size is looked up in a per-user cache file; if it is not there,
+  both methods are timed on the actual operands and the fastest one is
+  recorded so that future runs skip the measurement.
+*/
+static PetscErrorCode BVMatMultSelect_Private(BV V,Mat A,BV Y)
+{
+  char           fname[PETSC_MAX_PATH_LEN],home[PETSC_MAX_PATH_LEN],mtype[64];
+  MatType        type;
+  MPI_Comm       comm;
+  PetscMPIInt    rank;
+  PetscInt       M,N,bs;
+  long           fM,fN,fbs;
+  int            meth,found=-1;
+  PetscBool      same;
+  FILE           *fd;
+  PetscLogDouble t0,t1,t[2],gt[2];
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)V,&comm));
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  PetscCall(MatGetSize(A,&M,&N));
+  bs = V->k-V->l;
+  PetscCall(MatGetType(A,&type));
+  PetscCall(PetscGetHomeDirectory(home,sizeof(home)));
+  PetscCall(PetscSNPrintf(fname,sizeof(fname),"%s/.slepc_bvmatmult",home));
+  if (!rank) {
+    fd = fopen(fname,"r");
+    if (fd) {
+      while (fscanf(fd,"%63s %ld %ld %ld %d",mtype,&fM,&fN,&fbs,&meth)==5) {
+        PetscCall(PetscStrcmp(mtype,type,&same));
+        if (same && fM==(long)M && fN==(long)N && fbs==(long)bs) { found = meth; break; }
+      }
+      fclose(fd);
+    }
+  }
+  PetscCallMPI(MPI_Bcast(&found,1,MPI_INT,0,comm));
+  if (found==(int)BV_MATMULT_VECS || found==(int)BV_MATMULT_MAT) {
+    V->vmm = (BVMatMultType)found;
+    PetscCall(PetscInfo(V,"Using cached matmult method %s for %s %" PetscInt_FMT "x%" PetscInt_FMT " with %" PetscInt_FMT " columns\n",BVMatMultTypes[V->vmm],type,M,N,bs));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  /* not in the cache, time both methods on the actual operands */
+  V->vmm = BV_MATMULT_VECS;
+  PetscCall(PetscTime(&t0));
+  PetscUseTypeMethod(V,matmult,A,Y);
+  PetscCall(PetscTime(&t1));
+  t[0] = t1-t0;
+  V->vmm = BV_MATMULT_MAT;
+  PetscCall(PetscTime(&t0));
+  PetscUseTypeMethod(V,matmult,A,Y);
+  PetscCall(PetscTime(&t1));
+  t[1] = t1-t0;
+  PetscCall(MPIU_Allreduce(t,gt,2,MPIU_PETSCLOGDOUBLE,MPI_MAX,comm));
+  V->vmm = (gt[0]<gt[1])? BV_MATMULT_VECS: BV_MATMULT_MAT;
+  PetscCall(PetscInfo(V,"Selected matmult method %s (vecs %g seconds, mat %g seconds)\n",BVMatMultTypes[V->vmm],gt[0],gt[1]));
+  if (!rank) {
+    fd = fopen(fname,"a");
+    if (fd) {
+      fprintf(fd,"%s %ld %ld %ld %d\n",type,(long)M,(long)N,(long)bs,(int)V->vmm);
+      fclose(fd);
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    BVMatMult - Computes the matrix-vector product for each column, Y=A*V.
 
@@ -715,6 +822,7 @@ PetscErrorCode BVMatMult(BV V,Mat A,BV Y)
   PetscCheck(V->k-V->l==Y->k-Y->l,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_SIZ,"Y has %" PetscInt_FMT " active columns, should match %" PetscInt_FMT " active columns in V",Y->k-Y->l,V->k-V->l);
 
   PetscCall(PetscLogEventBegin(BV_MatMult,V,A,Y,0));
+  if (PetscUnlikely(V->vmm==BV_MATMULT_AUTO)) PetscCall(BVMatMultSelect_Private(V,A,Y));
   PetscUseTypeMethod(V,matmult,A,Y);
   PetscCall(PetscLogEventEnd(BV_MatMult,V,A,Y,0));
   PetscCall(PetscObjectStateIncrease((PetscObject)Y));
@@ -798,7 +906,9 @@ PetscErrorCode BVMatMultTranspose(BV V,Mat A,BV Y)
    The number of active columns in V and Y should match, although they need
    not be the same columns.
 
-   Currently implemented via MatCreateHermitianTranspose().
+   Currently implemented by conjugating the panels and reusing the batched
+   product of BVMatMult() with the transpose, so the method selected with
+   BVSetMatMultMethod() also applies here.
 
    Level: beginner
 
@@ -806,8 +916,11 @@ PetscErrorCode BVMatMultTranspose(BV V,Mat A,BV Y)
 @*/
 PetscErrorCode BVMatMultHermitianTranspose(BV V,Mat A,BV Y)
 {
-  PetscInt       j,M,N,m,n;
+  PetscInt       M,N,m,n;
+#if defined(PETSC_USE_COMPLEX)
+  PetscInt       j;
   Vec            v,y;
+#endif
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(V,BV_CLASSID,1);
@@ -829,18 +942,42 @@ PetscErrorCode BVMatMultHermitianTranspose(BV V,Mat A,BV Y)
   PetscCheck(n==Y->n,PetscObjectComm((PetscObject)Y),PETSC_ERR_ARG_INCOMP,"Mismatching local column dimension A %" PetscInt_FMT ", Y %" PetscInt_FMT,n,Y->n);
   PetscCheck(V->k-V->l==Y->k-Y->l,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_SIZ,"Y has %" PetscInt_FMT " active columns, should match %" PetscInt_FMT " active columns in V",Y->k-Y->l,V->k-V->l);
 
-  /* TODO: recover this code if PETSc ever gets MATPRODUCT_AhB done
-  PetscCall(MatCreateHermitianTranspose(A,&AH));
-  PetscCall(BVMatMult(V,AH,Y));
-  PetscCall(MatDestroy(&AH));
-  */
-  for (j=0;j<V->k-V->l;j++) {
-    PetscCall(BVGetColumn(V,V->l+j,&v));
-    PetscCall(BVGetColumn(Y,Y->l+j,&y));
-    PetscCall(MatMultHermitianTranspose(A,v,y));
-    PetscCall(BVRestoreColumn(V,V->l+j,&v));
-    PetscCall(BVRestoreColumn(Y,Y->l+j,&y));
+#if defined(PETSC_USE_COMPLEX)
+  /* use A^H*V = conj(A^T*conj(V)) so that the batched Mat-Mat product path
+     can be taken; the three conjugation passes over the panels are negligible
+     compared with the gain of a single product (replace with MATPRODUCT_AhB
+     if PETSc ever gets it done) */
+  {
+    Mat AT;
+    PetscCall(MatCreateTranspose(A,&AT));
+    for (j=V->l;j<V->k;j++) {
+      PetscCall(BVGetColumn(V,j,&v));
+      PetscCall(VecConjugate(v));
+      PetscCall(BVRestoreColumn(V,j,&v));
+    }
+    PetscCall(BVMatMult(V,AT,Y));
+    for (j=V->l;j<V->k;j++) {  /* leave V unchanged */
+      PetscCall(BVGetColumn(V,j,&v));
+      PetscCall(VecConjugate(v));
+      PetscCall(BVRestoreColumn(V,j,&v));
+    }
+    for (j=Y->l;j<Y->k;j++) {
+      PetscCall(BVGetColumn(Y,j,&y));
+      PetscCall(VecConjugate(y));
+      PetscCall(BVRestoreColumn(Y,j,&y));
+    }
+    PetscCall(MatDestroy(&AT));
   }
+#else
+  /* in real scalars the Hermitian transpose coincides with the transpose,
+     so the batched Mat-Mat product path can be used */
+  {
+    Mat AT;
+    PetscCall(MatCreateTranspose(A,&AT));
+    PetscCall(BVMatMult(V,AT,Y));
+    PetscCall(MatDestroy(&AT));
+  }
+#endif
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -99,6 +99,12 @@ static PetscErrorCode BVOrthogonalizeCGS1(BV bv,PetscInt j,Vec v,PetscBool *whic
     if (!v) {
       PetscCall(BVDotColumnInc(bv,j,c));
       PetscCall(BV_SquareRoot(bv,j,c,&beta));
+    } else if (bv->ops->dotvec_begin || bv->ops->dotvec_local) {
+      /* batch the coefficients and the norm in a single split-phase reduction */
+      PetscCall(BVDotVecBegin(bv,v,c));
+      PetscCall(BVNormVecBegin(bv,v,NORM_2,&beta));
+      PetscCall(BVDotVecEnd(bv,v,c));
+      PetscCall(BVNormVecEnd(bv,v,NORM_2,&beta));
     } else {
       PetscCall(BVDotVec(bv,v,c));
       PetscCall(BVNormVec(bv,v,NORM_2,&beta));
@@ -200,6 +206,13 @@ static PetscErrorCode BVOrthogonalizeGS(BV bv,PetscInt j,Vec v,PetscBool *which,
     /* linear dependence check: criterion not satisfied in the second iteration */
     if (dolindep) *lindep = PetscNot(nrm && PetscAbsReal(nrm) >= bv->orthog_eta*PetscAbsReal(onrm));
     break;
+
+  case BV_ORTHOG_REFINE_FUSED:
+    /* single sweep, with the norm estimated from the combined reduction */
+    PetscCall(BVOrthogonalizeGS1(bv,k,v,which,h,c,&onrm,&nrm));
+    /* linear dependence check: same criterion as in the ifneeded case */
+    if (dolindep) *lindep = PetscNot(nrm && PetscAbsReal(nrm) >= bv->orthog_eta*PetscAbsReal(onrm));
+    break;
   }
   if (signature) {
     PetscCall(VecGetArray(bv->omega,&omega));
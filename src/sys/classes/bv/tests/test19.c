@@ -0,0 +1,105 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Benchmark BV block operations.\n\n"
+  "Times BVMult, BVDot and BVOrthogonalize on randomly generated bases and\n"
+  "reports the median wall time over a number of repetitions. By default only\n"
+  "the configuration is printed, so that the output does not depend on the\n"
+  "machine; use -json to print the measured times in machine-readable form.\n\n";
+
+#include <slepcbv.h>
+#include <petsctime.h>
+
+int main(int argc,char **argv)
+{
+  Vec            t;
+  Mat            Q,M;
+  BV             X,Y;
+  BVType         type;
+  PetscInt       i,n=5000,k=16,reps=5;
+  PetscLogDouble t0,t1;
+  PetscReal      *times,med[3];
+  PetscBool      json;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-k",&k,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-reps",&reps,NULL));
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-json",&json));
+  PetscCheck(reps>0,PETSC_COMM_WORLD,PETSC_ERR_USER_INPUT,"The number of repetitions must be at least 1");
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Benchmark of BV operations with %" PetscInt_FMT " columns of dimension %" PetscInt_FMT " (%" PetscInt_FMT " repetitions).\n",k,n,reps));
+
+  /* Create template vector and work BV's */
+  PetscCall(VecCreate(PETSC_COMM_WORLD,&t));
+  PetscCall(VecSetSizes(t,PETSC_DECIDE,n));
+  PetscCall(VecSetFromOptions(t));
+  PetscCall(BVCreate(PETSC_COMM_WORLD,&X));
+  PetscCall(BVSetSizesFromVec(X,t,k));
+  PetscCall(BVSetFromOptions(X));
+  PetscCall(BVDuplicate(X,&Y));
+  PetscCall(BVSetRandom(X));
+  PetscCall(BVSetRandom(Y));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,k,NULL,&Q));
+  PetscCall(MatSetRandom(Q,NULL));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,k,NULL,&M));
+  PetscCall(PetscMalloc1(reps,&times));
+
+  /* BVMult */
+  for (i=0;i<reps;i++) {
+    PetscCall(PetscTime(&t0));
+    PetscCall(BVMult(Y,1.0,0.0,X,Q));
+    PetscCall(PetscTime(&t1));
+    times[i] = (PetscReal)(t1-t0);
+  }
+  PetscCall(PetscSortReal(reps,times));
+  med[0] = times[reps/2];
+
+  /* BVDot */
+  for (i=0;i<reps;i++) {
+    PetscCall(PetscTime(&t0));
+    PetscCall(BVDot(X,Y,M));
+    PetscCall(PetscTime(&t1));
+    times[i] = (PetscReal)(t1-t0);
+  }
+  PetscCall(PetscSortReal(reps,times));
+  med[1] = times[reps/2];
+
+  /* BVOrthogonalize, refilling the basis before each repetition */
+  for (i=0;i<reps;i++) {
+    PetscCall(BVSetRandom(X));
+    PetscCall(PetscTime(&t0));
+    PetscCall(BVOrthogonalize(X,NULL));
+    PetscCall(PetscTime(&t1));
+    times[i] = (PetscReal)(t1-t0);
+  }
+  PetscCall(PetscSortReal(reps,times));
+  med[2] = times[reps/2];
+
+  PetscCall(BVGetType(X,&type));
+  if (json) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"{\"bv\": {\"type\": \"%s\", \"n\": %" PetscInt_FMT ", \"k\": %" PetscInt_FMT ", \"reps\": %" PetscInt_FMT ", \"BVMult\": %g, \"BVDot\": %g, \"BVOrthogonalize\": %g}}\n",type,n,k,reps,(double)med[0],(double)med[1],(double)med[2]));
+
+  PetscCall(PetscFree(times));
+  PetscCall(MatDestroy(&Q));
+  PetscCall(MatDestroy(&M));
+  PetscCall(BVDestroy(&X));
+  PetscCall(BVDestroy(&Y));
+  PetscCall(VecDestroy(&t));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -bv_type {{vecs contiguous svec mat}} -n 200 -k 8 -reps 3
+
+TEST*/
@@ -113,6 +113,10 @@ int main(int argc,char **argv)
       test:
          suffix: 3
          args: -bv_type {{vecs contiguous svec mat}shared output} -bv_orthog_refine always
+      test:
+         suffix: 3_fused
+         args: -bv_type {{vecs contiguous svec mat}shared output} -bv_orthog_refine fused
+         requires: !single
       test:
          suffix: 4
          args: -bv_type {{vecs contiguous svec mat}shared output} -bv_orthog_type mgs
@@ -15,54 +15,46 @@
 #include <slepcblaslapack.h>
 
 /*
-   Compute the (real) Schur form of A. At the end, A is (quasi-)triangular and Q
-   contains the unitary matrix of Schur vectors. Eigenvalues are returned in wr,wi
+   Computational kernel of DSSolve_NHEP_Private, operating on plain arrays.
+   The LAPACK routines are invoked directly and the info arguments returned to
+   the caller, without any access to PETSc global state, so that independent
+   instances can run concurrently on different threads
 */
-PetscErrorCode DSSolve_NHEP_Private(DS ds,DSMatType mA,DSMatType mQ,PetscScalar *wr,PetscScalar *wi)
+void DSSolveKernel_NHEP_Private(PetscBLASInt n,PetscBLASInt ld,PetscBLASInt ilo,PetscBool reduce,PetscInt l,PetscScalar *A,PetscScalar *Q,PetscScalar *wr,PetscScalar *wi,PetscScalar *tau,PetscScalar *work,PetscBLASInt lwork,PetscBLASInt *infog,PetscBLASInt *infoh)
 {
-  PetscScalar    *work,*tau,*A,*Q;
-  PetscInt       i,j;
-  PetscBLASInt   ilo,lwork,info,n,k,ld;
+  PetscInt i,j;
 
-  PetscFunctionBegin;
-  PetscCall(MatDenseGetArray(ds->omat[mA],&A));
-  PetscCall(MatDenseGetArray(ds->omat[mQ],&Q));
-  PetscCall(PetscBLASIntCast(ds->n,&n));
-  PetscCall(PetscBLASIntCast(ds->ld,&ld));
-  PetscCall(PetscBLASIntCast(ds->l+1,&ilo));
-  PetscCall(PetscBLASIntCast(ds->k,&k));
-  PetscCall(DSAllocateWork_Private(ds,ld+6*ld,0,0));
-  tau  = ds->work;
-  work = ds->work+ld;
-  lwork = 6*ld;
+  *infog = 0;
+  *infoh = 0;
 
   /* initialize orthogonal matrix */
-  PetscCall(PetscArrayzero(Q,ld*ld));
+  for (i=0;i<ld*ld;i++) Q[i] = 0.0;
   for (i=0;i<n;i++) Q[i+i*ld] = 1.0;
   if (n==1) { /* quick return */
     wr[0] = A[0];
     if (wi) wi[0] = 0.0;
-    PetscFunctionReturn(PETSC_SUCCESS);
+    return;
   }
 
   /* reduce to upper Hessenberg form */
-  if (ds->state<DS_STATE_INTERMEDIATE) {
-    PetscCallBLAS("LAPACKgehrd",LAPACKgehrd_(&n,&ilo,&n,A,&ld,tau,work,&lwork,&info));
-    SlepcCheckLapackInfo("gehrd",info);
+  if (reduce) {
+    LAPACKgehrd_(&n,&ilo,&n,A,&ld,tau,work,&lwork,infog);
+    if (*infog) return;
     for (j=0;j<n-1;j++) {
       for (i=j+2;i<n;i++) {
         Q[i+j*ld] = A[i+j*ld];
         A[i+j*ld] = 0.0;
       }
     }
-    PetscCallBLAS("LAPACKorghr",LAPACKorghr_(&n,&ilo,&n,Q,&ld,tau,work,&lwork,&info));
-    SlepcCheckLapackInfo("orghr",info);
+    LAPACKorghr_(&n,&ilo,&n,Q,&ld,tau,work,&lwork,infog);
+    if (*infog) return;
   }
 
   /* compute the (real) Schur form */
 #if !defined(PETSC_USE_COMPLEX)
-  PetscCallBLAS("LAPACKhseqr",LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,wi,Q,&ld,work,&lwork,&info));
-  for (j=0;j<ds->l;j++) {
+  LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,wi,Q,&ld,work,&lwork,infoh);
+  if (*infoh) return;
+  for (j=0;j<l;j++) {
     if (j==n-1 || A[j+1+j*ld] == 0.0) {
       /* real eigenvalue */
       wr[j] = A[j+j*ld];
@@ -77,10 +69,34 @@ PetscErrorCode DSSolve_NHEP_Private(DS ds,DSMatType mA,DSMatType mQ,PetscScalar
     }
   }
 #else
-  PetscCallBLAS("LAPACKhseqr",LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,Q,&ld,work,&lwork,&info));
-  if (wi) for (i=ds->l;i<n;i++) wi[i] = 0.0;
+  LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,Q,&ld,work,&lwork,infoh);
+  if (wi) for (i=l;i<n;i++) wi[i] = 0.0;
 #endif
-  SlepcCheckLapackInfo("hseqr",info);
+}
+
+/*
+   Compute the (real) Schur form of A. At the end, A is (quasi-)triangular and Q
+   contains the unitary matrix of Schur vectors. Eigenvalues are returned in wr,wi
+*/
+PetscErrorCode DSSolve_NHEP_Private(DS ds,DSMatType mA,DSMatType mQ,PetscScalar *wr,PetscScalar *wi)
+{
+  PetscScalar    *work,*tau,*A,*Q;
+  PetscBLASInt   ilo,lwork,infog,infoh,n,ld;
+
+  PetscFunctionBegin;
+  PetscCall(MatDenseGetArray(ds->omat[mA],&A));
+  PetscCall(MatDenseGetArray(ds->omat[mQ],&Q));
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->l+1,&ilo));
+  PetscCall(DSAllocateWork_Private(ds,ld+6*ld,0,0));
+  tau  = ds->work;
+  work = ds->work+ld;
+  lwork = 6*ld;
+
+  DSSolveKernel_NHEP_Private(n,ld,ilo,(ds->state<DS_STATE_INTERMEDIATE)?PETSC_TRUE:PETSC_FALSE,ds->l,A,Q,wr,wi,tau,work,lwork,&infog,&infoh);
+  SlepcCheckLapackInfo("gehrd",infog);
+  SlepcCheckLapackInfo("hseqr",infoh);
   PetscCall(MatDenseRestoreArray(ds->omat[mA],&A));
   PetscCall(MatDenseRestoreArray(ds->omat[mQ],&Q));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -93,7 +109,7 @@ PetscErrorCode DSSolve_NHEP_Private(DS ds,DSMatType mA,DSMatType mQ,PetscScalar
 PetscErrorCode DSSort_NHEP_Total(DS ds,DSMatType mT,DSMatType mQ,PetscScalar *wr,PetscScalar *wi)
 {
   PetscScalar    re,*T,*Q;
-  PetscInt       i,j,pos,result;
+  PetscInt       i,j,pos,result,last;
   PetscBLASInt   ifst,ilst,info,n,ld;
 #if !defined(PETSC_USE_COMPLEX)
   PetscScalar    *work,im;
@@ -108,8 +124,10 @@ PetscErrorCode DSSort_NHEP_Total(DS ds,DSMatType mT,DSMatType mQ,PetscScalar *wr
   PetscCall(DSAllocateWork_Private(ds,ld,0,0));
   work = ds->work;
 #endif
-  /* selection sort */
-  for (i=ds->l;i<n-1;i++) {
+  /* selection sort; if a sort window has been given, stop as soon as the
+     leading positions are in order and leave the trailing block unordered */
+  last = (ds->swindow>0)? PetscMin(ds->l+ds->swindow,n-1): n-1;
+  for (i=ds->l;i<last;i++) {
     re = wr[i];
 #if !defined(PETSC_USE_COMPLEX)
     im = wi[i];
@@ -503,6 +503,144 @@ static PetscErrorCode DSSolve_GSVD(DS ds,PetscScalar *wr,PetscScalar *wi)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if !defined(SLEPC_MISSING_LAPACK_ORCSD2BY1)
+/*
+  Alternative solver based on a blocked two-stage approach: a QR factorization
+  of the stacked matrix [A;B] followed by the CS decomposition of the
+  orthonormal factor. Both stages are rich in BLAS-3 operations, as opposed to
+  the mostly unblocked _ggsvd. Requires m>=n and p>=n.
+*/
+static PetscErrorCode DSSolve_GSVD_CSD(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  DS_GSVD        *ctx = (DS_GSVD*)ds->data;
+  PetscInt       i,j;
+  PetscBLASInt   n1,m1,p1,mp,info,lc = 0,n = 0,m = 0,p = 0,ld,off,lwork,lw1;
+  PetscScalar    *A,*B,*X,*U,*V,*Z,*R,*V1T,*tau,*work,a,dummy,sone=1.0;
+  PetscReal      *alpha,*beta,*theta,*T,*D,rdummy;
+  PetscBLASInt   idummy;
+#if defined(PETSC_USE_COMPLEX)
+  PetscBLASInt   lrwork=-1;
+  PetscReal      b;
+#endif
+
+  PetscFunctionBegin;
+  PetscCheck(ctx->m,PetscObjectComm((PetscObject)ds),PETSC_ERR_ORDER,"You should set the other dimensions with DSGSVDSetDimensions()");
+  PetscCall(PetscBLASIntCast(ds->n,&m));
+  PetscCall(PetscBLASIntCast(ctx->m,&n));
+  PetscCall(PetscBLASIntCast(ctx->p,&p));
+  PetscCall(PetscBLASIntCast(ds->l,&lc));
+  PetscCheck(ds->compact || lc==0,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"DSGSVD with non-compact format does not support locking");
+  /* In compact storage B is always nxn and A can be either nxn or (n+1)xn */
+  PetscCheck(!ds->compact || (p==n && (m==p || m==p+1)),PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"Dimensions not supported in compact format");
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  n1 = n-lc;     /* n1 = size of leading block, excl. locked + size of trailing block */
+  m1 = m-lc;
+  p1 = p-lc;
+  PetscCheck(m1>=n1 && p1>=n1,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"The CS decomposition method requires m>=n and p>=n");
+  mp  = m1+p1;
+  off = lc+lc*ld;
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_B],&B));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_X],&X));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_U],&U));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_V],&V));
+  PetscCall(PetscArrayzero(X,ld*ld));
+  for (i=0;i<lc;i++) X[i+i*ld] = 1.0;
+  PetscCall(PetscArrayzero(U,ld*ld));
+  for (i=0;i<lc;i++) U[i+i*ld] = 1.0;
+  PetscCall(PetscArrayzero(V,ld*ld));
+  for (i=0;i<lc;i++) V[i+i*ld] = 1.0;
+  if (ds->compact) PetscCall(DSSwitchFormat_GSVD(ds));
+
+  /* workspace query and memory allocation */
+  lwork = -1;
+  PetscCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&mp,&n1,&dummy,&mp,&dummy,&a,&lwork,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(a),&lw1));
+  PetscCallBLAS("LAPACKorgqr",LAPACKorgqr_(&mp,&n1,&n1,&dummy,&mp,&dummy,&a,&lwork,&info));
+  lw1 = PetscMax(lw1,(PetscBLASInt)PetscRealPart(a));
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKorcsd2by1",LAPACKorcsd2by1_("Y","Y","Y",&mp,&m1,&n1,&dummy,&mp,&dummy,&mp,&rdummy,&dummy,&ld,&dummy,&ld,&dummy,&n1,&a,&lwork,&idummy,&info));
+  lwork = PetscMax(lw1,(PetscBLASInt)PetscRealPart(a));
+  PetscCall(DSAllocateWork_Private(ds,mp*n1+2*n1*n1+n1+lwork,2*ds->ld+n1,mp));
+#else
+  PetscCallBLAS("LAPACKorcsd2by1",LAPACKorcsd2by1_("Y","Y","Y",&mp,&m1,&n1,&dummy,&mp,&dummy,&mp,&rdummy,&dummy,&ld,&dummy,&ld,&dummy,&n1,&a,&lwork,&b,&lrwork,&idummy,&info));
+  lwork = PetscMax(lw1,(PetscBLASInt)PetscRealPart(a));
+  PetscCall(PetscBLASIntCast((PetscInt)b,&lrwork));
+  PetscCall(DSAllocateWork_Private(ds,mp*n1+2*n1*n1+n1+lwork,2*ds->ld+n1+lrwork,mp));
+#endif
+  Z    = ds->work;
+  R    = Z+mp*n1;
+  V1T  = R+n1*n1;
+  tau  = V1T+n1*n1;
+  work = tau+n1;
+
+  /* stack [A;B] and compute its QR factorization, keeping R apart */
+  for (j=0;j<n1;j++) {
+    PetscCall(PetscArraycpy(Z+j*mp,A+off+j*ld,m1));
+    PetscCall(PetscArraycpy(Z+j*mp+m1,B+off+j*ld,p1));
+  }
+  PetscCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&mp,&n1,Z,&mp,tau,work,&lwork,&info));
+  SlepcCheckLapackInfo("geqrf",info);
+  PetscCall(PetscArrayzero(R,n1*n1));
+  for (j=0;j<n1;j++) PetscCall(PetscArraycpy(R+j*n1,Z+j*mp,j+1));
+  PetscCallBLAS("LAPACKorgqr",LAPACKorgqr_(&mp,&n1,&n1,Z,&mp,tau,work,&lwork,&info));
+  SlepcCheckLapackInfo("orgqr",info);
+
+  /* CS decomposition of the orthonormal factor */
+  theta = ds->rwork+2*ds->ld;
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKorcsd2by1",LAPACKorcsd2by1_("Y","Y","Y",&mp,&m1,&n1,Z,&mp,Z+m1,&mp,theta,U+off,&ld,V+off,&ld,V1T,&n1,work,&lwork,ds->iwork,&info));
+#else
+  PetscCallBLAS("LAPACKorcsd2by1",LAPACKorcsd2by1_("Y","Y","Y",&mp,&m1,&n1,Z,&mp,Z+m1,&mp,theta,U+off,&ld,V+off,&ld,V1T,&n1,work,&lwork,ds->rwork+2*ds->ld+n1,&lrwork,ds->iwork,&info));
+#endif
+  SlepcCheckLapackInfo("orcsd2by1",info);
+
+  /* X = inv(R)*V1 */
+  for (i=0;i<n1;i++)
+    for (j=0;j<n1;j++) X[off+i+j*ld] = PetscConj(V1T[j+i*n1]);
+  PetscCallBLAS("BLAStrsm",BLAStrsm_("L","U","N","N",&n1,&n1,&sone,R,&n1,X+off,&ld));
+
+  alpha = ds->rwork;
+  beta  = ds->rwork+ds->ld;
+  for (i=0;i<n1;i++) {
+    alpha[i] = PetscCosReal(theta[i]);
+    beta[i]  = PetscSinReal(theta[i]);
+  }
+  if (ds->compact) {
+    PetscCall(DSGetArrayReal(ds,DS_MAT_T,&T));
+    PetscCall(DSGetArrayReal(ds,DS_MAT_D,&D));
+    PetscCall(PetscArrayzero(T+ld,m-1));
+    PetscCall(PetscArrayzero(T+2*ld,n-1));
+    for (i=lc;i<n;i++) {
+      T[i] = alpha[i-lc];
+      D[i] = beta[i-lc];
+      if (D[i]==0.0) wr[i] = PETSC_INFINITY;
+      else wr[i] = T[i]/D[i];
+    }
+    ds->t = n;
+    PetscCall(DSRestoreArrayReal(ds,DS_MAT_D,&D));
+    PetscCall(DSRestoreArrayReal(ds,DS_MAT_T,&T));
+  } else {
+    /* singular values */
+    PetscCall(PetscArrayzero(A,ld*ld));
+    PetscCall(PetscArrayzero(B,ld*ld));
+    for (j=0;j<n;j++) {
+      A[j*(1+ld)] = alpha[j];
+      B[j*(1+ld)] = beta[j];
+      if (beta[j]==0.0) wr[j] = PETSC_INFINITY;
+      else wr[j] = alpha[j]/beta[j];
+    }
+    ds->t = n; /* set number of computed values */
+  }
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_B],&B));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_X],&X));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_U],&U));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_V],&V));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 static PetscErrorCode DSCond_GSVD(DS ds,PetscReal *cond)
 {
   DS_GSVD           *ctx = (DS_GSVD*)ds->data;
@@ -790,7 +928,8 @@ static PetscErrorCode DSDestroy_GSVD(DS ds)
 -  DS_MAT_D - second upper bidiagonal matrix (if compact storage is selected)
 
    Implemented methods:
-.  0 - Lapack (_ggsvd3 if available, or _ggsvd)
++  0 - Lapack (_ggsvd3 if available, or _ggsvd)
+-  1 - QR factorization of [A;B] followed by the CS decomposition (_orcsd2by1)
 
 .seealso: DSCreate(), DSSetType(), DSType, DSGSVDSetDimensions()
 M*/
@@ -807,6 +946,9 @@ SLEPC_EXTERN PetscErrorCode DSCreate_GSVD(DS ds)
   ds->ops->vectors       = DSVectors_GSVD;
   ds->ops->sort          = DSSort_GSVD;
   ds->ops->solve[0]      = DSSolve_GSVD;
+#if !defined(SLEPC_MISSING_LAPACK_ORCSD2BY1)
+  ds->ops->solve[1]      = DSSolve_GSVD_CSD;
+#endif
 #if !defined(PETSC_HAVE_MPIUNI)
   ds->ops->synchronize   = DSSynchronize_GSVD;
 #endif
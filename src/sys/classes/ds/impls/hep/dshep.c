@@ -84,7 +84,9 @@ static PetscErrorCode DSView_HEP(DS ds,PetscViewer viewer)
                      "Implicit QR method (_steqr)",
                      "Relatively Robust Representations (_stevr)",
                      "Divide and Conquer method (_stedc)",
-                     "Block Divide and Conquer method (dsbtdc)"
+                     "Block Divide and Conquer method (dsbtdc)",
+                     "Divide and Conquer method on GPU (_syevd, MAGMA)",
+                     "Band storage Divide and Conquer method (_sbevd)"
   };
   const int         nmeth=PETSC_STATIC_ARRAY_LENGTH(methodname);
 
@@ -220,14 +222,23 @@ static PetscErrorCode DSVectors_HEP(DS ds,DSMatType mat,PetscInt *j,PetscReal *r
 */
 PetscErrorCode DSArrowTridiag(PetscBLASInt n,PetscReal *d,PetscReal *e,PetscScalar *Q,PetscBLASInt ld)
 {
-  PetscBLASInt i,j,j2,one=1;
-  PetscReal    c,s,p,off,temp;
+  PetscBLASInt i,j,j2;
+  PetscReal    c,s,p,off,temp,*cc,*ss;
 
   PetscFunctionBegin;
   if (n<=2) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscMalloc2(n-1,&cc,n-1,&ss));
 
   for (j=0;j<n-2;j++) {
 
+    /* Deflate negligible entries, frequent after restarts with converged pairs;
+       setting them to zero perturbs the matrix by O(eps)*norm(A) and avoids the
+       rotation chase below, which would consist of near-identity rotations */
+    if (PetscAbsReal(e[j])<=PETSC_MACHINE_EPSILON*(PetscAbsReal(d[j])+PetscAbsReal(d[n-1]))) {
+      e[j] = 0.0;
+      continue;
+    }
+
     /* Eliminate entry e(j) by a rotation in the planes (j,j+1) */
     temp = e[j+1];
     PetscCallBLAS("LAPACKlartg",LAPACKREALlartg_(&temp,&e[j],&c,&s,&e[j+1]));
@@ -238,10 +249,8 @@ PetscErrorCode DSArrowTridiag(PetscBLASInt n,PetscReal *d,PetscReal *e,PetscScal
     e[j]   = c*s*(temp-d[j]);
     d[j+1] = s*s*d[j] + c*c*temp;
     d[j]   = c*c*d[j] + s*s*temp;
-
-    /* Apply rotation to Q */
-    j2 = j+2;
-    PetscCallBLAS("BLASrot",BLASMIXEDrot_(&j2,Q+j*ld,&one,Q+(j+1)*ld,&one,&c,&s));
+    cc[j] = c;
+    ss[j] = s;
 
     /* Chase newly introduced off-diagonal entry to the top left corner */
     for (i=j-1;i>=0;i--) {
@@ -255,10 +264,16 @@ PetscErrorCode DSArrowTridiag(PetscBLASInt n,PetscReal *d,PetscReal *e,PetscScal
       d[i+1] += p;
       d[i] -= p;
       e[i] = -e[i] - c*temp;
-      j2 = j+2;
-      PetscCallBLAS("BLASrot",BLASMIXEDrot_(&j2,Q+i*ld,&one,Q+(i+1)*ld,&one,&c,&s));
+      cc[i] = c;
+      ss[i] = s;
     }
+
+    /* Accumulate the rotation sequence of this sweep into Q with a single
+       blocked update, instead of applying the rotations one at a time */
+    j2 = j+2;
+    PetscCallBLAS("LAPACKlasr",LAPACKlasr_("R","V","B",&j2,&j2,cc,ss,Q,&ld));
   }
+  PetscCall(PetscFree2(cc,ss));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -640,6 +655,141 @@ static PetscErrorCode DSSolve_HEP_BDC(DS ds,PetscScalar *wr,PetscScalar *wi)
 }
 #endif
 
+/*
+   DSSolve_HEP_Band - Band solver for the case of a block tridiagonal A, as
+   generated by block-Lanczos. The band of A (bandwidth equal to the block
+   size) is packed into LAPACK band storage and solved with _sbevd, so the
+   cost is O(n^2*bs) instead of the O(n^3) of the dense reduction.
+*/
+static PetscErrorCode DSSolve_HEP_Band(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  PetscInt       i,j;
+  PetscBLASInt   info,kd = 0,ldab,n = 0,ld = 0,lwork,liwork;
+  PetscScalar    *Q,*A,*AB,*work;
+  PetscReal      *w;
+#if defined(PETSC_USE_COMPLEX)
+  PetscBLASInt   lrwork;
+  PetscReal      *rwork;
+#endif
+
+  PetscFunctionBegin;
+  PetscCheck(ds->l==0,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"This method is not prepared for l>1");
+  PetscCheck(!ds->compact,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"Not implemented for compact storage");
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->bs,&kd));   /* the bandwidth equals the block size */
+  ldab = kd+1;
+  liwork = 3+5*n;
+#if !defined(PETSC_USE_COMPLEX)
+  lwork = 1+5*n+2*n*n;
+  PetscCall(DSAllocateWork_Private(ds,ldab*n+lwork,n,liwork));
+  w = ds->rwork;
+#else
+  lwork = 2*n*n;
+  lrwork = 1+5*n+2*n*n;
+  PetscCall(DSAllocateWork_Private(ds,ldab*n+lwork,n+lrwork,liwork));
+  w = ds->rwork;
+  rwork = ds->rwork+n;
+#endif
+  AB   = ds->work;
+  work = ds->work+ldab*n;
+
+  /* Pack the lower band of A in LAPACK band storage */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  for (j=0;j<n;j++)
+    for (i=j;i<PetscMin((PetscInt)n,j+kd+1);i++)
+      AB[i-j+j*ldab] = A[i+j*ld];
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+
+  /* Solve the band eigenproblem */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Q],&Q));
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKsbevd",LAPACKsbevd_("V","L",&n,&kd,AB,&ldab,w,Q,&ld,work,&lwork,ds->iwork,&liwork,&info));
+#else
+  PetscCallBLAS("LAPACKsbevd",LAPACKsbevd_("V","L",&n,&kd,AB,&ldab,w,Q,&ld,work,&lwork,rwork,&lrwork,ds->iwork,&liwork,&info));
+#endif
+  SlepcCheckLapackInfo("sbevd",info);
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Q],&Q));
+  for (i=0;i<ds->n;i++) wr[i] = w[i];
+
+  /* Create diagonal matrix as a result */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  for (i=0;i<ds->n;i++) PetscCall(PetscArrayzero(A+i*ld,ds->n));
+  for (i=0;i<ds->n;i++) A[i+i*ld] = w[i];
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+
+  /* Set zero wi */
+  if (wi) for (i=0;i<ds->n;i++) wi[i] = 0.0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+#if defined(PETSC_HAVE_MAGMA)
+#include <slepcmagma.h>
+
+static PetscErrorCode DSSolve_HEP_MAGMA(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  PetscInt          i,j;
+  PetscBLASInt      n1,lwork,liwork,l = 0,n = 0,ld,off;
+  PetscScalar       *Q,*A,*work;
+  const PetscScalar *As;
+  PetscReal         *d,*e,*w;
+#if defined(PETSC_USE_COMPLEX)
+  PetscBLASInt      lrwork;
+#endif
+
+  PetscFunctionBegin;
+  PetscCheck(ds->bs==1,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"This method is not prepared for bs>1");
+  PetscCall(SlepcMagmaInit());
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->l,&l));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  n1 = n-l;     /* n1 = size of leading block, excl. locked + size of trailing block */
+  off = l+l*ld;
+  if (ds->compact) PetscCall(DSSwitchFormat_HEP(ds));
+  PetscCall(DSGetArrayReal(ds,DS_MAT_T,&d));
+  e = d+ld;
+
+  /* Copy the active block to Q and diagonalize it on the GPU */
+  PetscCall(DSSetIdentity(ds,DS_MAT_Q));
+  PetscCall(MatDenseGetArrayRead(ds->omat[DS_MAT_A],&As));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Q],&Q));
+  for (j=l;j<n;j++) PetscCall(PetscArraycpy(Q+l+j*ld,As+l+j*ld,n-l));
+  PetscCall(MatDenseRestoreArrayRead(ds->omat[DS_MAT_A],&As));
+  liwork = 5*n1+3;
+  PetscCall(DSAllocateWork_Private(ds,0,0,liwork));
+  /* scalar and real workspaces are taken from the pinned buffer reused across calls */
+#if !defined(PETSC_USE_COMPLEX)
+  lwork = 2*n1*n1+6*n1+1;
+  PetscCall(SlepcMagmaGetWorkspace(sizeof(PetscScalar)*lwork+sizeof(PetscReal)*n,(void**)&work));
+  w = (PetscReal*)(work+lwork);
+  PetscCallMAGMA(magma_xsyevd,MagmaVec,MagmaLower,n1,Q+off,ld,w,work,lwork,ds->iwork,liwork);
+#else
+  lwork  = n1*n1+2*n1;
+  lrwork = 2*n1*n1+5*n1+1;
+  PetscCall(SlepcMagmaGetWorkspace(sizeof(PetscScalar)*lwork+sizeof(PetscReal)*(n+lrwork),(void**)&work));
+  w = (PetscReal*)(work+lwork);
+  PetscCallMAGMA(magma_xsyevd,MagmaVec,MagmaLower,n1,Q+off,ld,w,work,lwork,w+n,lrwork,ds->iwork,liwork);
+#endif
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Q],&Q));
+  for (i=0;i<l;i++) wr[i] = d[i];
+  for (i=l;i<n;i++) { wr[i] = w[i-l]; d[i] = w[i-l]; }
+
+  /* Create diagonal matrix as a result */
+  if (ds->compact) PetscCall(PetscArrayzero(e,n-1));
+  else {
+    PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+    for (i=l;i<n;i++) PetscCall(PetscArrayzero(A+l+i*ld,n-l));
+    for (i=l;i<n;i++) A[i+i*ld] = d[i];
+    PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+  }
+  PetscCall(DSRestoreArrayReal(ds,DS_MAT_T,&d));
+
+  /* Set zero wi */
+  if (wi) for (i=l;i<n;i++) wi[i] = 0.0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 static PetscErrorCode DSTruncate_HEP(DS ds,PetscInt n,PetscBool trim)
 {
   PetscInt    i,ld=ds->ld,l=ds->l;
@@ -837,7 +987,9 @@ static PetscErrorCode DSHermitian_HEP(DS ds,DSMatType m,PetscBool *flg)
 +  0 - Implicit QR (_steqr)
 .  1 - Multiple Relatively Robust Representations (_stevr)
 .  2 - Divide and Conquer (_stedc)
--  3 - Block Divide and Conquer (real scalars only)
+.  3 - Block Divide and Conquer (real scalars only)
+.  4 - Divide and Conquer on the GPU (_syevd, requires MAGMA)
+-  5 - Band storage Divide and Conquer (_sbevd), for block tridiagonal matrices
 
 .seealso: DSCreate(), DSSetType(), DSType
 M*/
@@ -853,6 +1005,11 @@ SLEPC_EXTERN PetscErrorCode DSCreate_HEP(DS ds)
 #if !defined(PETSC_USE_COMPLEX)
   ds->ops->solve[3]      = DSSolve_HEP_BDC;
 #endif
+#if defined(PETSC_HAVE_MAGMA)
+  ds->ops->solve[4]      = DSSolve_HEP_MAGMA;
+  ds->methodmagma        = 4;
+#endif
+  ds->ops->solve[5]      = DSSolve_HEP_Band;
   ds->ops->sort          = DSSort_HEP;
 #if !defined(PETSC_HAVE_MPIUNI)
   ds->ops->synchronize   = DSSynchronize_HEP;
@@ -21,6 +21,12 @@ typedef struct {
   PetscReal      rtol;               /* tolerance of Newton refinement */
   RG             rg;                 /* region for contour integral */
   PetscLayout    map;                /* used to distribute work among MPI processes */
+  PetscScalar    *qd;                /* cached quadrature nodes and weights */
+  PetscInt       nq;                 /* number of nodes of the cached quadrature rule */
+  PetscScalar    qcenter;            /* region parameters used to build the cached quadrature */
+  PetscReal      qradius,qvscale,qrgscale;
+  PetscScalar    *Rc;                /* cached random probing matrix */
+  PetscInt       nrc;                /* number of rows of the cached probing matrix */
   void           *computematrixctx;
   PetscErrorCode (*computematrix)(DS,PetscScalar,PetscBool,DSMatType,void*);
 } DS_NEP;
@@ -398,7 +404,7 @@ PetscErrorCode DSSolve_NEP_Contour(DS ds,PetscScalar *wr,PetscScalar *wi)
   p    = n;   /* maximum number of columns for the probing matrix */
   PetscCall(PetscBLASIntCast(ds->ld,&ld));
   PetscCall(PetscBLASIntCast(mid*n,&rowA));
-  nw     = 2*n*(p+mid)+3*nnod+2*mid*n*p;
+  nw     = n*(p+2*mid)+nnod+2*mid*n*p;
   lrwork = 9*mid*n;
 
   /* workspace query and memory allocation */
@@ -410,25 +416,41 @@ PetscErrorCode DSSolve_NEP_Contour(DS ds,PetscScalar *wr,PetscScalar *wi)
   sigma = ds->rwork;
   rwork = ds->rwork+mid*n;
   perm  = ds->iwork;
-  z     = ds->work+nwu;    nwu += nnod;         /* quadrature points */
-  zn    = ds->work+nwu;    nwu += nnod;         /* normalized quadrature points */
   w     = ds->work+nwu;    nwu += nnod;         /* quadrature weights */
-  Rc    = ds->work+nwu;    nwu += n*p;
   R     = ds->work+nwu;    nwu += n*p;
   alpha = ds->work+nwu;    nwu += mid*n;
   beta  = ds->work+nwu;    nwu += mid*n;
   S     = ds->work+nwu;    nwu += 2*mid*n*p;
   work  = ds->work+nwu;
 
-  /* Compute quadrature parameters */
-  PetscCall(RGComputeQuadrature(ctx->rg,RG_QUADRULE_TRAPEZOIDAL,nnod,z,zn,w));
-
-  /* Set random matrix */
-  PetscCall(PetscRandomCreate(PetscObjectComm((PetscObject)ds),&rand));
-  PetscCall(PetscRandomSetSeed(rand,0x12345678));
-  PetscCall(PetscRandomSeed(rand));
-  for (j=0;j<p;j++)
-    for (i=0;i<n;i++) PetscCall(PetscRandomGetValue(rand,Rc+i+j*n));
+  /* Compute quadrature parameters, reusing them in subsequent solves with the same region */
+  if (!ctx->qd || ctx->nq!=nnod || ctx->qcenter!=center || ctx->qradius!=radius || ctx->qvscale!=vscale || ctx->qrgscale!=rgscale) {
+    PetscCall(PetscFree(ctx->qd));
+    PetscCall(PetscMalloc1(3*nnod,&ctx->qd));
+    PetscCall(RGComputeQuadrature(ctx->rg,RG_QUADRULE_TRAPEZOIDAL,nnod,ctx->qd,ctx->qd+nnod,ctx->qd+2*nnod));
+    ctx->nq       = nnod;
+    ctx->qcenter  = center;
+    ctx->qradius  = radius;
+    ctx->qvscale  = vscale;
+    ctx->qrgscale = rgscale;
+  }
+  z  = ctx->qd;         /* quadrature points */
+  zn = ctx->qd+nnod;    /* normalized quadrature points */
+  PetscCall(PetscArraycpy(w,ctx->qd+2*nnod,nnod));  /* weights are modified during the computation */
+
+  /* Set random probing matrix, regenerated only when the dimension changes */
+  if (!ctx->Rc || ctx->nrc!=n) {
+    PetscCall(PetscFree(ctx->Rc));
+    PetscCall(PetscMalloc1((PetscInt)n*p,&ctx->Rc));
+    PetscCall(PetscRandomCreate(PetscObjectComm((PetscObject)ds),&rand));
+    PetscCall(PetscRandomSetSeed(rand,0x12345678));
+    PetscCall(PetscRandomSeed(rand));
+    for (j=0;j<p;j++)
+      for (i=0;i<n;i++) PetscCall(PetscRandomGetValue(rand,ctx->Rc+i+j*n));
+    PetscCall(PetscRandomDestroy(&rand));
+    ctx->nrc = n;
+  }
+  Rc = ctx->Rc;
   PetscCall(PetscArrayzero(S,2*mid*n*p));
   /* Loop of integration points */
   for (k=kstart;k<kend;k++) {
@@ -526,7 +548,6 @@ PetscErrorCode DSSolve_NEP_Contour(DS ds,PetscScalar *wr,PetscScalar *wi)
   /* Newton refinement */
   if (ctx->Nit) PetscCall(DSNEPNewtonRefine(ds,k,wr));
   ds->t = k;
-  PetscCall(PetscRandomDestroy(&rand));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 #endif
@@ -1107,6 +1128,7 @@ static PetscErrorCode DSNEPSetRG_NEP(DS ds,RG rg)
   PetscCall(PetscObjectReference((PetscObject)rg));
   PetscCall(RGDestroy(&dsctx->rg));
   dsctx->rg = rg;
+  dsctx->nq = 0;   /* invalidate the cached quadrature rule */
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1227,6 +1249,8 @@ static PetscErrorCode DSDestroy_NEP(DS ds)
   for (i=0;i<ctx->nf;i++) PetscCall(FNDestroy(&ctx->f[i]));
   PetscCall(RGDestroy(&ctx->rg));
   PetscCall(PetscLayoutDestroy(&ctx->map));
+  PetscCall(PetscFree(ctx->qd));
+  PetscCall(PetscFree(ctx->Rc));
   PetscCall(PetscFree(ds->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)ds,"DSNEPSetFN_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)ds,"DSNEPGetFN_C",NULL));
@@ -349,6 +349,85 @@ static PetscErrorCode DSSolve_NHEP(DS ds,PetscScalar *wr,PetscScalar *wi)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if defined(PETSC_HAVE_MAGMA)
+#include <slepcmagma.h>
+
+/*
+   Same as DSSolve_NHEP, but the reduction to Hessenberg form is done with
+   the hybrid CPU+GPU kernel. The QR iteration remains on the CPU.
+*/
+static PetscErrorCode DSSolve_NHEP_MAGMA(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  PetscScalar    *work,*tau,*A,*Q,*dT=NULL;
+  PetscInt       i,j;
+  PetscBLASInt   ilo,lwork,info,n,ld,nb;
+
+  PetscFunctionBegin;
+#if !defined(PETSC_USE_COMPLEX)
+  PetscAssertPointer(wi,3);
+#endif
+  PetscCall(SlepcMagmaInit());
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Q],&Q));
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->l+1,&ilo));
+  nb = magma_get_xgehrd_nb(n);
+  lwork = n*nb;
+  PetscCall(SlepcMagmaGetWorkspace(sizeof(PetscScalar)*(ld+lwork),(void**)&tau));
+  work = tau+ld;
+
+  /* initialize orthogonal matrix */
+  PetscCall(PetscArrayzero(Q,ld*ld));
+  for (i=0;i<n;i++) Q[i+i*ld] = 1.0;
+  if (n==1) { /* quick return */
+    wr[0] = A[0];
+    if (wi) wi[0] = 0.0;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* reduce to upper Hessenberg form on the GPU */
+  if (ds->state<DS_STATE_INTERMEDIATE) {
+    PetscCall(SlepcMagmaMalloc(sizeof(PetscScalar)*nb*ld,(void**)&dT));
+    PetscCallMAGMA(magma_xgehrd,n,ilo,n,A,ld,tau,work,lwork,dT);
+    for (j=0;j<n-1;j++) {
+      for (i=j+2;i<n;i++) {
+        Q[i+j*ld] = A[i+j*ld];
+        A[i+j*ld] = 0.0;
+      }
+    }
+    PetscCallMAGMA(magma_xunghr,n,ilo,n,Q,ld,tau,dT,nb);
+    PetscCall(SlepcMagmaFree(dT));
+  }
+
+  /* compute the (real) Schur form */
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKhseqr",LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,wi,Q,&ld,work,&lwork,&info));
+  for (j=0;j<ds->l;j++) {
+    if (j==n-1 || A[j+1+j*ld] == 0.0) {
+      /* real eigenvalue */
+      wr[j] = A[j+j*ld];
+      wi[j] = 0.0;
+    } else {
+      /* complex eigenvalue */
+      wr[j] = A[j+j*ld];
+      wr[j+1] = A[j+j*ld];
+      wi[j] = PetscSqrtReal(PetscAbsReal(A[j+1+j*ld]))*PetscSqrtReal(PetscAbsReal(A[j+(j+1)*ld]));
+      wi[j+1] = -wi[j];
+      j++;
+    }
+  }
+#else
+  PetscCallBLAS("LAPACKhseqr",LAPACKhseqr_("S","V",&n,&ilo,&n,A,&ld,wr,Q,&ld,work,&lwork,&info));
+  if (wi) for (i=ds->l;i<n;i++) wi[i] = 0.0;
+#endif
+  SlepcCheckLapackInfo("hseqr",info);
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Q],&Q));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 #if !defined(PETSC_HAVE_MPIUNI)
 static PetscErrorCode DSSynchronize_NHEP(DS ds,PetscScalar eigr[],PetscScalar eigi[])
 {
@@ -466,8 +545,8 @@ static PetscErrorCode DSCond_NHEP(DS ds,PetscReal *cond)
 static PetscErrorCode DSTranslateHarmonic_NHEP(DS ds,PetscScalar tau,PetscReal beta,PetscBool recover,PetscScalar *gin,PetscReal *gammaout)
 {
   PetscInt          i,j;
-  PetscBLASInt      *ipiv,info,n,ld,one=1,ncol;
-  PetscScalar       *A,*B,*g=gin,*ghat,done=1.0,dmone=-1.0,dzero=0.0;
+  PetscBLASInt      *ipiv,info,n,ld,one=1,ncol,k;
+  PetscScalar       *A,*B,*g=gin,*ghat,*bq,sbeta,done=1.0,dmone=-1.0,dzero=0.0;
   const PetscScalar *Q;
   PetscReal         gamma=1.0;
 
@@ -504,22 +583,24 @@ static PetscErrorCode DSTranslateHarmonic_NHEP(DS ds,PetscScalar tau,PetscReal b
     PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_W],&B));
 
     /* A = A + g*b' */
-    for (i=0;i<n;i++) A[i+(n-1)*ld] += g[i]*beta;
+    sbeta = beta;
+    PetscCallBLAS("BLASaxpy",BLASaxpy_(&n,&sbeta,g,&one,A+(n-1)*ld,&one));
 
   } else { /* recover */
 
-    PetscCall(DSAllocateWork_Private(ds,ld,0,0));
+    PetscCall(DSAllocateWork_Private(ds,2*ld,0,0));
     ghat = ds->work;
+    bq   = ds->work+ld;
     PetscCall(MatDenseGetArrayRead(ds->omat[DS_MAT_Q],&Q));
 
     /* g^ = -Q(:,idx)'*g */
     PetscCall(PetscBLASIntCast(ds->l+ds->k,&ncol));
     PetscCallBLAS("BLASgemv",BLASgemv_("C",&n,&ncol,&dmone,Q,&ld,g,&one,&dzero,ghat,&one));
 
-    /* A = A + g^*b' */
-    for (i=0;i<ds->l+ds->k;i++)
-      for (j=ds->l;j<ds->l+ds->k;j++)
-        A[i+j*ld] += ghat[i]*Q[n-1+j*ld]*beta;
+    /* A = A + g^*b', as a rank-1 GEMM update */
+    PetscCall(PetscBLASIntCast(ds->k,&k));
+    for (j=ds->l;j<ds->l+ds->k;j++) bq[j-ds->l] = beta*Q[n-1+j*ld];
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&ncol,&k,&one,&done,ghat,&ncol,bq,&one,&done,A+ds->l*ld,&ld));
 
     /* g~ = (I-Q(:,idx)*Q(:,idx)')*g = g+Q(:,idx)*g^ */
     PetscCallBLAS("BLASgemv",BLASgemv_("N",&n,&ncol,&done,Q,&ld,ghat,&one,&done,g,&one));
@@ -558,7 +639,8 @@ static PetscErrorCode DSTranslateHarmonic_NHEP(DS ds,PetscScalar tau,PetscReal b
    (intermediate step) or matrix of orthogonal Schur vectors
 
    Implemented methods:
-.  0 - Implicit QR (_hseqr)
++  0 - Implicit QR (_hseqr)
+-  1 - Hessenberg reduction on the GPU (_gehrd, requires MAGMA)
 
 .seealso: DSCreate(), DSSetType(), DSType
 M*/
@@ -569,6 +651,10 @@ SLEPC_EXTERN PetscErrorCode DSCreate_NHEP(DS ds)
   ds->ops->view            = DSView_NHEP;
   ds->ops->vectors         = DSVectors_NHEP;
   ds->ops->solve[0]        = DSSolve_NHEP;
+#if defined(PETSC_HAVE_MAGMA)
+  ds->ops->solve[1]        = DSSolve_NHEP_MAGMA;
+  ds->methodmagma          = 1;
+#endif
   ds->ops->sort            = DSSort_NHEP;
   ds->ops->sortperm        = DSSortWithPermutation_NHEP;
 #if !defined(PETSC_HAVE_MPIUNI)
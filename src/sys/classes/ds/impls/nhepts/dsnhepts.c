@@ -275,13 +275,49 @@ static PetscErrorCode DSUpdateExtraRow_NHEPTS(DS ds)
 static PetscErrorCode DSSolve_NHEPTS(DS ds,PetscScalar *wr,PetscScalar *wi)
 {
   DS_NHEPTS      *ctx = (DS_NHEPTS*)ds->data;
+#if defined(_OPENMP)
+  PetscScalar    *A,*B,*Q,*Z;
+  PetscBLASInt   ilo,lwork,infog[2],infoh[2],n,ld;
+  PetscBool      reduce;
+#endif
 
   PetscFunctionBegin;
 #if !defined(PETSC_USE_COMPLEX)
   PetscAssertPointer(wi,3);
 #endif
+#if defined(_OPENMP)
+  /* the two projected problems are independent until the final coupling, so
+     they are solved concurrently on two threads, sharing a single workspace
+     allocation; the kernel does not touch PETSc global state */
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->l+1,&ilo));
+  PetscCall(DSAllocateWork_Private(ds,2*(ld+6*ld),0,0));
+  lwork  = 6*ld;
+  reduce = (ds->state<DS_STATE_INTERMEDIATE)? PETSC_TRUE: PETSC_FALSE;
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Q],&Q));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_B],&B));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Z],&Z));
+  #pragma omp parallel sections num_threads(2)
+  {
+    #pragma omp section
+    DSSolveKernel_NHEP_Private(n,ld,ilo,reduce,ds->l,A,Q,wr,wi,ds->work,ds->work+ld,lwork,&infog[0],&infoh[0]);
+    #pragma omp section
+    DSSolveKernel_NHEP_Private(n,ld,ilo,reduce,ds->l,B,Z,ctx->wr,ctx->wi,ds->work+7*ld,ds->work+8*ld,lwork,&infog[1],&infoh[1]);
+  }
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Q],&Q));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_B],&B));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Z],&Z));
+  SlepcCheckLapackInfo("gehrd",infog[0]);
+  SlepcCheckLapackInfo("gehrd",infog[1]);
+  SlepcCheckLapackInfo("hseqr",infoh[0]);
+  SlepcCheckLapackInfo("hseqr",infoh[1]);
+#else
   PetscCall(DSSolve_NHEP_Private(ds,DS_MAT_A,DS_MAT_Q,wr,wi));
   PetscCall(DSSolve_NHEP_Private(ds,DS_MAT_B,DS_MAT_Z,ctx->wr,ctx->wi));
+#endif
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -90,30 +90,19 @@ static PetscErrorCode DSSort_PEP(DS ds,PetscScalar *wr,PetscScalar *wi,PetscScal
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode DSSolve_PEP_QZ(DS ds,PetscScalar *wr,PetscScalar *wi)
+/*
+   Builds the first matrix of the linearization of the polynomial eigenproblem,
+   of size d*n, in the array A with leading dimension ldd. Ed points to the
+   matrix of the leading coefficient of the polynomial.
+*/
+static PetscErrorCode DSPEP_BuildMatA(DS ds,const PetscScalar *Ed,PetscScalar *A,PetscBLASInt ldd)
 {
   DS_PEP            *ctx = (DS_PEP*)ds->data;
-  PetscInt          i,j,k,off;
-  PetscScalar       *A,*B,*W,*X,*U,*Y,*work,*beta,a;
-  const PetscScalar *Ed,*Ei;
-  PetscReal         *ca,*cb,*cg,norm,done=1.0;
-  PetscBLASInt      info,n,ld,ldd,nd,lwork,one=1,zero=0,cols;
-  PetscBool         useggev3=(ds->method==1)?PETSC_TRUE:PETSC_FALSE;
+  PetscInt          i,j,k,off,nd=ds->n*ctx->d;
+  const PetscScalar *Ei;
+  PetscReal         *ca,*cb,*cg;
 
   PetscFunctionBegin;
-  PetscCall(PetscBLASIntCast(ds->n*ctx->d,&nd));
-  PetscCall(PetscBLASIntCast(ds->n,&n));
-  PetscCall(PetscBLASIntCast(ds->ld,&ld));
-  PetscCall(PetscBLASIntCast(ds->ld*ctx->d,&ldd));
-  PetscCall(DSAllocateMat_Private(ds,DS_MAT_A));
-  PetscCall(DSAllocateMat_Private(ds,DS_MAT_B));
-  PetscCall(DSAllocateMat_Private(ds,DS_MAT_W));
-  PetscCall(DSAllocateMat_Private(ds,DS_MAT_U));
-  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
-  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_B],&B));
-
-  /* build matrices A and B of the linearization */
-  PetscCall(MatDenseGetArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
   PetscCall(PetscArrayzero(A,ldd*ldd));
   if (!ctx->pbc) { /* monomial basis */
     for (i=0;i<nd-ds->n;i++) A[i+(i+ds->n)*ldd] = 1.0;
@@ -159,6 +148,34 @@ static PetscErrorCode DSSolve_PEP_QZ(DS ds,PetscScalar *wr,PetscScalar *wi)
         A[off+j*ldd+k] = Ei[j*ds->ld+k]*ca[ctx->d-1]-Ed[j*ds->ld+k]*cb[ctx->d-1];
     PetscCall(MatDenseRestoreArrayRead(ds->omat[DSMatExtra[i]],&Ei));
   }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode DSSolve_PEP_QZ(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  DS_PEP            *ctx = (DS_PEP*)ds->data;
+  PetscInt          i,j,off;
+  PetscScalar       *A,*B,*W,*X,*U,*Y,*work,*beta,a;
+  const PetscScalar *Ed;
+  PetscReal         norm,done=1.0;
+  PetscBLASInt      info,n,ld,ldd,nd,lwork,one=1,zero=0,cols;
+  PetscBool         useggev3=(ds->method==1)?PETSC_TRUE:PETSC_FALSE;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(ds->n*ctx->d,&nd));
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->ld*ctx->d,&ldd));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_A));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_B));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_W));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_U));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_B],&B));
+
+  /* build matrices A and B of the linearization */
+  PetscCall(MatDenseGetArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
+  PetscCall(DSPEP_BuildMatA(ds,Ed,A,ldd));
   PetscCall(PetscArrayzero(B,ldd*ldd));
   for (i=0;i<nd-ds->n;i++) B[i+i*ldd] = 1.0;
   off = (ctx->d-1)*ds->n*(ldd+1);
@@ -241,6 +258,133 @@ static PetscErrorCode DSSolve_PEP_QZ(DS ds,PetscScalar *wr,PetscScalar *wi)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Solves the polynomial eigenproblem by reducing the linearization to a
+   standard eigenproblem, which requires a nonsingular leading coefficient
+   E_d. The second matrix of the linearization is block diagonal with
+   identity blocks except the last one, so only the last block row of the
+   first matrix needs to be transformed and a single (non-generalized)
+   eigensolve suffices. If E_d turns out to be singular, the QZ solver is
+   used as a fallback.
+*/
+static PetscErrorCode DSSolve_PEP_Linearized(DS ds,PetscScalar *wr,PetscScalar *wi)
+{
+  DS_PEP            *ctx = (DS_PEP*)ds->data;
+  PetscInt          i,j;
+  PetscScalar       *A,*B,*W,*X,*U,*Y,*work,a;
+  const PetscScalar *Ed;
+  PetscReal         norm,done=1.0,abnrm,*scale,*rcde,*rcdv;
+  PetscBLASInt      info,n,ld,ldd,nd,lwork,one=1,zero=0,cols,ilo,ihi,*ipiv;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(ds->n*ctx->d,&nd));
+  PetscCall(PetscBLASIntCast(ds->n,&n));
+  PetscCall(PetscBLASIntCast(ds->ld,&ld));
+  PetscCall(PetscBLASIntCast(ds->ld*ctx->d,&ldd));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_A));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_B));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_W));
+  PetscCall(DSAllocateMat_Private(ds,DS_MAT_U));
+
+  /* factorize the leading coefficient, stored in the first block of B */
+  PetscCall(DSAllocateWork_Private(ds,0,0,n));
+  ipiv = ds->iwork;
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_B],&B));
+  PetscCall(MatDenseGetArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
+  for (j=0;j<ds->n;j++) PetscCall(PetscArraycpy(B+j*ldd,Ed+j*ds->ld,ds->n));
+  PetscCall(MatDenseRestoreArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
+  PetscCallBLAS("LAPACKgetrf",LAPACKgetrf_(&n,&n,B,&ldd,ipiv,&info));
+  if (info>0) {  /* singular leading coefficient, cannot reduce to standard form */
+    PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_B],&B));
+    PetscCall(PetscInfo(ds,"Leading coefficient is singular, using QZ on the linearization\n"));
+    PetscCall(DSSolve_PEP_QZ(ds,wr,wi));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  SlepcCheckLapackInfo("getrf",info);
+
+  /* build the first matrix of the linearization and invert its last block row */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_A],&A));
+  PetscCall(MatDenseGetArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
+  PetscCall(DSPEP_BuildMatA(ds,Ed,A,ldd));
+  PetscCall(MatDenseRestoreArrayRead(ds->omat[DSMatExtra[ctx->d]],&Ed));
+  for (j=0;j<nd;j++)
+    for (i=0;i<ds->n;i++) A[(ctx->d-1)*ds->n+i+j*ldd] = -A[(ctx->d-1)*ds->n+i+j*ldd];
+  PetscCallBLAS("LAPACKgetrs",LAPACKgetrs_("N",&n,&nd,B,&ldd,ipiv,A+(ctx->d-1)*ds->n,&ldd,&info));
+  SlepcCheckLapackInfo("getrs",info);
+
+  /* solve standard eigenproblem */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_W],&W));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_U],&U));
+  lwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgeevx",LAPACKgeevx_("B","V","V","N",&nd,A,&ldd,wr,U,&ldd,W,&ldd,&ilo,&ihi,NULL,&abnrm,NULL,NULL,&a,&lwork,NULL,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(a),&lwork));
+  PetscCall(DSAllocateWork_Private(ds,lwork,5*nd,n));
+  work  = ds->work;
+  scale = ds->rwork;
+  rcde  = ds->rwork+nd;
+  rcdv  = ds->rwork+2*nd;
+  PetscCallBLAS("LAPACKgeevx",LAPACKgeevx_("B","V","V","N",&nd,A,&ldd,wr,U,&ldd,W,&ldd,&ilo,&ihi,scale,&abnrm,rcde,rcdv,work,&lwork,ds->rwork+3*nd,&info));
+#else
+  PetscCallBLAS("LAPACKgeevx",LAPACKgeevx_("B","V","V","N",&nd,A,&ldd,wr,wi,U,&ldd,W,&ldd,&ilo,&ihi,NULL,&abnrm,NULL,NULL,&a,&lwork,NULL,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)a,&lwork));
+  PetscCall(DSAllocateWork_Private(ds,lwork,3*nd,n));
+  work  = ds->work;
+  scale = ds->rwork;
+  rcde  = ds->rwork+nd;
+  rcdv  = ds->rwork+2*nd;
+  PetscCallBLAS("LAPACKgeevx",LAPACKgeevx_("B","V","V","N",&nd,A,&ldd,wr,wi,U,&ldd,W,&ldd,&ilo,&ihi,scale,&abnrm,rcde,rcdv,work,&lwork,NULL,&info));
+#endif
+  SlepcCheckLapackInfo("geevx",info);
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_A],&A));
+#if defined(PETSC_USE_COMPLEX)
+  if (wi) for (i=0;i<nd;i++) wi[i] = 0.0;
+#endif
+
+  /* copy and normalize eigenvectors */
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_X],&X));
+  PetscCall(MatDenseGetArray(ds->omat[DS_MAT_Y],&Y));
+  for (j=0;j<nd;j++) {
+    PetscCall(PetscArraycpy(X+j*ds->ld,W+j*ldd,ds->n));
+    PetscCall(PetscArraycpy(Y+j*ds->ld,U+ds->n*(ctx->d-1)+j*ldd,ds->n));
+  }
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_W],&W));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_U],&U));
+  /* left eigenvectors of the pencil are recovered as E_d^{-*} times the last
+     block of the left eigenvectors of the reduced problem */
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgetrs",LAPACKgetrs_("C",&n,&nd,B,&ldd,ipiv,Y,&ld,&info));
+#else
+  PetscCallBLAS("LAPACKgetrs",LAPACKgetrs_("T",&n,&nd,B,&ldd,ipiv,Y,&ld,&info));
+#endif
+  SlepcCheckLapackInfo("getrs",info);
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_B],&B));
+  for (j=0;j<nd;j++) {
+    cols = 1;
+    norm = BLASnrm2_(&n,X+j*ds->ld,&one);
+#if !defined(PETSC_USE_COMPLEX)
+    if (wi[j] != 0.0) {
+      norm = SlepcAbsEigenvalue(norm,BLASnrm2_(&n,X+(j+1)*ds->ld,&one));
+      cols = 2;
+    }
+#endif
+    PetscCallBLAS("LAPACKlascl",LAPACKlascl_("G",&zero,&zero,&norm,&done,&n,&cols,X+j*ds->ld,&ld,&info));
+    SlepcCheckLapackInfo("lascl",info);
+    norm = BLASnrm2_(&n,Y+j*ds->ld,&one);
+#if !defined(PETSC_USE_COMPLEX)
+    if (wi[j] != 0.0) norm = SlepcAbsEigenvalue(norm,BLASnrm2_(&n,Y+(j+1)*ds->ld,&one));
+#endif
+    PetscCallBLAS("LAPACKlascl",LAPACKlascl_("G",&zero,&zero,&norm,&done,&n,&cols,Y+j*ds->ld,&ld,&info));
+    SlepcCheckLapackInfo("lascl",info);
+#if !defined(PETSC_USE_COMPLEX)
+    if (wi[j] != 0.0) j++;
+#endif
+  }
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_X],&X));
+  PetscCall(MatDenseRestoreArray(ds->omat[DS_MAT_Y],&Y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 #if !defined(PETSC_HAVE_MPIUNI)
 static PetscErrorCode DSSynchronize_PEP(DS ds,PetscScalar eigr[],PetscScalar eigi[])
 {
@@ -506,7 +650,10 @@ static PetscErrorCode DSMatGetSize_PEP(DS ds,DSMatType t,PetscInt *rows,PetscInt
 -  DS_MAT_U  - (workspace) left eigenvectors of the linearization
 
    Implemented methods:
-.  0 - QZ iteration on the linearization (_ggev)
++  0 - QZ iteration on the linearization (_ggev)
+.  1 - QZ iteration on the linearization (_ggev3)
+-  2 - reduction to a standard eigenproblem (_geevx), requires a nonsingular
+       leading coefficient
 
 .seealso: DSCreate(), DSSetType(), DSType, DSPEPSetDegree(), DSPEPSetCoefficients()
 M*/
@@ -525,6 +672,7 @@ SLEPC_EXTERN PetscErrorCode DSCreate_PEP(DS ds)
 #if !defined(SLEPC_MISSING_LAPACK_GGES3)
   ds->ops->solve[1]      = DSSolve_PEP_QZ;
 #endif
+  ds->ops->solve[2]      = DSSolve_PEP_Linearized;
   ds->ops->sort          = DSSort_PEP;
 #if !defined(PETSC_HAVE_MPIUNI)
   ds->ops->synchronize   = DSSynchronize_PEP;
@@ -269,10 +269,19 @@ static PetscErrorCode DSSolve_SVD_DC(DS ds,PetscScalar *wr,PetscScalar *wi)
   PetscCall(MatDenseGetArrayWrite(ds->omat[DS_MAT_V],&V));
   PetscCall(DSGetArrayReal(ds,DS_MAT_T,&d));
   e = d+ld;
-  PetscCall(PetscArrayzero(U,ld*ld));
-  for (i=0;i<l;i++) U[i+i*ld] = 1.0;
-  PetscCall(PetscArrayzero(V,ld*ld));
-  for (i=0;i<l;i++) V[i+i*ld] = 1.0;
+  /* initialize only the parts of U and V that the factorization below will
+     not overwrite: identity in the locked columns and zeros in the coupling
+     blocks, instead of zeroing the full ld*ld arrays on every call */
+  for (j=0;j<l;j++) {
+    PetscCall(PetscArrayzero(U+j*ld,n));
+    U[j+j*ld] = 1.0;
+  }
+  for (j=l;j<n;j++) for (i=0;i<l;i++) U[i+j*ld] = 0.0;
+  for (j=0;j<l;j++) {
+    PetscCall(PetscArrayzero(V+j*ld,m));
+    V[j+j*ld] = 1.0;
+  }
+  for (j=l;j<m;j++) for (i=0;i<l;i++) V[i+j*ld] = 0.0;
 
   if (ds->state>DS_STATE_RAW) {
     /* solve bidiagonal SVD problem */
@@ -296,6 +305,10 @@ static PetscErrorCode DSSolve_SVD_DC(DS ds,PetscScalar *wr,PetscScalar *wi)
         V[i+j*ld] = PetscConj(Vr[j+i*ld]);  /* transpose VT returned by Lapack */
       }
     }
+    if (m>n) {  /* in the rectangular case, clear the trailing part of V as well */
+      for (j=l;j<n;j++) PetscCall(PetscArrayzero(V+n+j*ld,m-n));
+      for (j=n;j<m;j++) PetscCall(PetscArrayzero(V+l+j*ld,m-l));
+    }
   } else {
     /* solve general rectangular SVD problem */
     PetscCall(DSAllocateMat_Private(ds,DS_MAT_W));
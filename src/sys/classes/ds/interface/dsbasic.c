@@ -114,6 +114,7 @@ PetscErrorCode DSCreate(MPI_Comm comm,DS *newds)
 
   ds->state         = DS_STATE_RAW;
   ds->method        = 0;
+  ds->methodmagma   = -1;
   ds->compact       = PETSC_FALSE;
   ds->refined       = PETSC_FALSE;
   ds->extrarow      = PETSC_FALSE;
@@ -125,8 +126,22 @@ PetscErrorCode DSCreate(MPI_Comm comm,DS *newds)
   ds->bs            = 1;
   ds->sc            = NULL;
   ds->pmode         = DS_PARALLEL_REDUNDANT;
-
-  for (i=0;i<DS_NUM_MAT;i++) ds->omat[i] = NULL;
+  ds->nthreads      = 0;
+  ds->swindow       = 0;
+  ds->shmem         = PETSC_FALSE;
+
+  for (i=0;i<DS_NUM_MAT;i++) {
+    ds->omat[i]     = NULL;
+#if !defined(PETSC_HAVE_MPIUNI)
+    ds->win[i]      = MPI_WIN_NULL;
+#endif
+    ds->vecsdone[i] = PETSC_FALSE;
+  }
+  ds->nodecomm      = MPI_COMM_NULL;
+  ds->noderank      = 0;
+  ds->nodesize      = 1;
+  ds->allocating    = PETSC_FALSE;
+  ds->vecstate      = 0;
   ds->perm          = NULL;
   ds->data          = NULL;
   ds->scset         = PETSC_FALSE;
@@ -317,6 +332,9 @@ PetscErrorCode DSDuplicate(DS ds,DS *dsnew)
   (*dsnew)->extrarow = ds->extrarow;
   (*dsnew)->bs       = ds->bs;
   (*dsnew)->pmode    = ds->pmode;
+  (*dsnew)->nthreads = ds->nthreads;
+  (*dsnew)->swindow  = ds->swindow;
+  (*dsnew)->shmem    = ds->shmem;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -397,7 +415,10 @@ PetscErrorCode DSGetMethod(DS ds,PetscInt *meth)
 
    The 'distributed' parallel mode can be used in some DS types only, such
    as the contour integral method of DSNEP. In this case, every MPI process
-   will be in charge of part of the computation.
+   will be in charge of part of the computation. In DSHEP and DSNHEP, this
+   mode avoids the redundant computation: only the first MPI process runs
+   DSSolve() and the result is broadcast to the other processes automatically,
+   so no call to DSSynchronize() is needed.
 
    Level: advanced
 
@@ -436,6 +457,203 @@ PetscErrorCode DSGetParallel(DS ds,DSParallelType *pmode)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   DSSetNumThreads - Sets the number of BLAS threads to be used during DSSolve().
+
+   Logically Collective
+
+   Input Parameters:
++  ds       - the direct solver context
+-  nthreads - the number of threads
+
+   Options Database Key:
+.  -ds_num_threads <nthreads> - Sets the number of threads
+
+   Notes:
+   In hybrid MPI-thread runs, the BLAS library is usually configured to run
+   with a single thread so that the sparse phases of the solver do not
+   oversubscribe the cores. Since the dense solve of the projected problem
+   is either redundant or done by one process only, see DSSetParallel(), it
+   can exploit the idle cores. This function makes DSSolve() temporarily
+   change the number of BLAS threads, via PetscBLASSetNumThreads(), restoring
+   the previous value afterwards. With the default value of 0, the threading
+   of the BLAS library is left unchanged.
+
+   Level: advanced
+
+.seealso: DSSolve(), DSGetNumThreads(), DSSetParallel()
+@*/
+PetscErrorCode DSSetNumThreads(DS ds,PetscInt nthreads)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(ds,nthreads,2);
+  if (nthreads == PETSC_DEFAULT || nthreads == PETSC_DECIDE) ds->nthreads = 0;
+  else {
+    PetscCheck(nthreads>0,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of nthreads. Must be > 0");
+    ds->nthreads = nthreads;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   DSGetNumThreads - Gets the number of BLAS threads to be used during DSSolve().
+
+   Not Collective
+
+   Input Parameter:
+.  ds - the direct solver context
+
+   Output Parameter:
+.  nthreads - the number of threads
+
+   Level: advanced
+
+.seealso: DSSetNumThreads()
+@*/
+PetscErrorCode DSGetNumThreads(DS ds,PetscInt *nthreads)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscAssertPointer(nthreads,2);
+  *nthreads = ds->nthreads;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   DSSetSortWindow - Sets the number of leading eigenvalues that must be
+   placed in order by DSSort().
+
+   Logically Collective
+
+   Input Parameters:
++  ds - the direct solver context
+-  win - the number of eigenvalues to sort
+
+   Notes:
+   By default (win=0, or PETSC_DEFAULT), DSSort() fully orders the computed
+   spectrum. When only the leading part of the decomposition is going to be
+   retained, e.g. at restart of a Krylov solver, the caller can indicate this
+   with win, so that reordering stops as soon as the first win eigenvalues
+   occupy the leading positions and the trailing block is left unordered.
+   This reduces the number of reordering operations on the Schur form, which
+   may be significant for large projected problems.
+
+   Currently this hint is exploited in the sorting of (quasi-)triangular forms,
+   such as in DSNHEP; other types may perform a full sort regardless.
+
+   Level: developer
+
+.seealso: DSSort(), DSGetSortWindow()
+@*/
+PetscErrorCode DSSetSortWindow(DS ds,PetscInt win)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(ds,win,2);
+  if (win == PETSC_DEFAULT || win == PETSC_DECIDE) ds->swindow = 0;
+  else {
+    PetscCheck(win>=0,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of win. Must be nonnegative");
+    ds->swindow = win;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   DSGetSortWindow - Gets the number of leading eigenvalues that must be
+   placed in order by DSSort().
+
+   Not Collective
+
+   Input Parameter:
+.  ds - the direct solver context
+
+   Output Parameter:
+.  win - the number of eigenvalues to sort
+
+   Level: developer
+
+.seealso: DSSetSortWindow()
+@*/
+PetscErrorCode DSGetSortWindow(DS ds,PetscInt *win)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscAssertPointer(win,2);
+  *win = ds->swindow;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   DSSetNodeShared - Sets a flag to share a single copy of the DS matrices
+   among the processes that belong to the same computational node.
+
+   Logically Collective
+
+   Input Parameters:
++  ds    - the direct solver context
+-  shmem - a boolean flag
+
+   Options Database Key:
+.  -ds_node_shared <bool> - Sets the node-shared flag
+
+   Notes:
+   By default, every process stores a redundant copy of the matrices of the
+   projected problem. When this flag is set, the matrices allocated at
+   DSAllocate() are placed in MPI shared memory instead, with a single copy
+   per node, which may represent a considerable saving in memory for large
+   projected problems. Operations that modify these matrices, such as DSSolve()
+   or DSSort(), are then carried out by the first process of each node only,
+   with the rest of them waiting on a barrier and reading the result from
+   shared memory afterwards.
+
+   Matrices created on demand after DSAllocate(), e.g., to hold computed
+   eigenvectors, use regular (per-process) storage. The flag must be set
+   before DSAllocate(), and is currently supported only in DSHEP, DSNHEP
+   and DSGHEP. It is intended to be used with the default parallel mode
+   (DS_PARALLEL_REDUNDANT), see DSSetParallel().
+
+   Level: advanced
+
+.seealso: DSGetNodeShared(), DSAllocate(), DSSetParallel()
+@*/
+PetscErrorCode DSSetNodeShared(DS ds,PetscBool shmem)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(ds,shmem,2);
+  if (ds->shmem != shmem) {
+    PetscCheck(!ds->ld,PetscObjectComm((PetscObject)ds),PETSC_ERR_ORDER,"Must be called before DSAllocate()");
+    ds->shmem = shmem;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   DSGetNodeShared - Gets the flag indicating whether the DS matrices are
+   shared by the processes of each node.
+
+   Not Collective
+
+   Input Parameter:
+.  ds - the direct solver context
+
+   Output Parameter:
+.  shmem - the node-shared flag
+
+   Level: advanced
+
+.seealso: DSSetNodeShared()
+@*/
+PetscErrorCode DSGetNodeShared(DS ds,PetscBool *shmem)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscAssertPointer(shmem,2);
+  *shmem = ds->shmem;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    DSSetCompact - Switch to compact storage of matrices.
 
@@ -719,8 +937,8 @@ PetscErrorCode DSGetSlepcSC(DS ds,SlepcSC *sc)
 @*/
 PetscErrorCode DSSetFromOptions(DS ds)
 {
-  PetscInt       bs,meth;
-  PetscBool      flag;
+  PetscInt       bs,meth,nt;
+  PetscBool      flag,shmem;
   DSParallelType pmode;
 
   PetscFunctionBegin;
@@ -739,6 +957,12 @@ PetscErrorCode DSSetFromOptions(DS ds)
     PetscCall(PetscOptionsEnum("-ds_parallel","Operation mode in parallel runs","DSSetParallel",DSParallelTypes,(PetscEnum)ds->pmode,(PetscEnum*)&pmode,&flag));
     if (flag) PetscCall(DSSetParallel(ds,pmode));
 
+    PetscCall(PetscOptionsInt("-ds_num_threads","Number of BLAS threads for the dense system solver","DSSetNumThreads",ds->nthreads,&nt,&flag));
+    if (flag) PetscCall(DSSetNumThreads(ds,nt));
+
+    PetscCall(PetscOptionsBool("-ds_node_shared","Share a single copy of the matrices among the processes of each node","DSSetNodeShared",ds->shmem,&shmem,&flag));
+    if (flag) PetscCall(DSSetNodeShared(ds,shmem));
+
     PetscTryTypeMethod(ds,setfromoptions,PetscOptionsObject);
     PetscCall(PetscObjectProcessOptionsHandlers((PetscObject)ds,PetscOptionsObject));
   PetscOptionsEnd();
@@ -786,6 +1010,8 @@ PetscErrorCode DSView(DS ds,PetscViewer viewer)
     PetscCall(PetscObjectPrintClassNamePrefixType((PetscObject)ds,viewer));
     PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)ds),&size));
     if (size>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  parallel operation mode: %s\n",DSParallelTypes[ds->pmode]));
+    if (size>1 && ds->shmem) PetscCall(PetscViewerASCIIPrintf(viewer,"  using node-shared storage for the matrices\n"));
+    if (ds->nthreads) PetscCall(PetscViewerASCIIPrintf(viewer,"  number of BLAS threads for the solve: %" PetscInt_FMT "\n",ds->nthreads));
     if (format == PETSC_VIEWER_ASCII_INFO_DETAIL) {
       PetscCall(PetscViewerASCIIPrintf(viewer,"  current state: %s\n",DSStateTypes[ds->state]));
       PetscCall(PetscViewerASCIIPrintf(viewer,"  dimensions: ld=%" PetscInt_FMT ", n=%" PetscInt_FMT ", l=%" PetscInt_FMT ", k=%" PetscInt_FMT,ds->ld,ds->n,ds->l,ds->k));
@@ -842,6 +1068,8 @@ PetscErrorCode DSViewFromOptions(DS ds,PetscObject obj,const char name[])
 @*/
 PetscErrorCode DSAllocate(DS ds,PetscInt ld)
 {
+  PetscBool      flg;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(ds,DS_CLASSID,1);
   PetscValidLogicalCollectiveInt(ds,ld,2);
@@ -851,7 +1079,13 @@ PetscErrorCode DSAllocate(DS ds,PetscInt ld)
     PetscCall(PetscInfo(ds,"Allocating memory with leading dimension=%" PetscInt_FMT "\n",ld));
     PetscCall(DSReset(ds));
     ds->ld = ld;
+    if (ds->shmem) {
+      PetscCall(PetscObjectTypeCompareAny((PetscObject)ds,&flg,DSHEP,DSNHEP,DSGHEP,""));
+      PetscCheck(flg,PetscObjectComm((PetscObject)ds),PETSC_ERR_SUP,"Node-shared storage is currently only supported in DSHEP, DSNHEP and DSGHEP");
+    }
+    ds->allocating = PETSC_TRUE;
     PetscUseTypeMethod(ds,allocate,ld);
+    ds->allocating = PETSC_FALSE;
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -884,7 +1118,13 @@ PetscErrorCode DSReset(DS ds)
   ds->l        = 0;
   ds->n        = 0;
   ds->k        = 0;
-  for (i=0;i<DS_NUM_MAT;i++) PetscCall(MatDestroy(&ds->omat[i]));
+  for (i=0;i<DS_NUM_MAT;i++) {
+    PetscCall(MatDestroy(&ds->omat[i]));
+#if !defined(PETSC_HAVE_MPIUNI)
+    if (ds->win[i]!=MPI_WIN_NULL) PetscCallMPI(MPI_Win_free(&ds->win[i]));
+#endif
+    ds->vecsdone[i] = PETSC_FALSE;
+  }
   PetscCall(PetscFree(ds->perm));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -909,6 +1149,7 @@ PetscErrorCode DSDestroy(DS *ds)
   if (--((PetscObject)(*ds))->refct > 0) { *ds = NULL; PetscFunctionReturn(PETSC_SUCCESS); }
   PetscCall(DSReset(*ds));
   PetscTryTypeMethod(*ds,destroy);
+  if ((*ds)->nodecomm!=MPI_COMM_NULL) PetscCallMPI(MPI_Comm_free(&(*ds)->nodecomm));
   PetscCall(PetscFree((*ds)->work));
   PetscCall(PetscFree((*ds)->rwork));
   PetscCall(PetscFree((*ds)->iwork));
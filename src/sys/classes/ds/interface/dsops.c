@@ -12,6 +12,9 @@
 */
 
 #include <slepc/private/dsimpl.h>      /*I "slepcds.h" I*/
+#if defined(PETSC_HAVE_MAGMA)
+#include <slepcmagma.h>
+#endif
 
 /*@
    DSGetLeadingDimension - Returns the leading dimension of the allocated
@@ -239,9 +242,10 @@ PetscErrorCode DSTruncate(DS ds,PetscInt n,PetscBool trim)
   PetscCheck(n>=ds->l && n<=ds->n,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of n (%" PetscInt_FMT "). Must be between l (%" PetscInt_FMT ") and n (%" PetscInt_FMT ")",n,ds->l,ds->n);
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,truncate,n,trim);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,truncate,n,trim);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
   PetscCall(PetscInfo(ds,"Decomposition %s to size n=%" PetscInt_FMT "\n",trim?"trimmed":"truncated",ds->n));
   old = ds->state;
   ds->state = trim? DS_STATE_RAW: DS_STATE_TRUNCATED;
@@ -719,6 +723,13 @@ PetscErrorCode DSRestoreArrayReal(DS ds,DSMatType m,PetscReal *a[])
 @*/
 PetscErrorCode DSSolve(DS ds,PetscScalar eigr[],PetscScalar eigi[])
 {
+  PetscMPIInt    size,rank;
+  PetscInt       nth=0,meth;
+  PetscBool      distributed=PETSC_FALSE;
+#if defined(PETSC_HAVE_MAGMA)
+  PetscInt       crossover;
+#endif
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(ds,DS_CLASSID,1);
   PetscValidType(ds,1);
@@ -726,18 +737,103 @@ PetscErrorCode DSSolve(DS ds,PetscScalar eigr[],PetscScalar eigi[])
   PetscAssertPointer(eigr,2);
   if (ds->state>=DS_STATE_CONDENSED) PetscFunctionReturn(PETSC_SUCCESS);
   PetscCheck(ds->ops->solve[ds->method],PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_OUTOFRANGE,"The specified method number does not exist for this DS");
+  meth = ds->method;
+#if defined(PETSC_HAVE_MAGMA)
+  if (!meth && ds->methodmagma>0) {
+    /* with the default method, switch to the hybrid CPU+GPU variant for large enough problems */
+    PetscCall(SlepcMagmaGetCrossover(&crossover));
+    if (ds->n-ds->l>=crossover) {
+      meth = ds->methodmagma;
+      PetscCall(PetscInfo(ds,"Active size %" PetscInt_FMT " above crossover, selecting MAGMA method %" PetscInt_FMT "\n",ds->n-ds->l,meth));
+    }
+  }
+#endif
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)ds),&size));
+  if (size>1 && ds->pmode==DS_PARALLEL_DISTRIBUTED) PetscCall(PetscObjectTypeCompareAny((PetscObject)ds,&distributed,DSHEP,DSNHEP,""));  /* other types handle the distributed mode in the solver itself */
   PetscCall(PetscInfo(ds,"Starting solve with problem sizes: n=%" PetscInt_FMT ", l=%" PetscInt_FMT ", k=%" PetscInt_FMT "\n",ds->n,ds->l,ds->k));
   PetscCall(PetscLogEventBegin(DS_Solve,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,solve[ds->method],eigr,eigi);
+  if (ds->nthreads) {
+    /* temporarily raise the number of BLAS threads for the dense solve */
+    PetscCall(PetscBLASGetNumThreads(&nth));
+    PetscCall(PetscBLASSetNumThreads(ds->nthreads));
+  }
+  if (distributed) {
+    /* the dense solve is done by the first process only, the others get the result broadcast below */
+    PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)ds),&rank));
+    if (!rank) PetscUseTypeMethod(ds,solve[meth],eigr,eigi);
+  } else if (DSNodeSharedActive(ds)) {
+    /* the matrices are node-shared, so the node leader solves and the rest read the result afterwards */
+    if (!ds->noderank) PetscUseTypeMethod(ds,solve[meth],eigr,eigi);
+  } else PetscUseTypeMethod(ds,solve[meth],eigr,eigi);
+  if (ds->nthreads) PetscCall(PetscBLASSetNumThreads(nth));
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Solve,ds,0,0,0));
   PetscCall(PetscInfo(ds,"State has changed from %s to CONDENSED\n",DSStateTypes[ds->state]));
   ds->state = DS_STATE_CONDENSED;
+  if (distributed) {
+    PetscCall(PetscLogEventBegin(DS_Synchronize,ds,0,0,0));
+    PetscUseTypeMethod(ds,synchronize,eigr,eigi);
+    PetscCall(PetscLogEventEnd(DS_Synchronize,ds,0,0,0));
+  }
+  if (DSNodeSharedActive(ds)) PetscCall(DSNodeShareResult_Private(ds,eigr,eigi));
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+   DSSolveBatch - Solves a set of projected problems in a single call.
+
+   Logically Collective
+
+   Input Parameters:
++  n    - number of direct solver contexts
+.  ds   - array of n direct solver contexts
+.  eigr - array of n arrays to store the computed eigenvalues (real part)
+-  eigi - array of n arrays to store the computed eigenvalues (imaginary
+          part), or NULL
+
+   Notes:
+   Equivalent to calling DSSolve() on each context in turn, except that the
+   pending solves are executed in decreasing order of active problem size.
+   This way the largest problems, which benefit the most from threaded BLAS,
+   run first, and problems of similar size run back to back, which improves
+   the reuse of cache-resident LAPACK workspaces. Contexts whose solve has
+   already been performed are skipped.
+
+   All contexts must belong to the same communicator. This routine cannot
+   aggregate solves submitted by different processes, e.g. by slicing
+   partitions co-located on a node, since each DS stores its matrices in the
+   memory of a single process; for that scenario, the contention among
+   partitions is controlled by limiting the threads of each solve with
+   DSSetNumThreads(), or avoided altogether with the node-shared mode, where
+   only the node leader performs the solve.
+
+   Level: advanced
+
+.seealso: DSSolve(), DSSetNumThreads()
+@*/
+PetscErrorCode DSSolveBatch(PetscInt n,DS ds[],PetscScalar *eigr[],PetscScalar *eigi[])
+{
+  PetscInt       i,*sz,*perm;
+
+  PetscFunctionBegin;
+  PetscCheck(n>=0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of problems must be nonnegative");
+  if (!n) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(ds,2);
+  PetscAssertPointer(eigr,3);
+  for (i=0;i<n;i++) PetscValidHeaderSpecific(ds[i],DS_CLASSID,2);
+  PetscCall(PetscMalloc2(n,&sz,n,&perm));
+  for (i=0;i<n;i++) {
+    sz[i]   = ds[i]->n-ds[i]->l;
+    perm[i] = i;
+  }
+  PetscCall(PetscSortIntWithPermutation(n,sz,perm));
+  for (i=n-1;i>=0;i--) PetscCall(DSSolve(ds[perm[i]],eigr[perm[i]],eigi?eigi[perm[i]]:NULL));
+  PetscCall(PetscFree2(sz,perm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
    DSSort - Sorts the result of DSSolve() according to a given sorting
    criterion.
@@ -774,6 +870,7 @@ PetscErrorCode DSSolve(DS ds,PetscScalar eigr[],PetscScalar eigi[])
 PetscErrorCode DSSort(DS ds,PetscScalar *eigr,PetscScalar *eigi,PetscScalar *rr,PetscScalar *ri,PetscInt *k)
 {
   PetscInt       i;
+  PetscMPIInt    ne;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(ds,DS_CLASSID,1);
@@ -788,9 +885,16 @@ PetscErrorCode DSSort(DS ds,PetscScalar *eigr,PetscScalar *eigi,PetscScalar *rr,
   for (i=0;i<ds->n;i++) ds->perm[i] = i;   /* initialize to trivial permutation */
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,sort,eigr,eigi,rr,ri,k);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,sort,eigr,eigi,rr,ri,k);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) {
+    PetscCall(DSNodeShareResult_Private(ds,eigr,eigi));
+    PetscCall(PetscMPIIntCast(ds->n,&ne));
+    if (rr && rr!=eigr) PetscCallMPI(MPI_Bcast(rr,ne,MPIU_SCALAR,0,ds->nodecomm));
+    if (ri && ri!=eigi) PetscCallMPI(MPI_Bcast(ri,ne,MPIU_SCALAR,0,ds->nodecomm));
+    if (k) PetscCallMPI(MPI_Bcast(k,1,MPIU_INT,0,ds->nodecomm));
+  }
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   PetscCall(PetscInfo(ds,"Finished sorting\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -831,9 +935,10 @@ PetscErrorCode DSSortWithPermutation(DS ds,PetscInt *perm,PetscScalar *eigr,Pets
 
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,sortperm,perm,eigr,eigi);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,sortperm,perm,eigr,eigi);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) PetscCall(DSNodeShareResult_Private(ds,eigr,eigi));
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   PetscCall(PetscInfo(ds,"Finished sorting\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -927,6 +1032,9 @@ PetscErrorCode DSSynchronize(DS ds,PetscScalar eigr[],PetscScalar eigi[])
 @*/
 PetscErrorCode DSVectors(DS ds,DSMatType mat,PetscInt *j,PetscReal *rnorm)
 {
+  PetscObjectState state;
+  PetscInt         i;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(ds,DS_CLASSID,1);
   PetscValidType(ds,1);
@@ -935,13 +1043,22 @@ PetscErrorCode DSVectors(DS ds,DSMatType mat,PetscInt *j,PetscReal *rnorm)
   PetscCheck(mat<DS_NUM_MAT,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_WRONG,"Invalid matrix");
   PetscCheck(!rnorm || j,PetscObjectComm((PetscObject)ds),PETSC_ERR_ORDER,"Must give a value of j");
   if (!ds->omat[mat]) PetscCall(DSAllocateMat_Private(ds,mat));
+  /* the cached vectors are discarded whenever the DS data has been modified */
+  PetscCall(PetscObjectStateGet((PetscObject)ds,&state));
+  if (state!=ds->vecstate) for (i=0;i<DS_NUM_MAT;i++) ds->vecsdone[i] = PETSC_FALSE;
+  if (!j && ds->vecsdone[mat]) {
+    PetscCall(PetscInfo(ds,"Reusing the vectors on %s computed previously\n",DSMatName[mat]));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   if (!j) PetscCall(PetscInfo(ds,"Computing all vectors on %s\n",DSMatName[mat]));
   PetscCall(PetscLogEventBegin(DS_Vectors,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
   PetscUseTypeMethod(ds,vectors,mat,j,rnorm);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Vectors,ds,0,0,0));
+  if (!j) ds->vecsdone[mat] = PETSC_TRUE;
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
+  PetscCall(PetscObjectStateGet((PetscObject)ds,&ds->vecstate));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -968,9 +1085,10 @@ PetscErrorCode DSUpdateExtraRow(DS ds)
   PetscCall(PetscInfo(ds,"Updating extra row\n"));
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,update);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,update);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1054,9 +1172,13 @@ PetscErrorCode DSTranslateHarmonic(DS ds,PetscScalar tau,PetscReal beta,PetscBoo
   else PetscCall(PetscInfo(ds,"Computing the translation\n"));
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,transharm,tau,beta,recover,g,gamma);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,transharm,tau,beta,recover,g,gamma);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) {
+    PetscCall(DSNodeShareResult_Private(ds,g,NULL));
+    if (gamma) PetscCallMPI(MPI_Bcast(gamma,1,MPIU_REAL,0,ds->nodecomm));
+  }
   ds->state = DS_STATE_RAW;
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -1097,9 +1219,10 @@ PetscErrorCode DSTranslateRKS(DS ds,PetscScalar alpha)
   PetscCall(PetscInfo(ds,"Translating with alpha=%g\n",(double)PetscRealPart(alpha)));
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
-  PetscUseTypeMethod(ds,transrks,alpha);
+  if (!DSNodeSharedActive(ds) || !ds->noderank) PetscUseTypeMethod(ds,transrks,alpha);
   PetscCall(PetscFPTrapPop());
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
   ds->state   = DS_STATE_RAW;
   ds->compact = PETSC_FALSE;
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
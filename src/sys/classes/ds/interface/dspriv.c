@@ -14,6 +14,37 @@
 #include <slepc/private/dsimpl.h>      /*I "slepcds.h" I*/
 #include <slepcblaslapack.h>
 
+#if !defined(PETSC_HAVE_MPIUNI)
+/*
+   Allocates matrix m with the backing storage placed in an MPI shared memory
+   window, so that all processes in the same node use a single copy of the data.
+*/
+static PetscErrorCode DSAllocateShared_Private(DS ds,DSMatType m,PetscInt rows,PetscInt cols)
+{
+  MPI_Aint       winsize;
+  PetscMPIInt    dispunit;
+  PetscScalar    *base;
+
+  PetscFunctionBegin;
+  if (ds->nodecomm==MPI_COMM_NULL) {
+    PetscCallMPI(MPI_Comm_split_type(PetscObjectComm((PetscObject)ds),MPI_COMM_TYPE_SHARED,0,MPI_INFO_NULL,&ds->nodecomm));
+    PetscCallMPI(MPI_Comm_rank(ds->nodecomm,&ds->noderank));
+    PetscCallMPI(MPI_Comm_size(ds->nodecomm,&ds->nodesize));
+  }
+  if (ds->nodesize==1) {  /* no other processes in this node, use regular storage */
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,rows,cols,NULL,&ds->omat[m]));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  winsize = ds->noderank? 0: rows*cols*sizeof(PetscScalar);
+  PetscCallMPI(MPI_Win_allocate_shared(winsize,sizeof(PetscScalar),MPI_INFO_NULL,ds->nodecomm,&base,&ds->win[m]));
+  if (ds->noderank) PetscCallMPI(MPI_Win_shared_query(ds->win[m],0,&winsize,&dispunit,&base));
+  else PetscCall(PetscArrayzero(base,rows*cols));
+  PetscCallMPI(MPI_Barrier(ds->nodecomm));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,rows,cols,base,&ds->omat[m]));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 PetscErrorCode DSAllocateMat_Private(DS ds,DSMatType m)
 {
   PetscInt       n,d,rows=0,cols;
@@ -56,13 +87,52 @@ PetscErrorCode DSAllocateMat_Private(DS ds,DSMatType m)
     default:
       rows = n;
   }
-  if (ds->omat[m]) PetscCall(MatZeroEntries(ds->omat[m]));
-  else {
+  if (ds->omat[m]) {
+#if !defined(PETSC_HAVE_MPIUNI)
+    if (ds->win[m]!=MPI_WIN_NULL) {  /* node-shared matrix, zeroed by the leader only */
+      if (!ds->noderank) PetscCall(MatZeroEntries(ds->omat[m]));
+      PetscCallMPI(MPI_Barrier(ds->nodecomm));
+    } else PetscCall(MatZeroEntries(ds->omat[m]));
+#else
+    PetscCall(MatZeroEntries(ds->omat[m]));
+#endif
+  } else {
+#if !defined(PETSC_HAVE_MPIUNI)
+    if (ds->shmem && ds->allocating) PetscCall(DSAllocateShared_Private(ds,m,rows,cols));
+    else
+#endif
     PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,rows,cols,NULL,&ds->omat[m]));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   In node-shared mode, an operation that modifies the matrices is carried out
+   by the first process of each node only. This helper is called by all
+   processes afterwards: it waits until the leader has finished and then
+   replicates the small per-process data (dimensions, permutation and
+   optionally the eigenvalue arrays) from the leader.
+*/
+PetscErrorCode DSNodeShareResult_Private(DS ds,PetscScalar eigr[],PetscScalar eigi[])
+{
+  PetscInt       idata[5];
+  PetscMPIInt    n;
+
+  PetscFunctionBegin;
+  PetscCallMPI(MPI_Barrier(ds->nodecomm));
+  idata[0] = ds->n; idata[1] = ds->l; idata[2] = ds->k; idata[3] = ds->t; idata[4] = (PetscInt)ds->state;
+  PetscCallMPI(MPI_Bcast(idata,5,MPIU_INT,0,ds->nodecomm));
+  ds->n = idata[0]; ds->l = idata[1]; ds->k = idata[2]; ds->t = idata[3]; ds->state = (DSStateType)idata[4];
+  if (ds->perm) {
+    PetscCall(PetscMPIIntCast(ds->ld,&n));
+    PetscCallMPI(MPI_Bcast(ds->perm,n,MPIU_INT,0,ds->nodecomm));
+  }
+  PetscCall(PetscMPIIntCast(ds->n,&n));
+  if (eigr) PetscCallMPI(MPI_Bcast(eigr,n,MPIU_SCALAR,0,ds->nodecomm));
+  if (eigi) PetscCallMPI(MPI_Bcast(eigi,n,MPIU_SCALAR,0,ds->nodecomm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode DSAllocateWork_Private(DS ds,PetscInt s,PetscInt r,PetscInt i)
 {
   PetscFunctionBegin;
@@ -172,10 +242,15 @@ PetscErrorCode DSViewMat(DS ds,PetscViewer viewer,DSMatType m)
 PetscErrorCode DSSortEigenvalues_Private(DS ds,PetscScalar *wr,PetscScalar *wi,PetscInt *perm,PetscBool isghiep)
 {
   PetscScalar    re,im,wi0;
+  PetscReal      *keys,ki=0.0;
   PetscInt       n,i,j,result,tmp1,tmp2=0,d=1;
+  PetscBool      avail;
 
   PetscFunctionBegin;
   n = ds->t;   /* sort only first t pairs if truncated */
+  /* extract sorting keys in a single batched pass whenever the criterion allows it */
+  PetscCall(PetscMalloc1(n,&keys));
+  PetscCall(SlepcSCComputeKeys(ds->sc,n,wr,wi,keys,&avail));
   /* insertion sort */
   i=ds->l+1;
 #if !defined(PETSC_USE_COMPLEX)
@@ -188,6 +263,7 @@ PetscErrorCode DSSortEigenvalues_Private(DS ds,PetscScalar *wr,PetscScalar *wi,P
     if (wi) im = wi[perm[i]];
     else im = 0.0;
     tmp1 = perm[i];
+    if (avail) ki = keys[tmp1];
 #if !defined(PETSC_USE_COMPLEX)
     if (im!=0.0) { d = 2; tmp2 = perm[i+1]; }
     else d = 1;
@@ -196,9 +272,12 @@ PetscErrorCode DSSortEigenvalues_Private(DS ds,PetscScalar *wr,PetscScalar *wi,P
     else d = 1;
 #endif
     j = i-1;
-    if (wi) wi0 = wi[perm[j]];
-    else wi0 = 0.0;
-    PetscCall(SlepcSCCompare(ds->sc,re,im,wr[perm[j]],wi0,&result));
+    if (avail) result = (ki<keys[perm[j]])? -1: ((ki>keys[perm[j]])? 1: 0);
+    else {
+      if (wi) wi0 = wi[perm[j]];
+      else wi0 = 0.0;
+      PetscCall(SlepcSCCompare(ds->sc,re,im,wr[perm[j]],wi0,&result));
+    }
     while (result<0 && j>=ds->l) {
       perm[j+d] = perm[j];
       j--;
@@ -210,35 +289,51 @@ PetscErrorCode DSSortEigenvalues_Private(DS ds,PetscScalar *wr,PetscScalar *wi,P
         { perm[j+d] = perm[j]; j--; }
 
       if (j>=ds->l) {
-        if (wi) wi0 = wi[perm[j]];
-        else wi0 = 0.0;
-        PetscCall(SlepcSCCompare(ds->sc,re,im,wr[perm[j]],wi0,&result));
+        if (avail) result = (ki<keys[perm[j]])? -1: ((ki>keys[perm[j]])? 1: 0);
+        else {
+          if (wi) wi0 = wi[perm[j]];
+          else wi0 = 0.0;
+          PetscCall(SlepcSCCompare(ds->sc,re,im,wr[perm[j]],wi0,&result));
+        }
       }
     }
     perm[j+1] = tmp1;
     if (d==2) perm[j+2] = tmp2;
   }
+  PetscCall(PetscFree(keys));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode DSSortEigenvaluesReal_Private(DS ds,PetscReal *eig,PetscInt *perm)
 {
-  PetscScalar    re;
+  PetscScalar    re,*vals;
+  PetscReal      *keys,ki=0.0;
   PetscInt       i,j,result,tmp,l,n;
+  PetscBool      avail;
 
   PetscFunctionBegin;
   n = ds->t;   /* sort only first t pairs if truncated */
   l = ds->l;
+  /* extract sorting keys in a single batched pass whenever the criterion allows it */
+  PetscCall(PetscMalloc2(n,&keys,n,&vals));
+  for (i=0;i<n;i++) vals[i] = eig[i];
+  PetscCall(SlepcSCComputeKeys(ds->sc,n,vals,NULL,keys,&avail));
   /* insertion sort */
   for (i=l+1;i<n;i++) {
     re = eig[perm[i]];
+    if (avail) ki = keys[perm[i]];
     j = i-1;
-    PetscCall(SlepcSCCompare(ds->sc,re,0.0,eig[perm[j]],0.0,&result));
+    if (avail) result = (ki<keys[perm[j]])? -1: ((ki>keys[perm[j]])? 1: 0);
+    else PetscCall(SlepcSCCompare(ds->sc,re,0.0,eig[perm[j]],0.0,&result));
     while (result<0 && j>=l) {
       tmp = perm[j]; perm[j] = perm[j+1]; perm[j+1] = tmp; j--;
-      if (j>=l) PetscCall(SlepcSCCompare(ds->sc,re,0.0,eig[perm[j]],0.0,&result));
+      if (j>=l) {
+        if (avail) result = (ki<keys[perm[j]])? -1: ((ki>keys[perm[j]])? 1: 0);
+        else PetscCall(SlepcSCCompare(ds->sc,re,0.0,eig[perm[j]],0.0,&result));
+      }
     }
   }
+  PetscCall(PetscFree2(keys,vals));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -431,6 +526,11 @@ PetscErrorCode DSOrthogonalize(DS ds,DSMatType mat,PetscInt cols,PetscInt *lindc
   PetscCheck(cols<=n,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_WRONG,"Invalid number of columns");
   if (n == 0 || cols == 0) PetscFunctionReturn(PETSC_SUCCESS);
 
+  if (DSNodeSharedActive(ds) && ds->noderank) {  /* the matrix is node-shared, the leader does the work */
+    PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
+    if (lindcols) PetscCallMPI(MPI_Bcast(lindcols,1,MPIU_INT,0,ds->nodecomm));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
   PetscCall(MatDenseGetArray(ds->omat[mat],&A));
@@ -453,6 +553,10 @@ PetscErrorCode DSOrthogonalize(DS ds,DSMatType mat,PetscInt cols,PetscInt *lindc
   PetscCall(PetscFPTrapPop());
   PetscCall(MatDenseRestoreArray(ds->omat[mat],&A));
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) {
+    PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
+    if (lindcols) PetscCallMPI(MPI_Bcast(lindcols,1,MPIU_INT,0,ds->nodecomm));
+  }
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -544,6 +648,13 @@ PetscErrorCode DSPseudoOrthogonalize(DS ds,DSMatType mat,PetscInt cols,PetscReal
   n = n - l;
   PetscCheck(cols<=n,PetscObjectComm((PetscObject)ds),PETSC_ERR_ARG_WRONG,"Invalid number of columns");
   if (n == 0 || cols == 0) PetscFunctionReturn(PETSC_SUCCESS);
+
+  if (DSNodeSharedActive(ds) && ds->noderank) {  /* the matrix is node-shared, the leader does the work */
+    PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
+    if (ns) PetscCallMPI(MPI_Bcast(ns,(PetscMPIInt)cols,MPIU_REAL,0,ds->nodecomm));
+    if (lindcols) *lindcols = cols;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(PetscLogEventBegin(DS_Other,ds,0,0,0));
   PetscCall(PetscBLASIntCast(n,&rA_));
   PetscCall(PetscBLASIntCast(ld,&ld_));
@@ -583,6 +694,10 @@ PetscErrorCode DSPseudoOrthogonalize(DS ds,DSMatType mat,PetscInt cols,PetscReal
   }
   PetscCall(MatDenseRestoreArray(ds->omat[mat],&A_));
   PetscCall(PetscLogEventEnd(DS_Other,ds,0,0,0));
+  if (DSNodeSharedActive(ds)) {
+    PetscCall(DSNodeShareResult_Private(ds,NULL,NULL));
+    if (ns) PetscCallMPI(MPI_Bcast(ns,(PetscMPIInt)cols,MPIU_REAL,0,ds->nodecomm));
+  }
   PetscCall(PetscObjectStateIncrease((PetscObject)ds));
   if (lindcols) *lindcols = cols;
   PetscFunctionReturn(PETSC_SUCCESS);
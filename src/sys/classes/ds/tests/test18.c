@@ -125,5 +125,8 @@ int main(int argc,char **argv)
       test:
          suffix: 2
          args: -ds_parallel synchronized
+      test:
+         suffix: 3
+         args: -ds_parallel {{redundant synchronized}} -ds_node_shared
 
 TEST*/
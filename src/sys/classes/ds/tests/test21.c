@@ -141,12 +141,15 @@ int main(int argc,char **argv)
       output_file: output/test21_1.out
       requires: !single
       nsize: {{1 2 3}}
-      filter: grep -v "parallel operation mode" | grep -v " MPI process"
+      filter: grep -v "parallel operation mode" | grep -v " MPI process" | grep -v "node-shared storage"
       test:
          suffix: 1
          args: -ds_parallel redundant
       test:
          suffix: 2
          args: -ds_parallel synchronized
+      test:
+         suffix: 3
+         args: -ds_parallel {{redundant synchronized}} -ds_node_shared
 
 TEST*/
@@ -0,0 +1,97 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Benchmark DSSolve.\n\n"
+  "Times DSSolve on randomly generated dense problems of a given type and\n"
+  "dimension, reporting the median wall time over a number of repetitions.\n"
+  "By default only the configuration is printed, so that the output does not\n"
+  "depend on the machine; use -json to print the measured times.\n\n";
+
+#include <slepcds.h>
+#include <petsctime.h>
+
+int main(int argc,char **argv)
+{
+  DS             ds;
+  PetscRandom    rand;
+  PetscScalar    *A,*wr,*wi,val;
+  PetscReal      *times,med;
+  PetscInt       i,j,r,n=64,ld,reps=5;
+  PetscLogDouble t0,t1;
+  PetscBool      json,flg;
+  char           type[64]="hep";
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-reps",&reps,NULL));
+  PetscCall(PetscOptionsGetString(NULL,NULL,"-type",type,sizeof(type),NULL));
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-json",&json));
+  PetscCheck(reps>0,PETSC_COMM_WORLD,PETSC_ERR_USER_INPUT,"The number of repetitions must be at least 1");
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Benchmark of DSSolve for a %s problem of dimension %" PetscInt_FMT " (%" PetscInt_FMT " repetitions).\n",type,n,reps));
+
+  /* Create DS object */
+  PetscCall(DSCreate(PETSC_COMM_WORLD,&ds));
+  PetscCall(DSSetType(ds,type));
+  PetscCall(DSSetFromOptions(ds));
+  ld = n+2;  /* test leading dimension larger than n */
+  PetscCall(DSAllocate(ds,ld));
+  PetscCall(DSSetDimensions(ds,n,0,0));
+  PetscCall(PetscStrcmp(type,DSHEP,&flg));
+
+  PetscCall(PetscRandomCreate(PETSC_COMM_SELF,&rand));
+  PetscCall(PetscRandomSetFromOptions(rand));
+  PetscCall(PetscMalloc3(n,&wr,n,&wi,reps,&times));
+
+  for (r=0;r<reps;r++) {
+    /* Refill the matrix with random entries, Hermitian in the HEP case */
+    PetscCall(DSGetArray(ds,DS_MAT_A,&A));
+    for (j=0;j<n;j++) {
+      for (i=0;i<n;i++) {
+        PetscCall(PetscRandomGetValue(rand,&val));
+        A[i+j*ld] = val;
+      }
+    }
+    if (flg) {
+      for (j=0;j<n;j++) {
+        A[j+j*ld] = PetscRealPart(A[j+j*ld]);
+        for (i=0;i<j;i++) A[i+j*ld] = PetscConj(A[j+i*ld]);
+      }
+    }
+    PetscCall(DSRestoreArray(ds,DS_MAT_A,&A));
+    PetscCall(DSSetState(ds,DS_STATE_RAW));
+    PetscCall(PetscTime(&t0));
+    PetscCall(DSSolve(ds,wr,wi));
+    PetscCall(PetscTime(&t1));
+    times[r] = (PetscReal)(t1-t0);
+  }
+  PetscCall(PetscSortReal(reps,times));
+  med = times[reps/2];
+
+  if (json) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"{\"ds\": {\"type\": \"%s\", \"n\": %" PetscInt_FMT ", \"reps\": %" PetscInt_FMT ", \"DSSolve\": %g}}\n",type,n,reps,(double)med));
+
+  PetscCall(PetscFree3(wr,wi,times));
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(DSDestroy(&ds));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -n 48 -reps 3
+
+   test:
+      suffix: 2
+      args: -type nhep -n 48 -reps 3
+
+TEST*/
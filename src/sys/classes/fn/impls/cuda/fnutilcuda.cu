@@ -260,7 +260,7 @@ __host__ PetscErrorCode mult_diagonal(PetscInt n,PetscScalar *d_pa,PetscInt ld,P
 
   PetscFunctionBegin;
   PetscCall(SlepcKernelSetGrid1D(n,&blocks3d,&threads3d,&dimGrid_xcount));
-  PetscCallCUDA(cudaMalloc((void **)&d_part,sizeof(PetscScalar)*blocks3d.x));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_part,sizeof(PetscScalar)*blocks3d.x));
   PetscCall(PetscMalloc1(blocks3d.x,&part));
   for (i=0;i<dimGrid_xcount;i++) {
     mult_diagonal_kernel<<<blocks3d,threads3d>>>(n,d_pa,ld,d_part,i);
@@ -272,7 +272,7 @@ __host__ PetscErrorCode mult_diagonal(PetscInt n,PetscScalar *d_pa,PetscInt ld,P
     } else j=0;
     for (; j<(int)blocks3d.x; j++) *v *= part[j];
   }
-  PetscCallCUDA(cudaFree(d_part));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_part));
   PetscCall(PetscFree(part));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
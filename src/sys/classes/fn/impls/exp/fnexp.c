@@ -709,10 +709,31 @@ static PetscInt ell(PetscBLASInt n,PetscScalar *A,PetscReal coeff,PetscInt m,Pet
   PetscFunctionReturn(t);
 }
 
+/*
+ * Form the even powers of A up to A^(2*idx), Apowers[j] = A^(2*j); npowers keeps
+ * track of the highest power formed so far
+ */
+static PetscErrorCode expm_form_powers(PetscBLASInt n_,PetscScalar **Apowers,PetscInt idx,PetscInt *npowers)
+{
+  PetscScalar    sone=1.0,szero=0.0;
+
+  PetscFunctionBegin;
+  while (*npowers<idx) {
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&n_,&n_,&sone,Apowers[1],&n_,Apowers[*npowers],&n_,&szero,Apowers[*npowers+1],&n_));
+    PetscCall(PetscLogFlops(2.0*n_*n_*n_));
+    (*npowers)++;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
  * Compute scaling parameter (s) and order of Pade approximant (m)  (required workspace is 4*n*n)
+ *
+ * For small matrices the required powers of A are formed explicitly; otherwise their
+ * norms are estimated without forming them, and only the powers needed by the
+ * selected approximant will be formed by the caller (npowers is updated accordingly)
  */
-static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,PetscInt *m,PetscScalar *work)
+static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,PetscInt *m,PetscInt *npowers,PetscScalar *work)
 {
   PetscScalar     sfactor,sone=1.0,szero=0.0,*A=Apowers[0],*Ascaled;
   PetscReal       d4,d6,d8,d10,eta1,eta3,eta4,eta5,rwork[1];
@@ -731,13 +752,25 @@ static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,P
   *m = 13;
   PetscCall(PetscBLASIntCast(n,&n_));
   PetscCall(PetscRandomCreate(PETSC_COMM_SELF,&rand));
-  d4 = PetscPowReal(LAPACKlange_("O",&n_,&n_,Apowers[2],&n_,rwork),1.0/4.0);
-  if (d4==0.0) { /* safeguard for the case A = 0 */
-    *m = 3;
-    goto done;
+  if (n<SMALLN) {
+    PetscCall(expm_form_powers(n_,Apowers,3,npowers));
+    d4 = PetscPowReal(LAPACKlange_("O",&n_,&n_,Apowers[2],&n_,rwork),1.0/4.0);
+    if (d4==0.0) { /* safeguard for the case A = 0 */
+      *m = 3;
+      goto done;
+    }
+    d6 = PetscPowReal(LAPACKlange_("O",&n_,&n_,Apowers[3],&n_,rwork),1.0/6.0);
+    PetscCall(PetscLogFlops(2.0*n*n));
+  } else {
+    PetscCall(SlepcNormAm(n_,Apowers[1],2,work,rand,&d4));
+    d4 = PetscPowReal(d4,1.0/4.0);
+    if (d4==0.0) { /* safeguard for the case A = 0 */
+      *m = 3;
+      goto done;
+    }
+    PetscCall(SlepcNormAm(n_,Apowers[1],3,work,rand,&d6));
+    d6 = PetscPowReal(d6,1.0/6.0);
   }
-  d6 = PetscPowReal(LAPACKlange_("O",&n_,&n_,Apowers[3],&n_,rwork),1.0/6.0);
-  PetscCall(PetscLogFlops(2.0*n*n));
   eta1 = PetscMax(d4,d6);
   if (eta1<=theta[0] && !ell(n_,A,coeff[0],3,work,rand)) {
     *m = 3;
@@ -752,7 +785,7 @@ static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,P
     d8 = PetscPowReal(LAPACKlange_("O",&n_,&n_,work,&n_,rwork),1.0/8.0);
     PetscCall(PetscLogFlops(2.0*n*n*n+1.0*n*n));
   } else {
-    PetscCall(SlepcNormAm(n_,Apowers[2],2,work,rand,&d8));
+    PetscCall(SlepcNormAm(n_,Apowers[1],4,work,rand,&d8));
     d8 = PetscPowReal(d8,1.0/8.0);
   }
   eta3 = PetscMax(d6,d8);
@@ -798,7 +831,7 @@ done:
 PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
 {
   PetscBLASInt      n_=0,n2,*ipiv,info,one=1;
-  PetscInt          n,m,j,s;
+  PetscInt          n,m,j,s,npowers;
   PetscScalar       scale,smone=-1.0,sone=1.0,stwo=2.0,szero=0.0;
   PetscScalar       *Ba,*Apowers[5],*Q,*P,*W,*work,*aux;
   const PetscScalar *Aa,*c;
@@ -829,19 +862,21 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
 
   PetscCall(PetscArraycpy(Apowers[0],Aa,n2));
   PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&n_,&n_,&sone,Apowers[0],&n_,Apowers[0],&n_,&szero,Apowers[1],&n_));
-  PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&n_,&n_,&sone,Apowers[1],&n_,Apowers[1],&n_,&szero,Apowers[2],&n_));
-  PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&n_,&n_,&sone,Apowers[1],&n_,Apowers[2],&n_,&szero,Apowers[3],&n_));
-  PetscCall(PetscLogFlops(6.0*n*n*n));
+  PetscCall(PetscLogFlops(2.0*n*n*n));
+  npowers = 1;
 
   /* Compute scaling parameter and order of Pade approximant */
-  PetscCall(expm_params(n,Apowers,&s,&m,Apowers[4]));
+  PetscCall(expm_params(n,Apowers,&s,&m,&npowers,Apowers[4]));
+
+  /* form the remaining powers required by the selected approximant */
+  PetscCall(expm_form_powers(n_,Apowers,PetscMin((m+1)/2-1,3),&npowers));
 
   if (s) { /* rescale */
-    for (j=0;j<4;j++) {
+    for (j=0;j<=npowers;j++) {
       scale = PetscPowRealInt(2.0,-PetscMax(2*j,1)*s);
       PetscCallBLAS("BLASscal",BLASscal_(&n2,&scale,Apowers[j],&one));
     }
-    PetscCall(PetscLogFlops(4.0*n*n));
+    PetscCall(PetscLogFlops((npowers+1.0)*n*n));
   }
 
   /* Evaluate the Pade approximant */
@@ -957,20 +992,20 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Pade_CUDA(FN fn,Mat A,Mat B)
   ld  = n;
   ld2 = ld*ld;
   if (A==B) {
-    PetscCallCUDA(cudaMalloc((void **)&d_As,sizeof(PetscScalar)*m*m));
+    PetscCallCUDA(SlepcDeviceMallocAsync(&d_As,sizeof(PetscScalar)*m*m));
     PetscCall(MatDenseCUDAGetArrayRead(A,&Aa));
     PetscCallCUDA(cudaMemcpy(d_As,Aa,sizeof(PetscScalar)*ld2,cudaMemcpyDeviceToDevice));
     PetscCall(MatDenseCUDARestoreArrayRead(A,&Aa));
   } else PetscCall(MatDenseCUDAGetArrayRead(A,(const PetscScalar**)&d_As));
   PetscCall(MatDenseCUDAGetArrayWrite(B,&d_Ba));
 
-  PetscCallCUDA(cudaMalloc((void **)&d_Q,sizeof(PetscScalar)*m*m));
-  PetscCallCUDA(cudaMalloc((void **)&d_W,sizeof(PetscScalar)*m*m));
-  PetscCallCUDA(cudaMalloc((void **)&d_A2,sizeof(PetscScalar)*m*m));
-  PetscCallCUDA(cudaMalloc((void **)&d_ipiv,sizeof(PetscBLASInt)*ld));
-  PetscCallCUDA(cudaMalloc((void **)&d_info,sizeof(PetscBLASInt)));
-  PetscCallCUDA(cudaMalloc((void **)&d_ppP,sizeof(PetscScalar*)));
-  PetscCallCUDA(cudaMalloc((void **)&d_ppQ,sizeof(PetscScalar*)));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_Q,sizeof(PetscScalar)*m*m));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_W,sizeof(PetscScalar)*m*m));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_A2,sizeof(PetscScalar)*m*m));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_ipiv,sizeof(PetscBLASInt)*ld));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_info,sizeof(PetscBLASInt)));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_ppP,sizeof(PetscScalar*)));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_ppQ,sizeof(PetscScalar*)));
 
   PetscCall(PetscMalloc1(1,&ppP));
   PetscCall(PetscMalloc1(1,&ppQ));
@@ -1063,13 +1098,13 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Pade_CUDA(FN fn,Mat A,Mat B)
   PetscCall(PetscLogGpuFlops(2.0*n*n*n*sexp));
 
   PetscCall(PetscLogGpuTimeEnd());
-  PetscCallCUDA(cudaFree(d_Q));
-  PetscCallCUDA(cudaFree(d_W));
-  PetscCallCUDA(cudaFree(d_A2));
-  PetscCallCUDA(cudaFree(d_ipiv));
-  PetscCallCUDA(cudaFree(d_info));
-  PetscCallCUDA(cudaFree(d_ppP));
-  PetscCallCUDA(cudaFree(d_ppQ));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_Q));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_W));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_A2));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_ipiv));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_info));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_ppP));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_ppQ));
 
   PetscCall(PetscFree(ppP));
   PetscCall(PetscFree(ppQ));
@@ -1081,7 +1116,7 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Pade_CUDA(FN fn,Mat A,Mat B)
       PetscCallCUBLAS(cublasXscal(cublasv2handle,ld2,&scale,d_As,one));
     }
     PetscCall(MatDenseCUDARestoreArrayRead(A,(const PetscScalar**)&d_As));
-  } else PetscCallCUDA(cudaFree(d_As));
+  } else PetscCallCUDA(SlepcDeviceFreeAsync(d_As));
   PetscCall(MatDenseCUDARestoreArrayWrite(B,&d_Ba));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1654,6 +1689,160 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_GuettelNakatsukasa_CUDAm(FN fn,Mat A,Ma
 #endif /* PETSC_HAVE_MAGMA */
 #endif /* PETSC_HAVE_CUDA */
 
+#if defined(PETSC_HAVE_HIP)
+#include "../src/sys/classes/fn/impls/hip/fnutilhip.h"
+#include <slepchipblas.h>
+
+PetscErrorCode FNEvaluateFunctionMat_Exp_Pade_HIP(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt      n=0,ld,ld2,*d_ipiv,*d_info,info,one=1;
+  PetscInt          m,k,sexp;
+  PetscBool         odd;
+  const PetscInt    p=MAX_PADE;
+  PetscReal         c[MAX_PADE+1],s;
+  PetscScalar       scale,smone=-1.0,sone=1.0,stwo=2.0,szero=0.0;
+  const PetscScalar *Aa;
+  PetscScalar       *d_Ba,*d_As,*d_A2,*d_Q,*d_P,*d_W,*aux,**ppP,**d_ppP,**ppQ,**d_ppQ;
+  hipblasHandle_t   hipblashandle;
+
+  PetscFunctionBegin;
+  PetscCall(PetscDeviceInitialize(PETSC_DEVICE_HIP)); /* For HIP event timers */
+  PetscCall(PetscHIPBLASGetHandle(&hipblashandle));
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscBLASIntCast(m,&n));
+  ld  = n;
+  ld2 = ld*ld;
+  if (A==B) {
+    PetscCallHIP(SlepcDeviceMallocAsync(&d_As,sizeof(PetscScalar)*m*m));
+    PetscCall(MatDenseHIPGetArrayRead(A,&Aa));
+    PetscCallHIP(hipMemcpy(d_As,Aa,sizeof(PetscScalar)*ld2,hipMemcpyDeviceToDevice));
+    PetscCall(MatDenseHIPRestoreArrayRead(A,&Aa));
+  } else PetscCall(MatDenseHIPGetArrayRead(A,(const PetscScalar**)&d_As));
+  PetscCall(MatDenseHIPGetArrayWrite(B,&d_Ba));
+
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_Q,sizeof(PetscScalar)*m*m));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_W,sizeof(PetscScalar)*m*m));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_A2,sizeof(PetscScalar)*m*m));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_ipiv,sizeof(PetscBLASInt)*ld));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_info,sizeof(PetscBLASInt)));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_ppP,sizeof(PetscScalar*)));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_ppQ,sizeof(PetscScalar*)));
+
+  PetscCall(PetscMalloc1(1,&ppP));
+  PetscCall(PetscMalloc1(1,&ppQ));
+
+  d_P = d_Ba;
+  PetscCall(PetscLogGpuTimeBegin());
+
+  /* Pade' coefficients */
+  c[0] = 1.0;
+  for (k=1;k<=p;k++) c[k] = c[k-1]*(p+1-k)/(k*(2*p+1-k));
+
+  /* Scaling */
+  PetscCallHIPBLAS(hipblasXnrm2(hipblashandle,ld2,d_As,one,&s));
+  if (s>0.5) {
+    sexp = PetscMax(0,(int)(PetscLogReal(s)/PetscLogReal(2.0))+2);
+    scale = PetscPowRealInt(2.0,-sexp);
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,ld2,&scale,d_As,one));
+    PetscCall(PetscLogGpuFlops(1.0*n*n));
+  } else sexp = 0;
+
+  /* Horner evaluation */
+  PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_As,ld,d_As,ld,&szero,d_A2,ld));
+  PetscCall(PetscLogGpuFlops(2.0*n*n*n));
+  PetscCallHIP(hipMemset(d_Q,0,sizeof(PetscScalar)*ld2));
+  PetscCallHIP(hipMemset(d_P,0,sizeof(PetscScalar)*ld2));
+  PetscCall(set_diagonal(n,d_Q,ld,c[p]));
+  PetscCall(set_diagonal(n,d_P,ld,c[p-1]));
+
+  odd = PETSC_TRUE;
+  for (k=p-1;k>0;k--) {
+    if (odd) {
+      PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_Q,ld,d_A2,ld,&szero,d_W,ld));
+      SWAP(d_Q,d_W,aux);
+      PetscCall(shift_diagonal(n,d_Q,ld,c[k-1]));
+      odd = PETSC_FALSE;
+    } else {
+      PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_P,ld,d_A2,ld,&szero,d_W,ld));
+      SWAP(d_P,d_W,aux);
+      PetscCall(shift_diagonal(n,d_P,ld,c[k-1]));
+      odd = PETSC_TRUE;
+    }
+    PetscCall(PetscLogGpuFlops(2.0*n*n*n));
+  }
+  if (odd) {
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_Q,ld,d_As,ld,&szero,d_W,ld));
+    SWAP(d_Q,d_W,aux);
+    PetscCallHIPBLAS(hipblasXaxpy(hipblashandle,ld2,&smone,d_P,one,d_Q,one));
+
+    ppQ[0] = d_Q;
+    ppP[0] = d_P;
+    PetscCallHIP(hipMemcpy(d_ppQ,ppQ,sizeof(PetscScalar*),hipMemcpyHostToDevice));
+    PetscCallHIP(hipMemcpy(d_ppP,ppP,sizeof(PetscScalar*),hipMemcpyHostToDevice));
+
+    PetscCallHIPBLAS(hipblasXgetrfBatched(hipblashandle,n,d_ppQ,ld,d_ipiv,d_info,one));
+    PetscCallHIP(hipMemcpy(&info,d_info,sizeof(PetscBLASInt),hipMemcpyDeviceToHost));
+    PetscCheck(info>=0,PETSC_COMM_SELF,PETSC_ERR_LIB,"LAPACKgetrf: Illegal value on argument %" PetscBLASInt_FMT,PetscAbsInt(info));
+    PetscCheck(info<=0,PETSC_COMM_SELF,PETSC_ERR_MAT_LU_ZRPVT,"LAPACKgetrf: Matrix is singular. U(%" PetscBLASInt_FMT ",%" PetscBLASInt_FMT ") is zero",info,info);
+    PetscCallHIPBLAS(hipblasXgetrsBatched(hipblashandle,HIPBLAS_OP_N,n,n,(const PetscScalar **)d_ppQ,ld,d_ipiv,d_ppP,ld,&info,one));
+    PetscCheck(info>=0,PETSC_COMM_SELF,PETSC_ERR_LIB,"LAPACKgetri: Illegal value on argument %" PetscBLASInt_FMT,PetscAbsInt(info));
+    PetscCheck(info<=0,PETSC_COMM_SELF,PETSC_ERR_MAT_LU_ZRPVT,"LAPACKgetri: Matrix is singular. U(%" PetscBLASInt_FMT ",%" PetscBLASInt_FMT ") is zero",info,info);
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,ld2,&stwo,d_P,one));
+    PetscCall(shift_diagonal(n,d_P,ld,sone));
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,ld2,&smone,d_P,one));
+  } else {
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_P,ld,d_As,ld,&szero,d_W,ld));
+    SWAP(d_P,d_W,aux);
+    PetscCallHIPBLAS(hipblasXaxpy(hipblashandle,ld2,&smone,d_P,one,d_Q,one));
+
+    ppQ[0] = d_Q;
+    ppP[0] = d_P;
+    PetscCallHIP(hipMemcpy(d_ppQ,ppQ,sizeof(PetscScalar*),hipMemcpyHostToDevice));
+    PetscCallHIP(hipMemcpy(d_ppP,ppP,sizeof(PetscScalar*),hipMemcpyHostToDevice));
+
+    PetscCallHIPBLAS(hipblasXgetrfBatched(hipblashandle,n,d_ppQ,ld,d_ipiv,d_info,one));
+    PetscCallHIP(hipMemcpy(&info,d_info,sizeof(PetscBLASInt),hipMemcpyDeviceToHost));
+    PetscCheck(info>=0,PETSC_COMM_SELF,PETSC_ERR_LIB,"LAPACKgetrf: Illegal value on argument %" PetscBLASInt_FMT,PetscAbsInt(info));
+    PetscCheck(info<=0,PETSC_COMM_SELF,PETSC_ERR_MAT_LU_ZRPVT,"LAPACKgetrf: Matrix is singular. U(%" PetscBLASInt_FMT ",%" PetscBLASInt_FMT ") is zero",info,info);
+    PetscCallHIPBLAS(hipblasXgetrsBatched(hipblashandle,HIPBLAS_OP_N,n,n,(const PetscScalar **)d_ppQ,ld,d_ipiv,d_ppP,ld,&info,one));
+    PetscCheck(info>=0,PETSC_COMM_SELF,PETSC_ERR_LIB,"LAPACKgetri: Illegal value on argument %" PetscBLASInt_FMT,PetscAbsInt(info));
+    PetscCheck(info<=0,PETSC_COMM_SELF,PETSC_ERR_MAT_LU_ZRPVT,"LAPACKgetri: Matrix is singular. U(%" PetscBLASInt_FMT ",%" PetscBLASInt_FMT ") is zero",info,info);
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,ld2,&stwo,d_P,one));
+    PetscCall(shift_diagonal(n,d_P,ld,sone));
+  }
+  PetscCall(PetscLogGpuFlops(2.0*n*n*n+2.0*n*n*n/3.0+4.0*n*n));
+
+  for (k=1;k<=sexp;k++) {
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&sone,d_P,ld,d_P,ld,&szero,d_W,ld));
+    PetscCallHIP(hipMemcpy(d_P,d_W,sizeof(PetscScalar)*ld2,hipMemcpyDeviceToDevice));
+  }
+  PetscCall(PetscLogGpuFlops(2.0*n*n*n*sexp));
+
+  PetscCall(PetscLogGpuTimeEnd());
+  PetscCallHIP(SlepcDeviceFreeAsync(d_Q));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_W));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_A2));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_ipiv));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_info));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_ppP));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_ppQ));
+
+  PetscCall(PetscFree(ppP));
+  PetscCall(PetscFree(ppQ));
+
+  if (d_P!=d_Ba) PetscCallHIP(hipMemcpy(d_Ba,d_P,sizeof(PetscScalar)*ld2,hipMemcpyDeviceToDevice));
+  if (A!=B) {
+    if (s>0.5) {  /* undo scaling */
+      scale = 1.0/scale;
+      PetscCallHIPBLAS(hipblasXscal(hipblashandle,ld2,&scale,d_As,one));
+    }
+    PetscCall(MatDenseHIPRestoreArrayRead(A,(const PetscScalar**)&d_As));
+  } else PetscCallHIP(SlepcDeviceFreeAsync(d_As));
+  PetscCall(MatDenseHIPRestoreArrayWrite(B,&d_Ba));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif /* PETSC_HAVE_HIP */
+
 static PetscErrorCode FNView_Exp(FN fn,PetscViewer viewer)
 {
   PetscBool      isascii;
@@ -1708,6 +1897,9 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Exp(FN fn)
   fn->ops->evaluatefunctionmatcuda[2] = FNEvaluateFunctionMat_Exp_GuettelNakatsukasa_CUDAm; /* product form */
   fn->ops->evaluatefunctionmatcuda[3] = FNEvaluateFunctionMat_Exp_GuettelNakatsukasa_CUDAm; /* partial fraction */
 #endif
+#endif
+#if defined(PETSC_HAVE_HIP)
+  fn->ops->evaluatefunctionmathip[1] = FNEvaluateFunctionMat_Exp_Pade_HIP;
 #endif
   fn->ops->view                   = FNView_Exp;
   PetscFunctionReturn(PETSC_SUCCESS);
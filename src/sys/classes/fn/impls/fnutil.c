@@ -342,10 +342,10 @@ PetscErrorCode FNSqrtmNewtonSchulz_CUDA(FN fn,PetscBLASInt n,PetscScalar *d_A,Pe
   N = n*n;
   tol = PetscSqrtReal((PetscReal)n)*PETSC_MACHINE_EPSILON/2;
 
-  PetscCallCUDA(cudaMalloc((void **)&d_Yold,sizeof(PetscScalar)*N));
-  PetscCallCUDA(cudaMalloc((void **)&d_Z,sizeof(PetscScalar)*N));
-  PetscCallCUDA(cudaMalloc((void **)&d_Zold,sizeof(PetscScalar)*N));
-  PetscCallCUDA(cudaMalloc((void **)&d_M,sizeof(PetscScalar)*N));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_Yold,sizeof(PetscScalar)*N));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_Z,sizeof(PetscScalar)*N));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_Zold,sizeof(PetscScalar)*N));
+  PetscCallCUDA(SlepcDeviceMallocAsync(&d_M,sizeof(PetscScalar)*N));
 
   PetscCall(PetscLogGpuTimeBegin());
 
@@ -404,10 +404,10 @@ PetscErrorCode FNSqrtmNewtonSchulz_CUDA(FN fn,PetscBLASInt n,PetscScalar *d_A,Pe
   }
 
   PetscCall(PetscLogGpuTimeEnd());
-  PetscCallCUDA(cudaFree(d_Yold));
-  PetscCallCUDA(cudaFree(d_Z));
-  PetscCallCUDA(cudaFree(d_Zold));
-  PetscCallCUDA(cudaFree(d_M));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_Yold));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_Z));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_Zold));
+  PetscCallCUDA(SlepcDeviceFreeAsync(d_M));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -514,6 +514,102 @@ PetscErrorCode FNSqrtmDenmanBeavers_CUDAm(FN fn,PetscBLASInt n,PetscScalar *d_T,
 
 #endif /* PETSC_HAVE_CUDA */
 
+#if defined(PETSC_HAVE_HIP)
+#include "../src/sys/classes/fn/impls/hip/fnutilhip.h"
+#include <slepchipblas.h>
+
+/*
+ * Matrix square root by Newton-Schulz iteration. HIP version.
+ * Computes the principal square root of the matrix A using the
+ * Newton-Schulz iteration. A is overwritten with sqrtm(A).
+ */
+PetscErrorCode FNSqrtmNewtonSchulz_HIP(FN fn,PetscBLASInt n,PetscScalar *d_A,PetscBLASInt ld,PetscBool inv)
+{
+  PetscScalar        *d_Yold,*d_Z,*d_Zold,*d_M,alpha;
+  PetscReal          nrm,sqrtnrm,tol,Yres=0.0;
+  const PetscScalar  szero=0.0,sone=1.0,smone=-1.0,spfive=0.5,sthree=3.0;
+  PetscInt           it;
+  PetscBLASInt       N;
+  const PetscBLASInt one=1;
+  PetscBool          converged=PETSC_FALSE;
+  hipblasHandle_t    hipblashandle;
+
+  PetscFunctionBegin;
+  PetscCall(PetscDeviceInitialize(PETSC_DEVICE_HIP)); /* For HIP event timers */
+  PetscCall(PetscHIPBLASGetHandle(&hipblashandle));
+  N = n*n;
+  tol = PetscSqrtReal((PetscReal)n)*PETSC_MACHINE_EPSILON/2;
+
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_Yold,sizeof(PetscScalar)*N));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_Z,sizeof(PetscScalar)*N));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_Zold,sizeof(PetscScalar)*N));
+  PetscCallHIP(SlepcDeviceMallocAsync(&d_M,sizeof(PetscScalar)*N));
+
+  PetscCall(PetscLogGpuTimeBegin());
+
+  /* Z = I; */
+  PetscCallHIP(hipMemset(d_Z,0,sizeof(PetscScalar)*N));
+  PetscCall(set_diagonal(n,d_Z,ld,sone));
+
+  /* scale */
+  PetscCallHIPBLAS(hipblasXaxpy(hipblashandle,N,&smone,d_A,one,d_Z,one));
+  PetscCallHIPBLAS(hipblasXnrm2(hipblashandle,N,d_Z,one,&nrm));
+  sqrtnrm = PetscSqrtReal(nrm);
+  alpha = 1.0/nrm;
+  PetscCallHIPBLAS(hipblasXscal(hipblashandle,N,&alpha,d_A,one));
+  tol *= nrm;
+  PetscCall(PetscInfo(fn,"||I-A||_F = %g, new tol: %g\n",(double)nrm,(double)tol));
+  PetscCall(PetscLogGpuFlops(2.0*n*n));
+
+  /* Z = I; */
+  PetscCallHIP(hipMemset(d_Z,0,sizeof(PetscScalar)*N));
+  PetscCall(set_diagonal(n,d_Z,ld,sone));
+
+  for (it=0;it<NSMAXIT && !converged;it++) {
+    /* Yold = Y, Zold = Z */
+    PetscCallHIP(hipMemcpy(d_Yold,d_A,sizeof(PetscScalar)*N,hipMemcpyDeviceToDevice));
+    PetscCallHIP(hipMemcpy(d_Zold,d_Z,sizeof(PetscScalar)*N,hipMemcpyDeviceToDevice));
+
+    /* M = (3*I - Zold*Yold) */
+    PetscCallHIP(hipMemset(d_M,0,sizeof(PetscScalar)*N));
+    PetscCall(set_diagonal(n,d_M,ld,sthree));
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&smone,d_Zold,ld,d_Yold,ld,&sone,d_M,ld));
+
+    /* Y = (1/2) * Yold * M, Z = (1/2) * M * Zold */
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&spfive,d_Yold,ld,d_M,ld,&szero,d_A,ld));
+    PetscCallHIPBLAS(hipblasXgemm(hipblashandle,HIPBLAS_OP_N,HIPBLAS_OP_N,n,n,n,&spfive,d_M,ld,d_Zold,ld,&szero,d_Z,ld));
+
+    /* reldiff = norm(Y-Yold,'fro')/norm(Y,'fro') */
+    PetscCallHIPBLAS(hipblasXaxpy(hipblashandle,N,&smone,d_A,one,d_Yold,one));
+    PetscCallHIPBLAS(hipblasXnrm2(hipblashandle,N,d_Yold,one,&Yres));
+    PetscCheck(!PetscIsNanReal(Yres),PETSC_COMM_SELF,PETSC_ERR_FP,"The computed norm is not-a-number");
+    if (Yres<=tol) converged = PETSC_TRUE;
+    PetscCall(PetscInfo(fn,"it: %" PetscInt_FMT " res: %g\n",it,(double)Yres));
+
+    PetscCall(PetscLogGpuFlops(6.0*n*n*n+2.0*n*n));
+  }
+
+  PetscCheck(Yres<=tol,PETSC_COMM_SELF,PETSC_ERR_LIB,"SQRTM not converged after %d iterations", NSMAXIT);
+
+  /* undo scaling */
+  if (inv) {
+    alpha = 1.0/sqrtnrm;
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,N,&alpha,d_Z,one));
+    PetscCallHIP(hipMemcpy(d_A,d_Z,sizeof(PetscScalar)*N,hipMemcpyDeviceToDevice));
+  } else {
+    alpha = sqrtnrm;
+    PetscCallHIPBLAS(hipblasXscal(hipblashandle,N,&alpha,d_A,one));
+  }
+
+  PetscCall(PetscLogGpuTimeEnd());
+  PetscCallHIP(SlepcDeviceFreeAsync(d_Yold));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_Z));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_Zold));
+  PetscCallHIP(SlepcDeviceFreeAsync(d_M));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif /* PETSC_HAVE_HIP */
+
 #define ITMAX 5
 #define SWAP(a,b,t) do {t=a;a=b;b=t;} while (0)
 
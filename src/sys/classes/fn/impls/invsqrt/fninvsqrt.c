@@ -127,6 +127,42 @@ static PetscErrorCode FNEvaluateFunctionMat_Invsqrt_NS(FN fn,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Hybrid method: use the multiplication-only Newton-Schulz iteration when its
+   convergence can be guaranteed a priori (||I-A||_F<1), otherwise resort to
+   the Denman-Beavers iteration, which converges for any matrix with no
+   eigenvalues on the closed negative real axis.
+*/
+static PetscErrorCode FNEvaluateFunctionMat_Invsqrt_Auto(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt   n=0;
+  PetscScalar    *Ba,d;
+  PetscInt       i,j,m;
+  PetscReal      nrm=0.0;
+
+  PetscFunctionBegin;
+  if (A!=B) PetscCall(MatCopy(A,B,SAME_NONZERO_PATTERN));
+  PetscCall(MatDenseGetArray(B,&Ba));
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscBLASIntCast(m,&n));
+  for (j=0;j<m;j++) {
+    for (i=0;i<m;i++) {
+      d = Ba[i+j*m]-(i==j?(PetscScalar)1.0:(PetscScalar)0.0);
+      nrm += PetscAbsScalar(d)*PetscAbsScalar(d);
+    }
+  }
+  nrm = PetscSqrtReal(nrm);
+  if (nrm<1.0) {
+    PetscCall(PetscInfo(fn,"||I-A||_F = %g, using the Newton-Schulz iteration\n",(double)nrm));
+    PetscCall(FNSqrtmNewtonSchulz(fn,n,Ba,n,PETSC_TRUE));
+  } else {
+    PetscCall(PetscInfo(fn,"||I-A||_F = %g, using the Denman-Beavers iteration\n",(double)nrm));
+    PetscCall(FNSqrtmDenmanBeavers(fn,n,Ba,n,PETSC_TRUE));
+  }
+  PetscCall(MatDenseRestoreArray(B,&Ba));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode FNEvaluateFunctionMat_Invsqrt_Sadeghi(FN fn,Mat A,Mat B)
 {
   PetscBLASInt   n=0,ld,*ipiv,info;
@@ -231,7 +267,8 @@ static PetscErrorCode FNView_Invsqrt(FN fn,PetscViewer viewer)
                   "Schur method for inv(A)*sqrtm(A)",
                   "Denman-Beavers (product form)",
                   "Newton-Schulz iteration",
-                  "Sadeghi iteration"
+                  "Sadeghi iteration",
+                  "Newton-Schulz iteration with Denman-Beavers fallback"
   };
   const int      nmeth=PETSC_STATIC_ARRAY_LENGTH(methodname);
 
@@ -269,6 +306,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Invsqrt(FN fn)
   fn->ops->evaluatefunctionmat[1]    = FNEvaluateFunctionMat_Invsqrt_DBP;
   fn->ops->evaluatefunctionmat[2]    = FNEvaluateFunctionMat_Invsqrt_NS;
   fn->ops->evaluatefunctionmat[3]    = FNEvaluateFunctionMat_Invsqrt_Sadeghi;
+  fn->ops->evaluatefunctionmat[4]    = FNEvaluateFunctionMat_Invsqrt_Auto;
 #if defined(PETSC_HAVE_CUDA)
   fn->ops->evaluatefunctionmatcuda[2] = FNEvaluateFunctionMat_Invsqrt_NS_CUDA;
 #if defined(PETSC_HAVE_MAGMA)
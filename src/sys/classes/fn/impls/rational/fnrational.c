@@ -44,6 +44,42 @@ static PetscErrorCode FNEvaluateFunction_Rational(FN fn,PetscScalar x,PetscScala
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Vectorized variant of the above, where the Horner recurrence is applied to
+   all points at once, so that the inner loop over the points can be vectorized
+   by the compiler.
+*/
+static PetscErrorCode FNEvaluateFunctionArray_Rational(FN fn,PetscInt n,PetscScalar *x,PetscScalar *y)
+{
+  FN_RATIONAL *ctx = (FN_RATIONAL*)fn->data;
+  PetscInt    i,j;
+  PetscScalar c,*q;
+
+  PetscFunctionBegin;
+  if (!ctx->np) for (j=0;j<n;j++) y[j] = 1.0;
+  else {
+    for (j=0;j<n;j++) y[j] = ctx->pcoeff[0];
+    for (i=1;i<ctx->np;i++) {
+      c = ctx->pcoeff[i];
+      for (j=0;j<n;j++) y[j] = c+x[j]*y[j];
+    }
+  }
+  if (ctx->nq) {
+    PetscCall(PetscMalloc1(n,&q));
+    for (j=0;j<n;j++) q[j] = ctx->qcoeff[0];
+    for (i=1;i<ctx->nq;i++) {
+      c = ctx->qcoeff[i];
+      for (j=0;j<n;j++) q[j] = c+x[j]*q[j];
+    }
+    for (j=0;j<n;j++) {
+      PetscCheck(q[j]!=0.0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Function not defined in the requested value");
+      y[j] /= q[j];
+    }
+    PetscCall(PetscFree(q));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    Horner evaluation of P=p(A)
    d = degree of polynomial;   coeff = coefficients of polynomial;    W = workspace
@@ -489,6 +525,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Rational(FN fn)
 
   fn->ops->evaluatefunction          = FNEvaluateFunction_Rational;
   fn->ops->evaluatederivative        = FNEvaluateDerivative_Rational;
+  fn->ops->evaluatefunctionarray     = FNEvaluateFunctionArray_Rational;
   fn->ops->evaluatefunctionmat[0]    = FNEvaluateFunctionMat_Rational;
   fn->ops->evaluatefunctionmatvec[0] = FNEvaluateFunctionMatVec_Rational;
 #if defined(PETSC_HAVE_CUDA)
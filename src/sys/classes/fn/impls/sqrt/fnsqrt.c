@@ -102,6 +102,42 @@ static PetscErrorCode FNEvaluateFunctionMat_Sqrt_NS(FN fn,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Hybrid method: use the multiplication-only Newton-Schulz iteration when its
+   convergence can be guaranteed a priori (||I-A||_F<1), otherwise resort to
+   the Denman-Beavers iteration, which converges for any matrix with no
+   eigenvalues on the closed negative real axis.
+*/
+static PetscErrorCode FNEvaluateFunctionMat_Sqrt_Auto(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt   n=0;
+  PetscScalar    *Ba,d;
+  PetscInt       i,j,m;
+  PetscReal      nrm=0.0;
+
+  PetscFunctionBegin;
+  if (A!=B) PetscCall(MatCopy(A,B,SAME_NONZERO_PATTERN));
+  PetscCall(MatDenseGetArray(B,&Ba));
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscBLASIntCast(m,&n));
+  for (j=0;j<m;j++) {
+    for (i=0;i<m;i++) {
+      d = Ba[i+j*m]-(i==j?(PetscScalar)1.0:(PetscScalar)0.0);
+      nrm += PetscAbsScalar(d)*PetscAbsScalar(d);
+    }
+  }
+  nrm = PetscSqrtReal(nrm);
+  if (nrm<1.0) {
+    PetscCall(PetscInfo(fn,"||I-A||_F = %g, using the Newton-Schulz iteration\n",(double)nrm));
+    PetscCall(FNSqrtmNewtonSchulz(fn,n,Ba,n,PETSC_FALSE));
+  } else {
+    PetscCall(PetscInfo(fn,"||I-A||_F = %g, using the Denman-Beavers iteration\n",(double)nrm));
+    PetscCall(FNSqrtmDenmanBeavers(fn,n,Ba,n,PETSC_FALSE));
+  }
+  PetscCall(MatDenseRestoreArray(B,&Ba));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 #define MAXIT 50
 
 /*
@@ -362,6 +398,24 @@ PetscErrorCode FNEvaluateFunctionMat_Sqrt_Sadeghi_CUDAm(FN fn,Mat A,Mat B)
 #endif /* PETSC_HAVE_MAGMA */
 #endif /* PETSC_HAVE_CUDA */
 
+#if defined(PETSC_HAVE_HIP)
+PetscErrorCode FNEvaluateFunctionMat_Sqrt_NS_HIP(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt   n=0;
+  PetscScalar    *Ba;
+  PetscInt       m;
+
+  PetscFunctionBegin;
+  if (A!=B) PetscCall(MatCopy(A,B,SAME_NONZERO_PATTERN));
+  PetscCall(MatDenseHIPGetArray(B,&Ba));
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscBLASIntCast(m,&n));
+  PetscCall(FNSqrtmNewtonSchulz_HIP(fn,n,Ba,n,PETSC_FALSE));
+  PetscCall(MatDenseHIPRestoreArray(B,&Ba));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif /* PETSC_HAVE_HIP */
+
 static PetscErrorCode FNView_Sqrt(FN fn,PetscViewer viewer)
 {
   PetscBool      isascii;
@@ -370,7 +424,8 @@ static PetscErrorCode FNView_Sqrt(FN fn,PetscViewer viewer)
                   "Schur method for the square root",
                   "Denman-Beavers (product form)",
                   "Newton-Schulz iteration",
-                  "Sadeghi iteration"
+                  "Sadeghi iteration",
+                  "Newton-Schulz iteration with Denman-Beavers fallback"
   };
   const int      nmeth=PETSC_STATIC_ARRAY_LENGTH(methodname);
 
@@ -408,6 +463,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Sqrt(FN fn)
   fn->ops->evaluatefunctionmat[1]    = FNEvaluateFunctionMat_Sqrt_DBP;
   fn->ops->evaluatefunctionmat[2]    = FNEvaluateFunctionMat_Sqrt_NS;
   fn->ops->evaluatefunctionmat[3]    = FNEvaluateFunctionMat_Sqrt_Sadeghi;
+  fn->ops->evaluatefunctionmat[4]    = FNEvaluateFunctionMat_Sqrt_Auto;
 #if defined(PETSC_HAVE_CUDA)
   fn->ops->evaluatefunctionmatcuda[2] = FNEvaluateFunctionMat_Sqrt_NS_CUDA;
 #if defined(PETSC_HAVE_MAGMA)
@@ -415,6 +471,9 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Sqrt(FN fn)
   fn->ops->evaluatefunctionmatcuda[3] = FNEvaluateFunctionMat_Sqrt_Sadeghi_CUDAm;
 #endif /* PETSC_HAVE_MAGMA */
 #endif /* PETSC_HAVE_CUDA */
+#if defined(PETSC_HAVE_HIP)
+  fn->ops->evaluatefunctionmathip[2] = FNEvaluateFunctionMat_Sqrt_NS_HIP;
+#endif /* PETSC_HAVE_HIP */
   fn->ops->evaluatefunctionmatvec[0] = FNEvaluateFunctionMatVec_Sqrt_Schur;
   fn->ops->view                      = FNView_Sqrt;
   PetscFunctionReturn(PETSC_SUCCESS);
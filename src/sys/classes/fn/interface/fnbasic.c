@@ -13,6 +13,9 @@
 
 #include <slepc/private/fnimpl.h>      /*I "slepcfn.h" I*/
 #include <slepcblaslapack.h>
+#if defined(PETSC_HAVE_MAGMA)
+#include <slepcmagma.h>
+#endif
 
 PetscFunctionList FNList = NULL;
 PetscBool         FNRegisterAllCalled = PETSC_FALSE;
@@ -105,6 +108,7 @@ PetscErrorCode FNCreate(MPI_Comm comm,FN *newfn)
   fn->alpha    = 1.0;
   fn->beta     = 1.0;
   fn->method   = 0;
+  fn->memoize  = PETSC_FALSE;
 
   fn->nw       = 0;
   fn->cw       = 0;
@@ -230,6 +234,7 @@ PetscErrorCode FNSetType(FN fn,FNType type)
 
   PetscTryTypeMethod(fn,destroy);
   PetscCall(PetscMemzero(fn->ops,sizeof(struct _FNOps)));
+  if (fn->memoize) PetscCall(FNSetMemoize(fn,PETSC_TRUE));  /* flush the memoization table */
 
   PetscCall(PetscObjectChangeTypeName((PetscObject)fn,type));
   PetscCall((*r)(fn));
@@ -443,6 +448,94 @@ PetscErrorCode FNGetParallel(FN fn,FNParallelType *pmode)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   FN_MemoizeSlot - Maps a scalar argument to a slot of the memoization table,
+   by hashing the binary representation of the value.
+*/
+static PetscErrorCode FN_MemoizeSlot(PetscScalar x,PetscInt *slot)
+{
+  PetscInt64 h[2] = {0,0};
+
+  PetscFunctionBegin;
+  PetscCall(PetscMemcpy(h,&x,sizeof(PetscScalar)));
+  h[0] = (h[0]^h[1]^(h[0]>>23)) & 0x7fffffffffffffff;
+  *slot = (PetscInt)(h[0]%FN_MEMOIZE_SIZE);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   FNSetMemoize - Enables or disables the caching of scalar evaluations in a
+   memoization table.
+
+   Logically Collective
+
+   Input Parameters:
++  fn  - the math function context
+-  flg - whether scalar evaluations must be cached
+
+   Options Database Key:
+.  -fn_memoize <bool> - Sets the memoization flag
+
+   Notes:
+   When this option is enabled, the results of FNEvaluateFunction() and
+   FNEvaluateDerivative() are stored in a small hash table, so that a repeated
+   evaluation on an argument that is still in the table returns the cached value
+   without recomputing the function. This is intended for use cases where the
+   same points are evaluated many times, such as the divided differences
+   computed by nonlinear eigensolvers.
+
+   The table stores values of f(alpha*x), so later changes of the scaling
+   factors via FNSetScale() do not invalidate the cached entries. On the
+   contrary, changes made through type-specific routines such as
+   FNRationalSetNumerator() are not tracked, hence memoization should be
+   enabled only after the function has been completely defined. Calling this
+   function with flg equal to PETSC_TRUE flushes the table, even if
+   memoization was already enabled.
+
+   Level: advanced
+
+.seealso: FNGetMemoize(), FNEvaluateFunction(), FNEvaluateDerivative()
+@*/
+PetscErrorCode FNSetMemoize(FN fn,PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(fn,FN_CLASSID,1);
+  PetscValidLogicalCollectiveBool(fn,flg,2);
+  if (flg) {
+    if (!fn->memox) PetscCall(PetscCalloc6(FN_MEMOIZE_SIZE,&fn->memox,FN_MEMOIZE_SIZE,&fn->memoy,FN_MEMOIZE_SIZE,&fn->memoxd,FN_MEMOIZE_SIZE,&fn->memoyd,FN_MEMOIZE_SIZE,&fn->memof,FN_MEMOIZE_SIZE,&fn->memofd));
+    else {
+      PetscCall(PetscArrayzero(fn->memof,FN_MEMOIZE_SIZE));
+      PetscCall(PetscArrayzero(fn->memofd,FN_MEMOIZE_SIZE));
+    }
+  }
+  fn->memoize = flg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   FNGetMemoize - Gets the flag indicating whether scalar evaluations are cached.
+
+   Not Collective
+
+   Input Parameter:
+.  fn - the math function context
+
+   Output Parameter:
+.  flg - the memoization flag
+
+   Level: advanced
+
+.seealso: FNSetMemoize()
+@*/
+PetscErrorCode FNGetMemoize(FN fn,PetscBool *flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(fn,FN_CLASSID,1);
+  PetscAssertPointer(flg,2);
+  *flg = fn->memoize;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    FNEvaluateFunction - Computes the value of the function f(x) for a given x.
 
@@ -466,6 +559,7 @@ PetscErrorCode FNGetParallel(FN fn,FNParallelType *pmode)
 PetscErrorCode FNEvaluateFunction(FN fn,PetscScalar x,PetscScalar *y)
 {
   PetscScalar    xf,yf;
+  PetscInt       slot;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(fn,FN_CLASSID,1);
@@ -473,7 +567,16 @@ PetscErrorCode FNEvaluateFunction(FN fn,PetscScalar x,PetscScalar *y)
   PetscAssertPointer(y,3);
   PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
   xf = fn->alpha*x;
-  PetscUseTypeMethod(fn,evaluatefunction,xf,&yf);
+  if (fn->memoize) {
+    PetscCall(FN_MemoizeSlot(xf,&slot));
+    if (fn->memof[slot] && fn->memox[slot]==xf) yf = fn->memoy[slot];
+    else {
+      PetscUseTypeMethod(fn,evaluatefunction,xf,&yf);
+      fn->memox[slot] = xf;
+      fn->memoy[slot] = yf;
+      fn->memof[slot] = PETSC_TRUE;
+    }
+  } else PetscUseTypeMethod(fn,evaluatefunction,xf,&yf);
   *y = fn->beta*yf;
   PetscCall(PetscLogEventEnd(FN_Evaluate,fn,0,0,0));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -502,6 +605,7 @@ PetscErrorCode FNEvaluateFunction(FN fn,PetscScalar x,PetscScalar *y)
 PetscErrorCode FNEvaluateDerivative(FN fn,PetscScalar x,PetscScalar *y)
 {
   PetscScalar    xf,yf;
+  PetscInt       slot;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(fn,FN_CLASSID,1);
@@ -509,12 +613,80 @@ PetscErrorCode FNEvaluateDerivative(FN fn,PetscScalar x,PetscScalar *y)
   PetscAssertPointer(y,3);
   PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
   xf = fn->alpha*x;
-  PetscUseTypeMethod(fn,evaluatederivative,xf,&yf);
+  if (fn->memoize) {
+    PetscCall(FN_MemoizeSlot(xf,&slot));
+    if (fn->memofd[slot] && fn->memoxd[slot]==xf) yf = fn->memoyd[slot];
+    else {
+      PetscUseTypeMethod(fn,evaluatederivative,xf,&yf);
+      fn->memoxd[slot] = xf;
+      fn->memoyd[slot] = yf;
+      fn->memofd[slot] = PETSC_TRUE;
+    }
+  } else PetscUseTypeMethod(fn,evaluatederivative,xf,&yf);
   *y = fn->alpha*fn->beta*yf;
   PetscCall(PetscLogEventEnd(FN_Evaluate,fn,0,0,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@C
+   FNEvaluateFunctionArray - Computes the value of the function f(x) on an array
+   of points.
+
+   Not Collective
+
+   Input Parameters:
++  fn - the math function context
+.  n  - number of points where the function must be evaluated
+-  x  - array of points
+
+   Output Parameter:
+.  y  - array with the results of f(x[i]), must not overlap with x
+
+   Notes:
+   This is equivalent to calling FNEvaluateFunction() on each entry of x, but
+   with less overhead since the loop over the points is done internally. FN
+   types may provide a tailored implementation where the loop over the points
+   is vectorized.
+
+   Scaling factors are taken into account, as in FNEvaluateFunction(). The
+   memoization table, if enabled with FNSetMemoize(), is bypassed.
+
+   Level: intermediate
+
+.seealso: FNEvaluateFunction(), FNSetScale()
+@*/
+PetscErrorCode FNEvaluateFunctionArray(FN fn,PetscInt n,PetscScalar *x,PetscScalar *y)
+{
+  PetscInt       i;
+  PetscScalar    *xs,yf;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(fn,FN_CLASSID,1);
+  PetscValidType(fn,1);
+  PetscCheck(n>=0,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_OUTOFRANGE,"Number of points must be non-negative");
+  if (!n) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(x,3);
+  PetscAssertPointer(y,4);
+  PetscCheck(x!=y,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_IDN,"Arrays x and y must be different");
+  PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
+  if (fn->ops->evaluatefunctionarray) {
+    if (fn->alpha!=(PetscScalar)1.0) {
+      PetscCall(PetscMalloc1(n,&xs));
+      for (i=0;i<n;i++) xs[i] = fn->alpha*x[i];
+    } else xs = x;
+    PetscUseTypeMethod(fn,evaluatefunctionarray,n,xs,y);
+    if (fn->alpha!=(PetscScalar)1.0) PetscCall(PetscFree(xs));
+    if (fn->beta!=(PetscScalar)1.0) for (i=0;i<n;i++) y[i] *= fn->beta;
+  } else {
+    for (i=0;i<n;i++) {
+      PetscUseTypeMethod(fn,evaluatefunction,fn->alpha*x[i],&yf);
+      y[i] = fn->beta*yf;
+    }
+  }
+  PetscCall(PetscLogEventEnd(FN_Evaluate,fn,0,0,0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(FN fn,const PetscScalar *As,PetscScalar *Bs,PetscInt m,PetscBool firstonly)
 {
   PetscInt       i,j;
@@ -523,6 +695,15 @@ static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(FN fn,const PetscScalar
   PetscReal      *eig,dummy;
 #if defined(PETSC_USE_COMPLEX)
   PetscReal      *rwork,rdummy;
+#endif
+#if defined(PETSC_HAVE_MAGMA)
+  PetscInt       crossover;
+  PetscBLASInt   mlwork,liwork,*iwork;
+  PetscScalar    *mwork;
+#if defined(PETSC_USE_COMPLEX)
+  PetscBLASInt   mlrwork;
+  PetscReal      *mrwork;
+#endif
 #endif
 
   PetscFunctionBegin;
@@ -544,12 +725,35 @@ static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(FN fn,const PetscScalar
 
   /* compute eigendecomposition */
   for (j=0;j<n;j++) for (i=j;i<n;i++) Q[i+j*ld] = As[i+j*ld];
+#if defined(PETSC_HAVE_MAGMA)
+  PetscCall(SlepcMagmaGetCrossover(&crossover));
+  if (m>=crossover) {  /* large enough problem, diagonalize with the hybrid CPU+GPU kernel */
+    PetscCall(SlepcMagmaInit());
+    liwork = 5*n+3;
+    PetscCall(PetscMalloc1(liwork,&iwork));
 #if defined(PETSC_USE_COMPLEX)
-  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n,Q,&ld,eig,work,&lwork,rwork,&info));
+    mlwork  = n*n+2*n;
+    mlrwork = 2*n*n+5*n+1;
+    PetscCall(SlepcMagmaGetWorkspace(sizeof(PetscScalar)*mlwork+sizeof(PetscReal)*mlrwork,(void**)&mwork));
+    mrwork = (PetscReal*)(mwork+mlwork);
+    PetscCallMAGMA(magma_xsyevd,MagmaVec,MagmaLower,n,Q,ld,eig,mwork,mlwork,mrwork,mlrwork,iwork,liwork);
 #else
-  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n,Q,&ld,eig,work,&lwork,&info));
+    mlwork = 2*n*n+6*n+1;
+    PetscCall(SlepcMagmaGetWorkspace(sizeof(PetscScalar)*mlwork,(void**)&mwork));
+    PetscCallMAGMA(magma_xsyevd,MagmaVec,MagmaLower,n,Q,ld,eig,mwork,mlwork,iwork,liwork);
+#endif
+    PetscCall(PetscFree(iwork));
+  } else {
+#endif
+#if defined(PETSC_USE_COMPLEX)
+    PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n,Q,&ld,eig,work,&lwork,rwork,&info));
+#else
+    PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n,Q,&ld,eig,work,&lwork,&info));
+#endif
+    SlepcCheckLapackInfo("syev",info);
+#if defined(PETSC_HAVE_MAGMA)
+  }
 #endif
-  SlepcCheckLapackInfo("syev",info);
 
   /* W = f(Lambda)*Q' */
   for (i=0;i<n;i++) {
@@ -591,12 +795,15 @@ static PetscErrorCode FNEvaluateFunctionMat_Sym_Default(FN fn,Mat A,Mat B)
 
 static PetscErrorCode FNEvaluateFunctionMat_Basic(FN fn,Mat A,Mat F)
 {
-  PetscBool iscuda;
+  PetscBool iscuda,iship;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSECUDA,&iscuda));
+  PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSEHIP,&iship));
   if (iscuda && !fn->ops->evaluatefunctionmatcuda[fn->method]) PetscCall(PetscInfo(fn,"The method %" PetscInt_FMT " is not implemented for CUDA, falling back to CPU version\n",fn->method));
+  if (iship && !fn->ops->evaluatefunctionmathip[fn->method]) PetscCall(PetscInfo(fn,"The method %" PetscInt_FMT " is not implemented for HIP, falling back to CPU version\n",fn->method));
   if (iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmatcuda[fn->method],A,F);
+  else if (iship && fn->ops->evaluatefunctionmathip[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmathip[fn->method],A,F);
   else if (fn->ops->evaluatefunctionmat[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmat[fn->method],A,F);
   else {
     PetscCheck(fn->method,PetscObjectComm((PetscObject)fn),PETSC_ERR_SUP,"Matrix functions not implemented in this FN type");
@@ -607,7 +814,7 @@ static PetscErrorCode FNEvaluateFunctionMat_Basic(FN fn,Mat A,Mat F)
 
 PetscErrorCode FNEvaluateFunctionMat_Private(FN fn,Mat A,Mat B,PetscBool sync)
 {
-  PetscBool      set,flg,symm=PETSC_FALSE,iscuda,hasspecificmeth;
+  PetscBool      set,flg,symm=PETSC_FALSE,iscuda,iship,hasspecificmeth;
   PetscInt       m,n;
   PetscMPIInt    size,rank;
   PetscScalar    *pF;
@@ -626,7 +833,8 @@ PetscErrorCode FNEvaluateFunctionMat_Private(FN fn,Mat A,Mat B,PetscBool sync)
   if (size==1 || fn->pmode==FN_PARALLEL_REDUNDANT || (fn->pmode==FN_PARALLEL_SYNCHRONIZED && !rank)) {
     PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
     PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSECUDA,&iscuda));
-    hasspecificmeth = ((iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) || (!iscuda && fn->method && fn->ops->evaluatefunctionmat[fn->method]))? PETSC_TRUE: PETSC_FALSE;
+    PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSEHIP,&iship));
+    hasspecificmeth = ((iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) || (iship && fn->ops->evaluatefunctionmathip[fn->method]) || (!iscuda && !iship && fn->method && fn->ops->evaluatefunctionmat[fn->method]))? PETSC_TRUE: PETSC_FALSE;
     if (!hasspecificmeth && symm && !fn->method) {  /* prefer diagonalization */
       PetscCall(PetscInfo(fn,"Computing matrix function via diagonalization\n"));
       PetscCall(FNEvaluateFunctionMat_Sym_Default(fn,A,F));
@@ -698,7 +906,11 @@ PetscErrorCode FNEvaluateFunctionMat(FN fn,Mat A,Mat B)
     PetscValidHeaderSpecific(B,MAT_CLASSID,3);
     PetscValidType(B,3);
   } else inplace = PETSC_TRUE;
+#if defined(PETSC_HAVE_HIP)
+  PetscCheckTypeNames(A,MATSEQDENSE,MATSEQDENSEHIP);
+#else
   PetscCheckTypeNames(A,MATSEQDENSE,MATSEQDENSECUDA);
+#endif
   PetscCall(MatGetSize(A,&m,&n));
   PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Mat A is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",m,n);
   if (!inplace) {
@@ -717,6 +929,198 @@ PetscErrorCode FNEvaluateFunctionMat(FN fn,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   FNEvaluateFunctionMatBatch - Computes the value of the function f(A_i) for
+   a batch of matrices.
+
+   Logically Collective
+
+   Input Parameters:
++  fn   - the math function context
+.  nmat - number of matrices in the batch
+-  A    - array of matrices on which the function must be evaluated
+
+   Output Parameter:
+.  B    - (optional) array of matrices resulting from evaluating f(A_i)
+
+   Notes:
+   Each entry of the batch is subject to the same requirements as in
+   FNEvaluateFunctionMat(). If B is NULL then the computation is done in-place
+   for all entries, overwriting A_i with f(A_i).
+
+   This is equivalent to calling FNEvaluateFunctionMat() once per matrix, but
+   in the synchronized parallel mode (see FNSetParallel()) the results of the
+   whole batch are broadcast in a single message, which is considerably faster
+   than one synchronization per matrix when many small matrices are processed.
+
+   Level: advanced
+
+.seealso: FNEvaluateFunctionMat(), FNSetParallel()
+@*/
+PetscErrorCode FNEvaluateFunctionMatBatch(FN fn,PetscInt nmat,Mat A[],Mat B[])
+{
+  PetscBool         inplace=(PetscBool)!B;
+  PetscInt          i,m,n,n1,tot=0;
+  MatType           type;
+  PetscMPIInt       size,rank;
+  PetscScalar       *buf,*pF;
+  const PetscScalar *pFr;
+  Mat               F;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(fn,FN_CLASSID,1);
+  PetscValidLogicalCollectiveInt(fn,nmat,2);
+  PetscCheck(nmat>=0,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_OUTOFRANGE,"Number of matrices must be non-negative");
+  if (!nmat) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(A,3);
+  PetscValidType(fn,1);
+  for (i=0;i<nmat;i++) {
+    PetscValidHeaderSpecific(A[i],MAT_CLASSID,3);
+    PetscValidType(A[i],3);
+#if defined(PETSC_HAVE_HIP)
+    PetscCheckTypeNames(A[i],MATSEQDENSE,MATSEQDENSEHIP);
+#else
+    PetscCheckTypeNames(A[i],MATSEQDENSE,MATSEQDENSECUDA);
+#endif
+    PetscCall(MatGetSize(A[i],&m,&n));
+    PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Mat A[%" PetscInt_FMT "] is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",i,m,n);
+    if (!inplace) {
+      PetscValidHeaderSpecific(B[i],MAT_CLASSID,4);
+      PetscValidType(B[i],4);
+      PetscCall(MatGetType(A[i],&type));
+      PetscCheckTypeName(B[i],type);
+      n1 = n;
+      PetscCall(MatGetSize(B[i],&m,&n));
+      PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Mat B[%" PetscInt_FMT "] is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",i,m,n);
+      PetscCheck(n1==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Matrices A[%" PetscInt_FMT "] and B[%" PetscInt_FMT "] must have the same dimension",i,i);
+    }
+    tot += n*n;
+  }
+
+  /* evaluate matrix functions, with a single synchronization for the whole batch */
+  PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
+  for (i=0;i<nmat;i++) PetscCall(FNEvaluateFunctionMat_Private(fn,A[i],inplace?NULL:B[i],PETSC_FALSE));
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)fn),&size));
+  if (size>1 && fn->pmode==FN_PARALLEL_SYNCHRONIZED) {
+    PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)fn),&rank));
+    PetscCall(PetscMalloc1(tot,&buf));
+    if (!rank) {  /* pack all results into a single message */
+      for (i=0,tot=0;i<nmat;i++) {
+        F = inplace? A[i]: B[i];
+        PetscCall(MatGetSize(F,NULL,&n));
+        PetscCall(MatDenseGetArrayRead(F,&pFr));
+        PetscCall(PetscArraycpy(buf+tot,pFr,n*n));
+        PetscCall(MatDenseRestoreArrayRead(F,&pFr));
+        tot += n*n;
+      }
+    }
+    PetscCallMPI(MPI_Bcast(buf,tot,MPIU_SCALAR,0,PetscObjectComm((PetscObject)fn)));
+    if (rank) {
+      for (i=0,tot=0;i<nmat;i++) {
+        F = inplace? A[i]: B[i];
+        PetscCall(MatGetSize(F,NULL,&n));
+        PetscCall(MatDenseGetArray(F,&pF));
+        PetscCall(PetscArraycpy(pF,buf+tot,n*n));
+        PetscCall(MatDenseRestoreArray(F,&pF));
+        tot += n*n;
+      }
+    }
+    PetscCall(PetscFree(buf));
+  }
+  PetscCall(PetscLogEventEnd(FN_Evaluate,fn,0,0,0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+#define FN_KRYLOV_MATVEC_MIN_N 500   /* minimum matrix size to attempt the Arnoldi approximation */
+#define FN_KRYLOV_MATVEC_MAXIT 100   /* maximum dimension of the Krylov subspace */
+
+/*
+   FNEvaluateFunctionMatVec_Krylov - Arnoldi approximation of the first column
+   of f(A): build an orthonormal basis V_k of the Krylov subspace generated by
+   A and e_1, then f(A)*e_1 is approximated by V_k*f(H_k)*e_1, where H_k is the
+   projection of A onto the subspace. The iteration is stopped as soon as the
+   coefficient vector f(H_k)*e_1 has stabilized, hence the O(m^3) cost of
+   forming the full f(A) is avoided. If the iteration does not converge, done
+   is set to PETSC_FALSE and the caller must use another method.
+*/
+static PetscErrorCode FNEvaluateFunctionMatVec_Krylov(FN fn,Mat A,Vec v,PetscBool *done)
+{
+  PetscInt          i,j,k=0,m,lda,maxit;
+  PetscBLASInt      m_,j1_,k_,lda_,ld,one=1;
+  PetscScalar       *V,*H,*c,*coef,*fprev,*va,sone=1.0,szero=0.0,smone=-1.0;
+  const PetscScalar *As,*Fs;
+  PetscReal         hnorm,err=1.0,nrm,tol;
+  PetscBool         breakdown=PETSC_FALSE;
+  Mat               Hmat,Fmat;
+
+  PetscFunctionBegin;
+  *done = PETSC_FALSE;
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(MatDenseGetLDA(A,&lda));
+  maxit = PetscMin(m,FN_KRYLOV_MATVEC_MAXIT);
+  tol   = 100.0*PETSC_MACHINE_EPSILON;
+  PetscCall(PetscBLASIntCast(m,&m_));
+  PetscCall(PetscBLASIntCast(lda,&lda_));
+  PetscCall(PetscBLASIntCast(maxit+1,&ld));
+  PetscCall(PetscCalloc5((maxit+1)*m,&V,(maxit+1)*maxit,&H,maxit+1,&c,maxit+1,&coef,maxit+1,&fprev));
+  V[0] = 1.0;   /* start the recurrence with e_1 */
+  PetscCall(MatDenseGetArrayRead(A,&As));
+  for (j=0;j<maxit;j++) {
+    /* expand the subspace, w = A*v_j */
+    PetscCallBLAS("BLASgemv",BLASgemv_("N",&m_,&m_,&sone,As,&lda_,V+j*m,&one,&szero,V+(j+1)*m,&one));
+    /* orthogonalize with classical Gram-Schmidt with reorthogonalization */
+    j1_ = (PetscBLASInt)j+1;
+    PetscCallBLAS("BLASgemv",BLASgemv_("C",&m_,&j1_,&sone,V,&m_,V+(j+1)*m,&one,&szero,H+j*ld,&one));
+    PetscCallBLAS("BLASgemv",BLASgemv_("N",&m_,&j1_,&smone,V,&m_,H+j*ld,&one,&sone,V+(j+1)*m,&one));
+    PetscCallBLAS("BLASgemv",BLASgemv_("C",&m_,&j1_,&sone,V,&m_,V+(j+1)*m,&one,&szero,c,&one));
+    PetscCallBLAS("BLASgemv",BLASgemv_("N",&m_,&j1_,&smone,V,&m_,c,&one,&sone,V+(j+1)*m,&one));
+    for (i=0;i<=j;i++) H[j*ld+i] += c[i];
+    hnorm = BLASnrm2_(&m_,V+(j+1)*m,&one);
+    H[j*ld+j+1] = hnorm;
+    if (hnorm>0.0) for (i=0;i<m;i++) V[(j+1)*m+i] /= hnorm;
+    else breakdown = PETSC_TRUE;   /* invariant subspace, the approximation is exact */
+    /* evaluate the function on the projected matrix */
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,j+1,j+1,NULL,&Hmat));
+    PetscCall(MatDenseGetArray(Hmat,&va));
+    for (i=0;i<=j;i++) PetscCall(PetscArraycpy(va+i*(j+1),H+i*ld,j+1));
+    PetscCall(MatDenseRestoreArray(Hmat,&va));
+    PetscCall(MatDuplicate(Hmat,MAT_DO_NOT_COPY_VALUES,&Fmat));
+    PetscCall(FNEvaluateFunctionMat_Basic(fn,Hmat,Fmat));
+    PetscCall(MatDenseGetArrayRead(Fmat,&Fs));
+    PetscCall(PetscArraycpy(coef,Fs,j+1));
+    PetscCall(MatDenseRestoreArrayRead(Fmat,&Fs));
+    PetscCall(MatDestroy(&Hmat));
+    PetscCall(MatDestroy(&Fmat));
+    /* check if the coefficient vector has stabilized */
+    if (j>0) {
+      nrm = 0.0; err = 0.0;
+      for (i=0;i<=j;i++) {
+        err += PetscAbsScalar(coef[i]-fprev[i])*PetscAbsScalar(coef[i]-fprev[i]);
+        nrm += PetscAbsScalar(coef[i])*PetscAbsScalar(coef[i]);
+      }
+      err = (nrm>0.0)? PetscSqrtReal(err/nrm): PetscSqrtReal(err);
+    }
+    PetscCall(PetscArraycpy(fprev,coef,j+1));
+    if (breakdown || (j>0 && err<=tol)) {
+      k = j+1;
+      *done = PETSC_TRUE;
+      break;
+    }
+  }
+  PetscCall(MatDenseRestoreArrayRead(A,&As));
+  if (*done) {
+    /* v = V_k*f(H_k)*e_1 */
+    PetscCall(PetscBLASIntCast(k,&k_));
+    PetscCall(VecGetArrayWrite(v,&va));
+    PetscCallBLAS("BLASgemv",BLASgemv_("N",&m_,&k_,&sone,V,&m_,coef,&one,&szero,va,&one));
+    PetscCall(VecRestoreArrayWrite(v,&va));
+    PetscCall(PetscInfo(fn,"Arnoldi approximation of f(A)*e_1 converged with %" PetscInt_FMT " iterations\n",k));
+    PetscCall(PetscLogFlops(4.0*m*m*k));
+  }
+  PetscCall(PetscFree5(V,H,c,coef,fprev));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    FNEvaluateFunctionMatVec_Default - computes the full matrix f(A)
    and then copies the first column.
@@ -724,8 +1128,18 @@ PetscErrorCode FNEvaluateFunctionMat(FN fn,Mat A,Mat B)
 static PetscErrorCode FNEvaluateFunctionMatVec_Default(FN fn,Mat A,Vec v)
 {
   Mat            F;
+  PetscInt       m;
+  PetscBool      isdense,done;
 
   PetscFunctionBegin;
+  /* for large matrices, try first the Krylov approximation of f(A)*e_1 */
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSE,&isdense));
+  if (isdense && m>=FN_KRYLOV_MATVEC_MIN_N && fn->ops->evaluatefunctionmat[fn->method]) {
+    PetscCall(FNEvaluateFunctionMatVec_Krylov(fn,A,v,&done));
+    if (done) PetscFunctionReturn(PETSC_SUCCESS);
+    PetscCall(PetscInfo(fn,"Arnoldi approximation did not converge, falling back to full evaluation\n"));
+  }
   PetscCall(FN_AllocateWorkMat(fn,A,&F));
   PetscCall(FNEvaluateFunctionMat_Basic(fn,A,F));
   PetscCall(MatGetColumnVector(F,v,0));
@@ -756,7 +1170,7 @@ static PetscErrorCode FNEvaluateFunctionMatVec_Sym_Default(FN fn,Mat A,Vec v)
 
 PetscErrorCode FNEvaluateFunctionMatVec_Private(FN fn,Mat A,Vec v,PetscBool sync)
 {
-  PetscBool      set,flg,symm=PETSC_FALSE,iscuda,hasspecificmeth;
+  PetscBool      set,flg,symm=PETSC_FALSE,iscuda,iship,hasspecificmeth;
   PetscInt       m,n;
   Mat            M;
   PetscMPIInt    size,rank;
@@ -773,7 +1187,8 @@ PetscErrorCode FNEvaluateFunctionMatVec_Private(FN fn,Mat A,Vec v,PetscBool sync
   if (size==1 || fn->pmode==FN_PARALLEL_REDUNDANT || (fn->pmode==FN_PARALLEL_SYNCHRONIZED && !rank)) {
     PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
     PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSECUDA,&iscuda));
-    hasspecificmeth = ((iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) || (!iscuda && fn->method && fn->ops->evaluatefunctionmat[fn->method]))? PETSC_TRUE: PETSC_FALSE;
+    PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSEHIP,&iship));
+    hasspecificmeth = ((iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) || (iship && fn->ops->evaluatefunctionmathip[fn->method]) || (!iscuda && !iship && fn->method && fn->ops->evaluatefunctionmat[fn->method]))? PETSC_TRUE: PETSC_FALSE;
     if (!hasspecificmeth && symm && !fn->method) {  /* prefer diagonalization */
       PetscCall(PetscInfo(fn,"Computing matrix function via diagonalization\n"));
       PetscCall(FNEvaluateFunctionMatVec_Sym_Default(fn,A,v));
@@ -784,6 +1199,7 @@ PetscErrorCode FNEvaluateFunctionMatVec_Private(FN fn,Mat A,Vec v,PetscBool sync
         PetscCall(MatScale(M,fn->alpha));
       } else M = A;
       if (iscuda && fn->ops->evaluatefunctionmatveccuda[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmatveccuda[fn->method],M,v);
+      else if (iship && fn->ops->evaluatefunctionmatvechip[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmatvechip[fn->method],M,v);
       else if (fn->ops->evaluatefunctionmatvec[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmatvec[fn->method],M,v);
       else PetscCall(FNEvaluateFunctionMatVec_Default(fn,M,v));
       if (fn->alpha!=(PetscScalar)1.0) PetscCall(FN_FreeWorkMat(fn,&M));
@@ -827,7 +1243,7 @@ PetscErrorCode FNEvaluateFunctionMatVec_Private(FN fn,Mat A,Vec v,PetscBool sync
 PetscErrorCode FNEvaluateFunctionMatVec(FN fn,Mat A,Vec v)
 {
   PetscInt       m,n;
-  PetscBool      iscuda;
+  PetscBool      iscuda,iship;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(fn,FN_CLASSID,1);
@@ -836,11 +1252,16 @@ PetscErrorCode FNEvaluateFunctionMatVec(FN fn,Mat A,Vec v)
   PetscValidType(fn,1);
   PetscValidType(A,2);
   PetscValidType(v,3);
+#if defined(PETSC_HAVE_HIP)
+  PetscCheckTypeNames(A,MATSEQDENSE,MATSEQDENSEHIP);
+#else
   PetscCheckTypeNames(A,MATSEQDENSE,MATSEQDENSECUDA);
+#endif
   PetscCall(MatGetSize(A,&m,&n));
   PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Mat A is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",m,n);
   PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSECUDA,&iscuda));
-  PetscCheckTypeName(v,iscuda?VECSEQCUDA:VECSEQ);
+  PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSEHIP,&iship));
+  PetscCheckTypeName(v,iscuda?VECSEQCUDA:(iship?VECSEQHIP:VECSEQ));
   PetscCall(VecGetSize(v,&m));
   PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Matrix A and vector v must have the same size");
   PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
@@ -869,7 +1290,7 @@ PetscErrorCode FNSetFromOptions(FN fn)
   char           type[256];
   PetscScalar    array[2];
   PetscInt       k,meth;
-  PetscBool      flg;
+  PetscBool      flg,bval;
   FNParallelType pmode;
 
   PetscFunctionBegin;
@@ -894,6 +1315,9 @@ PetscErrorCode FNSetFromOptions(FN fn)
     PetscCall(PetscOptionsEnum("-fn_parallel","Operation mode in parallel runs","FNSetParallel",FNParallelTypes,(PetscEnum)fn->pmode,(PetscEnum*)&pmode,&flg));
     if (flg) PetscCall(FNSetParallel(fn,pmode));
 
+    PetscCall(PetscOptionsBool("-fn_memoize","Cache scalar evaluations in a memoization table","FNSetMemoize",fn->memoize,&bval,&flg));
+    if (flg) PetscCall(FNSetMemoize(fn,bval));
+
     PetscTryTypeMethod(fn,setfromoptions,PetscOptionsObject);
     PetscCall(PetscObjectProcessOptionsHandlers((PetscObject)fn,PetscOptionsObject));
   PetscOptionsEnd();
@@ -939,6 +1363,7 @@ PetscErrorCode FNView(FN fn,PetscViewer viewer)
     PetscCall(PetscObjectPrintClassNamePrefixType((PetscObject)fn,viewer));
     PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)fn),&size));
     if (size>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  parallel operation mode: %s\n",FNParallelTypes[fn->pmode]));
+    if (fn->memoize) PetscCall(PetscViewerASCIIPrintf(viewer,"  caching scalar evaluations in a memoization table\n"));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscTryTypeMethod(fn,view,viewer);
     PetscCall(PetscViewerASCIIPopTab(viewer));
@@ -1009,6 +1434,7 @@ PetscErrorCode FNDuplicate(FN fn,MPI_Comm comm,FN *newfn)
   PetscCall(FNSetMethod(*newfn,meth));
   PetscCall(FNGetParallel(fn,&ptype));
   PetscCall(FNSetParallel(*newfn,ptype));
+  if (fn->memoize) PetscCall(FNSetMemoize(*newfn,PETSC_TRUE));
   PetscTryTypeMethod(fn,duplicate,comm,newfn);
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1035,6 +1461,7 @@ PetscErrorCode FNDestroy(FN *fn)
   if (--((PetscObject)(*fn))->refct > 0) { *fn = NULL; PetscFunctionReturn(PETSC_SUCCESS); }
   PetscTryTypeMethod(*fn,destroy);
   for (i=0;i<(*fn)->nw;i++) PetscCall(MatDestroy(&(*fn)->W[i]));
+  if ((*fn)->memox) PetscCall(PetscFree6((*fn)->memox,(*fn)->memoy,(*fn)->memoxd,(*fn)->memoyd,(*fn)->memof,(*fn)->memofd));
   PetscCall(PetscHeaderDestroy(fn));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -217,6 +217,56 @@ static PetscErrorCode RGComputeQuadrature_Ellipse(RG rg,RGQuadRule quad,PetscInt
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Adaptive variant of the trapezoidal rule: the circle parameter is
+   reparametrized with theta(s) = s - sigma*sum_k sin(s-phi_k), where phi_k are
+   the angles of the given locations seen from the center of the ellipse. This
+   is a smooth periodic change of variable (so the exponential convergence of
+   the trapezoidal rule is preserved) that concentrates the nodes around the
+   angles phi_k; the weights carry the extra factor theta'(s).
+*/
+static PetscErrorCode RGComputeQuadratureAdaptive_Ellipse(RG rg,RGQuadRule quad,PetscInt nclust,const PetscScalar *clust,PetscInt n,PetscScalar *z,PetscScalar *zn,PetscScalar *w)
+{
+#if defined(PETSC_USE_COMPLEX)
+  RG_ELLIPSE  *ctx = (RG_ELLIPSE*)rg->data;
+  PetscReal   *phi,s,theta,dtheta,sigma;
+  PetscScalar d;
+  PetscInt    i,k;
+
+  PetscFunctionBegin;
+  if (quad!=RG_QUADRULE_TRAPEZOIDAL) {  /* Chebyshev nodes are fixed */
+    PetscCall(RGComputeQuadrature(rg,quad,n,z,zn,w));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  /* angles of the locations of interest, seen from the center of the ellipse */
+  PetscCall(PetscMalloc1(nclust,&phi));
+  for (k=0;k<nclust;k++) {
+    d = clust[k]/rg->sfactor-ctx->center;
+    phi[k] = PetscAtan2Real(PetscImaginaryPart(d)/ctx->vscale,PetscRealPart(d));
+  }
+  sigma = 0.9/nclust;   /* guarantees theta'(s) >= 0.1 */
+  for (i=0;i<n;i++) {
+    s      = 2.0*PETSC_PI*(i+0.5)/n;
+    theta  = s;
+    dtheta = 1.0;
+    for (k=0;k<nclust;k++) {
+      theta  -= sigma*PetscSinReal(s-phi[k]);
+      dtheta -= sigma*PetscCosReal(s-phi[k]);
+    }
+    zn[i] = PetscCMPLX(PetscCosReal(theta),ctx->vscale*PetscSinReal(theta));
+    z[i]  = rg->sfactor*(ctx->center+ctx->radius*zn[i]);
+    w[i]  = rg->sfactor*ctx->radius*(PetscCMPLX(ctx->vscale*PetscCosReal(theta),PetscSinReal(theta)))*dtheta/n;
+  }
+  PetscCall(PetscFree(phi));
+  PetscFunctionReturn(PETSC_SUCCESS);
+#else
+  PetscFunctionBegin;
+  /* in real scalars the nodes lie on the diameter and are not moved */
+  PetscCall(RGComputeQuadrature(rg,quad,n,z,zn,w));
+  PetscFunctionReturn(PETSC_SUCCESS);
+#endif
+}
+
 static PetscErrorCode RGCheckInside_Ellipse(RG rg,PetscReal px,PetscReal py,PetscInt *inside)
 {
   RG_ELLIPSE *ctx = (RG_ELLIPSE*)rg->data;
@@ -235,6 +285,35 @@ static PetscErrorCode RGCheckInside_Ellipse(RG rg,PetscReal px,PetscReal py,Pets
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Batch version of the above, with the transform of the points to the unit
+   circle precomputed out of the loop, which is branch-free and vectorizable.
+*/
+static PetscErrorCode RGCheckInsideArray_Ellipse(RG rg,PetscInt n,const PetscReal *px,const PetscReal *py,PetscInt *inside)
+{
+  RG_ELLIPSE *ctx = (RG_ELLIPSE*)rg->data;
+  PetscReal  cx,cy,ir,iv2,dx,dy,r;
+  PetscInt   i;
+
+  PetscFunctionBegin;
+#if defined(PETSC_USE_COMPLEX)
+  cx = PetscRealPart(ctx->center);
+  cy = PetscImaginaryPart(ctx->center);
+#else
+  cx = ctx->center;
+  cy = 0.0;
+#endif
+  ir  = 1.0/ctx->radius;
+  iv2 = 1.0/(ctx->vscale*ctx->vscale);
+  for (i=0;i<n;i++) {
+    dx = (px[i]-cx)*ir;
+    dy = (py[i]-cy)*ir;
+    r  = 1.0-dx*dx-dy*dy*iv2;
+    inside[i] = PetscSign(r);
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode RGIsAxisymmetric_Ellipse(RG rg,PetscBool vertical,PetscBool *symm)
 {
   RG_ELLIPSE *ctx = (RG_ELLIPSE*)rg->data;
@@ -288,7 +367,9 @@ SLEPC_EXTERN PetscErrorCode RGCreate_Ellipse(RG rg)
   rg->ops->computecontour    = RGComputeContour_Ellipse;
   rg->ops->computebbox       = RGComputeBoundingBox_Ellipse;
   rg->ops->computequadrature = RGComputeQuadrature_Ellipse;
+  rg->ops->computequadratureadaptive = RGComputeQuadratureAdaptive_Ellipse;
   rg->ops->checkinside       = RGCheckInside_Ellipse;
+  rg->ops->checkinsidearray  = RGCheckInsideArray_Ellipse;
   rg->ops->isaxisymmetric    = RGIsAxisymmetric_Ellipse;
   rg->ops->setfromoptions    = RGSetFromOptions_Ellipse;
   rg->ops->view              = RGView_Ellipse;
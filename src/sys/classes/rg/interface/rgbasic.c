@@ -409,7 +409,7 @@ PetscErrorCode RGIsTrivial(RG rg,PetscBool *trivial)
 @*/
 PetscErrorCode RGCheckInside(RG rg,PetscInt n,PetscScalar *ar,PetscScalar *ai,PetscInt *inside)
 {
-  PetscReal      px,py;
+  PetscReal      px,py,*xa,*ya;
   PetscInt       i;
 
   PetscFunctionBegin;
@@ -421,20 +421,41 @@ PetscErrorCode RGCheckInside(RG rg,PetscInt n,PetscScalar *ar,PetscScalar *ai,Pe
 #endif
   PetscAssertPointer(inside,5);
 
-  for (i=0;i<n;i++) {
+  if (rg->ops->checkinsidearray && n>1) {
+    /* batch evaluation, processing all points in one call */
+    PetscCall(PetscMalloc2(n,&xa,n,&ya));
+    for (i=0;i<n;i++) {
+#if defined(PETSC_USE_COMPLEX)
+      xa[i] = PetscRealPart(ar[i]);
+      ya[i] = PetscImaginaryPart(ar[i]);
+#else
+      xa[i] = ar[i];
+      ya[i] = ai[i];
+#endif
+      if (PetscUnlikely(rg->sfactor != 1.0)) {
+        xa[i] /= rg->sfactor;
+        ya[i] /= rg->sfactor;
+      }
+    }
+    PetscUseTypeMethod(rg,checkinsidearray,n,xa,ya,inside);
+    if (PetscUnlikely(rg->complement)) for (i=0;i<n;i++) inside[i] = -inside[i];
+    PetscCall(PetscFree2(xa,ya));
+  } else {
+    for (i=0;i<n;i++) {
 #if defined(PETSC_USE_COMPLEX)
-    px = PetscRealPart(ar[i]);
-    py = PetscImaginaryPart(ar[i]);
+      px = PetscRealPart(ar[i]);
+      py = PetscImaginaryPart(ar[i]);
 #else
-    px = ar[i];
-    py = ai[i];
+      px = ar[i];
+      py = ai[i];
 #endif
-    if (PetscUnlikely(rg->sfactor != 1.0)) {
-      px /= rg->sfactor;
-      py /= rg->sfactor;
+      if (PetscUnlikely(rg->sfactor != 1.0)) {
+        px /= rg->sfactor;
+        py /= rg->sfactor;
+      }
+      PetscUseTypeMethod(rg,checkinside,px,py,inside+i);
+      if (PetscUnlikely(rg->complement)) inside[i] = -inside[i];
     }
-    PetscUseTypeMethod(rg,checkinside,px,py,inside+i);
-    if (PetscUnlikely(rg->complement)) inside[i] = -inside[i];
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -650,6 +671,61 @@ PetscErrorCode RGComputeQuadrature(RG rg,RGQuadRule quad,PetscInt n,PetscScalar
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   RGComputeQuadratureAdaptive - Computes the values of the parameters used in
+   a quadrature rule for a contour integral, concentrating the quadrature
+   points near given locations of interest.
+
+   Not Collective
+
+   Input Parameters:
++  rg     - the region context
+.  quad   - the type of quadrature
+.  nclust - number of locations around which nodes must be concentrated
+.  clust  - the locations, typically eigenvalue approximations obtained in a
+            previous iteration of the solver
+-  n      - number of quadrature points to compute
+
+   Output Parameters:
++  z  - quadrature points
+.  zn - normalized quadrature points
+-  w  - quadrature weights
+
+   Notes:
+   This is a variant of RGComputeQuadrature() where the distribution of the
+   nodes along the contour is biased towards the sections of the contour
+   closest to the given locations, with the weights adjusted accordingly, so
+   that contour-integral solvers can reach a prescribed accuracy with fewer
+   quadrature nodes when the wanted eigenvalues are clustered.
+
+   Region types that do not implement adaptive placement, or quadrature rules
+   whose nodes are fixed, silently fall back to the standard distribution of
+   RGComputeQuadrature(). Passing nclust=0 is equivalent to calling
+   RGComputeQuadrature().
+
+   Level: advanced
+
+.seealso: RGComputeQuadrature(), RGComputeContour()
+@*/
+PetscErrorCode RGComputeQuadratureAdaptive(RG rg,RGQuadRule quad,PetscInt nclust,PetscScalar clust[],PetscInt n,PetscScalar *z,PetscScalar *zn,PetscScalar *w)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(rg,RG_CLASSID,1);
+  PetscValidType(rg,1);
+  PetscCheck(nclust>=0,PetscObjectComm((PetscObject)rg),PETSC_ERR_ARG_OUTOFRANGE,"Number of locations must be non-negative");
+  if (nclust) PetscAssertPointer(clust,4);
+  PetscAssertPointer(z,6);
+  PetscAssertPointer(zn,7);
+  PetscAssertPointer(w,8);
+
+  if (nclust && rg->ops->computequadratureadaptive) PetscUseTypeMethod(rg,computequadratureadaptive,quad,nclust,clust,n,z,zn,w);
+  else {
+    if (nclust) PetscCall(PetscInfo(rg,"Adaptive node placement not supported, using the standard distribution\n"));
+    PetscCall(RGComputeQuadrature(rg,quad,n,z,zn,w));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    RGSetComplement - Sets a flag to indicate that the region is the complement
    of the specified one.
@@ -14,8 +14,11 @@
 #include <slepc/private/stimpl.h>          /*I "slepcst.h" I*/
 
 typedef struct {
-  PetscScalar nu;
-  PetscBool   nu_set;
+  PetscScalar      nu;
+  PetscBool        nu_set;
+  Mat              Tstash;     /* numerator matrix kept when the antishift changes */
+  PetscScalar      nu_stash;   /* antishift of the stashed numerator */
+  PetscObjectState astash[2];  /* state of the user matrices when the stash was built */
 } ST_CAYLEY;
 
 static PetscErrorCode MatMult_Cayley(Mat B,Vec x,Vec y)
@@ -215,12 +218,33 @@ static PetscErrorCode STSetFromOptions_Cayley(ST st,PetscOptionItems *PetscOptio
 
 static PetscErrorCode STCayleySetAntishift_Cayley(ST st,PetscScalar newshift)
 {
-  ST_CAYLEY *ctx = (ST_CAYLEY*)st->data;
+  ST_CAYLEY        *ctx = (ST_CAYLEY*)st->data;
+  Mat              tmp;
+  PetscInt         i;
+  PetscBool        hit;
+  PetscObjectState astate[2];
 
   PetscFunctionBegin;
   if (ctx->nu != newshift) {
     STCheckNotSeized(st,1);
-    if (st->state && st->matmode!=ST_MATMODE_INPLACE) PetscCall(STMatMAXPY_Private(st,newshift,ctx->nu,0,NULL,PETSC_FALSE,PETSC_FALSE,&st->T[0]));
+    if (st->state==ST_STATE_SETUP && st->matmode==ST_MATMODE_COPY) {
+      /* keep the replaced numerator, so that alternating between two
+         antishifts does not pay the rebuild at every switch */
+      for (i=0;i<PetscMin(st->nmat,2);i++) astate[i] = ((PetscObject)st->A[i])->state;
+      hit = (ctx->Tstash && ctx->nu_stash==newshift)? PETSC_TRUE: PETSC_FALSE;
+      for (i=0;i<PetscMin(st->nmat,2) && hit;i++) if (ctx->astash[i]!=astate[i]) hit = PETSC_FALSE;
+      tmp = st->T[0];
+      if (hit) st->T[0] = ctx->Tstash;
+      else {
+        PetscCall(MatDestroy(&ctx->Tstash));
+        st->T[0] = NULL;
+        PetscCall(STMatMAXPY_Private(st,newshift,0.0,0,NULL,PETSC_FALSE,PETSC_FALSE,&st->T[0]));
+      }
+      ctx->Tstash   = tmp;
+      ctx->nu_stash = ctx->nu;
+      for (i=0;i<PetscMin(st->nmat,2);i++) ctx->astash[i] = astate[i];
+      if (st->M) st->M = st->T[0];
+    } else if (st->state && st->matmode!=ST_MATMODE_INPLACE) PetscCall(STMatMAXPY_Private(st,newshift,ctx->nu,0,NULL,PETSC_FALSE,PETSC_FALSE,&st->T[0]));
     ctx->nu = newshift;
   }
   ctx->nu_set = PETSC_TRUE;
@@ -247,6 +271,10 @@ static PetscErrorCode STCayleySetAntishift_Cayley(ST st,PetscScalar newshift)
    OP = inv(A - sigma B)*(A + nu B). This function sets the value of nu.
    Use STSetShift() for setting sigma. The value nu=-sigma is not allowed.
 
+   With STMatMode set to ST_MATMODE_COPY, the matrix replaced when the
+   antishift changes is kept internally, so alternating between two values
+   of nu does not rebuild the numerator matrix at every switch.
+
 .seealso: STSetShift(), STCayleyGetAntishift()
 @*/
 PetscErrorCode STCayleySetAntishift(ST st,PetscScalar nu)
@@ -307,6 +335,15 @@ static PetscErrorCode STView_Cayley(ST st,PetscViewer viewer)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode STReset_Cayley(ST st)
+{
+  ST_CAYLEY *ctx = (ST_CAYLEY*)st->data;
+
+  PetscFunctionBegin;
+  PetscCall(MatDestroy(&ctx->Tstash));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode STDestroy_Cayley(ST st)
 {
   PetscFunctionBegin;
@@ -327,6 +364,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Cayley(ST st)
   st->usesksp = PETSC_TRUE;
 
   st->ops->apply           = STApply_Generic;
+  st->ops->applymat        = STApplyMat_Generic;
   st->ops->applytrans      = STApplyTranspose_Generic;
   st->ops->applyhermtrans  = STApplyHermitianTranspose_Generic;
   st->ops->backtransform   = STBackTransform_Cayley;
@@ -336,6 +374,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Cayley(ST st)
   st->ops->computeoperator = STComputeOperator_Cayley;
   st->ops->setfromoptions  = STSetFromOptions_Cayley;
   st->ops->postsolve       = STPostSolve_Cayley;
+  st->ops->reset           = STReset_Cayley;
   st->ops->destroy         = STDestroy_Cayley;
   st->ops->view            = STView_Cayley;
   st->ops->checknullspace  = STCheckNullSpace_Default;
@@ -12,8 +12,70 @@
 */
 
 #include <slepc/private/stimpl.h>         /*I "slepcst.h" I*/
+#include <slepcblaslapack.h>
 #include "filter.h"
 
+/*
+   Estimate the numerical range of the matrix by running a few Lanczos steps
+   and bounding the extreme eigenvalues with the Ritz values plus the
+   corresponding residual norms
+*/
+static PetscErrorCode STFilterEstimateRange_Private(ST st)
+{
+  ST_FILTER      *ctx = (ST_FILTER*)st->data;
+  PetscInt       i,k=15;
+  PetscReal      *alpha,*beta,*rwork,nrm,left,right;
+  PetscScalar    *Z,dot;
+  PetscBLASInt   n,info;
+  PetscRandom    rand;
+  Vec            v,w,vold;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc4(k,&alpha,k,&beta,k*k,&Z,2*k,&rwork));
+  PetscCall(MatCreateVecs(st->A[0],&v,&w));
+  PetscCall(VecDuplicate(v,&vold));
+  PetscCall(PetscRandomCreate(PetscObjectComm((PetscObject)st),&rand));
+  PetscCall(VecSetRandom(v,rand));
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(VecNormalize(v,NULL));
+  for (i=0;i<k;i++) {   /* Lanczos iteration without reorthogonalization */
+    PetscCall(MatMult(st->A[0],v,w));
+    if (i) PetscCall(VecAXPY(w,-beta[i-1],vold));
+    PetscCall(VecDot(w,v,&dot));
+    alpha[i] = PetscRealPart(dot);
+    PetscCall(VecAXPY(w,-alpha[i],v));
+    PetscCall(VecNorm(w,NORM_2,&nrm));
+    beta[i] = nrm;
+    if (nrm<10*PETSC_MACHINE_EPSILON*PetscAbsReal(alpha[i])) { k = i+1; break; }  /* breakdown */
+    PetscCall(VecCopy(v,vold));
+    PetscCall(VecCopy(w,v));
+    PetscCall(VecScale(v,1.0/nrm));
+  }
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(VecDestroy(&vold));
+  PetscCall(PetscBLASIntCast(k,&n));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKsteqr",LAPACKsteqr_("I",&n,alpha,beta,Z,&n,rwork,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("steqr",info);
+  /* Ritz values are sorted in ascending order; beta[k-1] holds the residual norm */
+  left  = alpha[0]   - beta[k-1]*PetscAbsScalar(Z[k-1]);
+  right = alpha[k-1] + beta[k-1]*PetscAbsScalar(Z[k*k-1]);
+  /* make sure the requested interval is contained in the estimated range */
+  if (ctx->inta>PETSC_MIN_REAL) left = PetscMin(left,ctx->inta);
+  if (ctx->intb<PETSC_MAX_REAL) right = PetscMax(right,ctx->intb);
+  if (ctx->left != left || ctx->right != right) {
+    ctx->left   = left;
+    ctx->right  = right;
+    ctx->filtch = PETSC_TRUE;   /* rebuild the filter only if the estimate moved */
+  }
+  ctx->estimatedrange = PETSC_TRUE;
+  PetscCall(PetscInfo(st,"Estimated numerical range [%g,%g] with %" PetscInt_FMT " Lanczos steps\n",(double)left,(double)right,k));
+  PetscCall(PetscFree4(alpha,beta,Z,rwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    Operator (filter):
                Op               P         M
@@ -22,13 +84,21 @@
 static PetscErrorCode STComputeOperator_Filter(ST st)
 {
   ST_FILTER      *ctx = (ST_FILTER*)st->data;
+  PetscReal      w1,w2;
 
   PetscFunctionBegin;
   PetscCheck(st->nmat==1,PetscObjectComm((PetscObject)st),PETSC_ERR_SUP,"Only implemented for standard eigenvalue problem");
   PetscCheck(ctx->intb<PETSC_MAX_REAL || ctx->inta>PETSC_MIN_REAL,PetscObjectComm((PetscObject)st),PETSC_ERR_ORDER,"Must pass an interval with STFilterSetInterval()");
-  PetscCheck(ctx->right!=0.0 || ctx->left!=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ORDER,"Must pass an approximate numerical range with STFilterSetRange()");
-  PetscCheck(ctx->left<=ctx->inta && ctx->right>=ctx->intb,PetscObjectComm((PetscObject)st),PETSC_ERR_USER_INPUT,"The requested interval [%g,%g] must be contained in the numerical range [%g,%g]",(double)ctx->inta,(double)ctx->intb,(double)ctx->left,(double)ctx->right);
-  if (!ctx->polyDegree) ctx->polyDegree = 100;
+  if (ctx->right==0.0 && ctx->left==0.0) PetscCall(STFilterEstimateRange_Private(st));
+  else PetscCheck(ctx->left<=ctx->inta && ctx->right>=ctx->intb,PetscObjectComm((PetscObject)st),PETSC_ERR_USER_INPUT,"The requested interval [%g,%g] must be contained in the numerical range [%g,%g]",(double)ctx->inta,(double)ctx->intb,(double)ctx->left,(double)ctx->right);
+  if (!ctx->polyDegree) {
+    /* pick the degree according to the relative width of the wanted interval,
+       since narrower intervals require higher degrees to be resolved */
+    w1 = PetscMax(ctx->inta,ctx->left);
+    w2 = PetscMin(ctx->intb,ctx->right);
+    ctx->polyDegree = PetscMax(100,PetscMin(1000,(PetscInt)(50.0*PetscSqrtReal((ctx->right-ctx->left)/(w2-w1)))));
+    PetscCall(PetscInfo(st,"Using automatically determined polynomial degree %" PetscInt_FMT "\n",ctx->polyDegree));
+  }
   ctx->frame[0] = ctx->left;
   ctx->frame[1] = ctx->inta;
   ctx->frame[2] = ctx->intb;
@@ -174,6 +244,7 @@ static PetscErrorCode STFilterSetRange_Filter(ST st,PetscReal left,PetscReal rig
     st->opready = PETSC_FALSE;
     ctx->filtch = PETSC_TRUE;
   }
+  ctx->estimatedrange = PETSC_FALSE;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -195,6 +266,9 @@ static PetscErrorCode STFilterSetRange_Filter(ST st,PetscReal left,PetscReal rig
    The filter will be most effective if the numerical range is tight, that is, left and right
    are good approximations to the leftmost and rightmost eigenvalues, respectively.
 
+   If this function is not called, the numerical range is estimated automatically
+   during setup by running a few Lanczos iterations on the matrix.
+
    Level: intermediate
 
 .seealso: STFilterGetRange(), STFilterSetInterval()
@@ -277,6 +351,11 @@ static PetscErrorCode STFilterSetDegree_Filter(ST st,PetscInt deg)
    Options Database Key:
 .  -st_filter_degree <deg> - sets the degree of the filter polynomial
 
+   Note:
+   If the degree is not set, or is set to PETSC_DEFAULT, an appropriate value
+   is determined during setup from the relative width of the wanted interval
+   with respect to the numerical range.
+
    Level: intermediate
 
 .seealso: STFilterGetDegree()
@@ -364,6 +443,7 @@ static PetscErrorCode STReset_Filter(ST st)
   PetscFunctionBegin;
   ctx->left  = 0.0;
   ctx->right = 0.0;
+  ctx->estimatedrange = PETSC_FALSE;
   PetscCall(MatDestroy(&ctx->T));
   PetscCall(MatDestroyMatrices(ctx->nW,&ctx->W));
   ctx->nW = 0;
@@ -379,7 +459,7 @@ static PetscErrorCode STView_Filter(ST st,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer,"  interval of desired eigenvalues: [%g,%g]\n",(double)ctx->inta,(double)ctx->intb));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"  numerical range: [%g,%g]\n",(double)ctx->left,(double)ctx->right));
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  numerical range%s: [%g,%g]\n",ctx->estimatedrange?" (estimated)":"",(double)ctx->left,(double)ctx->right));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  degree of filter polynomial: %" PetscInt_FMT "\n",ctx->polyDegree));
     if (st->state>=ST_STATE_SETUP) PetscCall(PetscViewerASCIIPrintf(viewer,"  limit to accept eigenvalues: theta=%g\n",(double)ctx->filterInfo->yLimit));
   }
@@ -447,6 +527,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Filter(ST st)
   ctx->filterInfo         = pfi;
 
   st->ops->apply           = STApply_Generic;
+  st->ops->applymat        = STApplyMat_Generic;
   st->ops->setup           = STSetUp_Filter;
   st->ops->computeoperator = STComputeOperator_Filter;
   st->ops->setfromoptions  = STSetFromOptions_Filter;
@@ -55,6 +55,7 @@ typedef struct {
   PetscInt    baseDegree;          /* left and right degrees of the base filter for each interval */
   FILTLAN_IOP opts;                /* interval options */
   /* internal variables */
+  PetscBool   estimatedrange;      /* the numerical range was estimated instead of given by the user */
   FILTLAN_PFI filterInfo;          /* polynomial filter info */
   PetscReal   frame[4];            /* outer and inner intervals:
                                       [frame[0],frame[3]] (tightly) contains all eigenvalues
@@ -452,6 +452,230 @@ static PetscErrorCode FILTLAN_GetIntervals(PetscReal *intervals,PetscReal *frame
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* ////////////////////////////////////////////////////////////////////////////
+   //    Cache of Computed Filters
+   //////////////////////////////////////////////////////////////////////////// */
+
+/*
+   The optimization performed by FILTLAN_GetIntervals() may take a long time
+   for high polynomial degrees, but its result depends only on a small set of
+   scalar parameters, so computed filters are kept in a linked list that is
+   looked up in subsequent setups with the same parameters, as happens for
+   instance in parameter-sweep runs. Optionally, the cache is made persistent
+   across runs in a file given with the -st_filter_cache_file option (with no
+   value, a default file in the home directory is used).
+*/
+typedef struct _n_FILTLAN_Cache *FILTLAN_Cache;
+struct _n_FILTLAN_Cache {
+  PetscReal             frame[4];      /* key: shifted frame of the filter */
+  PetscInt              polyDeg;       /* key: degree of the polynomial filter */
+  PetscInt              baseDeg;       /* key: degree of the base filter */
+  struct _n_FILTLAN_IOP opts;          /* key: interval options */
+  PetscReal             intervals[6];  /* cached intervals defining the base filter */
+  struct _n_FILTLAN_PFI filterInfo;    /* cached polynomial filter info */
+  FILTLAN_Cache         next;
+};
+
+static FILTLAN_Cache FILTLAN_CacheList = NULL;
+static PetscBool     FILTLAN_CacheInitialized = PETSC_FALSE;
+static char          FILTLAN_CacheFile[PETSC_MAX_PATH_LEN] = "";
+
+/* number of values of each record in the cache file, including a magic number */
+#define FILTLAN_CACHE_NINT  12
+#define FILTLAN_CACHE_NREAL 31
+#define FILTLAN_CACHE_MAGIC 0x46494c54
+
+static PetscErrorCode FILTLAN_CacheDestroy(void)
+{
+  FILTLAN_Cache  cache;
+
+  PetscFunctionBegin;
+  while (FILTLAN_CacheList) {
+    cache = FILTLAN_CacheList;
+    FILTLAN_CacheList = cache->next;
+    PetscCall(PetscFree(cache));
+  }
+  FILTLAN_CacheInitialized = PETSC_FALSE;
+  FILTLAN_CacheFile[0] = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode FILTLAN_CacheSaveEntry(FILTLAN_Cache cache)
+{
+  PetscViewer    viewer;
+  PetscInt       i,iwork[FILTLAN_CACHE_NINT];
+  PetscReal      rwork[FILTLAN_CACHE_NREAL],*r=rwork;
+  FILTLAN_IOP    iop = &cache->opts;
+  FILTLAN_PFI    pfi = &cache->filterInfo;
+
+  PetscFunctionBegin;
+  iwork[0]  = FILTLAN_CACHE_MAGIC;
+  iwork[1]  = cache->polyDeg;
+  iwork[2]  = cache->baseDeg;
+  iwork[3]  = iop->reverseInterval? 1: 0;
+  iwork[4]  = iop->maxInnerIter;
+  iwork[5]  = iop->maxOuterIter;
+  iwork[6]  = pfi->filterType;
+  iwork[7]  = pfi->filterOK;
+  iwork[8]  = pfi->numIter;
+  iwork[9]  = pfi->totalNumIter;
+  iwork[10] = pfi->numLeftSteps;
+  iwork[11] = pfi->numRightSteps;
+  for (i=0;i<4;i++) *r++ = cache->frame[i];
+  for (i=0;i<5;i++) *r++ = iop->intervalWeights[i];
+  *r++ = iop->transIntervalRatio;
+  *r++ = iop->initialPlateau;
+  *r++ = iop->plateauShrinkRate;
+  *r++ = iop->initialShiftStep;
+  *r++ = iop->shiftStepExpanRate;
+  *r++ = iop->yLimitTol;
+  *r++ = iop->yBottomLine;
+  *r++ = iop->yRippleLimit;
+  for (i=0;i<6;i++) *r++ = cache->intervals[i];
+  *r++ = pfi->filterQualityIndex;
+  *r++ = pfi->yLimit;
+  *r++ = pfi->ySummit;
+  *r++ = pfi->yLeftSummit;
+  *r++ = pfi->yLeftBottom;
+  *r++ = pfi->yLimitGap;
+  *r++ = pfi->yRightSummit;
+  *r++ = pfi->yRightBottom;
+  PetscCall(PetscViewerCreate(PETSC_COMM_SELF,&viewer));
+  PetscCall(PetscViewerSetType(viewer,PETSCVIEWERBINARY));
+  PetscCall(PetscViewerBinarySetSkipInfo(viewer,PETSC_TRUE));
+  PetscCall(PetscViewerFileSetMode(viewer,FILE_MODE_APPEND));
+  PetscCall(PetscViewerFileSetName(viewer,FILTLAN_CacheFile));
+  PetscCall(PetscViewerBinaryWrite(viewer,iwork,FILTLAN_CACHE_NINT,PETSC_INT));
+  PetscCall(PetscViewerBinaryWrite(viewer,rwork,FILTLAN_CACHE_NREAL,PETSC_REAL));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode FILTLAN_CacheLoad(void)
+{
+  PetscViewer    viewer;
+  PetscInt       i,n,iwork[FILTLAN_CACHE_NINT],nentries=0;
+  PetscReal      rwork[FILTLAN_CACHE_NREAL],*r;
+  FILTLAN_Cache  cache;
+  FILTLAN_IOP    iop;
+  FILTLAN_PFI    pfi;
+
+  PetscFunctionBegin;
+  PetscCall(PetscViewerBinaryOpen(PETSC_COMM_SELF,FILTLAN_CacheFile,FILE_MODE_READ,&viewer));
+  while (PETSC_TRUE) {
+    PetscCall(PetscViewerBinaryRead(viewer,iwork,FILTLAN_CACHE_NINT,&n,PETSC_INT));
+    if (n<FILTLAN_CACHE_NINT || iwork[0]!=FILTLAN_CACHE_MAGIC) break;
+    PetscCall(PetscViewerBinaryRead(viewer,rwork,FILTLAN_CACHE_NREAL,&n,PETSC_REAL));
+    if (n<FILTLAN_CACHE_NREAL) break;
+    PetscCall(PetscNew(&cache));
+    iop = &cache->opts;
+    pfi = &cache->filterInfo;
+    cache->polyDeg       = iwork[1];
+    cache->baseDeg       = iwork[2];
+    iop->reverseInterval = iwork[3]? PETSC_TRUE: PETSC_FALSE;
+    iop->maxInnerIter    = iwork[4];
+    iop->maxOuterIter    = iwork[5];
+    pfi->filterType      = iwork[6];
+    pfi->filterOK        = iwork[7];
+    pfi->numIter         = iwork[8];
+    pfi->totalNumIter    = iwork[9];
+    pfi->numLeftSteps    = iwork[10];
+    pfi->numRightSteps   = iwork[11];
+    r = rwork;
+    for (i=0;i<4;i++) cache->frame[i] = *r++;
+    for (i=0;i<5;i++) iop->intervalWeights[i] = *r++;
+    iop->transIntervalRatio = *r++;
+    iop->initialPlateau     = *r++;
+    iop->plateauShrinkRate  = *r++;
+    iop->initialShiftStep   = *r++;
+    iop->shiftStepExpanRate = *r++;
+    iop->yLimitTol          = *r++;
+    iop->yBottomLine        = *r++;
+    iop->yRippleLimit       = *r++;
+    for (i=0;i<6;i++) cache->intervals[i] = *r++;
+    pfi->filterQualityIndex = *r++;
+    pfi->yLimit             = *r++;
+    pfi->ySummit            = *r++;
+    pfi->yLeftSummit        = *r++;
+    pfi->yLeftBottom        = *r++;
+    pfi->yLimitGap          = *r++;
+    pfi->yRightSummit       = *r++;
+    pfi->yRightBottom       = *r++;
+    cache->next = FILTLAN_CacheList;
+    FILTLAN_CacheList = cache;
+    nentries++;
+  }
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscCall(PetscInfo(NULL,"Loaded %" PetscInt_FMT " cached filters from %s\n",nentries,FILTLAN_CacheFile));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode FILTLAN_CacheInitialize(void)
+{
+  PetscBool      flg,found;
+
+  PetscFunctionBegin;
+  FILTLAN_CacheInitialized = PETSC_TRUE;
+  PetscCall(PetscRegisterFinalize(FILTLAN_CacheDestroy));
+  PetscCall(PetscOptionsGetString(NULL,NULL,"-st_filter_cache_file",FILTLAN_CacheFile,sizeof(FILTLAN_CacheFile),&flg));
+  if (flg && !FILTLAN_CacheFile[0]) {  /* option given with no value: use default location */
+    char home[PETSC_MAX_PATH_LEN];
+    PetscCall(PetscGetHomeDirectory(home,sizeof(home)));
+    PetscCall(PetscSNPrintf(FILTLAN_CacheFile,sizeof(FILTLAN_CacheFile),"%s/.slepc_filter_cache",home));
+  }
+  if (FILTLAN_CacheFile[0]) {
+    PetscCall(PetscTestFile(FILTLAN_CacheFile,'r',&found));
+    if (found) PetscCall(FILTLAN_CacheLoad());
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Looks up the cache before resorting to FILTLAN_GetIntervals(), and stores
+   the result of newly computed filters. The numGridPoints option is not part
+   of the key because FILTLAN_GetIntervals() normalizes it internally.
+*/
+static PetscErrorCode FILTLAN_GetIntervalsCached(ST st,PetscReal *intervals,PetscReal *frame,PetscInt polyDeg,PetscInt baseDeg,FILTLAN_IOP opts,FILTLAN_PFI filterInfo)
+{
+  FILTLAN_Cache  cache;
+  FILTLAN_IOP    iop;
+  PetscInt       i;
+  PetscBool      match;
+
+  PetscFunctionBegin;
+  if (!FILTLAN_CacheInitialized) PetscCall(FILTLAN_CacheInitialize());
+  for (cache=FILTLAN_CacheList;cache;cache=cache->next) {
+    iop = &cache->opts;
+    match = (cache->polyDeg==polyDeg && cache->baseDeg==baseDeg
+          && iop->reverseInterval==opts->reverseInterval && iop->maxInnerIter==opts->maxInnerIter
+          && iop->maxOuterIter==opts->maxOuterIter && iop->transIntervalRatio==opts->transIntervalRatio
+          && iop->initialPlateau==opts->initialPlateau && iop->plateauShrinkRate==opts->plateauShrinkRate
+          && iop->initialShiftStep==opts->initialShiftStep && iop->shiftStepExpanRate==opts->shiftStepExpanRate
+          && iop->yLimitTol==opts->yLimitTol && iop->yBottomLine==opts->yBottomLine
+          && iop->yRippleLimit==opts->yRippleLimit)? PETSC_TRUE: PETSC_FALSE;
+    for (i=0;i<4 && match;i++) if (cache->frame[i]!=frame[i]) match = PETSC_FALSE;
+    for (i=0;i<5 && match;i++) if (iop->intervalWeights[i]!=opts->intervalWeights[i]) match = PETSC_FALSE;
+    if (match) {
+      PetscCall(PetscArraycpy(intervals,cache->intervals,6));
+      *filterInfo = cache->filterInfo;
+      PetscCall(PetscInfo(st,"Reusing cached filter of degree %" PetscInt_FMT "\n",polyDeg));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
+  PetscCall(FILTLAN_GetIntervals(intervals,frame,polyDeg,baseDeg,opts,filterInfo));
+  PetscCall(PetscNew(&cache));
+  for (i=0;i<4;i++) cache->frame[i] = frame[i];
+  cache->polyDeg = polyDeg;
+  cache->baseDeg = baseDeg;
+  cache->opts = *opts;
+  PetscCall(PetscArraycpy(cache->intervals,intervals,6));
+  cache->filterInfo = *filterInfo;
+  cache->next = FILTLAN_CacheList;
+  FILTLAN_CacheList = cache;
+  if (FILTLAN_CacheFile[0] && PetscGlobalRank==0) PetscCall(FILTLAN_CacheSaveEntry(cache));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /* ////////////////////////////////////////////////////////////////////////////
    //    Chebyshev Polynomials
    //////////////////////////////////////////////////////////////////////////// */
@@ -1046,34 +1270,57 @@ static PetscErrorCode FILTLAN_FilteredConjugateResidualMatrixPolynomialVectorPro
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* maximum number of columns processed together when applying the filter to a matrix */
+#define FILTLAN_PANEL_SIZE 32
+
 /*
    Gateway to FILTLAN for evaluating C=p(A)*B
+
+   The columns of B are processed in panels of at most FILTLAN_PANEL_SIZE
+   vectors, so that the matrix is streamed once per panel during the recurrence
+   and the size of the work matrices is bounded independently of the block width
 */
 static PetscErrorCode MatMatMult_FILTLAN(Mat A,Mat B,Mat C,void *pctx)
 {
   ST             st;
   ST_FILTER      *ctx;
-  PetscInt       i,m1,m2,npoints;
+  Mat            Bp,Cp,Wp[4];
+  PetscInt       i,j,l,n,m2,npoints;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(A,&st));
   ctx = (ST_FILTER*)st->data;
   npoints = (ctx->filterInfo->filterType == 2)? 6: 4;
+  PetscCall(MatGetSize(B,NULL,&n));
+  l = PetscMin(n,FILTLAN_PANEL_SIZE);  /* panel width */
   if (ctx->nW) {  /* check if work matrices must be resized */
-    PetscCall(MatGetSize(B,NULL,&m1));
     PetscCall(MatGetSize(ctx->W[0],NULL,&m2));
-    if (m1!=m2) {
+    if (l!=m2) {
       PetscCall(MatDestroyMatrices(ctx->nW,&ctx->W));
       ctx->nW = 0;
     }
   }
-  if (!ctx->nW) {  /* allocate work matrices */
+  if (!ctx->nW) {  /* allocate work matrices of one panel */
     ctx->nW = 4;
     PetscCall(PetscMalloc1(ctx->nW,&ctx->W));
-    for (i=0;i<ctx->nW;i++) PetscCall(MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&ctx->W[i]));
+    PetscCall(MatDenseGetSubMatrix(B,PETSC_DECIDE,PETSC_DECIDE,0,l,&Bp));
+    for (i=0;i<ctx->nW;i++) PetscCall(MatDuplicate(Bp,MAT_DO_NOT_COPY_VALUES,&ctx->W[i]));
+    PetscCall(MatDenseRestoreSubMatrix(B,&Bp));
+  }
+  for (j=0;j<n;j+=l) {
+    PetscCall(MatDenseGetSubMatrix(B,PETSC_DECIDE,PETSC_DECIDE,j,PetscMin(j+l,n),&Bp));
+    PetscCall(MatDenseGetSubMatrix(C,PETSC_DECIDE,PETSC_DECIDE,j,PetscMin(j+l,n),&Cp));
+    if (n-j<l) {   /* last panel is narrower, use views of the work matrices */
+      for (i=0;i<ctx->nW;i++) PetscCall(MatDenseGetSubMatrix(ctx->W[i],PETSC_DECIDE,PETSC_DECIDE,0,n-j,&Wp[i]));
+    } else for (i=0;i<ctx->nW;i++) Wp[i] = ctx->W[i];
+    PetscCall(FILTLAN_FilteredConjugateResidualMatrixPolynomialVectorProductBlock(ctx->T,Bp,Wp[0],ctx->baseFilter,2*ctx->baseDegree+2,ctx->intervals,npoints-1,ctx->opts->intervalWeights,ctx->polyDegree,st->work,Cp,Wp[1],Wp[2],Wp[3]));
+    PetscCall(MatMatMult(ctx->T,Wp[0],MAT_REUSE_MATRIX,PETSC_DEFAULT,&Cp));
+    if (n-j<l) {
+      for (i=0;i<ctx->nW;i++) PetscCall(MatDenseRestoreSubMatrix(ctx->W[i],&Wp[i]));
+    }
+    PetscCall(MatDenseRestoreSubMatrix(B,&Bp));
+    PetscCall(MatDenseRestoreSubMatrix(C,&Cp));
   }
-  PetscCall(FILTLAN_FilteredConjugateResidualMatrixPolynomialVectorProductBlock(ctx->T,B,ctx->W[0],ctx->baseFilter,2*ctx->baseDegree+2,ctx->intervals,npoints-1,ctx->opts->intervalWeights,ctx->polyDegree,st->work,C,ctx->W[1],ctx->W[2],ctx->W[3]));
-  PetscCall(MatMatMult(ctx->T,ctx->W[0],MAT_REUSE_MATRIX,PETSC_DEFAULT,&C));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1118,7 +1365,7 @@ PetscErrorCode STFilter_FILTLAN_setFilter(ST st,Mat *G)
 
   /* no need to recompute filter if the parameters did not change */
   if (st->state==ST_STATE_INITIAL || ctx->filtch) {
-    PetscCall(FILTLAN_GetIntervals(ctx->intervals,frame2,ctx->polyDegree,ctx->baseDegree,ctx->opts,ctx->filterInfo));
+    PetscCall(FILTLAN_GetIntervalsCached(st,ctx->intervals,frame2,ctx->polyDegree,ctx->baseDegree,ctx->opts,ctx->filterInfo));
     /* translate the intervals back */
     if (ctx->frame[0] == ctx->frame[1]) {  /* low pass filter, convert it to high pass filter */
       for (i=0;i<4;i++) ctx->intervals2[i] = ctx->frame[3] - ctx->intervals[3-i];
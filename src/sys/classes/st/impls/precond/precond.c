@@ -14,7 +14,10 @@
 #include <slepc/private/stimpl.h>          /*I "slepcst.h" I*/
 
 typedef struct {
-  PetscBool ksphasmat;  /* the KSP must have the same matrix as PC */
+  PetscBool   ksphasmat;    /* the KSP must have the same matrix as PC */
+  PetscReal   updatetol;    /* tolerated drift of the shift before rebuilding the preconditioner */
+  PetscScalar sigma_built;  /* shift with which the current preconditioner was built */
+  PetscBool   built;        /* whether a preconditioner has been passed to the KSP */
 } ST_PRECOND;
 
 static PetscErrorCode STSetDefaultKSP_Precond(ST st)
@@ -104,6 +107,8 @@ static PetscErrorCode STSetUp_Precond(ST st)
   PetscFunctionBegin;
   if (st->P) {
     PetscCall(ST_KSPSetOperators(st,ctx->ksphasmat?st->P:NULL,st->P));
+    ctx->sigma_built = st->sigma;
+    ctx->built       = PETSC_TRUE;
     /* NOTE: we do not call KSPSetUp() here because some eigensolvers such as JD require a lazy setup */
   }
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -112,8 +117,19 @@ static PetscErrorCode STSetUp_Precond(ST st)
 static PetscErrorCode STSetShift_Precond(ST st,PetscScalar newshift)
 {
   ST_PRECOND     *ctx = (ST_PRECOND*)st->data;
+  PetscReal      ref;
 
   PetscFunctionBegin;
+  /* with a nonzero update tolerance, keep the preconditioner built with a
+     previous shift as long as the drift is small, so that expensive setups
+     such as a multigrid hierarchy are not repeated at every shift change */
+  if (ctx->updatetol>0.0 && ctx->built) {
+    ref = PetscAbsScalar(ctx->sigma_built);
+    if (PetscAbsScalar(newshift-ctx->sigma_built) <= (ref>0.0? ctx->updatetol*ref: ctx->updatetol)) {
+      PetscCall(PetscInfo(st,"Not rebuilding the preconditioner, shift drift within tolerance\n"));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
   if (st->Psplit) { /* update custom preconditioner from the split matrices */
     if (PetscAbsScalar(st->sigma)<PETSC_MAX_REAL || st->nmat==1) PetscCall(STMatMAXPY_Private(st,-st->sigma,0.0,0,NULL,PETSC_FALSE,PETSC_TRUE,&st->Pmat));
   }
@@ -125,7 +141,120 @@ static PetscErrorCode STSetShift_Precond(ST st,PetscScalar newshift)
       st->P = st->T[1];
     }
   }
-  if (st->P) PetscCall(ST_KSPSetOperators(st,ctx->ksphasmat?st->P:NULL,st->P));
+  if (st->P) {
+    PetscCall(ST_KSPSetOperators(st,ctx->ksphasmat?st->P:NULL,st->P));
+    ctx->sigma_built = newshift;
+    ctx->built       = PETSC_TRUE;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSetFromOptions_Precond(ST st,PetscOptionItems *PetscOptionsObject)
+{
+  PetscReal      tol;
+  PetscBool      flg;
+  ST_PRECOND     *ctx = (ST_PRECOND*)st->data;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"ST Precond Options");
+
+    PetscCall(PetscOptionsReal("-st_precond_update_tol","Tolerated relative drift of the shift before rebuilding the preconditioner","STPrecondSetUpdateTolerance",ctx->updatetol,&tol,&flg));
+    if (flg) PetscCall(STPrecondSetUpdateTolerance(st,tol));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STPrecondSetUpdateTolerance_Precond(ST st,PetscReal tol)
+{
+  ST_PRECOND *ctx = (ST_PRECOND*)st->data;
+
+  PetscFunctionBegin;
+  ctx->updatetol = tol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STPrecondSetUpdateTolerance - Sets the tolerance on the drift of the shift
+   below which the preconditioner is not rebuilt when the shift changes.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  tol - the tolerance
+
+   Options Database Key:
+.  -st_precond_update_tol <tol> - sets the tolerance
+
+   Notes:
+   By default the tolerance is zero and the preconditioner is updated at
+   every change of the shift. With a nonzero value, the preconditioner built
+   with a certain shift is reused while |sigma-sigma_built| does not exceed
+   tol relative to |sigma_built| (or in absolute value if the latter is zero).
+
+   This is intended for preconditioners with an expensive setup, such as a
+   multigrid hierarchy with Galerkin coarse operators, used in solvers that
+   update the shift at every outer iteration (e.g. EPSJD). A slightly
+   outdated preconditioner is usually as effective, and avoids rebuilding
+   the coarse levels each time.
+
+   Level: advanced
+
+.seealso: STPrecondGetUpdateTolerance(), STSetShift()
+@*/
+PetscErrorCode STPrecondSetUpdateTolerance(ST st,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveReal(st,tol,2);
+  PetscCheck(tol>=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Tolerance must be non-negative");
+  PetscTryMethod(st,"STPrecondSetUpdateTolerance_C",(ST,PetscReal),(st,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STPrecondGetUpdateTolerance_Precond(ST st,PetscReal *tol)
+{
+  ST_PRECOND *ctx = (ST_PRECOND*)st->data;
+
+  PetscFunctionBegin;
+  *tol = ctx->updatetol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STPrecondGetUpdateTolerance - Gets the tolerance on the drift of the shift
+   below which the preconditioner is not rebuilt when the shift changes.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  tol - the tolerance
+
+   Level: advanced
+
+.seealso: STPrecondSetUpdateTolerance()
+@*/
+PetscErrorCode STPrecondGetUpdateTolerance(ST st,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(tol,2);
+  PetscUseMethod(st,"STPrecondGetUpdateTolerance_C",(ST,PetscReal*),(st,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STView_Precond(ST st,PetscViewer viewer)
+{
+  PetscBool      isascii;
+  ST_PRECOND     *ctx = (ST_PRECOND*)st->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii && ctx->updatetol>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  updating the preconditioner when the shift drifts more than %g\n",(double)ctx->updatetol));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -211,6 +340,8 @@ static PetscErrorCode STDestroy_Precond(ST st)
   PetscCall(PetscFree(st->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondGetKSPHasMat_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondSetKSPHasMat_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondGetUpdateTolerance_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondSetUpdateTolerance_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -229,6 +360,8 @@ SLEPC_EXTERN PetscErrorCode STCreate_Precond(ST st)
   st->ops->applytrans      = STApplyTranspose_Generic;
   st->ops->applyhermtrans  = STApplyHermitianTranspose_Generic;
   st->ops->setshift        = STSetShift_Precond;
+  st->ops->setfromoptions  = STSetFromOptions_Precond;
+  st->ops->view            = STView_Precond;
   st->ops->getbilinearform = STGetBilinearForm_Default;
   st->ops->setup           = STSetUp_Precond;
   st->ops->computeoperator = STComputeOperator_Precond;
@@ -238,5 +371,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Precond(ST st)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondGetKSPHasMat_C",STPrecondGetKSPHasMat_Precond));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondSetKSPHasMat_C",STPrecondSetKSPHasMat_Precond));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondGetUpdateTolerance_C",STPrecondGetUpdateTolerance_Precond));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STPrecondSetUpdateTolerance_C",STPrecondSetUpdateTolerance_Precond));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
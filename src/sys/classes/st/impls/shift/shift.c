@@ -129,6 +129,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Shift(ST st)
   st->usesksp = PETSC_TRUE;
 
   st->ops->apply           = STApply_Generic;
+  st->ops->applymat        = STApplyMat_Generic;
   st->ops->applytrans      = STApplyTranspose_Generic;
   st->ops->applyhermtrans  = STApplyHermitianTranspose_Generic;
   st->ops->backtransform   = STBackTransform_Shift;
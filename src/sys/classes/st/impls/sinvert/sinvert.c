@@ -13,6 +13,13 @@
 
 #include <slepc/private/stimpl.h>
 
+typedef struct {
+  PetscInt lag;      /* number of consecutive shift updates the factorization is kept */
+  PetscInt lagits;   /* refactor if the last solve with the lagged factorization exceeded this */
+  PetscInt nupdates; /* shift updates since the preconditioner matrix was last factored */
+  Mat      Pbase;    /* matrix the current factorization was computed from */
+} ST_SINVERT;
+
 static PetscErrorCode STBackTransform_Sinvert(ST st,PetscInt n,PetscScalar *eigr,PetscScalar *eigi)
 {
   PetscInt    j;
@@ -78,10 +85,15 @@ static PetscErrorCode STComputeOperator_Sinvert(ST st)
 
 static PetscErrorCode STSetUp_Sinvert(ST st)
 {
+  ST_SINVERT     *ctx = (ST_SINVERT*)st->data;
   PetscInt       k,nc,nmat=st->nmat;
   PetscScalar    *coeffs=NULL;
 
   PetscFunctionBegin;
+  /* discard any lagged factorization from a previous setup */
+  PetscCall(MatDestroy(&ctx->Pbase));
+  ctx->nupdates = 0;
+  if (st->ksp) PetscCall(KSPSetReusePreconditioner(st->ksp,PETSC_FALSE));
   if (nmat>1) PetscCall(STSetWorkVecs(st,1));
   /* if the user did not set the shift, use the target value */
   if (!st->sigma_set) st->sigma = st->defsigma;
@@ -119,11 +131,44 @@ static PetscErrorCode STSetUp_Sinvert(ST st)
 
 static PetscErrorCode STSetShift_Sinvert(ST st,PetscScalar newshift)
 {
-  PetscInt       nmat=PetscMax(st->nmat,2),k,nc;
+  ST_SINVERT     *ctx = (ST_SINVERT*)st->data;
+  PetscInt       nmat=PetscMax(st->nmat,2),k,nc,its;
   PetscScalar    *coeffs=NULL;
+  PetscBool      reuse=PETSC_FALSE,preonly;
 
   PetscFunctionBegin;
   if (st->transform) {
+    /* when a factorization lag has been set, keep the current factorization as
+       a preconditioner and only update the operator matrix, until the number
+       of consecutive shift updates reaches the limit */
+    if (ctx->lag && st->matmode==ST_MATMODE_COPY && !st->Pmat_set && !st->nsplit && st->P) {
+      if (ctx->nupdates<ctx->lag) {
+        /* a solver that just applies the preconditioner would silently use the
+           factorization of the old shift, so in that case refactor instead */
+        PetscCall(PetscObjectTypeCompare((PetscObject)st->ksp,KSPPREONLY,&preonly));
+        reuse = PetscNot(preonly);
+      }
+      if (reuse && ctx->lagits>0 && ctx->nupdates>0) {
+        /* the shift has drifted too far from the factorized one when the last
+           solve needed too many iterations, so give up on the stale factors */
+        PetscCall(KSPGetIterationNumber(st->ksp,&its));
+        if (its>ctx->lagits) reuse = PETSC_FALSE;
+      }
+      if (reuse && !ctx->Pbase) {
+        /* first update: preserve the factored matrix; for polynomial problems
+           the T matrices are updated incrementally in place, so keep a copy */
+        if (st->nmat>2) PetscCall(MatDuplicate(st->P,MAT_COPY_VALUES,&ctx->Pbase));
+        else {
+          ctx->Pbase = st->P;   /* transfer the reference */
+          st->P = NULL;
+          PetscCall(MatDestroy(&st->T[nmat-1]));
+        }
+      } else if (!reuse) {    /* fallback: refactor and restart counting */
+        PetscCall(MatDestroy(&ctx->Pbase));
+        ctx->nupdates = 0;
+        PetscCall(KSPSetReusePreconditioner(st->ksp,PETSC_FALSE));
+      }
+    }
     if (st->matmode == ST_MATMODE_COPY && nmat>2) {
       nc = (nmat*(nmat+1))/2;
       PetscCall(PetscMalloc1(nc,&coeffs));
@@ -142,18 +187,263 @@ static PetscErrorCode STSetShift_Sinvert(ST st,PetscScalar newshift)
     }
   }
   if (st->P) {
-    PetscCall(ST_KSPSetOperators(st,st->P,st->Pmat?st->Pmat:st->P));
+    if (reuse) {
+      ctx->nupdates++;
+      PetscCall(PetscInfo(st,"Reusing the factorization as preconditioner for the new shift (update %" PetscInt_FMT " of %" PetscInt_FMT ")\n",ctx->nupdates,ctx->lag));
+      PetscCall(ST_KSPSetOperators(st,st->P,ctx->Pbase));
+      PetscCall(KSPSetReusePreconditioner(st->ksp,PETSC_TRUE));
+    } else PetscCall(ST_KSPSetOperators(st,st->P,st->Pmat?st->Pmat:st->P));
     PetscCall(KSPSetUp(st->ksp));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode STSetFromOptions_Sinvert(ST st,PetscOptionItems *PetscOptionsObject)
+{
+  PetscInt       lag;
+  PetscBool      flg;
+  ST_SINVERT     *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"ST Shift-and-Invert Options");
+
+    PetscCall(PetscOptionsInt("-st_sinvert_lag_factorization","Number of shift updates the factorization is reused as preconditioner","STSinvertSetLagFactorization",ctx->lag,&lag,&flg));
+    if (flg) PetscCall(STSinvertSetLagFactorization(st,lag));
+
+    PetscCall(PetscOptionsInt("-st_sinvert_lag_max_it","Maximum number of linear iterations before a lagged factorization is discarded","STSinvertSetLagMaxIts",ctx->lagits,&lag,&flg));
+    if (flg) PetscCall(STSinvertSetLagMaxIts(st,lag));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSinvertSetLagFactorization_Sinvert(ST st,PetscInt lag)
+{
+  ST_SINVERT *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  if (lag==PETSC_DEFAULT || lag==PETSC_DECIDE) lag = 0;
+  PetscCheck(lag>=0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of lag. Must be >= 0");
+  if (ctx->lag != lag) {
+    ctx->lag = lag;
+    if (!lag) {
+      PetscCall(MatDestroy(&ctx->Pbase));
+      ctx->nupdates = 0;
+      if (st->ksp) PetscCall(KSPSetReusePreconditioner(st->ksp,PETSC_FALSE));
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSinvertSetLagFactorization - Sets the number of consecutive shift updates
+   for which the shift-and-invert transformation will reuse the factorization
+   computed at a previous shift.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  lag - maximum number of shift updates between factorizations
+
+   Options Database Key:
+.  -st_sinvert_lag_factorization <lag> - Sets the lag value
+
+   Notes:
+   When the shift is updated, by default the matrix A-sigma*B is factored again
+   from scratch. If lag is larger than zero, the factorization of the previous
+   shift is kept and used as a preconditioner for the linear solves with the
+   updated matrix, avoiding up to lag consecutive refactorizations. Computed
+   results are still accurate up to the tolerance of the linear solver, since
+   the updated matrix is used as the actual operator.
+
+   This option requires an iterative linear solver, so it has no effect if the
+   KSP is KSPPREONLY (the default for shift-and-invert), in which case applying
+   the stale factorization would give the solution for the old shift. It is
+   also restricted to STMatMode set to ST_MATMODE_COPY and no user-provided
+   preconditioner matrix.
+
+   A zero value (the default, also with PETSC_DEFAULT) deactivates the lag and
+   recovers the usual behavior of factoring at every shift change. An early
+   refactorization can be forced when the shifts drift apart too quickly, see
+   STSinvertSetLagMaxIts().
+
+   Level: advanced
+
+.seealso: STSetShift(), STSinvertGetLagFactorization(), STSinvertSetLagMaxIts(), STSetMatMode()
+@*/
+PetscErrorCode STSinvertSetLagFactorization(ST st,PetscInt lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,lag,2);
+  PetscTryMethod(st,"STSinvertSetLagFactorization_C",(ST,PetscInt),(st,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSinvertGetLagFactorization_Sinvert(ST st,PetscInt *lag)
+{
+  ST_SINVERT *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  *lag = ctx->lag;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSinvertGetLagFactorization - Gets the number of consecutive shift updates
+   for which the factorization is reused in the shift-and-invert transformation.
+
+   Not Collective
+
+   Input Parameter:
+.  st  - the spectral transformation context
+
+   Output Parameter:
+.  lag - maximum number of shift updates between factorizations
+
+   Level: advanced
+
+.seealso: STSinvertSetLagFactorization()
+@*/
+PetscErrorCode STSinvertGetLagFactorization(ST st,PetscInt *lag)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(lag,2);
+  PetscUseMethod(st,"STSinvertGetLagFactorization_C",(ST,PetscInt*),(st,lag));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSinvertSetLagMaxIts_Sinvert(ST st,PetscInt its)
+{
+  ST_SINVERT *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  if (its==PETSC_DEFAULT || its==PETSC_DECIDE) its = 0;
+  PetscCheck(its>=0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of its. Must be >= 0");
+  ctx->lagits = its;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSinvertSetLagMaxIts - Sets the maximum number of linear iterations allowed
+   in a solve preconditioned with a lagged factorization, before falling back
+   to a fresh factorization at the next shift update.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  its - maximum number of iterations of the linear solver
+
+   Options Database Key:
+.  -st_sinvert_lag_max_it <its> - Sets the iteration bound
+
+   Notes:
+   This option complements STSinvertSetLagFactorization(). As the shift drifts
+   away from the value at which the factorization was computed, the lagged
+   preconditioner degrades and the inner iteration count grows. If the last
+   linear solve took more than its iterations, the matrix is refactored at the
+   next shift update even if the lag count has not been exhausted.
+
+   A zero value (the default, also with PETSC_DEFAULT) disables the bound, so
+   refactorization is governed by the lag count alone.
+
+   Level: advanced
+
+.seealso: STSinvertSetLagFactorization(), STSinvertGetLagMaxIts()
+@*/
+PetscErrorCode STSinvertSetLagMaxIts(ST st,PetscInt its)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,its,2);
+  PetscTryMethod(st,"STSinvertSetLagMaxIts_C",(ST,PetscInt),(st,its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSinvertGetLagMaxIts_Sinvert(ST st,PetscInt *its)
+{
+  ST_SINVERT *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  *its = ctx->lagits;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSinvertGetLagMaxIts - Gets the maximum number of linear iterations allowed
+   before a lagged factorization is discarded.
+
+   Not Collective
+
+   Input Parameter:
+.  st  - the spectral transformation context
+
+   Output Parameter:
+.  its - maximum number of iterations of the linear solver
+
+   Level: advanced
+
+.seealso: STSinvertSetLagMaxIts()
+@*/
+PetscErrorCode STSinvertGetLagMaxIts(ST st,PetscInt *its)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(its,2);
+  PetscUseMethod(st,"STSinvertGetLagMaxIts_C",(ST,PetscInt*),(st,its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STView_Sinvert(ST st,PetscViewer viewer)
+{
+  ST_SINVERT     *ctx = (ST_SINVERT*)st->data;
+  PetscBool      isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii && ctx->lag) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  reusing the factorization for up to %" PetscInt_FMT " shift updates\n",ctx->lag));
+    if (ctx->lagits) PetscCall(PetscViewerASCIIPrintf(viewer,"  refactoring when a lagged solve exceeds %" PetscInt_FMT " iterations\n",ctx->lagits));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STReset_Sinvert(ST st)
+{
+  ST_SINVERT *ctx = (ST_SINVERT*)st->data;
+
+  PetscFunctionBegin;
+  PetscCall(MatDestroy(&ctx->Pbase));
+  ctx->nupdates = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STDestroy_Sinvert(ST st)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscFree(st->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertSetLagFactorization_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertGetLagFactorization_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertSetLagMaxIts_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertGetLagMaxIts_C",NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode STCreate_Sinvert(ST st)
 {
+  ST_SINVERT     *ctx;
+
   PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  st->data = (void*)ctx;
+
   st->usesksp = PETSC_TRUE;
 
   st->ops->apply           = STApply_Generic;
+  st->ops->applymat        = STApplyMat_Generic;
   st->ops->applytrans      = STApplyTranspose_Generic;
   st->ops->applyhermtrans  = STApplyHermitianTranspose_Generic;
   st->ops->backtransform   = STBackTransform_Sinvert;
@@ -161,8 +451,17 @@ SLEPC_EXTERN PetscErrorCode STCreate_Sinvert(ST st)
   st->ops->getbilinearform = STGetBilinearForm_Default;
   st->ops->setup           = STSetUp_Sinvert;
   st->ops->computeoperator = STComputeOperator_Sinvert;
+  st->ops->setfromoptions  = STSetFromOptions_Sinvert;
   st->ops->postsolve       = STPostSolve_Sinvert;
+  st->ops->reset           = STReset_Sinvert;
+  st->ops->destroy         = STDestroy_Sinvert;
+  st->ops->view            = STView_Sinvert;
   st->ops->checknullspace  = STCheckNullSpace_Default;
   st->ops->setdefaultksp   = STSetDefaultKSP_Default;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertSetLagFactorization_C",STSinvertSetLagFactorization_Sinvert));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertGetLagFactorization_C",STSinvertGetLagFactorization_Sinvert));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertSetLagMaxIts_C",STSinvertSetLagMaxIts_Sinvert));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STSinvertGetLagMaxIts_C",STSinvertGetLagMaxIts_Sinvert));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -103,6 +103,9 @@ PetscErrorCode STReset(ST st)
   if (!st) PetscFunctionReturn(PETSC_SUCCESS);
   STCheckNotSeized(st,1);
   PetscTryTypeMethod(st,reset);
+  if (st->cache) PetscCall(STCacheReset_Private(st));
+  st->outertol = 0.0;
+  st->basertol = 0.0;
   if (st->ksp) PetscCall(KSPReset(st->ksp));
   PetscCall(MatDestroyMatrices(PetscMax(2,st->nmat),&st->T));
   PetscCall(MatDestroyMatrices(PetscMax(2,st->nmat),&st->A));
@@ -143,6 +146,7 @@ PetscErrorCode STDestroy(ST *st)
   if (--((PetscObject)(*st))->refct > 0) { *st = NULL; PetscFunctionReturn(PETSC_SUCCESS); }
   PetscCall(STReset(*st));
   PetscTryTypeMethod(*st,destroy);
+  PetscCall(PetscFree((*st)->cache));
   PetscCall(KSPDestroy(&(*st)->ksp));
   PetscCall(PetscHeaderDestroy(st));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -177,6 +181,7 @@ PetscErrorCode STCreate(MPI_Comm comm,ST *newst)
   st->nmat         = 0;
   st->sigma        = 0.0;
   st->defsigma     = 0.0;
+  st->scale        = 1.0;
   st->matmode      = ST_MATMODE_COPY;
   st->str          = UNKNOWN_NONZERO_PATTERN;
   st->transform    = PETSC_FALSE;
@@ -186,6 +191,7 @@ PetscErrorCode STCreate(MPI_Comm comm,ST *newst)
   st->Psplit       = NULL;
   st->nsplit       = 0;
   st->strp         = UNKNOWN_NONZERO_PATTERN;
+  st->adapttol     = PETSC_FALSE;
 
   st->ksp          = NULL;
   st->usesksp      = PETSC_FALSE;
@@ -201,9 +207,18 @@ PetscErrorCode STCreate(MPI_Comm comm,ST *newst)
   st->opready      = PETSC_FALSE;
   st->P            = NULL;
   st->M            = NULL;
+  st->outertol     = 0.0;
+  st->basertol     = 0.0;
   st->sigma_set    = PETSC_FALSE;
   st->asymm        = PETSC_FALSE;
   st->aherm        = PETSC_FALSE;
+  st->cache        = NULL;
+  st->cachecapacity = 0;
+  st->cachesize    = 0;
+  st->cacheage     = 0;
+  st->napply       = 0;
+  st->nmatmult     = 0;
+  st->nmatsolve    = 0;
   st->data         = NULL;
 
   *newst = st;
@@ -650,13 +665,18 @@ PetscErrorCode STGetSplitPreconditionerInfo(ST st,PetscInt *n,MatStructure *strp
 @*/
 PetscErrorCode STSetShift(ST st,PetscScalar shift)
 {
+  PetscBool      found=PETSC_FALSE;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidType(st,1);
   PetscValidLogicalCollectiveScalar(st,shift,2);
   if (st->sigma != shift) {
     STCheckNotSeized(st,1);
-    if (st->state==ST_STATE_SETUP) PetscTryTypeMethod(st,setshift,shift);
+    if (st->state==ST_STATE_SETUP) {
+      if (st->cachecapacity>0) PetscCall(STCacheSwap_Private(st,shift,&found));
+      if (!found) PetscTryTypeMethod(st,setshift,shift);
+    }
     st->sigma = shift;
   }
   st->sigma_set = PETSC_TRUE;
@@ -740,6 +760,76 @@ PetscErrorCode STScaleShift(ST st,PetscScalar factor)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   STSetScale - Sets a scaling factor to be applied to the transformed
+   operator.
+
+   Logically Collective
+
+   Input Parameters:
++  st    - the spectral transformation context
+-  scale - the scaling factor
+
+   Options Database Key:
+.  -st_scale <scale> - sets the scaling factor
+
+   Notes:
+   With a scaling factor gamma, the operator applied by STApply() becomes
+   gamma*OP, e.g. gamma*(A-sigma*B) in the case of the shift transformation.
+   The factor is applied to the result of the operator application and never
+   incorporated into the transformation matrices, so changing it does not
+   trigger any matrix assembly or refactorization. This makes it cheap to
+   tune, for instance when searching for the parameters of spectral folding
+   or of a polynomial filter, where rebuilding the operator for every
+   candidate value would dominate the cost. Computed eigenvalues are
+   divided by gamma before the usual back-transformation, so they always
+   refer to the original problem.
+
+   The factor multiplies the result of STApply(), STApplyTranspose() and the
+   operator obtained with STGetOperator(), but not the matrices returned by
+   STGetMatrix() nor the preconditioner.
+
+   A cheap estimate of the extremal eigenvalues to choose the shift and
+   scaling from can be obtained with MatEstimateSpectralRange().
+
+   Level: advanced
+
+.seealso: STGetScale(), STSetShift(), STApply(), MatEstimateSpectralRange()
+@*/
+PetscErrorCode STSetScale(ST st,PetscReal scale)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveReal(st,scale,2);
+  PetscCheck(scale!=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The scaling factor must be nonzero");
+  st->scale = scale;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetScale - Gets the scaling factor applied to the transformed operator.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  scale - the scaling factor
+
+   Level: advanced
+
+.seealso: STSetScale()
+@*/
+PetscErrorCode STGetScale(ST st,PetscReal *scale)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(scale,2);
+  *scale = st->scale;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STSetBalanceMatrix - Sets the diagonal matrix to be used for balancing.
 
@@ -1036,6 +1126,7 @@ PetscErrorCode STView(ST st,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPopTab(viewer));
     PetscCall(SlepcSNPrintfScalar(str,sizeof(str),st->sigma,PETSC_FALSE));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  shift: %s\n",str));
+    if (st->scale!=1.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  scaling factor: %g\n",(double)st->scale));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  number of matrices: %" PetscInt_FMT "\n",st->nmat));
     switch (st->matmode) {
     case ST_MATMODE_COPY:
@@ -1050,6 +1141,8 @@ PetscErrorCode STView(ST st,PetscViewer viewer)
     if (st->nmat>1 && st->matmode != ST_MATMODE_SHELL) PetscCall(PetscViewerASCIIPrintf(viewer,"  nonzero pattern of the matrices: %s\n",MatStructures[st->str]));
     if (st->Psplit) PetscCall(PetscViewerASCIIPrintf(viewer,"  using split preconditioner matrices with %s\n",MatStructures[st->strp]));
     if (st->transform && st->nmat>2) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing transformed matrices\n"));
+    if (st->cachecapacity>0) PetscCall(PetscViewerASCIIPrintf(viewer,"  caching up to %" PetscInt_FMT " factored operators\n",st->cachecapacity));
+    if (st->adapttol) PetscCall(PetscViewerASCIIPrintf(viewer,"  adapting the tolerance of the linear solves to the outer residual\n"));
   } else if (isstring) {
     PetscCall(STGetType(st,&cstr));
     PetscCall(PetscViewerStringSPrintf(viewer," %-7.7s",cstr));
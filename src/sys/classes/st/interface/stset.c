@@ -111,8 +111,10 @@ PetscErrorCode STGetType(ST st,STType *type)
 PetscErrorCode STSetFromOptions(ST st)
 {
   PetscScalar    s;
+  PetscReal      r;
   char           type[256];
   PetscBool      flg,bval;
+  PetscInt       i;
   STMatMode      mode;
   MatStructure   mstr;
 
@@ -127,6 +129,9 @@ PetscErrorCode STSetFromOptions(ST st)
     PetscCall(PetscOptionsScalar("-st_shift","Value of the shift","STSetShift",st->sigma,&s,&flg));
     if (flg) PetscCall(STSetShift(st,s));
 
+    PetscCall(PetscOptionsReal("-st_scale","Scaling factor applied to the operator","STSetScale",st->scale,&r,&flg));
+    if (flg) PetscCall(STSetScale(st,r));
+
     PetscCall(PetscOptionsEnum("-st_matmode","Matrix mode for transformed matrices","STSetMatMode",STMatModes,(PetscEnum)st->matmode,(PetscEnum*)&mode,&flg));
     if (flg) PetscCall(STSetMatMode(st,mode));
 
@@ -136,6 +141,12 @@ PetscErrorCode STSetFromOptions(ST st)
     PetscCall(PetscOptionsBool("-st_transform","Whether transformed matrices are computed or not","STSetTransform",st->transform,&bval,&flg));
     if (flg) PetscCall(STSetTransform(st,bval));
 
+    PetscCall(PetscOptionsInt("-st_cache_capacity","Capacity of the cache of factored operators","STCacheSetCapacity",st->cachecapacity,&i,&flg));
+    if (flg) PetscCall(STCacheSetCapacity(st,i));
+
+    PetscCall(PetscOptionsBool("-st_adaptive_tolerance","Whether to adapt the tolerance of the linear solves to the outer residual","STSetAdaptiveTolerance",st->adapttol,&bval,&flg));
+    if (flg) PetscCall(STSetAdaptiveTolerance(st,bval));
+
     PetscTryTypeMethod(st,setfromoptions,PetscOptionsObject);
     PetscCall(PetscObjectProcessOptionsHandlers((PetscObject)st,PetscOptionsObject));
   PetscOptionsEnd();
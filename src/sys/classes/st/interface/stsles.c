@@ -74,7 +74,7 @@ PetscErrorCode STSetDefaultKSP_Default(ST st)
 
    Level: developer
 
-.seealso: STMatMultTranspose(), STMatMultHermitianTranspose()
+.seealso: STMatMultAdd(), STMatMultTranspose(), STMatMultHermitianTranspose()
 @*/
 PetscErrorCode STMatMult(ST st,PetscInt k,Vec x,Vec y)
 {
@@ -90,6 +90,7 @@ PetscErrorCode STMatMult(ST st,PetscInt k,Vec x,Vec y)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(x));
+  st->nmatmult++;
   PetscCall(PetscLogEventBegin(ST_MatMult,st,x,y,0));
   if (!st->T[k]) PetscCall(VecCopy(x,y)); /* T[k]=NULL means identity matrix */
   else PetscCall(MatMult(st->T[k],x,y));
@@ -98,6 +99,54 @@ PetscErrorCode STMatMult(ST st,PetscInt k,Vec x,Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   STMatMultAdd - Computes the matrix-vector product plus addition y = T[k] x + z,
+   where T[k] is the k-th matrix of the spectral transformation.
+
+   Neighbor-wise Collective
+
+   Input Parameters:
++  st - the spectral transformation context
+.  k  - index of matrix to use
+.  x  - the vector to be multiplied
+-  z  - the vector to be added
+
+   Output Parameter:
+.  y - the result
+
+   Note:
+   The vectors z and y can be the same.
+
+   Level: developer
+
+.seealso: STMatMult(), STMatMultTranspose()
+@*/
+PetscErrorCode STMatMultAdd(ST st,PetscInt k,Vec x,Vec z,Vec y)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,k,2);
+  PetscValidHeaderSpecific(x,VEC_CLASSID,3);
+  PetscValidHeaderSpecific(z,VEC_CLASSID,4);
+  PetscValidHeaderSpecific(y,VEC_CLASSID,5);
+  STCheckMatrices(st,1);
+  PetscCheck(k>=0 && k<PetscMax(2,st->nmat),PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"k must be between 0 and %" PetscInt_FMT,st->nmat);
+  PetscCheck(x!=y,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_IDN,"x and y must be different vectors");
+  PetscCall(VecSetErrorIfLocked(y,5));
+
+  if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
+  PetscCall(VecLockReadPush(x));
+  st->nmatmult++;
+  PetscCall(PetscLogEventBegin(ST_MatMult,st,x,y,0));
+  if (!st->T[k]) { /* T[k]=NULL means identity matrix */
+    if (y!=z) PetscCall(VecCopy(z,y));
+    PetscCall(VecAXPY(y,1.0,x));
+  } else PetscCall(MatMultAdd(st->T[k],x,z,y));
+  PetscCall(PetscLogEventEnd(ST_MatMult,st,x,y,0));
+  PetscCall(VecLockReadPop(x));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STMatMultTranspose - Computes the matrix-vector product y = T[k]^T x, where T[k] is
    the k-th matrix of the spectral transformation.
@@ -130,6 +179,7 @@ PetscErrorCode STMatMultTranspose(ST st,PetscInt k,Vec x,Vec y)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(x));
+  st->nmatmult++;
   PetscCall(PetscLogEventBegin(ST_MatMultTranspose,st,x,y,0));
   if (!st->T[k]) PetscCall(VecCopy(x,y)); /* T[k]=NULL means identity matrix */
   else PetscCall(MatMultTranspose(st->T[k],x,y));
@@ -170,6 +220,7 @@ PetscErrorCode STMatMultHermitianTranspose(ST st,PetscInt k,Vec x,Vec y)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(x));
+  st->nmatmult++;
   PetscCall(PetscLogEventBegin(ST_MatMultTranspose,st,x,y,0));
   if (!st->T[k]) PetscCall(VecCopy(x,y)); /* T[k]=NULL means identity matrix */
   else PetscCall(MatMultHermitianTranspose(st->T[k],x,y));
@@ -178,6 +229,23 @@ PetscErrorCode STMatMultHermitianTranspose(ST st,PetscInt k,Vec x,Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Adjust the relative tolerance of the linear solver according to the current
+   residual estimate of the outer iteration, as in inexact inverse iteration
+*/
+static PetscErrorCode STAdaptKSPTolerance_Private(ST st)
+{
+  PetscReal      rtol,abstol,dtol;
+  PetscInt       maxits;
+
+  PetscFunctionBegin;
+  PetscCall(KSPGetTolerances(st->ksp,&rtol,&abstol,&dtol,&maxits));
+  if (!st->basertol) st->basertol = rtol;  /* remember the configured tolerance */
+  rtol = PetscMin(0.1,PetscMax(st->basertol,0.1*st->outertol));
+  PetscCall(KSPSetTolerances(st->ksp,rtol,abstol,dtol,maxits));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STMatSolve - Solves P x = b, where P is the preconditioner matrix of
    the spectral transformation, using a KSP object stored internally.
@@ -207,9 +275,13 @@ PetscErrorCode STMatSolve(ST st,Vec b,Vec x)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(b));
+  st->nmatsolve++;
   PetscCall(PetscLogEventBegin(ST_MatSolve,st,b,x,0));
   if (!st->P) PetscCall(VecCopy(b,x)); /* P=NULL means identity matrix */
-  else PetscCall(KSPSolve(st->ksp,b,x));
+  else {
+    if (st->adapttol && st->outertol>0.0) PetscCall(STAdaptKSPTolerance_Private(st));
+    PetscCall(KSPSolve(st->ksp,b,x));
+  }
   PetscCall(PetscLogEventEnd(ST_MatSolve,st,b,x,0));
   PetscCall(VecLockReadPop(b));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -234,6 +306,8 @@ PetscErrorCode STMatSolve(ST st,Vec b,Vec x)
 @*/
 PetscErrorCode STMatMatSolve(ST st,Mat B,Mat X)
 {
+  PetscInt       m;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidHeaderSpecific(B,MAT_CLASSID,2);
@@ -241,9 +315,14 @@ PetscErrorCode STMatMatSolve(ST st,Mat B,Mat X)
   STCheckMatrices(st,1);
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
+  PetscCall(MatGetSize(B,NULL,&m));
+  st->nmatsolve += m;
   PetscCall(PetscLogEventBegin(ST_MatSolve,st,B,X,0));
   if (!st->P) PetscCall(MatCopy(B,X,SAME_NONZERO_PATTERN)); /* P=NULL means identity matrix */
-  else PetscCall(KSPMatSolve(st->ksp,B,X));
+  else {
+    if (st->adapttol && st->outertol>0.0) PetscCall(STAdaptKSPTolerance_Private(st));
+    PetscCall(KSPMatSolve(st->ksp,B,X));
+  }
   PetscCall(PetscLogEventEnd(ST_MatSolve,st,B,X,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -277,9 +356,13 @@ PetscErrorCode STMatSolveTranspose(ST st,Vec b,Vec x)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(b));
+  st->nmatsolve++;
   PetscCall(PetscLogEventBegin(ST_MatSolveTranspose,st,b,x,0));
   if (!st->P) PetscCall(VecCopy(b,x)); /* P=NULL means identity matrix */
-  else PetscCall(KSPSolveTranspose(st->ksp,b,x));
+  else {
+    if (st->adapttol && st->outertol>0.0) PetscCall(STAdaptKSPTolerance_Private(st));
+    PetscCall(KSPSolveTranspose(st->ksp,b,x));
+  }
   PetscCall(PetscLogEventEnd(ST_MatSolveTranspose,st,b,x,0));
   PetscCall(VecLockReadPop(b));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -316,9 +399,11 @@ PetscErrorCode STMatSolveHermitianTranspose(ST st,Vec b,Vec x)
 
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(VecLockReadPush(b));
+  st->nmatsolve++;
   PetscCall(PetscLogEventBegin(ST_MatSolveTranspose,st,b,x,0));
   if (!st->P) PetscCall(VecCopy(b,x)); /* P=NULL means identity matrix */
   else {
+    if (st->adapttol && st->outertol>0.0) PetscCall(STAdaptKSPTolerance_Private(st));
     PetscCall(VecDuplicate(b,&w));
     PetscCall(VecCopy(b,w));
     PetscCall(VecConjugate(w));
@@ -350,6 +435,281 @@ PetscErrorCode STCheckFactorPackage(ST st)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   STCacheReset_Private - Discards all the entries stored in the cache of
+   factored operators.
+*/
+PetscErrorCode STCacheReset_Private(ST st)
+{
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  for (i=0;i<st->cachesize;i++) {
+    PetscCall(MatDestroy(&st->cache[i].P));
+    PetscCall(PCDestroy(&st->cache[i].pc));
+  }
+  st->cachesize = 0;
+  st->cacheage  = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   STCacheSwap_Private - Stores the factorization of the current shift in the
+   cache of factored operators and, if the new shift has a valid cache entry,
+   reinstalls the stored preconditioner in the KSP so that the factorization
+   need not be recomputed. On a cache miss, a fresh PC is attached to the KSP
+   and the operator matrix is detached from the ST, so that the upcoming
+   factorization does not overwrite the cached objects.
+*/
+PetscErrorCode STCacheSwap_Private(ST st,PetscScalar newshift,PetscBool *found)
+{
+  PC               pc,newpc;
+  PCType           pctype;
+  MatSolverType    stype;
+  PetscObjectState astate[2];
+  const char       *prefix;
+  PetscBool        sinvert;
+  PetscInt         i,j,oldest;
+  STCacheEntry     *entry;
+
+  PetscFunctionBegin;
+  *found = PETSC_FALSE;
+  /* the cache requires the factored matrix to be built as a separate copy,
+     currently only in shift-and-invert for linear problems */
+  PetscCall(PetscObjectTypeCompare((PetscObject)st,STSINVERT,&sinvert));
+  if (!sinvert || !st->transform || st->matmode!=ST_MATMODE_COPY || st->nmat>2 || st->Pmat_set || st->nsplit || !st->P) PetscFunctionReturn(PETSC_SUCCESS);
+  astate[0] = ((PetscObject)st->A[0])->state;
+  astate[1] = st->nmat>1? ((PetscObject)st->A[1])->state: 0;
+  /* store the active factorization, evicting the least recently used entry
+     if no free slot is left */
+  if (st->cachesize<st->cachecapacity) entry = st->cache+st->cachesize++;
+  else {
+    oldest = 0;
+    for (i=1;i<st->cachesize;i++) if (st->cache[i].age<st->cache[oldest].age) oldest = i;
+    entry = st->cache+oldest;
+    PetscCall(MatDestroy(&entry->P));
+    PetscCall(PCDestroy(&entry->pc));
+  }
+  PetscCall(KSPGetPC(st->ksp,&pc));
+  PetscCall(PetscObjectReference((PetscObject)pc));
+  PetscCall(PetscObjectReference((PetscObject)st->P));
+  entry->sigma     = st->sigma;
+  entry->astate[0] = astate[0];
+  entry->astate[1] = astate[1];
+  entry->P         = st->P;
+  entry->pc        = pc;
+  entry->age       = ++st->cacheage;
+  /* look up the new shift, checking that the matrices have not changed since
+     the entry was stored */
+  for (i=0;i<st->cachesize;i++) {
+    if (st->cache+i!=entry && st->cache[i].sigma==newshift && st->cache[i].astate[0]==astate[0] && st->cache[i].astate[1]==astate[1]) break;
+  }
+  if (i<st->cachesize) {
+    /* hit: reinstall the cached preconditioner and operator matrix, the
+       references are transferred from the cache entry, which is removed */
+    PetscCall(PetscInfo(st,"Reusing cached factorization for shift %g\n",(double)PetscRealPart(newshift)));
+    PetscCall(KSPSetPC(st->ksp,st->cache[i].pc));
+    PetscCall(PCDestroy(&st->cache[i].pc));
+    PetscCall(MatDestroy(&st->P));
+    st->P = st->cache[i].P;
+    PetscCall(MatDestroy(&st->T[1]));
+    PetscCall(PetscObjectReference((PetscObject)st->P));
+    st->T[1] = st->P;
+    for (j=i;j<st->cachesize-1;j++) st->cache[j] = st->cache[j+1];
+    st->cachesize--;
+    PetscCall(ST_KSPSetOperators(st,st->P,st->P));
+    PetscCall(KSPSetUp(st->ksp));  /* no factorization is done, the operator is unchanged */
+    *found = PETSC_TRUE;
+  } else {
+    /* miss: the stored matrix and preconditioner now belong to the cache,
+       attach fresh ones to be filled by the caller */
+    PetscCall(MatDestroy(&st->P));
+    PetscCall(MatDestroy(&st->T[1]));
+    PetscCall(PCGetType(pc,&pctype));
+    PetscCall(PCFactorGetMatSolverType(pc,&stype));
+    PetscCall(PCCreate(PetscObjectComm((PetscObject)st),&newpc));
+    PetscCall(PetscObjectIncrementTabLevel((PetscObject)newpc,(PetscObject)st,1));
+    PetscCall(PCGetOptionsPrefix(pc,&prefix));
+    PetscCall(PCSetOptionsPrefix(newpc,prefix));
+    PetscCall(PetscObjectSetOptions((PetscObject)newpc,((PetscObject)st)->options));
+    if (pctype) PetscCall(PCSetType(newpc,pctype));
+    if (stype) PetscCall(PCFactorSetMatSolverType(newpc,stype));
+    PetscCall(PCSetFromOptions(newpc));
+    PetscCall(KSPSetPC(st->ksp,newpc));
+    PetscCall(PCDestroy(&newpc));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STCacheSetCapacity - Sets the maximum number of factored operators that are
+   kept in an internal cache, to be reused when a previously visited shift is
+   set again.
+
+   Logically Collective
+
+   Input Parameters:
++  st       - the spectral transformation context
+-  capacity - the maximum number of cached factorizations
+
+   Options Database Key:
+.  -st_cache_capacity <capacity> - sets the capacity of the cache
+
+   Notes:
+   By default the capacity is zero and the cache is disabled. When the cache
+   is enabled, every time the shift changes the current factorization is
+   stored in the cache before computing the new one, and if the new shift was
+   visited before then the stored factorization is reinstalled in the linear
+   solver instead of refactoring the matrix. This is intended for shift sweeps
+   that revisit a small set of values, such as parameter continuation studies,
+   where each revisit would otherwise pay a full factorization.
+
+   The cache is used only in shift-and-invert with ST_MATMODE_COPY for linear
+   eigenproblems, and is bypassed when a preconditioner matrix has been set
+   with STSetPreconditionerMat() or STSetSplitPreconditioner(). Entries become
+   stale when the problem matrices change, in which case they are not reused.
+
+   Note that each cached factorization keeps its memory allocated, so the
+   capacity should be set according to the available resources.
+
+   Pass capacity=0 to disable the cache and discard the stored factorizations.
+
+   Level: advanced
+
+.seealso: STCacheGetCapacity(), STSetShift(), STSetMatMode()
+@*/
+PetscErrorCode STCacheSetCapacity(ST st,PetscInt capacity)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,capacity,2);
+  if (capacity==PETSC_DECIDE || capacity==PETSC_DEFAULT) capacity = 0;
+  PetscCheck(capacity>=0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The capacity must be >= 0");
+  if (st->cachecapacity!=capacity) {
+    if (st->cache) PetscCall(STCacheReset_Private(st));
+    PetscCall(PetscFree(st->cache));
+    if (capacity>0) PetscCall(PetscCalloc1(capacity,&st->cache));
+    st->cachecapacity = capacity;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STCacheGetCapacity - Returns the capacity of the cache of factored
+   operators.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  capacity - the maximum number of cached factorizations
+
+   Level: advanced
+
+.seealso: STCacheSetCapacity()
+@*/
+PetscErrorCode STCacheGetCapacity(ST st,PetscInt *capacity)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(capacity,2);
+  *capacity = st->cachecapacity;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSetAdaptiveTolerance - Sets a flag to indicate that the tolerance of the
+   linear solves must be adapted to the residual estimate of the outer
+   eigensolver iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  adapt - the boolean flag
+
+   Options Database Key:
+.  -st_adaptive_tolerance <bool> - Activate/deactivate the adaptation of the tolerance
+
+   Notes:
+   This flag is relevant only when the linear systems are solved with an
+   iterative method. Following the theory of inexact inverse iteration, the
+   relative tolerance of the inner solves is set proportional to the current
+   residual estimate of the outer iteration, provided by the eigensolver via
+   STSetOuterTolerance(), so early outer iterations use loose inner solves.
+   The tolerance is never set looser than 0.1 nor tighter than the value
+   configured in the KSP, which is restored at the end of the computation.
+
+   Level: advanced
+
+.seealso: STSetOuterTolerance(), STGetAdaptiveTolerance(), STGetKSP()
+@*/
+PetscErrorCode STSetAdaptiveTolerance(ST st,PetscBool adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveBool(st,adapt,2);
+  st->adapttol = adapt;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetAdaptiveTolerance - Gets the flag that indicates whether the tolerance
+   of the linear solves is adapted to the residual of the outer iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  adapt - the flag
+
+   Level: advanced
+
+.seealso: STSetAdaptiveTolerance()
+@*/
+PetscErrorCode STGetAdaptiveTolerance(ST st,PetscBool *adapt)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(adapt,2);
+  *adapt = st->adapttol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSetOuterTolerance - Informs the spectral transformation about the current
+   residual estimate of the outer eigensolver iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  tol - the residual estimate, or 0.0 if not available
+
+   Note:
+   This function is called by the eigensolvers at every outer iteration, so
+   normal users should not need to call it. The value is used to relax the
+   tolerance of the inner linear solves when the adaptive tolerance has been
+   activated with STSetAdaptiveTolerance().
+
+   Level: developer
+
+.seealso: STSetAdaptiveTolerance()
+@*/
+PetscErrorCode STSetOuterTolerance(ST st,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveReal(st,tol,2);
+  PetscCheck(tol>=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be >= 0");
+  st->outertol = tol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STSetKSP - Sets the KSP object associated with the spectral
    transformation.
@@ -38,6 +38,15 @@ PetscErrorCode STApply_Generic(ST st,Vec x,Vec y)
    Output Parameter:
 .  y - output vector
 
+   Developer Note:
+   A split STApplyBegin()/STApplyEnd() interface to overlap the halo exchange
+   of the underlying MatMult() with the orthogonalization of the previous
+   Krylov vector is not provided on purpose: the input of step j+1 is produced
+   by the orthogonalization and normalization of step j, so its halo values do
+   not exist before that computation finishes. The overlap that is possible,
+   hiding the scatter behind the local part of the product, already happens
+   inside the parallel MatMult() implementations.
+
    Level: developer
 
 .seealso: STApplyTranspose(), STApplyHermitianTranspose()
@@ -87,12 +96,19 @@ PetscErrorCode STApplyMat_Generic(ST st,Mat B,Mat C)
    Output Parameter:
 .  Y - output matrix
 
+   Note:
+   The linear solves, if any, are done with KSPMatSolve(), so all columns are
+   processed in a single call and solvers with efficient support for multiple
+   right-hand sides (such as MUMPS) can exploit it.
+
    Level: developer
 
-.seealso: STApply()
+.seealso: STApply(), STMatMatSolve()
 @*/
 PetscErrorCode STApplyMat(ST st,Mat X,Mat Y)
 {
+  PetscInt       m;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidHeaderSpecific(X,MAT_CLASSID,2);
@@ -100,7 +116,10 @@ PetscErrorCode STApplyMat(ST st,Mat X,Mat Y)
   PetscValidType(st,1);
   STCheckMatrices(st,1);
   PetscCheck(X!=Y,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_IDN,"X and Y must be different matrices");
+  PetscCall(MatGetSize(X,NULL,&m));
+  st->napply += m;
   PetscUseTypeMethod(st,applymat,X,Y);
+  if (st->scale!=1.0) PetscCall(MatScale(Y,st->scale));  /* deferred scaling, see STSetScale() */
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -199,6 +218,65 @@ PetscErrorCode STApplyHermitianTranspose(ST st,Vec x,Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   STGetOperationCounters - Gets the total number of operator applications,
+   matrix-vector products and linear solves performed by this ST object.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  applys    - number of applications of the transformed operator
+.  matmults  - number of matrix-vector products with the transformation matrices
+-  matsolves - number of linear solves with the preconditioner matrix
+
+   Notes:
+   Any output parameter may be NULL if not needed.
+
+   Operator applications are counted at STApply() and also when the operator
+   obtained with STGetOperator() is applied, either to a vector or, column by
+   column, to a matrix. The counters accumulate across solves until
+   STResetOperationCounters() is called.
+
+   Level: intermediate
+
+.seealso: STResetOperationCounters(), EPSGetOperationCounts()
+@*/
+PetscErrorCode STGetOperationCounters(ST st,PetscInt *applys,PetscInt *matmults,PetscInt *matsolves)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  if (applys) *applys = st->napply;
+  if (matmults) *matmults = st->nmatmult;
+  if (matsolves) *matsolves = st->nmatsolve;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STResetOperationCounters - Sets the counters of operator applications,
+   matrix-vector products and linear solves to zero.
+
+   Logically Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Level: intermediate
+
+.seealso: STGetOperationCounters()
+@*/
+PetscErrorCode STResetOperationCounters(ST st)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  st->napply    = 0;
+  st->nmatmult  = 0;
+  st->nmatsolve = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STGetBilinearForm - Returns the matrix used in the bilinear form with a
    generalized problem with semi-definite B.
@@ -248,12 +326,14 @@ static PetscErrorCode MatMult_STOperator(Mat Op,Vec x,Vec y)
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(Op,&st));
   PetscCall(STSetUp(st));
+  st->napply++;
   PetscCall(PetscLogEventBegin(ST_Apply,st,x,y,0));
   if (st->D) { /* with balancing */
     PetscCall(VecPointwiseDivide(st->wb,x,st->D));
     PetscUseTypeMethod(st,apply,st->wb,y);
     PetscCall(VecPointwiseMult(y,y,st->D));
   } else PetscUseTypeMethod(st,apply,x,y);
+  if (st->scale!=1.0) PetscCall(VecScale(y,st->scale));  /* deferred scaling, see STSetScale() */
   PetscCall(PetscLogEventEnd(ST_Apply,st,x,y,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -265,12 +345,14 @@ static PetscErrorCode MatMultTranspose_STOperator(Mat Op,Vec x,Vec y)
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(Op,&st));
   PetscCall(STSetUp(st));
+  st->napply++;
   PetscCall(PetscLogEventBegin(ST_ApplyTranspose,st,x,y,0));
   if (st->D) { /* with balancing */
     PetscCall(VecPointwiseMult(st->wb,x,st->D));
     PetscUseTypeMethod(st,applytrans,st->wb,y);
     PetscCall(VecPointwiseDivide(y,y,st->D));
   } else PetscUseTypeMethod(st,applytrans,x,y);
+  if (st->scale!=1.0) PetscCall(VecScale(y,st->scale));  /* deferred scaling, see STSetScale() */
   PetscCall(PetscLogEventEnd(ST_ApplyTranspose,st,x,y,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -283,6 +365,7 @@ static PetscErrorCode MatMultHermitianTranspose_STOperator(Mat Op,Vec x,Vec y)
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(Op,&st));
   PetscCall(STSetUp(st));
+  st->napply++;
   PetscCall(PetscLogEventBegin(ST_ApplyHermitianTranspose,st,x,y,0));
   if (st->ops->applyhermtrans) {
     if (st->D) { /* with balancing */
@@ -303,6 +386,7 @@ static PetscErrorCode MatMultHermitianTranspose_STOperator(Mat Op,Vec x,Vec y)
     } else PetscUseTypeMethod(st,applytrans,st->wht,y);
     PetscCall(VecConjugate(y));
   }
+  if (st->scale!=1.0) PetscCall(VecScale(y,st->scale));  /* deferred scaling, see STSetScale() */
   PetscCall(PetscLogEventEnd(ST_ApplyHermitianTranspose,st,x,y,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -311,12 +395,16 @@ static PetscErrorCode MatMultHermitianTranspose_STOperator(Mat Op,Vec x,Vec y)
 static PetscErrorCode MatMatMult_STOperator(Mat Op,Mat B,Mat C,void *ctx)
 {
   ST             st;
+  PetscInt       m;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(Op,&st));
   PetscCall(STSetUp(st));
+  PetscCall(MatGetSize(B,NULL,&m));
+  st->napply += m;
   PetscCall(PetscLogEventBegin(ST_Apply,st,B,C,0));
   PetscCall(STApplyMat_Generic(st,B,C));
+  if (st->scale!=1.0) PetscCall(MatScale(C,st->scale));  /* deferred scaling, see STSetScale() */
   PetscCall(PetscLogEventEnd(ST_Apply,st,B,C,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -673,6 +761,12 @@ PetscErrorCode STPostSolve(ST st)
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidType(st,1);
   PetscTryTypeMethod(st,postsolve);
+  if (st->adapttol && st->basertol>0.0) {
+    /* restore the tolerance configured in the KSP before any adaptation */
+    PetscCall(KSPSetTolerances(st->ksp,st->basertol,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT));
+    st->basertol = 0.0;
+    st->outertol = 0.0;
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -695,9 +789,18 @@ PetscErrorCode STPostSolve(ST st)
 @*/
 PetscErrorCode STBackTransform(ST st,PetscInt n,PetscScalar* eigr,PetscScalar* eigi)
 {
+  PetscInt       i;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidType(st,1);
+  if (st->scale!=1.0) {
+    /* undo the deferred scaling of the operator before the usual back-transformation */
+    for (i=0;i<n;i++) {
+      eigr[i] /= st->scale;
+      if (eigi) eigi[i] /= st->scale;
+    }
+  }
   PetscTryTypeMethod(st,backtransform,n,eigr,eigi);
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -0,0 +1,109 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the cache of factored operators with a revisited shift sequence.\n\n";
+
+#include <slepcst.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A,mat[1];
+  ST             st,stref;
+  Vec            v,w,wref;
+  PetscScalar    sigmas[] = { 0.1, 0.5, 2.2, 0.1, 0.5, 2.2, 0.1 };
+  PetscReal      norm,error;
+  PetscInt       n=10,i,k,Istart,Iend,nshifts=PETSC_STATIC_ARRAY_LENGTH(sigmas);
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian, n=%" PetscInt_FMT ", %" PetscInt_FMT " shift updates\n\n",n,nshifts));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compute the operator matrix for the 1-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatCreateVecs(A,&v,&w));
+  PetscCall(VecDuplicate(w,&wref));
+  PetscCall(VecSet(v,1.0));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        One ST with the cache enabled and an identical one without it
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  mat[0] = A;
+  PetscCall(STCreate(PETSC_COMM_WORLD,&st));
+  PetscCall(STSetMatrices(st,1,mat));
+  PetscCall(STSetType(st,STSINVERT));
+  PetscCall(STCacheSetCapacity(st,2));
+  PetscCall(STSetFromOptions(st));
+  PetscCall(STSetUp(st));
+
+  PetscCall(STCreate(PETSC_COMM_WORLD,&stref));
+  PetscCall(STSetMatrices(stref,1,mat));
+  PetscCall(STSetType(stref,STSINVERT));
+  PetscCall(STSetFromOptions(stref));
+  PetscCall(STCacheSetCapacity(stref,0));
+  PetscCall(STSetUp(stref));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Revisit the shifts; with capacity 2 and 3 distinct shifts the
+        sequence produces hits, misses and evictions
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (k=0;k<nshifts;k++) {
+    PetscCall(STSetShift(st,sigmas[k]));
+    PetscCall(STApply(st,v,w));
+    PetscCall(STSetShift(stref,sigmas[k]));
+    PetscCall(STApply(stref,v,wref));
+    PetscCall(VecNorm(wref,NORM_2,&norm));
+    PetscCall(VecAXPY(wref,-1.0,w));
+    PetscCall(VecNorm(wref,NORM_2,&error));
+    if (error/norm>1e-8) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Cached solve at shift %g differs from the uncached one: %g\n",(double)PetscRealPart(sigmas[k]),(double)(error/norm)));
+  }
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Cached and uncached solves match\n"));
+
+  PetscCall(STDestroy(&st));
+  PetscCall(STDestroy(&stref));
+  PetscCall(MatDestroy(&A));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(VecDestroy(&wref));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test10_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 2
+         nsize: 2
+         args: -st_pc_type redundant
+
+TEST*/
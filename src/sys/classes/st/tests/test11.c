@@ -0,0 +1,127 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test lagging the factorization in STSINVERT across shift updates.\n\n";
+
+#include <slepcst.h>
+
+/*
+   Creates a shift-and-invert ST for A with an iterative solver, so that a
+   lagged factorization can act as preconditioner for the updated operator
+*/
+PetscErrorCode CreateSinvert(Mat A,ST *st)
+{
+  Mat            mat[1];
+  KSP            ksp;
+
+  PetscFunctionBeginUser;
+  mat[0] = A;
+  PetscCall(STCreate(PETSC_COMM_WORLD,st));
+  PetscCall(STSetMatrices(*st,1,mat));
+  PetscCall(STSetType(*st,STSINVERT));
+  PetscCall(STGetKSP(*st,&ksp));
+  PetscCall(KSPSetType(ksp,KSPGMRES));
+  PetscCall(KSPSetTolerances(ksp,1e-12,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT));
+  PetscCall(STSetFromOptions(*st));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  ST             st,stref;
+  Vec            v,w,wref;
+  PetscScalar    sigma;
+  PetscReal      norm,error;
+  PetscInt       n=10,i,k,Istart,Iend,nupdates=7;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian, n=%" PetscInt_FMT ", %" PetscInt_FMT " shift updates\n\n",n,nupdates));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compute the operator matrix for the 1-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatSetUp(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatCreateVecs(A,&v,&w));
+  PetscCall(VecDuplicate(w,&wref));
+  PetscCall(VecSet(v,1.0));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        One ST with lagging enabled (-st_sinvert_lag_factorization is
+        set in the test harness) and an identical one without it
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(CreateSinvert(A,&st));
+  PetscCall(STSetUp(st));
+  PetscCall(CreateSinvert(A,&stref));
+  PetscCall(STSinvertSetLagFactorization(stref,0));
+  PetscCall(STSetUp(stref));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Drift the shift in small steps, so the lagged factorization
+        remains a good preconditioner for the updated operator
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (k=0;k<nupdates;k++) {
+    sigma = 0.5+0.01*k;
+    PetscCall(STSetShift(st,sigma));
+    PetscCall(STApply(st,v,w));
+    PetscCall(STSetShift(stref,sigma));
+    PetscCall(STApply(stref,v,wref));
+    PetscCall(VecNorm(wref,NORM_2,&norm));
+    PetscCall(VecAXPY(wref,-1.0,w));
+    PetscCall(VecNorm(wref,NORM_2,&error));
+    if (error/norm>1e-8) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Lagged solve at shift %g differs from the non-lagged one: %g\n",(double)PetscRealPart(sigma),(double)(error/norm)));
+  }
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Lagged and non-lagged solves match\n"));
+
+  PetscCall(STDestroy(&st));
+  PetscCall(STDestroy(&stref));
+  PetscCall(MatDestroy(&A));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(VecDestroy(&wref));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      args: -st_sinvert_lag_factorization 3
+      requires: !single
+      output_file: output/test11_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 1_maxits
+         args: -st_sinvert_lag_max_it 5
+      test:
+         suffix: 2
+         nsize: 2
+         args: -st_pc_type redundant
+
+TEST*/
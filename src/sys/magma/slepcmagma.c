@@ -11,7 +11,10 @@
 #include <slepc/private/slepcimpl.h>
 #include <slepcmagma.h>
 
-static PetscBool SlepcBeganMagma = PETSC_FALSE;
+static PetscBool SlepcBeganMagma     = PETSC_FALSE;
+static PetscInt  SlepcMagmaCrossover = 2000;       /* size at which the hybrid kernels are preferred */
+static void      *SlepcMagmaWork     = NULL;       /* pinned host workspace reused across calls */
+static size_t    SlepcMagmaWorkSize  = 0;
 
 static void slepc_magma_finalize(void PETSC_UNUSED *unused, magma_int_t *ierr)
 {
@@ -20,9 +23,38 @@ static void slepc_magma_finalize(void PETSC_UNUSED *unused, magma_int_t *ierr)
   return;
 }
 
+static void slepc_magma_malloc_pinned(void **ptr, size_t size, magma_int_t *ierr)
+{
+  *ierr = magma_malloc_pinned(ptr, size);
+  return;
+}
+
+static void slepc_magma_free_pinned(void *ptr, magma_int_t *ierr)
+{
+  *ierr = magma_free_pinned(ptr);
+  return;
+}
+
+static void slepc_magma_malloc(void **ptr, size_t size, magma_int_t *ierr)
+{
+  *ierr = magma_malloc(ptr, size);
+  return;
+}
+
+static void slepc_magma_free(void *ptr, magma_int_t *ierr)
+{
+  *ierr = magma_free(ptr);
+  return;
+}
+
 static PetscErrorCode SlepcMagmaFinalize(void)
 {
   PetscFunctionBegin;
+  if (SlepcMagmaWork) {
+    PetscCallMAGMA(slepc_magma_free_pinned, SlepcMagmaWork);
+    SlepcMagmaWork     = NULL;
+    SlepcMagmaWorkSize = 0;
+  }
   SlepcBeganMagma = PETSC_FALSE;
   PetscCallMAGMA(slepc_magma_finalize, NULL);
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -45,3 +77,67 @@ PetscErrorCode SlepcMagmaInit(void)
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   SlepcMagmaSetCrossoverFromOptions - Sets the problem size at which the dense
+   solvers switch automatically to the hybrid CPU+GPU kernels, from the option
+   -slepc_magma_crossover. Called during SlepcInitialize().
+*/
+PetscErrorCode SlepcMagmaSetCrossoverFromOptions(void)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-slepc_magma_crossover",&SlepcMagmaCrossover,NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SlepcMagmaGetCrossover - Returns the crossover size stored at SlepcInitialize()
+   time. Does not require MAGMA to be initialized.
+*/
+PetscErrorCode SlepcMagmaGetCrossover(PetscInt *crossover)
+{
+  PetscFunctionBegin;
+  PetscAssertPointer(crossover,1);
+  *crossover = SlepcMagmaCrossover;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SlepcMagmaGetWorkspace - Returns a pinned host buffer of at least the given
+   size in bytes. The buffer is owned by SLEPc and reused across calls, so the
+   caller must not free it nor assume its contents are preserved between calls.
+*/
+PetscErrorCode SlepcMagmaGetWorkspace(size_t bytes,void **buf)
+{
+  PetscFunctionBegin;
+  PetscAssertPointer(buf,2);
+  if (bytes > SlepcMagmaWorkSize) {
+    if (SlepcMagmaWork) PetscCallMAGMA(slepc_magma_free_pinned, SlepcMagmaWork);
+    PetscCallMAGMA(slepc_magma_malloc_pinned, &SlepcMagmaWork, bytes);
+    SlepcMagmaWorkSize = bytes;
+  }
+  *buf = SlepcMagmaWork;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SlepcMagmaMalloc - Allocates memory on the GPU, wrapping magma_malloc()
+   with the usual error checking.
+*/
+PetscErrorCode SlepcMagmaMalloc(size_t bytes,void **ptr)
+{
+  PetscFunctionBegin;
+  PetscAssertPointer(ptr,2);
+  PetscCallMAGMA(slepc_magma_malloc, ptr, bytes);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SlepcMagmaFree - Frees memory allocated with SlepcMagmaMalloc().
+*/
+PetscErrorCode SlepcMagmaFree(void *ptr)
+{
+  PetscFunctionBegin;
+  if (ptr) PetscCallMAGMA(slepc_magma_free, ptr);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
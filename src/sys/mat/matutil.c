@@ -9,10 +9,11 @@
 */
 
 #include <slepc/private/slepcimpl.h>            /*I "slepcsys.h" I*/
+#include <slepcblaslapack.h>
 
-static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,Mat G)
+static PetscErrorCode MatTileUpdateValues_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,PetscBool pattern,Mat G)
 {
-  PetscInt          i,j,M1,M2,N1,N2,*nnz,ncols,*scols,bs;
+  PetscInt          i,j,M1,M2,N1,N2,ncols,*scols;
   PetscScalar       *svals,*buf;
   const PetscInt    *cols;
   const PetscScalar *vals;
@@ -20,11 +21,80 @@ static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,
   PetscFunctionBegin;
   PetscCall(MatGetSize(A,&M1,&N1));
   PetscCall(MatGetSize(D,&M2,&N2));
+  PetscCall(PetscMalloc2(PetscMax(N1,N2),&buf,PetscMax(N1,N2),&scols));
+  if (pattern) PetscCall(PetscArrayzero(buf,PetscMax(N1,N2)));  /* insert explicit zeros */
+  /* Transfer A */
+  if (a!=0.0 || pattern) {
+    for (i=0;i<M1;i++) {
+      PetscCall(MatGetRow(A,i,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (a!=1.0) {
+        svals=buf;
+        for (j=0;j<ncols;j++) svals[j] = vals[j]*a;
+      } else svals=(PetscScalar*)vals;
+      PetscCall(MatSetValues(G,1,&i,ncols,cols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(A,i,&ncols,&cols,&vals));
+    }
+  }
+  /* Transfer B */
+  if (b!=0.0 || pattern) {
+    for (i=0;i<M1;i++) {
+      PetscCall(MatGetRow(B,i,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (b!=1.0) {
+        svals=buf;
+        for (j=0;j<ncols;j++) svals[j] = vals[j]*b;
+      } else svals=(PetscScalar*)vals;
+      for (j=0;j<ncols;j++) scols[j] = cols[j]+N1;
+      PetscCall(MatSetValues(G,1,&i,ncols,scols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(B,i,&ncols,&cols,&vals));
+    }
+  }
+  /* Transfer C */
+  if (c!=0.0 || pattern) {
+    for (i=0;i<M2;i++) {
+      PetscCall(MatGetRow(C,i,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (c!=1.0) {
+        svals=buf;
+        for (j=0;j<ncols;j++) svals[j] = vals[j]*c;
+      } else svals=(PetscScalar*)vals;
+      j = i+M1;
+      PetscCall(MatSetValues(G,1,&j,ncols,cols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(C,i,&ncols,&cols,&vals));
+    }
+  }
+  /* Transfer D */
+  if (d!=0.0 || pattern) {
+    for (i=0;i<M2;i++) {
+      PetscCall(MatGetRow(D,i,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (d!=1.0) {
+        svals=buf;
+        for (j=0;j<ncols;j++) svals[j] = vals[j]*d;
+      } else svals=(PetscScalar*)vals;
+      for (j=0;j<ncols;j++) scols[j] = cols[j]+N1;
+      j = i+M1;
+      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(D,i,&ncols,&cols,&vals));
+    }
+  }
+  PetscCall(PetscFree2(buf,scols));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,PetscBool pattern,Mat G)
+{
+  PetscInt       i,M1,M2,*nnz,ncols,bs;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(A,&M1,NULL));
+  PetscCall(MatGetSize(D,&M2,NULL));
   PetscCall(MatGetBlockSize(A,&bs));
 
   PetscCall(PetscCalloc1((M1+M2)/bs,&nnz));
   /* Preallocate for A */
-  if (a!=0.0) {
+  if (a!=0.0 || pattern) {
     for (i=0;i<(M1+bs-1)/bs;i++) {
       PetscCall(MatGetRow(A,i*bs,&ncols,NULL,NULL));
       nnz[i] += ncols/bs;
@@ -32,7 +102,7 @@ static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for B */
-  if (b!=0.0) {
+  if (b!=0.0 || pattern) {
     for (i=0;i<(M1+bs-1)/bs;i++) {
       PetscCall(MatGetRow(B,i*bs,&ncols,NULL,NULL));
       nnz[i] += ncols/bs;
@@ -40,7 +110,7 @@ static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for C */
-  if (c!=0.0) {
+  if (c!=0.0 || pattern) {
     for (i=0;i<(M2+bs-1)/bs;i++) {
       PetscCall(MatGetRow(C,i*bs,&ncols,NULL,NULL));
       nnz[i+M1/bs] += ncols/bs;
@@ -48,7 +118,7 @@ static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for D */
-  if (d!=0.0) {
+  if (d!=0.0 || pattern) {
     for (i=0;i<(M2+bs-1)/bs;i++) {
       PetscCall(MatGetRow(D,i*bs,&ncols,NULL,NULL));
       nnz[i+M1/bs] += ncols/bs;
@@ -58,71 +128,112 @@ static PetscErrorCode MatCreateTile_Seq(PetscScalar a,Mat A,PetscScalar b,Mat B,
   PetscCall(MatXAIJSetPreallocation(G,bs,nnz,NULL,NULL,NULL));
   PetscCall(PetscFree(nnz));
 
-  PetscCall(PetscMalloc2(PetscMax(N1,N2),&buf,PetscMax(N1,N2),&scols));
+  PetscCall(MatTileUpdateValues_Seq(a,A,b,B,c,C,d,D,pattern,G));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatTileUpdateValues_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,PetscBool pattern,Mat G)
+{
+  PetscMPIInt       np;
+  PetscInt          p,i,j,N1,N2,m1,m2,*map1,*map2;
+  PetscInt          ncols,*scols,start,gstart;
+  PetscScalar       *svals,*buf;
+  const PetscInt    *cols,*mapptr1,*mapptr2;
+  const PetscScalar *vals;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(A,NULL,&N1));
+  PetscCall(MatGetLocalSize(A,&m1,NULL));
+  PetscCall(MatGetSize(D,NULL,&N2));
+  PetscCall(MatGetLocalSize(D,&m2,NULL));
+
+  /* Create mappings */
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)G),&np));
+  PetscCall(MatGetOwnershipRangesColumn(A,&mapptr1));
+  PetscCall(MatGetOwnershipRangesColumn(B,&mapptr2));
+  PetscCall(PetscMalloc4(PetscMax(N1,N2),&buf,PetscMax(N1,N2),&scols,N1,&map1,N2,&map2));
+  for (p=0;p<np;p++) {
+    for (i=mapptr1[p];i<mapptr1[p+1];i++) map1[i] = i+mapptr2[p];
+  }
+  for (p=0;p<np;p++) {
+    for (i=mapptr2[p];i<mapptr2[p+1];i++) map2[i] = i+mapptr1[p+1];
+  }
+  PetscCall(MatGetOwnershipRange(G,&gstart,NULL));
+  if (pattern) PetscCall(PetscArrayzero(buf,PetscMax(N1,N2)));  /* insert explicit zeros */
   /* Transfer A */
-  if (a!=0.0) {
-    for (i=0;i<M1;i++) {
-      PetscCall(MatGetRow(A,i,&ncols,&cols,&vals));
-      if (a!=1.0) {
+  if (a!=0.0 || pattern) {
+    PetscCall(MatGetOwnershipRange(A,&start,NULL));
+    for (i=0;i<m1;i++) {
+      PetscCall(MatGetRow(A,i+start,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (a!=1.0) {
         svals=buf;
         for (j=0;j<ncols;j++) svals[j] = vals[j]*a;
       } else svals=(PetscScalar*)vals;
-      PetscCall(MatSetValues(G,1,&i,ncols,cols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(A,i,&ncols,&cols,&vals));
+      for (j=0;j<ncols;j++) scols[j] = map1[cols[j]];
+      j = gstart+i;
+      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(A,i+start,&ncols,&cols,&vals));
     }
   }
   /* Transfer B */
-  if (b!=0.0) {
-    for (i=0;i<M1;i++) {
-      PetscCall(MatGetRow(B,i,&ncols,&cols,&vals));
-      if (b!=1.0) {
+  if (b!=0.0 || pattern) {
+    PetscCall(MatGetOwnershipRange(B,&start,NULL));
+    for (i=0;i<m1;i++) {
+      PetscCall(MatGetRow(B,i+start,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (b!=1.0) {
         svals=buf;
         for (j=0;j<ncols;j++) svals[j] = vals[j]*b;
       } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = cols[j]+N1;
-      PetscCall(MatSetValues(G,1,&i,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(B,i,&ncols,&cols,&vals));
+      for (j=0;j<ncols;j++) scols[j] = map2[cols[j]];
+      j = gstart+i;
+      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(B,i+start,&ncols,&cols,&vals));
     }
   }
   /* Transfer C */
-  if (c!=0.0) {
-    for (i=0;i<M2;i++) {
-      PetscCall(MatGetRow(C,i,&ncols,&cols,&vals));
-      if (c!=1.0) {
+  if (c!=0.0 || pattern) {
+    PetscCall(MatGetOwnershipRange(C,&start,NULL));
+    for (i=0;i<m2;i++) {
+      PetscCall(MatGetRow(C,i+start,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (c!=1.0) {
         svals=buf;
         for (j=0;j<ncols;j++) svals[j] = vals[j]*c;
       } else svals=(PetscScalar*)vals;
-      j = i+M1;
-      PetscCall(MatSetValues(G,1,&j,ncols,cols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(C,i,&ncols,&cols,&vals));
+      for (j=0;j<ncols;j++) scols[j] = map1[cols[j]];
+      j = gstart+m1+i;
+      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
+      PetscCall(MatRestoreRow(C,i+start,&ncols,&cols,&vals));
     }
   }
   /* Transfer D */
-  if (d!=0.0) {
-    for (i=0;i<M2;i++) {
-      PetscCall(MatGetRow(D,i,&ncols,&cols,&vals));
-      if (d!=1.0) {
+  if (d!=0.0 || pattern) {
+    PetscCall(MatGetOwnershipRange(D,&start,NULL));
+    for (i=0;i<m2;i++) {
+      PetscCall(MatGetRow(D,i+start,&ncols,&cols,&vals));
+      if (pattern) svals=buf;
+      else if (d!=1.0) {
         svals=buf;
         for (j=0;j<ncols;j++) svals[j] = vals[j]*d;
       } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = cols[j]+N1;
-      j = i+M1;
+      for (j=0;j<ncols;j++) scols[j] = map2[cols[j]];
+      j = gstart+m1+i;
       PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(D,i,&ncols,&cols,&vals));
+      PetscCall(MatRestoreRow(D,i+start,&ncols,&cols,&vals));
     }
   }
-  PetscCall(PetscFree2(buf,scols));
+  PetscCall(PetscFree4(buf,scols,map1,map2));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,Mat G)
+static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,PetscBool pattern,Mat G)
 {
   PetscMPIInt       np;
   PetscInt          p,i,j,N1,N2,m1,m2,n1,n2,*map1,*map2;
   PetscInt          *dnz,*onz,ncols,*scols,start,gstart;
-  PetscScalar       *svals,*buf;
   const PetscInt    *cols,*mapptr1,*mapptr2;
-  const PetscScalar *vals;
 
   PetscFunctionBegin;
   PetscCall(MatGetSize(A,NULL,&N1));
@@ -134,7 +245,7 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
   PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)G),&np));
   PetscCall(MatGetOwnershipRangesColumn(A,&mapptr1));
   PetscCall(MatGetOwnershipRangesColumn(B,&mapptr2));
-  PetscCall(PetscMalloc4(PetscMax(N1,N2),&buf,PetscMax(N1,N2),&scols,N1,&map1,N2,&map2));
+  PetscCall(PetscMalloc3(PetscMax(N1,N2),&scols,N1,&map1,N2,&map2));
   for (p=0;p<np;p++) {
     for (i=mapptr1[p];i<mapptr1[p+1];i++) map1[i] = i+mapptr2[p];
   }
@@ -145,7 +256,7 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
   MatPreallocateBegin(PetscObjectComm((PetscObject)G),m1+m2,n1+n2,dnz,onz);
   PetscCall(MatGetOwnershipRange(G,&gstart,NULL));
   /* Preallocate for A */
-  if (a!=0.0) {
+  if (a!=0.0 || pattern) {
     PetscCall(MatGetOwnershipRange(A,&start,NULL));
     for (i=0;i<m1;i++) {
       PetscCall(MatGetRow(A,i+start,&ncols,&cols,NULL));
@@ -155,7 +266,7 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for B */
-  if (b!=0.0) {
+  if (b!=0.0 || pattern) {
     PetscCall(MatGetOwnershipRange(B,&start,NULL));
     for (i=0;i<m1;i++) {
       PetscCall(MatGetRow(B,i+start,&ncols,&cols,NULL));
@@ -165,7 +276,7 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for C */
-  if (c!=0.0) {
+  if (c!=0.0 || pattern) {
     PetscCall(MatGetOwnershipRange(C,&start,NULL));
     for (i=0;i<m2;i++) {
       PetscCall(MatGetRow(C,i+start,&ncols,&cols,NULL));
@@ -175,7 +286,7 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
     }
   }
   /* Preallocate for D */
-  if (d!=0.0) {
+  if (d!=0.0 || pattern) {
     PetscCall(MatGetOwnershipRange(D,&start,NULL));
     for (i=0;i<m2;i++) {
       PetscCall(MatGetRow(D,i+start,&ncols,&cols,NULL));
@@ -186,68 +297,82 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
   }
   PetscCall(MatMPIAIJSetPreallocation(G,0,dnz,0,onz));
   MatPreallocateEnd(dnz,onz);
+  PetscCall(PetscFree3(scols,map1,map2));
 
-  /* Transfer A */
-  if (a!=0.0) {
-    PetscCall(MatGetOwnershipRange(A,&start,NULL));
-    for (i=0;i<m1;i++) {
-      PetscCall(MatGetRow(A,i+start,&ncols,&cols,&vals));
-      if (a!=1.0) {
-        svals=buf;
-        for (j=0;j<ncols;j++) svals[j] = vals[j]*a;
-      } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = map1[cols[j]];
-      j = gstart+i;
-      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(A,i+start,&ncols,&cols,&vals));
-    }
-  }
-  /* Transfer B */
-  if (b!=0.0) {
-    PetscCall(MatGetOwnershipRange(B,&start,NULL));
-    for (i=0;i<m1;i++) {
-      PetscCall(MatGetRow(B,i+start,&ncols,&cols,&vals));
-      if (b!=1.0) {
-        svals=buf;
-        for (j=0;j<ncols;j++) svals[j] = vals[j]*b;
-      } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = map2[cols[j]];
-      j = gstart+i;
-      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(B,i+start,&ncols,&cols,&vals));
-    }
-  }
-  /* Transfer C */
-  if (c!=0.0) {
-    PetscCall(MatGetOwnershipRange(C,&start,NULL));
-    for (i=0;i<m2;i++) {
-      PetscCall(MatGetRow(C,i+start,&ncols,&cols,&vals));
-      if (c!=1.0) {
-        svals=buf;
-        for (j=0;j<ncols;j++) svals[j] = vals[j]*c;
-      } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = map1[cols[j]];
-      j = gstart+m1+i;
-      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(C,i+start,&ncols,&cols,&vals));
-    }
-  }
-  /* Transfer D */
-  if (d!=0.0) {
-    PetscCall(MatGetOwnershipRange(D,&start,NULL));
-    for (i=0;i<m2;i++) {
-      PetscCall(MatGetRow(D,i+start,&ncols,&cols,&vals));
-      if (d!=1.0) {
-        svals=buf;
-        for (j=0;j<ncols;j++) svals[j] = vals[j]*d;
-      } else svals=(PetscScalar*)vals;
-      for (j=0;j<ncols;j++) scols[j] = map2[cols[j]];
-      j = gstart+m1+i;
-      PetscCall(MatSetValues(G,1,&j,ncols,scols,svals,INSERT_VALUES));
-      PetscCall(MatRestoreRow(D,i+start,&ncols,&cols,&vals));
-    }
+  PetscCall(MatTileUpdateValues_MPI(a,A,b,B,c,C,d,D,pattern,G));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Checks that the dimensions of the four blocks are compatible and returns
+   the global and local sizes of the two block rows and columns
+*/
+static PetscErrorCode MatCreateTile_CheckSizes(Mat A,Mat B,Mat C,Mat D,PetscInt *M1,PetscInt *M2,PetscInt *N1,PetscInt *N2,PetscInt *m1,PetscInt *m2,PetscInt *n1,PetscInt *n2)
+{
+  PetscInt       M,N,m,n;
+
+  PetscFunctionBegin;
+  /* check row 1 */
+  PetscCall(MatGetSize(A,M1,NULL));
+  PetscCall(MatGetLocalSize(A,m1,NULL));
+  PetscCall(MatGetSize(B,&M,NULL));
+  PetscCall(MatGetLocalSize(B,&m,NULL));
+  PetscCheck(M==*M1 && m==*m1,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
+  /* check row 2 */
+  PetscCall(MatGetSize(C,M2,NULL));
+  PetscCall(MatGetLocalSize(C,m2,NULL));
+  PetscCall(MatGetSize(D,&M,NULL));
+  PetscCall(MatGetLocalSize(D,&m,NULL));
+  PetscCheck(M==*M2 && m==*m2,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
+  /* check column 1 */
+  PetscCall(MatGetSize(A,NULL,N1));
+  PetscCall(MatGetLocalSize(A,NULL,n1));
+  PetscCall(MatGetSize(C,NULL,&N));
+  PetscCall(MatGetLocalSize(C,NULL,&n));
+  PetscCheck(N==*N1 && n==*n1,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
+  /* check column 2 */
+  PetscCall(MatGetSize(B,NULL,N2));
+  PetscCall(MatGetLocalSize(B,NULL,n2));
+  PetscCall(MatGetSize(D,NULL,&N));
+  PetscCall(MatGetLocalSize(D,NULL,&n));
+  PetscCheck(N==*N2 && n==*n2,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatCreateTile_Private(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,PetscBool pattern,Mat *G)
+{
+  PetscInt       i,k,M1,M2,N1,N2,m1,m2,n1,n2,bs;
+  PetscBool      diag[4];
+  Mat            block[4] = {A,B,C,D};
+  MatType        type[4];
+  PetscMPIInt    size;
+
+  PetscFunctionBegin;
+  PetscCheckSameTypeAndComm(A,2,B,4);
+  PetscCheckSameTypeAndComm(A,2,C,6);
+  PetscCheckSameTypeAndComm(A,2,D,8);
+  PetscCall(MatCreateTile_CheckSizes(A,B,C,D,&M1,&M2,&N1,&N2,&m1,&m2,&n1,&n2));
+
+  /* check matrix types */
+  for (i=0;i<4;i++) {
+    PetscCall(MatGetType(block[i],&type[i]));
+    PetscCall(PetscStrcmp(type[i],MATCONSTANTDIAGONAL,&diag[i]));
   }
-  PetscCall(PetscFree4(buf,scols,map1,map2));
+  for (k=0;k<4;k++) if (!diag[k]) break;
+  PetscCheck(k<4,PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,"Not implemented for 4 diagonal blocks");
+
+  PetscCall(MatGetBlockSize(block[k],&bs));
+  PetscCall(MatCreate(PetscObjectComm((PetscObject)block[k]),G));
+  PetscCall(MatSetSizes(*G,m1+m2,n1+n2,M1+M2,N1+N2));
+  PetscCall(MatSetType(*G,type[k]));
+  PetscCall(MatSetBlockSize(*G,bs));
+  PetscCall(MatSetUp(*G));
+
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)*G),&size));
+  if (size>1) PetscCall(MatCreateTile_MPI(a,A,b,B,c,C,d,D,pattern,*G));
+  else PetscCall(MatCreateTile_Seq(a,A,b,B,c,C,d,D,pattern,*G));
+  PetscCall(MatAssemblyBegin(*G,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(*G,MAT_FINAL_ASSEMBLY));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -283,14 +408,102 @@ static PetscErrorCode MatCreateTile_MPI(PetscScalar a,Mat A,PetscScalar b,Mat B,
 
    Level: developer
 
-.seealso: MatCreateNest()
+.seealso: MatCreateTileImplicit(), MatCreateTilePattern(), MatTileUpdateValues(), MatCreateNest()
 @*/
 PetscErrorCode MatCreateTile(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,Mat *G)
 {
-  PetscInt       i,k,M1,M2,N1,N2,M,N,m1,m2,n1,n2,m,n,bs;
-  PetscBool      diag[4];
-  Mat            block[4] = {A,B,C,D};
-  MatType        type[4];
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,4);
+  PetscValidHeaderSpecific(C,MAT_CLASSID,6);
+  PetscValidHeaderSpecific(D,MAT_CLASSID,8);
+  PetscValidLogicalCollectiveScalar(A,a,1);
+  PetscValidLogicalCollectiveScalar(A,b,3);
+  PetscValidLogicalCollectiveScalar(A,c,5);
+  PetscValidLogicalCollectiveScalar(A,d,7);
+  PetscAssertPointer(G,9);
+  PetscCall(MatCreateTile_Private(a,A,b,B,c,C,d,D,PETSC_FALSE,G));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MatCreateTilePattern - Build a matrix with the union of the sparsity patterns of
+   four blocks, G = [ A B; C D ], with all values set to zero.
+
+   Collective
+
+   Input Parameters:
++  A - matrix for top-left block
+.  B - matrix for top-right block
+.  C - matrix for bottom-left block
+-  D - matrix for bottom-right block
+
+   Output Parameter:
+.  G  - the resulting matrix
+
+   Notes:
+   The result is structurally identical to the matrix built by MatCreateTile(), with
+   explicit zero entries in all positions that are nonzero in some block, but the
+   values of the blocks are not read nor copied. This is cheaper when only the
+   sparsity pattern of the tiled matrix is needed, e.g., for symbolic factorization
+   analysis or for preallocating a matrix to be filled later.
+
+   Matrix G must be destroyed by the user.
+
+   Level: developer
+
+.seealso: MatCreateTile()
+@*/
+PetscErrorCode MatCreateTilePattern(Mat A,Mat B,Mat C,Mat D,Mat *G)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(C,MAT_CLASSID,3);
+  PetscValidHeaderSpecific(D,MAT_CLASSID,4);
+  PetscAssertPointer(G,5);
+  PetscCall(MatCreateTile_Private(1.0,A,1.0,B,1.0,C,1.0,D,PETSC_TRUE,G));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MatTileUpdateValues - Update the values of a matrix previously built with
+   MatCreateTile(), G = [ a*A b*B; c*C d*D ], after the values of the blocks
+   have changed.
+
+   Collective
+
+   Input Parameters:
++  A - matrix for top-left block
+.  a - scaling factor for block A
+.  B - matrix for top-right block
+.  b - scaling factor for block B
+.  C - matrix for bottom-left block
+.  c - scaling factor for block C
+.  D - matrix for bottom-right block
+-  d - scaling factor for block D
+
+   Output Parameter:
+.  G  - the matrix to be updated
+
+   Notes:
+   The values of G are overwritten in place, reusing the nonzero structure computed
+   when the matrix was created, so the preallocation scan is skipped entirely. This
+   is much cheaper than building the matrix anew when only the coefficient values
+   change between uses, as in parameter sweeps that rebuild a linearization at
+   every step.
+
+   The sparsity structure of the blocks must not have changed since G was created,
+   and scaling factors that were zero at creation time must remain zero, otherwise
+   new nonzero locations would be generated, degrading performance.
+
+   Level: developer
+
+.seealso: MatCreateTile()
+@*/
+PetscErrorCode MatTileUpdateValues(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,Mat G)
+{
+  PetscInt       M1,M2,N1,N2,m1,m2,n1,n2,M,N,m,n;
   PetscMPIInt    size;
 
   PetscFunctionBegin;
@@ -298,6 +511,7 @@ PetscErrorCode MatCreateTile(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar
   PetscValidHeaderSpecific(B,MAT_CLASSID,4);
   PetscValidHeaderSpecific(C,MAT_CLASSID,6);
   PetscValidHeaderSpecific(D,MAT_CLASSID,8);
+  PetscValidHeaderSpecific(G,MAT_CLASSID,9);
   PetscCheckSameTypeAndComm(A,2,B,4);
   PetscCheckSameTypeAndComm(A,2,C,6);
   PetscCheckSameTypeAndComm(A,2,D,8);
@@ -305,53 +519,237 @@ PetscErrorCode MatCreateTile(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar
   PetscValidLogicalCollectiveScalar(A,b,3);
   PetscValidLogicalCollectiveScalar(A,c,5);
   PetscValidLogicalCollectiveScalar(A,d,7);
-  PetscAssertPointer(G,9);
+  PetscCall(MatCreateTile_CheckSizes(A,B,C,D,&M1,&M2,&N1,&N2,&m1,&m2,&n1,&n2));
+  PetscCall(MatGetSize(G,&M,&N));
+  PetscCall(MatGetLocalSize(G,&m,&n));
+  PetscCheck(M==M1+M2 && N==N1+N2 && m==m1+m2 && n==n1+n2,PetscObjectComm((PetscObject)G),PETSC_ERR_ARG_INCOMP,"Matrix G has dimensions incompatible with the given blocks");
 
-  /* check row 1 */
-  PetscCall(MatGetSize(A,&M1,NULL));
-  PetscCall(MatGetLocalSize(A,&m1,NULL));
-  PetscCall(MatGetSize(B,&M,NULL));
-  PetscCall(MatGetLocalSize(B,&m,NULL));
-  PetscCheck(M==M1 && m==m1,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
-  /* check row 2 */
-  PetscCall(MatGetSize(C,&M2,NULL));
-  PetscCall(MatGetLocalSize(C,&m2,NULL));
-  PetscCall(MatGetSize(D,&M,NULL));
-  PetscCall(MatGetLocalSize(D,&m,NULL));
-  PetscCheck(M==M2 && m==m2,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
-  /* check column 1 */
-  PetscCall(MatGetSize(A,NULL,&N1));
-  PetscCall(MatGetLocalSize(A,NULL,&n1));
-  PetscCall(MatGetSize(C,NULL,&N));
-  PetscCall(MatGetLocalSize(C,NULL,&n));
-  PetscCheck(N==N1 && n==n1,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
-  /* check column 2 */
-  PetscCall(MatGetSize(B,NULL,&N2));
-  PetscCall(MatGetLocalSize(B,NULL,&n2));
-  PetscCall(MatGetSize(D,NULL,&N));
-  PetscCall(MatGetLocalSize(D,NULL,&n));
-  PetscCheck(N==N2 && n==n2,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"Incompatible dimensions");
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)G),&size));
+  if (size>1) PetscCall(MatTileUpdateValues_MPI(a,A,b,B,c,C,d,D,PETSC_FALSE,G));
+  else PetscCall(MatTileUpdateValues_Seq(a,A,b,B,c,C,d,D,PETSC_FALSE,G));
+  PetscCall(MatAssemblyBegin(G,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(G,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 
-  /* check matrix types */
-  for (i=0;i<4;i++) {
-    PetscCall(MatGetType(block[i],&type[i]));
-    PetscCall(PetscStrcmp(type[i],MATCONSTANTDIAGONAL,&diag[i]));
+typedef struct {
+  PetscScalar a,b,c,d;       /* scaling factors for the four blocks */
+  Mat         A,B,C,D;       /* the four blocks, referenced and not copied */
+  Vec         x1,x2,y1,y2;   /* auxiliary vectors without array, to access subvectors */
+  Vec         w1,w2;         /* workspace to accumulate the product of the second block of each row */
+  Vec         t1,t2;         /* analogous workspace for the transposed product, created on demand */
+  PetscInt    m1,n1;         /* local row and column lengths of the first block */
+} MatTile_Shell;
+
+static PetscErrorCode MatMult_TileImplicit(Mat G,Vec x,Vec y)
+{
+  MatTile_Shell     *ctx;
+  const PetscScalar *px;
+  PetscScalar       *py;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&ctx));
+  PetscCall(VecGetArrayRead(x,&px));
+  PetscCall(VecGetArrayWrite(y,&py));
+  PetscCall(VecPlaceArray(ctx->x1,px));
+  PetscCall(VecPlaceArray(ctx->x2,px+ctx->n1));
+  PetscCall(VecPlaceArray(ctx->y1,py));
+  PetscCall(VecPlaceArray(ctx->y2,py+ctx->m1));
+  if (ctx->a!=0.0) {
+    PetscCall(MatMult(ctx->A,ctx->x1,ctx->y1));
+    if (ctx->a!=1.0) PetscCall(VecScale(ctx->y1,ctx->a));
+  } else PetscCall(VecSet(ctx->y1,0.0));
+  if (ctx->b!=0.0) {
+    PetscCall(MatMult(ctx->B,ctx->x2,ctx->w1));
+    PetscCall(VecAXPY(ctx->y1,ctx->b,ctx->w1));
   }
-  for (k=0;k<4;k++) if (!diag[k]) break;
-  PetscCheck(k<4,PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,"Not implemented for 4 diagonal blocks");
+  if (ctx->c!=0.0) {
+    PetscCall(MatMult(ctx->C,ctx->x1,ctx->y2));
+    if (ctx->c!=1.0) PetscCall(VecScale(ctx->y2,ctx->c));
+  } else PetscCall(VecSet(ctx->y2,0.0));
+  if (ctx->d!=0.0) {
+    PetscCall(MatMult(ctx->D,ctx->x2,ctx->w2));
+    PetscCall(VecAXPY(ctx->y2,ctx->d,ctx->w2));
+  }
+  PetscCall(VecResetArray(ctx->x1));
+  PetscCall(VecResetArray(ctx->x2));
+  PetscCall(VecResetArray(ctx->y1));
+  PetscCall(VecResetArray(ctx->y2));
+  PetscCall(VecRestoreArrayRead(x,&px));
+  PetscCall(VecRestoreArrayWrite(y,&py));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 
-  PetscCall(MatGetBlockSize(block[k],&bs));
-  PetscCall(MatCreate(PetscObjectComm((PetscObject)block[k]),G));
-  PetscCall(MatSetSizes(*G,m1+m2,n1+n2,M1+M2,N1+N2));
-  PetscCall(MatSetType(*G,type[k]));
-  PetscCall(MatSetBlockSize(*G,bs));
-  PetscCall(MatSetUp(*G));
+static PetscErrorCode MatMultTranspose_TileImplicit(Mat G,Vec x,Vec y)
+{
+  MatTile_Shell     *ctx;
+  const PetscScalar *px;
+  PetscScalar       *py;
 
-  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)*G),&size));
-  if (size>1) PetscCall(MatCreateTile_MPI(a,A,b,B,c,C,d,D,*G));
-  else PetscCall(MatCreateTile_Seq(a,A,b,B,c,C,d,D,*G));
-  PetscCall(MatAssemblyBegin(*G,MAT_FINAL_ASSEMBLY));
-  PetscCall(MatAssemblyEnd(*G,MAT_FINAL_ASSEMBLY));
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&ctx));
+  if (!ctx->t1) PetscCall(MatCreateVecs(ctx->A,&ctx->t1,NULL));
+  if (!ctx->t2) PetscCall(MatCreateVecs(ctx->D,&ctx->t2,NULL));
+  PetscCall(VecGetArrayRead(x,&px));
+  PetscCall(VecGetArrayWrite(y,&py));
+  /* G^T = [ a*A^T c*C^T; b*B^T d*D^T ], with rows of G^T following the column layout of G */
+  PetscCall(VecPlaceArray(ctx->y1,px));
+  PetscCall(VecPlaceArray(ctx->y2,px+ctx->m1));
+  PetscCall(VecPlaceArray(ctx->x1,py));
+  PetscCall(VecPlaceArray(ctx->x2,py+ctx->n1));
+  if (ctx->a!=0.0) {
+    PetscCall(MatMultTranspose(ctx->A,ctx->y1,ctx->x1));
+    if (ctx->a!=1.0) PetscCall(VecScale(ctx->x1,ctx->a));
+  } else PetscCall(VecSet(ctx->x1,0.0));
+  if (ctx->c!=0.0) {
+    PetscCall(MatMultTranspose(ctx->C,ctx->y2,ctx->t1));
+    PetscCall(VecAXPY(ctx->x1,ctx->c,ctx->t1));
+  }
+  if (ctx->b!=0.0) {
+    PetscCall(MatMultTranspose(ctx->B,ctx->y1,ctx->x2));
+    if (ctx->b!=1.0) PetscCall(VecScale(ctx->x2,ctx->b));
+  } else PetscCall(VecSet(ctx->x2,0.0));
+  if (ctx->d!=0.0) {
+    PetscCall(MatMultTranspose(ctx->D,ctx->y2,ctx->t2));
+    PetscCall(VecAXPY(ctx->x2,ctx->d,ctx->t2));
+  }
+  PetscCall(VecResetArray(ctx->x1));
+  PetscCall(VecResetArray(ctx->x2));
+  PetscCall(VecResetArray(ctx->y1));
+  PetscCall(VecResetArray(ctx->y2));
+  PetscCall(VecRestoreArrayRead(x,&px));
+  PetscCall(VecRestoreArrayWrite(y,&py));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatGetDiagonal_TileImplicit(Mat G,Vec diag)
+{
+  MatTile_Shell  *ctx;
+  PetscScalar    *pd;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&ctx));
+  PetscCall(VecGetArrayWrite(diag,&pd));
+  PetscCall(VecPlaceArray(ctx->y1,pd));
+  PetscCall(VecPlaceArray(ctx->y2,pd+ctx->m1));
+  if (ctx->a!=0.0) {
+    PetscCall(MatGetDiagonal(ctx->A,ctx->y1));
+    if (ctx->a!=1.0) PetscCall(VecScale(ctx->y1,ctx->a));
+  } else PetscCall(VecSet(ctx->y1,0.0));
+  if (ctx->d!=0.0) {
+    PetscCall(MatGetDiagonal(ctx->D,ctx->y2));
+    if (ctx->d!=1.0) PetscCall(VecScale(ctx->y2,ctx->d));
+  } else PetscCall(VecSet(ctx->y2,0.0));
+  PetscCall(VecResetArray(ctx->y1));
+  PetscCall(VecResetArray(ctx->y2));
+  PetscCall(VecRestoreArrayWrite(diag,&pd));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatDestroy_TileImplicit(Mat G)
+{
+  MatTile_Shell  *ctx;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&ctx));
+  PetscCall(MatDestroy(&ctx->A));
+  PetscCall(MatDestroy(&ctx->B));
+  PetscCall(MatDestroy(&ctx->C));
+  PetscCall(MatDestroy(&ctx->D));
+  PetscCall(VecDestroy(&ctx->x1));
+  PetscCall(VecDestroy(&ctx->x2));
+  PetscCall(VecDestroy(&ctx->y1));
+  PetscCall(VecDestroy(&ctx->y2));
+  PetscCall(VecDestroy(&ctx->w1));
+  PetscCall(VecDestroy(&ctx->w2));
+  PetscCall(VecDestroy(&ctx->t1));
+  PetscCall(VecDestroy(&ctx->t2));
+  PetscCall(PetscFree(ctx));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MatCreateTileImplicit - Build an implicit representation of a matrix from four
+   blocks, G = [ a*A b*B; c*C d*D ], without copying any values.
+
+   Collective
+
+   Input Parameters:
++  A - matrix for top-left block
+.  a - scaling factor for block A
+.  B - matrix for top-right block
+.  b - scaling factor for block B
+.  C - matrix for bottom-left block
+.  c - scaling factor for block C
+.  D - matrix for bottom-right block
+-  d - scaling factor for block D
+
+   Output Parameter:
+.  G  - the resulting matrix
+
+   Notes:
+   In contrast to MatCreateTile(), the blocks are referenced rather than copied, so
+   no memory is duplicated and changes made to the values of the blocks (without
+   altering their structure) are immediately visible through G. The returned matrix
+   is a shell that supports the matrix-vector product, the transposed product, and
+   getting the diagonal (the latter only if the diagonal blocks are square), so it
+   can be used with solvers configured for matrix-free operation, but not with
+   direct factorizations. The parallel layout of G is the same perfect shuffle
+   produced by MatCreateTile().
+
+   Blocks with a zero scaling factor are never applied. The blocks need not be of
+   the same type, but they must be defined on the same communicator.
+
+   Matrix G must be destroyed by the user.
+
+   Level: developer
+
+.seealso: MatCreateTile(), MatCreateVecsEmpty()
+@*/
+PetscErrorCode MatCreateTileImplicit(PetscScalar a,Mat A,PetscScalar b,Mat B,PetscScalar c,Mat C,PetscScalar d,Mat D,Mat *G)
+{
+  PetscInt       M1,M2,N1,N2,m1,m2,n1,n2;
+  MatTile_Shell  *ctx;
+  VecType        vtype;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,4);
+  PetscValidHeaderSpecific(C,MAT_CLASSID,6);
+  PetscValidHeaderSpecific(D,MAT_CLASSID,8);
+  PetscCheckSameComm(A,2,B,4);
+  PetscCheckSameComm(A,2,C,6);
+  PetscCheckSameComm(A,2,D,8);
+  PetscValidLogicalCollectiveScalar(A,a,1);
+  PetscValidLogicalCollectiveScalar(A,b,3);
+  PetscValidLogicalCollectiveScalar(A,c,5);
+  PetscValidLogicalCollectiveScalar(A,d,7);
+  PetscAssertPointer(G,9);
+  PetscCall(MatCreateTile_CheckSizes(A,B,C,D,&M1,&M2,&N1,&N2,&m1,&m2,&n1,&n2));
+
+  PetscCall(PetscNew(&ctx));
+  ctx->a = a; ctx->A = A;
+  ctx->b = b; ctx->B = B;
+  ctx->c = c; ctx->C = C;
+  ctx->d = d; ctx->D = D;
+  PetscCall(PetscObjectReference((PetscObject)A));
+  PetscCall(PetscObjectReference((PetscObject)B));
+  PetscCall(PetscObjectReference((PetscObject)C));
+  PetscCall(PetscObjectReference((PetscObject)D));
+  ctx->m1 = m1;
+  ctx->n1 = n1;
+  PetscCall(MatCreateVecsEmpty(A,&ctx->x1,&ctx->y1));
+  PetscCall(MatCreateVecsEmpty(D,&ctx->x2,&ctx->y2));
+  PetscCall(MatCreateVecs(A,NULL,&ctx->w1));
+  PetscCall(MatCreateVecs(D,NULL,&ctx->w2));
+
+  PetscCall(MatCreateShell(PetscObjectComm((PetscObject)A),m1+m2,n1+n2,M1+M2,N1+N2,ctx,G));
+  PetscCall(MatShellSetOperation(*G,MATOP_MULT,(void(*)(void))MatMult_TileImplicit));
+  PetscCall(MatShellSetOperation(*G,MATOP_MULT_TRANSPOSE,(void(*)(void))MatMultTranspose_TileImplicit));
+  if (M1==N1 && M2==N2 && m1==n1 && m2==n2) PetscCall(MatShellSetOperation(*G,MATOP_GET_DIAGONAL,(void(*)(void))MatGetDiagonal_TileImplicit));
+  PetscCall(MatShellSetOperation(*G,MATOP_DESTROY,(void(*)(void))MatDestroy_TileImplicit));
+  PetscCall(MatGetVecType(A,&vtype));
+  PetscCall(MatSetVecType(*G,vtype));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -489,3 +887,349 @@ PetscErrorCode MatNormEstimate(Mat A,Vec vrn,Vec w,PetscReal *nrm)
   PetscCall(VecDestroy(&ww));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*@
+   MatNorm2Estimate - Estimate the 2-norm of a matrix with a few iterations of
+   the power method.
+
+   Collective
+
+   Input Parameters:
++  A   - the matrix
+-  its - number of iterations of the power method, or PETSC_DEFAULT
+
+   Output Parameter:
+.  nrm - the norm estimate
+
+   Notes:
+   Runs the power method implicitly on the product of the (conjugate) transpose
+   of A and A, starting from a random vector, so the cost is its applications
+   of the matrix and of its transpose, plus two workspace vectors. A handful of
+   iterations gives an estimate accurate to a few percent, which is usually
+   enough when the value is needed for scaling decisions. The default number of
+   iterations is 5.
+
+   In contrast to MatNormEstimate(), which performs a single matrix-vector
+   product to get a rough magnitude estimate, this function approaches the true
+   norm from below as the number of iterations is increased, but the matrix
+   must support the (conjugate) transpose matrix-vector product. The matrix can
+   be rectangular. For computing the norm to full accuracy, use an SVD solver
+   instead.
+
+   Level: developer
+
+.seealso: MatNormEstimate()
+@*/
+PetscErrorCode MatNorm2Estimate(Mat A,PetscInt its,PetscReal *nrm)
+{
+  PetscInt       i;
+  Vec            x,y;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidType(A,1);
+  PetscValidLogicalCollectiveInt(A,its,2);
+  PetscAssertPointer(nrm,3);
+  if (its==PETSC_DEFAULT || its==PETSC_DECIDE) its = 5;
+  PetscCheck(its>0,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_OUTOFRANGE,"The number of iterations must be at least 1");
+
+  PetscCall(MatCreateVecs(A,&x,&y));
+  PetscCall(VecSetRandomNormal(x,NULL,NULL,NULL));
+  PetscCall(VecNormalize(x,NULL));
+  for (i=0;i<its;i++) {
+    PetscCall(MatMult(A,x,y));
+    PetscCall(VecNorm(y,NORM_2,nrm));
+    if (i<its-1) {
+#if defined(PETSC_USE_COMPLEX)
+      PetscCall(MatMultHermitianTranspose(A,y,x));
+#else
+      PetscCall(MatMultTranspose(A,y,x));
+#endif
+      PetscCall(VecNormalize(x,NULL));
+    }
+  }
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MatSpectrumSketch - Compute a cheap sketch of the spectrum of a Hermitian
+   matrix: an approximate density of states together with estimates of the
+   spectral interval.
+
+   Collective
+
+   Input Parameters:
++  A      - the matrix, which is assumed Hermitian (symmetric in real scalars)
+.  budget - maximum number of matrix-vector products to be spent, or PETSC_DEFAULT
+.  nbins  - number of bins of the histogram, or PETSC_DEFAULT
+-  viewer - viewer where the histogram is printed (can be NULL)
+
+   Output Parameters:
++  left  - estimate of the leftmost eigenvalue (can be NULL)
+-  right - estimate of the rightmost eigenvalue (can be NULL)
+
+   Notes:
+   Does not need access to the matrix entries, just performs matrix-vector
+   products. The matrix-vector budget is split into several runs of the Lanczos
+   recurrence started with independent random vectors, and the Ritz values of
+   each run are combined with the weights given by stochastic Lanczos
+   quadrature to approximate the eigenvalue counting measure. The endpoints of
+   the interval are obtained from the extreme Ritz values corrected with their
+   residual bounds, in the same way as the bounds used to set up polynomial
+   filters.
+
+   The histogram gives, for each bin of the estimated spectral interval, the
+   approximate fraction of eigenvalues contained in it. The estimates are cheap
+   but rough, intended for choosing solver parameters such as the subspace
+   dimensions or the degree of a filter, not as a substitute for an eigensolver.
+   The default budget is 100 matrix-vector products and the default number of
+   bins is 10.
+
+   Level: developer
+
+.seealso: MatNormEstimate(), MatNorm2Estimate()
+@*/
+PetscErrorCode MatSpectrumSketch(Mat A,PetscInt budget,PetscInt nbins,PetscReal *left,PetscReal *right,PetscViewer viewer)
+{
+  PetscInt       i,j,k,v,m,nv,kact,nodes=0,matvecs=0,bin,M,N;
+  PetscReal      *alpha,*beta,*D,*E,*w,*Z,*theta,*tau,*hist,*work;
+  PetscReal      nrm,bnd,lmin=PETSC_MAX_REAL,lmax=PETSC_MIN_REAL,width,frac;
+  PetscScalar    dot;
+  PetscBool      isascii=PETSC_FALSE;
+  PetscBLASInt   n_,il,iu,mout,*isuppz,lwork,*iwork,liwork,info;
+  PetscReal      abstol=0.0,vl,vu;
+  Vec            x,xprev,y;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidType(A,1);
+  PetscValidLogicalCollectiveInt(A,budget,2);
+  PetscValidLogicalCollectiveInt(A,nbins,3);
+  if (viewer) PetscValidHeaderSpecific(viewer,PETSC_VIEWER_CLASSID,6);
+  PetscCall(MatGetSize(A,&M,&N));
+  PetscCheck(M==N,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_WRONG,"Matrix must be square");
+  if (budget==PETSC_DEFAULT || budget==PETSC_DECIDE) budget = 100;
+  if (nbins==PETSC_DEFAULT || nbins==PETSC_DECIDE) nbins = 10;
+  PetscCheck(budget>0,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_OUTOFRANGE,"The budget must be at least 1");
+  PetscCheck(nbins>0,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_OUTOFRANGE,"The number of bins must be at least 1");
+
+  m  = PetscMin(30,PetscMin(N,budget));
+  nv = PetscMax(1,budget/m);
+  PetscCall(PetscBLASIntCast(20*m,&lwork));
+  PetscCall(PetscBLASIntCast(10*m,&liwork));
+  PetscCall(PetscMalloc6(m,&alpha,m,&beta,m,&D,m,&E,m,&w,m*m,&Z));
+  PetscCall(PetscMalloc3(nv*m,&theta,nv*m,&tau,nbins,&hist));
+  PetscCall(PetscMalloc2(2*m,&isuppz,liwork,&iwork));
+  PetscCall(PetscMalloc1(lwork,&work));
+  PetscCall(MatCreateVecs(A,&x,NULL));
+  PetscCall(VecDuplicate(x,&xprev));
+  PetscCall(VecDuplicate(x,&y));
+
+  for (v=0;v<nv;v++) {
+    /* plain Lanczos recurrence without reorthogonalization; the quadrature
+       weights are not harmed by the loss of orthogonality */
+    PetscCall(VecSetRandomNormal(x,NULL,NULL,NULL));
+    PetscCall(VecNormalize(x,NULL));
+    PetscCall(VecSet(xprev,0.0));
+    kact = 0;
+    for (k=0;k<m;k++) {
+      PetscCall(MatMult(A,x,y));
+      matvecs++;
+      PetscCall(VecDot(y,x,&dot));
+      alpha[k] = PetscRealPart(dot);
+      PetscCall(VecAXPY(y,-alpha[k],x));
+      if (k>0) PetscCall(VecAXPY(y,-beta[k-1],xprev));
+      PetscCall(VecNorm(y,NORM_2,&nrm));
+      kact = k+1;
+      beta[k] = nrm;
+      if (nrm<PETSC_MACHINE_EPSILON*PetscAbsReal(alpha[k])) break;  /* breakdown, the run spans an invariant subspace */
+      if (k<m-1) {
+        PetscCall(VecCopy(x,xprev));
+        PetscCall(VecCopy(y,x));
+        PetscCall(VecScale(x,1.0/nrm));
+      }
+    }
+    /* eigendecomposition of the tridiagonal matrix of the run */
+    for (k=0;k<kact;k++) D[k] = alpha[k];
+    for (k=0;k<kact-1;k++) E[k] = beta[k];
+    PetscCall(PetscBLASIntCast(kact,&n_));
+    PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+    PetscCallBLAS("LAPACKstevr",LAPACKstevr_("V","A",&n_,D,E,&vl,&vu,&il,&iu,&abstol,&mout,w,Z,&n_,isuppz,work,&lwork,iwork,&liwork,&info));
+    PetscCall(PetscFPTrapPop());
+    SlepcCheckLapackInfo("stevr",info);
+    for (j=0;j<kact;j++) {
+      theta[nodes] = w[j];
+      tau[nodes]   = Z[j*kact]*Z[j*kact];
+      bnd          = beta[kact-1]*PetscAbsReal(Z[kact-1+j*kact]);
+      lmin = PetscMin(lmin,w[j]-bnd);
+      lmax = PetscMax(lmax,w[j]+bnd);
+      nodes++;
+    }
+  }
+
+  /* accumulate the quadrature nodes into the histogram */
+  for (bin=0;bin<nbins;bin++) hist[bin] = 0.0;
+  width = (lmax-lmin)/nbins;
+  for (i=0;i<nodes;i++) {
+    bin = (width>0.0)? (PetscInt)((theta[i]-lmin)/width): 0;
+    bin = PetscMax(0,PetscMin(nbins-1,bin));
+    hist[bin] += tau[i]/nv;
+  }
+
+  if (left) *left = lmin;
+  if (right) *right = lmax;
+  if (viewer) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+    if (isascii) {
+      PetscCall(PetscViewerASCIIPrintf(viewer,"Spectrum sketch obtained with %" PetscInt_FMT " matrix-vector products\n",matvecs));
+      PetscCall(PetscViewerASCIIPrintf(viewer,"Estimated spectral interval: [%g,%g]\n",(double)lmin,(double)lmax));
+      for (bin=0;bin<nbins;bin++) {
+        frac = 100.0*hist[bin];
+        PetscCall(PetscViewerASCIIPrintf(viewer,"  [%12g,%12g): %6.2f%% of the eigenvalues\n",(double)(lmin+bin*width),(double)(lmin+(bin+1)*width),(double)frac));
+      }
+    }
+  }
+
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&xprev));
+  PetscCall(VecDestroy(&y));
+  PetscCall(PetscFree(work));
+  PetscCall(PetscFree2(isuppz,iwork));
+  PetscCall(PetscFree3(theta,tau,hist));
+  PetscCall(PetscFree6(alpha,beta,D,E,w,Z));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* keys for the estimates cached on the matrix by MatEstimateSpectralRange() */
+static PetscInt SpectralRangeId_Left  = -1;
+static PetscInt SpectralRangeId_Right = -1;
+
+/*@
+   MatEstimateSpectralRange - Estimate the extremal eigenvalues of a Hermitian
+   matrix with a few steps of the Lanczos recurrence.
+
+   Collective
+
+   Input Parameters:
++  A   - the matrix, which is assumed Hermitian (symmetric in real scalars)
+-  its - number of Lanczos steps, or PETSC_DEFAULT
+
+   Output Parameters:
++  left  - estimate of the leftmost eigenvalue (can be NULL)
+-  right - estimate of the rightmost eigenvalue (can be NULL)
+
+   Notes:
+   Does not need access to the matrix entries, just performs its matrix-vector
+   products. The endpoints are obtained from the extreme Ritz values of a
+   single Lanczos run started with a random vector, corrected with their
+   residual bounds, as in MatSpectrumSketch(). The default number of steps
+   is 10, which is usually enough for the purpose of choosing transformation
+   parameters such as a shift, a scaling factor or a filter interval.
+
+   The estimates are stored on the matrix as composed data, so subsequent
+   calls, possibly issued from different solver objects working on the same
+   operator, return the cached values without performing any matrix-vector
+   product. The cache is invalidated automatically whenever the matrix values
+   change.
+
+   Level: developer
+
+.seealso: MatSpectrumSketch(), MatNorm2Estimate(), STSetScale()
+@*/
+PetscErrorCode MatEstimateSpectralRange(Mat A,PetscInt its,PetscReal *left,PetscReal *right)
+{
+  PetscInt       j,k,kact,M,N;
+  PetscReal      *alpha,*beta,*D,*E,*w,*Z,*work;
+  PetscReal      nrm,bnd,lmin=PETSC_MAX_REAL,lmax=PETSC_MIN_REAL;
+  PetscScalar    dot;
+  PetscBool      hasl=PETSC_FALSE,hasr=PETSC_FALSE;
+  PetscBLASInt   n_,il,iu,mout,*isuppz,lwork,*iwork,liwork,info;
+  PetscReal      abstol=0.0,vl,vu;
+  Vec            x,xprev,y;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidType(A,1);
+  PetscValidLogicalCollectiveInt(A,its,2);
+  PetscCall(MatGetSize(A,&M,&N));
+  PetscCheck(M==N,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_WRONG,"Matrix must be square");
+  if (its==PETSC_DEFAULT || its==PETSC_DECIDE) its = 10;
+  PetscCheck(its>0,PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_OUTOFRANGE,"The number of steps must be at least 1");
+  its = PetscMin(its,N);
+
+  /* return the cached estimates if the matrix has not changed */
+  if (SpectralRangeId_Left==-1) {
+    PetscCall(PetscObjectComposedDataRegister(&SpectralRangeId_Left));
+    PetscCall(PetscObjectComposedDataRegister(&SpectralRangeId_Right));
+  }
+  PetscCall(PetscObjectComposedDataGetReal((PetscObject)A,SpectralRangeId_Left,lmin,hasl));
+  PetscCall(PetscObjectComposedDataGetReal((PetscObject)A,SpectralRangeId_Right,lmax,hasr));
+  if (hasl && hasr) {
+    if (left) *left = lmin;
+    if (right) *right = lmax;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  lmin = PETSC_MAX_REAL;
+  lmax = PETSC_MIN_REAL;
+
+  PetscCall(PetscBLASIntCast(20*its,&lwork));
+  PetscCall(PetscBLASIntCast(10*its,&liwork));
+  PetscCall(PetscMalloc6(its,&alpha,its,&beta,its,&D,its,&E,its,&w,its*its,&Z));
+  PetscCall(PetscMalloc2(2*its,&isuppz,liwork,&iwork));
+  PetscCall(PetscMalloc1(lwork,&work));
+  PetscCall(MatCreateVecs(A,&x,NULL));
+  PetscCall(VecDuplicate(x,&xprev));
+  PetscCall(VecDuplicate(x,&y));
+
+  /* plain Lanczos recurrence without reorthogonalization */
+  PetscCall(VecSetRandomNormal(x,NULL,NULL,NULL));
+  PetscCall(VecNormalize(x,NULL));
+  PetscCall(VecSet(xprev,0.0));
+  kact = 0;
+  for (k=0;k<its;k++) {
+    PetscCall(MatMult(A,x,y));
+    PetscCall(VecDot(y,x,&dot));
+    alpha[k] = PetscRealPart(dot);
+    PetscCall(VecAXPY(y,-alpha[k],x));
+    if (k>0) PetscCall(VecAXPY(y,-beta[k-1],xprev));
+    PetscCall(VecNorm(y,NORM_2,&nrm));
+    kact = k+1;
+    beta[k] = nrm;
+    if (nrm<PETSC_MACHINE_EPSILON*PetscAbsReal(alpha[k])) break;  /* breakdown, the run spans an invariant subspace */
+    if (k<its-1) {
+      PetscCall(VecCopy(x,xprev));
+      PetscCall(VecCopy(y,x));
+      PetscCall(VecScale(x,1.0/nrm));
+    }
+  }
+
+  /* eigendecomposition of the tridiagonal matrix */
+  for (k=0;k<kact;k++) D[k] = alpha[k];
+  for (k=0;k<kact-1;k++) E[k] = beta[k];
+  PetscCall(PetscBLASIntCast(kact,&n_));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKstevr",LAPACKstevr_("V","A",&n_,D,E,&vl,&vu,&il,&iu,&abstol,&mout,w,Z,&n_,isuppz,work,&lwork,iwork,&liwork,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("stevr",info);
+  for (j=0;j<kact;j++) {
+    bnd  = beta[kact-1]*PetscAbsReal(Z[kact-1+j*kact]);
+    lmin = PetscMin(lmin,w[j]-bnd);
+    lmax = PetscMax(lmax,w[j]+bnd);
+  }
+
+  /* cache the estimates on the matrix */
+  PetscCall(PetscObjectComposedDataSetReal((PetscObject)A,SpectralRangeId_Left,lmin));
+  PetscCall(PetscObjectComposedDataSetReal((PetscObject)A,SpectralRangeId_Right,lmax));
+  if (left) *left = lmin;
+  if (right) *right = lmax;
+
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&xprev));
+  PetscCall(VecDestroy(&y));
+  PetscCall(PetscFree(work));
+  PetscCall(PetscFree2(isuppz,iwork));
+  PetscCall(PetscFree6(alpha,beta,D,E,w,Z));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
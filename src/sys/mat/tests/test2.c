@@ -0,0 +1,95 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test MatTileUpdateValues.\n\n";
+
+#include <slepcsys.h>
+
+int main(int argc,char **argv)
+{
+  Mat            T,E,G,G2;
+  PetscReal      norm,gnorm;
+  PetscInt       i,Istart,Iend,n=10;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,(char*)0,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"MatTileUpdateValues test, n=%" PetscInt_FMT "\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Create T=tridiag([-1 2 -1],n,n) and E=eye(n)
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&T));
+  PetscCall(MatSetSizes(T,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(T));
+  PetscCall(MatSetUp(T));
+
+  PetscCall(MatGetOwnershipRange(T,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(T,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(T,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(T,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(T,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(T,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&E));
+  PetscCall(MatSetSizes(E,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(E));
+  PetscCall(MatSetUp(E));
+
+  PetscCall(MatGetOwnershipRange(E,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) PetscCall(MatSetValue(E,i,i,1.0,INSERT_VALUES));
+  PetscCall(MatAssemblyBegin(E,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(E,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Create tiled matrix G = [ 2*T -E; 0 3*T ]
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(MatCreateTile(2.0,T,-1.0,E,0.0,E,3.0,T,&G));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Change the values of the blocks (same structure) and the scaling
+     factors, then update G in place and compare with a fresh tile
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(MatGetOwnershipRange(T,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(T,i,i-1,-2.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(T,i,i+1,-2.0,INSERT_VALUES));
+    PetscCall(MatSetValue(T,i,i,4.0+i,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(T,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(T,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatTileUpdateValues(1.5,T,-2.0,E,0.0,E,2.5,T,G));
+  PetscCall(MatCreateTile(1.5,T,-2.0,E,0.0,E,2.5,T,&G2));
+
+  PetscCall(MatNorm(G2,NORM_FROBENIUS,&gnorm));
+  PetscCall(MatAXPY(G2,-1.0,G,DIFFERENT_NONZERO_PATTERN));
+  PetscCall(MatNorm(G2,NORM_FROBENIUS,&norm));
+  if (norm>10*PETSC_MACHINE_EPSILON*gnorm) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Updated tile differs from a freshly assembled tile: %g\n",(double)(norm/gnorm)));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Updated tile matches a freshly assembled tile\n"));
+
+  PetscCall(MatDestroy(&T));
+  PetscCall(MatDestroy(&E));
+  PetscCall(MatDestroy(&G));
+  PetscCall(MatDestroy(&G2));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      nsize: {{1 2}}
+
+TEST*/
@@ -240,3 +240,46 @@ PetscErrorCode SlepcCISS_BH_SVD(PetscScalar *H,PetscInt ml,PetscReal delta,Petsc
 #endif
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   SlepcCISS_BH_SVD_Adaptive - Determine the rank from block Hankel matrices
+   of increasing moment degree.
+
+   Input Parameters:
+   Mu - the moments computed with BVDotQuadrature()
+   s  - the shift of the Hankel matrix (0 for H0, 1 for H1)
+   L  - block size
+   M  - maximum moment degree
+   delta - the tolerance used to determine the rank
+
+   Output Parameters:
+   H     - workspace of (at least) m*L rows and columns, overwritten with the
+           singular value decomposition of the last Hankel matrix built
+   sigma - computed singular values
+   m     - the moment degree actually used
+   rank  - the rank of H
+
+   Notes:
+   The rank of the Hankel matrix of degree m cannot exceed the number of
+   eigenvalues enclosed in the contour, so as soon as some degree yields a
+   rank-deficient matrix the rank has stabilized and larger degrees need not
+   be examined. The degree is increased by doubling up to M, hence in the
+   worst case the accumulated cost stays within a small multiple of the cost
+   of the decomposition of the full-degree matrix, while runs whose rank
+   settles early skip the most expensive decompositions entirely.
+*/
+PetscErrorCode SlepcCISS_BH_SVD_Adaptive(PetscScalar *Mu,PetscInt s,PetscInt L,PetscInt M,PetscReal delta,PetscScalar *H,PetscReal *sigma,PetscInt *m,PetscInt *rank)
+{
+  PetscInt       deg;
+
+  PetscFunctionBegin;
+  deg = PetscMin(2,M);
+  while (PETSC_TRUE) {
+    PetscCall(CISS_BlockHankel(Mu,s,L,deg,H));
+    PetscCall(SlepcCISS_BH_SVD(H,L*deg,delta,sigma,rank));
+    if (*rank<L*deg || deg==M) break;
+    deg = PetscMin(2*deg,M);
+  }
+  *m = deg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -16,6 +16,10 @@ SLEPC_EXTERN PetscErrorCode KSPCreate_HPDDM(KSP);
 SLEPC_EXTERN PetscErrorCode PCCreate_HPDDM(PC);
 #endif
 
+#if defined(PETSC_HAVE_MAGMA)
+#include <slepcmagma.h>
+#endif
+
 /*@C
     SlepcGetVersion - Gets the SLEPc version information in a string.
 
@@ -270,24 +274,89 @@ PetscErrorCode SlepcInitialize(int *argc,char ***args,const char file[],const ch
   /* Load the dynamic libraries (on machines that support them), this registers all the solvers etc. */
   PetscCall(SlepcInitialize_DynamicLibraries());
 
+  /* Activate logging if a machine-readable performance dump was requested */
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-slepc_perf_json",&flg));
+  if (flg) PetscCall(PetscLogDefaultBegin());
+
+#if defined(PETSC_HAVE_MAGMA)
+  /* Store the problem size at which dense solves switch to the hybrid CPU+GPU kernels */
+  PetscCall(SlepcMagmaSetCrossoverFromOptions());
+#endif
+
   SlepcInitializeCalled = PETSC_TRUE;
   SlepcFinalizeCalled   = PETSC_FALSE;
   PetscCall(PetscInfo(0,"SLEPc successfully started\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   SlepcPerfDumpJSON - Write the performance counters of the hot regions of
+   the SLEPc solvers to a file in JSON format, for the -slepc_perf_json option.
+
+   The data come from the PETSc logging infrastructure, so any additional
+   counters that PETSc has been configured to collect (e.g. hardware counters
+   through PAPI) are aggregated under the same named events and can be
+   correlated with the solver phases listed here. Times and counts are the
+   maximum over all processes, flops and message counts are summed.
+*/
+static PetscErrorCode SlepcPerfDumpJSON(const char filename[])
+{
+  static const char *const events[] = {
+    "EPSSetUp","EPSSolve","SVDSetUp","SVDSolve","PEPSetUp","PEPSolve","NEPSetUp","NEPSolve",
+    "STSetUp","STApply","STApplyTranspose","STMatMult","STMatSolve",
+    "BVCopy","BVMult","BVMultVec","BVMultInPlace","BVDot","BVDotVec","BVOrthogonalize",
+    "BVOrthogonalizeV","BVNorm","BVNormVec","BVSetRandom","BVMatMult","BVMatProject",
+    "DSSolve","DSVectors","DSSynchronize","DSOther",
+    "MatMult","MatMultTranspose","MatSolve","KSPSolve","PCApply"
+  };
+  PetscViewer        viewer;
+  PetscEventPerfInfo info;
+  PetscLogEvent      event;
+  PetscLogDouble     lmax[2],gmax[2],lsum[2],gsum[2];
+  PetscInt           i;
+  PetscBool          first=PETSC_TRUE;
+
+  PetscFunctionBegin;
+  PetscCall(PetscViewerASCIIOpen(PETSC_COMM_WORLD,filename,&viewer));
+  PetscCall(PetscViewerASCIIPrintf(viewer,"{\n  \"events\": [\n"));
+  for (i=0;i<(PetscInt)PETSC_STATIC_ARRAY_LENGTH(events);i++) {
+    PetscCall(PetscLogEventGetId(events[i],&event));
+    if (event<0) continue;
+    PetscCall(PetscLogEventGetPerfInfo(PETSC_DETERMINE,event,&info));
+    lmax[0] = info.time;
+    lmax[1] = (PetscLogDouble)info.count;
+    lsum[0] = info.flops;
+    lsum[1] = info.numMessages;
+    PetscCall(MPIU_Allreduce(lmax,gmax,2,MPIU_PETSCLOGDOUBLE,MPI_MAX,PETSC_COMM_WORLD));
+    PetscCall(MPIU_Allreduce(lsum,gsum,2,MPIU_PETSCLOGDOUBLE,MPI_SUM,PETSC_COMM_WORLD));
+    if (gmax[1]==0.0) continue;   /* skip events that never ran */
+    PetscCall(PetscViewerASCIIPrintf(viewer,"%s    {\"name\": \"%s\", \"count\": %d, \"time\": %g, \"flops\": %g, \"messages\": %g}",first?"":",\n",events[i],(int)gmax[1],(double)gmax[0],(double)gsum[0],(double)gsum[1]));
+    first = PETSC_FALSE;
+  }
+  PetscCall(PetscViewerASCIIPrintf(viewer,"\n  ]\n}\n"));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@C
    SlepcFinalize - Checks for options to be called at the conclusion
    of the SLEPc program and calls PetscFinalize().
 
    Collective on PETSC_COMM_WORLD
 
+   Options Database Key:
+.  -slepc_perf_json [filename] - dump the performance counters of the main
+   solver phases in JSON format (default filename slepc_perf.json)
+
    Level: beginner
 
 .seealso: SlepcInitialize(), PetscFinalize()
 @*/
 PetscErrorCode SlepcFinalize(void)
 {
+  char           perffile[PETSC_MAX_PATH_LEN];
+  PetscBool      flg;
+
   PetscFunctionBegin;
   if (PetscUnlikely(!SlepcInitializeCalled)) {
     fprintf(PETSC_STDOUT,"SlepcInitialize() must be called before SlepcFinalize()\n");
@@ -295,6 +364,8 @@ PetscErrorCode SlepcFinalize(void)
     return PETSC_ERR_ARG_WRONGSTATE;
   }
   PetscCall(PetscInfo(NULL,"SlepcFinalize() called\n"));
+  PetscCall(PetscOptionsGetString(NULL,NULL,"-slepc_perf_json",perffile,sizeof(perffile),&flg));
+  if (flg) PetscCall(SlepcPerfDumpJSON(perffile[0]?perffile:"slepc_perf.json"));
   if (SlepcBeganPetsc) {
     PetscCall(PetscFinalize());
     SlepcBeganPetsc = PETSC_FALSE;
@@ -62,6 +62,94 @@ PetscErrorCode SlepcSCCompare(SlepcSC sc,PetscScalar ar,PetscScalar ai,PetscScal
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   SlepcSCComputeKeys - Computes scalar sorting keys for a list of (possibly
+   complex) values, so that sorting the keys in ascending order is equivalent
+   to sorting the values with SlepcSCCompare().
+
+   Not Collective
+
+   Input Parameters:
++  sc   - the sorting criterion context
+.  n    - number of values in the list
+.  eigr - pointer to the array containing the values
+-  eigi - imaginary part of the values (may be NULL)
+
+   Output Parameters:
++  keys  - array of at least n entries where the keys are returned
+-  avail - whether the keys could be computed
+
+   Notes:
+   The keys are computed in a single pass, applying the mapping function and
+   the region test (if any) to the whole array at once, which is much cheaper
+   than one mapping and one region test per comparison when sorting long
+   lists. This is possible only for the predefined comparison functions; for
+   a user-defined comparison avail is set to PETSC_FALSE and keys is not
+   touched, in which case the caller must resort to SlepcSCCompare().
+
+   Values lying outside the region (if a region has been set) get their key
+   shifted so that they sort after all the values inside, as in
+   SlepcSCCompare().
+
+   Level: developer
+
+.seealso: SlepcSCCompare(), SlepcSortEigenvalues(), SlepcSC
+@*/
+PetscErrorCode SlepcSCComputeKeys(SlepcSC sc,PetscInt n,const PetscScalar *eigr,const PetscScalar *eigi,PetscReal *keys,PetscBool *avail)
+{
+  PetscScalar    target=0.0,*re,*im;
+  PetscReal      kmin,kmax;
+  PetscInt       i,*cin;
+
+  PetscFunctionBegin;
+  PetscAssertPointer(sc,1);
+  PetscAssertPointer(keys,5);
+  PetscAssertPointer(avail,6);
+  *avail = PETSC_FALSE;
+  if (sc->comparison==SlepcCompareTargetMagnitude || sc->comparison==SlepcCompareTargetReal
+#if defined(PETSC_USE_COMPLEX)
+      || sc->comparison==SlepcCompareTargetImaginary
+#endif
+     ) target = *(PetscScalar*)sc->comparisonctx;
+  else if (sc->comparison!=SlepcCompareLargestMagnitude && sc->comparison!=SlepcCompareSmallestMagnitude && sc->comparison!=SlepcCompareLargestReal && sc->comparison!=SlepcCompareSmallestReal && sc->comparison!=SlepcCompareLargestImaginary && sc->comparison!=SlepcCompareSmallestImaginary) PetscFunctionReturn(PETSC_SUCCESS);
+  *avail = PETSC_TRUE;
+  if (!n) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscMalloc2(n,&re,n,&im));
+  for (i=0;i<n;i++) {
+    re[i] = eigr[i];
+    im[i] = eigi? eigi[i]: 0.0;
+  }
+  if (sc->map) PetscCall((*sc->map)(sc->mapobj,n,re,im));
+  if (sc->comparison==SlepcCompareLargestMagnitude) for (i=0;i<n;i++) keys[i] = -SlepcAbsEigenvalue(re[i],im[i]);
+  else if (sc->comparison==SlepcCompareSmallestMagnitude) for (i=0;i<n;i++) keys[i] = SlepcAbsEigenvalue(re[i],im[i]);
+  else if (sc->comparison==SlepcCompareLargestReal) for (i=0;i<n;i++) keys[i] = -PetscRealPart(re[i]);
+  else if (sc->comparison==SlepcCompareSmallestReal) for (i=0;i<n;i++) keys[i] = PetscRealPart(re[i]);
+#if defined(PETSC_USE_COMPLEX)
+  else if (sc->comparison==SlepcCompareLargestImaginary) for (i=0;i<n;i++) keys[i] = -PetscImaginaryPart(re[i]);
+  else if (sc->comparison==SlepcCompareSmallestImaginary) for (i=0;i<n;i++) keys[i] = PetscImaginaryPart(re[i]);
+  else if (sc->comparison==SlepcCompareTargetImaginary) for (i=0;i<n;i++) keys[i] = PetscAbsReal(PetscImaginaryPart(re[i]-target));
+#else
+  else if (sc->comparison==SlepcCompareLargestImaginary) for (i=0;i<n;i++) keys[i] = -PetscAbsReal(im[i]);
+  else if (sc->comparison==SlepcCompareSmallestImaginary) for (i=0;i<n;i++) keys[i] = PetscAbsReal(im[i]);
+#endif
+  else if (sc->comparison==SlepcCompareTargetMagnitude) for (i=0;i<n;i++) keys[i] = SlepcAbsEigenvalue(re[i]-target,im[i]);
+  else for (i=0;i<n;i++) keys[i] = PetscAbsReal(PetscRealPart(re[i]-target));
+  if (sc->rg) {
+    PetscCall(PetscMalloc1(n,&cin));
+    PetscCall(RGCheckInside(sc->rg,n,re,im,cin));
+    kmin = kmax = keys[0];
+    for (i=1;i<n;i++) {
+      kmin = PetscMin(kmin,keys[i]);
+      kmax = PetscMax(kmax,keys[i]);
+    }
+    /* shift values lying outside the region past all the inside ones */
+    for (i=0;i<n;i++) if (cin[i]<0) keys[i] += kmax-kmin+1.0;
+    PetscCall(PetscFree(cin));
+  }
+  PetscCall(PetscFree2(re,im));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    SlepcSortEigenvalues - Sorts a list of eigenvalues according to the
    sorting criterion specified in a SlepcSC context.
@@ -89,17 +177,23 @@ PetscErrorCode SlepcSCCompare(SlepcSC sc,PetscScalar ar,PetscScalar ai,PetscScal
 PetscErrorCode SlepcSortEigenvalues(SlepcSC sc,PetscInt n,PetscScalar *eigr,PetscScalar *eigi,PetscInt *perm)
 {
   PetscScalar    re,im;
+  PetscReal      *keys,ki=0.0;
   PetscInt       i,j,result,tmp;
+  PetscBool      avail;
 
   PetscFunctionBegin;
   PetscAssertPointer(sc,1);
   PetscAssertPointer(eigr,3);
   PetscAssertPointer(eigi,4);
   PetscAssertPointer(perm,5);
+  /* extract sorting keys in a single batched pass whenever the criterion allows it */
+  PetscCall(PetscMalloc1(n,&keys));
+  PetscCall(SlepcSCComputeKeys(sc,n,eigr,eigi,keys,&avail));
   /* insertion sort */
   for (i=n-1;i>=0;i--) {
     re = eigr[perm[i]];
     im = eigi[perm[i]];
+    if (avail) ki = keys[perm[i]];
     j = i+1;
 #if !defined(PETSC_USE_COMPLEX)
     if (im!=0) {
@@ -109,7 +203,8 @@ PetscErrorCode SlepcSortEigenvalues(SlepcSC sc,PetscInt n,PetscScalar *eigr,Pets
     }
 #endif
     while (j<n) {
-      PetscCall(SlepcSCCompare(sc,re,im,eigr[perm[j]],eigi[perm[j]],&result));
+      if (avail) result = (ki<keys[perm[j]])? -1: ((ki>keys[perm[j]])? 1: 0);
+      else PetscCall(SlepcSCCompare(sc,re,im,eigr[perm[j]],eigi[perm[j]],&result));
       if (result<=0) break;
 #if !defined(PETSC_USE_COMPLEX)
       /* keep together every complex conjugated eigenpair */
@@ -136,6 +231,7 @@ PetscErrorCode SlepcSortEigenvalues(SlepcSC sc,PetscInt n,PetscScalar *eigr,Pets
 #endif
     }
   }
+  PetscCall(PetscFree(keys));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
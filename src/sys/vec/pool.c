@@ -54,21 +54,38 @@ PetscErrorCode SlepcVecPoolCreate(Vec v,PetscInt init_size,VecPool *p)
    Input Parameters:
 .  p - pool of Vec.
 
+   Options Database Key:
+.  -slepc_pool_view - print usage statistics of the pool being destroyed
+
    Level: developer
 
 .seealso: SlepcVecPoolGetVecs(), SlepcVecPoolCreate()
 */
 PetscErrorCode SlepcVecPoolDestroy(VecPool *p)
 {
-  VecPool_       *pool = (VecPool_*)*p;
+  VecPool_       *pool = (VecPool_*)*p,*next;
+  PetscInt       nalloc,N;
+  PetscBool      flg;
+  PetscViewer    viewer;
 
   PetscFunctionBegin;
   if (!*p) PetscFunctionReturn(PETSC_SUCCESS);
+  if (pool->gets) {  /* only the head of the list keeps statistics */
+    PetscCall(PetscOptionsHasName(NULL,NULL,"-slepc_pool_view",&flg));
+    if (flg) {
+      for (nalloc=0,next=pool;next;next=next->next) nalloc += next->n;
+      PetscCall(VecGetSize(pool->v,&N));
+      PetscCall(PetscViewerASCIIGetStdout(PetscObjectComm((PetscObject)pool->v),&viewer));
+      PetscCall(PetscViewerASCIIPrintf(viewer,"Vec pool: %" PetscInt_FMT " vectors of length %" PetscInt_FMT " allocated, high-water mark %" PetscInt_FMT ", served %" PetscInt_FMT " requests\n",nalloc,N,pool->hwm,pool->gets));
+    }
+  }
   PetscCall(VecDestroy(&pool->v));
   PetscCall(VecDestroyVecs(pool->n,&pool->vecs));
   pool->n     = 0;
   pool->used  = 0;
   pool->guess = 0;
+  pool->hwm   = 0;
+  pool->gets  = 0;
   PetscCall(SlepcVecPoolDestroy((VecPool*)&pool->next));
   PetscCall(PetscFree(pool));
   *p = NULL;
@@ -94,6 +111,7 @@ PetscErrorCode SlepcVecPoolDestroy(VecPool *p)
 PetscErrorCode SlepcVecPoolGetVecs(VecPool p,PetscInt n,Vec **vecs)
 {
   VecPool_       *pool = (VecPool_*)p;
+  PetscInt       nused;
 
   PetscFunctionBegin;
   PetscAssertPointer(p,1);
@@ -112,6 +130,9 @@ PetscErrorCode SlepcVecPoolGetVecs(VecPool p,PetscInt n,Vec **vecs)
   }
   *vecs = pool->vecs + pool->used;
   pool->used += n;
+  for (nused=0,pool=(VecPool_*)p;pool;pool=pool->next) nused += pool->used;
+  p->hwm = PetscMax(p->hwm,nused);
+  p->gets++;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -144,5 +165,42 @@ PetscErrorCode SlepcVecPoolRestoreVecs(VecPool p,PetscInt n,Vec **vecs)
   }
   pool->used -= n;
   PetscCheck(pool->used>=0,PetscObjectComm((PetscObject)pool->v),PETSC_ERR_ARG_OUTOFRANGE,"Unmatched SlepcVecPoolRestoreVecs");
+  /* when the pool becomes idle, release vectors beyond the observed maximum simultaneous need */
+  if (pool == (VecPool_*)p && pool->used == 0 && pool->n > pool->hwm) PetscCall(SlepcVecPoolShrink(p,pool->hwm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SlepcVecPoolShrink - Free vectors of the pool that are not currently in use,
+   keeping at most nkeep of them allocated.
+
+   Collective
+
+   Input Parameters:
++  p     - pool of Vec.
+-  nkeep - number of unused vectors to keep allocated.
+
+   Note:
+   The freed vectors are duplicated again from the template when needed, so this
+   is intended for releasing memory between distant uses of the pool. The value
+   of nkeep is irrelevant if more vectors are currently checked out.
+
+   Level: developer
+
+.seealso: SlepcVecPoolGetVecs(), SlepcVecPoolRestoreVecs()
+*/
+PetscErrorCode SlepcVecPoolShrink(VecPool p,PetscInt nkeep)
+{
+  VecPool_       *pool = (VecPool_*)p;
+  PetscInt       i,newn;
+
+  PetscFunctionBegin;
+  PetscAssertPointer(p,1);
+  PetscCheck(nkeep>=0,PetscObjectComm((PetscObject)pool->v),PETSC_ERR_ARG_OUTOFRANGE,"nkeep should be positive");
+  while (pool->next) pool = pool->next;
+  newn = PetscMax(pool->used,nkeep);
+  for (i=newn;i<pool->n;i++) PetscCall(VecDestroy(&pool->vecs[i]));
+  if (!newn && pool->vecs) PetscCall(PetscFree(pool->vecs));
+  pool->n = newn;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -21,6 +21,8 @@ static inline PetscReal GetNorm2(PetscReal,PetscReal);
 static inline void AddNorm2(PetscReal*,PetscReal*,PetscReal);
 static PetscErrorCode VecCompSetSubVecs_Comp(Vec,PetscInt,Vec*);
 static PetscErrorCode VecCompGetSubVecs_Comp(Vec,PetscInt*,const Vec**);
+static PetscErrorCode VecCompNormComponents_Comp(Vec,NormType,PetscReal*);
+static PetscErrorCode VecCompDotComponents_Comp(Vec,Vec,PetscScalar*);
 
 #include "veccomp0.h"
 
@@ -120,6 +122,8 @@ PetscErrorCode VecDestroy_Comp(Vec v)
   PetscCall(PetscFree(vs));
   PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompSetSubVecs_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompGetSubVecs_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompNormComponents_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompDotComponents_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -277,6 +281,8 @@ static PetscErrorCode VecCreate_Comp_Private(Vec v,Vec *x,PetscInt nx,PetscBool
   PetscCall(PetscObjectChangeTypeName((PetscObject)v,VECCOMP));
   PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompSetSubVecs_C",VecCompSetSubVecs_Comp));
   PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompGetSubVecs_C",VecCompGetSubVecs_Comp));
+  PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompNormComponents_C",VecCompNormComponents_Comp));
+  PetscCall(PetscObjectComposeFunction((PetscObject)v,"VecCompDotComponents_C",VecCompDotComponents_Comp));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -475,6 +481,133 @@ PetscErrorCode VecCompSetSubVecs(Vec win,PetscInt n,Vec *x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode VecCompNormComponents_Comp(Vec win,NormType t,PetscReal *norms)
+{
+  Vec_Comp       *s = (Vec_Comp*)win->data;
+  PetscReal      *work,nrm;
+  PetscMPIInt    size;
+  PetscInt       i,n;
+
+  PetscFunctionBegin;
+  SlepcValidVecComp(win,1);
+  PetscCheck(t==NORM_1 || t==NORM_2 || t==NORM_FROBENIUS || t==NORM_INFINITY,PetscObjectComm((PetscObject)win),PETSC_ERR_SUP,"Norm type not supported");
+  n = s->n->n;
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)win),&size));
+  if (size>1 && n && s->x[0]->ops->norm_local) {
+    /* compute all local norms, then fuse the communication in one reduction */
+    if (t==NORM_2 || t==NORM_FROBENIUS) {
+      PetscCall(PetscMalloc1(4*n,&work));
+      for (i=0;i<n;i++) {
+        PetscUseTypeMethod(s->x[i],norm_local,t,&nrm);
+        work[2*i] = 1.0; work[2*i+1] = 0.0;   /* (ssq,scale) pair */
+        AddNorm2(&work[2*i],&work[2*i+1],nrm);
+      }
+      PetscCall(MPIU_Allreduce(work,work+2*n,n,MPIU_NORM2,MPIU_NORM2_SUM,PetscObjectComm((PetscObject)win)));
+      for (i=0;i<n;i++) norms[i] = GetNorm2(work[2*n+2*i],work[2*n+2*i+1]);
+    } else {
+      PetscCall(PetscMalloc1(n,&work));
+      for (i=0;i<n;i++) PetscUseTypeMethod(s->x[i],norm_local,t,&work[i]);
+      PetscCall(MPIU_Allreduce(work,norms,n,MPIU_REAL,t==NORM_1?MPIU_SUM:MPIU_MAX,PetscObjectComm((PetscObject)win)));
+    }
+    PetscCall(PetscFree(work));
+  } else {
+    for (i=0;i<n;i++) PetscCall(VecNorm(s->x[i],t,norms+i));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+   VecCompNormComponents - Computes the norm of each of the component vectors
+   of a compound vector.
+
+   Collective
+
+   Input Parameters:
++  win - compound vector
+-  t   - the norm type
+
+   Output Parameter:
+.  norms - array with the norm of each child vector
+
+   Notes:
+   The norms array must have at least as many entries as child vectors.
+
+   This is equivalent to computing the norm of each child vector separately,
+   but the communication of all partial results is fused in a single
+   reduction. NORM_1_AND_2 is not supported.
+
+   Level: developer
+
+.seealso: VecCompDotComponents(), VecCompGetSubVecs(), VecCreateComp()
+@*/
+PetscErrorCode VecCompNormComponents(Vec win,NormType t,PetscReal norms[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(win,VEC_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(win,t,2);
+  PetscAssertPointer(norms,3);
+  PetscUseMethod(win,"VecCompNormComponents_C",(Vec,NormType,PetscReal*),(win,t,norms));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode VecCompDotComponents_Comp(Vec win,Vec w,PetscScalar *dots)
+{
+  Vec_Comp       *vs = (Vec_Comp*)win->data,*ws = (Vec_Comp*)w->data;
+  PetscScalar    *work;
+  PetscMPIInt    size;
+  PetscInt       i,n;
+
+  PetscFunctionBegin;
+  SlepcValidVecComp(win,1);
+  SlepcValidVecComp(w,2);
+  n = vs->n->n;
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)win),&size));
+  if (size>1 && n && vs->x[0]->ops->dot_local) {
+    /* compute all local dot products, then fuse the communication in one reduction */
+    PetscCall(PetscMalloc1(n,&work));
+    for (i=0;i<n;i++) PetscUseTypeMethod(vs->x[i],dot_local,ws->x[i],&work[i]);
+    PetscCall(MPIU_Allreduce(work,dots,n,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)win)));
+    PetscCall(PetscFree(work));
+  } else {
+    for (i=0;i<n;i++) PetscCall(VecDot(vs->x[i],ws->x[i],dots+i));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+   VecCompDotComponents - Computes the dot product of each pair of component
+   vectors of two compound vectors.
+
+   Collective
+
+   Input Parameters:
++  win - first compound vector
+-  w   - second compound vector
+
+   Output Parameter:
+.  dots - array with the dot product of each pair of child vectors
+
+   Notes:
+   The dots array must have at least as many entries as child vectors.
+
+   This is equivalent to computing the dot product of each pair of child
+   vectors separately, but the communication of all partial results is fused
+   in a single reduction.
+
+   Level: developer
+
+.seealso: VecCompNormComponents(), VecCompGetSubVecs(), VecCreateComp()
+@*/
+PetscErrorCode VecCompDotComponents(Vec win,Vec w,PetscScalar dots[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(win,VEC_CLASSID,1);
+  PetscValidHeaderSpecific(w,VEC_CLASSID,2);
+  PetscAssertPointer(dots,3);
+  PetscUseMethod(win,"VecCompDotComponents_C",(Vec,Vec,PetscScalar*),(win,w,dots));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode VecAXPY_Comp(Vec v,PetscScalar alpha,Vec w)
 {
   Vec_Comp       *vs = (Vec_Comp*)v->data,*ws = (Vec_Comp*)w->data;